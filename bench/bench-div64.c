@@ -0,0 +1,166 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * 64-bit divide and multiply: the helpers in libc/stdlib/local-div64.h
+ * against the plain C operators, which call the libgcc routines, and
+ * the libc functions which use the helpers. Each *_c case has a
+ * matching *_helper case over the same values.
+ */
+
+#include "bench.h"
+#include "../libc/stdlib/local-div64.h"
+#include <stdlib.h>
+
+#define NVALS 16
+
+static uint64_t vals[NVALS];
+
+/* Spread over 33..63 bits, where the helpers do their full work */
+static void
+setup_vals(void)
+{
+    uint64_t x = 0x9e3779b97f4a7c15ULL;
+    int      i;
+
+    for (i = 0; i < NVALS; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        vals[i] = x >> (1 + i * 2 % 31);
+    }
+}
+
+/* Keep divisors out of sight of the compiler for the run-time cases */
+static volatile uint32_t div_var = 1000003;
+
+#define DIV_C(name, d)                                       \
+    static void run_##name(unsigned long iters)              \
+    {                                                        \
+        uint64_t sum = 0;                                    \
+        while (iters--) {                                    \
+            uint64_t n = vals[iters % NVALS];                \
+            sum += n / (d) + n % (d);                        \
+        }                                                    \
+        bench_sink = (unsigned long)sum;                     \
+    }
+
+#define DIV_HELPER(name, fn, d)                              \
+    static void run_##name(unsigned long iters)              \
+    {                                                        \
+        uint64_t sum = 0;                                    \
+        while (iters--) {                                    \
+            uint32_t r;                                      \
+            sum += fn(vals[iters % NVALS], d, &r);           \
+            sum += r;                                        \
+        }                                                    \
+        bench_sink = (unsigned long)sum;                     \
+    }
+
+DIV_C(div64_32_c, (uint64_t)div_var)
+DIV_HELPER(div64_32_helper, __udiv64_32, div_var)
+DIV_C(div64_10_c, 10U)
+DIV_HELPER(div64_10_helper, __udiv64_by, 10U)
+DIV_C(div64_60_c, 60U)
+DIV_HELPER(div64_60_helper, __udiv64_by, 60U)
+DIV_C(div64_3600_c, 3600U)
+DIV_HELPER(div64_3600_helper, __udiv64_by, 3600U)
+DIV_C(div64_86400_c, 86400U)
+DIV_HELPER(div64_86400_helper, __udiv64_by, 86400U)
+
+static void
+run_mul64x32_c(unsigned long iters)
+{
+    uint64_t sum = 0;
+
+    while (iters--) {
+        uint64_t p;
+        if (!__builtin_mul_overflow(vals[iters % NVALS] >> 16, (uint64_t)div_var, &p))
+            sum += p;
+    }
+    bench_sink = (unsigned long)sum;
+}
+
+static void
+run_mul64x32_helper(unsigned long iters)
+{
+    uint64_t sum = 0;
+
+    while (iters--) {
+        uint64_t p;
+        if (!__umul64x32_overflow(vals[iters % NVALS] >> 16, div_var, &p))
+            sum += p;
+    }
+    bench_sink = (unsigned long)sum;
+}
+
+static void
+run_strtoull(unsigned long iters)
+{
+    unsigned long long r = 0;
+
+    while (iters--)
+        r += strtoull("12345678901234567890", NULL, 10);
+    bench_sink = (unsigned long)r;
+}
+
+static void
+run_strtoll_base36(unsigned long iters)
+{
+    long long r = 0;
+
+    while (iters--)
+        r += strtoll("-1y2p0ij32e8e7", NULL, 36);
+    bench_sink = (unsigned long)r;
+}
+
+static const struct bench benches[] = {
+    { "div64_32_c", 0, 200, setup_vals, run_div64_32_c },
+    { "div64_32_helper", 0, 200, setup_vals, run_div64_32_helper },
+    { "div64_10_c", 0, 200, setup_vals, run_div64_10_c },
+    { "div64_10_helper", 0, 200, setup_vals, run_div64_10_helper },
+    { "div64_60_c", 0, 200, setup_vals, run_div64_60_c },
+    { "div64_60_helper", 0, 200, setup_vals, run_div64_60_helper },
+    { "div64_3600_c", 0, 200, setup_vals, run_div64_3600_c },
+    { "div64_3600_helper", 0, 200, setup_vals, run_div64_3600_helper },
+    { "div64_86400_c", 0, 200, setup_vals, run_div64_86400_c },
+    { "div64_86400_helper", 0, 200, setup_vals, run_div64_86400_helper },
+    { "mul64x32_c", 0, 200, setup_vals, run_mul64x32_c },
+    { "mul64x32_helper", 0, 200, setup_vals, run_mul64x32_helper },
+    { "strtoull", 20, 200, NULL, run_strtoull },
+    { "strtoll_base36", 14, 200, NULL, run_strtoll_base36 },
+};
+
+BENCH_MAIN(benches)
@@ -0,0 +1,151 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+
+#define BATCH 32
+
+static void *ptrs[BATCH];
+
+/* Sizes for the batch cases, a mix of small and medium blocks */
+static const size_t sizes[BATCH] = {
+    16, 24, 8, 100, 32, 48, 256, 12, 64, 20, 512, 40, 16, 80, 128, 24,
+    8, 200, 36, 16, 1024, 60, 28, 96, 16, 300, 44, 12, 160, 72, 32, 640,
+};
+
+#define MALLOC_FREE(n)                                      \
+    static void run_malloc_free_##n(unsigned long iters)    \
+    {                                                       \
+        while (iters--) {                                   \
+            void *p = malloc(n);                            \
+            bench_sink = (unsigned long)p;                  \
+            free(p);                                        \
+        }                                                   \
+    }
+
+MALLOC_FREE(16)
+MALLOC_FREE(256)
+MALLOC_FREE(4096)
+
+/* Allocate a batch, then free it in reverse order */
+static void
+run_lifo(unsigned long iters)
+{
+    int i;
+
+    while (iters--) {
+        for (i = 0; i < BATCH; i++)
+            ptrs[i] = malloc(sizes[i]);
+        for (i = BATCH; i-- > 0;)
+            free(ptrs[i]);
+    }
+    bench_sink = (unsigned long)ptrs[0];
+}
+
+/* Allocate a batch, then free it in allocation order */
+static void
+run_fifo(unsigned long iters)
+{
+    int i;
+
+    while (iters--) {
+        for (i = 0; i < BATCH; i++)
+            ptrs[i] = malloc(sizes[i]);
+        for (i = 0; i < BATCH; i++)
+            free(ptrs[i]);
+    }
+    bench_sink = (unsigned long)ptrs[0];
+}
+
+/* Keep a batch live and replace one block per operation */
+static void
+setup_churn(void)
+{
+    int i;
+
+    for (i = 0; i < BATCH; i++)
+        ptrs[i] = malloc(sizes[i]);
+}
+
+static void
+run_churn(unsigned long iters)
+{
+    unsigned i = 0;
+
+    while (iters--) {
+        i = (i + 7) % BATCH;
+        free(ptrs[i]);
+        ptrs[i] = malloc(sizes[(i * 5 + iters) % BATCH]);
+    }
+    bench_sink = (unsigned long)ptrs[0];
+}
+
+/* Grow one block from 16 bytes to 4 KiB by doubling, then free it */
+static void
+run_realloc(unsigned long iters)
+{
+    while (iters--) {
+        void  *p = NULL;
+        size_t n;
+        for (n = 16; n <= 4096; n *= 2)
+            p = realloc(p, n);
+        bench_sink = (unsigned long)p;
+        free(p);
+    }
+}
+
+static void
+run_calloc(unsigned long iters)
+{
+    while (iters--) {
+        void *p = calloc(1, 256);
+        bench_sink = (unsigned long)p;
+        free(p);
+    }
+}
+
+static const struct bench benches[] = {
+    { "malloc_free_16", 0, 1000, NULL, run_malloc_free_16 },
+    { "malloc_free_256", 0, 1000, NULL, run_malloc_free_256 },
+    { "malloc_free_4096", 0, 500, NULL, run_malloc_free_4096 },
+    { "calloc_free_256", 256, 500, NULL, run_calloc },
+    { "batch32_lifo", 0, 50, NULL, run_lifo },
+    { "batch32_fifo", 0, 50, NULL, run_fifo },
+    { "batch32_churn", 0, 1000, setup_churn, run_churn },
+    { "realloc_grow_4096", 0, 100, NULL, run_realloc },
+};
+
+BENCH_MAIN(benches)
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bench.h"
+#include <math.h>
+
+#define N 64
+
+static double dx[N], dpos[N];
+static float  fx[N], fpos[N];
+
+static void
+setup(void)
+{
+    int i;
+
+    for (i = 0; i < N; i++) {
+        dx[i] = (i - N / 2) * 0.37 + 0.01;
+        dpos[i] = i * 1.73 + 0.5;
+        fx[i] = (float)dx[i];
+        fpos[i] = (float)dpos[i];
+    }
+}
+
+#define MATH1(name, type, sink, fn, in)                     \
+    static void run_##name(unsigned long iters)             \
+    {                                                       \
+        type r = 0;                                         \
+        while (iters--)                                     \
+            r += fn(in[iters % N]);                         \
+        sink = r;                                           \
+    }
+
+#define MATH2(name, type, sink, fn, in)                     \
+    static void run_##name(unsigned long iters)             \
+    {                                                       \
+        type r = 0;                                         \
+        while (iters--)                                     \
+            r += fn(in[iters % N], in[(iters + 1) % N] / 8); \
+        sink = r;                                           \
+    }
+
+MATH1(sin, double, bench_dsink, sin, dx)
+MATH1(cos, double, bench_dsink, cos, dx)
+MATH1(tan, double, bench_dsink, tan, dx)
+MATH1(atan, double, bench_dsink, atan, dx)
+MATH1(exp, double, bench_dsink, exp, dx)
+MATH1(log, double, bench_dsink, log, dpos)
+MATH1(sqrt, double, bench_dsink, sqrt, dpos)
+MATH1(floor, double, bench_dsink, floor, dx)
+MATH2(pow, double, bench_dsink, pow, dpos)
+MATH2(atan2, double, bench_dsink, atan2, dx)
+MATH1(sinf, float, bench_dsink, sinf, fx)
+MATH1(cosf, float, bench_dsink, cosf, fx)
+MATH1(expf, float, bench_dsink, expf, fx)
+MATH1(logf, float, bench_dsink, logf, fpos)
+MATH1(sqrtf, float, bench_dsink, sqrtf, fpos)
+MATH2(powf, float, bench_dsink, powf, fpos)
+
+static const struct bench benches[] = {
+    { "sin", 0, 50, setup, run_sin },
+    { "cos", 0, 50, setup, run_cos },
+    { "tan", 0, 50, setup, run_tan },
+    { "atan", 0, 50, setup, run_atan },
+    { "exp", 0, 50, setup, run_exp },
+    { "log", 0, 50, setup, run_log },
+    { "sqrt", 0, 50, setup, run_sqrt },
+    { "floor", 0, 200, setup, run_floor },
+    { "pow", 0, 50, setup, run_pow },
+    { "atan2", 0, 50, setup, run_atan2 },
+    { "sinf", 0, 100, setup, run_sinf },
+    { "cosf", 0, 100, setup, run_cosf },
+    { "expf", 0, 100, setup, run_expf },
+    { "logf", 0, 100, setup, run_logf },
+    { "sqrtf", 0, 100, setup, run_sqrtf },
+    { "powf", 0, 100, setup, run_powf },
+};
+
+BENCH_MAIN(benches)
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include "bench.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 256
+
+static int32_t  input[N], work[N];
+static uint32_t uwork[N], tmp[N];
+
+static int
+cmp_int(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void
+setup_random(void)
+{
+    uint32_t x = 2463534242u;
+    int      i;
+
+    for (i = 0; i < N; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        input[i] = (int32_t)x;
+    }
+}
+
+static void
+setup_sorted(void)
+{
+    int i;
+
+    for (i = 0; i < N; i++)
+        input[i] = i;
+}
+
+static void
+setup_few(void)
+{
+    int i;
+
+    setup_random();
+    for (i = 0; i < N; i++)
+        input[i] &= 7;
+}
+
+/* Every operation sorts a fresh copy of input */
+static void
+run_qsort(unsigned long iters)
+{
+    while (iters--) {
+        memcpy(work, input, sizeof(work));
+        qsort(work, N, sizeof(work[0]), cmp_int);
+    }
+    bench_sink = work[0];
+}
+
+static void
+run_qsort_int32(unsigned long iters)
+{
+    while (iters--) {
+        memcpy(work, input, sizeof(work));
+        qsort_int32(work, N);
+    }
+    bench_sink = work[0];
+}
+
+static void
+run_radixsort(unsigned long iters)
+{
+    while (iters--) {
+        memcpy(uwork, input, sizeof(uwork));
+        radixsort_uint32(uwork, N, tmp);
+    }
+    bench_sink = uwork[0];
+}
+
+static void
+run_bsearch(unsigned long iters)
+{
+    unsigned long r = 0;
+
+    while (iters--) {
+        int32_t key = (int32_t)(iters % N);
+        r += bsearch(&key, input, N, sizeof(input[0]), cmp_int) != NULL;
+    }
+    bench_sink = r;
+}
+
+static const struct bench benches[] = {
+    { "qsort_256_random", N * 4, 10, setup_random, run_qsort },
+    { "qsort_256_sorted", N * 4, 10, setup_sorted, run_qsort },
+    { "qsort_256_few_unique", N * 4, 10, setup_few, run_qsort },
+    { "qsort_int32_256_random", N * 4, 10, setup_random, run_qsort_int32 },
+    { "radixsort_uint32_256_random", N * 4, 10, setup_random, run_radixsort },
+    { "bsearch_256", 0, 500, setup_sorted, run_bsearch },
+};
+
+BENCH_MAIN(benches)
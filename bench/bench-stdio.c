@@ -0,0 +1,113 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bench.h"
+#include <stdio.h>
+
+static char buf[64];
+
+#define SNPRINTF(name, fmt, val)                                       \
+    static void run_##name(unsigned long iters)                        \
+    {                                                                  \
+        int r = 0;                                                     \
+        while (iters--)                                                \
+            r += snprintf(buf, sizeof(buf), fmt, val);                 \
+        bench_sink = r;                                                \
+    }
+
+#define SSCANF(name, str, fmt, type)                                   \
+    static void run_##name(unsigned long iters)                        \
+    {                                                                  \
+        type v = 0;                                                    \
+        int  r = 0;                                                    \
+        while (iters--)                                                \
+            r += sscanf(str, fmt, &v);                                 \
+        bench_sink = r + (unsigned long)v;                             \
+    }
+
+SNPRINTF(printf_d, "%d", -123456789)
+SNPRINTF(printf_u_small, "%u", 7u)
+SNPRINTF(printf_x, "%08x", 0xdeadbeefu)
+SNPRINTF(printf_lld, "%lld", -1234567890123456789LL)
+SNPRINTF(printf_s, "%s", "hello, world")
+SNPRINTF(printf_g, "%g", 3.14159265358979)
+SNPRINTF(printf_f, "%.6f", 12345.678901)
+SNPRINTF(printf_e, "%.15e", 1.0 / 3.0)
+
+static void
+run_printf_mixed(unsigned long iters)
+{
+    int r = 0;
+
+    while (iters--)
+        r += snprintf(buf, sizeof(buf), "[%5d] %-8s %04x %c", (int)iters, "name", 0xab, 'z');
+    bench_sink = r;
+}
+
+SSCANF(scanf_d, "-123456789", "%d", int)
+SSCANF(scanf_x, "deadbeef", "%x", unsigned)
+SSCANF(scanf_lld, "-1234567890123456789", "%lld", long long)
+SSCANF(scanf_lf, "3.14159265358979", "%lf", double)
+
+static void
+run_scanf_mixed(unsigned long iters)
+{
+    int      a = 0, r = 0;
+    unsigned b = 0;
+    char     s[16];
+
+    while (iters--)
+        r += sscanf("42 name ff", "%d %15s %x", &a, s, &b);
+    bench_sink = r + a + b;
+}
+
+static const struct bench benches[] = {
+    { "snprintf_d", 0, 200, NULL, run_printf_d },
+    { "snprintf_u_small", 0, 200, NULL, run_printf_u_small },
+    { "snprintf_08x", 0, 200, NULL, run_printf_x },
+    { "snprintf_lld", 0, 100, NULL, run_printf_lld },
+    { "snprintf_s", 0, 200, NULL, run_printf_s },
+    { "snprintf_g", 0, 50, NULL, run_printf_g },
+    { "snprintf_f", 0, 50, NULL, run_printf_f },
+    { "snprintf_e", 0, 50, NULL, run_printf_e },
+    { "snprintf_mixed", 0, 100, NULL, run_printf_mixed },
+    { "sscanf_d", 0, 200, NULL, run_scanf_d },
+    { "sscanf_x", 0, 200, NULL, run_scanf_x },
+    { "sscanf_lld", 0, 100, NULL, run_scanf_lld },
+    { "sscanf_lf", 0, 50, NULL, run_scanf_lf },
+    { "sscanf_mixed", 0, 100, NULL, run_scanf_mixed },
+};
+
+BENCH_MAIN(benches)
@@ -0,0 +1,282 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bench.h"
+#include <string.h>
+#include <strings.h>
+#include <wchar.h>
+
+#define BUF_SIZE 1100
+
+static char src[BUF_SIZE] __attribute__((aligned(8)));
+static char dst[BUF_SIZE] __attribute__((aligned(8)));
+static wchar_t wsrc[BUF_SIZE];
+static wchar_t wdst[BUF_SIZE];
+
+static void
+setup(void)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(src) - 1; i++)
+        src[i] = dst[i] = 'a' + i % 26;
+    src[sizeof(src) - 1] = dst[sizeof(dst) - 1] = '\0';
+}
+
+static void
+setup_wide(void)
+{
+    size_t i;
+
+    for (i = 0; i < BUF_SIZE - 1; i++)
+        wsrc[i] = wdst[i] = 0x4e00 + i % 26;
+    wsrc[BUF_SIZE - 1] = wdst[BUF_SIZE - 1] = 0;
+}
+
+/* Terminate both wide strings after n characters */
+#define WCS_SETUP(n)                    \
+    static void setup_wcs_##n(void)     \
+    {                                   \
+        setup_wide();                   \
+        wsrc[n] = wdst[n] = 0;          \
+    }
+
+/* Terminate both strings after n characters */
+#define STR_SETUP(n)                    \
+    static void setup_str_##n(void)     \
+    {                                   \
+        setup();                        \
+        src[n] = dst[n] = '\0';         \
+    }
+
+#define MEMCPY(n, off)                                              \
+    static void run_memcpy_##n##_##off(unsigned long iters)         \
+    {                                                               \
+        while (iters--)                                             \
+            memcpy(dst + (off), src, n);                            \
+        bench_sink = dst[(off)];                                    \
+    }
+
+#define MEMMOVE(n)                                                  \
+    static void run_memmove_##n(unsigned long iters)                \
+    {                                                               \
+        while (iters--)                                             \
+            memmove(dst + 1, dst, n);                               \
+        bench_sink = dst[1];                                        \
+    }
+
+#define MEMSET(n)                                                   \
+    static void run_memset_##n(unsigned long iters)                 \
+    {                                                               \
+        while (iters--)                                             \
+            memset(dst, (int)iters, n);                             \
+        bench_sink = dst[0];                                        \
+    }
+
+#define MEMCMP(n)                                                   \
+    static void run_memcmp_##n(unsigned long iters)                 \
+    {                                                               \
+        int r = 0;                                                  \
+        while (iters--)                                             \
+            r += memcmp(dst, src, n);                               \
+        bench_sink = r;                                             \
+    }
+
+#define MEMCMP_OFF(n, off)                                          \
+    static void run_memcmp_##n##_##off(unsigned long iters)         \
+    {                                                               \
+        int r = 0;                                                  \
+        while (iters--)                                             \
+            r += memcmp(dst + (off), src + (off), n);               \
+        bench_sink = r;                                             \
+    }
+
+#define BCMP(n)                                                     \
+    static void run_bcmp_##n(unsigned long iters)                   \
+    {                                                               \
+        int r = 0;                                                  \
+        while (iters--)                                             \
+            r += bcmp(dst, src, n);                                 \
+        bench_sink = r;                                             \
+    }
+
+#define STRLEN(n)                                                   \
+    STR_SETUP(n)                                                    \
+    static void run_strlen_##n(unsigned long iters)                 \
+    {                                                               \
+        size_t r = 0;                                               \
+        while (iters--)                                             \
+            r += strlen(src);                                       \
+        bench_sink = r;                                             \
+    }
+
+#define STRCMP(n)                                                   \
+    static void run_strcmp_##n(unsigned long iters)                 \
+    {                                                               \
+        int r = 0;                                                  \
+        while (iters--)                                             \
+            r += strcmp(dst, src);                                  \
+        bench_sink = r;                                             \
+    }
+
+#define STRNCMP(n)                                                  \
+    static void run_strncmp_##n(unsigned long iters)                \
+    {                                                               \
+        int r = 0;                                                  \
+        while (iters--)                                             \
+            r += strncmp(dst, src, n);                              \
+        bench_sink = r;                                             \
+    }
+
+#define STRCPY(n)                                                   \
+    static void run_strcpy_##n(unsigned long iters)                 \
+    {                                                               \
+        while (iters--)                                             \
+            strcpy(dst + 64, src);                                  \
+        bench_sink = dst[64];                                       \
+    }
+
+#define WCSLEN(n)                                                   \
+    WCS_SETUP(n)                                                    \
+    static void run_wcslen_##n(unsigned long iters)                 \
+    {                                                               \
+        size_t r = 0;                                               \
+        while (iters--)                                             \
+            r += wcslen(wsrc);                                      \
+        bench_sink = r;                                             \
+    }
+
+#define WCSCMP(n)                                                   \
+    static void run_wcscmp_##n(unsigned long iters)                 \
+    {                                                               \
+        int r = 0;                                                  \
+        while (iters--)                                             \
+            r += wcscmp(wdst, wsrc);                                \
+        bench_sink = r;                                             \
+    }
+
+#define WCSCHR(n)                                                   \
+    static void run_wcschr_##n(unsigned long iters)                 \
+    {                                                               \
+        size_t r = 0;                                               \
+        while (iters--)                                             \
+            r += wcschr(wsrc, 1) == NULL;                           \
+        bench_sink = r;                                             \
+    }
+
+#define WMEMCHR(n)                                                  \
+    static void run_wmemchr_##n(unsigned long iters)                \
+    {                                                               \
+        size_t r = 0;                                               \
+        while (iters--)                                             \
+            r += wmemchr(wsrc, 1, n) == NULL;                       \
+        bench_sink = r;                                             \
+    }
+
+#define WMEMSET(n)                                                  \
+    static void run_wmemset_##n(unsigned long iters)                \
+    {                                                               \
+        while (iters--)                                             \
+            wmemset(wdst, 0x4e00 + (wchar_t)(iters & 0xff), n);     \
+        bench_sink = wdst[0];                                       \
+    }
+
+MEMCPY(8, 0)
+MEMCPY(64, 0)
+MEMCPY(1024, 0)
+MEMCPY(1024, 1)
+MEMMOVE(1024)
+MEMSET(8)
+MEMSET(64)
+MEMSET(1024)
+MEMCMP(64)
+MEMCMP(1024)
+MEMCMP_OFF(1024, 1)
+BCMP(64)
+BCMP(1024)
+STRLEN(8)
+STRLEN(64)
+STRLEN(1024)
+STRCMP(8)
+STRCMP(64)
+STRCMP(1024)
+STRNCMP(1024)
+STRCPY(64)
+STRCPY(1024)
+WCSLEN(8)
+WCSLEN(64)
+WCSLEN(1024)
+WCSCMP(64)
+WCSCMP(1024)
+WCSCHR(1024)
+WMEMCHR(1024)
+WMEMSET(64)
+WMEMSET(1024)
+
+static const struct bench benches[] = {
+    { "memcpy_8", 8, 2000, setup, run_memcpy_8_0 },
+    { "memcpy_64", 64, 1000, setup, run_memcpy_64_0 },
+    { "memcpy_1024", 1024, 200, setup, run_memcpy_1024_0 },
+    { "memcpy_1024_unaligned", 1024, 200, setup, run_memcpy_1024_1 },
+    { "memmove_1024_overlap", 1024, 200, setup, run_memmove_1024 },
+    { "memset_8", 8, 2000, setup, run_memset_8 },
+    { "memset_64", 64, 1000, setup, run_memset_64 },
+    { "memset_1024", 1024, 200, setup, run_memset_1024 },
+    { "memcmp_64", 64, 1000, setup, run_memcmp_64 },
+    { "memcmp_1024", 1024, 200, setup, run_memcmp_1024 },
+    { "memcmp_1024_unaligned", 1024, 200, setup, run_memcmp_1024_1 },
+    { "bcmp_64", 64, 1000, setup, run_bcmp_64 },
+    { "bcmp_1024", 1024, 200, setup, run_bcmp_1024 },
+    { "strlen_8", 8, 2000, setup_str_8, run_strlen_8 },
+    { "strlen_64", 64, 1000, setup_str_64, run_strlen_64 },
+    { "strlen_1024", 1024, 200, setup_str_1024, run_strlen_1024 },
+    { "strcmp_8", 8, 2000, setup_str_8, run_strcmp_8 },
+    { "strcmp_64", 64, 1000, setup_str_64, run_strcmp_64 },
+    { "strcmp_1024", 1024, 200, setup_str_1024, run_strcmp_1024 },
+    { "strncmp_1024", 1024, 200, setup_str_1024, run_strncmp_1024 },
+    { "strcpy_64", 64, 1000, setup_str_64, run_strcpy_64 },
+    { "strcpy_1024", 1024, 200, setup_str_1024, run_strcpy_1024 },
+    { "wcslen_8", 8 * sizeof(wchar_t), 2000, setup_wcs_8, run_wcslen_8 },
+    { "wcslen_64", 64 * sizeof(wchar_t), 1000, setup_wcs_64, run_wcslen_64 },
+    { "wcslen_1024", 1024 * sizeof(wchar_t), 200, setup_wcs_1024, run_wcslen_1024 },
+    { "wcscmp_64", 64 * sizeof(wchar_t), 1000, setup_wcs_64, run_wcscmp_64 },
+    { "wcscmp_1024", 1024 * sizeof(wchar_t), 200, setup_wcs_1024, run_wcscmp_1024 },
+    { "wcschr_1024", 1024 * sizeof(wchar_t), 200, setup_wcs_1024, run_wcschr_1024 },
+    { "wmemchr_1024", 1024 * sizeof(wchar_t), 200, setup_wide, run_wmemchr_1024 },
+    { "wmemset_64", 64 * sizeof(wchar_t), 1000, setup_wide, run_wmemset_64 },
+    { "wmemset_1024", 1024 * sizeof(wchar_t), 200, setup_wide, run_wmemset_1024 },
+};
+
+BENCH_MAIN(benches)
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include "bench.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STRTOD(name, str)                                   \
+    static void run_##name(unsigned long iters)             \
+    {                                                       \
+        double r = 0;                                       \
+        while (iters--)                                     \
+            r += strtod(str, NULL);                         \
+        bench_dsink = r;                                    \
+    }
+
+STRTOD(strtod_short, "3.25")
+STRTOD(strtod_pi, "3.14159265358979323846")
+STRTOD(strtod_large, "1.7976931348623157e308")
+STRTOD(strtod_small, "4.9406564584124654e-324")
+STRTOD(strtod_long_digits, "123456789012345678901234567890.123456789e-10")
+
+static void
+run_strtof(unsigned long iters)
+{
+    float r = 0;
+
+    while (iters--)
+        r += strtof("3.1415927", NULL);
+    bench_dsink = r;
+}
+
+static void
+run_strtol(unsigned long iters)
+{
+    long r = 0;
+
+    while (iters--)
+        r += strtol("-123456789", NULL, 10);
+    bench_sink = r;
+}
+
+static void
+run_strtoull(unsigned long iters)
+{
+    unsigned long long r = 0;
+
+    while (iters--)
+        r += strtoull("18446744073709551615", NULL, 10);
+    bench_sink = (unsigned long)r;
+}
+
+static const char csv[] = "1.5,2.25,-3.125,4e3,0.001,6.02e23,7,8.5,"
+                          "9.75,10.125,-11,12.5e-3,13,14.0625,15.5,16";
+
+static void
+run_strtod_loop(unsigned long iters)
+{
+    double r = 0;
+
+    while (iters--) {
+        const char *p = csv;
+        char       *end;
+        for (;;) {
+            r += strtod(p, &end);
+            if (*end != ',')
+                break;
+            p = end + 1;
+        }
+    }
+    bench_dsink = r;
+}
+
+static void
+run_strtod_array(unsigned long iters)
+{
+    double vals[16];
+    double r = 0;
+
+    while (iters--) {
+        strtod_array(csv, sizeof(csv) - 1, vals, 16, NULL);
+        r += vals[15];
+    }
+    bench_dsink = r;
+}
+
+static const struct bench benches[] = {
+    { "strtod_short", 4, 100, NULL, run_strtod_short },
+    { "strtod_pi", 22, 100, NULL, run_strtod_pi },
+    { "strtod_large", 22, 100, NULL, run_strtod_large },
+    { "strtod_small", 23, 100, NULL, run_strtod_small },
+    { "strtod_long_digits", 44, 50, NULL, run_strtod_long_digits },
+    { "strtof", 9, 100, NULL, run_strtof },
+    { "strtol", 10, 500, NULL, run_strtol },
+    { "strtoull", 20, 200, NULL, run_strtoull },
+    { "strtod_16_csv", sizeof(csv) - 1, 20, NULL, run_strtod_loop },
+    { "strtod_array_16_csv", sizeof(csv) - 1, 20, NULL, run_strtod_array },
+};
+
+BENCH_MAIN(benches)
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Microbenchmark harness for run_picolibc_bench.py.
+ *
+ * Each bench-*.c file fills in a table of struct bench and ends with
+ * BENCH_MAIN(table). The runner builds every file several times:
+ *
+ *  - without BENCH_CASE, the program prints one line per case,
+ *    "BENCH <index> <name> <bytes> <iters>", and exits;
+ *
+ *  - with -DBENCH_CASE=<index> -DBENCH_ITERS=<n>, the program runs the
+ *    setup function of that case and then n operations of it.
+ *
+ * The emulator reports the cycles used by the whole program. The runner
+ * subtracts a BENCH_ITERS=0 run of the same case, which removes startup,
+ * setup and exit, and divides by n to get cycles per operation. Cases
+ * which work on a buffer give its size in bytes so that the runner can
+ * also report cycles per byte.
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+struct bench {
+    const char   *name;
+    size_t        bytes; /* bytes handled by one operation, 0 if not meaningful */
+    unsigned long iters; /* default number of operations */
+    void (*setup)(void); /* may be NULL */
+    void (*run)(unsigned long n);
+};
+
+/* Results are stored here so the compiler cannot drop the work */
+static volatile unsigned long bench_sink;
+static volatile double        bench_dsink;
+
+#define BENCH_COUNT(t) (sizeof(t) / sizeof((t)[0]))
+
+#ifdef BENCH_CASE
+
+#ifndef BENCH_ITERS
+#define BENCH_ITERS 1
+#endif
+
+#define BENCH_MAIN(t)                             \
+    int main(void)                                \
+    {                                             \
+        const struct bench *b = &(t)[BENCH_CASE]; \
+        if (b->setup)                             \
+            b->setup();                           \
+        b->run(BENCH_ITERS);                      \
+        return 0;                                 \
+    }
+
+#else
+
+#define BENCH_MAIN(t)                                                                      \
+    int main(void)                                                                         \
+    {                                                                                      \
+        size_t i;                                                                          \
+        for (i = 0; i < BENCH_COUNT(t); i++)                                               \
+            printf("BENCH %u %s %lu %lu\n", (unsigned)i, (t)[i].name,                     \
+                   (unsigned long)(t)[i].bytes, (t)[i].iters);                             \
+        return 0;                                                                          \
+    }
+
+#endif
+
+#endif /* _BENCH_H_ */
@@ -0,0 +1,161 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Replays an allocation trace recorded with malloc_trace_start.
+ *
+ * run_malloc_replay.py decodes the trace and writes it as the
+ * replay_ops table in malloc-replay-data.h, with each pointer replaced
+ * by a slot number so that replaying needs no lookups: a slot holds a
+ * live block from its allocation to its release, and slots are reused
+ * afterwards; realloc keeps the slot of the block it resizes.
+ * REPLAY_NONE stands for NULL, for blocks allocated before the trace
+ * started and for allocations that failed in the recorded run.
+ *
+ * Built with -DREPLAY_OPS=<n>, the program replays the first n records
+ * and exits; as for bench.h, the runner subtracts the cycles of a
+ * REPLAY_OPS=0 build. With -DREPLAY_STATS, it also follows the heap
+ * size (mallinfo arena) and the bytes requested by live blocks after
+ * every record and prints their peaks in one line,
+ *
+ *   REPLAY <records> <failed allocations> <peak heap> <peak live>
+ *
+ * from which the runner computes the fragmentation.
+ */
+
+#include <malloc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define REPLAY_NONE UINT32_MAX
+
+struct replay_op {
+    uint8_t  op;    /* MALLOC_TRACE_ */
+    uint32_t slot;  /* where the result goes */
+    uint32_t old;   /* block released by FREE and REALLOC */
+    uint32_t size;
+    uint32_t align; /* MEMALIGN */
+};
+
+/* Defines REPLAY_SLOTS and replay_ops */
+#include "malloc-replay-data.h"
+
+#define REPLAY_COUNT (sizeof(replay_ops) / sizeof(replay_ops[0]))
+
+#ifndef REPLAY_OPS
+#define REPLAY_OPS REPLAY_COUNT
+#endif
+
+static void *slots[REPLAY_SLOTS];
+
+#ifdef REPLAY_STATS
+static size_t slot_size[REPLAY_SLOTS];
+#endif
+
+int
+main(void)
+{
+    /* volatile keeps the table in the REPLAY_OPS=0 build */
+    volatile unsigned long   nops = REPLAY_OPS;
+    const struct replay_op  *r;
+    unsigned long            i, failed = 0;
+    void                    *p;
+#ifdef REPLAY_STATS
+    size_t live = 0, peak_live = 0, peak_heap = 0, heap;
+#endif
+
+    for (i = 0, r = replay_ops; i < nops && i < REPLAY_COUNT; i++, r++) {
+        p = NULL;
+        switch (r->op) {
+        case MALLOC_TRACE_MALLOC:
+            p = malloc(r->size);
+            break;
+        case MALLOC_TRACE_CALLOC:
+            p = calloc(1, r->size);
+            break;
+        case MALLOC_TRACE_MEMALIGN:
+            p = memalign(r->align, r->size);
+            break;
+        case MALLOC_TRACE_REALLOC:
+            p = realloc(r->old == REPLAY_NONE ? NULL : slots[r->old], r->size);
+            /* The block stays where it was */
+            if (!p && r->size) {
+                failed++;
+                continue;
+            }
+            break;
+        case MALLOC_TRACE_FREE:
+            if (r->old != REPLAY_NONE)
+                free(slots[r->old]);
+            break;
+        }
+        if (r->old != REPLAY_NONE) {
+            slots[r->old] = NULL;
+#ifdef REPLAY_STATS
+            live -= slot_size[r->old];
+            slot_size[r->old] = 0;
+#endif
+        }
+        if (r->op == MALLOC_TRACE_FREE
+            || (r->op == MALLOC_TRACE_REALLOC && !r->size && r->old != REPLAY_NONE))
+            continue;
+        if (!p) {
+            failed++;
+            continue;
+        }
+        if (r->slot == REPLAY_NONE) {
+            /* Failed in the recorded run; nothing refers to it again */
+            free(p);
+            continue;
+        }
+        slots[r->slot] = p;
+#ifdef REPLAY_STATS
+        slot_size[r->slot] = r->size;
+        live += r->size;
+        if (live > peak_live)
+            peak_live = live;
+        heap = mallinfo().arena;
+        if (heap > peak_heap)
+            peak_heap = heap;
+#endif
+    }
+
+#ifdef REPLAY_STATS
+    printf("REPLAY %lu %lu %lu %lu\n", i, failed, (unsigned long)peak_heap,
+           (unsigned long)peak_live);
+#endif
+    return 0;
+}
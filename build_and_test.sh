@@ -1,15 +1,25 @@
 #!/bin/bash
 # build_and_test.sh - Full rebuild and test for M65832 picolibc
 #
-# Rebuilds everything from scratch so all binaries match:
+# Rebuilds everything that changed so all binaries match:
 # 1. compiler-rt (soft int64, soft float)
 # 2. picolibc (libc, libm)
 # 3. Runs the full picolibc test suite
 #
+# Builds are incremental; tests whose sources and libraries are unchanged
+# are reused from the test build cache.
+#
 # Usage:
-#   ./build_and_test.sh              Full rebuild + test
+#   ./build_and_test.sh              Incremental rebuild + test
+#   ./build_and_test.sh --clean      Clean rebuild of everything + test
 #   ./build_and_test.sh --skip-build Just run tests (use existing build)
 #   ./build_and_test.sh --filter=mem Run only tests matching "mem"
+#   ./build_and_test.sh --lto        Build and test picolibc with -flto in
+#                                    its own build directory
+#   ./build_and_test.sh --profile=fast-io
+#                                    Build and test with the options of
+#                                    scripts/profile-m65832-NAME.txt, in
+#                                    its own build directory
 
 set -e
 
@@ -36,6 +46,9 @@ NC='\033[0m'
 
 # Parse arguments
 SKIP_BUILD=false
+CLEAN=false
+LTO=false
+PROFILE=""
 TEST_ARGS=""
 while [[ $# -gt 0 ]]; do
     case $1 in
@@ -43,6 +56,19 @@ while [[ $# -gt 0 ]]; do
             SKIP_BUILD=true
             shift
             ;;
+        --lto)
+            LTO=true
+            shift
+            ;;
+        --profile=*)
+            PROFILE="${1#--profile=}"
+            shift
+            ;;
+        --clean)
+            CLEAN=true
+            TEST_ARGS="$TEST_ARGS $1"
+            shift
+            ;;
         *)
             TEST_ARGS="$TEST_ARGS $1"
             shift
@@ -50,6 +76,27 @@ while [[ $# -gt 0 ]]; do
     esac
 done
 
+# LTO libraries hold bitcode; keep them apart from the normal build so the
+# two can be benchmarked against each other
+LTO_ARGS=""
+if [ "$LTO" = true ]; then
+    PICOLIBC_BUILD="$PICOLIBC_BUILD-lto"
+    LTO_ARGS="-Db_lto=true"
+fi
+
+# A build profile is one more machine file, with its own build directory
+PROFILE_ARGS=""
+if [ -n "$PROFILE" ]; then
+    PROFILE_FILE="$SCRIPT_DIR/scripts/profile-m65832-$PROFILE.txt"
+    if [ ! -f "$PROFILE_FILE" ]; then
+        echo -e "${RED}ERROR: no profile $PROFILE_FILE${NC}"
+        exit 1
+    fi
+    PICOLIBC_BUILD="$PICOLIBC_BUILD-$PROFILE"
+    PROFILE_ARGS="--cross-file $PROFILE_FILE"
+fi
+export PICOLIBC_BUILD
+
 echo -e "${BOLD}=========================================="
 echo "M65832 Build and Test"
 echo -e "==========================================${NC}"
@@ -59,6 +106,9 @@ echo "Picolibc:    $PICOLIBC_SRC"
 echo "Build dir:   $PICOLIBC_BUILD"
 echo "Compiler-RT: $COMPILER_RT_DIR"
 echo "Cross file:  $CROSS_FILE"
+if [ -n "$PROFILE" ]; then
+    echo "Profile:     $PROFILE_FILE"
+fi
 echo ""
 
 # Verify tools exist
@@ -79,27 +129,39 @@ if [ "$SKIP_BUILD" = false ]; then
     # =========================================================
     echo -e "\n${BOLD}>>> Step 1/2: Rebuilding compiler-rt...${NC}"
     cd "$COMPILER_RT_DIR"
-    make clean 2>/dev/null || true
+    if [ "$CLEAN" = true ]; then
+        make clean 2>/dev/null || true
+    fi
     make -j8
     echo -e "${GREEN}    compiler-rt built: $COMPILER_RT_DIR/libcompiler_rt.a${NC}"
 
     # =========================================================
-    # Step 2: Clean rebuild picolibc
+    # Step 2: Rebuild picolibc
     # =========================================================
-    echo -e "\n${BOLD}>>> Step 2/2: Clean rebuilding picolibc...${NC}"
-    rm -rf "$PICOLIBC_BUILD"
-
-    meson setup "$PICOLIBC_BUILD" "$PICOLIBC_SRC" \
-        --cross-file "$CROSS_FILE" \
-        --buildtype=plain \
-        -Ddebug=false \
-        -Doptimization=1 \
-        -Dmultilib=false \
-        -Dtests=false \
-        -Dprintf-aliases=false \
-        -Dspecsdir=none \
-        -Dfreestanding=true \
-        -Dio-float-exact=false
+    echo -e "\n${BOLD}>>> Step 2/2: Rebuilding picolibc...${NC}"
+    if [ "$CLEAN" = true ]; then
+        rm -rf "$PICOLIBC_BUILD"
+    fi
+
+    # meson compile reconfigures an existing build directory by itself
+    if [ ! -f "$PICOLIBC_BUILD/build.ninja" ]; then
+        meson setup "$PICOLIBC_BUILD" "$PICOLIBC_SRC" \
+            --cross-file "$CROSS_FILE" \
+            $PROFILE_ARGS \
+            --buildtype=plain \
+            -Ddebug=false \
+            -Doptimization=1 \
+            -Dmultilib=false \
+            -Dtests=false \
+            -Dprintf-aliases=false \
+            -Dspecsdir=none \
+            -Dfreestanding=true \
+            -Dfast-bufio=true \
+            -Dfstat-bufsiz=true \
+            -Dio-float-exact=false \
+            -Dopt-profile=balanced \
+            $LTO_ARGS
+    fi
 
     meson compile -C "$PICOLIBC_BUILD" -j8
     echo -e "${GREEN}    picolibc built: $PICOLIBC_BUILD${NC}"
@@ -0,0 +1,188 @@
+#!/bin/bash
+# build_pgo.sh - Profile-guided optimization build of M65832 picolibc
+#
+# 1. Builds an instrumented picolibc (-Db_pgo=generate) and the parts of
+#    the compiler-rt profile runtime that work without an OS
+# 2. Runs the benchmarks and a set of representative tests against it on
+#    the emulator; each run writes default_N.profraw into the sandbox
+#    through the TRAP file syscalls (libc/machine/m65832/instrprof.c)
+# 3. Merges the profiles and rebuilds picolibc with -Db_pgo=use
+#
+# The optimized libraries are built for installation under lib/pgo, so
+# they can be installed next to the regular ones as a multilib variant.
+#
+# Usage:
+#   ./build_pgo.sh                   Incremental PGO build
+#   ./build_pgo.sh --clean           Start over from the instrumented build
+#   ./build_pgo.sh --prefix=DIR      Also install the result into DIR
+#   ./build_pgo.sh --train="a b"     Test patterns to train with
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+PROJECTS_DIR="$(dirname "$SCRIPT_DIR")"
+
+LLVM_ROOT="$PROJECTS_DIR/llvm-m65832"
+LLVM_BUILD="$LLVM_ROOT/build-fast"
+PICOLIBC_SRC="$SCRIPT_DIR"
+GEN_BUILD="$PROJECTS_DIR/picolibc-build-m65832-pgo-gen"
+USE_BUILD="$PROJECTS_DIR/picolibc-build-m65832-pgo"
+PROFILE_RT_SRC="$LLVM_ROOT/compiler-rt/lib/profile"
+CROSS_FILE="$LLVM_ROOT/m65832-stdlib/picolibc/cross-m65832.txt"
+PROFILE_DIR="$GEN_BUILD/profiles"
+
+CLANG="$LLVM_BUILD/bin/clang"
+LLVM_AR="$LLVM_BUILD/bin/llvm-ar"
+LLVM_PROFDATA="$LLVM_BUILD/bin/llvm-profdata"
+
+# Tests run for training, beside every benchmark
+TRAIN="printf scanf strto malloc string"
+
+# The OS independent parts of the profile runtime; instrprof.c in libc
+# replaces the file writer and the atexit registration
+PROFILE_RT_FILES="
+    InstrProfiling.c
+    InstrProfilingBuffer.c
+    InstrProfilingInternal.c
+    InstrProfilingMerge.c
+    InstrProfilingNameVar.c
+    InstrProfilingPlatformOther.c
+    InstrProfilingValue.c
+    InstrProfilingVersionVar.c
+    InstrProfilingWriter.c
+"
+
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+BOLD='\033[1m'
+NC='\033[0m'
+
+CLEAN=false
+PREFIX=""
+while [[ $# -gt 0 ]]; do
+    case $1 in
+        --clean)
+            CLEAN=true
+            shift
+            ;;
+        --prefix=*)
+            PREFIX="${1#--prefix=}"
+            shift
+            ;;
+        --train=*)
+            TRAIN="${1#--train=}"
+            shift
+            ;;
+        *)
+            echo -e "${RED}ERROR: unknown option $1${NC}"
+            exit 1
+            ;;
+    esac
+done
+
+for tool in "$CLANG" "$LLVM_AR" "$LLVM_PROFDATA"; do
+    if [ ! -x "$tool" ]; then
+        echo -e "${RED}ERROR: $tool not found${NC}"
+        exit 1
+    fi
+done
+if [ ! -d "$PROFILE_RT_SRC" ]; then
+    echo -e "${RED}ERROR: compiler-rt profile sources not found at $PROFILE_RT_SRC${NC}"
+    exit 1
+fi
+
+if [ "$CLEAN" = true ]; then
+    rm -rf "$GEN_BUILD" "$USE_BUILD"
+fi
+
+# Same configuration as build_and_test.sh
+MESON_ARGS=(
+    --cross-file "$CROSS_FILE"
+    --buildtype=plain
+    -Ddebug=false
+    -Doptimization=1
+    -Dmultilib=false
+    -Dtests=false
+    -Dprintf-aliases=false
+    -Dspecsdir=none
+    -Dfreestanding=true
+    -Dfast-bufio=true
+    -Dfstat-bufsiz=true
+    -Dio-float-exact=false
+    -Dopt-profile=balanced
+)
+
+# =========================================================
+# Step 1: Instrumented build and profile runtime
+# =========================================================
+echo -e "\n${BOLD}>>> Step 1/3: Building instrumented picolibc...${NC}"
+if [ ! -f "$GEN_BUILD/build.ninja" ]; then
+    meson setup "$GEN_BUILD" "$PICOLIBC_SRC" "${MESON_ARGS[@]}" -Db_pgo=generate
+fi
+meson compile -C "$GEN_BUILD" -j8
+
+rm -rf "$GEN_BUILD/profile-rt"
+mkdir -p "$GEN_BUILD/profile-rt"
+for file in $PROFILE_RT_FILES; do
+    "$CLANG" -target m65832-elf -O2 -ffreestanding \
+        -I"$PICOLIBC_SRC/libc/include" -I"$GEN_BUILD" -I"$PROFILE_RT_SRC/../../include" \
+        -c "$PROFILE_RT_SRC/$file" -o "$GEN_BUILD/profile-rt/${file%.c}.o"
+done
+rm -f "$GEN_BUILD/libclang_rt.profile.a"
+"$LLVM_AR" rcs "$GEN_BUILD/libclang_rt.profile.a" "$GEN_BUILD"/profile-rt/*.o
+
+# =========================================================
+# Step 2: Training runs
+# =========================================================
+echo -e "\n${BOLD}>>> Step 2/3: Collecting profiles...${NC}"
+rm -rf "$PROFILE_DIR"
+mkdir -p "$PROFILE_DIR"
+
+# One job at a time: each run picks the first free default_N.profraw
+export PICOLIBC_BUILD="$GEN_BUILD"
+export PICOLIBC_LINK_LIBS="-lclang_rt.profile"
+export M65832_SANDBOX="$PROFILE_DIR"
+export TEST_CACHE_DIR="$GEN_BUILD/test-cache"
+
+cd "$SCRIPT_DIR"
+python3 run_picolibc_bench.py --no-save || true
+for pattern in $TRAIN; do
+    python3 run_picolibc_gtest.py --no-rebuild -j 1 --filter="*$pattern*" || true
+done
+
+shopt -s nullglob
+PROFRAW=("$PROFILE_DIR"/default_*.profraw)
+shopt -u nullglob
+if [ ${#PROFRAW[@]} -eq 0 ]; then
+    echo -e "${RED}ERROR: the training runs wrote no profiles${NC}"
+    exit 1
+fi
+echo "    ${#PROFRAW[@]} profiles"
+
+# =========================================================
+# Step 3: Optimized build
+# =========================================================
+echo -e "\n${BOLD}>>> Step 3/3: Building picolibc with the profiles...${NC}"
+mkdir -p "$USE_BUILD"
+# -fprofile-use reads default.profdata from the build directory
+"$LLVM_PROFDATA" merge -o "$USE_BUILD/default.profdata" "${PROFRAW[@]}"
+
+if [ ! -f "$USE_BUILD/build.ninja" ]; then
+    INSTALL_ARGS=()
+    if [ -n "$PREFIX" ]; then
+        INSTALL_ARGS=(--prefix="$PREFIX")
+    fi
+    meson setup "$USE_BUILD" "$PICOLIBC_SRC" "${MESON_ARGS[@]}" \
+        "${INSTALL_ARGS[@]}" --libdir=lib/pgo -Db_pgo=use
+elif [ -n "$PREFIX" ]; then
+    meson configure "$USE_BUILD" --prefix="$PREFIX"
+fi
+# ninja does not know the objects depend on the profile
+meson compile -C "$USE_BUILD" --clean
+meson compile -C "$USE_BUILD" -j8
+echo -e "${GREEN}    picolibc built: $USE_BUILD${NC}"
+
+if [ -n "$PREFIX" ]; then
+    meson install -C "$USE_BUILD"
+    echo -e "${GREEN}    installed: $PREFIX/lib/pgo${NC}"
+fi
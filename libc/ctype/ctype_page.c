@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local.h"
+
+#ifdef __CTYPE_PAGE_TABLES
+
+#include "ctype_page.h"
+
+#define CTYPE_PAGE_BLOCKS (1 << (CTYPE_PAGE_SHIFT - CTYPE_BLOCK_SHIFT))
+
+const struct ctype_page_prop *
+__ctype_page_lookup(wint_t c, locale_t locale)
+{
+    unsigned block;
+
+    /* Includes WEOF; entry 0 has no classes and no case mapping */
+    if (c >= CTYPE_PAGE_LIMIT)
+        return &ctype_page_prop[0];
+
+    /* Be compatible with glibc where the C locale has no classes outside of ASCII */
+    if (c >= 0x80 && __locale_is_C(locale))
+        return &ctype_page_prop[0];
+
+    block = ctype_page_index[c >> CTYPE_PAGE_SHIFT] * CTYPE_PAGE_BLOCKS
+        + ((c >> CTYPE_BLOCK_SHIFT) & (CTYPE_PAGE_BLOCKS - 1));
+    return &ctype_page_prop[ctype_page_leaf[(ctype_page_block[block] << CTYPE_BLOCK_SHIFT)
+                                            + (c & ((1 << CTYPE_BLOCK_SHIFT) - 1))]];
+}
+
+#endif /* __CTYPE_PAGE_TABLES */
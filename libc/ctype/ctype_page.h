@@ -0,0 +1,1069 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* This file is auto-generated from mkctype_page.py */
+/* clang-format off */
+
+#define CTYPE_PAGE_LIMIT  0xe0200
+#define CTYPE_PAGE_SHIFT  9
+#define CTYPE_BLOCK_SHIFT 4
+
+static const struct ctype_page_prop ctype_page_prop[194] = {
+    { CLASS_none, 0, 0 },
+    { CLASS_cntrl, 0, 0 },
+    { CLASS_blank|CLASS_cntrl|CLASS_space, 0, 0 },
+    { CLASS_cntrl|CLASS_space, 0, 0 },
+    { CLASS_blank|CLASS_print|CLASS_space, 0, 0 },
+    { CLASS_graph|CLASS_print|CLASS_punct, 0, 0 },
+    { CLASS_alnum|CLASS_digit|CLASS_graph|CLASS_print|CLASS_xdigit, 0, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_xdigit|CLASS_case, 32, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 32, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_xdigit|CLASS_case, 0, -32 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -32 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print, 0, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 743 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 121 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 1, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -1 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -199, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -232 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -121, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -300 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 195 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 210, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 206, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 205, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 79, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 202, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 203, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 207, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 97 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 211, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 209, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 163 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42561 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 213, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 130 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 214, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 218, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 217, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 219, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print, 0, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 56 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 2, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_upper|CLASS_case, 1, -1 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -2 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -79 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -97, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -56, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -130, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 10795, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -163, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 10792, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10815 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -195, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 69, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 71, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10783 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10780 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10782 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -210 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -206 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -205 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -202 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -203 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42319 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42315 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -207 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42343 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42280 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42308 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -209 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -211 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10743 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42305 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10749 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -213 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -214 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 10727 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -218 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42307 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42282 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -69 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -217 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -71 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -219 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42261 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 42258 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 84 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 116, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 38, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 37, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 64, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 63, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -38 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -37 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -31 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -64 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -63 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 8, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -62 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -57 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper, 0, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -47 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -54 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -8 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -86 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -80 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 7 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -116 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -60, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -96 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -7, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 80, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 15, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -15 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 48, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -48 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 7264, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 3008 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 38864, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6254 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6253 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6244 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6242 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6243 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6236 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -6181 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 35266 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -3008, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 35332 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 3814 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 35384 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -59 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -7615, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 8 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -8, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 74 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 86 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 100 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 128 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 112 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 126 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 9 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -74, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -9, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -7205 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -86, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -100, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -112, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -128, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -126, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -7517, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -8383, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -8262, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 28, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -28 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 16, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -16 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 26, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -26 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10743, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -3814, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10727, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -10795 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -10792 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10780, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10749, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10783, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10782, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -10815, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -7264 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -35332, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42280, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, 48 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42308, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42319, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42315, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42305, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42258, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42282, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42261, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 928, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -48, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42307, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -35384, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42343, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, -42561, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -928 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -38864 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 40, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -40 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 39, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -39 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_print|CLASS_upper|CLASS_case, 34, 0 },
+    { CLASS_alnum|CLASS_alpha|CLASS_graph|CLASS_lower|CLASS_print|CLASS_case, 0, -34 },
+};
+
+static const uint8_t ctype_page_index[1793] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 17, 17, 19, 20, 21, 22, 23, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 26, 27, 28, 29, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 30, 31, 31, 31, 31,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    24, 52, 53, 31, 31, 31, 31, 54, 24, 24, 55, 24, 24, 24, 24, 24,
+    24, 56, 24, 57, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    58, 31, 31, 31, 24, 59, 60, 61, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 62, 24, 24, 63, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 64, 65, 66, 31, 31, 31, 31, 67, 31,
+    31, 31, 31, 31, 31, 31, 68, 69, 70, 71, 72, 73, 17, 74, 31, 75,
+    76, 77, 78, 79, 80, 31, 81, 82, 83, 84, 17, 85, 86, 87, 31, 31,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 88, 24, 24, 24, 24, 24, 24, 24, 89, 90, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 91, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 92, 24, 93, 31, 31, 31, 31, 24, 94, 31, 31,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 95, 24, 24, 24, 24, 24, 24,
+    24, 96, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    97,
+};
+
+static const uint16_t ctype_page_block[3136] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 1, 1, 8, 9, 10, 11, 12, 13,
+    14, 14, 14, 15, 16, 14, 14, 17, 18, 19, 20, 21, 22, 23, 14, 24,
+    14, 14, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    38, 38, 38, 38, 39, 38, 40, 41, 42, 43, 44, 45, 46, 47, 14, 48,
+    49, 10, 10, 12, 12, 50, 14, 14, 51, 14, 14, 14, 52, 14, 14, 14,
+    14, 14, 14, 53, 54, 55, 56, 57, 58, 59, 38, 60, 61, 62, 63, 64,
+    38, 65, 62, 62, 62, 66, 67, 62, 62, 62, 62, 62, 62, 68, 69, 70,
+    71, 62, 62, 62, 72, 62, 62, 62, 62, 62, 62, 73, 62, 62, 65, 74,
+    62, 75, 76, 77, 62, 78, 79, 62, 80, 81, 62, 62, 82, 83, 84, 62,
+    62, 62, 62, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 91, 92, 99, 100, 101, 102, 103, 104, 105, 92, 106, 107, 108, 96, 109,
+    110, 91, 92, 106, 111, 112, 96, 113, 114, 115, 116, 117, 118, 119, 102, 120,
+    121, 122, 92, 123, 124, 125, 96, 126, 127, 122, 92, 128, 124, 129, 96, 130,
+    121, 122, 62, 131, 132, 133, 96, 134, 135, 136, 62, 137, 138, 139, 102, 140,
+    141, 62, 62, 142, 143, 144, 145, 145, 146, 62, 147, 148, 149, 150, 145, 145,
+    151, 38, 82, 38, 152, 62, 153, 141, 154, 152, 62, 155, 156, 120, 145, 145,
+    62, 62, 62, 157, 82, 62, 62, 62, 62, 158, 159, 159, 160, 161, 161, 162,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 163, 164, 62, 62, 163, 62, 62, 165, 166, 167, 62, 62,
+    62, 166, 62, 62, 62, 168, 38, 169, 62, 170, 171, 171, 171, 171, 171, 172,
+    89, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 70, 62, 173, 174, 62, 62, 62, 62, 175, 176,
+    62, 177, 62, 178, 62, 179, 121, 180, 62, 62, 62, 88, 181, 182, 183, 170,
+    38, 183, 62, 62, 62, 62, 62, 176, 62, 62, 79, 62, 62, 62, 62, 184,
+    62, 185, 186, 187, 188, 62, 189, 190, 62, 62, 186, 62, 183, 191, 38, 38,
+    62, 192, 62, 62, 62, 185, 89, 193, 183, 183, 194, 195, 196, 145, 145, 145,
+    62, 62, 62, 197, 198, 82, 38, 38, 62, 62, 199, 62, 62, 62, 200, 201,
+    62, 62, 62, 202, 203, 62, 62, 158, 204, 205, 205, 206, 207, 38, 208, 209,
+    33, 33, 33, 33, 33, 33, 33, 210, 211, 33, 33, 33, 38, 40, 62, 212,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 213, 14, 14, 14, 14, 14, 14,
+    214, 215, 214, 214, 215, 216, 214, 217, 214, 214, 214, 218, 219, 220, 221, 222,
+    223, 38, 224, 38, 38, 225, 226, 227, 77, 228, 38, 38, 229, 38, 38, 229,
+    230, 231, 232, 233, 234, 38, 235, 236, 237, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 170, 145, 120, 145, 38, 38, 38, 38, 38, 238, 239, 240, 241, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 242, 38, 243, 38, 38, 38, 38, 38, 38,
+    54, 54, 54, 57, 57, 57, 244, 245, 14, 14, 14, 14, 14, 14, 246, 247,
+    248, 248, 249, 62, 62, 62, 250, 251, 62, 252, 253, 253, 253, 253, 62, 62,
+    38, 38, 195, 38, 38, 254, 145, 145, 38, 255, 38, 38, 38, 38, 38, 256,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 257, 145, 38,
+    258, 38, 259, 260, 141, 62, 62, 62, 62, 261, 89, 62, 62, 62, 62, 262,
+    263, 62, 62, 141, 62, 62, 62, 62, 185, 38, 62, 62, 38, 38, 264, 62,
+    38, 77, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 38, 38, 38, 38,
+    62, 62, 62, 62, 62, 62, 62, 62, 153, 38, 38, 38, 265, 62, 62, 158,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    266, 62, 186, 145, 14, 14, 267, 268, 14, 269, 62, 62, 62, 62, 62, 207,
+    38, 270, 271, 272, 14, 14, 14, 273, 274, 275, 276, 277, 278, 279, 145, 280,
+    200, 62, 281, 170, 62, 62, 62, 282, 62, 62, 62, 62, 283, 183, 38, 284,
+    62, 62, 65, 62, 62, 285, 62, 153, 62, 62, 62, 286, 287, 288, 62, 185,
+    62, 62, 62, 252, 189, 289, 62, 290, 62, 62, 62, 291, 292, 293, 62, 294,
+    295, 296, 253, 33, 33, 297, 298, 299, 299, 299, 299, 299, 62, 62, 300, 183,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 179, 62, 301, 62, 62, 186,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 189, 62, 62, 62, 62, 62, 62, 183, 145, 145,
+    302, 303, 304, 305, 306, 62, 62, 62, 62, 62, 62, 36, 307, 308, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 158, 38, 62, 62, 62, 62, 309, 62, 62, 310, 145, 145, 311,
+    38, 170, 38, 38, 38, 312, 313, 314, 62, 62, 62, 62, 62, 62, 62, 315,
+    59, 82, 316, 5, 317, 318, 319, 62, 62, 62, 62, 185, 320, 321, 322, 323,
+    324, 62, 167, 325, 189, 189, 145, 145, 62, 62, 62, 62, 62, 62, 62, 79,
+    326, 38, 38, 327, 62, 62, 62, 212, 77, 169, 229, 145, 145, 38, 38, 254,
+    145, 145, 145, 145, 145, 145, 145, 145, 62, 153, 62, 62, 62, 108, 38, 328,
+    62, 62, 329, 62, 79, 62, 62, 79, 62, 330, 62, 62, 331, 332, 145, 145,
+    333, 333, 334, 335, 335, 62, 62, 62, 62, 189, 183, 333, 333, 336, 335, 337,
+    62, 62, 338, 62, 62, 62, 339, 340, 340, 341, 342, 343, 62, 62, 62, 179,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 252, 62, 184, 338, 145, 344, 33, 33, 345, 145, 145, 145, 145,
+    346, 62, 62, 347, 62, 348, 62, 349, 62, 185, 126, 145, 145, 145, 62, 350,
+    62, 351, 62, 352, 145, 145, 145, 145, 62, 62, 62, 353, 38, 354, 38, 38,
+    355, 356, 62, 357, 358, 358, 62, 266, 62, 266, 145, 145, 66, 62, 359, 265,
+    62, 62, 62, 360, 62, 361, 62, 362, 62, 363, 364, 145, 145, 145, 145, 145,
+    62, 62, 62, 62, 176, 145, 145, 145, 365, 365, 365, 366, 367, 367, 367, 368,
+    62, 62, 338, 183, 62, 10, 369, 12, 370, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 38, 77, 62, 62, 371, 73, 372, 145, 145, 373,
+    62, 266, 374, 62, 375, 170, 145, 62, 376, 145, 145, 62, 377, 145, 62, 252,
+    62, 62, 62, 62, 378, 354, 319, 379, 62, 62, 62, 181, 380, 62, 176, 183,
+    62, 62, 62, 381, 382, 62, 62, 383, 62, 62, 62, 62, 384, 385, 59, 386,
+    62, 105, 62, 387, 73, 145, 145, 145, 388, 389, 390, 62, 62, 62, 391, 183,
+    90, 91, 92, 392, 111, 393, 394, 386, 395, 62, 62, 396, 397, 398, 399, 145,
+    62, 62, 62, 62, 400, 401, 73, 145, 62, 62, 62, 62, 402, 183, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 62, 62, 62, 403, 38, 404, 145, 145,
+    62, 62, 62, 291, 405, 183, 169, 145, 62, 62, 62, 406, 183, 62, 179, 145,
+    62, 407, 408, 82, 252, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    62, 62, 62, 187, 145, 145, 145, 145, 145, 145, 10, 10, 12, 12, 82, 409,
+    410, 411, 62, 412, 413, 183, 145, 145, 145, 145, 414, 62, 62, 414, 415, 145,
+    62, 62, 62, 416, 207, 62, 62, 62, 62, 417, 307, 62, 62, 62, 62, 176,
+    170, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 62, 62, 418, 183,
+    92, 62, 62, 419, 420, 82, 169, 421, 62, 309, 152, 252, 145, 145, 145, 145,
+    422, 62, 62, 423, 424, 183, 425, 62, 185, 426, 183, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 62, 427,
+    62, 122, 62, 428, 151, 429, 145, 145, 145, 145, 145, 108, 38, 38, 38, 430,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 183, 145, 145, 145, 145, 145, 145,
+    62, 62, 62, 62, 62, 62, 185, 386, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 179, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 62, 62, 62, 62, 62, 62, 431,
+    62, 62, 62, 38, 432, 257, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 79,
+    62, 62, 62, 62, 252, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    62, 62, 291, 183, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    62, 62, 62, 176, 62, 185, 288, 62, 62, 62, 62, 185, 183, 62, 189, 257,
+    62, 62, 62, 38, 433, 434, 435, 436, 62, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 62, 62, 266, 183, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 10, 10, 12, 12, 38, 120, 145, 145, 145, 145, 145, 145,
+    62, 62, 62, 62, 63, 62, 62, 62, 250, 62, 145, 145, 145, 145, 437, 73,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 338,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 184, 145, 438,
+    176, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 439,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 440, 441, 145, 442, 443, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 186,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    62, 62, 62, 62, 62, 62, 79, 153, 176, 444, 256, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 183,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 256, 145, 145, 145, 145,
+    38, 38, 254, 38, 265, 38, 38, 38, 38, 38, 38, 38, 256, 145, 145, 145,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 257,
+    38, 38, 445, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 120, 145,
+    38, 38, 38, 38, 257, 145, 145, 145, 145, 145, 145, 145, 38, 256, 38, 256,
+    38, 38, 38, 38, 38, 265, 38, 358, 145, 145, 145, 145, 145, 145, 145, 145,
+    446, 447, 33, 448, 449, 450, 451, 446, 452, 453, 454, 455, 456, 446, 447, 33,
+    457, 458, 33, 459, 460, 461, 462, 446, 463, 33, 446, 447, 33, 448, 449, 33,
+    451, 446, 452, 462, 446, 463, 33, 446, 447, 33, 464, 446, 465, 466, 467, 468,
+    33, 469, 446, 470, 471, 472, 473, 33, 474, 446, 475, 33, 476, 62, 62, 62,
+    38, 38, 38, 38, 38, 38, 38, 38, 328, 477, 59, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    478, 479, 480, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    167, 481, 482, 33, 33, 33, 483, 145, 438, 145, 145, 145, 145, 145, 145, 145,
+    62, 62, 153, 484, 485, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 62, 486, 145, 62, 62, 311, 352,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 62, 311, 183,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 62, 158, 142,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 487, 185,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 488, 265, 145, 145,
+    489, 489, 490, 491, 492, 288, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 59, 38, 38, 38, 386, 145, 145, 145, 145,
+    59, 38, 38, 254, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    493, 62, 494, 495, 496, 497, 498, 499, 500, 186, 501, 186, 145, 145, 145, 502,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    38, 38, 328, 38, 38, 38, 38, 38, 38, 256, 77, 59, 59, 59, 38, 257,
+    38, 38, 38, 446, 503, 446, 503, 446, 503, 38, 254, 145, 145, 145, 504, 38,
+    307, 38, 38, 328, 358, 502, 257, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 505, 169, 169,
+    38, 38, 38, 38, 38, 38, 38, 506, 38, 38, 38, 38, 38, 170, 328, 229,
+    328, 38, 38, 38, 207, 170, 38, 38, 207, 38, 254, 328, 502, 145, 145, 145,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 256, 254, 169, 507, 38, 38, 38, 508, 509, 170, 358,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 312, 38, 38, 38, 38, 38, 183,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 145, 145,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 183, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 189, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 73, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 108, 62,
+    62, 62, 62, 62, 62, 189, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    62, 189, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 79, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 145, 145, 145, 145, 145,
+    510, 145, 38, 38, 38, 38, 38, 38, 145, 145, 145, 145, 145, 145, 145, 145,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 145,
+};
+
+static const uint8_t ctype_page_leaf[8176] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5,
+    5, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 5, 5, 5,
+    5, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 1,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 12, 5, 5, 5, 5, 11, 5, 5, 5, 5, 5,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 5, 8, 8, 8, 8, 8, 8, 8, 11,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 5, 10, 10, 10, 10, 10, 10, 10, 13,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    16, 17, 14, 15, 14, 15, 14, 15, 11, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 11, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 18, 14, 15, 14, 15, 14, 15, 19,
+    20, 21, 14, 15, 14, 15, 22, 14, 15, 23, 23, 14, 15, 11, 24, 25,
+    26, 14, 15, 23, 27, 28, 29, 30, 14, 15, 31, 32, 29, 33, 34, 35,
+    14, 15, 14, 15, 14, 15, 36, 14, 15, 36, 11, 11, 14, 15, 36, 14,
+    15, 37, 37, 14, 15, 14, 15, 38, 14, 15, 11, 39, 14, 15, 11, 40,
+    39, 39, 39, 39, 41, 42, 43, 41, 42, 43, 41, 42, 43, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 44, 14, 15,
+    11, 41, 42, 43, 14, 15, 45, 46, 14, 15, 14, 15, 14, 15, 14, 15,
+    47, 11, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 11, 11, 11, 11, 11, 11, 48, 14, 15, 49, 50, 51,
+    51, 14, 15, 52, 53, 54, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    55, 56, 57, 58, 59, 11, 60, 60, 11, 61, 11, 62, 63, 11, 11, 11,
+    60, 64, 11, 65, 66, 67, 68, 11, 69, 70, 68, 71, 72, 11, 11, 70,
+    11, 73, 74, 11, 11, 75, 11, 11, 11, 11, 11, 11, 11, 76, 11, 11,
+    77, 11, 78, 77, 11, 11, 11, 79, 77, 80, 81, 81, 82, 11, 11, 11,
+    11, 11, 83, 11, 39, 11, 11, 11, 11, 11, 11, 11, 11, 84, 85, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 39, 39, 39, 39, 39, 39, 39,
+    11, 11, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    11, 11, 11, 11, 11, 5, 5, 5, 5, 5, 5, 5, 39, 5, 39, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 86, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    14, 15, 14, 15, 39, 5, 14, 15, 0, 0, 11, 34, 34, 34, 5, 87,
+    0, 0, 0, 0, 5, 5, 88, 5, 89, 89, 89, 0, 90, 0, 91, 91,
+    11, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 92, 93, 93, 93,
+    11, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 94, 10, 10, 10, 10, 10, 10, 10, 10, 10, 95, 96, 96, 97,
+    98, 99, 100, 100, 100, 101, 102, 103, 14, 15, 14, 15, 14, 15, 14, 15,
+    104, 105, 106, 107, 108, 109, 5, 14, 15, 110, 14, 15, 11, 47, 47, 47,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+    14, 15, 5, 5, 5, 5, 5, 5, 5, 5, 14, 15, 14, 15, 14, 15,
+    112, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 113,
+    0, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 0, 0, 39, 5, 5, 5, 5, 5, 5,
+    11, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 11, 11, 5, 5, 0, 0, 5, 5, 5,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39,
+    5, 39, 39, 5, 39, 39, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 39,
+    39, 39, 39, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 39, 39,
+    39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5,
+    5, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 39,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 39, 39, 39,
+    39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 39, 39, 5, 5, 5, 5, 39, 0, 0, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 0, 0, 5, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 0,
+    5, 5, 0, 0, 0, 0, 0, 39, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39,
+    39, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 39,
+    39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39,
+    39, 0, 39, 0, 0, 0, 39, 39, 39, 39, 0, 0, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 0, 0, 39, 39, 0, 0, 39, 39, 5, 39, 0,
+    0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 39, 39, 0, 39,
+    39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 39, 5, 5, 0,
+    0, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 39,
+    39, 0, 39, 39, 0, 39, 39, 0, 39, 39, 0, 0, 5, 0, 39, 39,
+    39, 39, 39, 0, 0, 0, 0, 39, 39, 0, 0, 39, 39, 5, 0, 0,
+    0, 39, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39, 39, 0, 39, 0,
+    0, 0, 0, 0, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39,
+    39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 0, 39, 39, 0, 39, 39, 39, 39, 39, 0, 0, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 0, 39, 39, 5, 0, 0,
+    39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39, 39, 5, 5, 5,
+    0, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 39,
+    39, 39, 39, 39, 39, 0, 0, 39, 39, 0, 0, 39, 39, 5, 0, 0,
+    0, 0, 0, 0, 0, 5, 39, 39, 0, 0, 0, 0, 39, 39, 0, 39,
+    5, 39, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 39, 39, 0, 39, 39, 39, 39, 39, 39, 0, 0, 0, 39, 39,
+    39, 0, 39, 39, 39, 39, 0, 0, 0, 39, 39, 0, 39, 0, 39, 39,
+    0, 0, 0, 39, 39, 0, 0, 0, 39, 39, 39, 0, 0, 0, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 39, 39,
+    39, 39, 39, 0, 0, 0, 39, 39, 39, 0, 39, 39, 39, 5, 0, 0,
+    39, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39,
+    39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 0, 39, 39, 39, 0, 39, 39, 39, 5, 0, 0,
+    0, 0, 0, 0, 0, 39, 39, 0, 39, 39, 39, 0, 0, 39, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39,
+    39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 0, 0, 5, 39, 39, 39,
+    0, 0, 0, 0, 0, 39, 39, 0, 0, 0, 0, 0, 0, 39, 39, 0,
+    0, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 0, 39, 39, 39, 0, 39, 39, 39, 5, 39, 5,
+    0, 0, 0, 0, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 39,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39,
+    0, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 39, 39, 39, 39, 39, 39,
+    39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 5, 0, 0, 0, 0, 39,
+    39, 39, 39, 39, 39, 0, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+    0, 0, 39, 39, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 5,
+    39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 39, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 39, 39, 0, 39, 0, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39,
+    39, 39, 39, 39, 0, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39, 39, 0, 0,
+    39, 39, 39, 39, 39, 0, 39, 0, 5, 5, 5, 5, 5, 39, 5, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39,
+    39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0,
+    39, 39, 39, 39, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 5, 39, 5, 5, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5,
+    116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+    116, 116, 116, 116, 116, 116, 0, 116, 0, 0, 0, 0, 0, 116, 0, 0,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 5, 11, 117, 117, 117,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 0, 39, 39, 39, 39, 0, 0,
+    39, 0, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 0,
+    39, 0, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+    97, 97, 97, 97, 97, 97, 0, 0, 103, 103, 103, 103, 103, 103, 0, 0,
+    4, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39,
+    39, 39, 39, 39, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 0, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 39, 5, 5, 5, 5, 39, 5, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 0, 0, 0, 0,
+    5, 0, 0, 0, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0,
+    39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 0, 0, 0, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 5, 5,
+    39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 39, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 39,
+    39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 39, 39, 39, 0,
+    39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39, 39, 0, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 5, 0, 0, 0, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 39, 39, 39,
+    119, 120, 121, 122, 122, 123, 124, 125, 126, 14, 15, 0, 0, 0, 0, 0,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 0, 0, 127, 127, 127,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 39, 39, 39, 39, 5, 39, 39,
+    39, 39, 39, 39, 5, 39, 39, 5, 5, 5, 39, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 128, 11, 11, 11, 129, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 130, 11,
+    39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    14, 15, 14, 15, 14, 15, 11, 11, 11, 11, 11, 131, 11, 11, 132, 11,
+    133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134,
+    133, 133, 133, 133, 133, 133, 0, 0, 134, 134, 134, 134, 134, 134, 0, 0,
+    11, 133, 11, 133, 11, 133, 11, 133, 0, 134, 0, 134, 0, 134, 0, 134,
+    135, 135, 136, 136, 136, 136, 137, 137, 138, 138, 139, 139, 140, 140, 0, 0,
+    133, 133, 11, 141, 11, 0, 11, 11, 134, 134, 142, 142, 143, 5, 144, 5,
+    5, 5, 11, 141, 11, 0, 11, 11, 145, 145, 145, 145, 143, 5, 5, 5,
+    133, 133, 11, 11, 0, 0, 11, 11, 134, 134, 146, 146, 0, 5, 5, 5,
+    133, 133, 11, 11, 11, 106, 11, 11, 134, 134, 147, 147, 110, 5, 5, 5,
+    0, 0, 11, 141, 11, 0, 11, 11, 148, 148, 149, 149, 143, 5, 5, 0,
+    4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 3, 3, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4,
+    5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 11, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 100, 5, 5, 5, 5, 100, 5, 5, 11, 100, 100, 100, 11, 11,
+    100, 100, 100, 11, 5, 100, 5, 5, 5, 100, 100, 100, 100, 100, 5, 5,
+    5, 5, 5, 5, 100, 5, 150, 5, 100, 5, 151, 152, 100, 100, 5, 11,
+    100, 100, 153, 100, 11, 39, 39, 39, 39, 11, 5, 5, 11, 11, 100, 100,
+    5, 5, 5, 5, 5, 100, 11, 11, 11, 11, 5, 5, 5, 5, 154, 5,
+    155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    39, 39, 39, 14, 15, 39, 39, 39, 39, 5, 5, 5, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+    157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    14, 15, 159, 160, 161, 162, 163, 14, 15, 14, 15, 14, 15, 164, 165, 166,
+    167, 11, 14, 15, 11, 14, 15, 11, 11, 11, 11, 11, 11, 11, 168, 168,
+    14, 15, 14, 15, 11, 5, 5, 5, 5, 5, 5, 14, 15, 14, 15, 5,
+    5, 5, 14, 15, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 0, 169, 0, 0, 0, 0, 0, 169, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 39,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 5, 5, 5, 5, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5,
+    5, 39, 39, 39, 39, 39, 5, 5, 39, 39, 39, 39, 39, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 5, 5, 5, 5, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39, 39, 39,
+    0, 0, 0, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 39, 5,
+    5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 39,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 11, 11, 39, 39,
+    5, 5, 5, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 5, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    11, 11, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 14, 15, 14, 15, 170, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 39, 5, 5, 14, 15, 171, 11, 39,
+    14, 15, 14, 15, 172, 11, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 173, 174, 175, 176, 173, 11,
+    177, 178, 179, 180, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 181, 182, 183, 14, 15, 14, 15, 184, 14, 15, 0, 0,
+    14, 15, 0, 11, 0, 11, 14, 15, 14, 15, 14, 15, 185, 0, 0, 0,
+    0, 0, 11, 11, 11, 14, 15, 39, 11, 11, 11, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 0, 0, 0,
+    39, 39, 39, 39, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+    5, 5, 39, 39, 39, 39, 39, 39, 5, 5, 5, 39, 5, 39, 39, 39,
+    39, 39, 39, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    39, 39, 39, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5,
+    39, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39, 5, 5,
+    5, 5, 39, 39, 39, 39, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 0,
+    0, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 186, 11, 11, 11, 11, 11, 11, 11, 5, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 5, 5, 0, 0, 0, 0,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 39, 39, 39, 39, 39,
+    11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 0, 39, 0,
+    39, 39, 0, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5,
+    5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 5,
+    5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    0, 0, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39,
+    0, 0, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 0, 39,
+    5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 5,
+    39, 39, 39, 39, 0, 0, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+    188, 188, 188, 188, 188, 188, 188, 188, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    188, 188, 188, 188, 0, 0, 0, 0, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 0, 190, 190, 190, 190,
+    190, 190, 190, 0, 190, 190, 0, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 0, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+    191, 191, 0, 191, 191, 191, 191, 191, 191, 191, 0, 191, 191, 0, 0, 0,
+    11, 39, 39, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 0, 0, 39, 0, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 0, 39, 39, 0, 0, 0, 39, 0, 0, 39,
+    39, 39, 39, 39, 39, 39, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 0, 39, 39, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 0, 0, 0, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 5, 5, 39, 39,
+    0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 0, 39, 39, 0, 0, 0, 0, 0, 39, 39, 39, 39,
+    39, 39, 39, 39, 0, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 0, 0, 5, 5, 5, 0, 0, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+    8, 8, 8, 8, 8, 8, 0, 0, 0, 39, 5, 5, 5, 5, 5, 39,
+    10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 5, 0, 0,
+    0, 0, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    5, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    39, 39, 39, 5, 5, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    5, 5, 5, 5, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 5, 5, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 39, 5, 5, 5,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 5, 5, 39, 5, 5, 5, 5, 5, 5, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 0, 39, 39, 39, 39, 0, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 0, 0, 0, 0, 0,
+    39, 0, 39, 39, 0, 39, 39, 39, 39, 39, 0, 5, 5, 39, 39, 39,
+    39, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 39, 39, 39,
+    39, 39, 39, 39, 0, 0, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 0, 0, 39, 0,
+    39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 0, 39, 0, 0, 39, 0, 39, 39, 39, 39, 0, 39, 39, 5, 5,
+    5, 39, 5, 39, 5, 5, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 5, 39, 39, 39, 5, 39, 39, 39, 39, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 0, 5, 5, 39,
+    39, 39, 5, 5, 39, 39, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 0, 0,
+    39, 5, 5, 5, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 5, 5, 39, 5, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 0, 0, 0, 0,
+    5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 39, 0, 0, 39, 39, 39, 39,
+    39, 39, 39, 39, 0, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 0, 39, 39, 0, 0, 39, 39, 5, 5, 39,
+    39, 39, 39, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39,
+    5, 39, 5, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 39, 5, 5,
+    39, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 5,
+    39, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 0, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 39, 0, 39, 39, 0, 39,
+    39, 39, 5, 39, 5, 5, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 0, 39, 39, 0, 39, 39, 39, 39, 39, 39,
+    39, 39, 0, 39, 39, 39, 39, 5, 39, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 0, 0, 0, 0, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    39, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    39, 39, 39, 39, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 5, 5, 5, 5, 5,
+    5, 5, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 39, 39, 39,
+    39, 39, 5, 39, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39,
+    39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 0,
+    39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 5, 5, 39, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 11, 11,
+    11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 100, 0, 100, 100,
+    0, 0, 100, 0, 0, 100, 100, 0, 0, 100, 100, 100, 100, 0, 100, 100,
+    100, 100, 100, 100, 100, 100, 11, 11, 11, 11, 0, 11, 0, 11, 11, 11,
+    11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 100, 100, 0, 100, 100, 100, 100, 0, 0, 100, 100, 100,
+    100, 100, 100, 100, 100, 0, 100, 100, 100, 100, 100, 100, 100, 0, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 100, 100, 0, 100, 100, 100, 100, 0,
+    100, 100, 100, 100, 100, 0, 100, 0, 0, 0, 100, 100, 100, 100, 100, 100,
+    100, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 0, 0, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 5, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 5, 11, 11, 11, 11,
+    11, 11, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 5, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 5, 11, 11, 11, 11, 11, 11, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 5, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 5,
+    11, 11, 11, 11, 11, 11, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 5,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 5, 11, 11, 11, 11, 11, 11,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 5, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 5, 11, 11, 11, 11, 11, 11, 100, 11, 0, 0, 39, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 39, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+    0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39, 39,
+    39, 39, 0, 39, 39, 0, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 39, 39, 39, 39, 39, 39, 39, 0, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 39, 5,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 5, 0,
+    39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 0, 39, 39, 0,
+    39, 39, 39, 39, 39, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+    192, 192, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    193, 193, 193, 193, 5, 5, 5, 39, 5, 5, 5, 39, 0, 0, 0, 0,
+    39, 39, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    0, 39, 39, 0, 39, 0, 0, 39, 0, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 0, 39, 39, 39, 39, 0, 39, 0, 39, 0, 0, 0, 0,
+    0, 0, 39, 0, 0, 0, 0, 39, 0, 39, 0, 39, 0, 39, 39, 39,
+    0, 39, 39, 0, 39, 0, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39,
+    0, 39, 39, 0, 39, 0, 0, 39, 39, 39, 39, 0, 39, 39, 39, 39,
+    39, 39, 39, 0, 39, 39, 39, 39, 0, 39, 39, 39, 39, 0, 39, 0,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39,
+    0, 39, 39, 39, 0, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39, 39,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 5, 5, 5, 5, 5, 5,
+    0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* 16241 bytes of index and block data */
@@ -39,7 +39,15 @@
 #include <langinfo.h>
 #include "local.h"
 
-#ifdef __MB_CAPABLE
+#ifdef __CTYPE_PAGE_TABLES
+
+wctype_t
+__ctype_table_lookup(wint_t ic, locale_t locale, wctype_t mask)
+{
+    return __ctype_page_lookup(ic, locale)->category & mask;
+}
+
+#elif defined(__MB_CAPABLE)
 
 static const struct {
     wchar_t  code;
@@ -124,3 +124,23 @@ __attribute__((packed))
 ;
 
 const struct caseconv_entry *__caseconv_lookup(wint_t c, locale_t locale);
+
+/*
+ * Unless the library prefers size over speed, the wide character
+ * functions skip both binary searches and use the page-indexed tables
+ * which mkctype_page.py builds from ctype_table.h and caseconv.t. One
+ * lookup gives the class of a code point, with CLASS_case resolved to
+ * CLASS_lower and/or CLASS_upper, and the deltas towlower and towupper
+ * add to it.
+ */
+#if defined(__MB_CAPABLE) && !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+#define __CTYPE_PAGE_TABLES
+
+struct ctype_page_prop {
+    uint16_t      category;
+    int_least32_t lower;
+    int_least32_t upper;
+};
+
+const struct ctype_page_prop *__ctype_page_lookup(wint_t c, locale_t locale);
+#endif
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Copyright © 2026 M65832 Project
+#
+"""
+Build the page-indexed ctype tables in ctype_page.h
+
+The input is the generated range tables, ctype_table.h and caseconv.t,
+so the page tables always match what the binary searches return. Each
+code point gets one entry in a property table holding its class, with
+CLASS_case already resolved to CLASS_lower and/or CLASS_upper, and the
+deltas towlower and towupper add to it. Code points are split into
+pages, pages into blocks and identical pages and blocks are stored
+once; the page and block sizes are the ones giving the smallest tables.
+
+Usage: mkctype_page.py [ctype_table.h [caseconv.t]] > ctype_page.h
+"""
+
+import re
+import sys
+
+CLASSES = ['alnum', 'alpha', 'blank', 'cntrl', 'digit', 'graph', 'lower',
+           'print', 'punct', 'space', 'upper', 'xdigit', 'case']
+
+CLASS = {'CLASS_' + name: 1 << bit for bit, name in enumerate(CLASSES)}
+CLASS['CLASS_none'] = 0
+
+
+def class_name(value):
+    names = [name for name in CLASS if CLASS[name] and value & CLASS[name]]
+    return '|'.join(names) or 'CLASS_none'
+
+
+def load_classes(name):
+    """(first code, class) ranges from the wide-wchar_t half of ctype_table.h"""
+    ranges = []
+    skip = False
+    with open(name) as f:
+        for line in f:
+            if line.startswith('#if __SIZEOF_WCHAR_T__ == 2'):
+                skip = True
+            elif line.startswith('#else'):
+                skip = False
+            elif not skip:
+                m = re.match(r'\{ 0x([0-9a-f]+), ([A-Za-z_|]+) \},', line)
+                if m:
+                    value = 0
+                    for c in m.group(2).split('|'):
+                        value |= CLASS[c]
+                    ranges.append((int(m.group(1), 16), value))
+    return ranges
+
+
+def load_caseconv(name):
+    """(first, last, mode, delta) ranges from caseconv.t"""
+    ranges = []
+    with open(name) as f:
+        for line in f:
+            m = re.match(r'\s*\{(0x[0-9A-Fa-f]+), (\d+), (\w+), (-?\w+)\},', line)
+            if m:
+                first = int(m.group(1), 16)
+                ranges.append((first, first + int(m.group(2)), m.group(3), m.group(4)))
+    return ranges
+
+
+def properties(class_ranges, case_ranges):
+    limit = class_ranges[-1][0]
+    for first, last, _, _ in case_ranges:
+        limit = max(limit, last + 1)
+
+    classes = [0] * limit
+    for i, (first, value) in enumerate(class_ranges):
+        end = class_ranges[i + 1][0] if i + 1 < len(class_ranges) else limit
+        classes[first:end] = [value] * (end - first)
+
+    lower = [0] * limit
+    upper = [0] * limit
+    for first, last, mode, delta in case_ranges:
+        for c in range(first, last + 1):
+            if mode == 'TOLO':
+                lower[c] = int(delta)
+            elif mode == 'TOUP':
+                upper[c] = int(delta)
+            elif mode == 'TOBOTH':
+                lower[c] = 1
+                upper[c] = -1
+            elif (c & 1) == (0 if delta == 'EVENCAP' else 1):
+                lower[c] = 1
+            else:
+                upper[c] = -1
+
+    # Resolve CLASS_case the way __ctype_table_lookup does
+    for c in range(limit):
+        if classes[c] & CLASS['CLASS_case']:
+            if lower[c]:
+                classes[c] |= CLASS['CLASS_upper']
+            if upper[c]:
+                classes[c] |= CLASS['CLASS_lower']
+
+    return list(zip(classes, lower, upper))
+
+
+def type_for(count):
+    return 'uint8_t' if count <= 0x100 else 'uint16_t'
+
+
+def split(values, size):
+    """Store each distinct size-entry run of values once"""
+    runs = {}
+    index = []
+    for i in range(0, len(values), size):
+        index.append(runs.setdefault(tuple(values[i:i + size]), len(runs)))
+    return index, [v for run in runs for v in run], len(runs)
+
+
+def build(props, page_shift, block_shift):
+    page = 1 << page_shift
+    limit = (len(props) + page - 1) & ~(page - 1)
+    props = props + [(0, 0, 0)] * (limit - len(props))
+
+    prop_ids = {(0, 0, 0): 0}
+    codes = [prop_ids.setdefault(p, len(prop_ids)) for p in props]
+
+    leaf_index, leaf, nleaf = split(codes, 1 << block_shift)
+    page_index, blocks, nblock = split(leaf_index, 1 << (page_shift - block_shift))
+
+    size = (len(page_index) * (1 if nblock <= 0x100 else 2) +
+            len(blocks) * (1 if nleaf <= 0x100 else 2) +
+            len(leaf) * (1 if len(prop_ids) <= 0x100 else 2))
+    return {
+        'limit': limit,
+        'page_shift': page_shift,
+        'block_shift': block_shift,
+        'props': list(prop_ids),
+        'page_index': page_index,
+        'blocks': blocks,
+        'leaf': leaf,
+        'size': size,
+    }
+
+
+def dump_array(ctype, name, values):
+    print('static const %s %s[%d] = {' % (ctype, name, len(values)))
+    for i in range(0, len(values), 16):
+        print('    ' + ' '.join('%d,' % v for v in values[i:i + 16]))
+    print('};')
+    print()
+
+
+def dump(t):
+    print('''/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* This file is auto-generated from mkctype_page.py */
+/* clang-format off */
+''')
+    print('#define CTYPE_PAGE_LIMIT  0x%05x' % t['limit'])
+    print('#define CTYPE_PAGE_SHIFT  %d' % t['page_shift'])
+    print('#define CTYPE_BLOCK_SHIFT %d' % t['block_shift'])
+    print()
+    print('static const struct ctype_page_prop ctype_page_prop[%d] = {' % len(t['props']))
+    for value, lower, upper in t['props']:
+        print('    { %s, %d, %d },' % (class_name(value), lower, upper))
+    print('};')
+    print()
+    dump_array(type_for(len(t['blocks']) >> (t['page_shift'] - t['block_shift'])),
+               'ctype_page_index', t['page_index'])
+    dump_array(type_for(len(t['leaf']) >> t['block_shift']), 'ctype_page_block', t['blocks'])
+    dump_array(type_for(len(t['props'])), 'ctype_page_leaf', t['leaf'])
+    print('/* %d bytes of index and block data */' % t['size'])
+
+
+def main():
+    table = sys.argv[1] if len(sys.argv) > 1 else 'ctype_table.h'
+    caseconv = sys.argv[2] if len(sys.argv) > 2 else 'caseconv.t'
+    props = properties(load_classes(table), load_caseconv(caseconv))
+
+    best = None
+    for page_shift in range(6, 14):
+        for block_shift in range(2, page_shift):
+            t = build(props, page_shift, block_shift)
+            if best is None or t['size'] < best['size']:
+                best = t
+    dump(best)
+
+
+if __name__ == '__main__':
+    main()
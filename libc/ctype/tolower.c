@@ -93,7 +93,7 @@ tolower(int c)
 {
 #if defined(__MB_EXTENDED_CHARSETS_ISO) || defined(__MB_EXTENDED_CHARSETS_WINDOWS)
     if ((unsigned char)c <= 0x7f)
-        return isupper(c) ? c - 'A' + 'a' : c;
+        return ('A' <= c && c <= 'Z') ? c - 'A' + 'a' : c;
     else if (c != EOF && MB_CUR_MAX == 1 && isupper(c)) {
         char    s[MB_LEN_MAX] = { c, '\0' };
         wchar_t wc;
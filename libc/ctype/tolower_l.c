@@ -18,7 +18,7 @@ tolower_l(int c, locale_t locale)
 {
 #if defined(__MB_EXTENDED_CHARSETS_ISO) || defined(__MB_EXTENDED_CHARSETS_WINDOWS)
     if ((unsigned char)c <= 0x7f)
-        return isupper_l(c, locale) ? c - 'A' + 'a' : c;
+        return ('A' <= c && c <= 'Z') ? c - 'A' + 'a' : c;
     else if (c != EOF && __locale_mb_cur_max_l(locale) == 1 && isupper_l(c, locale)) {
         char      s[MB_LEN_MAX] = { c, '\0' };
         wchar_t   wc;
@@ -93,7 +93,7 @@ toupper(int c)
 {
 #if defined(__MB_EXTENDED_CHARSETS_ISO) || defined(__MB_EXTENDED_CHARSETS_WINDOWS)
     if ((unsigned char)c <= 0x7f)
-        return islower(c) ? c - 'a' + 'A' : c;
+        return ('a' <= c && c <= 'z') ? c - 'a' + 'A' : c;
     else if (c != EOF && MB_CUR_MAX == 1 && islower(c)) {
         char    s[MB_LEN_MAX] = { c, '\0' };
         wchar_t wc;
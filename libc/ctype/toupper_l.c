@@ -18,7 +18,7 @@ toupper_l(int c, locale_t locale)
 {
 #if defined(__MB_EXTENDED_CHARSETS_ISO) || defined(__MB_EXTENDED_CHARSETS_WINDOWS)
     if ((unsigned char)c <= 0x7f)
-        return islower_l(c, locale) ? c - 'a' + 'A' : c;
+        return ('a' <= c && c <= 'z') ? c - 'a' + 'A' : c;
     else if (c != EOF && __locale_mb_cur_max_l(locale) == 1 && islower_l(c, locale)) {
         char      s[MB_LEN_MAX] = { c, '\0' };
         wchar_t   wc;
@@ -10,7 +10,9 @@ Modified (m) 2017 Thomas Wolff: revise Unicode and locale/wchar handling
 wint_t
 towlower_l(wint_t c, locale_t locale)
 {
-#ifdef __MB_CAPABLE
+#ifdef __CTYPE_PAGE_TABLES
+    return c + __ctype_page_lookup(c, locale)->lower;
+#elif defined(__MB_CAPABLE)
     const struct caseconv_entry *cce = __caseconv_lookup(c, locale);
 
     if (cce)
@@ -34,7 +34,12 @@
  */
 
 #include <errno.h>
+#include <picofast.h>
 
 #ifndef __PICOLIBC_ERRNO_FUNCTION
+#if defined(__GLOBAL_ERRNO) || !defined(__THREAD_LOCAL_STORAGE)
+int errno __libc_fastdata;
+#else
 __THREAD_LOCAL_ERRNO int errno;
 #endif
+#endif
@@ -71,6 +71,13 @@ iconv(iconv_t ic, char ** __restrict inbuf, size_t * __restrict inbytesleft,
                 ic->buf_off = ic->buf_len = 0;
             }
         } else if (inbytes && ic->buf_len == 0) {
+            if (ic->fast && ic->in_state.__count == 0 && ic->out_state.__count == 0) {
+                char *start = in;
+                __iconv_fast(ic, &in, &inbytes, &out, &outbytes);
+                /* The general code takes whatever the fast path left */
+                if (in != start)
+                    continue;
+            }
             ret = ic->in_mbtowc(&wc, in, inbytes, &ic->in_state);
             switch (ret) {
             case 0:
@@ -81,9 +88,10 @@ iconv(iconv_t ic, char ** __restrict inbuf, size_t * __restrict inbytesleft,
             case -1:
                 switch (ic->mode) {
                 case iconv_ignore:
+                    /* Skip the byte, there's no character to convert */
                     in += 1;
                     inbytes--;
-                    break;
+                    continue;
                 default:
                     goto fail;
                 }
@@ -111,9 +119,12 @@ iconv(iconv_t ic, char ** __restrict inbuf, size_t * __restrict inbytesleft,
                     ret = ic->out_wctomb(wc_out, L'?', &ic->out_state);
                     if (ret == -1)
                         goto fail;
-                    __fallthrough;
+                    inexact_count++;
+                    break;
                 case iconv_ignore:
                 case iconv_discard:
+                    /* Nothing was stored */
+                    ret = 0;
                     inexact_count++;
                     break;
                 }
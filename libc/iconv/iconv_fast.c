@@ -0,0 +1,310 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Direct conversions between UTF-8 and UCS-2, UCS-4 or ISO-8859-1,
+ * picked by iconv_open. These skip the mbtowc/wctomb pair and the
+ * wchar_t in between, moving runs of ASCII several characters at a
+ * time. Like the UTF-8 kernels in stdlib, they only handle complete
+ * characters which fit in the output and stop before anything else
+ * (NUL, invalid or truncated input, characters the target can't hold,
+ * surrogates), leaving it to the general loop in iconv.
+ */
+
+#include "iconv_private.h"
+#include <string.h>
+#include <endian.h>
+#include <limits.h>
+#include "../string/local.h"
+
+#ifdef __MB_CAPABLE
+
+#if ULONG_MAX == 4294967295UL
+#define HIGH_BITS 0x80808080UL
+#else
+#define HIGH_BITS 0x8080808080808080UL
+#endif
+
+typedef unsigned long __attribute__((__may_alias__)) iconv_word_t;
+
+/* Nonzero unless the aligned word at p is all ASCII and has no NUL */
+static inline int
+not_ascii_word(const unsigned char *p)
+{
+    iconv_word_t w = *(const iconv_word_t *)p;
+
+    return (w & HIGH_BITS) || DETECT_NULL(w);
+}
+
+static inline uint32_t
+get_unit(const unsigned char *p, unsigned width, bool swap)
+{
+    uint16_t u16;
+    uint32_t u32;
+
+    switch (width) {
+    case 1:
+        return *p;
+    case 2:
+        memcpy(&u16, p, 2);
+        return swap ? __bswap16(u16) : u16;
+    default:
+        memcpy(&u32, p, 4);
+        return swap ? __bswap32(u32) : u32;
+    }
+}
+
+static inline void
+put_unit(unsigned char *p, uint32_t c, unsigned width, bool swap)
+{
+    uint16_t u16;
+    uint32_t u32;
+
+    switch (width) {
+    case 1:
+        *p = (unsigned char)c;
+        break;
+    case 2:
+        u16 = (uint16_t)c;
+        if (swap)
+            u16 = __bswap16(u16);
+        memcpy(p, &u16, 2);
+        break;
+    default:
+        u32 = swap ? __bswap32(c) : c;
+        memcpy(p, &u32, 4);
+        break;
+    }
+}
+
+static void
+from_utf8(const unsigned char **inp, size_t *inleftp, unsigned char **outp, size_t *outleftp,
+          unsigned width, bool swap)
+{
+    const unsigned char *in = *inp;
+    unsigned char       *out = *outp;
+    size_t               inleft = *inleftp;
+    size_t               outleft = *outleftp;
+    uint32_t             max = width == 1 ? 0xff : width == 2 ? 0xffff : 0x10ffff;
+    unsigned             i;
+    wchar_t              wc;
+    int                  len;
+
+    while (inleft) {
+        if (!UNALIGNED_X(in)) {
+            while (inleft >= sizeof(iconv_word_t) && outleft >= sizeof(iconv_word_t) * width
+                   && !not_ascii_word(in)) {
+                if (width == 1)
+                    memcpy(out, in, sizeof(iconv_word_t));
+                else
+                    for (i = 0; i < sizeof(iconv_word_t); i++)
+                        put_unit(out + i * width, in[i], width, swap);
+                in += sizeof(iconv_word_t);
+                inleft -= sizeof(iconv_word_t);
+                out += sizeof(iconv_word_t) * width;
+                outleft -= sizeof(iconv_word_t) * width;
+            }
+            if (!inleft)
+                break;
+        }
+        len = __utf8_decode(&wc, in, inleft);
+        if (len <= 0 || (uint32_t)wc > max || outleft < width)
+            break;
+        put_unit(out, (uint32_t)wc, width, swap);
+        in += len;
+        inleft -= len;
+        out += width;
+        outleft -= width;
+    }
+    *inp = in;
+    *inleftp = inleft;
+    *outp = out;
+    *outleftp = outleft;
+}
+
+static void
+to_utf8(const unsigned char **inp, size_t *inleftp, unsigned char **outp, size_t *outleftp,
+        unsigned width, bool swap)
+{
+    const unsigned char *in = *inp;
+    unsigned char       *out = *outp;
+    size_t               inleft = *inleftp;
+    size_t               outleft = *outleftp;
+    uint32_t             a, b, c, d;
+    size_t               bytes;
+
+    while (inleft >= width) {
+        if (width == 1) {
+            if (!UNALIGNED_X(in))
+                while (inleft >= sizeof(iconv_word_t) && outleft >= sizeof(iconv_word_t)
+                       && !not_ascii_word(in)) {
+                    memcpy(out, in, sizeof(iconv_word_t));
+                    in += sizeof(iconv_word_t);
+                    inleft -= sizeof(iconv_word_t);
+                    out += sizeof(iconv_word_t);
+                    outleft -= sizeof(iconv_word_t);
+                }
+        } else {
+            while (inleft >= 4 * width && outleft >= 4) {
+                a = get_unit(in, width, swap);
+                b = get_unit(in + width, width, swap);
+                c = get_unit(in + 2 * width, width, swap);
+                d = get_unit(in + 3 * width, width, swap);
+
+                /* all four in 1..0x7f */
+                if ((a | b | c | d | (a - 1) | (b - 1) | (c - 1) | (d - 1)) >= 0x80)
+                    break;
+                out[0] = (unsigned char)a;
+                out[1] = (unsigned char)b;
+                out[2] = (unsigned char)c;
+                out[3] = (unsigned char)d;
+                in += 4 * width;
+                inleft -= 4 * width;
+                out += 4;
+                outleft -= 4;
+            }
+        }
+        if (inleft < width)
+            break;
+        a = get_unit(in, width, swap);
+        if (a == 0 || (a >= 0xd800 && a <= 0xdfff) || a > 0x10ffff)
+            break;
+        bytes = a < 0x80 ? 1 : a < 0x800 ? 2 : a < 0x10000 ? 3 : 4;
+        if (outleft < bytes)
+            break;
+        switch (bytes) {
+        case 1:
+            out[0] = (unsigned char)a;
+            break;
+        case 2:
+            out[0] = 0xc0 | (a >> 6);
+            out[1] = 0x80 | (a & 0x3f);
+            break;
+        case 3:
+            out[0] = 0xe0 | (a >> 12);
+            out[1] = 0x80 | ((a >> 6) & 0x3f);
+            out[2] = 0x80 | (a & 0x3f);
+            break;
+        default:
+            out[0] = 0xf0 | (a >> 18);
+            out[1] = 0x80 | ((a >> 12) & 0x3f);
+            out[2] = 0x80 | ((a >> 6) & 0x3f);
+            out[3] = 0x80 | (a & 0x3f);
+            break;
+        }
+        in += width;
+        inleft -= width;
+        out += bytes;
+        outleft -= bytes;
+    }
+    *inp = in;
+    *inleftp = inleft;
+    *outp = out;
+    *outleftp = outleft;
+}
+
+/*
+ * Width and byte order of the non-UTF-8 side, or zero when there's no
+ * direct conversion for it
+ */
+static unsigned
+fast_width(enum locale_id id, bool *swap)
+{
+    *swap = false;
+    switch (id) {
+#ifdef __MB_EXTENDED_CHARSETS_UCS
+#if _BYTE_ORDER == _LITTLE_ENDIAN
+    case locale_UCS_2BE:
+        *swap = true;
+        __fallthrough;
+    case locale_UCS_2:
+    case locale_UCS_2LE:
+        return 2;
+    case locale_UCS_4BE:
+        *swap = true;
+        __fallthrough;
+    case locale_UCS_4:
+    case locale_UCS_4LE:
+        return 4;
+#else
+    case locale_UCS_2LE:
+        *swap = true;
+        __fallthrough;
+    case locale_UCS_2:
+    case locale_UCS_2BE:
+        return 2;
+    case locale_UCS_4LE:
+        *swap = true;
+        __fallthrough;
+    case locale_UCS_4:
+    case locale_UCS_4BE:
+        return 4;
+#endif
+#endif
+#ifdef __MB_EXTENDED_CHARSETS_ISO
+    case locale_ISO_8859_1:
+        return 1;
+#endif
+    default:
+        return 0;
+    }
+}
+
+void
+__iconv_fast_init(iconv_t ic, enum locale_id toid, enum locale_id fromid)
+{
+    bool swap;
+
+    if (fromid == locale_UTF_8 && (ic->fast_width = fast_width(toid, &swap)) != 0)
+        ic->fast = iconv_fast_from_utf8;
+    else if (toid == locale_UTF_8 && (ic->fast_width = fast_width(fromid, &swap)) != 0)
+        ic->fast = iconv_fast_to_utf8;
+    else
+        return;
+    ic->fast_swap = swap;
+}
+
+void
+__iconv_fast(iconv_t ic, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft)
+{
+    if (ic->fast == iconv_fast_from_utf8)
+        from_utf8((const unsigned char **)inbuf, inbytesleft, (unsigned char **)outbuf,
+                  outbytesleft, ic->fast_width, ic->fast_swap);
+    else
+        to_utf8((const unsigned char **)inbuf, inbytesleft, (unsigned char **)outbuf, outbytesleft,
+                ic->fast_width, ic->fast_swap);
+}
+
+#endif /* __MB_CAPABLE */
@@ -85,6 +85,7 @@ iconv_open(const char *tocode, const char *fromcode)
     ic->in_mbtowc = __get_mbtowc(fromid);
     ic->out_wctomb = __get_wctomb(toid);
     ic->mode = mode;
+    __iconv_fast_init(ic, toid, fromid);
     return ic;
 #else
     return NULL;
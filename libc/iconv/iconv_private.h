@@ -39,9 +39,13 @@
 #include "../stdlib/local.h"
 #include "../ctype/ctype_.h"
 #include <iconv.h>
+#include <stdbool.h>
 
 enum __iconv_mode { iconv_default, iconv_ignore, iconv_discard, iconv_translit };
 
+/* Direct conversions to or from UTF-8, see iconv_fast.c */
+enum __iconv_fast { iconv_fast_none, iconv_fast_from_utf8, iconv_fast_to_utf8 };
+
 struct __iconv_t {
     mbtowc_p          in_mbtowc;
     wctomb_p          out_wctomb;
@@ -50,7 +54,17 @@ struct __iconv_t {
     size_t            buf_len;
     size_t            buf_off;
     enum __iconv_mode mode;
+    enum __iconv_fast fast;
+    uint8_t           fast_width; /* bytes per character on the other side */
+    bool              fast_swap;  /* other side is opposite endian */
     char              buf[MB_LEN_MAX];
 };
 
+#ifdef __MB_CAPABLE
+void __iconv_fast_init(iconv_t ic, enum locale_id toid, enum locale_id fromid);
+
+void __iconv_fast(iconv_t ic, char **inbuf, size_t *inbytesleft, char **outbuf,
+                  size_t *outbytesleft);
+#endif
+
 #endif /* _ICONV_PRIVATE_H_ */
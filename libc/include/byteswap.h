@@ -40,7 +40,12 @@
 
 _BEGIN_STD_C
 
-#ifdef __GNUC__
+#if defined(__GNUC__) && defined(__m65832__)
+#include <machine/endian.h>
+#define bswap_16(_x) __bswap16(_x)
+#define bswap_32(_x) __bswap32(_x)
+#define bswap_64(_x) __bswap64(_x)
+#elif defined(__GNUC__)
 #define bswap_16(_x) __builtin_bswap16(_x)
 #define bswap_32(_x) __builtin_bswap32(_x)
 #define bswap_64(_x) __builtin_bswap64(_x)
@@ -327,8 +327,16 @@ extern const short _ctype_wide[];
 #endif
 
 #ifdef __MB_EXTENDED_CHARSETS_NON_UNICODE
-const char *__locale_ctype_ptr(void);
-#define __CTYPE_PTR __locale_ctype_ptr()
+/*
+ * Table for the current locale, kept up to date by setlocale and
+ * uselocale so the macros need not look up the locale. The thread
+ * pointer is set while the thread uses a locale other than the global
+ * one.
+ */
+extern const char                *__ctype_ptr_global;
+extern __THREAD_LOCAL const char *__ctype_ptr_thread;
+const char                       *__locale_ctype_ptr(void);
+#define __CTYPE_PTR (__ctype_ptr_thread ? __ctype_ptr_thread : __ctype_ptr_global)
 #else
 #define __CTYPE_PTR _ctype_
 #endif
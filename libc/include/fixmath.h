@@ -0,0 +1,233 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q15 and Q31 fixed-point arithmetic and elementary functions
+ *
+ * q15_t holds a value in [-1, 1) scaled by 2^15 and q31_t one scaled
+ * by 2^31. The arithmetic helpers saturate instead of wrapping and
+ * round products to nearest. The functions only use integer
+ * arithmetic, so on targets without an FPU they avoid the soft-float
+ * calls of the libm equivalents:
+ *
+ *  - sin, cos: the argument is an angle divided by pi, so the full
+ *    range of the type covers [-pi, pi)
+ *  - atan2: returns the angle divided by pi
+ *  - sqrt: returns 0 for negative arguments
+ *  - log: returns ln(x) / 32 (q31) or ln(x) / 16 (q15), so every
+ *    positive argument has a representable result; x <= 0 gives the
+ *    most negative value
+ *  - exp: takes the same scaled argument that log returns, so
+ *    exp(log(x)) is x; non-negative arguments saturate to the largest
+ *    value
+ *
+ * The q31 functions are within 2 units in the last place of the exact
+ * result and the q15 ones within 1.
+ */
+
+#ifndef _FIXMATH_H_
+#define _FIXMATH_H_
+
+#include <sys/cdefs.h>
+#include <stdint.h>
+
+_BEGIN_STD_C
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+#define Q15_MAX INT16_MAX
+#define Q15_MIN INT16_MIN
+#define Q31_MAX INT32_MAX
+#define Q31_MIN INT32_MIN
+
+static __inline q15_t
+q15_sat(int32_t v)
+{
+    return v > Q15_MAX ? Q15_MAX : v < Q15_MIN ? Q15_MIN : (q15_t)v;
+}
+
+static __inline q31_t
+q31_sat(int64_t v)
+{
+    return v > Q31_MAX ? Q31_MAX : v < Q31_MIN ? Q31_MIN : (q31_t)v;
+}
+
+static __inline q15_t
+q15_add(q15_t a, q15_t b)
+{
+    return q15_sat((int32_t)a + b);
+}
+
+static __inline q15_t
+q15_sub(q15_t a, q15_t b)
+{
+    return q15_sat((int32_t)a - b);
+}
+
+static __inline q15_t
+q15_mul(q15_t a, q15_t b)
+{
+    return q15_sat(((int32_t)a * b + (1 << 14)) >> 15);
+}
+
+static __inline q15_t
+q15_neg(q15_t a)
+{
+    return q15_sat(-(int32_t)a);
+}
+
+static __inline q15_t
+q15_abs(q15_t a)
+{
+    return a < 0 ? q15_neg(a) : a;
+}
+
+static __inline q31_t
+q31_add(q31_t a, q31_t b)
+{
+    return q31_sat((int64_t)a + b);
+}
+
+static __inline q31_t
+q31_sub(q31_t a, q31_t b)
+{
+    return q31_sat((int64_t)a - b);
+}
+
+static __inline q31_t
+q31_mul(q31_t a, q31_t b)
+{
+    return q31_sat(((int64_t)a * b + (1 << 30)) >> 31);
+}
+
+static __inline q31_t
+q31_neg(q31_t a)
+{
+    return a == Q31_MIN ? Q31_MAX : -a;
+}
+
+static __inline q31_t
+q31_abs(q31_t a)
+{
+    return a < 0 ? q31_neg(a) : a;
+}
+
+static __inline q15_t
+q15_from_q31(q31_t a)
+{
+    /* round to nearest without overflowing a + 2^15 */
+    return q15_sat((a >> 16) + ((a >> 15) & 1));
+}
+
+static __inline q31_t
+q31_from_q15(q15_t a)
+{
+    return (q31_t)a * 65536;
+}
+
+static __inline q15_t
+q15_from_float(float f)
+{
+    f *= 32768.0f;
+    if (!(f < 32767.5f))
+        return f != f ? 0 : Q15_MAX;
+    if (f <= -32768.0f)
+        return Q15_MIN;
+    return (q15_t)(f + (f < 0 ? -0.5f : 0.5f));
+}
+
+static __inline float
+q15_to_float(q15_t a)
+{
+    return (float)a * (1.0f / 32768.0f);
+}
+
+static __inline q31_t
+q31_from_double(double d)
+{
+    d *= 2147483648.0;
+    if (!(d < 2147483647.5))
+        return d != d ? 0 : Q31_MAX;
+    if (d <= -2147483648.0)
+        return Q31_MIN;
+    return (q31_t)(d + (d < 0 ? -0.5 : 0.5));
+}
+
+static __inline double
+q31_to_double(q31_t a)
+{
+    return (double)a * (1.0 / 2147483648.0);
+}
+
+q15_t q15_sin(q15_t x);
+q15_t q15_cos(q15_t x);
+q15_t q15_atan2(q15_t y, q15_t x);
+q15_t q15_sqrt(q15_t x);
+q15_t q15_exp(q15_t x);
+q15_t q15_log(q15_t x);
+
+q31_t q31_sin(q31_t x);
+q31_t q31_cos(q31_t x);
+q31_t q31_atan2(q31_t y, q31_t x);
+q31_t q31_sqrt(q31_t x);
+q31_t q31_exp(q31_t x);
+q31_t q31_log(q31_t x);
+
+/*
+ * ISO/IEC TR 18037 fixed-point types, for compilers that provide
+ * them. The q15 and q31 formats match _Fract and long _Fract bit for
+ * bit when those have no integer bits.
+ */
+#if defined(__FRACT_FBIT__) && __FRACT_FBIT__ == 15 && __FRACT_IBIT__ == 0
+
+static __inline q15_t
+q15_from_fract(_Fract f)
+{
+    union {
+        _Fract f;
+        q15_t  q;
+    } u = { f };
+    return u.q;
+}
+
+static __inline _Fract
+q15_to_fract(q15_t q)
+{
+    union {
+        q15_t  q;
+        _Fract f;
+    } u = { q };
+    return u.f;
+}
+
+#endif
+
+#if defined(__LFRACT_FBIT__) && __LFRACT_FBIT__ == 31 && __LFRACT_IBIT__ == 0
+
+static __inline q31_t
+q31_from_lfract(long _Fract f)
+{
+    union {
+        long _Fract f;
+        q31_t       q;
+    } u = { f };
+    return u.q;
+}
+
+static __inline long _Fract
+q31_to_lfract(q31_t q)
+{
+    union {
+        q31_t       q;
+        long _Fract f;
+    } u = { q };
+    return u.f;
+}
+
+#endif
+
+_END_STD_C
+
+#endif /* _FIXMATH_H_ */
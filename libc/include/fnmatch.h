@@ -50,6 +50,12 @@
 
 _BEGIN_STD_C
 int fnmatch(const char *, const char *, int);
+#if __MISC_VISIBLE
+struct fnmatch_pattern;
+struct fnmatch_pattern *fnmatch_compile(const char *__pattern, int __flags);
+int  fnmatch_exec(const struct fnmatch_pattern *__compiled, const char *__string);
+void fnmatch_free(struct fnmatch_pattern *__compiled);
+#endif
 _END_STD_C
 
 #endif /* !_FNMATCH_H_ */
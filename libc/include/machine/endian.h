@@ -21,7 +21,21 @@
 #define BYTE_ORDER    _BYTE_ORDER
 #endif
 
-#ifdef __GNUC__
+#if defined(__GNUC__) && defined(__m65832__)
+/*
+ * The bswap builtins become shift loops on m65832; swap bytes in
+ * memory instead (libc/machine/m65832/stdbit.c) unless the value is
+ * a constant
+ */
+_BEGIN_STD_C
+__uint16_t __m65832_bswap16(__uint16_t __x);
+__uint32_t __m65832_bswap32(__uint32_t __x);
+__uint64_t __m65832_bswap64(__uint64_t __x);
+_END_STD_C
+#define __bswap16(_x) (__builtin_constant_p(_x) ? __builtin_bswap16(_x) : __m65832_bswap16(_x))
+#define __bswap32(_x) (__builtin_constant_p(_x) ? __builtin_bswap32(_x) : __m65832_bswap32(_x))
+#define __bswap64(_x) (__builtin_constant_p(_x) ? __builtin_bswap64(_x) : __m65832_bswap64(_x))
+#elif defined(__GNUC__)
 #define __bswap16(_x) __builtin_bswap16(_x)
 #define __bswap32(_x) __builtin_bswap32(_x)
 #define __bswap64(_x) __builtin_bswap64(_x)
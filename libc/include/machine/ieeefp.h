@@ -678,9 +678,16 @@ warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
 #endif
 #endif
 
-/* M65832 - 32-bit little-endian processor */
+/* M65832 - 32-bit little-endian processor, no FPU */
 #ifdef __m65832__
 #define __IEEE_LITTLE_ENDIAN
+#ifndef _SOFT_FLOAT
+#define _SOFT_FLOAT
+#endif
+/* The library only has double versions of the long double functions */
+#ifndef _LDBL_EQ_DBL
+#error "m65832 requires long double to be the same as double"
+#endif
 #endif
 
 #ifndef __IEEE_BIG_ENDIAN
@@ -38,6 +38,7 @@ SUCH DAMAGE.
 #include <sys/cdefs.h>
 #define __need_size_t
 #include <stddef.h>
+#include <sys/_types.h>
 
 /* include any machine-specific extensions */
 #include <machine/malloc.h>
@@ -50,11 +51,11 @@ _BEGIN_STD_C
 struct mallinfo {
     size_t arena;    /* total space allocated from system */
     size_t ordblks;  /* number of non-inuse chunks */
-    size_t smblks;   /* unused -- always zero */
+    size_t smblks;   /* number of chunks in size bins and caches */
     size_t hblks;    /* number of mmapped regions */
     size_t hblkhd;   /* total space in mmapped regions */
     size_t usmblks;  /* unused -- always zero */
-    size_t fsmblks;  /* unused -- always zero */
+    size_t fsmblks;  /* space in chunks in size bins and caches */
     size_t uordblks; /* total allocated space */
     size_t fordblks; /* total non-inuse space */
     size_t keepcost; /* top-most, releasable (via malloc_trim) space */
@@ -104,6 +105,125 @@ void            __malloc_unlock(void);
 /* Some systems provide this, so do too for compatibility.  */
 void cfree(void *);
 
+/* Return an XML description of the heap, compatible with glibc  */
+struct __file;
+int malloc_info(int __options, struct __file *__fp);
+
+/* Heap profiling, available when picolibc is built with
+   -Dmalloc-profile=true. Events are reported for the public malloc,
+   free and realloc entry points. Work done inside the library, such
+   as by calloc, memalign or a realloc that has to move the block, is
+   reported as the underlying malloc and free calls with the library
+   function as caller; trimming the end of a block shows up as a free
+   of the trimmed tail. The hook must not allocate.  */
+
+#define MALLOC_EVENT_MALLOC  0
+#define MALLOC_EVENT_FREE    1
+#define MALLOC_EVENT_REALLOC 2
+
+#define MALLOC_PROFILE_NHIST 16
+
+struct malloc_profile {
+    size_t nmalloc;  /* successful allocations */
+    size_t nfail;    /* failed allocations */
+    size_t nfree;    /* calls to free */
+    size_t nrealloc; /* reallocs resolved without moving to a new block */
+    size_t in_use;   /* bytes held in allocated chunks */
+    size_t peak;     /* largest in_use seen */
+    size_t hist[MALLOC_PROFILE_NHIST]; /* allocations by request size: bucket n > 0
+                                          counts sizes from 2^(n-1) to 2^n - 1 and the
+                                          last bucket also all larger ones */
+};
+
+typedef void (*malloc_hook_t)(int __event, void *__ptr, void *__old, size_t __size,
+                              void *__caller);
+
+malloc_hook_t malloc_set_hook(malloc_hook_t __hook);
+void          malloc_profile(struct malloc_profile *__profile);
+void          malloc_profile_reset(void);
+
+/* Allocation tracing, also with -Dmalloc-profile=true. Between
+   malloc_trace_start and malloc_trace_stop, every call the application
+   makes to malloc, free, realloc, memalign (and the functions built on
+   it) and calloc is added as one record to a compact binary trace,
+   which bench/malloc-replay.c plays back. The trace is passed to
+   __WRITE in pieces as for fwopen; it is called with the allocator
+   locked and must not allocate. Calls the allocator makes to itself
+   are left out. Both return 0 or -1 when writing the trace failed.  */
+
+#define MALLOC_TRACE_MALLOC   0
+#define MALLOC_TRACE_FREE     1
+#define MALLOC_TRACE_REALLOC  2
+#define MALLOC_TRACE_MEMALIGN 3
+#define MALLOC_TRACE_CALLOC   4
+
+int malloc_trace_start(__ssize_t (*__write)(void *__cookie, const void *__buf, size_t __n),
+                       void *__cookie);
+int malloc_trace_stop(void);
+
+/* Fixed-size object pools. Objects are carved from slabs of heap
+   memory and allocated and released in constant time. Pools are not
+   locked; callers sharing one between threads must serialize access
+   themselves.  */
+
+struct malloc_pool;
+
+struct malloc_pool_info {
+    size_t objsize; /* size of each object, after alignment */
+    size_t nslabs;  /* number of slabs obtained from the heap */
+    size_t nobjs;   /* total objects in all slabs */
+    size_t nfree;   /* objects available for allocation */
+    size_t peak;    /* most objects in use at any one time */
+};
+
+struct malloc_pool     *malloc_pool_create(size_t __size, size_t __count) __warn_unused_result;
+void                   *malloc_pool_alloc(struct malloc_pool *__pool) __malloc_like __warn_unused_result;
+void                    malloc_pool_free(struct malloc_pool *__pool, void *__ptr);
+void                    malloc_pool_destroy(struct malloc_pool *__pool);
+struct malloc_pool_info malloc_pool_info(struct malloc_pool *__pool);
+
+/* Arenas. Memory is handed out by bumping a pointer through a single
+   region, either supplied by the caller or taken from the heap, and
+   is only released in bulk by rewinding to a mark, resetting or
+   destroying the arena. Arenas are not locked.  */
+
+struct malloc_arena;
+
+struct malloc_arena *malloc_arena_create(void *__buf, size_t __size) __warn_unused_result;
+void   *malloc_arena_alloc(struct malloc_arena *__arena, size_t __size, size_t __align)
+    __warn_unused_result __alloc_size(2);
+size_t  malloc_arena_mark(struct malloc_arena *__arena);
+void    malloc_arena_rewind(struct malloc_arena *__arena, size_t __mark);
+void    malloc_arena_reset(struct malloc_arena *__arena);
+void    malloc_arena_destroy(struct malloc_arena *__arena);
+
+/* Independent heaps. A heap hands out and takes back blocks of any
+   size from a caller-supplied region, like malloc and free but apart
+   from the malloc heap: it has its own free list and its own lock, so
+   fragmentation and leaks in one heap cannot starve another and
+   threads using different heaps do not wait for each other. Blocks
+   must be released to the heap they came from. Heaps do not grow;
+   malloc_heap_destroy only releases the lock, the region stays with
+   the caller.  */
+
+struct malloc_heap;
+
+struct malloc_heap_info {
+    size_t size;    /* bytes managed, after the heap header */
+    size_t in_use;  /* bytes in allocated blocks, with their headers */
+    size_t peak;    /* most bytes in use at any one time */
+    size_t free;    /* bytes in free blocks */
+    size_t nfree;   /* number of free blocks */
+    size_t largest; /* largest block that can be allocated */
+};
+
+struct malloc_heap     *malloc_heap_create(void *__buf, size_t __size) __warn_unused_result;
+void                   *malloc_heap_alloc(struct malloc_heap *__heap, size_t __size)
+    __malloc_like __warn_unused_result __alloc_size(2);
+void                    malloc_heap_free(struct malloc_heap *__heap, void *__ptr);
+void                    malloc_heap_destroy(struct malloc_heap *__heap);
+struct malloc_heap_info malloc_heap_info(struct malloc_heap *__heap);
+
 _END_STD_C
 
 #endif /* _INCLUDE_MALLOC_H_ */
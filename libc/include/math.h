@@ -241,12 +241,13 @@ typedef double double_t;
 #define MATH_ERREXCEPT 2
 #endif
 #ifndef math_errhandling
-#ifdef __IEEE_LIBM
+/* Code linked with libmfast defines __MATH_FAST_LIB */
+#if defined(__IEEE_LIBM) || defined(__MATH_FAST_LIB)
 #define _MATH_ERRHANDLING_ERRNO 0
 #else
 #define _MATH_ERRHANDLING_ERRNO MATH_ERRNO
 #endif
-#ifdef _SUPPORTS_ERREXCEPT
+#if defined(_SUPPORTS_ERREXCEPT) && !defined(__MATH_FAST_LIB)
 #define _MATH_ERRHANDLING_ERREXCEPT MATH_ERREXCEPT
 #else
 #define _MATH_ERRHANDLING_ERREXCEPT 0
@@ -686,6 +687,29 @@ extern float j1f(float);
 extern float jnf(int, float);
 #endif
 
+#if __ISO_C_VISIBLE >= 2023
+extern double sinpi(double);
+extern double cospi(double);
+extern float  sinpif(float);
+extern float  cospif(float);
+extern double compoundn(double, long long);
+extern double pown(double, long long);
+extern double powr(double, double);
+extern double rootn(double, long long);
+extern float  compoundnf(float, long long);
+extern float  pownf(float, long long);
+extern float  powrf(float, float);
+extern float  rootnf(float, long long);
+#ifdef __HAVE_LONG_DOUBLE_MATH
+extern long double sinpil(long double);
+extern long double cospil(long double);
+extern long double compoundnl(long double, long long);
+extern long double pownl(long double, long long);
+extern long double powrl(long double, long double);
+extern long double rootnl(long double, long long);
+#endif
+#endif /* __ISO_C_VISIBLE >= 2023 */
+
 /* GNU extensions */
 #if __GNU_VISIBLE
 extern void sincos(double, double *, double *);
@@ -693,6 +717,11 @@ extern void sincosf(float, float *, float *);
 #ifdef __HAVE_LONG_DOUBLE_MATH
 extern void sincosl(long double, long double *, long double *);
 #endif
+extern void sincospi(double, double *, double *);
+extern void sincospif(float, float *, float *);
+#ifdef __HAVE_LONG_DOUBLE_MATH
+extern void sincospil(long double, long double *, long double *);
+#endif
 extern double exp10(double);
 extern double pow10(double);
 extern float  exp10f(float);
@@ -756,6 +785,8 @@ extern int signgam;
 
 #endif /* __BSD_VISIBLE */
 
+#include <sys/_mathtier.h>
+
 #include <machine/math.h>
 
 #ifdef __FAST_MATH__
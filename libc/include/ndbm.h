@@ -86,6 +86,21 @@ int   dbm_store(DBM *, datum, datum, int);
 #if __BSD_VISIBLE
 int dbm_dirfno(DBM *);
 #endif
+#if __MISC_VISIBLE
+struct dbm_stats {
+    unsigned long hits;      /* page found in a buffer */
+    unsigned long misses;    /* page needed a buffer */
+    unsigned long reads;     /* pages copied from the file or image */
+    unsigned long mapped;    /* pages used in place in the image */
+    unsigned long writes;    /* pages written to the file */
+    unsigned long evictions; /* buffers reused for another page */
+    unsigned long buffers;   /* buffers allocated */
+};
+
+DBM *dbm_open_cache(const char *, int, mode_t, size_t);
+DBM *dbm_open_image(const void *, size_t, size_t);
+int  dbm_stats(DBM *, struct dbm_stats *);
+#endif
 _END_STD_C
 
 #endif /* !_NDBM_H_ */
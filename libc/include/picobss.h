@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Static storage which crt0 does not clear
+ *
+ * picolibc.ld places variables marked __noinit or __lazy_bss after
+ * .bss, outside of the range crt0 zeroes at startup, so large buffers
+ * do not add to boot time.
+ *
+ *   __noinit    never cleared; the contents are undefined until the
+ *               application writes them and survive a warm reset
+ *   __lazy_bss  cleared by the first call to _init_lazy_bss(), for
+ *               code that needs zeroed memory but not before main
+ *
+ * Neither kind of variable may have an initializer.
+ */
+
+#ifndef _PICOBSS_H_
+#define _PICOBSS_H_
+
+#include <sys/cdefs.h>
+
+_BEGIN_STD_C
+
+#define __noinit   __section(".noinit")
+#define __lazy_bss __section(".lazy_bss")
+
+/* Zero every __lazy_bss variable, once; later calls return at once */
+void _init_lazy_bss(void);
+
+_END_STD_C
+
+#endif /* _PICOBSS_H_ */
@@ -0,0 +1,34 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Static storage in fast memory
+ *
+ * picolibc.ld places variables marked __fastdata at the very start of
+ * .data, between __fastdata_start and __fastdata_end, so a port can
+ * map that short range into whatever memory its CPU reaches fastest.
+ * On m65832 that is the direct page above the register block, which
+ * takes one-byte addresses. Setting __fastdata_size_max in the linker
+ * script makes the link fail when the variables outgrow it.
+ *
+ * __fastdata variables are initialized like any other data, zero when
+ * they have no initializer, but they always take space in flash. The
+ * attribute is meant for a few small, frequently used variables.
+ */
+
+#ifndef _PICOFAST_H_
+#define _PICOFAST_H_
+
+#include <sys/cdefs.h>
+
+#define __fastdata __section(".fastdata")
+
+/* Placement of libc's own hot variables, see m65832-fast-data */
+#ifdef __M65832_FAST_DATA
+#define __libc_fastdata __fastdata
+#else
+#define __libc_fastdata
+#endif
+
+#endif /* _PICOFAST_H_ */
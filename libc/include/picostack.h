@@ -0,0 +1,39 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Stack high-water mark
+ *
+ * __stack_paint fills the unused part of the stack, from
+ * __stack_limit up to just below the caller's frame, with
+ * __STACK_PAINT_WORD. __stack_high_water then finds the lowest word
+ * which no longer holds the pattern and returns how many bytes below
+ * __stack have been used since. crt0 paints the stack before running
+ * constructors and main when picolibc is built with
+ * -Dcrt-stack-paint=true; an application can repaint at any time to
+ * measure one phase on its own.
+ *
+ * Both assume a stack which grows down from __stack to __stack_limit,
+ * as picolibc.ld lays it out. Without painting, __stack_high_water
+ * returns the whole stack size.
+ */
+
+#ifndef _PICOSTACK_H_
+#define _PICOSTACK_H_
+
+#include <sys/cdefs.h>
+#define __need_size_t
+#include <stddef.h>
+
+_BEGIN_STD_C
+
+#define __STACK_PAINT_WORD 0x5a5aa5a5UL
+
+void   __stack_paint(void);
+size_t __stack_high_water(void);
+size_t __stack_size(void);
+
+_END_STD_C
+
+#endif /* _PICOSTACK_H_ */
@@ -0,0 +1,32 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Minimal UBSan runtime
+ *
+ * When picolibc is built with -Dsanitize-minimal-runtime=true, the
+ * __ubsan_handle_* functions called by code compiled with
+ * -fsanitize=undefined no longer format a report and abort. Instead
+ * the first failure at each source location is noted in a ring of 16
+ * entries and the program carries on, so the checks can stay enabled
+ * in production builds. Only __builtin_unreachable and a missing
+ * return, which cannot carry on, report and abort at once.
+ *
+ * __ubsan_report prints the failures noted since the last call to
+ * stderr and returns how many there were, including any which the
+ * ring overwrote before they could be printed.
+ */
+
+#ifndef _PICOUBSAN_H_
+#define _PICOUBSAN_H_
+
+#include <sys/cdefs.h>
+
+_BEGIN_STD_C
+
+int __ubsan_report(void);
+
+_END_STD_C
+
+#endif /* _PICOUBSAN_H_ */
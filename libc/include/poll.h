@@ -0,0 +1,43 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Wait for events on a set of file descriptors
+ *
+ * picolibc declares poll for targets whose system interface provides
+ * it; there is no generic implementation. The event bits have the
+ * values used by Linux and most other systems.
+ */
+
+#ifndef _POLL_H_
+#define _POLL_H_
+
+#include <sys/cdefs.h>
+
+_BEGIN_STD_C
+
+typedef unsigned int nfds_t;
+
+struct pollfd {
+    int   fd;      /* file descriptor, ignored when negative */
+    short events;  /* requested events */
+    short revents; /* returned events */
+};
+
+#define POLLIN     0x0001 /* data other than high-priority may be read */
+#define POLLPRI    0x0002 /* high-priority data may be read */
+#define POLLOUT    0x0004 /* data may be written */
+#define POLLERR    0x0008 /* error, only in revents */
+#define POLLHUP    0x0010 /* hang up, only in revents */
+#define POLLNVAL   0x0020 /* fd is not open, only in revents */
+#define POLLRDNORM 0x0040 /* normal data may be read */
+#define POLLRDBAND 0x0080 /* priority data may be read */
+#define POLLWRNORM 0x0100 /* normal data may be written */
+#define POLLWRBAND 0x0200 /* priority data may be written */
+
+int poll(struct pollfd *__fds, nfds_t __nfds, int __timeout);
+
+_END_STD_C
+
+#endif /* _POLL_H_ */
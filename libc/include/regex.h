@@ -39,6 +39,7 @@
 
 #include <sys/cdefs.h>
 #define __need_ptrdiff_t
+#define __need_size_t
 #include <stddef.h>
 
 /* types */
@@ -100,6 +101,9 @@ size_t regerror(int, const regex_t * __restrict, char * __restrict, size_t);
 int regexec(const regex_t * __restrict, const char * __restrict, size_t, regmatch_t[__restrict_arr],
             int);
 void regfree(regex_t *);
+#if __MISC_VISIBLE
+int regcomp_cache(size_t);
+#endif
 _END_STD_C
 
 #endif /* !_REGEX_H_ */
@@ -50,16 +50,34 @@ typedef enum { FIND, ENTER } ACTION;
 
 typedef enum { preorder, postorder, endorder, leaf } VISIT;
 
+#if __MISC_VISIBLE
+/*
+ * Tree node for tinsert and tremove, which leave node allocation to
+ * the caller. The layout matches the nodes tsearch allocates.
+ */
+struct tnode {
+    const void   *__key;
+    struct tnode *__llink, *__rlink;
+    int           __height;
+};
+#endif
+
 #ifdef _SEARCH_PRIVATE
 typedef struct node {
     char        *key;
     struct node *llink, *rlink;
+    int          height; /* AVL subtree height */
 } node_t;
 #endif
 
 struct hsearch_data {
-    struct internal_head *htable;
-    size_t                htablesize;
+    struct __hsearch_slot *htable;
+    size_t                 htablesize;
+    size_t                 hcount;
+    /* Previous table while its entries are moved over after growing */
+    struct __hsearch_slot *holdtable;
+    size_t                 holdsize;
+    size_t                 holdpos;
 };
 
 #ifndef __compar_fn_t_defined
@@ -74,10 +92,20 @@ ENTRY *hsearch(ENTRY, ACTION);
 int    hcreate_r(size_t, struct hsearch_data *);
 void   hdestroy_r(struct hsearch_data *);
 int    hsearch_r(ENTRY, ACTION, ENTRY **, struct hsearch_data *);
+#if __MISC_VISIBLE
+int    hsearch_len_r(ENTRY, size_t, ACTION, ENTRY **, struct hsearch_data *);
+int    hdelete_r(const char *, struct hsearch_data *);
+int    hdelete_len_r(const char *, size_t, struct hsearch_data *);
+int    hdelete(const char *);
+#endif
 void  *tdelete(const void  *__restrict, void  **__restrict, __compar_fn_t);
 void   tdestroy(void *, void (*)(void *));
 void  *tfind(const void *, void **, __compar_fn_t);
 void  *tsearch(const void *, void **, __compar_fn_t);
+#if __MISC_VISIBLE
+void  *tinsert(const void *, void **, __compar_fn_t, struct tnode *);
+void  *tremove(const void *, void **, __compar_fn_t);
+#endif
 void   twalk(const void *, void (*)(const void *, VISIT, int));
 _END_STD_C
 
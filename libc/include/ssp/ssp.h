@@ -52,6 +52,14 @@
 #define __ssp_bos_known(ptr) (__ssp_bos0(ptr) != (size_t)-1)
 #endif
 
+/*
+ * True when the compiler can prove that len bytes fit in the object
+ * at ptr, for instance a buffer from malloc(n) and a length of n.
+ * Such calls skip the _chk function and go straight to the real one.
+ */
+#define __ssp_bos_safe(ptr, len, bos) \
+    (__builtin_constant_p((len) <= bos(ptr)) && (len) <= bos(ptr))
+
 #define __ssp_check(buf, len, bos)              \
     if (__ssp_bos_known(buf) && len > bos(buf)) \
     __chk_fail()
@@ -51,9 +51,15 @@ char *__gets_chk(char *, size_t);
 
 #define vsprintf(str, fmt, ap)       __builtin___vsprintf_chk(str, 0, __ssp_bos(str), fmt, ap)
 
-#define snprintf(str, len, ...)      __builtin___snprintf_chk(str, len, 0, __ssp_bos(str), __VA_ARGS__)
-
-#define vsnprintf(str, len, fmt, ap) __builtin___vsnprintf_chk(str, len, 0, __ssp_bos(str), fmt, ap)
+#define snprintf(str, len, ...)                                   \
+    (__ssp_bos_safe(str, len, __ssp_bos)                          \
+         ? __builtin_snprintf(str, len, __VA_ARGS__)              \
+         : __builtin___snprintf_chk(str, len, 0, __ssp_bos(str), __VA_ARGS__))
+
+#define vsnprintf(str, len, fmt, ap)                                \
+    (__ssp_bos_safe(str, len, __ssp_bos)                            \
+         ? __builtin_vsnprintf(str, len, fmt, ap)                   \
+         : __builtin___vsnprintf_chk(str, len, 0, __ssp_bos(str), fmt, ap))
 
 #define gets(str)                    __gets_chk(str, __ssp_bos(str))
 
@@ -48,9 +48,10 @@ _END_STD_C
 
 #if __SSP_FORTIFY_LEVEL > 0
 
-#define __ssp_bos_check3(fun, dst, src, len)                                        \
-    (__ssp_bos_known(dst) ? __builtin___##fun##_chk(dst, src, len, __ssp_bos0(dst)) \
-                          : __##fun##_ichk(dst, src, len))
+#define __ssp_bos_check3(fun, dst, src, len)                                          \
+    (__ssp_bos_safe(dst, len, __ssp_bos0) ? __builtin_##fun(dst, src, len)            \
+     : __ssp_bos_known(dst)               ? __builtin___##fun##_chk(dst, src, len, __ssp_bos0(dst)) \
+                                          : __##fun##_ichk(dst, src, len))
 
 #define __ssp_bos_check2(fun, dst, src)                                        \
     (__ssp_bos_known(dst) ? __builtin___##fun##_chk(dst, src, __ssp_bos0(dst)) \
@@ -0,0 +1,442 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * C23 bit and byte utilities
+ *
+ * Every function is also available inline: the stdc_ names expand to
+ * __stdc_ versions defined here, built on three kernels per word size
+ * that count leading zeros, trailing zeros and set bits of a 32- or
+ * 64-bit value (a zero value has all bits counted as zeros). They use
+ * compiler builtins where available; on m65832, where those become
+ * bit-at-a-time library calls, they are byte table lookups in
+ * libc/machine/m65832/stdbit.c instead.
+ */
+
+#ifndef _STDBIT_H_
+#define _STDBIT_H_
+
+#include <sys/cdefs.h>
+#include <machine/_default_types.h>
+
+#define __STDC_VERSION_STDBIT_H__ 202311L
+
+#define __STDC_ENDIAN_LITTLE__ __ORDER_LITTLE_ENDIAN__
+#define __STDC_ENDIAN_BIG__    __ORDER_BIG_ENDIAN__
+#define __STDC_ENDIAN_NATIVE__ __BYTE_ORDER__
+
+_BEGIN_STD_C
+
+#ifdef __m65832__
+
+unsigned   __m65832_clz32(__uint32_t __x);
+unsigned   __m65832_clz64(__uint64_t __x);
+unsigned   __m65832_ctz32(__uint32_t __x);
+unsigned   __m65832_ctz64(__uint64_t __x);
+unsigned   __m65832_popcount32(__uint32_t __x);
+unsigned   __m65832_popcount64(__uint64_t __x);
+__uint16_t __m65832_bswap16(__uint16_t __x);
+__uint32_t __m65832_bswap32(__uint32_t __x);
+__uint64_t __m65832_bswap64(__uint64_t __x);
+
+#define __stdc_clz32(x)      __m65832_clz32(x)
+#define __stdc_clz64(x)      __m65832_clz64(x)
+#define __stdc_ctz32(x)      __m65832_ctz32(x)
+#define __stdc_ctz64(x)      __m65832_ctz64(x)
+#define __stdc_popcount32(x) __m65832_popcount32(x)
+#define __stdc_popcount64(x) __m65832_popcount64(x)
+
+#else
+
+static __inline unsigned
+__stdc_clz32(__uint32_t __x)
+{
+#if __has_builtin(__builtin_clzl)
+    return __x ? (unsigned)__builtin_clzl(__x) - (__SIZEOF_LONG__ * __CHAR_BIT__ - 32) : 32;
+#else
+    unsigned __n = 32;
+
+    while (__x) {
+        __x >>= 1;
+        __n--;
+    }
+    return __n;
+#endif
+}
+
+static __inline unsigned
+__stdc_clz64(__uint64_t __x)
+{
+#if __has_builtin(__builtin_clzll)
+    return __x ? (unsigned)__builtin_clzll(__x) - (__SIZEOF_LONG_LONG__ * __CHAR_BIT__ - 64) : 64;
+#else
+    if (__x >> 32)
+        return __stdc_clz32((__uint32_t)(__x >> 32));
+    return 32 + __stdc_clz32((__uint32_t)__x);
+#endif
+}
+
+static __inline unsigned
+__stdc_ctz32(__uint32_t __x)
+{
+#if __has_builtin(__builtin_ctzl)
+    return __x ? (unsigned)__builtin_ctzl(__x) : 32;
+#else
+    unsigned __n = 0;
+
+    if (!__x)
+        return 32;
+    while (!(__x & 1)) {
+        __x >>= 1;
+        __n++;
+    }
+    return __n;
+#endif
+}
+
+static __inline unsigned
+__stdc_ctz64(__uint64_t __x)
+{
+#if __has_builtin(__builtin_ctzll)
+    return __x ? (unsigned)__builtin_ctzll(__x) : 64;
+#else
+    if ((__uint32_t)__x)
+        return __stdc_ctz32((__uint32_t)__x);
+    return 32 + __stdc_ctz32((__uint32_t)(__x >> 32));
+#endif
+}
+
+static __inline unsigned
+__stdc_popcount32(__uint32_t __x)
+{
+#if __has_builtin(__builtin_popcountl)
+    return (unsigned)__builtin_popcountl(__x);
+#else
+    __x = __x - ((__x >> 1) & 0x55555555UL);
+    __x = (__x & 0x33333333UL) + ((__x >> 2) & 0x33333333UL);
+    __x = (__x + (__x >> 4)) & 0x0f0f0f0fUL;
+    return (unsigned)((__uint32_t)(__x * 0x01010101UL) >> 24);
+#endif
+}
+
+static __inline unsigned
+__stdc_popcount64(__uint64_t __x)
+{
+#if __has_builtin(__builtin_popcountll)
+    return (unsigned)__builtin_popcountll(__x);
+#else
+    return __stdc_popcount32((__uint32_t)__x) + __stdc_popcount32((__uint32_t)(__x >> 32));
+#endif
+}
+
+#endif /* __m65832__ */
+
+/*
+ * The functions for one type, on kernels of p bits (32 or 64, at
+ * least as wide as the type)
+ */
+#define __STDC_BIT_FUNCS(sfx, type, p) __STDC_BIT_FUNCS_(sfx, type, p)
+#define __STDC_BIT_FUNCS_(sfx, type, p)                                         \
+    static __inline unsigned __stdc_leading_zeros_##sfx(type __x)               \
+    {                                                                           \
+        return __stdc_clz##p(__x) - (p - sizeof(type) * __CHAR_BIT__);          \
+    }                                                                           \
+    static __inline unsigned __stdc_leading_ones_##sfx(type __x)                \
+    {                                                                           \
+        return __stdc_leading_zeros_##sfx((type)~__x);                          \
+    }                                                                           \
+    static __inline unsigned __stdc_trailing_zeros_##sfx(type __x)              \
+    {                                                                           \
+        unsigned __n = __stdc_ctz##p(__x);                                      \
+        return __n < sizeof(type) * __CHAR_BIT__ ? __n : sizeof(type) * __CHAR_BIT__; \
+    }                                                                           \
+    static __inline unsigned __stdc_trailing_ones_##sfx(type __x)               \
+    {                                                                           \
+        return __stdc_trailing_zeros_##sfx((type)~__x);                         \
+    }                                                                           \
+    static __inline unsigned __stdc_first_leading_zero_##sfx(type __x)          \
+    {                                                                           \
+        return __x == (type)~(type)0 ? 0 : __stdc_leading_ones_##sfx(__x) + 1;  \
+    }                                                                           \
+    static __inline unsigned __stdc_first_leading_one_##sfx(type __x)           \
+    {                                                                           \
+        return __x ? __stdc_leading_zeros_##sfx(__x) + 1 : 0;                   \
+    }                                                                           \
+    static __inline unsigned __stdc_first_trailing_zero_##sfx(type __x)         \
+    {                                                                           \
+        return __x == (type)~(type)0 ? 0 : __stdc_ctz##p((type)~__x) + 1;       \
+    }                                                                           \
+    static __inline unsigned __stdc_first_trailing_one_##sfx(type __x)          \
+    {                                                                           \
+        return __x ? __stdc_ctz##p(__x) + 1 : 0;                                \
+    }                                                                           \
+    static __inline unsigned __stdc_count_zeros_##sfx(type __x)                 \
+    {                                                                           \
+        return sizeof(type) * __CHAR_BIT__ - __stdc_popcount##p(__x);           \
+    }                                                                           \
+    static __inline unsigned __stdc_count_ones_##sfx(type __x)                  \
+    {                                                                           \
+        return __stdc_popcount##p(__x);                                         \
+    }                                                                           \
+    static __inline _Bool __stdc_has_single_bit_##sfx(type __x)                 \
+    {                                                                           \
+        return __x && !(__x & (type)(__x - 1));                                 \
+    }                                                                           \
+    static __inline unsigned __stdc_bit_width_##sfx(type __x)                   \
+    {                                                                           \
+        return p - __stdc_clz##p(__x);                                          \
+    }                                                                           \
+    static __inline type __stdc_bit_floor_##sfx(type __x)                       \
+    {                                                                           \
+        return __x ? (type)((type)1 << (__stdc_bit_width_##sfx(__x) - 1)) : 0;  \
+    }                                                                           \
+    static __inline type __stdc_bit_ceil_##sfx(type __x)                        \
+    {                                                                           \
+        unsigned __n;                                                           \
+        if (__x <= 1)                                                           \
+            return 1;                                                           \
+        __n = __stdc_bit_width_##sfx((type)(__x - 1));                          \
+        return __n < sizeof(type) * __CHAR_BIT__ ? (type)((type)1 << __n) : 0;  \
+    }
+
+#if __SIZEOF_LONG__ > 4
+#define __STDC_BIT_LONG 64
+#else
+#define __STDC_BIT_LONG 32
+#endif
+
+__STDC_BIT_FUNCS(uc, unsigned char, 32)
+__STDC_BIT_FUNCS(us, unsigned short, 32)
+__STDC_BIT_FUNCS(ui, unsigned int, 32)
+__STDC_BIT_FUNCS(ul, unsigned long, __STDC_BIT_LONG)
+__STDC_BIT_FUNCS(ull, unsigned long long, 64)
+unsigned int stdc_leading_zeros_uc(unsigned char __value);
+unsigned int stdc_leading_zeros_us(unsigned short __value);
+unsigned int stdc_leading_zeros_ui(unsigned int __value);
+unsigned int stdc_leading_zeros_ul(unsigned long __value);
+unsigned int stdc_leading_zeros_ull(unsigned long long __value);
+
+unsigned int stdc_leading_ones_uc(unsigned char __value);
+unsigned int stdc_leading_ones_us(unsigned short __value);
+unsigned int stdc_leading_ones_ui(unsigned int __value);
+unsigned int stdc_leading_ones_ul(unsigned long __value);
+unsigned int stdc_leading_ones_ull(unsigned long long __value);
+
+unsigned int stdc_trailing_zeros_uc(unsigned char __value);
+unsigned int stdc_trailing_zeros_us(unsigned short __value);
+unsigned int stdc_trailing_zeros_ui(unsigned int __value);
+unsigned int stdc_trailing_zeros_ul(unsigned long __value);
+unsigned int stdc_trailing_zeros_ull(unsigned long long __value);
+
+unsigned int stdc_trailing_ones_uc(unsigned char __value);
+unsigned int stdc_trailing_ones_us(unsigned short __value);
+unsigned int stdc_trailing_ones_ui(unsigned int __value);
+unsigned int stdc_trailing_ones_ul(unsigned long __value);
+unsigned int stdc_trailing_ones_ull(unsigned long long __value);
+
+unsigned int stdc_first_leading_zero_uc(unsigned char __value);
+unsigned int stdc_first_leading_zero_us(unsigned short __value);
+unsigned int stdc_first_leading_zero_ui(unsigned int __value);
+unsigned int stdc_first_leading_zero_ul(unsigned long __value);
+unsigned int stdc_first_leading_zero_ull(unsigned long long __value);
+
+unsigned int stdc_first_leading_one_uc(unsigned char __value);
+unsigned int stdc_first_leading_one_us(unsigned short __value);
+unsigned int stdc_first_leading_one_ui(unsigned int __value);
+unsigned int stdc_first_leading_one_ul(unsigned long __value);
+unsigned int stdc_first_leading_one_ull(unsigned long long __value);
+
+unsigned int stdc_first_trailing_zero_uc(unsigned char __value);
+unsigned int stdc_first_trailing_zero_us(unsigned short __value);
+unsigned int stdc_first_trailing_zero_ui(unsigned int __value);
+unsigned int stdc_first_trailing_zero_ul(unsigned long __value);
+unsigned int stdc_first_trailing_zero_ull(unsigned long long __value);
+
+unsigned int stdc_first_trailing_one_uc(unsigned char __value);
+unsigned int stdc_first_trailing_one_us(unsigned short __value);
+unsigned int stdc_first_trailing_one_ui(unsigned int __value);
+unsigned int stdc_first_trailing_one_ul(unsigned long __value);
+unsigned int stdc_first_trailing_one_ull(unsigned long long __value);
+
+unsigned int stdc_count_zeros_uc(unsigned char __value);
+unsigned int stdc_count_zeros_us(unsigned short __value);
+unsigned int stdc_count_zeros_ui(unsigned int __value);
+unsigned int stdc_count_zeros_ul(unsigned long __value);
+unsigned int stdc_count_zeros_ull(unsigned long long __value);
+
+unsigned int stdc_count_ones_uc(unsigned char __value);
+unsigned int stdc_count_ones_us(unsigned short __value);
+unsigned int stdc_count_ones_ui(unsigned int __value);
+unsigned int stdc_count_ones_ul(unsigned long __value);
+unsigned int stdc_count_ones_ull(unsigned long long __value);
+
+_Bool stdc_has_single_bit_uc(unsigned char __value);
+_Bool stdc_has_single_bit_us(unsigned short __value);
+_Bool stdc_has_single_bit_ui(unsigned int __value);
+_Bool stdc_has_single_bit_ul(unsigned long __value);
+_Bool stdc_has_single_bit_ull(unsigned long long __value);
+
+unsigned int stdc_bit_width_uc(unsigned char __value);
+unsigned int stdc_bit_width_us(unsigned short __value);
+unsigned int stdc_bit_width_ui(unsigned int __value);
+unsigned int stdc_bit_width_ul(unsigned long __value);
+unsigned int stdc_bit_width_ull(unsigned long long __value);
+
+unsigned char stdc_bit_floor_uc(unsigned char __value);
+unsigned short stdc_bit_floor_us(unsigned short __value);
+unsigned int stdc_bit_floor_ui(unsigned int __value);
+unsigned long stdc_bit_floor_ul(unsigned long __value);
+unsigned long long stdc_bit_floor_ull(unsigned long long __value);
+
+unsigned char stdc_bit_ceil_uc(unsigned char __value);
+unsigned short stdc_bit_ceil_us(unsigned short __value);
+unsigned int stdc_bit_ceil_ui(unsigned int __value);
+unsigned long stdc_bit_ceil_ul(unsigned long __value);
+unsigned long long stdc_bit_ceil_ull(unsigned long long __value);
+
+#define stdc_leading_zeros_uc(value) __stdc_leading_zeros_uc(value)
+#define stdc_leading_zeros_us(value) __stdc_leading_zeros_us(value)
+#define stdc_leading_zeros_ui(value) __stdc_leading_zeros_ui(value)
+#define stdc_leading_zeros_ul(value) __stdc_leading_zeros_ul(value)
+#define stdc_leading_zeros_ull(value) __stdc_leading_zeros_ull(value)
+
+#define stdc_leading_ones_uc(value) __stdc_leading_ones_uc(value)
+#define stdc_leading_ones_us(value) __stdc_leading_ones_us(value)
+#define stdc_leading_ones_ui(value) __stdc_leading_ones_ui(value)
+#define stdc_leading_ones_ul(value) __stdc_leading_ones_ul(value)
+#define stdc_leading_ones_ull(value) __stdc_leading_ones_ull(value)
+
+#define stdc_trailing_zeros_uc(value) __stdc_trailing_zeros_uc(value)
+#define stdc_trailing_zeros_us(value) __stdc_trailing_zeros_us(value)
+#define stdc_trailing_zeros_ui(value) __stdc_trailing_zeros_ui(value)
+#define stdc_trailing_zeros_ul(value) __stdc_trailing_zeros_ul(value)
+#define stdc_trailing_zeros_ull(value) __stdc_trailing_zeros_ull(value)
+
+#define stdc_trailing_ones_uc(value) __stdc_trailing_ones_uc(value)
+#define stdc_trailing_ones_us(value) __stdc_trailing_ones_us(value)
+#define stdc_trailing_ones_ui(value) __stdc_trailing_ones_ui(value)
+#define stdc_trailing_ones_ul(value) __stdc_trailing_ones_ul(value)
+#define stdc_trailing_ones_ull(value) __stdc_trailing_ones_ull(value)
+
+#define stdc_first_leading_zero_uc(value) __stdc_first_leading_zero_uc(value)
+#define stdc_first_leading_zero_us(value) __stdc_first_leading_zero_us(value)
+#define stdc_first_leading_zero_ui(value) __stdc_first_leading_zero_ui(value)
+#define stdc_first_leading_zero_ul(value) __stdc_first_leading_zero_ul(value)
+#define stdc_first_leading_zero_ull(value) __stdc_first_leading_zero_ull(value)
+
+#define stdc_first_leading_one_uc(value) __stdc_first_leading_one_uc(value)
+#define stdc_first_leading_one_us(value) __stdc_first_leading_one_us(value)
+#define stdc_first_leading_one_ui(value) __stdc_first_leading_one_ui(value)
+#define stdc_first_leading_one_ul(value) __stdc_first_leading_one_ul(value)
+#define stdc_first_leading_one_ull(value) __stdc_first_leading_one_ull(value)
+
+#define stdc_first_trailing_zero_uc(value) __stdc_first_trailing_zero_uc(value)
+#define stdc_first_trailing_zero_us(value) __stdc_first_trailing_zero_us(value)
+#define stdc_first_trailing_zero_ui(value) __stdc_first_trailing_zero_ui(value)
+#define stdc_first_trailing_zero_ul(value) __stdc_first_trailing_zero_ul(value)
+#define stdc_first_trailing_zero_ull(value) __stdc_first_trailing_zero_ull(value)
+
+#define stdc_first_trailing_one_uc(value) __stdc_first_trailing_one_uc(value)
+#define stdc_first_trailing_one_us(value) __stdc_first_trailing_one_us(value)
+#define stdc_first_trailing_one_ui(value) __stdc_first_trailing_one_ui(value)
+#define stdc_first_trailing_one_ul(value) __stdc_first_trailing_one_ul(value)
+#define stdc_first_trailing_one_ull(value) __stdc_first_trailing_one_ull(value)
+
+#define stdc_count_zeros_uc(value) __stdc_count_zeros_uc(value)
+#define stdc_count_zeros_us(value) __stdc_count_zeros_us(value)
+#define stdc_count_zeros_ui(value) __stdc_count_zeros_ui(value)
+#define stdc_count_zeros_ul(value) __stdc_count_zeros_ul(value)
+#define stdc_count_zeros_ull(value) __stdc_count_zeros_ull(value)
+
+#define stdc_count_ones_uc(value) __stdc_count_ones_uc(value)
+#define stdc_count_ones_us(value) __stdc_count_ones_us(value)
+#define stdc_count_ones_ui(value) __stdc_count_ones_ui(value)
+#define stdc_count_ones_ul(value) __stdc_count_ones_ul(value)
+#define stdc_count_ones_ull(value) __stdc_count_ones_ull(value)
+
+#define stdc_has_single_bit_uc(value) __stdc_has_single_bit_uc(value)
+#define stdc_has_single_bit_us(value) __stdc_has_single_bit_us(value)
+#define stdc_has_single_bit_ui(value) __stdc_has_single_bit_ui(value)
+#define stdc_has_single_bit_ul(value) __stdc_has_single_bit_ul(value)
+#define stdc_has_single_bit_ull(value) __stdc_has_single_bit_ull(value)
+
+#define stdc_bit_width_uc(value) __stdc_bit_width_uc(value)
+#define stdc_bit_width_us(value) __stdc_bit_width_us(value)
+#define stdc_bit_width_ui(value) __stdc_bit_width_ui(value)
+#define stdc_bit_width_ul(value) __stdc_bit_width_ul(value)
+#define stdc_bit_width_ull(value) __stdc_bit_width_ull(value)
+
+#define stdc_bit_floor_uc(value) __stdc_bit_floor_uc(value)
+#define stdc_bit_floor_us(value) __stdc_bit_floor_us(value)
+#define stdc_bit_floor_ui(value) __stdc_bit_floor_ui(value)
+#define stdc_bit_floor_ul(value) __stdc_bit_floor_ul(value)
+#define stdc_bit_floor_ull(value) __stdc_bit_floor_ull(value)
+
+#define stdc_bit_ceil_uc(value) __stdc_bit_ceil_uc(value)
+#define stdc_bit_ceil_us(value) __stdc_bit_ceil_us(value)
+#define stdc_bit_ceil_ui(value) __stdc_bit_ceil_ui(value)
+#define stdc_bit_ceil_ul(value) __stdc_bit_ceil_ul(value)
+#define stdc_bit_ceil_ull(value) __stdc_bit_ceil_ull(value)
+
+#ifndef __cplusplus
+
+#define __STDC_BIT_GENERIC(op, value)                                           \
+    _Generic((value),                                                           \
+        unsigned char: __stdc_##op##_uc,                                        \
+        unsigned short: __stdc_##op##_us,                                       \
+        unsigned int: __stdc_##op##_ui,                                         \
+        unsigned long: __stdc_##op##_ul,                                        \
+        unsigned long long: __stdc_##op##_ull)(value)
+
+#define stdc_leading_zeros(value) __STDC_BIT_GENERIC(leading_zeros, value)
+#define stdc_leading_ones(value) __STDC_BIT_GENERIC(leading_ones, value)
+#define stdc_trailing_zeros(value) __STDC_BIT_GENERIC(trailing_zeros, value)
+#define stdc_trailing_ones(value) __STDC_BIT_GENERIC(trailing_ones, value)
+#define stdc_first_leading_zero(value) __STDC_BIT_GENERIC(first_leading_zero, value)
+#define stdc_first_leading_one(value) __STDC_BIT_GENERIC(first_leading_one, value)
+#define stdc_first_trailing_zero(value) __STDC_BIT_GENERIC(first_trailing_zero, value)
+#define stdc_first_trailing_one(value) __STDC_BIT_GENERIC(first_trailing_one, value)
+#define stdc_count_zeros(value) __STDC_BIT_GENERIC(count_zeros, value)
+#define stdc_count_ones(value) __STDC_BIT_GENERIC(count_ones, value)
+#define stdc_has_single_bit(value) __STDC_BIT_GENERIC(has_single_bit, value)
+#define stdc_bit_width(value) __STDC_BIT_GENERIC(bit_width, value)
+#define stdc_bit_floor(value) __STDC_BIT_GENERIC(bit_floor, value)
+#define stdc_bit_ceil(value) __STDC_BIT_GENERIC(bit_ceil, value)
+
+#endif /* !__cplusplus */
+
+_END_STD_C
+
+#endif /* _STDBIT_H_ */
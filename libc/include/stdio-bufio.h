@@ -44,6 +44,10 @@
 #define __BLBF  0x0002 /* bufio is line buffered */
 #define __BFALL 0x0004 /* FILE is allocated by stdio */
 #define __BFPTR 0x0008 /* funcs need pointers instead of ints */
+#define __BFPOOL 0x0010 /* FILE and buf are a slot of the static fopen pool */
+#define __BAPP  0x0020 /* file was opened with O_APPEND */
+
+struct iovec;
 
 union __file_bufio_cookie {
     int   fd;
@@ -62,8 +66,8 @@ struct __file_bufio {
     __off_t           pos; /* FD position */
     char             *buf;
     int               size; /* sizeof buf */
-    int               len;  /* valid data in buf */
-    int               off;  /* offset of data in buf */
+    int               len;  /* valid data in buf; writing: where the next byte goes */
+    int               off;  /* offset of data in buf; writing: end of data past len */
     union {
         ssize_t (*read_int)(int fd, void *buf, size_t count);
         ssize_t (*read_ptr)(void *ptr, void *buf, size_t count);
@@ -80,6 +84,14 @@ struct __file_bufio {
         int (*close_int)(int fd);
         int (*close_ptr)(void *ptr);
     };
+    union {
+        ssize_t (*writev_int)(int fd, const struct iovec *iov, int iovcnt);
+        ssize_t (*writev_ptr)(void *ptr, const struct iovec *iov, int iovcnt);
+    };
+    union {
+        ssize_t (*readv_int)(int fd, const struct iovec *iov, int iovcnt);
+        ssize_t (*readv_ptr)(void *ptr, const struct iovec *iov, int iovcnt);
+    };
 #ifdef __STDIO_BUFIO_LOCKING
     _LOCK_T lock;
 #endif
@@ -87,9 +99,11 @@ struct __file_bufio {
 
 #define FDEV_SETUP_BUFIO(_fd, _buf, _size, _read, _write, _lseek, _close, _rwflag, _bflags)        \
     {                                                                                              \
-        .xfile = FDEV_SETUP_EXT(__bufio_put, __bufio_get, __bufio_flush,                           \
-                                (_bflags) & (__BALL | __BFALL) ? __bufio_close : __bufio_close_nf, \
-                                __bufio_seek, NULL, (_rwflag) | __SBUF),                           \
+        .xfile = FDEV_SETUP_EXT_SPAN(__bufio_put, __bufio_get, __bufio_put_span, __bufio_get_span, \
+                                     __bufio_flush,                                                \
+                                     (_bflags) & (__BALL | __BFALL | __BFPOOL) ? __bufio_close     \
+                                                                    : __bufio_close_nf,            \
+                                     __bufio_seek, NULL, (_rwflag) | __SBUF),                      \
         .ptr = (void *)(intptr_t)(_fd), .dir = 0, .bflags = (_bflags), .pos = 0, .buf = _buf,      \
         .size = _size, .len = 0, .off = 0, { .read_int = _read }, { .write_int = _write },         \
         { .lseek_int = _lseek },                                                                   \
@@ -98,11 +112,54 @@ struct __file_bufio {
         }                                                                                          \
     }
 
+/*
+ * Like FDEV_SETUP_BUFIO, but also supplies a writev function which
+ * lets bufio send buffered data and a large caller buffer together
+ */
+#define FDEV_SETUP_BUFIO_WRITEV(_fd, _buf, _size, _read, _write, _writev, _lseek, _close, _rwflag, \
+                                _bflags)                                                           \
+    {                                                                                              \
+        .xfile = FDEV_SETUP_EXT_SPAN(__bufio_put, __bufio_get, __bufio_put_span, __bufio_get_span, \
+                                     __bufio_flush,                                                \
+                                     (_bflags) & (__BALL | __BFALL | __BFPOOL) ? __bufio_close     \
+                                                                    : __bufio_close_nf,            \
+                                     __bufio_seek, NULL, (_rwflag) | __SBUF),                      \
+        .ptr = (void *)(intptr_t)(_fd), .dir = 0, .bflags = (_bflags), .pos = 0, .buf = _buf,      \
+        .size = _size, .len = 0, .off = 0, { .read_int = _read }, { .write_int = _write },         \
+        { .lseek_int = _lseek }, { .close_int = _close },                                          \
+        {                                                                                          \
+            .writev_int = _writev                                                                  \
+        }                                                                                          \
+    }
+
+/*
+ * Like FDEV_SETUP_BUFIO_WRITEV, but also supplies a readv function
+ * which lets bufio fill a large caller buffer and refill its own
+ * buffer from the data after it in one call
+ */
+#define FDEV_SETUP_BUFIO_IOV(_fd, _buf, _size, _read, _write, _readv, _writev, _lseek, _close,      \
+                             _rwflag, _bflags)                                                     \
+    {                                                                                              \
+        .xfile = FDEV_SETUP_EXT_SPAN(__bufio_put, __bufio_get, __bufio_put_span, __bufio_get_span, \
+                                     __bufio_flush,                                                \
+                                     (_bflags) & (__BALL | __BFALL | __BFPOOL) ? __bufio_close     \
+                                                                    : __bufio_close_nf,            \
+                                     __bufio_seek, NULL, (_rwflag) | __SBUF),                      \
+        .ptr = (void *)(intptr_t)(_fd), .dir = 0, .bflags = (_bflags), .pos = 0, .buf = _buf,      \
+        .size = _size, .len = 0, .off = 0, { .read_int = _read }, { .write_int = _write },         \
+        { .lseek_int = _lseek }, { .close_int = _close }, { .writev_int = _writev },               \
+        {                                                                                          \
+            .readv_int = _readv                                                                    \
+        }                                                                                          \
+    }
+
 #define FDEV_SETUP_BUFIO_PTR(_ptr, _buf, _size, _read, _write, _lseek, _close, _rwflag, _bflags)   \
     {                                                                                              \
-        .xfile = FDEV_SETUP_EXT(__bufio_put, __bufio_get, __bufio_flush,                           \
-                                (_bflags) & (__BALL | __BFALL) ? __bufio_close : __bufio_close_nf, \
-                                __bufio_seek, NULL, (_rwflag) | __SBUF),                           \
+        .xfile = FDEV_SETUP_EXT_SPAN(__bufio_put, __bufio_get, __bufio_put_span, __bufio_get_span, \
+                                     __bufio_flush,                                                \
+                                     (_bflags) & (__BALL | __BFALL | __BFPOOL) ? __bufio_close     \
+                                                                    : __bufio_close_nf,            \
+                                     __bufio_seek, NULL, (_rwflag) | __SBUF),                      \
         .ptr = _ptr, .dir = 0, .bflags = (_bflags) | __BFPTR, .pos = 0, .buf = _buf,               \
         .size = _size, .len = 0, .off = 0, { .read_ptr = _read }, { .write_ptr = _write },         \
         { .lseek_ptr = _lseek },                                                                   \
@@ -156,12 +213,18 @@ int   __bufio_fill_locked(FILE *f);
 
 int   __bufio_setdir_locked(FILE *f, uint8_t dir);
 
+size_t __bufio_write_direct_locked(FILE *f, const void *buf, size_t count);
+
 int   __bufio_flush(FILE *f);
 
 int   __bufio_put(char c, FILE *f);
 
 int   __bufio_get(FILE *f);
 
+size_t __bufio_put_span(const char *s, size_t len, FILE *f);
+
+size_t __bufio_get_span(char *s, size_t len, FILE *f);
+
 off_t __bufio_seek(FILE *f, off_t offset, int whence);
 
 int   __bufio_setvbuf(FILE *f, char *buf, int mode, size_t size);
@@ -170,4 +233,76 @@ int   __bufio_close(FILE *f);
 
 int   __bufio_close_nf(FILE *f);
 
+/*
+ * ungetc for bufio streams: when c is the byte just read, step back
+ * over it in the buffer instead of using the single unget slot. That
+ * allows as much pushback as the buffer still holds, and leaves the
+ * slot empty so the next getc stays on the fast path. Returns zero
+ * when the caller has to use the slot.
+ */
+static inline int
+__bufio_unget(FILE *f, int c)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+    int                  ret = 0;
+
+    __bufio_lock(f);
+    if (bf->dir == __SRD && bf->off > 0 && bf->off <= bf->len
+        && (unsigned char)bf->buf[bf->off - 1] == (unsigned char)c) {
+        bf->off--;
+        ret = 1;
+    }
+    __bufio_unlock(f);
+    return ret;
+}
+
+/*
+ * Inline getc_unlocked and putc_unlocked for bufio streams. When the
+ * buffer already holds the next byte, or has room for one more which
+ * won't need flushing, these touch it directly; everything else goes
+ * to the library functions. That's only safe when the caller holds
+ * the FILE lock (or there are no threads), not when bufio has a lock
+ * of its own, so the macros are left alone in that configuration.
+ */
+#if defined(__FAST_BUFIO) && !defined(__STDIO_BUFIO_LOCKING) && __POSIX_VISIBLE >= 199309L
+
+static __inline int
+__bufio_getc_unlocked(FILE *f)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+
+    if ((f->flags & (__SBUF | __SRD)) == (__SBUF | __SRD) && bf->dir == __SRD && !f->unget
+        && bf->off < bf->len)
+        return (unsigned char)bf->buf[bf->off++];
+    return (getc_unlocked)(f);
+}
+
+static __inline int
+__bufio_putc_unlocked(int c, FILE *f)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+
+    if ((f->flags & (__SBUF | __SWR)) == (__SBUF | __SWR) && bf->dir == __SWR
+        && bf->len < bf->size - 1 && (c != '\n' || !(bf->bflags & __BLBF))) {
+        bf->buf[bf->len++] = (char)c;
+        return (unsigned char)c;
+    }
+    return (putc_unlocked)(c, f);
+}
+
+#undef getc_unlocked
+#undef putc_unlocked
+#define getc_unlocked(f)    __bufio_getc_unlocked(f)
+#define putc_unlocked(c, f) __bufio_putc_unlocked(c, f)
+
+#ifndef __STDIO_LOCKING
+/* No FILE lock either, so getc and putc are the same functions */
+#undef getc
+#undef putc
+#define getc(f)    __bufio_getc_unlocked(f)
+#define putc(c, f) __bufio_putc_unlocked(c, f)
+#endif
+
+#endif /* __FAST_BUFIO && !__STDIO_BUFIO_LOCKING */
+
 #endif /* _STDIO_BUFIO_H_ */
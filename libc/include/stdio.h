@@ -100,6 +100,14 @@ struct __file {
     int (*put)(char, struct __file *); /* function to write one char to device */
     int (*get)(struct __file *);       /* function to read one char from device */
     int (*flush)(struct __file *);     /* function to flush output to device */
+    /*
+     * Optional bulk transfers. put_span writes len bytes and returns
+     * how many went out, fewer meaning an error. get_span reads up to
+     * len bytes and returns how many arrived, fewer meaning end of
+     * file or an error, which it records in flags.
+     */
+    size_t (*put_span)(const char *, size_t, struct __file *);
+    size_t (*get_span)(char *, size_t, struct __file *);
 #ifdef __STDIO_LOCKING
     _LOCK_RECURSIVE_T lock;
 #endif
@@ -120,25 +128,34 @@ struct __file_close {
     int           (*close)(struct __file *); /* function to close file */
 };
 
-#define FDEV_SETUP_CLOSE(__put, __get, __flush, __close, __flags)               \
-    {                                                                           \
-        .file = FDEV_SETUP_STREAM(__put, __get, __flush, (__flags) | __SCLOSE), \
-        .close = (__close),                                                     \
+#define FDEV_SETUP_CLOSE_SPAN(__put, __get, __put_span, __get_span, __flush, __close, __flags) \
+    {                                                                                       \
+        .file = FDEV_SETUP_STREAM_SPAN(__put, __get, __put_span, __get_span, __flush,       \
+                                       (__flags) | __SCLOSE),                               \
+        .close = (__close),                                                                 \
     }
 
+#define FDEV_SETUP_CLOSE(__put, __get, __flush, __close, __flags) \
+    FDEV_SETUP_CLOSE_SPAN(__put, __get, NULL, NULL, __flush, __close, __flags)
+
 struct __file_ext {
     struct __file_close cfile; /* close file struct */
     __off_t             (*seek)(struct __file *, __off_t offset, int whence);
     int                 (*setvbuf)(struct __file *, char *buf, int mode, size_t size);
 };
 
-#define FDEV_SETUP_EXT(__put, __get, __flush, __close, __seek, __setvbuf, __flags)     \
-    {                                                                                  \
-        .cfile = FDEV_SETUP_CLOSE(__put, __get, __flush, __close, (__flags) | __SEXT), \
-        .seek = (__seek),                                                              \
-        .setvbuf = (__setvbuf),                                                        \
+#define FDEV_SETUP_EXT_SPAN(__put, __get, __put_span, __get_span, __flush, __close, __seek,     \
+                            __setvbuf, __flags)                                               \
+    {                                                                                         \
+        .cfile = FDEV_SETUP_CLOSE_SPAN(__put, __get, __put_span, __get_span, __flush, __close, \
+                                       (__flags) | __SEXT),                                   \
+        .seek = (__seek),                                                                     \
+        .setvbuf = (__setvbuf),                                                               \
     }
 
+#define FDEV_SETUP_EXT(__put, __get, __flush, __close, __seek, __setvbuf, __flags) \
+    FDEV_SETUP_EXT_SPAN(__put, __get, NULL, NULL, __flush, __close, __seek, __setvbuf, __flags)
+
 /*@{*/
 /**
    \c FILE is the opaque structure that is passed around between the
@@ -195,14 +212,24 @@ extern FILE * const stderr;
  */
 #define _FDEV_EOF (-2)
 
-#define FDEV_SETUP_STREAM(__put, __get, __flush, __flags) \
-    {                                                     \
-        .flags = (__flags),                               \
-        .put = (__put),                                   \
-        .get = (__get),                                   \
-        .flush = (__flush),                               \
+/*
+ * The _SPAN variants also supply the put_span and get_span bulk
+ * transfer functions, which fputs, fwrite, puts, printf and fread use
+ * in place of a call per byte
+ */
+#define FDEV_SETUP_STREAM_SPAN(__put, __get, __put_span, __get_span, __flush, __flags) \
+    {                                                                                  \
+        .flags = (__flags),                                                            \
+        .put = (__put),                                                                \
+        .get = (__get),                                                                \
+        .flush = (__flush),                                                            \
+        .put_span = (__put_span),                                                      \
+        .get_span = (__get_span),                                                      \
     }
 
+#define FDEV_SETUP_STREAM(__put, __get, __flush, __flags) \
+    FDEV_SETUP_STREAM_SPAN(__put, __get, NULL, NULL, __flush, __flags)
+
 FILE *fdevopen(int (*__put)(char, FILE *), int (*__get)(FILE *), int (*__flush)(FILE *));
 int   fclose(FILE *__stream) __nonnull((1));
 int   fflush(FILE *stream) __nonnull((1));
@@ -284,6 +311,56 @@ char *asnprintf(char *str, size_t *lenp, const char *fmt, ...) __PRINTF_ATTRIBUT
 int   vasprintf(char **strp, const char *fmt, __gnuc_va_list ap) __PRINTF_ATTRIBUTE__(2, 0);
 char *vasnprintf(char *str, size_t *lenp, const char *fmt, __gnuc_va_list ap)
     __PRINTF_ATTRIBUTE__(3, 0);
+struct malloc_arena;
+int malloc_arena_asprintf(struct malloc_arena *arena, char **strp, const char *fmt, ...)
+    __PRINTF_ATTRIBUTE__(3, 4);
+int malloc_arena_vasprintf(struct malloc_arena *arena, char **strp, const char *fmt,
+                           __gnuc_va_list ap) __PRINTF_ATTRIBUTE__(3, 0);
+FILE *malloc_arena_open_memstream(struct malloc_arena *arena, char **bufp, size_t *sizep);
+
+/*
+ * Pre-compiled formats. A descriptor is an array of printf_op, each
+ * printing an optional literal followed by an optional conversion,
+ * ended by PRINTF_OP_END:
+ *
+ *   static const struct printf_op fmt[] = {
+ *       PRINTF_OP("count=", d), PRINTF_OP(" name=", s), PRINTF_OP_LIT("\n"), PRINTF_OP_END
+ *   };
+ *   printf_desc(fmt, count, name);
+ *
+ * is equivalent to printf("count=%d name=%s\n", count, name) without
+ * parsing the format at runtime. Each conversion is a separate
+ * function, so only those named in some descriptor are linked in.
+ * Conversions are d u x ld lu lx lld llu llx s c, all without flags,
+ * width or precision.
+ */
+typedef int (*__printf_conv_t)(FILE *__stream, __gnuc_va_list *__ap);
+
+struct printf_op {
+    __printf_conv_t conv;
+    const char     *lit;
+};
+
+#define PRINTF_OP(__lit, __conv) { __printf_conv_##__conv, __lit }
+#define PRINTF_OP_LIT(__lit)     { 0, __lit }
+#define PRINTF_OP_END            { 0, 0 }
+
+int __printf_conv_d(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_u(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_x(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_ld(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_lu(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_lx(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_lld(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_llu(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_llx(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_s(FILE *__stream, __gnuc_va_list *__ap);
+int __printf_conv_c(FILE *__stream, __gnuc_va_list *__ap);
+
+int printf_desc(const struct printf_op *__ops, ...);
+int fprintf_desc(FILE *__stream, const struct printf_op *__ops, ...) __nonnull((1));
+int vfprintf_desc(FILE *__stream, const struct printf_op *__ops, __gnuc_va_list __ap)
+    __nonnull((1));
 
 int    fputs(const char *__str, FILE *__stream) __nonnull((2));
 int    puts(const char *__str);
@@ -336,6 +413,20 @@ int  feof_unlocked(FILE *__stream) __nonnull((1));
 #define feof_unlocked(s)     __feof_unlocked(s)
 #endif
 
+#if __MISC_VISIBLE
+int    fgetc_unlocked(FILE *__stream) __nonnull((1));
+int    fputc_unlocked(int __c, FILE *__stream) __nonnull((2));
+size_t fread_unlocked(void *__ptr, size_t __size, size_t __nmemb, FILE *__stream) __nonnull((4));
+size_t fwrite_unlocked(const void *__ptr, size_t __size, size_t __nmemb, FILE *__stream)
+    __nonnull((4));
+int    fflush_unlocked(FILE *__stream) __nonnull((1));
+int    fileno_unlocked(FILE *__stream) __nonnull((1));
+#endif
+#if __GNU_VISIBLE
+char *fgets_unlocked(char *__str, int __size, FILE *__stream) __nonnull((3));
+int   fputs_unlocked(const char *__str, FILE *__stream) __nonnull((2));
+#endif
+
 #ifndef SEEK_SET
 #define SEEK_SET 0 /* set file offset to offset */
 #endif
@@ -409,6 +500,7 @@ FILE    *fopen(const char *path, const char *mode) __malloc_like_with_free(fclos
 FILE    *freopen(const char *path, const char *mode, FILE *stream) __nonnull((3));
 FILE    *fdopen(int, const char *) __malloc_like_with_free(fclose, 1);
 FILE    *fmemopen(void *buf, size_t size, const char *mode) __malloc_like_with_free(fclose, 1);
+FILE    *open_memstream(char **bufp, size_t *sizep) __malloc_like_with_free(fclose, 1);
 int      fseek(FILE *stream, long offset, int whence) __nonnull((1));
 int      fseeko(FILE *stream, __off_t offset, int whence) __nonnull((1));
 int      fsetpos(FILE *stream, const fpos_t *pos) __nonnull((1));
@@ -429,6 +521,8 @@ _ssize_t getline(char ** __restrict lineptr, size_t * __restrict n, FILE * __res
     __nonnull((3));
 _ssize_t getdelim(char ** __restrict lineptr, size_t * __restrict n, int delim,
                   FILE * __restrict stream) __nonnull((4));
+_ssize_t getdelim_max(char ** __restrict lineptr, size_t * __restrict n, int delim, size_t max,
+                      FILE * __restrict stream) __nonnull((5));
 
 #if __BSD_VISIBLE
 FILE *funopen(const void *cookie, _ssize_t (*readfn)(void *cookie, void *buf, size_t n),
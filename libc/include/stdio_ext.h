@@ -0,0 +1,39 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#ifndef _STDIO_EXT_H_
+#define _STDIO_EXT_H_
+
+#include <sys/cdefs.h>
+#include <stdio.h>
+
+_BEGIN_STD_C
+
+/*
+ * Direct access to stream buffers, as found in other C libraries.
+ * These work on bufio and fmemopen streams; other streams have no
+ * buffer and always report an empty window. They do not take the
+ * stream lock, use flockfile around a sequence of calls.
+ *
+ * __freadptr returns the buffered input that can be consumed in place
+ * and stores its length in *sizep, or returns NULL if nothing is
+ * buffered (including when an ungetc is pending); getc then refills
+ * the buffer. __freadptrinc consumes bytes from that window.
+ *
+ * __fwriteptr returns free buffer space to write in place, flushing a
+ * full bufio buffer first, or NULL if there is none. __fwriteptrinc
+ * commits bytes written there, flushing as putc would.
+ */
+size_t      __fpending(FILE *__stream);
+size_t      __freadahead(FILE *__stream);
+const char *__freadptr(FILE *__stream, size_t *__sizep);
+void        __freadptrinc(FILE *__stream, size_t __increment);
+char       *__fwriteptr(FILE *__stream, size_t *__sizep);
+void        __fwriteptrinc(FILE *__stream, size_t __increment);
+
+_END_STD_C
+
+#endif /* _STDIO_EXT_H_ */
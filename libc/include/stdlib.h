@@ -92,6 +92,10 @@ size_t __locale_mb_cur_max(void);
 
 /* Declare free up here so it can be used with __malloc_like */
 void free(void *) __nothrow;
+#if __ISO_C_VISIBLE >= 2023
+void free_sized(void *, size_t) __nothrow;
+void free_aligned_sized(void *, size_t, size_t) __nothrow;
+#endif
 
 #if __ISO_C_VISIBLE >= 1999
 __noreturn void _Exit(int __status);
@@ -180,6 +184,10 @@ __malloc_like __warn_unused_result __alloc_size(1) __nothrow;
 int    mblen(const char *, size_t);
 size_t mbstowcs(wchar_t * __restrict, const char * __restrict, size_t);
 int    mbtowc(wchar_t    *__restrict, const char    *__restrict, size_t);
+#if __BSD_VISIBLE
+int mergesort(void *__base, size_t __nmemb, size_t __size,
+              int (*__compar)(const void *, const void *));
+#endif
 #if __BSD_VISIBLE || __POSIX_VISIBLE >= 200809
 char *mkdtemp(char *);
 #endif
@@ -230,6 +238,27 @@ void __bsd_qsort_r(void *__base, size_t __nmemb, size_t __size, void *__thunk,
 #define qsort_r __bsd_qsort_r
 #endif
 #endif
+#if __MISC_VISIBLE
+void qsort_int32(__int32_t *__base, size_t __nmemb);
+void qsort_uint32(__uint32_t *__base, size_t __nmemb);
+void qsort_int64(__int64_t *__base, size_t __nmemb);
+void qsort_float(float *__base, size_t __nmemb);
+void qsort_double(double *__base, size_t __nmemb);
+void qsort_str(char **__base, size_t __nmemb);
+void radixsort_uint32(__uint32_t *__base, size_t __nmemb, __uint32_t *__tmp);
+void radixsort_int32(__int32_t *__base, size_t __nmemb, __int32_t *__tmp);
+__int32_t  *bsearch_int32(__int32_t __key, const __int32_t *__base, size_t __nmemb);
+__uint32_t *bsearch_uint32(__uint32_t __key, const __uint32_t *__base, size_t __nmemb);
+__int64_t  *bsearch_int64(__int64_t __key, const __int64_t *__base, size_t __nmemb);
+void        eytzinger_int32(__int32_t *__tree, const __int32_t *__sorted, size_t __nmemb);
+void        eytzinger_uint32(__uint32_t *__tree, const __uint32_t *__sorted, size_t __nmemb);
+void        eytzinger_int64(__int64_t *__tree, const __int64_t *__sorted, size_t __nmemb);
+__int32_t  *eytzinger_bsearch_int32(__int32_t __key, const __int32_t *__tree, size_t __nmemb);
+__uint32_t *eytzinger_bsearch_uint32(__uint32_t __key, const __uint32_t *__tree, size_t __nmemb);
+__int64_t  *eytzinger_bsearch_int64(__int64_t __key, const __int64_t *__tree, size_t __nmemb);
+int         timsort(void *__base, size_t __nmemb, size_t __size,
+                    int (*__compar)(const void *, const void *), void *__tmp);
+#endif
 int rand(void);
 #if __POSIX_VISIBLE
 int rand_r(unsigned *__seed);
@@ -237,6 +266,23 @@ int rand_r(unsigned *__seed);
 #if __SVID_VISIBLE || __XSI_VISIBLE >= 4 || __BSD_VISIBLE
 long random(void);
 #endif
+#if __MISC_VISIBLE
+struct xoshiro128pp {
+    __uint32_t __s[4];
+};
+void       xoshiro128pp_seed(struct xoshiro128pp *__state, __uint64_t __seed);
+__uint32_t xoshiro128pp_next(struct xoshiro128pp *__state);
+__uint32_t xoshiro128pp_uniform(struct xoshiro128pp *__state, __uint32_t __upper_bound);
+void       xoshiro128pp_fill(struct xoshiro128pp *__state, void *__buf, size_t __n);
+struct pcg32 {
+    __uint64_t __state;
+    __uint64_t __inc;
+};
+void       pcg32_seed(struct pcg32 *__state, __uint64_t __seed, __uint64_t __seq);
+__uint32_t pcg32_next(struct pcg32 *__state);
+__uint32_t pcg32_uniform(struct pcg32 *__state, __uint32_t __upper_bound);
+void       pcg32_fill(struct pcg32 *__state, void *__buf, size_t __n);
+#endif
 void *
 realloc(void *, size_t)
 __warn_unused_result __alloc_size(2) __nothrow;
@@ -293,6 +339,13 @@ int strfroml(char * __restrict str, size_t n, const char * __restrict format, lo
 #define strtodf strtof
 #endif
 #endif
+#if __MISC_VISIBLE
+/* Convert a run of numbers from a text buffer in one call */
+size_t strtod_array(const char * __restrict __buf, size_t __len, double * __restrict __vals,
+                    size_t __nvals, size_t * __restrict __ends);
+size_t strtof_array(const char * __restrict __buf, size_t __len, float * __restrict __vals,
+                    size_t __nvals, size_t * __restrict __ends);
+#endif
 long strtol(const char * __restrict __n, char ** __restrict __end_PTR, int __base);
 #ifdef __HAVE_LONG_DOUBLE
 #if __ISO_C_VISIBLE >= 1999
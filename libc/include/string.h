@@ -84,6 +84,25 @@ void *memcpy(void * __restrict, const void * __restrict, size_t);
 #if __GNU_VISIBLE
 void *memmem(const void *, size_t, const void *, size_t);
 #endif
+#if __MISC_VISIBLE
+struct memmem_set;
+struct memmem_set_state {
+    size_t __node;
+    size_t __out;
+};
+#define MEMMEM_SET_STATE_INIT { 0, 0 }
+struct memmem_set *memmem_set_compile(const void * const *__needles, const size_t *__lens,
+                                      size_t __n);
+void  memmem_set_free(struct memmem_set *__set);
+void *memmem_set(const struct memmem_set *__set, const void *__haystack, size_t __len,
+                 size_t *__which);
+void *memmem_set_next(const struct memmem_set *__set, struct memmem_set_state *__state,
+                      const void *__buf, size_t __len, size_t *__which);
+struct memmem_needle;
+struct memmem_needle *memmem_prepare(const void *__needle, size_t __len);
+void *memmem_prepared(const struct memmem_needle *__prep, const void *__haystack, size_t __len);
+void  memmem_prepare_free(struct memmem_needle *__prep);
+#endif
 void *memmove(void *, const void *, size_t);
 #if __GNU_VISIBLE
 void *mempcpy(void *, const void *, size_t);
@@ -192,12 +211,25 @@ char *strsignal(int __signo);
 #endif
 size_t strspn(const char *, const char *);
 char  *strstr(const char *, const char *);
+#if __MISC_VISIBLE
+char *strstr_set(const struct memmem_set *__set, const char *__haystack, size_t *__which);
+char *strstr_prepared(const struct memmem_needle *__prep, const char *__haystack);
+#endif
 char  *strtok(char  *__restrict, const char  *__restrict);
 #if __MISC_VISIBLE || __POSIX_VISIBLE || __ZEPHYR_VISIBLE
 char *strtok_r(char * __restrict, const char * __restrict, char ** __restrict);
 #endif
 #if __MISC_VISIBLE
-char *strupr(char *);
+struct strset {
+    unsigned char __bits[32];
+};
+void   strset_init(struct strset *__set, const char *__chars);
+size_t strspn_set(const char *, const struct strset *__set);
+size_t strcspn_set(const char *, const struct strset *__set);
+char  *strpbrk_set(const char *, const struct strset *__set);
+char  *strtok_set_r(char * __restrict, const struct strset *__set, char ** __restrict);
+char  *strsep_set(char **, const struct strset *__set);
+char  *strupr(char *);
 #endif
 #if __GNU_VISIBLE
 int strverscmp(const char *, const char *);
@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Accuracy tiers for some float functions, included by <math.h>
+ *
+ * expf, exp2f, logf, log2f, powf, sinf and cosf also come as
+ * __fast_<name>, within 4 ULP and free to skip errno and exception
+ * handling, and expf, exp2f, logf and log2f as __cr_<name>, correctly
+ * rounded in round-to-nearest. Defining __MATH_TIER before including
+ * <math.h> sends calls to one tier, and __MATH_TIER_<name> picks a
+ * tier for one function:
+ *
+ *     -D__MATH_TIER=__MATH_TIER_FAST -D__MATH_TIER_logf=__MATH_TIER_CR
+ *
+ * A function without the requested tier keeps its default version.
+ * To switch a whole program, including code built without these
+ * macros, link with -Wl,-u,__fast_expf,--defsym=expf=__fast_expf
+ * instead.
+ */
+
+#ifndef _SYS__MATHTIER_H_
+#define _SYS__MATHTIER_H_
+
+#define __MATH_TIER_DEFAULT 0
+#define __MATH_TIER_FAST    1
+#define __MATH_TIER_CR      2
+
+#ifndef __MATH_TIER
+#define __MATH_TIER __MATH_TIER_DEFAULT
+#endif
+
+float __fast_expf(float);
+float __fast_exp2f(float);
+float __fast_logf(float);
+float __fast_log2f(float);
+float __fast_powf(float, float);
+float __fast_sinf(float);
+float __fast_cosf(float);
+
+float __cr_expf(float);
+float __cr_exp2f(float);
+float __cr_logf(float);
+float __cr_log2f(float);
+
+#ifndef __MATH_TIER_expf
+#define __MATH_TIER_expf __MATH_TIER
+#endif
+#if __MATH_TIER_expf == __MATH_TIER_FAST
+#define expf __fast_expf
+#elif __MATH_TIER_expf == __MATH_TIER_CR
+#define expf __cr_expf
+#endif
+
+#ifndef __MATH_TIER_exp2f
+#define __MATH_TIER_exp2f __MATH_TIER
+#endif
+#if __MATH_TIER_exp2f == __MATH_TIER_FAST
+#define exp2f __fast_exp2f
+#elif __MATH_TIER_exp2f == __MATH_TIER_CR
+#define exp2f __cr_exp2f
+#endif
+
+#ifndef __MATH_TIER_logf
+#define __MATH_TIER_logf __MATH_TIER
+#endif
+#if __MATH_TIER_logf == __MATH_TIER_FAST
+#define logf __fast_logf
+#elif __MATH_TIER_logf == __MATH_TIER_CR
+#define logf __cr_logf
+#endif
+
+#ifndef __MATH_TIER_log2f
+#define __MATH_TIER_log2f __MATH_TIER
+#endif
+#if __MATH_TIER_log2f == __MATH_TIER_FAST
+#define log2f __fast_log2f
+#elif __MATH_TIER_log2f == __MATH_TIER_CR
+#define log2f __cr_log2f
+#endif
+
+#ifndef __MATH_TIER_powf
+#define __MATH_TIER_powf __MATH_TIER
+#endif
+#if __MATH_TIER_powf == __MATH_TIER_FAST
+#define powf __fast_powf
+#endif
+
+#ifndef __MATH_TIER_sinf
+#define __MATH_TIER_sinf __MATH_TIER
+#endif
+#if __MATH_TIER_sinf == __MATH_TIER_FAST
+#define sinf __fast_sinf
+#endif
+
+#ifndef __MATH_TIER_cosf
+#define __MATH_TIER_cosf __MATH_TIER
+#endif
+#if __MATH_TIER_cosf == __MATH_TIER_FAST
+#define cosf __fast_cosf
+#endif
+
+#endif /* _SYS__MATHTIER_H_ */
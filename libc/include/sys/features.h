@@ -468,6 +468,11 @@ extern "C" {
 
 #endif
 
+/* The m65832 syscalls provide a monotonic clock */
+#ifdef __m65832__
+#define _POSIX_MONOTONIC_CLOCK 200112L
+#endif
+
 /* XMK loosely adheres to POSIX -- 1003.1 */
 #ifdef __XMK__
 #define _POSIX_THREADS                    1
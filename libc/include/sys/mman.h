@@ -0,0 +1,36 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#ifndef _SYS_MMAN_H
+#define _SYS_MMAN_H
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+/*
+ * Per POSIX, limited to mapping files. Only available on targets
+ * whose system layer provides mmap.
+ */
+
+#define PROT_NONE  0x0
+#define PROT_READ  0x1
+#define PROT_WRITE 0x2
+#define PROT_EXEC  0x4
+
+#define MAP_SHARED  0x01
+#define MAP_PRIVATE 0x02
+#define MAP_FIXED   0x10
+
+#define MAP_FAILED ((void *)-1)
+
+void *mmap(void *, size_t, int, int, int, off_t);
+int   munmap(void *, size_t);
+
+_END_STD_C
+
+#endif /* _SYS_MMAN_H */
@@ -39,7 +39,11 @@
 
 /* Runtime invariant values */
 #define ARG_MAX    65536 /* max bytes for an exec function */
-#define ATEXIT_MAX 32    /* max atexit functions */
+#ifdef __ATEXIT_MAX
+#define ATEXIT_MAX __ATEXIT_MAX /* max atexit functions */
+#else
+#define ATEXIT_MAX 32 /* max atexit functions */
+#endif
 #define CHILD_MAX  40    /* max simultaneous processes */
 #define IOV_MAX    1024  /* max elements in i/o vector */
 #define OPEN_MAX   64    /* max open files per process */
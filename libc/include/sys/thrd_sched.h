@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Scheduler interface under <threads.h>
+ *
+ * The mtx_, cnd_, call_once and tss_ functions are built on these, so
+ * a port or RTOS only has to provide threads, a way to block on a word
+ * of memory and a way to wake the threads blocked there. The defaults
+ * in libc/misc/thrd_sched.c run a single thread: thrd_create fails,
+ * and waiting for a word that nothing else can change either times
+ * out or fails. A machine directory replaces them with its own
+ * thrd_sched.c.
+ */
+
+#ifndef _SYS_THRD_SCHED_H_
+#define _SYS_THRD_SCHED_H_
+
+#include <threads.h>
+
+_BEGIN_STD_C
+
+/*
+ * Start a thread running func(arg). When func returns, the thread
+ * calls thrd_exit with its result.
+ */
+int __thrd_sched_create(thrd_t *__thr, thrd_start_t __func, void *__arg);
+
+thrd_t __thrd_sched_current(void);
+int    __thrd_sched_detach(thrd_t __thr);
+int    __thrd_sched_join(thrd_t __thr, int *__res);
+
+/* Ends the calling thread; thrd_exit has run its tss destructors */
+__noreturn void __thrd_sched_exit(int __res);
+
+void __thrd_sched_yield(void);
+
+/* As thrd_sleep: 0, -1 when interrupted or another negative value on error */
+int __thrd_sched_sleep(const struct timespec *__duration, struct timespec *__remaining);
+
+/*
+ * Block while *addr == val, checking and blocking as one step with
+ * respect to __thrd_sched_wake. Returns thrd_success when woken or
+ * when *addr differs (spurious returns are allowed), thrd_timedout
+ * once the TIME_UTC time abstime has passed, or thrd_error when
+ * nothing could ever wake the caller. abstime NULL waits forever.
+ */
+int __thrd_sched_wait(volatile int *__addr, int __val, const struct timespec *__abstime);
+
+/* Wake up to count threads blocked on addr */
+void __thrd_sched_wake(volatile int *__addr, int __count);
+
+/* Runs the calling thread's tss destructors; thrd_exit calls it */
+void __tss_run_dtors(void);
+
+_END_STD_C
+
+#endif /* _SYS_THRD_SCHED_H_ */
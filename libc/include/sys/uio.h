@@ -0,0 +1,29 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#ifndef _SYS_UIO_H
+#define _SYS_UIO_H
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+/*
+ * Per POSIX
+ */
+
+struct iovec {
+    void  *iov_base;
+    size_t iov_len;
+};
+
+ssize_t readv(int, const struct iovec *, int);
+ssize_t writev(int, const struct iovec *, int);
+
+_END_STD_C
+
+#endif /* _SYS_UIO_H */
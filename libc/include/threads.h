@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _THREADS_H_
+#define _THREADS_H_
+
+#include <sys/cdefs.h>
+#include <time.h>
+
+_BEGIN_STD_C
+
+#if !defined(__cplusplus) && (!defined(__STDC_VERSION__) || __STDC_VERSION__ < 202311L)
+#define thread_local _Thread_local
+#endif
+
+#define ONCE_FLAG_INIT      { 0 }
+#define TSS_DTOR_ITERATIONS 4
+
+/* Number of tss_t keys that can exist at once */
+#define __TSS_KEYS_MAX 8
+
+enum {
+    thrd_success = 0,
+    thrd_busy = 1,
+    thrd_error = 2,
+    thrd_nomem = 3,
+    thrd_timedout = 4,
+};
+
+enum {
+    mtx_plain = 0,
+    mtx_recursive = 1,
+    mtx_timed = 2,
+};
+
+typedef struct __thrd *thrd_t;
+typedef int (*thrd_start_t)(void *);
+
+/*
+ * __lock is 0 when unlocked, 1 when locked and 2 when locked with
+ * threads possibly waiting. __owner and __count are used by recursive
+ * mutexes only.
+ */
+typedef struct {
+    volatile int __lock;
+    int          __type;
+    thrd_t       __owner;
+    int          __count;
+} mtx_t;
+
+/* __seq changes with every signal and broadcast */
+typedef struct {
+    volatile int __seq;
+} cnd_t;
+
+/* 0 before the call, 1 while it runs, 2 once it has returned */
+typedef struct {
+    volatile int __state;
+} once_flag;
+
+typedef unsigned tss_t;
+typedef void (*tss_dtor_t)(void *);
+
+void call_once(once_flag *__flag, void (*__func)(void));
+
+int  cnd_broadcast(cnd_t *__cond);
+void cnd_destroy(cnd_t *__cond);
+int  cnd_init(cnd_t *__cond);
+int  cnd_signal(cnd_t *__cond);
+int  cnd_timedwait(cnd_t *__restrict __cond, mtx_t *__restrict __mtx,
+                   const struct timespec *__restrict __ts);
+int  cnd_wait(cnd_t *__cond, mtx_t *__mtx);
+
+void mtx_destroy(mtx_t *__mtx);
+int  mtx_init(mtx_t *__mtx, int __type);
+int  mtx_lock(mtx_t *__mtx);
+int  mtx_timedlock(mtx_t *__restrict __mtx, const struct timespec *__restrict __ts);
+int  mtx_trylock(mtx_t *__mtx);
+int  mtx_unlock(mtx_t *__mtx);
+
+int             thrd_create(thrd_t *__thr, thrd_start_t __func, void *__arg);
+thrd_t          thrd_current(void);
+int             thrd_detach(thrd_t __thr);
+int             thrd_equal(thrd_t __thr0, thrd_t __thr1);
+__noreturn void thrd_exit(int __res);
+int             thrd_join(thrd_t __thr, int *__res);
+int             thrd_sleep(const struct timespec *__duration, struct timespec *__remaining);
+void            thrd_yield(void);
+
+int   tss_create(tss_t *__key, tss_dtor_t __dtor);
+void  tss_delete(tss_t __key);
+void *tss_get(tss_t __key);
+int   tss_set(tss_t __key, void *__val);
+
+_END_STD_C
+
+#endif /* _THREADS_H_ */
@@ -256,6 +256,32 @@ size_t strftime_l(char * __restrict _s, size_t              _maxsize, const char
                   const struct tm * __restrict _t, locale_t _l);
 #endif
 
+#if __MISC_VISIBLE
+/* A strftime format compiled by strftime_compile */
+#define STRFTIME_FORMAT_OPS 32
+
+struct strftime_format {
+    const char *__fmt;
+    unsigned    __nops;
+    struct {
+        unsigned char  __op;
+        unsigned char  __arg;
+        unsigned short __off;
+    } __ops[STRFTIME_FORMAT_OPS];
+};
+
+int    strftime_compile(struct strftime_format * __restrict _cf, const char * __restrict _fmt);
+size_t strftime_compiled(char * __restrict _s, size_t _maxsize,
+                         const struct strftime_format * __restrict _cf,
+                         const struct tm * __restrict _t);
+size_t strftime_iso8601(char * __restrict _s, size_t _maxsize, const struct tm * __restrict _t);
+size_t strftime_rfc3339(char * __restrict _s, size_t _maxsize, const struct tm * __restrict _t,
+                        long _utcoff);
+char  *strptime_iso8601(const char * __restrict _buf, struct tm * __restrict _t);
+char  *strptime_rfc3339(const char * __restrict _buf, struct tm * __restrict _t, long *_utcoff,
+                        struct timespec *_ts);
+#endif
+
 #if __XSI_VISIBLE
 char *strptime(const char * __restrict, const char * __restrict, struct tm * __restrict);
 #endif
@@ -74,6 +74,18 @@ size_t mbrtoc32(char32_t * __restrict pc32, const char * __restrict s, size_t n,
 
 size_t c32rtomb(char * __restrict s, char32_t c32, _mbstate_t * __restrict ps);
 
+#if __MISC_VISIBLE
+/* Whole-string conversions between the Unicode forms, any locale */
+int utf8_to_utf16(const char8_t ** __restrict src, size_t * __restrict srclen,
+                  char16_t ** __restrict dst, size_t * __restrict dstlen);
+
+int utf16_to_utf8(const char16_t ** __restrict src, size_t * __restrict srclen,
+                  char8_t ** __restrict dst, size_t * __restrict dstlen);
+
+int utf8_to_utf32(const char8_t ** __restrict src, size_t * __restrict srclen,
+                  char32_t ** __restrict dst, size_t * __restrict dstlen);
+#endif
+
 _END_STD_C
 
 #endif /* _UCHAR_H_ */
@@ -0,0 +1,33 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Batch versions of common float math functions
+ *
+ * Each function computes out[i] = f(in[i]) for i < n, giving the same
+ * results as the scalar function. Special arguments (large, infinite,
+ * NaN, zero or negative for log) are handed to the scalar function, so
+ * errno and exceptions behave as in a loop calling it; everything else
+ * runs the polynomial kernel inline without those checks. The input and
+ * output arrays may be the same but must not otherwise overlap.
+ */
+
+#ifndef _VECMATH_H_
+#define _VECMATH_H_
+
+#include <sys/cdefs.h>
+#include <stddef.h>
+
+_BEGIN_STD_C
+
+void vsinf(float *out, const float *in, size_t n);
+void vcosf(float *out, const float *in, size_t n);
+void vsincosf(float *sinout, float *cosout, const float *in, size_t n);
+void vexpf(float *out, const float *in, size_t n);
+void vlogf(float *out, const float *in, size_t n);
+void vsqrtf(float *out, const float *in, size_t n);
+
+_END_STD_C
+
+#endif /* _VECMATH_H_ */
@@ -184,6 +184,13 @@ __find_charset(const char *charset)
 #define LOCALE_DEFAULT locale_C
 #endif
 
+/*
+ * Last locale found. Programs switching locales tend to pass the same
+ * canonical names over and over, which then match with one strcmp
+ * instead of a search through the charset names.
+ */
+static enum locale_id __find_locale_last = locale_C;
+
 /*
  * Map a locale name to one of our internal locale ids.
  * Returns locale_INVALID for an invalid charset
@@ -192,6 +199,7 @@ enum locale_id
 __find_locale(const char *name)
 {
     enum locale_id id = LOCALE_DEFAULT;
+    enum locale_id last = __find_locale_last;
     const char    *lang_end;
 
     if (!name)
@@ -200,6 +208,9 @@ __find_locale(const char *name)
     if (!*name)
         return _DEFAULT_LOCALE;
 
+    if (!strcmp(name, __locale_name(last)))
+        return last;
+
     /* POSIX is an alias for C */
     if (!strcmp(name, "POSIX"))
         name = __locale_name(locale_C);
@@ -213,5 +224,8 @@ __find_locale(const char *name)
     if (*lang_end)
         id = __find_charset(lang_end + 1);
 
+    if (id != locale_INVALID)
+        __find_locale_last = id;
+
     return id;
 }
@@ -280,6 +280,24 @@ __locale_is_C(locale_t locale)
 #endif
 }
 
+/*
+ * True when tolower and toupper in locale only change the ASCII
+ * letters. The C and Unicode locales share the ctype table which has
+ * no case above 0x7f; the extended charsets each have their own.
+ */
+static inline bool
+__locale_ascii_case(locale_t locale)
+{
+#ifdef __MB_EXTENDED_CHARSETS_NON_UNICODE
+    if (!locale)
+        locale = __get_current_locale();
+    return locale < locale_EXTENDED_BASE;
+#else
+    (void)locale;
+    return true;
+#endif
+}
+
 static inline size_t
 __locale_mb_cur_max_l(locale_t locale)
 {
@@ -42,3 +42,8 @@ locale_t __global_locale = locale_C;
 #ifdef __HAVE_POSIX_LOCALE_API
 __THREAD_LOCAL locale_t _locale;
 #endif
+
+#ifdef __MB_EXTENDED_CHARSETS_NON_UNICODE
+const char                *__ctype_ptr_global = _ctype_;
+__THREAD_LOCAL const char *__ctype_ptr_thread;
+#endif
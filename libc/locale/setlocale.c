@@ -61,6 +61,9 @@ setlocale(int category, const char *name)
     case LC_ALL:
     case LC_CTYPE:
         __global_locale = locale;
+#ifdef __MB_EXTENDED_CHARSETS_NON_UNICODE
+        __ctype_ptr_global = __get_ctype(locale);
+#endif
         break;
     default:
         break;
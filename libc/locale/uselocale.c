@@ -51,6 +51,9 @@ uselocale(locale_t locale)
         locale = 0;
 
     _locale = locale;
+#ifdef __MB_EXTENDED_CHARSETS_NON_UNICODE
+    __ctype_ptr_thread = locale ? __get_ctype(locale) : NULL;
+#endif
 
     return current;
 }
@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Sized __atomic library calls for M65832
+ *
+ * The compiler has no atomic instructions to expand <stdatomic.h> and
+ * the __atomic builtins into on this core, so it calls these instead.
+ * Each one runs with interrupts masked, which makes it atomic with
+ * respect to interrupt handlers and whatever they schedule. The memory
+ * order argument is ignored: the single core never reorders its own
+ * accesses and the critical section is a compiler barrier.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "m65832_irq.h"
+
+#ifdef __GNUCLIKE_PRAGMA_DIAGNOSTIC
+#pragma GCC diagnostic ignored "-Wpragmas"
+#pragma GCC diagnostic ignored "-Wunknown-warning-option"
+/* The compiler declares these itself */
+#pragma GCC diagnostic ignored "-Wbuiltin-declaration-mismatch"
+#pragma GCC diagnostic ignored "-Wmissing-prototypes"
+#pragma GCC diagnostic ignored "-Wmissing-declarations"
+#endif
+
+#define ATOMIC_LOAD_STORE(n, type)                                              \
+    type __atomic_load_##n(const volatile void *ptr, int order)                 \
+    {                                                                           \
+        unsigned state = __m65832_critical_enter();                             \
+        type     ret = *(const volatile type *)ptr;                             \
+        (void)order;                                                            \
+        __m65832_critical_exit(state);                                          \
+        return ret;                                                             \
+    }                                                                           \
+                                                                                \
+    void __atomic_store_##n(volatile void *ptr, type val, int order)            \
+    {                                                                           \
+        unsigned state = __m65832_critical_enter();                             \
+        (void)order;                                                            \
+        *(volatile type *)ptr = val;                                            \
+        __m65832_critical_exit(state);                                          \
+    }                                                                           \
+                                                                                \
+    type __atomic_exchange_##n(volatile void *ptr, type val, int order)         \
+    {                                                                           \
+        unsigned state = __m65832_critical_enter();                             \
+        type     ret = *(volatile type *)ptr;                                   \
+        (void)order;                                                            \
+        *(volatile type *)ptr = val;                                            \
+        __m65832_critical_exit(state);                                          \
+        return ret;                                                             \
+    }                                                                           \
+                                                                                \
+    bool __atomic_compare_exchange_##n(volatile void *ptr, void *expected,      \
+                                       type desired, bool weak, int success,    \
+                                       int failure)                             \
+    {                                                                           \
+        unsigned state = __m65832_critical_enter();                             \
+        type     cur = *(volatile type *)ptr;                                   \
+        bool     ret = cur == *(type *)expected;                                \
+        (void)weak;                                                             \
+        (void)success;                                                          \
+        (void)failure;                                                          \
+        if (ret)                                                                \
+            *(volatile type *)ptr = desired;                                    \
+        __m65832_critical_exit(state);                                          \
+        if (!ret)                                                               \
+            *(type *)expected = cur;                                            \
+        return ret;                                                             \
+    }
+
+#define ATOMIC_FETCH_OP(n, type, name, op)                                      \
+    type __atomic_fetch_##name##_##n(volatile void *ptr, type val, int order)   \
+    {                                                                           \
+        unsigned state = __m65832_critical_enter();                             \
+        type     ret = *(volatile type *)ptr;                                   \
+        (void)order;                                                            \
+        *(volatile type *)ptr = ret op val;                                     \
+        __m65832_critical_exit(state);                                          \
+        return ret;                                                             \
+    }
+
+#define ATOMIC_SIZE(n, type)                                                    \
+    ATOMIC_LOAD_STORE(n, type)                                                  \
+    ATOMIC_FETCH_OP(n, type, add, +)                                            \
+    ATOMIC_FETCH_OP(n, type, sub, -)                                            \
+    ATOMIC_FETCH_OP(n, type, and, &)                                            \
+    ATOMIC_FETCH_OP(n, type, or, |)                                             \
+    ATOMIC_FETCH_OP(n, type, xor, ^)
+
+ATOMIC_SIZE(1, uint8_t)
+ATOMIC_SIZE(2, uint16_t)
+ATOMIC_SIZE(4, uint32_t)
+ATOMIC_SIZE(8, uint64_t)
+
+/* Every size above is lock-free as far as interrupt handlers can tell */
+bool
+__atomic_is_lock_free(size_t size, const volatile void *ptr)
+{
+    (void)ptr;
+    return size == 1 || size == 2 || size == 4 || size == 8;
+}
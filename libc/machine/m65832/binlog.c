@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Binary log writer, see <machine/binlog.h>. Recording a line walks
+ * the format once and copies each argument straight into the ring;
+ * the record only becomes visible to the reader when head moves past
+ * it, so a record dropped half way leaves nothing behind.
+ */
+
+#include "m65832_binlog.h"
+#include <errno.h>
+
+int
+__m65832_binlog_init(struct m65832_binlog *log, uintptr_t *buf, unsigned words)
+{
+    if (words < 4 || (words & (words - 1)) != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    log->buf = buf;
+    log->mask = words - 1;
+    log->head = 0;
+    log->tail = 0;
+    log->dropped = 0;
+    return 0;
+}
+
+#define PUT(w)                                \
+    do {                                      \
+        if (n >= room)                        \
+            goto full;                        \
+        buf[(head + n++) & mask] = (w);       \
+    } while (0)
+
+#define PUTV(type)                                    \
+    do {                                              \
+        type      v_ = va_arg(ap, type);              \
+        uintptr_t w_[BINLOG_WORDS(type)] = { 0 };     \
+        unsigned  i_;                                 \
+        memcpy(w_, &v_, sizeof(v_));                  \
+        for (i_ = 0; i_ < BINLOG_WORDS(type); i_++)   \
+            PUT(w_[i_]);                              \
+    } while (0)
+
+int
+__m65832_vbinlog(struct m65832_binlog *log, const char *fmt, va_list ap)
+{
+    struct binlog_conv conv;
+    uintptr_t         *buf = log->buf;
+    unsigned           mask = log->mask;
+    unsigned           head = log->head;
+    unsigned           room = mask + 1 - (head - __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE));
+    unsigned           n = 2, s;
+    const char        *f = fmt;
+
+    while ((f = binlog_next(f, &conv)) != NULL) {
+        for (s = 0; s < conv.stars; s++)
+            PUTV(int);
+        switch (conv.cls) {
+        case BINLOG_NONE:
+            break;
+        case BINLOG_INT:
+            PUTV(unsigned int);
+            break;
+        case BINLOG_LONG:
+            PUTV(unsigned long);
+            break;
+        case BINLOG_LLONG:
+            PUTV(unsigned long long);
+            break;
+        case BINLOG_INTMAX:
+            PUTV(uintmax_t);
+            break;
+        case BINLOG_SIZE:
+            PUTV(size_t);
+            break;
+        case BINLOG_PTRDIFF:
+            PUTV(ptrdiff_t);
+            break;
+        case BINLOG_PTR:
+            PUTV(void *);
+            break;
+        case BINLOG_DOUBLE:
+            PUTV(double);
+            break;
+        default:
+            errno = EINVAL;
+            return -1;
+        }
+    }
+    if (n > room)
+        goto full;
+    buf[head & mask] = (uintptr_t)fmt;
+    buf[(head + 1) & mask] = n - 2;
+    __atomic_store_n(&log->head, head + n, __ATOMIC_RELEASE);
+    return 0;
+
+full:
+    log->dropped++;
+    errno = ENOSPC;
+    return -1;
+}
+
+int
+__m65832_binlog(struct m65832_binlog *log, const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = __m65832_vbinlog(log, fmt, ap);
+    va_end(ap);
+    return ret;
+}
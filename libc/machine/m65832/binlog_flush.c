@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Binary log reader, see <machine/binlog.h>. Each record is printed
+ * one conversion at a time: the literal text between conversions is
+ * written as is and every conversion specification goes to fprintf
+ * with its stored argument rebuilt at the original type.
+ */
+
+#include "m65832_binlog.h"
+
+#define SPEC_MAX 32
+
+#define GETV(type, v)                                 \
+    do {                                              \
+        uintptr_t w_[BINLOG_WORDS(type)];             \
+        unsigned  i_;                                 \
+        for (i_ = 0; i_ < BINLOG_WORDS(type); i_++)   \
+            w_[i_] = buf[pos++ & mask];               \
+        memcpy(&(v), w_, sizeof(type));               \
+    } while (0)
+
+#define EMIT(type)                                                              \
+    do {                                                                        \
+        type v;                                                                 \
+        GETV(type, v);                                                          \
+        if (conv.stars == 0)                                                    \
+            fprintf(out, spec, v);                                              \
+        else if (conv.stars == 1)                                               \
+            fprintf(out, spec, star[0], v);                                     \
+        else                                                                    \
+            fprintf(out, spec, star[0], star[1], v);                            \
+    } while (0)
+
+static void
+binlog_print(FILE *out, const char *fmt, const uintptr_t *buf, unsigned mask, unsigned pos)
+{
+    struct binlog_conv conv;
+    const char        *f;
+    char               spec[SPEC_MAX];
+    int                star[2];
+    unsigned           s;
+    size_t             len;
+
+    while ((f = binlog_next(fmt, &conv)) != NULL) {
+        fwrite(fmt, 1, (size_t)(conv.start - fmt), out);
+        if (conv.cls == BINLOG_BAD)
+            return;
+        fmt = f;
+        if (conv.cls == BINLOG_NONE) {
+            putc('%', out);
+            continue;
+        }
+        for (s = 0; s < conv.stars; s++)
+            GETV(int, star[s]);
+        len = (size_t)(conv.end - conv.start);
+        if (len >= SPEC_MAX)
+            len = SPEC_MAX - 1;
+        memcpy(spec, conv.start, len);
+        spec[len] = '\0';
+
+        switch (conv.cls) {
+        case BINLOG_INT:
+            EMIT(unsigned int);
+            break;
+        case BINLOG_LONG:
+            EMIT(unsigned long);
+            break;
+        case BINLOG_LLONG:
+            EMIT(unsigned long long);
+            break;
+        case BINLOG_INTMAX:
+            EMIT(uintmax_t);
+            break;
+        case BINLOG_SIZE:
+            EMIT(size_t);
+            break;
+        case BINLOG_PTRDIFF:
+            EMIT(ptrdiff_t);
+            break;
+        case BINLOG_PTR:
+            EMIT(void *);
+            break;
+        case BINLOG_DOUBLE:
+            EMIT(double);
+            break;
+        }
+    }
+    fputs(fmt, out);
+}
+
+int
+__m65832_binlog_flush(struct m65832_binlog *log, FILE *out)
+{
+    unsigned tail = log->tail;
+    unsigned head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+    unsigned mask = log->mask;
+    int      count = 0;
+
+    while (tail != head) {
+        const char *fmt = (const char *)log->buf[tail & mask];
+
+        binlog_print(out, fmt, log->buf, mask, tail + 2);
+        tail += 2 + (unsigned)log->buf[(tail + 1) & mask];
+        /* Hand the space back to the writer record by record */
+        __atomic_store_n(&log->tail, tail, __ATOMIC_RELEASE);
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,28 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * The BULK TRAP used by memcpy, memmove and memset, see m65832_bulk.h
+ */
+
+#include "m65832_bulk.h"
+
+#if __M65832_BULK_TRAP > 0
+
+bool __m65832_bulk_off;
+
+bool
+__m65832_bulk_trap(long op, uintptr_t dst, uintptr_t arg, size_t len)
+{
+    long r = __syscall3(op, (long)dst, (long)arg, (long)len);
+
+    if (r == 0)
+        return true;
+    /* A racing first call also gets -ENOSYS and stores the same answer */
+    if (r == -ENOSYS)
+        __m65832_bulk_off = true;
+    return false;
+}
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * M65832 has no compare-and-swap, so the generic version is only a
+ * weak non-atomic placeholder. Mask interrupts around it instead.
+ */
+
+#include "../../stdio/stdio_private.h"
+#include "m65832_irq.h"
+
+#if defined(__ATOMIC_UNGETC) && !defined(PICOLIBC_HAVE_SYNC_COMPARE_AND_SWAP)
+
+bool
+__atomic_compare_exchange_ungetc(__ungetc_t *p, __ungetc_t d, __ungetc_t v)
+{
+    unsigned state;
+    bool     ret;
+
+    /* An aligned word load is atomic; skip masking when it must fail */
+    if (*(volatile __ungetc_t *)p != d)
+        return false;
+    state = __m65832_critical_enter();
+    ret = __non_atomic_compare_exchange_ungetc(p, d, v);
+
+    __m65832_critical_exit(state);
+    return ret;
+}
+
+#endif
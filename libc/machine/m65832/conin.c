@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Console input ring, see <machine/conin.h>
+ *
+ * head and tail count bytes ever put and taken; the writer only moves
+ * head and the reader only moves tail, each publishing with a release
+ * store after touching the bytes.
+ */
+
+#include <machine/conin.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CONIN_MASK (M65832_CONIN_SIZE - 1)
+
+extern ssize_t _read(int fd, void *buf, size_t len);
+
+static unsigned char  conin_buf[M65832_CONIN_SIZE];
+static unsigned       conin_head, conin_tail;
+static unsigned long  conin_drops;
+static volatile int   conin_irq;
+
+int
+__m65832_conin_put(unsigned char c)
+{
+    unsigned head = conin_head;
+
+    if (head - __atomic_load_n(&conin_tail, __ATOMIC_ACQUIRE) == M65832_CONIN_SIZE) {
+        conin_drops++;
+        return -1;
+    }
+    conin_buf[head & CONIN_MASK] = c;
+    __atomic_store_n(&conin_head, head + 1, __ATOMIC_RELEASE);
+    return c;
+}
+
+size_t
+__m65832_conin_put_span(const void *buf, size_t len)
+{
+    const unsigned char *s = buf;
+    unsigned             head = conin_head;
+    size_t               room = M65832_CONIN_SIZE - (head - __atomic_load_n(&conin_tail, __ATOMIC_ACQUIRE));
+    size_t               n, done;
+
+    if (len > room) {
+        conin_drops += len - room;
+        len = room;
+    }
+    for (done = 0; done < len; done += n) {
+        n = M65832_CONIN_SIZE - ((head + done) & CONIN_MASK);
+        if (n > len - done)
+            n = len - done;
+        memcpy(&conin_buf[(head + done) & CONIN_MASK], s + done, n);
+    }
+    __atomic_store_n(&conin_head, head + len, __ATOMIC_RELEASE);
+    return len;
+}
+
+void
+__m65832_conin_irq(int on)
+{
+    conin_irq = on;
+}
+
+size_t
+__m65832_conin_ready(void)
+{
+    return __atomic_load_n(&conin_head, __ATOMIC_ACQUIRE) - conin_tail;
+}
+
+unsigned long
+__m65832_conin_dropped(void)
+{
+    return conin_drops;
+}
+
+__attribute__((weak)) void
+__m65832_conin_idle(void)
+{
+}
+
+/* Copy out up to len buffered bytes */
+static size_t
+conin_take(unsigned char *buf, size_t len)
+{
+    unsigned tail = conin_tail;
+    size_t   avail = __atomic_load_n(&conin_head, __ATOMIC_ACQUIRE) - tail;
+    size_t   n, done;
+
+    if (len > avail)
+        len = avail;
+    for (done = 0; done < len; done += n) {
+        n = M65832_CONIN_SIZE - ((tail + done) & CONIN_MASK);
+        if (n > len - done)
+            n = len - done;
+        memcpy(buf + done, &conin_buf[(tail + done) & CONIN_MASK], n);
+    }
+    __atomic_store_n(&conin_tail, tail + len, __ATOMIC_RELEASE);
+    return len;
+}
+
+ssize_t
+__m65832_conin_read(void *buf, size_t len)
+{
+    size_t  n;
+    ssize_t r;
+
+    if (!len)
+        return 0;
+    n = conin_take(buf, len);
+    if (n)
+        return (ssize_t)n;
+
+    if (conin_irq) {
+        while (!__m65832_conin_ready())
+            __m65832_conin_idle();
+        return (ssize_t)conin_take(buf, len);
+    }
+
+    /* Large reads need no staging */
+    if (len >= M65832_CONIN_SIZE)
+        return _read(0, buf, len);
+
+    /* Refill the ring with whatever is waiting, up to its end */
+    r = _read(0, &conin_buf[conin_head & CONIN_MASK],
+              M65832_CONIN_SIZE - (conin_head & CONIN_MASK));
+    if (r <= 0)
+        return r;
+    __atomic_store_n(&conin_head, conin_head + (unsigned)r, __ATOMIC_RELEASE);
+    return (ssize_t)conin_take(buf, len);
+}
@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Console output ring, see <machine/conout.h>
+ *
+ * head and tail count bytes ever written and transmitted. Writers
+ * move head inside a critical section, one chunk at a time so that a
+ * blocked writer does not keep interrupts off; the transmitter moves
+ * tail with a release store once it is done with the bytes.
+ */
+
+#include <machine/conout.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "m65832_irq.h"
+
+#define CONOUT_MASK (M65832_CONOUT_SIZE - 1)
+
+extern ssize_t _write(int fd, const void *buf, size_t len);
+extern ssize_t _writev(int fd, const struct iovec *iov, int iovcnt);
+
+static unsigned char conout_buf[M65832_CONOUT_SIZE];
+static unsigned      conout_head, conout_tail;
+static unsigned long conout_drops;
+static volatile int  conout_mode;
+
+__attribute__((weak)) void
+__m65832_conout_kick(void)
+{
+}
+
+__attribute__((weak)) void
+__m65832_conout_idle(void)
+{
+}
+
+size_t
+__m65832_conout_pending(void)
+{
+    return conout_head - __atomic_load_n(&conout_tail, __ATOMIC_ACQUIRE);
+}
+
+unsigned long
+__m65832_conout_dropped(void)
+{
+    return conout_drops;
+}
+
+void
+__m65832_conout_sync(void)
+{
+    while (__m65832_conout_pending())
+        __m65832_conout_idle();
+}
+
+void
+__m65832_conout_mode(int mode)
+{
+    if (mode == M65832_CONOUT_OFF)
+        __m65832_conout_sync();
+    conout_mode = mode;
+}
+
+/* Copy as much of buf as fits; returns the bytes taken */
+static size_t
+conout_put(const unsigned char *buf, size_t len)
+{
+    unsigned state = __m65832_critical_enter();
+    unsigned head = conout_head;
+    size_t   room = M65832_CONOUT_SIZE - (head - __atomic_load_n(&conout_tail, __ATOMIC_ACQUIRE));
+    size_t   n, done;
+
+    if (len > room)
+        len = room;
+    for (done = 0; done < len; done += n) {
+        n = M65832_CONOUT_SIZE - ((head + done) & CONOUT_MASK);
+        if (n > len - done)
+            n = len - done;
+        memcpy(&conout_buf[(head + done) & CONOUT_MASK], buf + done, n);
+    }
+    __atomic_store_n(&conout_head, head + len, __ATOMIC_RELEASE);
+    __m65832_critical_exit(state);
+    return len;
+}
+
+ssize_t
+__m65832_conout_write(int fd, const void *buf, size_t len)
+{
+    const unsigned char *s = buf;
+    size_t               done = 0, n;
+    int                  mode = conout_mode;
+
+    if (mode == M65832_CONOUT_OFF || (fd != 1 && fd != 2))
+        return _write(fd, buf, len);
+
+    while (done < len) {
+        n = conout_put(s + done, len - done);
+        if (n)
+            __m65832_conout_kick();
+        done += n;
+        if (done == len)
+            break;
+        if (mode == M65832_CONOUT_DROP) {
+            conout_drops += len - done;
+            break;
+        }
+        __m65832_conout_idle();
+    }
+    return (ssize_t)len;
+}
+
+ssize_t
+__m65832_conout_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+    ssize_t total = 0;
+    int     i;
+
+    if (conout_mode == M65832_CONOUT_OFF || (fd != 1 && fd != 2))
+        return _writev(fd, iov, iovcnt);
+    for (i = 0; i < iovcnt; i++)
+        total += __m65832_conout_write(fd, iov[i].iov_base, iov[i].iov_len);
+    return total;
+}
+
+size_t
+__m65832_conout_span(const void **span)
+{
+    unsigned tail = conout_tail;
+    size_t   n = __atomic_load_n(&conout_head, __ATOMIC_ACQUIRE) - tail;
+
+    if (n > M65832_CONOUT_SIZE - (tail & CONOUT_MASK))
+        n = M65832_CONOUT_SIZE - (tail & CONOUT_MASK);
+    *span = &conout_buf[tail & CONOUT_MASK];
+    return n;
+}
+
+void
+__m65832_conout_done(size_t len)
+{
+    __atomic_store_n(&conout_tail, conout_tail + (unsigned)len, __ATOMIC_RELEASE);
+}
+
+size_t
+__m65832_conout_get(void *buf, size_t max)
+{
+    unsigned char *d = buf;
+    const void    *span;
+    size_t         done = 0, n;
+
+    /* At most two spans, either side of the end of the ring */
+    while (done < max && (n = __m65832_conout_span(&span)) != 0) {
+        if (n > max - done)
+            n = max - done;
+        memcpy(d + done, span, n);
+        __m65832_conout_done(n);
+        done += n;
+    }
+    return done;
+}
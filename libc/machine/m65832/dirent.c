@@ -0,0 +1,199 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Directory streams for M65832
+ *
+ * Each DIR holds a DIR_BUFSIZ buffer which the GETDENTS_PLUS TRAP
+ * fills with as many entries as fit, a few dozen for typical names,
+ * and readdir hands them out one at a time. The records carry the
+ * file type and size along with the name, see m65832_syscall.h.
+ */
+
+#define _DEFAULT_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "m65832_syscall.h"
+
+#define DIR_BUFSIZ 1024
+
+struct _m65832_dir {
+    int           fd;
+    int           loc;  /* offset of the next record in buf */
+    int           len;  /* bytes in buf */
+    long          pos;  /* entries returned since the last rewind */
+    struct dirent ent;
+    char          buf[DIR_BUFSIZ] __aligned(4);
+};
+
+static DIR *
+__dir_alloc(int fd)
+{
+    DIR *dir = malloc(sizeof(*dir));
+
+    if (!dir)
+        return NULL;
+    dir->fd = fd;
+    dir->loc = 0;
+    dir->len = 0;
+    dir->pos = 0;
+    return dir;
+}
+
+DIR *
+opendir(const char *path)
+{
+    int  fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    DIR *dir;
+
+    if (fd < 0)
+        return NULL;
+    dir = __dir_alloc(fd);
+    if (!dir) {
+        close(fd);
+        errno = ENOMEM;
+    }
+    return dir;
+}
+
+DIR *
+fdopendir(int fd)
+{
+    struct stat st;
+
+    if (fstat(fd, &st) < 0)
+        return NULL;
+    if (!S_ISDIR(st.st_mode)) {
+        errno = ENOTDIR;
+        return NULL;
+    }
+    return __dir_alloc(fd);
+}
+
+/* The next record, refilling the buffer when it runs out */
+static const struct m65832_dirent *
+__dir_next(DIR *dir)
+{
+    const struct m65832_dirent *rec;
+    long                        r;
+
+    if (dir->loc >= dir->len) {
+        r = __syscall3(M65832_SYS_GETDENTS_PLUS, dir->fd, (long)dir->buf, DIR_BUFSIZ);
+        if (r <= 0) {
+            if (r < 0)
+                errno = (int)-r;
+            return NULL;
+        }
+        dir->loc = 0;
+        dir->len = (int)r;
+    }
+    rec = (const struct m65832_dirent *)(dir->buf + dir->loc);
+    if (rec->d_reclen <= offsetof(struct m65832_dirent, d_name) || (rec->d_reclen & 3) != 0
+        || rec->d_reclen > dir->len - dir->loc) {
+        dir->loc = dir->len;
+        errno = EIO;
+        return NULL;
+    }
+    dir->loc += rec->d_reclen;
+    dir->pos++;
+    return rec;
+}
+
+static void
+__dir_fill(struct dirent *ent, const struct m65832_dirent *rec)
+{
+    size_t max = rec->d_reclen - offsetof(struct m65832_dirent, d_name);
+    size_t len = strnlen(rec->d_name, max < MAXNAMLEN ? max : MAXNAMLEN);
+
+    ent->d_ino = (ino_t)rec->d_ino;
+    ent->d_size = (off_t)rec->d_size;
+    ent->d_reclen = sizeof(*ent);
+    ent->d_type = rec->d_type;
+    memcpy(ent->d_name, rec->d_name, len);
+    ent->d_name[len] = '\0';
+}
+
+struct dirent *
+readdir(DIR *dir)
+{
+    const struct m65832_dirent *rec = __dir_next(dir);
+
+    if (!rec)
+        return NULL;
+    __dir_fill(&dir->ent, rec);
+    return &dir->ent;
+}
+
+int
+readdir_r(DIR * __restrict dir, struct dirent * __restrict entry, struct dirent ** __restrict result)
+{
+    const struct m65832_dirent *rec;
+    int                         save = errno;
+
+    errno = 0;
+    rec = __dir_next(dir);
+    if (!rec) {
+        *result = NULL;
+        if (errno)
+            return errno;
+        errno = save;
+        return 0;
+    }
+    errno = save;
+    __dir_fill(entry, rec);
+    *result = entry;
+    return 0;
+}
+
+void
+rewinddir(DIR *dir)
+{
+    lseek(dir->fd, 0, SEEK_SET);
+    dir->loc = 0;
+    dir->len = 0;
+    dir->pos = 0;
+}
+
+/* Positions count entries from the start of the directory */
+long
+telldir(DIR *dir)
+{
+    return dir->pos;
+}
+
+void
+seekdir(DIR *dir, long loc)
+{
+    if (loc < dir->pos)
+        rewinddir(dir);
+    while (dir->pos < loc && __dir_next(dir))
+        ;
+}
+
+int
+dirfd(DIR *dir)
+{
+    return dir->fd;
+}
+
+int
+fdclosedir(DIR *dir)
+{
+    int fd = dir->fd;
+
+    free(dir);
+    return fd;
+}
+
+int
+closedir(DIR *dir)
+{
+    return close(fdclosedir(dir));
+}
@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Event sets over poll, see <machine/event.h> */
+
+#include <machine/event.h>
+#include <errno.h>
+#include <stddef.h>
+
+static int
+event_find(struct m65832_event_set *set, int fd)
+{
+    nfds_t i;
+
+    for (i = 0; i < set->count; i++)
+        if (set->fds[i].fd == fd)
+            return (int)i;
+    return -1;
+}
+
+void
+__m65832_event_init(struct m65832_event_set *set)
+{
+    set->count = 0;
+    set->next = 0;
+}
+
+int
+__m65832_event_add(struct m65832_event_set *set, int fd, short events, void *data)
+{
+    nfds_t i = set->count;
+
+    if (fd < 0) {
+        errno = EBADF;
+        return -1;
+    }
+    if (event_find(set, fd) >= 0) {
+        errno = EEXIST;
+        return -1;
+    }
+    if (i == M65832_EVENT_MAX) {
+        errno = ENOSPC;
+        return -1;
+    }
+    set->fds[i].fd = fd;
+    set->fds[i].events = events;
+    set->fds[i].revents = 0;
+    set->data[i] = data;
+    set->count = i + 1;
+    return 0;
+}
+
+int
+__m65832_event_mod(struct m65832_event_set *set, int fd, short events)
+{
+    int i = event_find(set, fd);
+
+    if (i < 0) {
+        errno = ENOENT;
+        return -1;
+    }
+    set->fds[i].events = events;
+    return 0;
+}
+
+int
+__m65832_event_del(struct m65832_event_set *set, int fd)
+{
+    int    i = event_find(set, fd);
+    nfds_t last;
+
+    if (i < 0) {
+        errno = ENOENT;
+        return -1;
+    }
+    /* Order does not matter, move the last entry into the hole */
+    last = --set->count;
+    set->fds[i] = set->fds[last];
+    set->data[i] = set->data[last];
+    if (set->next > last)
+        set->next = 0;
+    return 0;
+}
+
+int
+__m65832_event_wait(struct m65832_event_set *set, struct m65832_event *ev, int max, int timeout)
+{
+    nfds_t i, n;
+    int    ready, got = 0;
+
+    if (max <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    ready = poll(set->fds, set->count, timeout);
+    if (ready <= 0)
+        return ready;
+
+    i = set->next < set->count ? set->next : 0;
+    for (n = 0; n < set->count && got < max; n++) {
+        struct pollfd *p = &set->fds[i];
+
+        if (p->revents) {
+            ev[got].fd = p->fd;
+            ev[got].events = p->revents;
+            ev[got].data = set->data[i];
+            got++;
+        }
+        if (++i == set->count)
+            i = 0;
+    }
+    set->next = i;
+    return got;
+}
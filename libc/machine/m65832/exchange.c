@@ -0,0 +1,30 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Interrupt-safe replacement for the weak non-atomic generic version
+ */
+
+#include "../../stdio/stdio_private.h"
+#include "m65832_irq.h"
+
+#if defined(__ATOMIC_UNGETC) && !defined(PICOLIBC_HAVE_SYNC_COMPARE_AND_SWAP)
+
+__ungetc_t
+__atomic_exchange_ungetc(__ungetc_t *p, __ungetc_t v)
+{
+    unsigned   state;
+    __ungetc_t ret;
+
+    /* Storing the value already there needs no critical section */
+    if (*(volatile __ungetc_t *)p == v)
+        return v;
+    state = __m65832_critical_enter();
+    ret = __non_atomic_exchange_ungetc(p, v);
+
+    __m65832_critical_exit(state);
+    return ret;
+}
+
+#endif
@@ -0,0 +1,274 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * gprof support for M65832
+ *
+ * Code built with -pg calls _mcount at the start of every function,
+ * which records a call graph arc (caller, callee) here. Linking it
+ * pulls in this file, whose constructor starts profiling and registers
+ * _mcleanup to write gmon.out through the open/write syscalls at exit.
+ * Code also built with -finstrument-functions has its entry hook in
+ * trace.c pass each call on to __gmon_arc.
+ *
+ * _mcount finds the caller of the instrumented function with
+ * __builtin_return_address(1), which needs frame pointers; without them
+ * the calls are still counted but charged to <spontaneous>.
+ * __gmon_arc is passed both addresses and needs neither.
+ *
+ * The PC histogram covers __text_start up to __text_end when the linker
+ * script defines both, or whatever monstartup was given. The target has
+ * no profiling timer, so samples are only taken when a timer handler
+ * calls __gmon_sample with the interrupted PC.
+ */
+
+#include <sys/cdefs.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NOPROF __attribute__((no_instrument_function))
+
+/* Call graph arcs kept; further new arcs are dropped */
+#ifndef GMON_ARCS
+#define GMON_ARCS 2048
+#endif
+
+/* Bytes of text per histogram counter */
+#define HISTFRACTION 4
+
+/* Rate at which a timer is expected to call __gmon_sample */
+#ifndef GMON_SAMPLE_RATE
+#define GMON_SAMPLE_RATE 100
+#endif
+
+#define GMON_MAGIC         "gmon"
+#define GMON_VERSION       1
+#define GMON_TAG_TIME_HIST 0
+#define GMON_TAG_CG_ARC    1
+
+enum { GMON_PROF_OFF, GMON_PROF_ON, GMON_PROF_BUSY, GMON_PROF_ERROR };
+
+struct gmon_arc {
+    uintptr_t frompc;
+    uintptr_t selfpc;
+    uint32_t  count;
+};
+
+struct gmon_hdr {
+    char    cookie[4];
+    int32_t version;
+    char    spare[3 * 4];
+};
+
+struct gmon_hist_hdr {
+    uintptr_t low_pc;
+    uintptr_t high_pc;
+    int32_t   hist_size;
+    int32_t   prof_rate;
+    char      dimen[15];
+    char      dimen_abbrev;
+} __attribute__((packed));
+
+struct gmon_arc_rec {
+    unsigned char tag;
+    uintptr_t     frompc;
+    uintptr_t     selfpc;
+    int32_t       count;
+} __attribute__((packed));
+
+/* Arc records written per write call */
+#define GMON_ARC_BATCH 32
+
+extern char              __text_start[] __attribute__((weak));
+extern char              __text_end[] __attribute__((weak));
+
+static volatile int      gmon_state = GMON_PROF_OFF;
+static struct gmon_arc  *gmon_arcs;
+static unsigned          gmon_dropped;
+static unsigned short   *gmon_hist;
+static uintptr_t         gmon_lowpc, gmon_highpc;
+static int32_t           gmon_hist_size;
+
+void monstartup(uintptr_t lowpc, uintptr_t highpc);
+void moncontrol(int mode);
+void _mcleanup(void);
+void __gmon_sample(uintptr_t pc);
+void _mcount(void);
+void __gmon_arc(uintptr_t frompc, uintptr_t selfpc);
+
+static NOPROF void
+gmon_arc(uintptr_t frompc, uintptr_t selfpc)
+{
+    struct gmon_arc *arc;
+    unsigned         i, n;
+
+    if (gmon_state != GMON_PROF_ON)
+        return;
+    gmon_state = GMON_PROF_BUSY;
+
+    i = (unsigned)((frompc >> 1) ^ (selfpc * 2654435761u));
+    for (n = 0; n < GMON_ARCS; n++, i++) {
+        arc = &gmon_arcs[i % GMON_ARCS];
+        if (arc->selfpc == selfpc && arc->frompc == frompc) {
+            arc->count++;
+            break;
+        }
+        if (!arc->count) {
+            arc->frompc = frompc;
+            arc->selfpc = selfpc;
+            arc->count = 1;
+            break;
+        }
+    }
+    if (n == GMON_ARCS)
+        gmon_dropped++;
+
+    gmon_state = GMON_PROF_ON;
+}
+
+NOPROF void
+_mcount(void)
+{
+    gmon_arc((uintptr_t)__builtin_return_address(1), (uintptr_t)__builtin_return_address(0));
+}
+
+__strong_reference(_mcount, mcount);
+
+/* Arcs from the -finstrument-functions hooks in trace.c */
+NOPROF void
+__gmon_arc(uintptr_t frompc, uintptr_t selfpc)
+{
+    gmon_arc(frompc, selfpc);
+}
+
+NOPROF void
+__gmon_sample(uintptr_t pc)
+{
+    if (gmon_hist && pc >= gmon_lowpc && pc < gmon_highpc) {
+        unsigned short *counter = &gmon_hist[(pc - gmon_lowpc) / HISTFRACTION];
+        if (*counter != 0xffff)
+            (*counter)++;
+    }
+}
+
+NOPROF void
+moncontrol(int mode)
+{
+    if (gmon_state == GMON_PROF_ERROR)
+        return;
+    gmon_state = mode ? GMON_PROF_ON : GMON_PROF_OFF;
+}
+
+NOPROF void
+monstartup(uintptr_t lowpc, uintptr_t highpc)
+{
+    gmon_state = GMON_PROF_BUSY;
+
+    if (!gmon_arcs)
+        gmon_arcs = calloc(GMON_ARCS, sizeof(*gmon_arcs));
+    if (!gmon_arcs) {
+        gmon_state = GMON_PROF_ERROR;
+        return;
+    }
+
+    free(gmon_hist);
+    gmon_hist = NULL;
+    gmon_hist_size = 0;
+    if (highpc > lowpc) {
+        gmon_lowpc = lowpc & ~(uintptr_t)(HISTFRACTION - 1);
+        gmon_highpc = (highpc + HISTFRACTION - 1) & ~(uintptr_t)(HISTFRACTION - 1);
+        gmon_hist_size = (gmon_highpc - gmon_lowpc) / HISTFRACTION;
+        gmon_hist = calloc(gmon_hist_size, sizeof(*gmon_hist));
+        if (!gmon_hist)
+            gmon_hist_size = 0;
+    }
+
+    gmon_state = GMON_PROF_ON;
+}
+
+static NOPROF int
+gmon_write(int fd, const void *buf, size_t len)
+{
+    const char *p = buf;
+
+    while (len) {
+        ssize_t r = write(fd, p, len);
+        if (r <= 0)
+            return -1;
+        p += r;
+        len -= r;
+    }
+    return 0;
+}
+
+NOPROF void
+_mcleanup(void)
+{
+    static const char    dropped_msg[] = "_mcleanup: call graph arcs dropped, raise GMON_ARCS\n";
+    struct gmon_hdr      hdr;
+    struct gmon_hist_hdr hist;
+    struct gmon_arc_rec  recs[GMON_ARC_BATCH];
+    unsigned char        tag;
+    unsigned             i, n;
+    int                  fd;
+    int                  ok;
+
+    if (gmon_state == GMON_PROF_ERROR || !gmon_arcs)
+        return;
+    gmon_state = GMON_PROF_BUSY;
+
+    if (gmon_dropped)
+        (void)write(2, dropped_msg, sizeof(dropped_msg) - 1);
+
+    fd = open("gmon.out", O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        gmon_state = GMON_PROF_ERROR;
+        return;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.cookie, GMON_MAGIC, sizeof(hdr.cookie));
+    hdr.version = GMON_VERSION;
+    ok = gmon_write(fd, &hdr, sizeof(hdr)) == 0;
+
+    if (ok && gmon_hist_size) {
+        tag = GMON_TAG_TIME_HIST;
+        memset(&hist, 0, sizeof(hist));
+        hist.low_pc = gmon_lowpc;
+        hist.high_pc = gmon_highpc;
+        hist.hist_size = gmon_hist_size;
+        hist.prof_rate = GMON_SAMPLE_RATE;
+        memcpy(hist.dimen, "seconds", sizeof("seconds"));
+        hist.dimen_abbrev = 's';
+        ok = gmon_write(fd, &tag, 1) == 0 && gmon_write(fd, &hist, sizeof(hist)) == 0
+            && gmon_write(fd, gmon_hist, gmon_hist_size * sizeof(*gmon_hist)) == 0;
+    }
+
+    for (i = 0, n = 0; ok && i < GMON_ARCS; i++) {
+        if (gmon_arcs[i].count) {
+            recs[n].tag = GMON_TAG_CG_ARC;
+            recs[n].frompc = gmon_arcs[i].frompc;
+            recs[n].selfpc = gmon_arcs[i].selfpc;
+            recs[n].count = gmon_arcs[i].count;
+            n++;
+        }
+        if (n == GMON_ARC_BATCH || (n && i == GMON_ARCS - 1)) {
+            ok = gmon_write(fd, recs, n * sizeof(recs[0])) == 0;
+            n = 0;
+        }
+    }
+
+    close(fd);
+    gmon_state = GMON_PROF_OFF;
+}
+
+static NOPROF __attribute__((constructor)) void
+gmon_init(void)
+{
+    monstartup((uintptr_t)__text_start, (uintptr_t)__text_end);
+    atexit(_mcleanup);
+}
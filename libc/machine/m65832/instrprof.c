@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Profile output for code built with -fprofile-generate or
+ * -fprofile-instr-generate
+ *
+ * Instrumented code references __llvm_profile_runtime, which pulls in
+ * this file instead of the hosted parts of the compiler-rt profile
+ * runtime; only its buffer writer is needed from there. At exit the
+ * counters are written through the open/write syscalls to the first
+ * free name default_N.profraw, so that several runs in the same
+ * directory keep their profiles apart for llvm-profdata merge.
+ */
+
+#include <sys/cdefs.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define NOPROF __attribute__((no_instrument_function, no_profile_instrument_function))
+
+/* Names tried before giving up */
+#define INSTRPROF_FILES 1000
+
+int      __llvm_profile_runtime;
+
+uint64_t __llvm_profile_get_size_for_buffer(void);
+int      __llvm_profile_write_buffer(char *buffer);
+
+static NOPROF int
+instrprof_open(void)
+{
+    char     name[32];
+    unsigned n;
+    int      fd;
+
+    for (n = 0; n < INSTRPROF_FILES; n++) {
+        snprintf(name, sizeof(name), "default_%u.profraw", n);
+        fd = open(name, O_RDONLY);
+        if (fd >= 0) {
+            close(fd);
+            continue;
+        }
+        return open(name, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+    return -1;
+}
+
+static NOPROF void
+instrprof_write(void)
+{
+    static const char fail_msg[] = "instrprof: cannot write profile\n";
+    uint64_t          size = __llvm_profile_get_size_for_buffer();
+    char             *buf = malloc(size);
+    const char       *p = buf;
+    ssize_t           r = 0;
+    int               fd = -1;
+
+    if (buf && __llvm_profile_write_buffer(buf) == 0)
+        fd = instrprof_open();
+    if (fd >= 0) {
+        while (size) {
+            r = write(fd, p, size);
+            if (r <= 0)
+                break;
+            p += r;
+            size -= r;
+        }
+        close(fd);
+    }
+    if (fd < 0 || r <= 0)
+        (void)write(2, fail_msg, sizeof(fail_msg) - 1);
+    free(buf);
+}
+
+static NOPROF __attribute__((constructor)) void
+instrprof_init(void)
+{
+    atexit(instrprof_write);
+}
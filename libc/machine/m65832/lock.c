@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Retargetable locking for M65832
+ *
+ * Replaces the dummy locks in libc/misc/lock.c with interrupt masking.
+ * On a single core with cooperative tasks the only code which can run
+ * in the middle of a libc call is an interrupt handler, so every lock
+ * is the same critical section: the first acquire masks interrupts,
+ * the matching last release restores the mask it found. One nesting
+ * count covers all locks, which makes them recursive and lets them be
+ * released in any order; acquires from within an interrupt handler
+ * find interrupts already masked and leave them that way.
+ *
+ * A task must not yield while it holds a libc lock, as interrupts stay
+ * masked until it is released. Applications with a preemptive
+ * scheduler can still link their own implementation of the whole API
+ * in place of this one.
+ */
+
+#include <sys/lock.h>
+#include "m65832_irq.h"
+
+#ifndef __SINGLE_THREAD
+
+struct __lock {
+    char unused;
+};
+
+struct __lock __lock___libc_recursive_mutex;
+
+static unsigned __m65832_lock_depth;
+static unsigned __m65832_lock_state;
+
+void
+__retarget_lock_init(_LOCK_T *lock)
+{
+    *lock = &__lock___libc_recursive_mutex;
+}
+
+void
+__retarget_lock_init_recursive(_LOCK_T *lock)
+{
+    *lock = &__lock___libc_recursive_mutex;
+}
+
+void
+__retarget_lock_close(_LOCK_T lock)
+{
+    (void)lock;
+}
+
+void
+__retarget_lock_close_recursive(_LOCK_T lock)
+{
+    (void)lock;
+}
+
+void
+__retarget_lock_acquire(_LOCK_T lock)
+{
+    unsigned state = __m65832_critical_enter();
+
+    (void)lock;
+    if (__m65832_lock_depth++ == 0)
+        __m65832_lock_state = state;
+}
+
+void
+__retarget_lock_acquire_recursive(_LOCK_T lock)
+{
+    __retarget_lock_acquire(lock);
+}
+
+void
+__retarget_lock_release(_LOCK_T lock)
+{
+    (void)lock;
+    if (--__m65832_lock_depth == 0)
+        __m65832_critical_exit(__m65832_lock_state);
+}
+
+void
+__retarget_lock_release_recursive(_LOCK_T lock)
+{
+    __retarget_lock_release(lock);
+}
+
+#endif /* __SINGLE_THREAD */
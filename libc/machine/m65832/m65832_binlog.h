@@ -0,0 +1,161 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Format walking shared by the binary log writer and reader, see
+ * <machine/binlog.h>. Both sides classify each conversion the same
+ * way, which is what keeps the stored words in step with the format.
+ * The classes follow the argument types vfprintf fetches for each
+ * conversion and length modifier.
+ */
+
+#ifndef _M65832_BINLOG_H_
+#define _M65832_BINLOG_H_
+
+#include <machine/binlog.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* The argument a conversion consumes */
+#define BINLOG_NONE    0 /* %% */
+#define BINLOG_INT     1 /* int, and everything promoted to it */
+#define BINLOG_LONG    2
+#define BINLOG_LLONG   3
+#define BINLOG_INTMAX  4
+#define BINLOG_SIZE    5
+#define BINLOG_PTRDIFF 6
+#define BINLOG_PTR     7
+#define BINLOG_DOUBLE  8
+#define BINLOG_BAD     9 /* %n, positional or unknown */
+
+/* Words of the ring taken by a value */
+#define BINLOG_WORDS(v) ((sizeof(v) + sizeof(uintptr_t) - 1) / sizeof(uintptr_t))
+
+struct binlog_conv {
+    const char   *start; /* the '%' */
+    const char   *end;   /* just past the conversion character */
+    unsigned char stars; /* '*' widths and precisions, an int each */
+    unsigned char cls;
+};
+
+static inline int
+binlog_digit(char c)
+{
+    return (unsigned)(c - '0') < 10;
+}
+
+/*
+ * Find the conversion at or after fmt; returns NULL when only literal
+ * text is left.
+ */
+static inline const char *
+binlog_next(const char *fmt, struct binlog_conv *conv)
+{
+    const char *s = strchr(fmt, '%');
+    int         len = 0;
+    char        c;
+
+    if (!s)
+        return NULL;
+    conv->start = s++;
+    conv->stars = 0;
+    conv->cls = BINLOG_BAD;
+
+    while ((c = *s) == '-' || c == '+' || c == ' ' || c == '#' || c == '0' || c == '\'')
+        s++;
+    if (*s == '*') {
+        conv->stars++;
+        s++;
+    } else {
+        while (binlog_digit(*s))
+            s++;
+    }
+    if (*s == '$')
+        goto bad;
+    if (*s == '.') {
+        s++;
+        if (*s == '*') {
+            conv->stars++;
+            s++;
+        } else {
+            while (binlog_digit(*s))
+                s++;
+        }
+    }
+
+    switch ((c = *s)) {
+    case 'h':
+        s += s[1] == 'h';
+        break;
+    case 'l':
+        if (s[1] == 'l') {
+            s++;
+            len = BINLOG_LLONG;
+        } else {
+            len = BINLOG_LONG;
+        }
+        break;
+    case 'q':
+        len = BINLOG_LLONG;
+        break;
+    case 'j':
+        len = BINLOG_INTMAX;
+        break;
+    case 'z':
+        len = BINLOG_SIZE;
+        break;
+    case 't':
+        len = BINLOG_PTRDIFF;
+        break;
+    case 'L':
+        if (sizeof(long double) != sizeof(double))
+            goto bad;
+        len = BINLOG_LLONG;
+        break;
+    default:
+        s--;
+        break;
+    }
+    c = *++s;
+    if (c)
+        s++;
+
+    switch (c) {
+    case '%':
+        conv->cls = BINLOG_NONE;
+        break;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'b':
+        conv->cls = len ? len : BINLOG_INT;
+        break;
+    case 'c':
+        conv->cls = BINLOG_INT;
+        break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        conv->cls = BINLOG_DOUBLE;
+        break;
+    case 's':
+    case 'p':
+        conv->cls = BINLOG_PTR;
+        break;
+    }
+bad:
+    conv->end = s;
+    return s;
+}
+
+#endif /* _M65832_BINLOG_H_ */
@@ -0,0 +1,47 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Host-side bulk copy and fill for the M65832 memcpy, memmove and memset
+ *
+ * Built with -Dm65832-bulk-trap=N, blocks of at least N bytes go to
+ * the BULK_COPY and BULK_FILL TRAPs, which an emulator (or a system
+ * with a DMA engine) carries out in one step. BULK_COPY has memmove
+ * semantics, so memcpy and memmove share it. The TRAPs return 0 once
+ * the work is done. An emulator without them answers -ENOSYS; the
+ * first such answer turns them off for the rest of the run and every
+ * call falls back to the software loops. With N = 0 none of this is
+ * compiled in.
+ */
+
+#ifndef _M65832_BULK_H_
+#define _M65832_BULK_H_
+
+#include <picolibc.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "m65832_syscall.h"
+
+#if __M65832_BULK_TRAP > 0
+
+extern bool __m65832_bulk_off;
+
+bool __m65832_bulk_trap(long op, uintptr_t dst, uintptr_t arg, size_t len);
+
+static inline bool
+__m65832_bulk(long op, uintptr_t dst, uintptr_t arg, size_t len)
+{
+    if (len < __M65832_BULK_TRAP || __m65832_bulk_off)
+        return false;
+    return __m65832_bulk_trap(op, dst, arg, len);
+}
+
+#else
+
+#define __m65832_bulk(op, dst, arg, len) false
+
+#endif
+
+#endif /* _M65832_BULK_H_ */
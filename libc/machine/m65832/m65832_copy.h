@@ -0,0 +1,163 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Copy kernels shared by the M65832 memcpy and memmove
+ *
+ * The generic C versions handle a source and destination with
+ * different word alignment by merging pairs of source words with
+ * variable-count shifts, which M65832 (like the rest of the 65xx
+ * family) performs one bit at a time, so that costs far more than it
+ * saves. These kernels dispatch on size and
+ * on the relative alignment of the two pointers instead:
+ *
+ *   tiny     fewer than M65832_COPY_TINY bytes: plain byte loop
+ *   aligned  same alignment modulo 4: align, then move 32 bytes per
+ *            iteration with 32-bit accumulator loads and stores,
+ *            then single words
+ *   half     same alignment modulo 2: 16-bit moves
+ *   bytes    anything else: byte moves unrolled by four
+ *
+ * None of them read or write outside of the requested ranges.
+ */
+
+#ifndef _M65832_COPY_H_
+#define _M65832_COPY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define M65832_COPY_TINY 8
+#define M65832_COPY_BULK 32
+
+typedef uint32_t __attribute__((__may_alias__)) m65832_word_t;
+typedef uint16_t __attribute__((__may_alias__)) m65832_half_t;
+
+/*
+ * Copy forwards. Safe for overlapping ranges when dst < src as
+ * every load is issued before the store which could clobber it.
+ */
+static inline void
+__m65832_copy_fwd(unsigned char *dst, const unsigned char *src, size_t len)
+{
+    if (len >= M65832_COPY_TINY) {
+        uintptr_t skew = ((uintptr_t)dst ^ (uintptr_t)src);
+
+        if ((skew & 3) == 0) {
+            while ((uintptr_t)dst & 3) {
+                *dst++ = *src++;
+                len--;
+            }
+            m65832_word_t       *wd = (m65832_word_t *)dst;
+            const m65832_word_t *ws = (const m65832_word_t *)src;
+
+            while (len >= M65832_COPY_BULK) {
+                wd[0] = ws[0];
+                wd[1] = ws[1];
+                wd[2] = ws[2];
+                wd[3] = ws[3];
+                wd[4] = ws[4];
+                wd[5] = ws[5];
+                wd[6] = ws[6];
+                wd[7] = ws[7];
+                wd += 8;
+                ws += 8;
+                len -= M65832_COPY_BULK;
+            }
+            while (len >= sizeof(m65832_word_t)) {
+                *wd++ = *ws++;
+                len -= sizeof(m65832_word_t);
+            }
+            dst = (unsigned char *)wd;
+            src = (const unsigned char *)ws;
+        } else if ((skew & 1) == 0) {
+            if ((uintptr_t)dst & 1) {
+                *dst++ = *src++;
+                len--;
+            }
+            m65832_half_t       *hd = (m65832_half_t *)dst;
+            const m65832_half_t *hs = (const m65832_half_t *)src;
+
+            while (len >= sizeof(m65832_half_t)) {
+                *hd++ = *hs++;
+                len -= sizeof(m65832_half_t);
+            }
+            dst = (unsigned char *)hd;
+            src = (const unsigned char *)hs;
+        } else {
+            while (len >= 4) {
+                dst[0] = src[0];
+                dst[1] = src[1];
+                dst[2] = src[2];
+                dst[3] = src[3];
+                dst += 4;
+                src += 4;
+                len -= 4;
+            }
+        }
+    }
+    while (len--)
+        *dst++ = *src++;
+}
+
+/*
+ * Copy backwards, starting from the ends of the ranges. Safe for
+ * overlapping ranges when dst > src.
+ */
+static inline void
+__m65832_copy_bwd(unsigned char *dst, const unsigned char *src, size_t len)
+{
+    dst += len;
+    src += len;
+    if (len >= M65832_COPY_TINY) {
+        uintptr_t skew = ((uintptr_t)dst ^ (uintptr_t)src);
+
+        if ((skew & 3) == 0) {
+            while ((uintptr_t)dst & 3) {
+                *--dst = *--src;
+                len--;
+            }
+            m65832_word_t       *wd = (m65832_word_t *)dst;
+            const m65832_word_t *ws = (const m65832_word_t *)src;
+
+            while (len >= M65832_COPY_BULK) {
+                wd -= 8;
+                ws -= 8;
+                wd[7] = ws[7];
+                wd[6] = ws[6];
+                wd[5] = ws[5];
+                wd[4] = ws[4];
+                wd[3] = ws[3];
+                wd[2] = ws[2];
+                wd[1] = ws[1];
+                wd[0] = ws[0];
+                len -= M65832_COPY_BULK;
+            }
+            while (len >= sizeof(m65832_word_t)) {
+                *--wd = *--ws;
+                len -= sizeof(m65832_word_t);
+            }
+            dst = (unsigned char *)wd;
+            src = (const unsigned char *)ws;
+        } else if ((skew & 1) == 0) {
+            if ((uintptr_t)dst & 1) {
+                *--dst = *--src;
+                len--;
+            }
+            m65832_half_t       *hd = (m65832_half_t *)dst;
+            const m65832_half_t *hs = (const m65832_half_t *)src;
+
+            while (len >= sizeof(m65832_half_t)) {
+                *--hd = *--hs;
+                len -= sizeof(m65832_half_t);
+            }
+            dst = (unsigned char *)hd;
+            src = (const unsigned char *)hs;
+        }
+    }
+    while (len--)
+        *--dst = *--src;
+}
+
+#endif /* _M65832_COPY_H_ */
@@ -7,52 +7,228 @@
  *
  * Uses _write() / _read() syscall stubs for I/O, which go through
  * TRAP-based syscalls when running with the system emulator.
+ *
+ * stdin, stdout and stderr are separate streams on fd 0, 1 and 2.
+ * The buffering of stdin/stdout is selected with -Dm65832-console
+ * and that of stderr with -Dm65832-console-stderr. Buffered streams
+ * use the bufio machinery so that output is collected into a buffer
+ * and handed to the emulator in one TRAP instead of one TRAP per
+ * character. Anything left in the buffers is flushed from _exit.
  */
 
 #include <stdio.h>
+#include <stdio-bufio.h>
+#include <picofast.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <machine/conin.h>
+#include <machine/conout.h>
 
 /* Declare syscall functions provided by libsys.a */
 extern ssize_t _write(int fd, const void *buf, size_t len);
 extern ssize_t _read(int fd, void *buf, size_t len);
+extern ssize_t _writev(int fd, const struct iovec *iov, int iovcnt);
+
+void __m65832_console_flush(void);
+
+/*
+ * stdin reads through the console input ring, see <machine/conin.h>:
+ * one TRAP fetches everything waiting, or none at all when an
+ * interrupt handler fills the ring
+ */
+static ssize_t
+conin_read(int fd, void *buf, size_t len)
+{
+    (void)fd;
+    return __m65832_conin_read(buf, len);
+}
 
+#if !defined(__M65832_CONSOLE_BUFIO) || !defined(__M65832_STDERR_BUFIO)
 /*
- * Output a character via _write(1, &c, 1) — stdout fd
+ * Output a character via the console output ring or _write(fd, &c, 1)
  */
 static int
-sys_putc(char c, FILE *file)
+sys_putc(int fd, char c)
 {
-    (void)file;
-    ssize_t r = _write(1, &c, 1);
+    ssize_t r = __m65832_conout_write(fd, &c, 1);
     if (r < 0) return EOF;
     return (unsigned char)c;
 }
 
 /*
- * Read a character via _read(0, &c, 1) — stdin fd
+ * Output a whole span with as few _write calls as the fd allows, so
+ * that fputs, fwrite and printf strings cost one TRAP instead of one
+ * per character
+ */
+static size_t
+sys_put_span(int fd, const char *s, size_t len)
+{
+    size_t done = 0;
+
+    while (done < len) {
+        ssize_t r = __m65832_conout_write(fd, s + done, len - done);
+        if (r <= 0)
+            break;
+        done += r;
+    }
+    return done;
+}
+#endif
+
+#ifdef __M65832_CONSOLE_BUFIO
+
+#ifdef __M65832_CONSOLE_LINEBUF
+#define CONSOLE_BFLAGS __BLBF
+#else
+#define CONSOLE_BFLAGS 0
+#endif
+
+static char                __stdin_buf[BUFSIZ];
+static char                __stdout_buf[BUFSIZ];
+
+static struct __file_bufio __stdin
+    = FDEV_SETUP_BUFIO(0, __stdin_buf, BUFSIZ, conin_read, _write, NULL, NULL, __SRD, 0);
+static struct __file_bufio __stdout
+    = FDEV_SETUP_BUFIO_WRITEV(1, __stdout_buf, BUFSIZ, _read, __m65832_conout_write,
+                              __m65832_conout_writev, NULL, NULL, __SWR, CONSOLE_BFLAGS);
+
+FILE * const stdin = &__stdin.xfile.cfile.file;
+FILE * const stdout = &__stdout.xfile.cfile.file;
+
+#ifdef __M65832_CONSOLE_LINEBUF
+/*
+ * Line buffering only helps someone watching a terminal. When stdout
+ * is redirected to a file or pipe, buffer it fully so that large
+ * outputs go out in BUFSIZ writes. This runs before main, so setvbuf
+ * in the application still has the last word.
+ */
+static __attribute__((constructor)) void
+console_check_tty(void)
+{
+    if (!isatty(1))
+        __stdout.bflags &= ~__BLBF;
+}
+#endif
+
+#else
+
+/*
+ * Output a character to the stdout fd
+ */
+static int
+sys_putc_stdout(char c, FILE *file)
+{
+    (void)file;
+    return sys_putc(1, c);
+}
+
+static size_t
+sys_put_span_stdout(const char *s, size_t len, FILE *file)
+{
+    (void)file;
+    return sys_put_span(1, s, len);
+}
+
+/*
+ * Read a character from the console input ring
  */
 static int
 sys_getc(FILE *file)
 {
     (void)file;
     char c;
-    ssize_t r = _read(0, &c, 1);
+    ssize_t r = conin_read(0, &c, 1);
     if (r <= 0) return EOF;
     return (unsigned char)c;
 }
 
-/* Create the stdio FILE structure using syscall-based I/O */
-static FILE __stdio = FDEV_SETUP_STREAM(sys_putc, sys_getc, NULL, _FDEV_SETUP_RW);
+/*
+ * Read a span from stdin, one conin_read per chunk available
+ */
+static size_t
+sys_get_span(char *s, size_t len, FILE *file)
+{
+    size_t done = 0;
+
+    while (done < len) {
+        ssize_t r = conin_read(0, s + done, len - done);
+        if (r <= 0) {
+            file->flags |= r < 0 ? __SERR : __SEOF;
+            break;
+        }
+        done += r;
+    }
+    return done;
+}
+
+/* The unbuffered FILEs are small enough for .fastdata, see m65832-fast-data */
+static FILE __stdin __libc_fastdata
+    = FDEV_SETUP_STREAM_SPAN(NULL, sys_getc, NULL, sys_get_span, NULL, _FDEV_SETUP_READ);
+static FILE __stdout __libc_fastdata = FDEV_SETUP_STREAM_SPAN(sys_putc_stdout, NULL, sys_put_span_stdout,
+                                                              NULL, NULL, _FDEV_SETUP_WRITE);
 
-/* Define stdin, stdout, stderr to all use the same stream */
-#ifdef __strong_reference
-#define STDIO_ALIAS(x) __strong_reference(stdin, x);
+FILE * const stdin = &__stdin;
+FILE * const stdout = &__stdout;
+
+#endif
+
+#ifdef __M65832_STDERR_BUFIO
+
+#ifdef __M65832_STDERR_LINEBUF
+#define STDERR_BFLAGS __BLBF
 #else
-#define STDIO_ALIAS(x) FILE * const x = &__stdio;
+#define STDERR_BFLAGS 0
+#endif
+
+static char                __stderr_buf[BUFSIZ];
+
+static struct __file_bufio __stderr
+    = FDEV_SETUP_BUFIO_WRITEV(2, __stderr_buf, BUFSIZ, _read, __m65832_conout_write,
+                              __m65832_conout_writev, NULL, NULL, __SWR, STDERR_BFLAGS);
+
+FILE * const stderr = &__stderr.xfile.cfile.file;
+
+#else
+
+/*
+ * Output a character to the stderr fd
+ */
+static int
+sys_putc_stderr(char c, FILE *file)
+{
+    (void)file;
+    return sys_putc(2, c);
+}
+
+static size_t
+sys_put_span_stderr(const char *s, size_t len, FILE *file)
+{
+    (void)file;
+    return sys_put_span(2, s, len);
+}
+
+static FILE __stderr __libc_fastdata = FDEV_SETUP_STREAM_SPAN(sys_putc_stderr, NULL, sys_put_span_stderr,
+                                                              NULL, NULL, _FDEV_SETUP_WRITE);
+
+FILE * const stderr = &__stderr;
+
 #endif
 
-FILE * const stdin = &__stdio;
-STDIO_ALIAS(stdout);
-STDIO_ALIAS(stderr);
+/*
+ * Called from _exit so that buffered output isn't lost when the
+ * application terminates without going through exit() or fflush()
+ */
+void
+__m65832_console_flush(void)
+{
+#ifdef __M65832_CONSOLE_BUFIO
+    __bufio_flush(stdout);
+#endif
+#ifdef __M65832_STDERR_BUFIO
+    __bufio_flush(stderr);
+#endif
+    __m65832_conout_sync();
+}
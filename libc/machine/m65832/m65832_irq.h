@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Critical sections for the M65832 locks and atomics
+ *
+ * __m65832_irq_save() masks interrupts and returns the previous mask
+ * state for the matching __m65832_irq_restore(); see irq.S. The memory
+ * clobbers keep the compiler from moving loads and stores of the
+ * protected data out of the section.
+ */
+
+#ifndef _M65832_IRQ_H_
+#define _M65832_IRQ_H_
+
+unsigned __m65832_irq_save(void);
+void     __m65832_irq_restore(unsigned state);
+
+static __inline__ unsigned
+__m65832_critical_enter(void)
+{
+    unsigned state = __m65832_irq_save();
+
+    __asm__ volatile("" ::: "memory");
+    return state;
+}
+
+static __inline__ void
+__m65832_critical_exit(unsigned state)
+{
+    __asm__ volatile("" ::: "memory");
+    __m65832_irq_restore(state);
+}
+
+/*
+ * WAI: halt until an interrupt is pending. With interrupts masked the
+ * core resumes after the WAI without taking the interrupt.
+ */
+static __inline__ void
+__m65832_wait_irq(void)
+{
+    __asm__ volatile(".byte 0xcb" ::: "memory");
+}
+
+#endif /* _M65832_IRQ_H_ */
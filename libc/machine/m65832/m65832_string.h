@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Word-at-a-time helpers for the M65832 string functions
+ *
+ * M65832_HAS_ZERO flags the high bit of each zero byte in a 32-bit
+ * word. A borrow can also flag a 0x01 byte sitting just above a zero
+ * byte, but never one below it, so on this little-endian target the
+ * lowest flagged byte is always the first real match. That lets the
+ * callers compute the match position straight from the flags rather
+ * than rescanning the word a byte at a time.
+ *
+ * Scans that run backwards want the highest match instead, which the
+ * borrow can fake, so they use M65832_HAS_ZERO_EXACT. It adds without
+ * carrying between bytes and flags exactly the zero bytes.
+ */
+
+#ifndef _M65832_STRING_H_
+#define _M65832_STRING_H_
+
+#include <stdint.h>
+
+typedef uint32_t __attribute__((__may_alias__)) m65832_word_t;
+
+#define M65832_HAS_ZERO(x) (((x) - 0x01010101UL) & ~(x) & 0x80808080UL)
+
+#define M65832_HAS_ZERO_EXACT(x) \
+    (~((((x) & 0x7f7f7f7fUL) + 0x7f7f7f7fUL) | (x)) & 0x80808080UL)
+
+/* Replicate a byte into all four bytes of a word */
+static inline uint32_t
+__m65832_splat(unsigned char c)
+{
+    uint32_t w = c | ((uint32_t)c << 8);
+    return w | (w << 16);
+}
+
+/* Index of the first flagged byte; flags must be non-zero */
+static inline unsigned
+__m65832_first_byte(uint32_t flags)
+{
+    if (flags & 0x80UL)
+        return 0;
+    if (flags & 0x8000UL)
+        return 1;
+    if (flags & 0x800000UL)
+        return 2;
+    return 3;
+}
+
+/* Index of the first non-zero byte of x; x must be non-zero */
+static inline unsigned
+__m65832_first_set_byte(uint32_t x)
+{
+    if (x & 0xffUL)
+        return 0;
+    if (x & 0xff00UL)
+        return 1;
+    if (x & 0xff0000UL)
+        return 2;
+    return 3;
+}
+
+/* Index of the last flagged byte; flags must be non-zero and exact */
+static inline unsigned
+__m65832_last_byte(uint32_t flags)
+{
+    if (flags & 0x80000000UL)
+        return 3;
+    if (flags & 0x800000UL)
+        return 2;
+    if (flags & 0x8000UL)
+        return 1;
+    return 0;
+}
+
+#endif /* _M65832_STRING_H_ */
@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * TRAP #0 system calls for M65832
+ *
+ * The call number goes in r0 and up to three arguments in r1-r3; the
+ * result comes back in r0, with -errno for failures. Numbers follow
+ * the Linux i386 table except for the M65832 extensions at 0x1000 and
+ * above.
+ */
+
+#ifndef _M65832_SYSCALL_H_
+#define _M65832_SYSCALL_H_
+
+#include <picolibc.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#define M65832_SYS_EXIT     1
+#define M65832_SYS_READ     3
+#define M65832_SYS_WRITE    4
+#define M65832_SYS_OPEN     5
+#define M65832_SYS_CLOSE    6
+#define M65832_SYS_LSEEK    19
+#define M65832_SYS_GETPID   20
+#define M65832_SYS_IOCTL    54
+#define M65832_SYS_FCNTL    55
+#define M65832_SYS_MMAP     90
+#define M65832_SYS_MUNMAP   91
+#define M65832_SYS_STAT     106
+#define M65832_SYS_FSTAT    108
+#define M65832_SYS_READV    145
+#define M65832_SYS_WRITEV   146
+#define M65832_SYS_NANOSLEEP 162
+#define M65832_SYS_POLL     168
+#define M65832_SYS_EXIT_GRP 248
+#define M65832_SYS_GETRANDOM 355
+#define M65832_SYS_CLOCK_GETTIME64 403
+#define M65832_SYS_CLOCK_GETRES64  406
+
+/* M65832 extensions */
+#define M65832_SYS_BATCH     0x1000 /* run an array of m65832_sqe, see ring.c */
+#define M65832_SYS_TIME_PAGE 0x1001 /* address of the time page, see timepage.c */
+#define M65832_SYS_SEMIHOST  0x1002 /* ARM semihosting operation, see semihost/machine/m65832 */
+#define M65832_SYS_BULK_COPY 0x1003 /* memmove(r1, r2, r3) by the host, see m65832_bulk.h */
+#define M65832_SYS_BULK_FILL 0x1004 /* memset(r1, r2, r3) by the host */
+#define M65832_SYS_GETDENTS_PLUS 0x1005 /* m65832_dirent records, see below */
+#define M65832_SYS_TIMER     0x1006 /* raise IRQ at monotonic ns r1 (low), r2 (high), see sleep.c */
+
+/*
+ * The stat ABI: FSTAT fills the Linux i386 struct stat, whatever the
+ * layout of picolibc's struct stat, and _fstat converts it. Emulators
+ * report the host's preferred I/O size in st_blksize, or 0 when they
+ * have none.
+ */
+struct m65832_stat {
+    unsigned long  st_dev;
+    unsigned long  st_ino;
+    unsigned short st_mode;
+    unsigned short st_nlink;
+    unsigned short st_uid;
+    unsigned short st_gid;
+    unsigned long  st_rdev;
+    unsigned long  st_size;
+    unsigned long  st_blksize;
+    unsigned long  st_blocks;
+    unsigned long  st_atime_sec;
+    unsigned long  st_atime_nsec;
+    unsigned long  st_mtime_sec;
+    unsigned long  st_mtime_nsec;
+    unsigned long  st_ctime_sec;
+    unsigned long  st_ctime_nsec;
+    unsigned long  __unused4;
+    unsigned long  __unused5;
+};
+
+/*
+ * GETDENTS_PLUS fills the r3-byte buffer at r2 with as many entries of
+ * the directory open on r1 as fit and returns the bytes used, 0 at the
+ * end. Each record is d_reclen bytes long, a multiple of 4, and d_name
+ * is NUL-terminated. d_type takes the DT_ values of <dirent.h>.
+ */
+struct m65832_dirent {
+    unsigned long  d_ino;
+    unsigned long  d_size;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    unsigned char  __pad;
+    char           d_name[];
+};
+
+static inline long __m65832_trap0(long n) {
+    register long r0 __asm__("r0") = n;
+    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : : "memory");
+    return r0;
+}
+
+static inline long __m65832_trap1(long n, long a1) {
+    register long r0 __asm__("r0") = n;
+    register long r1 __asm__("r1") = a1;
+    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : "r"(r1) : "memory");
+    return r0;
+}
+
+static inline long __m65832_trap2(long n, long a1, long a2) {
+    register long r0 __asm__("r0") = n;
+    register long r1 __asm__("r1") = a1;
+    register long r2 __asm__("r2") = a2;
+    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : "r"(r1), "r"(r2) : "memory");
+    return r0;
+}
+
+static inline long __m65832_trap3(long n, long a1, long a2, long a3) {
+    register long r0 __asm__("r0") = n;
+    register long r1 __asm__("r1") = a1;
+    register long r2 __asm__("r2") = a2;
+    register long r3 __asm__("r3") = a3;
+    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : "r"(r1), "r"(r2), "r"(r3) : "memory");
+    return r0;
+}
+
+/*
+ * Built with -Dm65832-syscall-stats=true, every call goes through
+ * sysstats.c, which counts it, see <machine/sysstats.h>
+ */
+#if __M65832_SYSCALL_STATS
+
+long __m65832_syscall_counted(long n, long a1, long a2, long a3);
+
+static inline long __syscall0(long n) {
+    return __m65832_syscall_counted(n, 0, 0, 0);
+}
+
+static inline long __syscall1(long n, long a1) {
+    return __m65832_syscall_counted(n, a1, 0, 0);
+}
+
+static inline long __syscall2(long n, long a1, long a2) {
+    return __m65832_syscall_counted(n, a1, a2, 0);
+}
+
+static inline long __syscall3(long n, long a1, long a2, long a3) {
+    return __m65832_syscall_counted(n, a1, a2, a3);
+}
+
+#else
+
+#define __syscall0 __m65832_trap0
+#define __syscall1 __m65832_trap1
+#define __syscall2 __m65832_trap2
+#define __syscall3 __m65832_trap3
+
+#endif
+
+static inline long __syscall_ret(long r) {
+    if (r < 0 && r > -4096) {
+        errno = -r;
+        return -1;
+    }
+    return r;
+}
+
+/*
+ * Read the realtime or monotonic clock from the time page. Returns -1
+ * when there is no page or it is too stale, and the TRAP has to be used.
+ */
+struct timespec;
+int __m65832_time_page_read(bool realtime, struct timespec *tp);
+
+#endif /* _M65832_SYSCALL_H_ */
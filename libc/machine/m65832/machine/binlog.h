@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Deferred binary logging for M65832
+ *
+ * Formatting a printf line costs thousands of cycles, too many for an
+ * interrupt handler or a tight loop. __m65832_binlog takes the same
+ * arguments as printf but only records them: it walks the format to
+ * learn the argument types and stores the format pointer and the raw
+ * argument words in a ring. __m65832_binlog_flush later formats the
+ * pending records into a FILE, from a low-priority task or the idle
+ * loop.
+ *
+ * Each record is the format pointer, the number of argument words
+ * which follow and the arguments in order, a word each for int, long
+ * and pointer values and two for long long and double. A host tool
+ * can also read the ring from a memory dump and look the format
+ * strings up in the ELF instead of formatting on the target.
+ *
+ * Only the pointer of a %s argument is stored, so the string must
+ * still be there when the record is formatted; string literals are.
+ * Formats using %n or positional arguments are refused.
+ *
+ * The log is plain storage owned by the caller, over a buffer of a
+ * power of two words; initialize it with __m65832_binlog_init. One
+ * context writes to it and one drains it, and neither takes a lock,
+ * so give each task or interrupt level its own log. Records which do
+ * not fit are dropped and counted.
+ */
+
+#ifndef _MACHINE_BINLOG_H_
+#define _MACHINE_BINLOG_H_
+
+#include <sys/cdefs.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+_BEGIN_STD_C
+
+struct m65832_binlog {
+    uintptr_t *buf;
+    unsigned   mask;    /* words in buf - 1 */
+    unsigned   head;    /* words ever written, advanced by the writer */
+    unsigned   tail;    /* words ever drained, advanced by the reader */
+    unsigned   dropped; /* records which did not fit */
+};
+
+int __m65832_binlog_init(struct m65832_binlog *__log, uintptr_t *__buf, unsigned __words);
+int __m65832_binlog(struct m65832_binlog *__log, const char *__fmt, ...)
+    __picolibc_format(__printf__, 2, 3);
+int __m65832_vbinlog(struct m65832_binlog *__log, const char *__fmt, va_list __ap)
+    __picolibc_format(__printf__, 2, 0);
+int __m65832_binlog_flush(struct m65832_binlog *__log, FILE *__out);
+
+_END_STD_C
+
+#endif /* _MACHINE_BINLOG_H_ */
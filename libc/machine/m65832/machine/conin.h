@@ -0,0 +1,50 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Console input ring for M65832
+ *
+ * stdin reads through a ring of M65832_CONIN_SIZE bytes. By default
+ * the ring is filled with one read of fd 0 for as much as is waiting,
+ * and getc then takes characters from it without a TRAP until it runs
+ * dry.
+ *
+ * A system with a UART interrupt can fill the ring from the handler
+ * instead: call __m65832_conin_put for each received byte and turn
+ * on __m65832_conin_irq. stdin then never makes a TRAP for input;
+ * while the ring is empty it calls __m65832_conin_idle, which does
+ * nothing unless the application provides one (to wait for an
+ * interrupt, or yield to another thread). Bytes arriving while the
+ * ring is full are dropped and counted.
+ *
+ * The handler is the only writer and stdin the only reader, so the
+ * ring needs no lock. poll reports fd 0 readable while the ring holds
+ * bytes.
+ */
+
+#ifndef _MACHINE_CONIN_H_
+#define _MACHINE_CONIN_H_
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+#define M65832_CONIN_SIZE 256
+
+/* Producer side, for the interrupt handler */
+int    __m65832_conin_put(unsigned char __c);
+size_t __m65832_conin_put_span(const void *__buf, size_t __len);
+
+void          __m65832_conin_irq(int __on);
+size_t        __m65832_conin_ready(void);
+unsigned long __m65832_conin_dropped(void);
+void          __m65832_conin_idle(void);
+
+/* What stdin reads with */
+ssize_t __m65832_conin_read(void *__buf, size_t __len);
+
+_END_STD_C
+
+#endif /* _MACHINE_CONIN_H_ */
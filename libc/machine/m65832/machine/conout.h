@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Console output ring for M65832
+ *
+ * Normally stdout and stderr hand their output to the emulator or
+ * kernel with write TRAPs, which return once the data is taken. A
+ * system with a UART TX interrupt or a DMA engine can instead switch
+ * the console to a ring of M65832_CONOUT_SIZE bytes: writes to fd 1
+ * and 2 only copy into the ring, __m65832_conout_kick is called so
+ * the application can start its transmitter, and the transmitter
+ * drains the ring with __m65832_conout_get (copying, for a FIFO) or
+ * __m65832_conout_span and __m65832_conout_done (in place, for DMA).
+ *
+ * When the ring is full, M65832_CONOUT_BLOCK waits for room, calling
+ * __m65832_conout_idle, and M65832_CONOUT_DROP drops what does not
+ * fit and counts it. Both hooks are weak and do nothing by default.
+ * At exit, and when the ring is turned off, writers wait until the
+ * transmitter has emptied it.
+ *
+ * Writers copy under a critical section, so stdout and stderr may be
+ * used from different threads; the transmitter is the only reader
+ * and takes no lock.
+ */
+
+#ifndef _MACHINE_CONOUT_H_
+#define _MACHINE_CONOUT_H_
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+#define M65832_CONOUT_SIZE 512
+
+#define M65832_CONOUT_OFF   0 /* write TRAPs, the default */
+#define M65832_CONOUT_BLOCK 1
+#define M65832_CONOUT_DROP  2
+
+void __m65832_conout_mode(int __mode);
+
+/* Transmitter side */
+size_t __m65832_conout_get(void *__buf, size_t __max);
+size_t __m65832_conout_span(const void **__span);
+void   __m65832_conout_done(size_t __len);
+
+size_t        __m65832_conout_pending(void);
+unsigned long __m65832_conout_dropped(void);
+void          __m65832_conout_kick(void);
+void          __m65832_conout_idle(void);
+void          __m65832_conout_sync(void);
+
+/* What stdout and stderr write with */
+struct iovec;
+ssize_t __m65832_conout_write(int __fd, const void *__buf, size_t __len);
+ssize_t __m65832_conout_writev(int __fd, const struct iovec *__iov, int __iovcnt);
+
+_END_STD_C
+
+#endif /* _MACHINE_CONOUT_H_ */
@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Inline cycle counter read for timing hot paths on M65832
+ *
+ * __m65832_cycles() returns the number of CPU cycles since reset, or 0
+ * when neither hardware nor emulator provides a counter. Building with
+ * __M65832_CYCLE_COUNTER set to the address of a memory-mapped 64-bit
+ * counter reads it directly; otherwise the counter is read with one
+ * TRAP, which leaves memory alone and costs a few dozen cycles.
+ */
+
+#ifndef _MACHINE_CYCLES_H_
+#define _MACHINE_CYCLES_H_
+
+#include <stdint.h>
+
+/* TRAP service returning the cycle count in R0 (low) and R1 (high) */
+#define M65832_SYS_CYCLES 0x400
+
+static __inline__ uint64_t
+__m65832_cycles(void)
+{
+#ifdef __M65832_CYCLE_COUNTER
+    volatile const uint32_t *counter = (volatile const uint32_t *)(__M65832_CYCLE_COUNTER);
+    uint32_t                 hi, lo;
+
+    /* Read the high word around the low one to catch a carry */
+    do {
+        hi = counter[1];
+        lo = counter[0];
+    } while (hi != counter[1]);
+    return ((uint64_t)hi << 32) | lo;
+#else
+    register uint32_t r0 __asm__("r0") = M65832_SYS_CYCLES;
+    register uint32_t r1 __asm__("r1") = 0xffffffff;
+
+    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0), "+r"(r1));
+    /* An emulator without the service leaves R1 alone */
+    if (r1 == 0xffffffff)
+        return 0;
+    return ((uint64_t)r1 << 32) | r0;
+#endif
+}
+
+#endif /* _MACHINE_CYCLES_H_ */
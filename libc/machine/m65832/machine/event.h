@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Event loop support for M65832
+ *
+ * An event set holds up to M65832_EVENT_MAX file descriptors, each
+ * with the poll events it waits for and a pointer handed back with
+ * every event, typically the handler or state for that descriptor.
+ * __m65832_event_wait blocks in one poll TRAP until at least one
+ * descriptor is ready or the timeout expires, then reports the ready
+ * ones. Combined with O_NONBLOCK, a single loop can service the
+ * console, pipes and storage without busy-waiting.
+ *
+ * Ready descriptors are reported starting after the last one returned
+ * by the previous wait, so a busy descriptor cannot starve the others
+ * when fewer events than are ready fit in the caller's array.
+ *
+ * The set is plain storage owned by the caller; initialize it with
+ * __m65832_event_init. It is not locked.
+ */
+
+#ifndef _MACHINE_EVENT_H_
+#define _MACHINE_EVENT_H_
+
+#include <sys/cdefs.h>
+#include <poll.h>
+
+_BEGIN_STD_C
+
+#define M65832_EVENT_MAX 16
+
+struct m65832_event {
+    int   fd;
+    short events; /* poll revents: POLLIN, POLLOUT, POLLHUP... */
+    void *data;   /* as passed to __m65832_event_add */
+};
+
+struct m65832_event_set {
+    nfds_t        count;
+    nfds_t        next; /* where the next wait starts reporting */
+    struct pollfd fds[M65832_EVENT_MAX];
+    void         *data[M65832_EVENT_MAX];
+};
+
+void __m65832_event_init(struct m65832_event_set *__set);
+int  __m65832_event_add(struct m65832_event_set *__set, int __fd, short __events, void *__data);
+int  __m65832_event_mod(struct m65832_event_set *__set, int __fd, short __events);
+int  __m65832_event_del(struct m65832_event_set *__set, int __fd);
+int  __m65832_event_wait(struct m65832_event_set *__set, struct m65832_event *__ev, int __max,
+                         int __timeout);
+
+_END_STD_C
+
+#endif /* _MACHINE_EVENT_H_ */
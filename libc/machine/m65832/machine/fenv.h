@@ -0,0 +1,179 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Soft-float floating point environment for M65832
+ *
+ * m65832 has no FPU, so the whole environment is one word in memory,
+ * __m65832_fenv, shared by the inline functions below and by the
+ * compiler-rt soft-float hooks in libm/machine/m65832/fenv.c:
+ * __fe_getround() reads the rounding mode from it and
+ * __fe_raise_inexact() sets FE_INEXACT in it.
+ *
+ *   bits 0-4   exception flags (FE_INVALID .. FE_INEXACT)
+ *   bits 8-9   rounding mode, numbered as compiler-rt's CRT_FE_ROUND_MODE
+ *
+ * Building with __M65832_ROUND_NEAREST_ONLY (-Dm65832-round-nearest-only=true)
+ * drops FE_DOWNWARD, FE_UPWARD and FE_TOWARDZERO: fegetround() is a
+ * constant, fesetround() only accepts FE_TONEAREST, compiler-rt never
+ * sees anything but round-to-nearest and libm leaves out its
+ * directed-rounding special cases.
+ *
+ * libm never forces a soft-float operation just to raise a flag here
+ * (__FLOAT_NOEXCEPT and friends). compiler-rt does not honor the
+ * rounding mode in every operation either, so the tests treat float and
+ * double arithmetic as round-to-nearest (__FLOAT_NOROUND and friends).
+ */
+
+#ifndef _MACHINE_FENV_H_
+#define _MACHINE_FENV_H_
+
+#include <sys/cdefs.h>
+
+_BEGIN_STD_C
+
+typedef int fenv_t;
+typedef int fexcept_t;
+
+#define __FLOAT_NOEXCEPT
+#define __DOUBLE_NOEXCEPT
+#define __LONG_DOUBLE_NOEXCEPT
+#define __FLOAT_NOROUND
+#define __DOUBLE_NOROUND
+#define __LONG_DOUBLE_NOROUND
+
+#define FE_INVALID    0x0001
+#define FE_DIVBYZERO  0x0002
+#define FE_OVERFLOW   0x0004
+#define FE_UNDERFLOW  0x0008
+#define FE_INEXACT    0x0010
+
+#define FE_ALL_EXCEPT (FE_INVALID | FE_DIVBYZERO | FE_OVERFLOW | FE_UNDERFLOW | FE_INEXACT)
+
+#define FE_TONEAREST  0
+#ifndef __M65832_ROUND_NEAREST_ONLY
+#define FE_DOWNWARD   1
+#define FE_UPWARD     2
+#define FE_TOWARDZERO 3
+#endif
+
+#define _M65832_ROUND_SHIFT 8
+#define _M65832_ROUND_MASK  (3 << _M65832_ROUND_SHIFT)
+
+extern fenv_t __m65832_fenv;
+
+#if !defined(__declare_fenv_inline) && defined(__declare_extern_inline)
+#define __declare_fenv_inline(type) __declare_extern_inline(type)
+#endif
+
+#ifdef __declare_fenv_inline
+
+__declare_fenv_inline(int) feclearexcept(int excepts)
+{
+    __m65832_fenv &= ~(excepts & FE_ALL_EXCEPT);
+    return 0;
+}
+
+__declare_fenv_inline(int) fegetexceptflag(fexcept_t *flagp, int excepts)
+{
+    *flagp = __m65832_fenv & excepts & FE_ALL_EXCEPT;
+    return 0;
+}
+
+__declare_fenv_inline(int) fesetexceptflag(const fexcept_t *flagp, int excepts)
+{
+    excepts &= FE_ALL_EXCEPT;
+    __m65832_fenv = (__m65832_fenv & ~excepts) | (*flagp & excepts);
+    return 0;
+}
+
+__declare_fenv_inline(int) feraiseexcept(int excepts)
+{
+    __m65832_fenv |= excepts & FE_ALL_EXCEPT;
+    return 0;
+}
+
+__declare_fenv_inline(int) fesetexcept(int excepts)
+{
+    return feraiseexcept(excepts);
+}
+
+__declare_fenv_inline(int) fetestexcept(int excepts)
+{
+    return __m65832_fenv & excepts & FE_ALL_EXCEPT;
+}
+
+__declare_fenv_inline(int) fegetround(void)
+{
+#ifdef __M65832_ROUND_NEAREST_ONLY
+    return FE_TONEAREST;
+#else
+    return (__m65832_fenv & _M65832_ROUND_MASK) >> _M65832_ROUND_SHIFT;
+#endif
+}
+
+__declare_fenv_inline(int) fesetround(int rounding_mode)
+{
+#ifdef __M65832_ROUND_NEAREST_ONLY
+    return rounding_mode != FE_TONEAREST;
+#else
+    if (rounding_mode & ~3)
+        return 1;
+    __m65832_fenv = (__m65832_fenv & ~_M65832_ROUND_MASK) | (rounding_mode << _M65832_ROUND_SHIFT);
+    return 0;
+#endif
+}
+
+__declare_fenv_inline(int) fegetenv(fenv_t *envp)
+{
+    *envp = __m65832_fenv;
+    return 0;
+}
+
+__declare_fenv_inline(int) feholdexcept(fenv_t *envp)
+{
+    *envp = __m65832_fenv;
+    __m65832_fenv &= ~FE_ALL_EXCEPT;
+    return 0;
+}
+
+__declare_fenv_inline(int) fesetenv(const fenv_t *envp)
+{
+    __m65832_fenv = *envp;
+    return 0;
+}
+
+__declare_fenv_inline(int) feupdateenv(const fenv_t *envp)
+{
+    __m65832_fenv = *envp | (__m65832_fenv & FE_ALL_EXCEPT);
+    return 0;
+}
+
+#if __BSD_VISIBLE
+
+/* There are no traps; only enabling none of them succeeds */
+
+__declare_fenv_inline(int) feenableexcept(int __mask)
+{
+    return (__mask & FE_ALL_EXCEPT) ? -1 : 0;
+}
+
+__declare_fenv_inline(int) fedisableexcept(int __mask)
+{
+    (void)__mask;
+    return 0;
+}
+
+__declare_fenv_inline(int) fegetexcept(void)
+{
+    return 0;
+}
+
+#endif /* __BSD_VISIBLE */
+
+#endif /* __declare_fenv_inline */
+
+_END_STD_C
+
+#endif /* _MACHINE_FENV_H_ */
@@ -0,0 +1,43 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Heap regions for M65832
+ *
+ * sbrk serves memory from up to M65832_HEAP_REGIONS separate ranges.
+ * The heap between __heap_start and __heap_end (or the internal-heap
+ * array) is always present and counts as fast on-chip memory. A linker
+ * script can add a slow external range by defining __heap_ext_start
+ * and __heap_ext_end; more ranges are registered at run time with
+ * __m65832_heap_add, before or after malloc has started using the
+ * heap. Any part of a new range overlapping one already present is
+ * left out. With semihosting and crt-runtime-size, the semihost crt0
+ * adds the heap reported by SYS_HEAPINFO.
+ *
+ * __m65832_malloc_fast returns memory from a fast range when one has
+ * room and from anywhere malloc finds it otherwise. The result is
+ * released with free.
+ */
+
+#ifndef _MACHINE_HEAP_H_
+#define _MACHINE_HEAP_H_
+
+#include <sys/cdefs.h>
+#define __need_size_t
+#include <stddef.h>
+
+_BEGIN_STD_C
+
+#define M65832_HEAP_REGIONS 8
+
+/* Region attributes */
+#define M65832_HEAP_SLOW 0x0 /* external or banked memory */
+#define M65832_HEAP_FAST 0x1 /* on-chip memory */
+
+int   __m65832_heap_add(void *__start, size_t __size, unsigned __flags);
+void *__m65832_malloc_fast(size_t __size) __malloc_like __warn_unused_result __alloc_size(1);
+
+_END_STD_C
+
+#endif /* _MACHINE_HEAP_H_ */
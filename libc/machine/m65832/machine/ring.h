@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Batched system calls for M65832
+ *
+ * Every TRAP is a full transition into the emulator or kernel. A ring
+ * collects read, write and lseek requests in memory and runs the
+ * whole queue with one TRAP when __m65832_ring_submit is called, or
+ * when it fills. Requests run in the order queued. Each one produces
+ * a completion holding the user pointer given when it was queued and
+ * the result the plain call would have returned, or -errno.
+ *
+ * Buffers handed to a request must stay valid until it completes.
+ * A request flagged M65832_SQE_STOP cancels the rest of its batch when
+ * it fails or transfers less than asked; the cancelled ones complete
+ * with -ECANCELED. Use it to chain writes which must land in order.
+ *
+ * Emulators without the batch TRAP get one TRAP per request, with the
+ * same results.
+ *
+ * The ring is plain storage owned by the caller; initialize it with
+ * __m65832_ring_init. It is not locked.
+ */
+
+#ifndef _MACHINE_RING_H_
+#define _MACHINE_RING_H_
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+#define M65832_RING_ENTRIES 16
+
+/* Request operations */
+#define M65832_OP_NOP   0
+#define M65832_OP_READ  1
+#define M65832_OP_WRITE 2
+#define M65832_OP_LSEEK 3
+
+/* Request flags */
+#define M65832_SQE_STOP 0x1
+
+struct m65832_sqe {
+    unsigned char op;
+    unsigned char flags;
+    short         whence; /* lseek */
+    int           fd;
+    void         *buf;    /* read, write */
+    long          arg;    /* length, or lseek offset */
+    void         *user;
+};
+
+struct m65832_cqe {
+    void *user;
+    long  res;
+};
+
+struct m65832_ring {
+    unsigned          sq_head; /* first request not yet run */
+    unsigned          sq_tail; /* next free request */
+    unsigned          cq_head; /* first completion not yet reaped */
+    struct m65832_sqe sq[M65832_RING_ENTRIES];
+    struct m65832_cqe cq[M65832_RING_ENTRIES];
+};
+
+void __m65832_ring_init(struct m65832_ring *__ring);
+int  __m65832_ring_read(struct m65832_ring *__ring, int __fd, void *__buf, size_t __len,
+                        unsigned __flags, void *__user);
+int  __m65832_ring_write(struct m65832_ring *__ring, int __fd, const void *__buf, size_t __len,
+                         unsigned __flags, void *__user);
+int  __m65832_ring_lseek(struct m65832_ring *__ring, int __fd, off_t __offset, int __whence,
+                         unsigned __flags, void *__user);
+int  __m65832_ring_submit(struct m65832_ring *__ring);
+int  __m65832_ring_reap(struct m65832_ring *__ring, struct m65832_cqe *__cqe);
+
+/* Run n requests at once, with one TRAP when the emulator allows */
+unsigned __m65832_batch(struct m65832_sqe *__sqe, unsigned __n, struct m65832_cqe *__cqe);
+
+_END_STD_C
+
+#endif /* _MACHINE_RING_H_ */
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Shared execute-in-place libc for M65832
+ *
+ * Built with -Dm65832-romlib=true, libc.a can be linked once into a
+ * ROM image that several applications share instead of each carrying
+ * its own copy. The ROM starts with struct __m65832_romlib, whose
+ * table holds the exported functions in a fixed order that later ROMs
+ * only append to, so an image keeps working with a newer ROM.
+ * Applications link with libcrom.a instead of libc.a: it has a small
+ * stub for each export that calls through the table.
+ *
+ * libc's .data and .bss sit in one RAM window, from window to
+ * window_end, which holds the state of whichever image called libc
+ * last. The stubs compare *owner with their image and, when another
+ * image was there, call enter, which saves the window into the old
+ * image's save area and restores the new one's, or sets it up from
+ * data_source on the image's first call. The word *owner lives
+ * outside the window.
+ * Images must therefore not preempt each other inside libc; switching
+ * between calls, cooperatively or from a scheduler, is fine.
+ *
+ * crt0 calls __m65832_romlib_init, which checks the ROM header, takes
+ * the save area and the image's heap from its __heap_start..__heap_end
+ * range and registers its destructors with the ROM's atexit.
+ */
+
+#ifndef _MACHINE_ROMLIB_H_
+#define _MACHINE_ROMLIB_H_
+
+#include <sys/cdefs.h>
+#include <stdint.h>
+#define __need_size_t
+#include <stddef.h>
+
+_BEGIN_STD_C
+
+#define M65832_ROMLIB_MAGIC   0x4d36524c /* "LR6M" */
+#define M65832_ROMLIB_VERSION 1
+#define M65832_ROMLIB_IMAGE   0x4d36494d /* "MI6M" */
+
+struct __m65832_romlib_image {
+    uint32_t                      magic; /* M65832_ROMLIB_IMAGE */
+    struct __m65832_romlib_image *self;
+    void                         *save;  /* as large as the window */
+    uint32_t                      started;
+};
+
+struct __m65832_romlib {
+    uint32_t                        magic;   /* M65832_ROMLIB_MAGIC */
+    uint16_t                        version; /* of this header */
+    uint16_t                        count;   /* entries in table */
+    struct __m65832_romlib_image  **owner;
+    void                            (*enter)(struct __m65832_romlib_image *__image);
+    char                           *window;      /* .data, then .bss */
+    char                           *data_end;
+    char                           *window_end;
+    const char                     *data_source; /* initial .data */
+    void                            (*const *table)(void);
+};
+
+/* At the start of the ROM; images get its address with --defsym */
+extern const struct __m65832_romlib __m65832_romlib;
+
+void __m65832_romlib_init(void);
+
+/* The ROM's stdin, stdout or stderr for fd 0, 1 or 2 */
+struct __file *__m65832_romlib_file(int __fd);
+
+_END_STD_C
+
+#endif /* _MACHINE_ROMLIB_H_ */
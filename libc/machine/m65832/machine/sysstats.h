@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * System call statistics for M65832
+ *
+ * A library built with -Dm65832-syscall-stats=true counts every TRAP
+ * the system layer makes: for each call number, how often it ran,
+ * how often it failed, the bytes it moved (read, write, readv,
+ * writev, getdents and the bulk copies) and the cycles spent in it,
+ * as read with __m65832_cycles. At exit a table of them goes to
+ * stderr, so a program making a write per character, or a FILE left
+ * unbuffered, shows up at once.
+ *
+ * __m65832_syscall_trace additionally records each call in a ring
+ * owned by the caller, a power of two entries long; once it is full
+ * the oldest entries are overwritten. Pass NULL to stop tracing.
+ *
+ * Counters are not locked; calls made from interrupt handlers may be
+ * lost. In a library built without the option the table is always
+ * empty and tracing cannot be started.
+ */
+
+#ifndef _MACHINE_SYSSTATS_H_
+#define _MACHINE_SYSSTATS_H_
+
+#include <sys/cdefs.h>
+#include <stdint.h>
+
+_BEGIN_STD_C
+
+/* Call numbers counted separately; the rest share one entry */
+#define M65832_SYSCALL_STATS_MAX 32
+
+struct m65832_syscall_stat {
+    long          nr;     /* call number, -1 for the shared entry */
+    unsigned long calls;
+    unsigned long errors; /* calls returning -errno */
+    uint64_t      bytes;
+    uint64_t      cycles;
+};
+
+struct m65832_syscall_rec {
+    long     nr;
+    long     arg;    /* first argument, usually the descriptor */
+    long     ret;
+    uint32_t cycles;
+};
+
+/* Copy up to max entries with calls, most cycles first; returns how many */
+int  __m65832_syscall_stats(struct m65832_syscall_stat *__stats, int __max);
+void __m65832_syscall_stats_reset(void);
+void __m65832_syscall_stats_print(int __fd);
+
+int      __m65832_syscall_trace(struct m65832_syscall_rec *__buf, unsigned __entries);
+/* Calls recorded since tracing started, including overwritten ones */
+uint32_t __m65832_syscall_traced(void);
+
+_END_STD_C
+
+#endif /* _MACHINE_SYSSTATS_H_ */
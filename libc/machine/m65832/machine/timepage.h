@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Shared time page for TRAP-free clock reads on M65832
+ *
+ * The emulator or kernel keeps the realtime and monotonic clocks in a
+ * page the program can read, so clock_gettime, gettimeofday and time
+ * need no TRAP. The writer makes seq odd, updates the other fields and
+ * makes seq even again; readers retry until they see the same even
+ * seq before and after reading.
+ *
+ * The times are those at cycle count cycle_base. When counter holds
+ * the address of a memory-mapped 64-bit cycle counter, readers add
+ * (cycles - cycle_base) * mult >> shift nanoseconds; the writer must
+ * refresh the page at least every 2^32 cycles. When counter is 0 the
+ * times are used as they are, so they are only as fine as the writer
+ * keeps them.
+ *
+ * Building with __M65832_TIME_PAGE set to the address of the page
+ * uses it directly; otherwise one TRAP on the first clock read asks
+ * the emulator where it is.
+ */
+
+#ifndef _MACHINE_TIMEPAGE_H_
+#define _MACHINE_TIMEPAGE_H_
+
+#include <sys/cdefs.h>
+#include <stdint.h>
+
+_BEGIN_STD_C
+
+#define M65832_TIME_PAGE_VERSION 1
+
+struct m65832_time_page {
+    uint32_t seq;       /* odd while the writer is updating */
+    uint32_t version;   /* M65832_TIME_PAGE_VERSION */
+    uint32_t counter;   /* address of the cycle counter, or 0 */
+    uint32_t mult;      /* nanoseconds per cycle, scaled by 2^shift */
+    uint32_t shift;
+    uint32_t mono_nsec;
+    uint32_t real_nsec;
+    uint32_t __pad;
+    uint64_t cycle_base;
+    int64_t  mono_sec;
+    int64_t  real_sec;
+};
+
+/* The page, or NULL when the emulator has none */
+const volatile struct m65832_time_page *__m65832_time_page(void);
+
+_END_STD_C
+
+#endif /* _MACHINE_TIMEPAGE_H_ */
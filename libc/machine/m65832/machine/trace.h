@@ -0,0 +1,58 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Function entry and exit tracing for M65832
+ *
+ * Code built with -finstrument-functions calls
+ * __cyg_profile_func_enter and __cyg_profile_func_exit around every
+ * function. The m65832 runtime stores one record per call in a ring:
+ * the function address and a cycle stamp from __m65832_cycles. Once
+ * the ring is full the oldest records are overwritten, so it always
+ * holds the latest calls. At exit the ring is written to trace.out,
+ * which m65832_trace.py turns into a timeline and a call tree with
+ * the time spent in each function.
+ *
+ * The stamp holds the low 31 bits of the cycle count shifted up one,
+ * with M65832_TRACE_EXIT set on exit records; readers unwrap it
+ * assuming records less than 2^31 cycles apart. Without a cycle
+ * counter every stamp is 0 and only the call order is kept.
+ *
+ * The ring is not locked. An interrupt handler which is itself
+ * instrumented can take the slot of the record it interrupted.
+ */
+
+#ifndef _MACHINE_TRACE_H_
+#define _MACHINE_TRACE_H_
+
+#include <sys/cdefs.h>
+#include <stdint.h>
+
+_BEGIN_STD_C
+
+#define M65832_TRACE_MAGIC   "m6tr"
+#define M65832_TRACE_VERSION 1
+#define M65832_TRACE_EXIT    0x1
+
+struct m65832_trace_rec {
+    uintptr_t fn;
+    uint32_t  stamp;
+};
+
+/* Start of a dump, followed by the records, oldest first */
+struct m65832_trace_hdr {
+    char     magic[4];
+    uint32_t version;
+    uint32_t count; /* records in the dump */
+    uint32_t lost;  /* records overwritten before the dump */
+};
+
+/* Record into buf, a power of two entries, from now on */
+int  __m65832_trace_buffer(struct m65832_trace_rec *__buf, unsigned __entries);
+void __m65832_trace_control(int __on);
+int  __m65832_trace_dump(int __fd);
+
+_END_STD_C
+
+#endif /* _MACHINE_TRACE_H_ */
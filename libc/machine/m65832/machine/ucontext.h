@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Cooperative context switching for M65832
+ *
+ * getcontext, setcontext, makecontext and swapcontext as in POSIX,
+ * for running many small tasks on their own stacks without an RTOS.
+ * A context holds only what setjmp does: the stack pointer, the
+ * return address and the callee-saved DP registers R16-R21, so a
+ * switch costs a few dozen cycles. Everything else is caller-saved
+ * and already spilled by the compiler around the call. The signal
+ * mask is not saved or restored.
+ *
+ * makecontext passes up to M65832_CONTEXT_ARGS int arguments. When
+ * the function returns, the context continues with uc_link, or the
+ * program exits with status 0 if that is NULL.
+ *
+ * __m65832_context_stack gives a context a stack of the requested
+ * size, from fast memory when there is room (see <machine/heap.h>);
+ * release it with free(ucp->uc_stack.ss_sp).
+ */
+
+#ifndef _MACHINE_UCONTEXT_H_
+#define _MACHINE_UCONTEXT_H_
+
+#include <sys/cdefs.h>
+#include <stdint.h>
+#include <signal.h>
+
+_BEGIN_STD_C
+
+#define M65832_CONTEXT_ARGS 6
+
+/* Laid out like jmp_buf, plus the R0 value a resumed context sees */
+typedef struct {
+    uint32_t __sp;
+    uint32_t __pc;
+    uint32_t __r16_21[6];
+    uint32_t __r0;
+} mcontext_t;
+
+typedef struct __ucontext {
+    mcontext_t          uc_mcontext; /* first, ucontext.S uses its offsets */
+    struct __ucontext  *uc_link;
+    stack_t             uc_stack;
+    sigset_t            uc_sigmask;  /* not saved or restored */
+    void              (*__func)(void);
+    int                 __argc;
+    int                 __argv[M65832_CONTEXT_ARGS];
+} ucontext_t;
+
+int  getcontext(ucontext_t *__ucp);
+int  setcontext(const ucontext_t *__ucp);
+void makecontext(ucontext_t *__ucp, void (*__func)(void), int __argc, ...);
+int  swapcontext(ucontext_t *__restrict __oucp, const ucontext_t *__restrict __ucp);
+
+int __m65832_context_stack(ucontext_t *__ucp, size_t __size);
+
+_END_STD_C
+
+#endif /* _MACHINE_UCONTEXT_H_ */
@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * memcmp for M65832
+ *
+ * Buffers with the same alignment modulo 4 are compared 16 bytes per
+ * iteration once aligned. In the first differing word, the XOR of the
+ * two words has its lowest non-zero byte at the first difference on
+ * this little-endian target, so that byte decides the result directly.
+ * Byte-swapping both words and comparing them whole would need
+ * shifts, which M65832 performs one bit at a time.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+#define MEMCMP_TINY 16
+
+int
+memcmp(const void *m1, const void *m2, size_t n)
+{
+    const unsigned char *s1 = (const unsigned char *)m1;
+    const unsigned char *s2 = (const unsigned char *)m2;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+    if (n >= MEMCMP_TINY && (((uintptr_t)s1 ^ (uintptr_t)s2) & 3) == 0) {
+        const m65832_word_t *a1;
+        const m65832_word_t *a2;
+
+        while ((uintptr_t)s1 & 3) {
+            if (*s1 != *s2)
+                return *s1 - *s2;
+            s1++;
+            s2++;
+            n--;
+        }
+
+        a1 = (const m65832_word_t *)s1;
+        a2 = (const m65832_word_t *)s2;
+        while (n >= 4 * sizeof(m65832_word_t)) {
+            if (a1[0] != a2[0] || a1[1] != a2[1] || a1[2] != a2[2] || a1[3] != a2[3])
+                break;
+            a1 += 4;
+            a2 += 4;
+            n -= 4 * sizeof(m65832_word_t);
+        }
+        while (n >= sizeof(m65832_word_t)) {
+            uint32_t x = *a1 ^ *a2;
+            if (x) {
+                unsigned i = __m65832_first_set_byte(x);
+                return ((const unsigned char *)a1)[i] - ((const unsigned char *)a2)[i];
+            }
+            a1++;
+            a2++;
+            n -= sizeof(m65832_word_t);
+        }
+
+        s1 = (const unsigned char *)a1;
+        s2 = (const unsigned char *)a2;
+    }
+#endif
+
+    while (n--) {
+        if (*s1 != *s2)
+            return *s1 - *s2;
+        s1++;
+        s2++;
+    }
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * memcpy for M65832, see m65832_copy.h for the size classes and
+ * m65832_bulk.h for very large blocks
+ */
+
+#include <string.h>
+#include "m65832_copy.h"
+#include "m65832_bulk.h"
+
+#undef memcpy
+
+void * __no_builtin
+memcpy(void * __restrict dst0, const void * __restrict src0, size_t len0)
+{
+    if (!__m65832_bulk(M65832_SYS_BULK_COPY, (uintptr_t)dst0, (uintptr_t)src0, len0))
+        __m65832_copy_fwd(dst0, src0, len0);
+    return dst0;
+}
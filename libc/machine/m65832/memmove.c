@@ -0,0 +1,29 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * memmove for M65832, see m65832_copy.h for the size classes and
+ * m65832_bulk.h for very large blocks
+ */
+
+#include <string.h>
+#include "m65832_copy.h"
+#include "m65832_bulk.h"
+
+#undef memmove
+
+void * __no_builtin
+memmove(void *dst_void, const void *src_void, size_t length)
+{
+    unsigned char       *dst = dst_void;
+    const unsigned char *src = src_void;
+
+    if (__m65832_bulk(M65832_SYS_BULK_COPY, (uintptr_t)dst, (uintptr_t)src, length))
+        return dst_void;
+    if (src < dst && dst < src + length)
+        __m65832_copy_bwd(dst, src, length);
+    else if (dst != src)
+        __m65832_copy_fwd(dst, src, length);
+    return dst_void;
+}
@@ -0,0 +1,52 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * memrchr for M65832, scanning a word at a time from the end
+ */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+void *
+memrchr(const void *src_void, int c, size_t length)
+{
+    const unsigned char *src = (const unsigned char *)src_void + length;
+    unsigned char        d = c;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    while ((uintptr_t)src & 3) {
+        if (!length--)
+            return NULL;
+        if (*--src == d)
+            return (void *)src;
+    }
+
+    if (length >= sizeof(m65832_word_t)) {
+        const m65832_word_t *w = (const m65832_word_t *)src;
+        uint32_t             mask = __m65832_splat(d);
+
+        while (length >= sizeof(m65832_word_t)) {
+            uint32_t flags;
+
+            w--;
+            flags = M65832_HAS_ZERO_EXACT(*w ^ mask);
+            if (flags)
+                return (unsigned char *)w + __m65832_last_byte(flags);
+            length -= sizeof(m65832_word_t);
+        }
+        src = (const unsigned char *)w;
+    }
+#endif
+
+    while (length--) {
+        if (*--src == d)
+            return (void *)src;
+    }
+
+    return NULL;
+}
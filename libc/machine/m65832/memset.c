@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * memset for M65832
+ *
+ * Short fills use a byte loop. Longer ones align the destination and
+ * then store the replicated pattern 32 bytes per iteration using
+ * 32-bit accumulator stores. Very large fills can go to the host, see
+ * m65832_bulk.h.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "m65832_bulk.h"
+
+#undef memset
+
+#define MEMSET_TINY 8
+#define MEMSET_BULK 32
+
+typedef uint32_t __attribute__((__may_alias__)) m65832_word_t;
+
+void * __no_builtin
+memset(void *m, int c, size_t n)
+{
+    unsigned char *s = m;
+    unsigned char  d = (unsigned char)c;
+
+    if (__m65832_bulk(M65832_SYS_BULK_FILL, (uintptr_t)m, d, n))
+        return m;
+    if (n >= MEMSET_TINY) {
+        while ((uintptr_t)s & 3) {
+            *s++ = d;
+            n--;
+        }
+
+        uint32_t pattern = d | ((uint32_t)d << 8);
+        pattern |= pattern << 16;
+        m65832_word_t *w = (m65832_word_t *)s;
+
+        while (n >= MEMSET_BULK) {
+            w[0] = pattern;
+            w[1] = pattern;
+            w[2] = pattern;
+            w[3] = pattern;
+            w[4] = pattern;
+            w[5] = pattern;
+            w[6] = pattern;
+            w[7] = pattern;
+            w += 8;
+            n -= MEMSET_BULK;
+        }
+        while (n >= sizeof(m65832_word_t)) {
+            *w++ = pattern;
+            n -= sizeof(m65832_word_t);
+        }
+        s = (unsigned char *)w;
+    }
+    while (n--)
+        *s++ = d;
+    return m;
+}
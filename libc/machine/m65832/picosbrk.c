@@ -0,0 +1,192 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * sbrk over a list of heap regions, see <machine/heap.h>.
+ *
+ * Each region has its own break. sbrk keeps extending the region it
+ * used last so that malloc can grow its top chunk in place, and moves
+ * to the first region with room, fast ones before slow ones, when that
+ * one is full. Memory left at the end of a region is still handed out
+ * to later requests which fit. malloc copes with the jumps as it does
+ * with any other discontinuous sbrk. Shrinking only applies to the
+ * region used last.
+ *
+ * __m65832_malloc_fast takes a block straight from sbrk with only fast
+ * regions allowed, leaving the region malloc grows into unchanged. If
+ * no fast region has room the restriction is dropped and the block
+ * comes from malloc.
+ */
+
+#include "../../stdlib/local-malloc.h"
+#include <machine/heap.h>
+
+#if __INTERNAL_HEAP > 0
+char __heap_start[__INTERNAL_HEAP] __aligned(sizeof(double));
+#define __heap_end (&__heap_start[__INTERNAL_HEAP])
+#else
+extern char __heap_start[];
+extern char __heap_end[];
+#endif
+
+extern char __heap_ext_start[] __weak;
+extern char __heap_ext_end[] __weak;
+
+struct heap_region {
+    char    *start;
+    char    *brk;
+    char    *end;
+    unsigned flags;
+};
+
+static struct heap_region heap_regions[M65832_HEAP_REGIONS];
+static unsigned           heap_nregions;
+static unsigned           heap_cur;
+
+/* Attributes sbrk requires of a region, set by __m65832_malloc_fast */
+static unsigned heap_need;
+
+static int
+heap_insert(char *start, char *end, unsigned flags)
+{
+    unsigned i;
+
+    start = (char *)__align_up((uintptr_t)start, sizeof(double));
+
+    /* Skip any part already served by another region */
+    for (i = 0; i < heap_nregions && start < end; i++) {
+        struct heap_region *r = &heap_regions[i];
+
+        if (start < r->end && end > r->start) {
+            if (start >= r->start)
+                start = r->end;
+            else
+                end = r->start;
+        }
+    }
+    if (heap_nregions == M65832_HEAP_REGIONS || start >= end)
+        return -1;
+
+    /* Keep fast regions ahead of slow ones, in the order added */
+    for (i = heap_nregions; i > 0 && (flags & ~heap_regions[i - 1].flags & M65832_HEAP_FAST); i--)
+        heap_regions[i] = heap_regions[i - 1];
+    heap_regions[i] = (struct heap_region) { start, start, end, flags };
+    if (i <= heap_cur && heap_nregions)
+        heap_cur++;
+    heap_nregions++;
+    return 0;
+}
+
+static void
+heap_init(void)
+{
+    if (heap_nregions)
+        return;
+    heap_insert(__heap_start, __heap_end, M65832_HEAP_FAST);
+    if (__heap_ext_start && __heap_ext_end)
+        heap_insert(__heap_ext_start, __heap_ext_end, M65832_HEAP_SLOW);
+}
+
+static bool
+heap_fits(struct heap_region *r, ptrdiff_t incr)
+{
+    return (r->flags & heap_need) == heap_need
+        && (size_t)((uintptr_t)r->end - (uintptr_t)r->brk) >= (size_t)incr;
+}
+
+int
+__m65832_heap_add(void *start, size_t size, unsigned flags)
+{
+    int ret;
+
+    __LIBC_LOCK();
+    heap_init();
+    ret = heap_insert(start, (char *)start + size, flags);
+    __LIBC_UNLOCK();
+    if (ret < 0)
+        errno = ENOMEM;
+    return ret;
+}
+
+void *
+sbrk(ptrdiff_t incr)
+{
+    struct heap_region *r;
+    unsigned            i;
+    void               *ret;
+
+    heap_init();
+    r = &heap_regions[heap_cur];
+    if (incr < 0) {
+        if ((size_t)((uintptr_t)r->brk - (uintptr_t)r->start) < (size_t)(-incr)) {
+            errno = ENOMEM;
+            return (void *)-1;
+        }
+    } else if (!heap_fits(r, incr)) {
+        for (i = 0; i < heap_nregions; i++) {
+            if (heap_fits(&heap_regions[i], incr))
+                break;
+        }
+        if (i == heap_nregions) {
+            heap_need = 0;
+            errno = ENOMEM;
+            return (void *)-1;
+        }
+        r = &heap_regions[i];
+        heap_cur = i;
+    }
+    ret = r->brk;
+    r->brk = (char *)((uintptr_t)r->brk + incr);
+    return ret;
+}
+
+void *
+__m65832_malloc_fast(size_t size)
+{
+    unsigned cur;
+    void    *p;
+
+    __LIBC_LOCK();
+    heap_init();
+    cur = heap_cur;
+    heap_need = M65832_HEAP_FAST;
+    p = __malloc_sbrk_block(size);
+    if (heap_need) {
+        heap_need = 0;
+        heap_cur = cur;
+    }
+    __LIBC_UNLOCK();
+    return p;
+}
@@ -0,0 +1,43 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * rawmemchr for M65832, scanning a word at a time
+ */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+void *
+rawmemchr(const void *src_void, int c)
+{
+    const unsigned char *src = (const unsigned char *)src_void;
+    unsigned char        d = c;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    const m65832_word_t *w;
+    uint32_t             mask, flags;
+
+    while ((uintptr_t)src & 3) {
+        if (*src == d)
+            return (void *)src;
+        src++;
+    }
+
+    /* Aligned reads never cross into an unmapped page */
+    mask = __m65832_splat(d);
+    w = (const m65832_word_t *)src;
+    while (!(flags = M65832_HAS_ZERO(*w ^ mask)))
+        w++;
+
+    return (unsigned char *)w + __m65832_first_byte(flags);
+#else
+    while (*src != d)
+        src++;
+    return (void *)src;
+#endif
+}
@@ -0,0 +1,222 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Batched system calls, see <machine/ring.h>.
+ *
+ * The batch TRAP takes an array of n requests and an array of n
+ * completions. It runs the requests in order, fills in a completion
+ * for each, -ECANCELED for those skipped after an M65832_SQE_STOP
+ * request, and returns how many it ran. Every slot of a ring is used
+ * by one request and then by its completion, with the same index, so
+ * queued requests plus unreaped completions never exceed the ring
+ * size.
+ */
+
+#include <machine/ring.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "m65832_syscall.h"
+
+#define RING_MASK (M65832_RING_ENTRIES - 1)
+
+/* Set once the emulator has said it has no batch TRAP */
+static bool batch_missing;
+
+static void
+batch_cancel(struct m65832_sqe *sqe, unsigned n, struct m65832_cqe *cqe, long res)
+{
+    unsigned i;
+
+    for (i = 0; i < n; i++) {
+        cqe[i].user = sqe[i].user;
+        cqe[i].res = res;
+    }
+}
+
+/* One TRAP per request, for emulators without the batch TRAP */
+static unsigned
+batch_loop(struct m65832_sqe *sqe, unsigned n, struct m65832_cqe *cqe)
+{
+    unsigned i;
+
+    for (i = 0; i < n; i++) {
+        struct m65832_sqe *s = &sqe[i];
+        long               res;
+
+        switch (s->op) {
+        case M65832_OP_NOP:
+            res = 0;
+            break;
+        case M65832_OP_READ:
+            res = __syscall3(M65832_SYS_READ, s->fd, (long)s->buf, s->arg);
+            break;
+        case M65832_OP_WRITE:
+            res = __syscall3(M65832_SYS_WRITE, s->fd, (long)s->buf, s->arg);
+            break;
+        case M65832_OP_LSEEK:
+            res = __syscall3(M65832_SYS_LSEEK, s->fd, s->arg, s->whence);
+            break;
+        default:
+            res = -EINVAL;
+            break;
+        }
+        cqe[i].user = s->user;
+        cqe[i].res = res;
+        if ((s->flags & M65832_SQE_STOP)
+            && (res < 0 || ((s->op == M65832_OP_READ || s->op == M65832_OP_WRITE) && res < s->arg))) {
+            i++;
+            batch_cancel(sqe + i, n - i, cqe + i, -ECANCELED);
+            return i;
+        }
+    }
+    return n;
+}
+
+unsigned
+__m65832_batch(struct m65832_sqe *sqe, unsigned n, struct m65832_cqe *cqe)
+{
+    long r;
+
+    if (!n)
+        return 0;
+    if (!batch_missing) {
+        r = __syscall3(M65832_SYS_BATCH, (long)sqe, (long)n, (long)cqe);
+        if (r >= 0)
+            return (unsigned)r;
+        if (r != -ENOSYS) {
+            batch_cancel(sqe, n, cqe, r);
+            return 0;
+        }
+        batch_missing = true;
+    }
+    return batch_loop(sqe, n, cqe);
+}
+
+void
+__m65832_ring_init(struct m65832_ring *ring)
+{
+    ring->sq_head = 0;
+    ring->sq_tail = 0;
+    ring->cq_head = 0;
+}
+
+static struct m65832_sqe *
+ring_get(struct m65832_ring *ring)
+{
+    if (ring->sq_tail - ring->cq_head == M65832_RING_ENTRIES) {
+        if (ring->sq_head != ring->sq_tail)
+            __m65832_ring_submit(ring);
+        /* Full of completions, the caller has to reap some */
+        if (ring->sq_tail - ring->cq_head == M65832_RING_ENTRIES) {
+            errno = EBUSY;
+            return NULL;
+        }
+    }
+    return &ring->sq[ring->sq_tail++ & RING_MASK];
+}
+
+static int
+ring_queue(struct m65832_ring *ring, int op, int fd, void *buf, long arg, int whence,
+           unsigned flags, void *user)
+{
+    struct m65832_sqe *s = ring_get(ring);
+
+    if (!s)
+        return -1;
+    s->op = (unsigned char)op;
+    s->flags = (unsigned char)flags;
+    s->whence = (short)whence;
+    s->fd = fd;
+    s->buf = buf;
+    s->arg = arg;
+    s->user = user;
+    return 0;
+}
+
+int
+__m65832_ring_read(struct m65832_ring *ring, int fd, void *buf, size_t len, unsigned flags,
+                   void *user)
+{
+    return ring_queue(ring, M65832_OP_READ, fd, buf, (long)len, 0, flags, user);
+}
+
+int
+__m65832_ring_write(struct m65832_ring *ring, int fd, const void *buf, size_t len,
+                    unsigned flags, void *user)
+{
+    return ring_queue(ring, M65832_OP_WRITE, fd, (void *)buf, (long)len, 0, flags, user);
+}
+
+int
+__m65832_ring_lseek(struct m65832_ring *ring, int fd, off_t offset, int whence, unsigned flags,
+                    void *user)
+{
+    return ring_queue(ring, M65832_OP_LSEEK, fd, NULL, (long)offset, whence, flags, user);
+}
+
+int
+__m65832_ring_submit(struct m65832_ring *ring)
+{
+    unsigned n = ring->sq_tail - ring->sq_head;
+    unsigned idx = ring->sq_head & RING_MASK;
+    unsigned first = M65832_RING_ENTRIES - idx;
+    unsigned ran;
+
+    if (!n)
+        return 0;
+    /* The queue may wrap around the end of the arrays */
+    if (first > n)
+        first = n;
+    ran = __m65832_batch(&ring->sq[idx], first, &ring->cq[idx]);
+    if (first < n) {
+        if (ran == first)
+            ran += __m65832_batch(ring->sq, n - first, ring->cq);
+        else
+            batch_cancel(ring->sq, n - first, ring->cq, -ECANCELED);
+    }
+    ring->sq_head = ring->sq_tail;
+    return (int)ran;
+}
+
+int
+__m65832_ring_reap(struct m65832_ring *ring, struct m65832_cqe *cqe)
+{
+    if (ring->cq_head == ring->sq_head)
+        return 0;
+    *cqe = ring->cq[ring->cq_head++ & RING_MASK];
+    return 1;
+}
@@ -0,0 +1,173 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Functions exported by the m65832 ROM libc, see <machine/romlib.h>
+ *
+ * The position of an entry is its index in the ROM table, which
+ * images are built against: only ever add entries at the end. Each
+ * list includes this file after defining
+ *
+ *   ROMLIB(ret, name, (params), (args))
+ *   ROMLIB_VOID(name, (params), (args))
+ *   ROMLIB_NORETURN(name, (params), (args))
+ *
+ * Variadic functions are reached through their v variants, for which
+ * romlib_stubs.c has the stubs.
+ */
+
+/* Startup */
+ROMLIB(int *, __m65832_errno, (void), ())
+ROMLIB(int, __m65832_heap_add, (void *start, size_t size, unsigned flags), (start, size, flags))
+ROMLIB(int, atexit, (void (*fn)(void)), (fn))
+ROMLIB_NORETURN(exit, (int status), (status))
+ROMLIB_NORETURN(_Exit, (int status), (status))
+ROMLIB_NORETURN(abort, (void), ())
+ROMLIB(FILE *, __m65832_romlib_file, (int fd), (fd))
+
+/* stdio */
+ROMLIB(FILE *, fopen, (const char *path, const char *mode), (path, mode))
+ROMLIB(FILE *, fdopen, (int fd, const char *mode), (fd, mode))
+ROMLIB(int, fclose, (FILE *f), (f))
+ROMLIB(int, fflush, (FILE *f), (f))
+ROMLIB(size_t, fread, (void *buf, size_t size, size_t n, FILE *f), (buf, size, n, f))
+ROMLIB(size_t, fwrite, (const void *buf, size_t size, size_t n, FILE *f), (buf, size, n, f))
+ROMLIB(int, fgetc, (FILE *f), (f))
+ROMLIB(int, fputc, (int c, FILE *f), (c, f))
+ROMLIB(int, getc, (FILE *f), (f))
+ROMLIB(int, putc, (int c, FILE *f), (c, f))
+ROMLIB(int, getchar, (void), ())
+ROMLIB(int, putchar, (int c), (c))
+ROMLIB(char *, fgets, (char *s, int n, FILE *f), (s, n, f))
+ROMLIB(int, fputs, (const char *s, FILE *f), (s, f))
+ROMLIB(int, puts, (const char *s), (s))
+ROMLIB(int, ungetc, (int c, FILE *f), (c, f))
+ROMLIB(int, fseek, (FILE *f, long off, int whence), (f, off, whence))
+ROMLIB(long, ftell, (FILE *f), (f))
+ROMLIB_VOID(rewind, (FILE *f), (f))
+ROMLIB(int, feof, (FILE *f), (f))
+ROMLIB(int, ferror, (FILE *f), (f))
+ROMLIB_VOID(clearerr, (FILE *f), (f))
+ROMLIB(int, setvbuf, (FILE *f, char *buf, int mode, size_t size), (f, buf, mode, size))
+ROMLIB(int, vprintf, (const char *fmt, va_list ap), (fmt, ap))
+ROMLIB(int, vfprintf, (FILE *f, const char *fmt, va_list ap), (f, fmt, ap))
+ROMLIB(int, vsprintf, (char *s, const char *fmt, va_list ap), (s, fmt, ap))
+ROMLIB(int, vsnprintf, (char *s, size_t n, const char *fmt, va_list ap), (s, n, fmt, ap))
+ROMLIB(int, vscanf, (const char *fmt, va_list ap), (fmt, ap))
+ROMLIB(int, vfscanf, (FILE *f, const char *fmt, va_list ap), (f, fmt, ap))
+ROMLIB(int, vsscanf, (const char *s, const char *fmt, va_list ap), (s, fmt, ap))
+ROMLIB_VOID(perror, (const char *s), (s))
+ROMLIB(int, remove, (const char *path), (path))
+ROMLIB(int, rename, (const char *from, const char *to), (from, to))
+ROMLIB(FILE *, tmpfile, (void), ())
+
+/* stdlib */
+ROMLIB(void *, malloc, (size_t size), (size))
+ROMLIB_VOID(free, (void *p), (p))
+ROMLIB(void *, calloc, (size_t n, size_t size), (n, size))
+ROMLIB(void *, realloc, (void *p, size_t size), (p, size))
+ROMLIB(void *, aligned_alloc, (size_t align, size_t size), (align, size))
+ROMLIB(int, atoi, (const char *s), (s))
+ROMLIB(long, atol, (const char *s), (s))
+ROMLIB(long, strtol, (const char *s, char **end, int base), (s, end, base))
+ROMLIB(unsigned long, strtoul, (const char *s, char **end, int base), (s, end, base))
+ROMLIB(long long, strtoll, (const char *s, char **end, int base), (s, end, base))
+ROMLIB(unsigned long long, strtoull, (const char *s, char **end, int base), (s, end, base))
+ROMLIB(double, strtod, (const char *s, char **end), (s, end))
+ROMLIB(float, strtof, (const char *s, char **end), (s, end))
+ROMLIB_VOID(qsort, (void *base, size_t n, size_t size, int (*cmp)(const void *, const void *)),
+            (base, n, size, cmp))
+ROMLIB(void *, bsearch,
+       (const void *key, const void *base, size_t n, size_t size,
+        int (*cmp)(const void *, const void *)),
+       (key, base, n, size, cmp))
+ROMLIB(int, rand, (void), ())
+ROMLIB_VOID(srand, (unsigned seed), (seed))
+ROMLIB(char *, getenv, (const char *name), (name))
+
+/* string */
+ROMLIB(void *, memcpy, (void *d, const void *s, size_t n), (d, s, n))
+ROMLIB(void *, memmove, (void *d, const void *s, size_t n), (d, s, n))
+ROMLIB(void *, memset, (void *d, int c, size_t n), (d, c, n))
+ROMLIB(int, memcmp, (const void *a, const void *b, size_t n), (a, b, n))
+ROMLIB(void *, memchr, (const void *s, int c, size_t n), (s, c, n))
+ROMLIB(size_t, strlen, (const char *s), (s))
+ROMLIB(size_t, strnlen, (const char *s, size_t n), (s, n))
+ROMLIB(int, strcmp, (const char *a, const char *b), (a, b))
+ROMLIB(int, strncmp, (const char *a, const char *b, size_t n), (a, b, n))
+ROMLIB(char *, strcpy, (char *d, const char *s), (d, s))
+ROMLIB(char *, strncpy, (char *d, const char *s, size_t n), (d, s, n))
+ROMLIB(char *, strcat, (char *d, const char *s), (d, s))
+ROMLIB(char *, strncat, (char *d, const char *s, size_t n), (d, s, n))
+ROMLIB(char *, strchr, (const char *s, int c), (s, c))
+ROMLIB(char *, strrchr, (const char *s, int c), (s, c))
+ROMLIB(char *, strstr, (const char *s, const char *t), (s, t))
+ROMLIB(char *, strdup, (const char *s), (s))
+ROMLIB(char *, strndup, (const char *s, size_t n), (s, n))
+ROMLIB(char *, strerror, (int e), (e))
+ROMLIB(char *, strtok, (char *s, const char *delim), (s, delim))
+ROMLIB(size_t, strspn, (const char *s, const char *set), (s, set))
+ROMLIB(size_t, strcspn, (const char *s, const char *set), (s, set))
+ROMLIB(char *, strpbrk, (const char *s, const char *set), (s, set))
+ROMLIB(int, strcasecmp, (const char *a, const char *b), (a, b))
+ROMLIB(int, strncasecmp, (const char *a, const char *b, size_t n), (a, b, n))
+
+/* math */
+ROMLIB(double, sin, (double x), (x))
+ROMLIB(double, cos, (double x), (x))
+ROMLIB(double, tan, (double x), (x))
+ROMLIB(double, asin, (double x), (x))
+ROMLIB(double, acos, (double x), (x))
+ROMLIB(double, atan, (double x), (x))
+ROMLIB(double, atan2, (double y, double x), (y, x))
+ROMLIB(double, sinh, (double x), (x))
+ROMLIB(double, cosh, (double x), (x))
+ROMLIB(double, tanh, (double x), (x))
+ROMLIB(double, exp, (double x), (x))
+ROMLIB(double, exp2, (double x), (x))
+ROMLIB(double, log, (double x), (x))
+ROMLIB(double, log2, (double x), (x))
+ROMLIB(double, log10, (double x), (x))
+ROMLIB(double, pow, (double x, double y), (x, y))
+ROMLIB(double, sqrt, (double x), (x))
+ROMLIB(double, cbrt, (double x), (x))
+ROMLIB(double, hypot, (double x, double y), (x, y))
+ROMLIB(double, floor, (double x), (x))
+ROMLIB(double, ceil, (double x), (x))
+ROMLIB(double, round, (double x), (x))
+ROMLIB(double, trunc, (double x), (x))
+ROMLIB(double, fmod, (double x, double y), (x, y))
+ROMLIB(double, fabs, (double x), (x))
+ROMLIB(double, ldexp, (double x, int e), (x, e))
+ROMLIB(double, frexp, (double x, int *e), (x, e))
+ROMLIB(double, modf, (double x, double *i), (x, i))
+ROMLIB(float, sinf, (float x), (x))
+ROMLIB(float, cosf, (float x), (x))
+ROMLIB(float, tanf, (float x), (x))
+ROMLIB(float, atan2f, (float y, float x), (y, x))
+ROMLIB(float, expf, (float x), (x))
+ROMLIB(float, logf, (float x), (x))
+ROMLIB(float, powf, (float x, float y), (x, y))
+ROMLIB(float, sqrtf, (float x), (x))
+ROMLIB(float, floorf, (float x), (x))
+ROMLIB(float, ceilf, (float x), (x))
+ROMLIB(float, roundf, (float x), (x))
+ROMLIB(float, fmodf, (float x, float y), (x, y))
+ROMLIB(float, fabsf, (float x), (x))
+
+/* time and system */
+ROMLIB(time_t, time, (time_t *t), (t))
+ROMLIB(int, clock_gettime, (clockid_t id, struct timespec *ts), (id, ts))
+ROMLIB(struct tm *, gmtime_r, (const time_t *t, struct tm *tm), (t, tm))
+ROMLIB(struct tm *, localtime_r, (const time_t *t, struct tm *tm), (t, tm))
+ROMLIB(time_t, mktime, (struct tm *tm), (tm))
+ROMLIB(size_t, strftime, (char *s, size_t n, const char *fmt, const struct tm *tm), (s, n, fmt, tm))
+ROMLIB(int, nanosleep, (const struct timespec *req, struct timespec *rem), (req, rem))
+ROMLIB(int, usleep, (useconds_t us), (us))
+ROMLIB(unsigned, sleep, (unsigned s), (s))
+ROMLIB(ssize_t, read, (int fd, void *buf, size_t n), (fd, buf, n))
+ROMLIB(ssize_t, write, (int fd, const void *buf, size_t n), (fd, buf, n))
+ROMLIB(int, close, (int fd), (fd))
+ROMLIB(off_t, lseek, (int fd, off_t off, int whence), (fd, off, whence))
+ROMLIB(int, isatty, (int fd), (fd))
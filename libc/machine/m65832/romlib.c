@@ -0,0 +1,109 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * ROM side of the shared m65832 libc, see <machine/romlib.h>
+ *
+ * The header goes in .text.init.enter, which picolibc.ld puts at the
+ * start of flash, so the ROM's origin is the address images link
+ * against. Linking with -u __m65832_romlib pulls in the table and
+ * with it every exported function.
+ */
+
+#define _DEFAULT_SOURCE
+#include <picolibc.h>
+
+#ifdef __M65832_ROMLIB
+
+#include <errno.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <picobss.h>
+#include <machine/heap.h>
+#include <machine/romlib.h>
+#include "m65832_irq.h"
+
+extern char __data_start[], __data_end[], __data_source[], __bss_end[];
+
+/* Whose state the window holds; it must not be swapped with it */
+static struct __m65832_romlib_image *romlib_owner __noinit;
+
+static int romlib_errno;
+
+int *
+__m65832_errno(void)
+{
+    return &romlib_errno;
+}
+
+FILE *
+__m65832_romlib_file(int fd)
+{
+    switch (fd) {
+    case 0:
+        return stdin;
+    case 1:
+        return stdout;
+    case 2:
+        return stderr;
+    }
+    return NULL;
+}
+
+/* romlib_owner is garbage until the first image enters */
+static bool
+romlib_valid(struct __m65832_romlib_image *image)
+{
+    return image && image->magic == M65832_ROMLIB_IMAGE && image->self == image;
+}
+
+static void
+romlib_enter(struct __m65832_romlib_image *image)
+{
+    size_t   size = (size_t)(__bss_end - __data_start);
+    unsigned state = __m65832_critical_enter();
+
+    if (romlib_owner != image) {
+        if (romlib_valid(romlib_owner))
+            memcpy(romlib_owner->save, __data_start, size);
+        if (image->started) {
+            memcpy(__data_start, image->save, size);
+        } else {
+            memcpy(__data_start, __data_source, (size_t)(__data_end - __data_start));
+            memset(__data_end, 0, (size_t)(__bss_end - __data_end));
+            image->started = 1;
+        }
+        romlib_owner = image;
+    }
+    __m65832_critical_exit(state);
+}
+
+static void (*const romlib_table[])(void) = {
+#define ROMLIB(ret, name, params, args)     (void (*)(void))(name),
+#define ROMLIB_VOID(name, params, args)     (void (*)(void))(name),
+#define ROMLIB_NORETURN(name, params, args) (void (*)(void))(name),
+#include "romlib-exports.h"
+};
+
+const struct __m65832_romlib __m65832_romlib __section(".text.init.enter") __used = {
+    .magic = M65832_ROMLIB_MAGIC,
+    .version = M65832_ROMLIB_VERSION,
+    .count = sizeof(romlib_table) / sizeof(romlib_table[0]),
+    .owner = &romlib_owner,
+    .enter = romlib_enter,
+    .window = __data_start,
+    .data_end = __data_end,
+    .window_end = __bss_end,
+    .data_source = __data_source,
+    .table = romlib_table,
+};
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * stdin, stdout and stderr of an image using the shared m65832 libc
+ *
+ * <stdio.h> declares them as constant pointers, but their values are
+ * only known once __m65832_romlib_init has asked the ROM, before any
+ * constructor runs. They are defined here, away from that declaration,
+ * so they can be set.
+ */
+
+#include <picolibc.h>
+
+#ifdef __M65832_ROMLIB
+
+struct __file;
+
+struct __file *stdin, *stdout, *stderr;
+
+void __m65832_romlib_set_stdio(struct __file *(*file)(int fd));
+
+void
+__m65832_romlib_set_stdio(struct __file *(*file)(int fd))
+{
+    stdin = file(0);
+    stdout = file(1);
+    stderr = file(2);
+}
+
+#endif
@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Image side of the shared m65832 libc, see <machine/romlib.h>
+ *
+ * Each stub puts this image's libc state in the window, unless it is
+ * already there, and calls the ROM function through the table with
+ * its own type, so arguments and results pass exactly as they would
+ * in a direct call.
+ */
+
+#define _DEFAULT_SOURCE
+#include <picolibc.h>
+
+#ifdef __M65832_ROMLIB
+
+#include <errno.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <machine/heap.h>
+#include <machine/romlib.h>
+#include "m65832_syscall.h"
+
+enum {
+#define ROMLIB(ret, name, params, args)     ROMLIB_ID_##name,
+#define ROMLIB_VOID(name, params, args)     ROMLIB_ID_##name,
+#define ROMLIB_NORETURN(name, params, args) ROMLIB_ID_##name,
+#include "romlib-exports.h"
+#undef ROMLIB
+#undef ROMLIB_VOID
+#undef ROMLIB_NORETURN
+    ROMLIB_COUNT
+};
+
+static struct __m65832_romlib_image romlib_image;
+
+static inline void
+romlib_enter(void)
+{
+    if (*__m65832_romlib.owner != &romlib_image)
+        __m65832_romlib.enter(&romlib_image);
+}
+
+#define ROMLIB_FN(name) ((__typeof__(&(name)))__m65832_romlib.table[ROMLIB_ID_##name])
+
+#define ROMLIB(ret, name, params, args) \
+    ret(name) params                    \
+    {                                   \
+        romlib_enter();                 \
+        return ROMLIB_FN(name) args;    \
+    }
+#define ROMLIB_VOID(name, params, args) \
+    void(name) params                   \
+    {                                   \
+        romlib_enter();                 \
+        ROMLIB_FN(name) args;           \
+    }
+#define ROMLIB_NORETURN(name, params, args) \
+    void(name) params                       \
+    {                                       \
+        romlib_enter();                     \
+        ROMLIB_FN(name) args;               \
+        __builtin_unreachable();            \
+    }
+#include "romlib-exports.h"
+
+int
+printf(const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vprintf(fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+int
+fprintf(FILE *f, const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vfprintf(f, fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+int
+sprintf(char *s, const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vsprintf(s, fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+int
+snprintf(char *s, size_t n, const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vsnprintf(s, n, fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+int
+scanf(const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vscanf(fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+int
+fscanf(FILE *f, const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vfscanf(f, fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+int
+sscanf(const char *s, const char *fmt, ...)
+{
+    va_list ap;
+    int     ret;
+
+    va_start(ap, fmt);
+    ret = vsscanf(s, fmt, ap);
+    va_end(ap);
+    return ret;
+}
+
+extern char __heap_start[], __heap_end[];
+void __m65832_romlib_set_stdio(struct __file *(*file)(int fd));
+
+#ifdef __INIT_FINI_ARRAY
+extern void __libc_fini_array(void);
+#endif
+
+static __noreturn void
+romlib_fail(void)
+{
+    for (;;)
+        __syscall1(M65832_SYS_EXIT, 127);
+}
+
+void
+__m65832_romlib_init(void)
+{
+    const struct __m65832_romlib *rom = &__m65832_romlib;
+    size_t                        size;
+    char                         *save;
+
+    /* A ROM without every entry this image was built with will not do */
+    if (rom->magic != M65832_ROMLIB_MAGIC || rom->version != M65832_ROMLIB_VERSION
+        || rom->count < ROMLIB_COUNT)
+        romlib_fail();
+
+    /* The save area comes off the bottom of the heap */
+    size = (size_t)(rom->window_end - rom->window);
+    save = (char *)(((uintptr_t)__heap_start + 7) & ~(uintptr_t)7);
+    if (size > (size_t)(__heap_end - save))
+        romlib_fail();
+    romlib_image = (struct __m65832_romlib_image) {
+        .magic = M65832_ROMLIB_IMAGE,
+        .self = &romlib_image,
+        .save = save,
+    };
+
+    __m65832_heap_add(save + size, (size_t)(__heap_end - save) - size, M65832_HEAP_FAST);
+    __m65832_romlib_set_stdio(__m65832_romlib_file);
+#ifdef __INIT_FINI_ARRAY
+    atexit(__libc_fini_array);
+#endif
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * scandir and alphasort for M65832, on top of readdir. Each entry is
+ * allocated just large enough for its name.
+ */
+
+#define _DEFAULT_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+int
+scandir(const char *path, struct dirent ***list, int (*filter)(const struct dirent *),
+        int (*compar)(const struct dirent **, const struct dirent **))
+{
+    DIR           *dir = opendir(path);
+    struct dirent *ent, *copy, **names = NULL, **grow;
+    size_t         n = 0, cap = 0, size;
+    int            save = errno;
+
+    if (!dir)
+        return -1;
+
+    errno = 0;
+    while ((ent = readdir(dir)) != NULL) {
+        if (filter && !filter(ent))
+            continue;
+        if (n == cap) {
+            cap = cap ? cap * 2 : 16;
+            grow = reallocarray(names, cap, sizeof(*names));
+            if (!grow)
+                break;
+            names = grow;
+        }
+        size = offsetof(struct dirent, d_name) + strlen(ent->d_name) + 1;
+        copy = malloc(size);
+        if (!copy)
+            break;
+        memcpy(copy, ent, size);
+        copy->d_reclen = (unsigned short)size;
+        names[n++] = copy;
+    }
+    closedir(dir);
+
+    /* readdir, filter or an allocation failed */
+    if (errno) {
+        while (n)
+            free(names[--n]);
+        free(names);
+        return -1;
+    }
+    errno = save;
+
+    if (compar)
+        qsort(names, n, sizeof(*names), (int (*)(const void *, const void *))compar);
+    *list = names;
+    return (int)n;
+}
+
+int
+alphasort(const struct dirent **a, const struct dirent **b)
+{
+    return strcoll((*a)->d_name, (*b)->d_name);
+}
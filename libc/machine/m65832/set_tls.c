@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#include <picotls.h>
+
+#ifdef __THREAD_LOCAL_STORAGE_API
+
+#include "tls-local.h"
+
+void
+_set_tls(void *tls)
+{
+    __tls = tls;
+}
+
+#endif
@@ -1,58 +0,0 @@
-/*
- * SPDX-License-Identifier: BSD-3-Clause
- * Copyright © 2026 M65832 Project
- *
- * setjmp/longjmp for M65832
- *
- * This is a minimal implementation that saves/restores just enough
- * state to make simple setjmp/longjmp work. For full conformance,
- * this should be written in assembly.
- */
-
-#include <setjmp.h>
-#include <stdint.h>
-#include <stdlib.h>
-#include <unistd.h>
-
-/* jmp_buf layout:
- * [0] = return address
- * [1] = stack pointer
- * [2] = frame pointer (B)
- */
-
-int setjmp(jmp_buf env)
-{
-    uint32_t *buf = (uint32_t *)env;
-    
-    /* This stub returns 0 on first call.
-     * A proper implementation would save PC, SP, B, and callee-saved regs.
-     * For now, we just mark the buffer so longjmp knows it was set.
-     */
-    buf[0] = 0xDEADBEEF;  /* Magic marker */
-    buf[1] = 0;
-    buf[2] = 0;
-    
-    return 0;
-}
-
-void __attribute__((noreturn)) longjmp(jmp_buf env, int val)
-{
-    uint32_t *buf = (uint32_t *)env;
-    
-    /* Check if setjmp was called */
-    if (buf[0] != 0xDEADBEEF) {
-        /* Invalid jmp_buf - undefined behavior, just exit */
-        _exit(1);
-    }
-    
-    /* This stub just exits since we can't properly restore state.
-     * A proper implementation would restore all saved state and
-     * return to the setjmp call site with val (or 1 if val == 0).
-     */
-    (void)val;
-    
-    /* For now, just exit - tests will fail but at least won't crash */
-    _exit(val ? val : 1);
-    
-    __builtin_unreachable();
-}
@@ -0,0 +1,148 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * nanosleep, clock_nanosleep, usleep and sleep for M65832
+ *
+ * A sleep arms the TIMER TRAP with the monotonic deadline and halts
+ * in WAI with interrupts masked: the timer interrupt resumes the core
+ * without being taken, and the TRAP that disarms the timer clears it.
+ * Other interrupts stay pending until the sleep ends. An emulator can
+ * skip the clock straight to the deadline while the core waits, so
+ * tests full of timeouts do not spend real time in them.
+ *
+ * Emulators without the TIMER TRAP get the Linux nanosleep call
+ * instead, and those without that a loop reading the clock.
+ */
+
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include "m65832_irq.h"
+#include "m65832_syscall.h"
+
+#define NSEC_PER_SEC 1000000000LL
+
+/* struct timespec of the Linux i386 nanosleep call */
+struct m65832_timespec32 {
+    long tv_sec;
+    long tv_nsec;
+};
+
+static bool sleep_no_timer, sleep_no_nanosleep;
+
+static int64_t
+sleep_now(clockid_t clock_id)
+{
+    struct timespec ts;
+
+    if (clock_gettime(clock_id, &ts) < 0)
+        return -1;
+    return (int64_t)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+/* Sleep until the monotonic clock reaches deadline */
+static void
+sleep_until(int64_t deadline)
+{
+    struct m65832_timespec32 ts;
+    unsigned                 state;
+    int64_t                  now, rel;
+    long                     r;
+
+    if (!sleep_no_timer) {
+        state = __m65832_critical_enter();
+        r = __syscall2(M65832_SYS_TIMER, (long)(uint32_t)deadline, (long)(deadline >> 32));
+        if (r == 0) {
+            while (sleep_now(CLOCK_MONOTONIC) < deadline)
+                __m65832_wait_irq();
+            __syscall2(M65832_SYS_TIMER, 0, 0);
+        }
+        __m65832_critical_exit(state);
+        if (r == 0)
+            return;
+        if (r == -ENOSYS)
+            sleep_no_timer = true;
+    }
+
+    while ((now = sleep_now(CLOCK_MONOTONIC)) >= 0 && now < deadline) {
+        if (sleep_no_nanosleep)
+            continue;
+        rel = deadline - now;
+        ts.tv_sec = (long)(rel / NSEC_PER_SEC);
+        ts.tv_nsec = (long)(rel % NSEC_PER_SEC);
+        if (__syscall2(M65832_SYS_NANOSLEEP, (long)&ts, 0) == -ENOSYS)
+            sleep_no_nanosleep = true;
+    }
+}
+
+static bool
+sleep_valid(const struct timespec *ts)
+{
+    return ts->tv_sec >= 0 && ts->tv_nsec >= 0 && ts->tv_nsec < NSEC_PER_SEC;
+}
+
+__attribute__((weak)) int
+clock_nanosleep(clockid_t clock_id, int flags, const struct timespec *rqtp, struct timespec *rmtp)
+{
+    int64_t now, req;
+
+    if ((clock_id != CLOCK_MONOTONIC && clock_id != CLOCK_REALTIME) || !sleep_valid(rqtp))
+        return EINVAL;
+    now = sleep_now(CLOCK_MONOTONIC);
+    if (now < 0)
+        return errno;
+    req = (int64_t)rqtp->tv_sec * NSEC_PER_SEC + rqtp->tv_nsec;
+    if (flags & TIMER_ABSTIME) {
+        /* Turn the deadline into a monotonic one */
+        int64_t base = clock_id == CLOCK_REALTIME ? sleep_now(CLOCK_REALTIME) : now;
+
+        if (base < 0)
+            return errno;
+        req -= base;
+    } else if (rmtp) {
+        /* Nothing can interrupt the sleep */
+        rmtp->tv_sec = 0;
+        rmtp->tv_nsec = 0;
+    }
+    if (req > 0)
+        sleep_until(now + req);
+    return 0;
+}
+
+__attribute__((weak)) int
+nanosleep(const struct timespec *rqtp, struct timespec *rmtp)
+{
+    int r = clock_nanosleep(CLOCK_MONOTONIC, 0, rqtp, rmtp);
+
+    if (r) {
+        errno = r;
+        return -1;
+    }
+    return 0;
+}
+
+__attribute__((weak)) int
+usleep(useconds_t useconds)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(useconds / 1000000);
+    ts.tv_nsec = (long)(useconds % 1000000) * 1000;
+    return nanosleep(&ts, NULL);
+}
+
+__attribute__((weak)) unsigned
+sleep(unsigned seconds)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = 0;
+    nanosleep(&ts, NULL);
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bit counting and byte swapping kernels for <stdbit.h> on M65832
+ *
+ * The compiler turns __builtin_clz, __builtin_ctz and
+ * __builtin_popcount into library loops that shift one bit per step,
+ * as M65832 has no multi-bit shifts. Bytes, on the other hand, are
+ * cheap to pick out of a word in memory, so these look at the value a
+ * byte at a time: clz and ctz find the first non-zero byte from the
+ * top or bottom and finish with a 256-entry table, popcount adds four
+ * table entries. Byte swaps store the bytes back in the other order,
+ * as XBA does for the two halves of the accumulator, instead of
+ * shifting and masking.
+ *
+ * A zero value has all of its bits counted as leading or trailing
+ * zeros.
+ */
+
+#include <stdbit.h>
+#include <stdint.h>
+
+union m65832_word32 {
+    uint32_t w;
+    uint8_t  b[4];
+};
+
+union m65832_word64 {
+    uint64_t w;
+    uint32_t h[2];
+    uint8_t  b[8];
+};
+
+static const uint8_t clz8[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ctz8[256] = {
+    8, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    7, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    6, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    5, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
+};
+
+static const uint8_t popcount8[256] = {
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8,
+};
+
+unsigned
+__m65832_clz32(uint32_t x)
+{
+    union m65832_word32 u = { .w = x };
+
+    if (u.b[3])
+        return clz8[u.b[3]];
+    if (u.b[2])
+        return 8 + clz8[u.b[2]];
+    if (u.b[1])
+        return 16 + clz8[u.b[1]];
+    return 24 + clz8[u.b[0]];
+}
+
+unsigned
+__m65832_clz64(uint64_t x)
+{
+    union m65832_word64 u = { .w = x };
+
+    if (u.h[1])
+        return __m65832_clz32(u.h[1]);
+    return 32 + __m65832_clz32(u.h[0]);
+}
+
+unsigned
+__m65832_ctz32(uint32_t x)
+{
+    union m65832_word32 u = { .w = x };
+
+    if (u.b[0])
+        return ctz8[u.b[0]];
+    if (u.b[1])
+        return 8 + ctz8[u.b[1]];
+    if (u.b[2])
+        return 16 + ctz8[u.b[2]];
+    return 24 + ctz8[u.b[3]];
+}
+
+unsigned
+__m65832_ctz64(uint64_t x)
+{
+    union m65832_word64 u = { .w = x };
+
+    if (u.h[0])
+        return __m65832_ctz32(u.h[0]);
+    return 32 + __m65832_ctz32(u.h[1]);
+}
+
+unsigned
+__m65832_popcount32(uint32_t x)
+{
+    union m65832_word32 u = { .w = x };
+
+    return popcount8[u.b[0]] + popcount8[u.b[1]] + popcount8[u.b[2]] + popcount8[u.b[3]];
+}
+
+unsigned
+__m65832_popcount64(uint64_t x)
+{
+    union m65832_word64 u = { .w = x };
+
+    return __m65832_popcount32(u.h[0]) + __m65832_popcount32(u.h[1]);
+}
+
+uint16_t
+__m65832_bswap16(uint16_t x)
+{
+    union {
+        uint16_t w;
+        uint8_t  b[2];
+    } u = { .w = x }, r;
+
+    r.b[0] = u.b[1];
+    r.b[1] = u.b[0];
+    return r.w;
+}
+
+uint32_t
+__m65832_bswap32(uint32_t x)
+{
+    union m65832_word32 u = { .w = x }, r;
+
+    r.b[0] = u.b[3];
+    r.b[1] = u.b[2];
+    r.b[2] = u.b[1];
+    r.b[3] = u.b[0];
+    return r.w;
+}
+
+uint64_t
+__m65832_bswap64(uint64_t x)
+{
+    union m65832_word64 u = { .w = x }, r;
+
+    r.h[0] = __m65832_bswap32(u.h[1]);
+    r.h[1] = __m65832_bswap32(u.h[0]);
+    return r.w;
+}
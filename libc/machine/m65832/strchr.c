@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strchr for M65832, scanning a word at a time for either the
+ * target byte or the terminating null
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+char *
+strchr(const char *s1, int i)
+{
+    const unsigned char *s = (const unsigned char *)s1;
+    unsigned char        c = i;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    const m65832_word_t *w;
+    uint32_t             mask, flags;
+
+    while ((uintptr_t)s & 3) {
+        if (*s == c)
+            return (char *)s;
+        if (!*s)
+            return NULL;
+        s++;
+    }
+
+    mask = __m65832_splat(c);
+    w = (const m65832_word_t *)s;
+    for (;;) {
+        uint32_t x = *w;
+        flags = M65832_HAS_ZERO(x) | M65832_HAS_ZERO(x ^ mask);
+        if (flags)
+            break;
+        w++;
+    }
+
+    /* The first flagged byte is either c or the terminator */
+    s = (const unsigned char *)w + __m65832_first_byte(flags);
+    if (*s == c)
+        return (char *)s;
+    return NULL;
+#else
+    while (*s && *s != c)
+        s++;
+    if (*s == c)
+        return (char *)s;
+    return NULL;
+#endif
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strcmp for M65832
+ *
+ * When both strings have the same alignment modulo four, compare
+ * leading bytes until they are word aligned and then compare a word
+ * at a time, stopping at the first differing word or the first word
+ * holding the terminator. The generic version only takes the word
+ * path when both strings start out aligned.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+int
+strcmp(const char *s1, const char *s2)
+{
+#if ((defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)) && !defined(__FAST_STRCMP)) \
+    || defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    while (*s1 != '\0' && *s1 == *s2) {
+        s1++;
+        s2++;
+    }
+
+    return (*(unsigned char *)s1) - (*(unsigned char *)s2);
+#else
+    if ((((uintptr_t)s1 ^ (uintptr_t)s2) & 3) == 0) {
+        const m65832_word_t *a1;
+        const m65832_word_t *a2;
+
+        while ((uintptr_t)s1 & 3) {
+            if (*s1 == '\0' || *s1 != *s2)
+                goto bytes;
+            s1++;
+            s2++;
+        }
+
+        a1 = (const m65832_word_t *)s1;
+        a2 = (const m65832_word_t *)s2;
+        while (*a1 == *a2) {
+            /* Equal words holding a null mean equal strings */
+            if (M65832_HAS_ZERO(*a1))
+                return 0;
+            a1++;
+            a2++;
+        }
+
+        /* The difference is somewhere in these four bytes */
+        s1 = (const char *)a1;
+        s2 = (const char *)a2;
+    }
+
+bytes:
+    while (*s1 != '\0' && *s1 == *s2) {
+        s1++;
+        s2++;
+    }
+    return (*(unsigned char *)s1) - (*(unsigned char *)s2);
+#endif
+}
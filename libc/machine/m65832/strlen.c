@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strlen for M65832, scanning a word at a time
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+size_t
+strlen(const char *str)
+{
+    const char *start = str;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    const m65832_word_t *w;
+    uint32_t             flags;
+
+    while ((uintptr_t)str & 3) {
+        if (!*str)
+            return str - start;
+        str++;
+    }
+
+    /* Aligned reads never cross into an unmapped page */
+    w = (const m65832_word_t *)str;
+    while (!(flags = M65832_HAS_ZERO(*w)))
+        w++;
+
+    return (const char *)w - start + __m65832_first_byte(flags);
+#else
+    while (*str)
+        str++;
+    return str - start;
+#endif
+}
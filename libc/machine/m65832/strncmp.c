@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strncmp for M65832
+ *
+ * As in strcmp, strings with the same alignment modulo 4 are compared
+ * a byte at a time until aligned and then a word at a time, stopping
+ * at the first differing word, the first word holding the terminator
+ * or the end of the count.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+int
+strncmp(const char *s1, const char *s2, size_t n)
+{
+    if (n == 0)
+        return 0;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    if ((((uintptr_t)s1 ^ (uintptr_t)s2) & 3) == 0) {
+        const m65832_word_t *a1;
+        const m65832_word_t *a2;
+
+        while ((uintptr_t)s1 & 3) {
+            if (*s1 == '\0' || *s1 != *s2)
+                goto bytes;
+            if (--n == 0)
+                return 0;
+            s1++;
+            s2++;
+        }
+
+        a1 = (const m65832_word_t *)s1;
+        a2 = (const m65832_word_t *)s2;
+        while (n >= sizeof(m65832_word_t) && *a1 == *a2) {
+            n -= sizeof(m65832_word_t);
+            /* Equal words holding a null mean equal strings */
+            if (n == 0 || M65832_HAS_ZERO(*a1))
+                return 0;
+            a1++;
+            a2++;
+        }
+
+        s1 = (const char *)a1;
+        s2 = (const char *)a2;
+    }
+
+bytes:
+#endif
+    while (n-- > 0 && *s1 == *s2) {
+        if (n == 0 || *s1 == '\0')
+            return 0;
+        s1++;
+        s2++;
+    }
+    return (*(unsigned char *)s1) - (*(unsigned char *)s2);
+}
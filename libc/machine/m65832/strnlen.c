@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strnlen for M65832, scanning a word at a time
+ */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <stdint.h>
+#include "m65832_string.h"
+
+size_t
+strnlen(const char *str, size_t n)
+{
+    const char *start = str;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    while ((uintptr_t)str & 3) {
+        if (!n-- || !*str)
+            return str - start;
+        str++;
+    }
+
+    /* Aligned reads never cross into an unmapped page */
+    if (n >= sizeof(m65832_word_t)) {
+        const m65832_word_t *w = (const m65832_word_t *)str;
+
+        while (n >= sizeof(m65832_word_t)) {
+            uint32_t flags = M65832_HAS_ZERO(*w);
+            if (flags)
+                return (const char *)w - start + __m65832_first_byte(flags);
+            n -= sizeof(m65832_word_t);
+            w++;
+        }
+        str = (const char *)w;
+    }
+#endif
+
+    while (n-- > 0 && *str)
+        str++;
+    return str - start;
+}
@@ -0,0 +1,50 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Directory entries for M65832
+ *
+ * readdir fills each entry from the GETDENTS_PLUS TRAP, which also
+ * returns the file type and size, so a listing that only needs those
+ * does not have to stat every name. d_size is an M65832 extension.
+ */
+
+#ifndef _SYS_DIRENT_H
+#define _SYS_DIRENT_H
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+#define MAXNAMLEN 255
+
+struct dirent {
+    ino_t          d_ino;
+    off_t          d_size;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[MAXNAMLEN + 1];
+};
+
+/* Opaque, see libc/machine/m65832/dirent.c */
+typedef struct _m65832_dir DIR;
+
+#if __MISC_VISIBLE
+#define DT_UNKNOWN 0
+#define DT_FIFO    1
+#define DT_CHR     2
+#define DT_DIR     4
+#define DT_BLK     6
+#define DT_REG     8
+#define DT_LNK     10
+#define DT_SOCK    12
+
+#define IFTODT(mode)    (((mode) & 0170000) >> 12)
+#define DTTOIF(dirtype) ((dirtype) << 12)
+#endif
+
+_END_STD_C
+
+#endif /* _SYS_DIRENT_H */
@@ -2,94 +2,156 @@
  * syscalls.c - M65832 syscall stubs for picolibc (TRAP #0)
  */
 
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/times.h>
 #include <sys/types.h>
+#include <sys/select.h>
+#include <sys/uio.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
 #include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
 #include <unistd.h>
 
-#define M65832_SYS_EXIT     1
-#define M65832_SYS_READ     3
-#define M65832_SYS_WRITE    4
-#define M65832_SYS_OPEN     5
-#define M65832_SYS_CLOSE    6
-#define M65832_SYS_LSEEK    19
-#define M65832_SYS_GETPID   20
-#define M65832_SYS_FSTAT    108
-#define M65832_SYS_EXIT_GRP 248
+#include <machine/ring.h>
 
-static inline long __syscall0(long n) {
-    register long r0 __asm__("r0") = n;
-    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : : "memory");
-    return r0;
-}
+#include "m65832_syscall.h"
 
-static inline long __syscall1(long n, long a1) {
-    register long r0 __asm__("r0") = n;
-    register long r1 __asm__("r1") = a1;
-    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : "r"(r1) : "memory");
-    return r0;
+/* Heap management, the regions sbrk uses are set up in picosbrk.c */
+__attribute__((weak)) void *_sbrk(ptrdiff_t incr) {
+    return sbrk(incr);
 }
 
-static inline long __syscall2(long n, long a1, long a2) {
-    register long r0 __asm__("r0") = n;
-    register long r1 __asm__("r1") = a1;
-    register long r2 __asm__("r2") = a2;
-    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : "r"(r1), "r"(r2) : "memory");
-    return r0;
+__attribute__((weak)) ssize_t _write(int fd, const void *buf, size_t len) {
+    return __syscall_ret(__syscall3(M65832_SYS_WRITE, fd, (long)buf, (long)len));
 }
 
-static inline long __syscall3(long n, long a1, long a2, long a3) {
-    register long r0 __asm__("r0") = n;
-    register long r1 __asm__("r1") = a1;
-    register long r2 __asm__("r2") = a2;
-    register long r3 __asm__("r3") = a3;
-    __asm__ volatile(".byte 0x02, 0x40, 0x00" : "+r"(r0) : "r"(r1), "r"(r2), "r"(r3) : "memory");
-    return r0;
+__attribute__((weak)) ssize_t _read(int fd, void *buf, size_t len) {
+    return __syscall_ret(__syscall3(M65832_SYS_READ, fd, (long)buf, (long)len));
 }
 
-static inline long __syscall_ret(long r) {
-    if (r < 0 && r > -4096) {
-        errno = -r;
-        return -1;
-    }
-    return r;
+__attribute__((weak)) ssize_t write(int fd, const void *buf, size_t len) {
+    return _write(fd, buf, len);
 }
 
-/* Heap management */
-extern char _end[];
-extern char _heap_end[];
-static char *heap_ptr;
+__attribute__((weak)) ssize_t read(int fd, void *buf, size_t len) {
+    return _read(fd, buf, len);
+}
 
-__attribute__((weak)) void *_sbrk(ptrdiff_t incr) {
-    char *prev_heap;
-    if (!heap_ptr) {
-        heap_ptr = _end;
-    }
-    prev_heap = heap_ptr;
-    if (heap_ptr + incr > _heap_end) {
-        errno = ENOMEM;
-        return (void *)-1;
+/*
+ * Emulators without the vectored syscalls return -ENOSYS; fall back
+ * to a batch of scalar calls, one per iovec entry, which stops at a
+ * short transfer.
+ */
+#define IOV_BATCH 8
+
+static ssize_t __iov_loop(int fd, const struct iovec *iov, int iovcnt, int is_write) {
+    struct m65832_sqe sqe[IOV_BATCH];
+    struct m65832_cqe cqe[IOV_BATCH];
+    ssize_t           total = 0;
+
+    while (iovcnt > 0) {
+        unsigned n = iovcnt < IOV_BATCH ? (unsigned)iovcnt : IOV_BATCH;
+        unsigned i;
+
+        for (i = 0; i < n; i++) {
+            sqe[i].op = is_write ? M65832_OP_WRITE : M65832_OP_READ;
+            sqe[i].flags = M65832_SQE_STOP;
+            sqe[i].fd = fd;
+            sqe[i].buf = iov[i].iov_base;
+            sqe[i].arg = (long)iov[i].iov_len;
+            sqe[i].user = NULL;
+        }
+        __m65832_batch(sqe, n, cqe);
+        for (i = 0; i < n; i++) {
+            long r = cqe[i].res;
+            if (r < 0)
+                return total ? total : __syscall_ret(r);
+            total += r;
+            if ((size_t)r < iov[i].iov_len)
+                return total;
+        }
+        iov += n;
+        iovcnt -= (int)n;
     }
-    heap_ptr += incr;
-    return prev_heap;
+    return total;
 }
 
-__attribute__((weak)) ssize_t _write(int fd, const void *buf, size_t len) {
-    return __syscall_ret(__syscall3(M65832_SYS_WRITE, fd, (long)buf, (long)len));
+__attribute__((weak)) ssize_t _writev(int fd, const struct iovec *iov, int iovcnt) {
+    long r = __syscall3(M65832_SYS_WRITEV, fd, (long)iov, iovcnt);
+    if (r == -ENOSYS)
+        return __iov_loop(fd, iov, iovcnt, 1);
+    return __syscall_ret(r);
 }
 
-__attribute__((weak)) ssize_t _read(int fd, void *buf, size_t len) {
-    return __syscall_ret(__syscall3(M65832_SYS_READ, fd, (long)buf, (long)len));
+__attribute__((weak)) ssize_t _readv(int fd, const struct iovec *iov, int iovcnt) {
+    long r = __syscall3(M65832_SYS_READV, fd, (long)iov, iovcnt);
+    if (r == -ENOSYS)
+        return __iov_loop(fd, iov, iovcnt, 0);
+    return __syscall_ret(r);
 }
 
-__attribute__((weak)) ssize_t write(int fd, const void *buf, size_t len) {
-    return _write(fd, buf, len);
+__attribute__((weak)) ssize_t writev(int fd, const struct iovec *iov, int iovcnt) {
+    return _writev(fd, iov, iovcnt);
 }
 
-__attribute__((weak)) ssize_t read(int fd, void *buf, size_t len) {
-    return _read(fd, buf, len);
+__attribute__((weak)) ssize_t readv(int fd, const struct iovec *iov, int iovcnt) {
+    return _readv(fd, iov, iovcnt);
+}
+
+/*
+ * The TRAP takes Linux open flags. The access mode, O_CREAT, O_TRUNC
+ * and O_APPEND have the same values in picolibc; the others move.
+ */
+#define LINUX_O_EXCL      0200
+#define LINUX_O_NOCTTY    0400
+#define LINUX_O_NONBLOCK  04000
+#define LINUX_O_SYNC      04010000
+#define LINUX_O_DIRECTORY 0200000
+#define LINUX_O_NOFOLLOW  0400000
+#define LINUX_O_CLOEXEC   02000000
+
+#define SAME_O_FLAGS (O_ACCMODE | O_CREAT | O_TRUNC | O_APPEND)
+
+static const struct {
+    int  flag;
+    long linux_flag;
+} __open_flag_map[] = {
+    { _FEXCL, LINUX_O_EXCL },
+    { _FNOCTTY, LINUX_O_NOCTTY },
+    { _FNONBLOCK, LINUX_O_NONBLOCK },
+    { _FSYNC, LINUX_O_SYNC },
+    { _FDIRECTORY, LINUX_O_DIRECTORY },
+    { _FNOFOLLOW, LINUX_O_NOFOLLOW },
+    { _FNOINHERIT, LINUX_O_CLOEXEC },
+};
+
+#define OPEN_FLAG_MAP_LEN (sizeof(__open_flag_map) / sizeof(__open_flag_map[0]))
+
+static long __linux_open_flags(int flags) {
+    long     l = flags & SAME_O_FLAGS;
+    unsigned i;
+
+    for (i = 0; i < OPEN_FLAG_MAP_LEN; i++)
+        if (flags & __open_flag_map[i].flag)
+            l |= __open_flag_map[i].linux_flag;
+    return l;
+}
+
+static int __picolibc_open_flags(long l) {
+    int      flags = l & SAME_O_FLAGS;
+    unsigned i;
+
+    for (i = 0; i < OPEN_FLAG_MAP_LEN; i++)
+        if ((l & __open_flag_map[i].linux_flag) == __open_flag_map[i].linux_flag)
+            flags |= __open_flag_map[i].flag;
+    return flags;
 }
 
 __attribute__((weak)) int _open(const char *path, int flags, ...) {
@@ -100,7 +162,7 @@ __attribute__((weak)) int _open(const char *path, int flags, ...) {
         mode = va_arg(ap, mode_t);
         va_end(ap);
     }
-    return (int)__syscall_ret(__syscall3(M65832_SYS_OPEN, (long)path, flags, mode));
+    return (int)__syscall_ret(__syscall3(M65832_SYS_OPEN, (long)path, __linux_open_flags(flags), mode));
 }
 
 __attribute__((weak)) int open(const char *path, int flags, ...) {
@@ -122,6 +184,162 @@ __attribute__((weak)) int close(int fd) {
     return _close(fd);
 }
 
+/*
+ * Descriptor flags. Only duplication, close-on-exec and the file status
+ * flags are supported; O_NONBLOCK makes read and write return EAGAIN
+ * rather than wait.
+ */
+#define LINUX_F_DUPFD_CLOEXEC 1030
+
+__attribute__((weak)) int _fcntl(int fd, int cmd, ...) {
+    long    arg = 0;
+    long    r;
+    va_list ap;
+
+    va_start(ap, cmd);
+    switch (cmd) {
+    case F_DUPFD:
+    case F_DUPFD_CLOEXEC:
+    case F_SETFD:
+    case F_SETFL:
+        arg = va_arg(ap, int);
+        break;
+    }
+    va_end(ap);
+
+    switch (cmd) {
+    case F_DUPFD_CLOEXEC:
+        cmd = LINUX_F_DUPFD_CLOEXEC;
+        break;
+    case F_SETFL:
+        arg = __linux_open_flags((int)arg);
+        break;
+    case F_DUPFD:
+    case F_GETFD:
+    case F_SETFD:
+    case F_GETFL:
+        break;
+    default:
+        errno = EINVAL;
+        return -1;
+    }
+    r = __syscall_ret(__syscall3(M65832_SYS_FCNTL, fd, cmd, arg));
+    if (cmd == F_GETFL && r >= 0)
+        r = __picolibc_open_flags(r);
+    return (int)r;
+}
+
+__attribute__((weak)) int fcntl(int fd, int cmd, ...) {
+    long    arg;
+    va_list ap;
+
+    va_start(ap, cmd);
+    arg = (cmd == F_DUPFD || cmd == F_DUPFD_CLOEXEC || cmd == F_SETFD || cmd == F_SETFL)
+        ? va_arg(ap, int) : 0;
+    va_end(ap);
+    return _fcntl(fd, cmd, (int)arg);
+}
+
+/*
+ * Wait for descriptors to become ready. poll is one TRAP; select is
+ * built on it because fd_set here is smaller than the Linux one.
+ */
+extern size_t __m65832_conin_ready(void) __attribute__((weak));
+
+__attribute__((weak)) int poll(struct pollfd *fds, nfds_t nfds, int timeout) {
+    nfds_t i;
+    int    r, n = 0;
+
+    /* Bytes in the console input ring make stdin readable, see conin.c */
+    if (__m65832_conin_ready && __m65832_conin_ready()) {
+        for (i = 0; i < nfds; i++)
+            if (fds[i].fd == 0 && (fds[i].events & POLLIN))
+                n++;
+        if (n)
+            timeout = 0;
+    }
+    r = (int)__syscall_ret(__syscall3(M65832_SYS_POLL, (long)fds, (long)nfds, timeout));
+    if (!n || r < 0)
+        return r;
+    for (i = 0; i < nfds; i++) {
+        if (fds[i].fd == 0 && (fds[i].events & POLLIN)) {
+            if (!fds[i].revents)
+                r++;
+            fds[i].revents |= POLLIN;
+        }
+    }
+    return r;
+}
+
+__attribute__((weak)) int select(int n, fd_set *rfds, fd_set *wfds, fd_set *efds,
+                                 struct timeval *tv) {
+    struct pollfd fds[FD_SETSIZE];
+    nfds_t        nfds = 0, i;
+    int           fd, timeout = -1, r;
+
+    if (n < 0 || n > FD_SETSIZE) {
+        errno = EINVAL;
+        return -1;
+    }
+    for (fd = 0; fd < n; fd++) {
+        short ev = 0;
+
+        if (rfds && FD_ISSET(fd, rfds))
+            ev |= POLLIN;
+        if (wfds && FD_ISSET(fd, wfds))
+            ev |= POLLOUT;
+        if (efds && FD_ISSET(fd, efds))
+            ev |= POLLPRI;
+        if (ev) {
+            fds[nfds].fd = fd;
+            fds[nfds].events = ev;
+            fds[nfds].revents = 0;
+            nfds++;
+        }
+    }
+    if (tv) {
+        if (tv->tv_sec >= INT_MAX / 1000)
+            timeout = INT_MAX;
+        else
+            timeout = (int)tv->tv_sec * 1000 + (int)((tv->tv_usec + 999) / 1000);
+    }
+
+    r = poll(fds, nfds, timeout);
+    if (r < 0)
+        return r;
+
+    r = 0;
+    for (i = 0; i < nfds; i++) {
+        short ev = fds[i].events;
+        short rev = fds[i].revents;
+
+        fd = fds[i].fd;
+        if (rev & POLLNVAL) {
+            errno = EBADF;
+            return -1;
+        }
+        if (ev & POLLIN) {
+            if (rev & (POLLIN | POLLHUP | POLLERR))
+                r++;
+            else
+                FD_CLR(fd, rfds);
+        }
+        if (ev & POLLOUT) {
+            if (rev & (POLLOUT | POLLERR))
+                r++;
+            else
+                FD_CLR(fd, wfds);
+        }
+        if (ev & POLLPRI) {
+            if (rev & POLLPRI)
+                r++;
+            else
+                FD_CLR(fd, efds);
+        }
+    }
+    return r;
+}
+
 __attribute__((weak)) off_t _lseek(int fd, off_t offset, int whence) {
     return (off_t)__syscall_ret(__syscall3(M65832_SYS_LSEEK, fd, (long)offset, whence));
 }
@@ -130,26 +348,135 @@ __attribute__((weak)) off_t lseek(int fd, off_t offset, int whence) {
     return _lseek(fd, offset, whence);
 }
 
+/*
+ * Map a file into memory. The emulator can expose host files as
+ * directly addressable memory; the arguments are passed in a block as
+ * for the old Linux mmap call. Emulators without it return -ENOSYS.
+ */
+__attribute__((weak)) void *_mmap(void *addr, size_t len, int prot, int flags, int fd, off_t offset) {
+    long args[6] = { (long)addr, (long)len, prot, flags, fd, (long)offset };
+    long r = __syscall1(M65832_SYS_MMAP, (long)args);
+    if (r < 0 && r > -4096) {
+        errno = -r;
+        return MAP_FAILED;
+    }
+    return (void *)r;
+}
+
+__attribute__((weak)) void *mmap(void *addr, size_t len, int prot, int flags, int fd, off_t offset) {
+    return _mmap(addr, len, prot, flags, fd, offset);
+}
+
+__attribute__((weak)) int _munmap(void *addr, size_t len) {
+    return (int)__syscall_ret(__syscall2(M65832_SYS_MUNMAP, (long)addr, (long)len));
+}
+
+__attribute__((weak)) int munmap(void *addr, size_t len) {
+    return _munmap(addr, len);
+}
+
+/*
+ * stdio sizes the buffer of each stream from st_blksize. Hosts may
+ * prefer far larger blocks than this target wants to hold in RAM, so
+ * the value passed on is limited to M65832_BLKSIZE_MAX.
+ */
+#define M65832_BLKSIZE_MAX 4096
+
+static void __stat_from_linux(struct stat *st, const struct m65832_stat *ks) {
+    memset(st, 0, sizeof(*st));
+    st->st_dev = (dev_t)ks->st_dev;
+    st->st_ino = (ino_t)ks->st_ino;
+    st->st_mode = ks->st_mode;
+    st->st_nlink = ks->st_nlink;
+    st->st_uid = ks->st_uid;
+    st->st_gid = ks->st_gid;
+    st->st_rdev = (dev_t)ks->st_rdev;
+    st->st_size = (off_t)ks->st_size;
+    st->st_blksize = (blksize_t)(ks->st_blksize < M65832_BLKSIZE_MAX ? ks->st_blksize
+                                                                     : M65832_BLKSIZE_MAX);
+    st->st_blocks = (blkcnt_t)ks->st_blocks;
+    st->st_atim.tv_sec = (time_t)ks->st_atime_sec;
+    st->st_atim.tv_nsec = (long)ks->st_atime_nsec;
+    st->st_mtim.tv_sec = (time_t)ks->st_mtime_sec;
+    st->st_mtim.tv_nsec = (long)ks->st_mtime_nsec;
+    st->st_ctim.tv_sec = (time_t)ks->st_ctime_sec;
+    st->st_ctim.tv_nsec = (long)ks->st_ctime_nsec;
+}
+
 __attribute__((weak)) int _fstat(int fd, struct stat *st) {
-    return (int)__syscall_ret(__syscall2(M65832_SYS_FSTAT, fd, (long)st));
+    struct m65832_stat ks;
+    long               r = __syscall2(M65832_SYS_FSTAT, fd, (long)&ks);
+
+    if (r < 0)
+        return (int)__syscall_ret(r);
+    __stat_from_linux(st, &ks);
+    return 0;
 }
 
 __attribute__((weak)) int fstat(int fd, struct stat *st) {
     return _fstat(fd, st);
 }
 
+/*
+ * A descriptor is a terminal when TCGETS succeeds on it. Emulators
+ * without ioctl are asked for the file type instead, and those with
+ * neither only have the console on 0-2.
+ */
+#define LINUX_TCGETS 0x5401
+
 __attribute__((weak)) int _isatty(int fd) {
-    if (fd >= 0 && fd <= 2) {
-        return 1;
+    long               termios[16];
+    struct m65832_stat ks;
+    long               r = __syscall3(M65832_SYS_IOCTL, fd, LINUX_TCGETS, (long)termios);
+
+    if (r == -ENOSYS) {
+        r = __syscall2(M65832_SYS_FSTAT, fd, (long)&ks);
+        if (r == 0) {
+            if (S_ISCHR(ks.st_mode))
+                return 1;
+            r = -ENOTTY;
+        } else if (r == -ENOSYS) {
+            if (fd >= 0 && fd <= 2)
+                return 1;
+            r = -EBADF;
+        }
     }
-    errno = EBADF;
-    return 0;
+    return __syscall_ret(r) == 0;
+}
+
+__attribute__((weak)) int isatty(int fd) {
+    return _isatty(fd);
 }
 
 __attribute__((weak)) int _getpid(void) {
     return (int)__syscall_ret(__syscall0(M65832_SYS_GETPID));
 }
 
+/*
+ * getentropy seeds the stack protector guard from crt0 and arc4random;
+ * emulators without GETRANDOM make it fail with ENOSYS.
+ */
+__attribute__((weak)) int getentropy(void *buf, size_t len) {
+    unsigned char *b = buf;
+    long           r;
+
+    if (len > 256) {
+        errno = EIO;
+        return -1;
+    }
+    while (len) {
+        r = __syscall_ret(__syscall3(M65832_SYS_GETRANDOM, (long)b, (long)len, 0));
+        if (r <= 0) {
+            if (r == 0)
+                errno = EIO;
+            return -1;
+        }
+        b += r;
+        len -= r;
+    }
+    return 0;
+}
+
 __attribute__((weak)) int _kill(pid_t pid, int sig) {
     (void)pid;
     (void)sig;
@@ -157,7 +484,130 @@ __attribute__((weak)) int _kill(pid_t pid, int sig) {
     return -1;
 }
 
+/*
+ * Clocks. The TRAP interface takes Linux clock ids and fills a pair of
+ * 64-bit seconds and nanoseconds, whatever the layout of struct timespec.
+ */
+struct m65832_timespec64 {
+    int64_t tv_sec;
+    int64_t tv_nsec;
+};
+
+static int __clock_id(clockid_t clock_id) {
+    switch (clock_id) {
+    case CLOCK_REALTIME:
+        return 0;
+    case CLOCK_MONOTONIC:
+        return 1;
+    case 2: /* CLOCK_PROCESS_CPUTIME_ID */
+    case 3: /* CLOCK_THREAD_CPUTIME_ID */
+        return clock_id;
+#if __GNU_VISIBLE
+    case CLOCK_REALTIME_COARSE:
+        return 5;
+    case CLOCK_MONOTONIC_RAW:
+        return 4;
+    case CLOCK_MONOTONIC_COARSE:
+        return 6;
+    case CLOCK_BOOTTIME:
+        return 7;
+#endif
+    default:
+        return -1;
+    }
+}
+
+static int __clock_call(long n, clockid_t clock_id, struct timespec *tp) {
+    struct m65832_timespec64 ts;
+    int id = __clock_id(clock_id);
+    long r;
+
+    if (id < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    r = __syscall2(n, id, (long)&ts);
+    /* A single program is the only process: CPU time is elapsed time */
+    if (r == -EINVAL && (id == 2 || id == 3))
+        r = __syscall2(n, 1, (long)&ts);
+    if (__syscall_ret(r) < 0)
+        return -1;
+    if (tp) {
+        tp->tv_sec = (time_t)ts.tv_sec;
+        tp->tv_nsec = (long)ts.tv_nsec;
+    }
+    return 0;
+}
+
+__attribute__((weak)) int clock_gettime(clockid_t clock_id, struct timespec *tp) {
+    int id = __clock_id(clock_id);
+
+    /* Realtime and monotonic clocks come from the time page when there is one */
+    if (tp && (id == 0 || id == 1 || id == 5 || id == 6)
+        && __m65832_time_page_read(id == 0 || id == 5, tp) == 0)
+        return 0;
+    return __clock_call(M65832_SYS_CLOCK_GETTIME64, clock_id, tp);
+}
+
+__attribute__((weak)) int clock_getres(clockid_t clock_id, struct timespec *res) {
+    return __clock_call(M65832_SYS_CLOCK_GETRES64, clock_id, res);
+}
+
+__attribute__((weak)) int _gettimeofday(struct timeval *tv, void *tz) {
+    struct timespec ts;
+
+    (void)tz;
+    if (clock_gettime(CLOCK_REALTIME, &ts) < 0)
+        return -1;
+    if (tv) {
+        tv->tv_sec = ts.tv_sec;
+        tv->tv_usec = ts.tv_nsec / 1000;
+    }
+    return 0;
+}
+
+__attribute__((weak)) int gettimeofday(struct timeval *tv, void *tz) {
+    return _gettimeofday(tv, tz);
+}
+
+/*
+ * times() counts in CLOCKS_PER_SEC units, which is what clock() expects
+ * from it. All CPU time is user time of this one process.
+ */
+static clock_t __clock_ticks(clockid_t clock_id) {
+    struct timespec ts;
+
+    if (clock_gettime(clock_id, &ts) < 0)
+        return (clock_t)-1;
+    return (clock_t)((uint64_t)ts.tv_sec * CLOCKS_PER_SEC
+                     + (uint32_t)ts.tv_nsec / (1000000000 / CLOCKS_PER_SEC));
+}
+
+__attribute__((weak)) clock_t _times(struct tms *buf) {
+    clock_t elapsed = __clock_ticks(CLOCK_MONOTONIC);
+    clock_t cpu = __clock_ticks(2);
+
+    if (elapsed == (clock_t)-1)
+        return (clock_t)-1;
+    if (buf) {
+        buf->tms_utime = cpu == (clock_t)-1 ? elapsed : cpu;
+        buf->tms_stime = 0;
+        buf->tms_cutime = 0;
+        buf->tms_cstime = 0;
+    }
+    return elapsed;
+}
+
+__attribute__((weak)) clock_t times(struct tms *buf) {
+    return _times(buf);
+}
+
+/* Provided by m65832_iob.c when the console streams are linked in */
+extern void __m65832_console_flush(void) __attribute__((weak));
+
 __attribute__((weak, noreturn)) void _exit(int status) {
+    if (__m65832_console_flush)
+        __m65832_console_flush();
     __syscall1(M65832_SYS_EXIT_GRP, status);
     __syscall1(M65832_SYS_EXIT, status);
     __builtin_unreachable();
@@ -186,11 +636,27 @@ __attribute__((weak)) int link(const char *oldpath, const char *newpath) {
     return _link(oldpath, newpath);
 }
 
+/*
+ * Emulators without STAT get open, fstat and close instead; that
+ * misses only names which cannot be opened for reading.
+ */
 __attribute__((weak)) int _stat(const char *path, struct stat *st) {
-    (void)path;
-    (void)st;
-    errno = ENOENT;
-    return -1;
+    struct m65832_stat ks;
+    long               r = __syscall2(M65832_SYS_STAT, (long)path, (long)&ks);
+    int                fd;
+
+    if (r == -ENOSYS) {
+        fd = _open(path, O_RDONLY);
+        if (fd < 0)
+            return -1;
+        r = _fstat(fd, st);
+        _close(fd);
+        return (int)r;
+    }
+    if (r < 0)
+        return (int)__syscall_ret(r);
+    __stat_from_linux(st, &ks);
+    return 0;
 }
 
 __attribute__((weak)) int stat(const char *path, struct stat *st) {
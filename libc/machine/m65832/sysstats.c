@@ -0,0 +1,285 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * System call statistics, see <machine/sysstats.h>
+ *
+ * Entries are found by hashing the call number into a small open
+ * addressed table. The summary is formatted by hand and written with
+ * a raw TRAP, so that it works after stdio has shut down and does not
+ * count itself.
+ */
+
+#include <machine/sysstats.h>
+#include <machine/cycles.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m65832_syscall.h"
+
+#if __M65832_SYSCALL_STATS
+
+#define STATS_SHARED M65832_SYSCALL_STATS_MAX
+
+static struct m65832_syscall_stat stats[M65832_SYSCALL_STATS_MAX + 1];
+static struct m65832_syscall_rec *trace_buf;
+static unsigned                   trace_mask;
+static uint32_t                   trace_next;
+
+static struct m65832_syscall_stat *
+stats_entry(long n)
+{
+    /* The top five bits, for 32 entries */
+    unsigned i = ((uint32_t)n * 2654435761u) >> 27;
+    unsigned probe;
+
+    for (probe = 0; probe < M65832_SYSCALL_STATS_MAX; probe++) {
+        struct m65832_syscall_stat *st = &stats[i];
+
+        if (st->nr == n && st->calls)
+            return st;
+        if (!st->calls) {
+            st->nr = n;
+            return st;
+        }
+        if (++i == M65832_SYSCALL_STATS_MAX)
+            i = 0;
+    }
+    stats[STATS_SHARED].nr = -1;
+    return &stats[STATS_SHARED];
+}
+
+/* Bytes a successful call moved */
+static unsigned long
+stats_bytes(long n, long a3, long r)
+{
+    switch (n) {
+    case M65832_SYS_READ:
+    case M65832_SYS_WRITE:
+    case M65832_SYS_READV:
+    case M65832_SYS_WRITEV:
+    case M65832_SYS_GETDENTS_PLUS:
+        return r > 0 ? (unsigned long)r : 0;
+    case M65832_SYS_BULK_COPY:
+    case M65832_SYS_BULK_FILL:
+        return r == 0 ? (unsigned long)a3 : 0;
+    }
+    return 0;
+}
+
+long
+__m65832_syscall_counted(long n, long a1, long a2, long a3)
+{
+    uint64_t                    start = __m65832_cycles();
+    long                        r = __m65832_trap3(n, a1, a2, a3);
+    uint32_t                    took = (uint32_t)(__m65832_cycles() - start);
+    struct m65832_syscall_stat *st = stats_entry(n);
+
+    st->calls++;
+    if (r < 0 && r > -4096)
+        st->errors++;
+    st->bytes += stats_bytes(n, a3, r);
+    st->cycles += took;
+
+    if (trace_buf) {
+        struct m65832_syscall_rec *rec = &trace_buf[trace_next++ & trace_mask];
+
+        rec->nr = n;
+        rec->arg = a1;
+        rec->ret = r;
+        rec->cycles = took;
+    }
+    return r;
+}
+
+int
+__m65832_syscall_stats(struct m65832_syscall_stat *out, int max)
+{
+    int i, j, count = 0;
+
+    for (i = 0; i <= M65832_SYSCALL_STATS_MAX; i++) {
+        if (!stats[i].calls)
+            continue;
+        /* Insert by cycles, dropping whatever falls off the end */
+        for (j = count < max ? count++ : max; j > 0 && out[j - 1].cycles < stats[i].cycles; j--)
+            if (j < max)
+                out[j] = out[j - 1];
+        if (j < max)
+            out[j] = stats[i];
+    }
+    return count;
+}
+
+void
+__m65832_syscall_stats_reset(void)
+{
+    memset(stats, 0, sizeof(stats));
+}
+
+int
+__m65832_syscall_trace(struct m65832_syscall_rec *buf, unsigned entries)
+{
+    if (buf && (!entries || (entries & (entries - 1)) != 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    trace_buf = NULL;
+    trace_mask = entries - 1;
+    trace_next = 0;
+    trace_buf = buf;
+    return 0;
+}
+
+uint32_t
+__m65832_syscall_traced(void)
+{
+    return trace_next;
+}
+
+static const struct {
+    short       nr;
+    const char *name;
+} stats_names[] = {
+    { M65832_SYS_EXIT, "exit" },
+    { M65832_SYS_READ, "read" },
+    { M65832_SYS_WRITE, "write" },
+    { M65832_SYS_OPEN, "open" },
+    { M65832_SYS_CLOSE, "close" },
+    { M65832_SYS_LSEEK, "lseek" },
+    { M65832_SYS_GETPID, "getpid" },
+    { M65832_SYS_IOCTL, "ioctl" },
+    { M65832_SYS_FCNTL, "fcntl" },
+    { M65832_SYS_MMAP, "mmap" },
+    { M65832_SYS_MUNMAP, "munmap" },
+    { M65832_SYS_STAT, "stat" },
+    { M65832_SYS_FSTAT, "fstat" },
+    { M65832_SYS_READV, "readv" },
+    { M65832_SYS_WRITEV, "writev" },
+    { M65832_SYS_POLL, "poll" },
+    { M65832_SYS_GETRANDOM, "getrandom" },
+    { M65832_SYS_CLOCK_GETTIME64, "clock_gettime" },
+    { M65832_SYS_CLOCK_GETRES64, "clock_getres" },
+    { M65832_SYS_BATCH, "BATCH" },
+    { M65832_SYS_TIME_PAGE, "TIME_PAGE" },
+    { M65832_SYS_SEMIHOST, "SEMIHOST" },
+    { M65832_SYS_BULK_COPY, "BULK_COPY" },
+    { M65832_SYS_BULK_FILL, "BULK_FILL" },
+    { M65832_SYS_GETDENTS_PLUS, "GETDENTS_PLUS" },
+};
+
+/* Right-align v in a field of width characters ending at end */
+static char *
+stats_num(char *end, uint64_t v, int width)
+{
+    char *p = end;
+
+    do {
+        *--p = '0' + (char)(v % 10);
+        v /= 10;
+    } while (v);
+    while (end - p < width)
+        *--p = ' ';
+    return p;
+}
+
+#define NAME_WIDTH 14
+
+static void
+stats_line(int fd, const char *name, long nr, const struct m65832_syscall_stat *st)
+{
+    char     line[80], num[12];
+    char    *p = line + sizeof(line);
+    size_t   len;
+    unsigned i;
+
+    *--p = '\n';
+    p = stats_num(p, st->cycles, 15);
+    p = stats_num(p, st->bytes, 15);
+    p = stats_num(p, st->errors, 9);
+    p = stats_num(p, st->calls, 10);
+    for (i = 0; !name && i < sizeof(stats_names) / sizeof(stats_names[0]); i++)
+        if (stats_names[i].nr == nr)
+            name = stats_names[i].name;
+    if (!name)
+        name = stats_num(num + sizeof(num) - 1, (unsigned long)nr, 0);
+    num[sizeof(num) - 1] = '\0';
+
+    p -= NAME_WIDTH;
+    memset(p, ' ', NAME_WIDTH);
+    len = strlen(name);
+    memcpy(p, name, len < NAME_WIDTH ? len : NAME_WIDTH);
+    __m65832_trap3(M65832_SYS_WRITE, fd, (long)p, (long)(line + sizeof(line) - p));
+}
+
+void
+__m65832_syscall_stats_print(int fd)
+{
+    static const char          head[] = "syscall            calls   errors          bytes         cycles\n";
+    struct m65832_syscall_stat sorted[M65832_SYSCALL_STATS_MAX + 1], total;
+    int                        i, n;
+
+    n = __m65832_syscall_stats(sorted, M65832_SYSCALL_STATS_MAX + 1);
+    if (!n)
+        return;
+    memset(&total, 0, sizeof(total));
+    __m65832_trap3(M65832_SYS_WRITE, fd, (long)head, sizeof(head) - 1);
+    for (i = 0; i < n; i++) {
+        stats_line(fd, sorted[i].nr < 0 ? "other" : NULL, sorted[i].nr, &sorted[i]);
+        total.calls += sorted[i].calls;
+        total.errors += sorted[i].errors;
+        total.bytes += sorted[i].bytes;
+        total.cycles += sorted[i].cycles;
+    }
+    stats_line(fd, "total", 0, &total);
+}
+
+static void
+stats_exit(void)
+{
+    __m65832_syscall_stats_print(2);
+}
+
+static __attribute__((constructor)) void
+stats_init(void)
+{
+    atexit(stats_exit);
+}
+
+#else
+
+int
+__m65832_syscall_stats(struct m65832_syscall_stat *out, int max)
+{
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+void
+__m65832_syscall_stats_reset(void)
+{
+}
+
+void
+__m65832_syscall_stats_print(int fd)
+{
+    (void)fd;
+}
+
+int
+__m65832_syscall_trace(struct m65832_syscall_rec *buf, unsigned entries)
+{
+    (void)buf;
+    (void)entries;
+    errno = ENOSYS;
+    return -1;
+}
+
+uint32_t
+__m65832_syscall_traced(void)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,365 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Cooperative scheduler for <threads.h> on M65832
+ *
+ * Replaces the single-threaded libc/misc/thrd_sched.c. Threads run
+ * until they block, sleep, yield or exit; switching is swapcontext
+ * (see <machine/ucontext.h>) plus moving the TLS pointer, so nothing
+ * here needs interrupts masked. Interrupt handlers must not call the
+ * <threads.h> functions.
+ *
+ * All threads sit on one ring in creation order and the next one to
+ * run is the first runnable thread after the current one, which keeps
+ * the order round-robin. When nothing can run but some thread waits
+ * with a deadline, the scheduler sleeps in poll until the earliest
+ * one; when nothing could ever run, the blocked wait fails with
+ * thrd_error instead of hanging.
+ *
+ * Each thread gets a stack of M65832_THREAD_STACK_SIZE bytes, from
+ * fast memory when there is room, and its own TLS block, so errno and
+ * the tss_ values are per thread.
+ */
+
+#define _DEFAULT_SOURCE
+#include <sys/thrd_sched.h>
+#include <machine/ucontext.h>
+#include <picotls.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <poll.h>
+#include <time.h>
+#include "tls-local.h"
+
+#ifndef M65832_THREAD_STACK_SIZE
+#define M65832_THREAD_STACK_SIZE 4096
+#endif
+
+enum thrd_state {
+    THRD_READY,
+    THRD_BLOCKED,
+    THRD_EXITED,
+};
+
+struct __thrd {
+    ucontext_t      ctx;
+    struct __thrd  *next;      /* ring of all threads */
+    enum thrd_state state;
+    volatile int   *wait_addr; /* word blocked on */
+    struct timespec deadline;
+    int             timed;     /* deadline is set */
+    int             wait_ret;  /* result for __thrd_sched_wait */
+    volatile int    exited;    /* joiners wait for this to change */
+    int             detached;
+    int             res;
+    thrd_start_t    func;
+    void           *arg;
+    void           *tls;
+};
+
+static struct __thrd  thrd_main = { .next = &thrd_main };
+static struct __thrd *thrd_cur = &thrd_main;
+
+/* An exited, detached thread whose stack was still in use */
+static struct __thrd *thrd_reap;
+
+static void
+thrd_free(struct __thrd *t)
+{
+    free(t->ctx.uc_stack.ss_sp);
+    free(t->tls);
+    free(t);
+}
+
+static void
+thrd_unlink(struct __thrd *t)
+{
+    struct __thrd *p = t;
+
+    while (p->next != t)
+        p = p->next;
+    p->next = t->next;
+}
+
+static void
+thrd_reap_zombie(void)
+{
+    if (thrd_reap) {
+        thrd_free(thrd_reap);
+        thrd_reap = NULL;
+    }
+}
+
+static int
+timespec_before(const struct timespec *a, const struct timespec *b)
+{
+    return a->tv_sec < b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+/* Run the next thread that can; returns when the current one runs again */
+static void
+thrd_schedule(void)
+{
+    struct __thrd   *cur = thrd_cur, *t, *next;
+    struct __thrd   *first = cur->next;
+    struct timespec  now = { 0 };
+    struct timespec *soonest;
+    int              have_now;
+    long long        ms;
+
+    for (;;) {
+        next = NULL;
+        soonest = NULL;
+        have_now = 0;
+        t = first;
+        do {
+            if (t->state == THRD_BLOCKED && t->timed) {
+                if (!have_now) {
+                    clock_gettime(CLOCK_REALTIME, &now);
+                    have_now = 1;
+                }
+                if (!timespec_before(&now, &t->deadline)) {
+                    t->state = THRD_READY;
+                    t->wait_ret = thrd_timedout;
+                } else if (soonest == NULL || timespec_before(&t->deadline, soonest)) {
+                    soonest = &t->deadline;
+                }
+            }
+            if (t->state == THRD_READY) {
+                next = t;
+                break;
+            }
+            t = t->next;
+        } while (t != first);
+
+        if (next)
+            break;
+        if (soonest) {
+            ms = (long long)(soonest->tv_sec - now.tv_sec) * 1000
+                 + (soonest->tv_nsec - now.tv_nsec + 999999) / 1000000;
+            poll(NULL, 0, ms > INT_MAX ? INT_MAX : (int)ms);
+            continue;
+        }
+        /* Deadlock: fail the current wait, or end with the last thread */
+        if (cur->state == THRD_EXITED)
+            exit(EXIT_SUCCESS);
+        cur->state = THRD_READY;
+        cur->wait_ret = thrd_error;
+        next = cur;
+        break;
+    }
+
+    if (next == cur)
+        return;
+    thrd_cur = next;
+#ifdef __THREAD_LOCAL_STORAGE
+    cur->tls = __tls;
+    __tls = next->tls;
+#endif
+    swapcontext(&cur->ctx, &next->ctx);
+    thrd_reap_zombie();
+}
+
+static void
+thrd_start(int arg)
+{
+    struct __thrd *t = (struct __thrd *)(uintptr_t)arg;
+
+    thrd_reap_zombie();
+    thrd_exit(t->func(t->arg));
+}
+
+int
+__thrd_sched_create(thrd_t *thr, thrd_start_t func, void *arg)
+{
+    struct __thrd *t = calloc(1, sizeof(*t)), *p;
+
+    if (t == NULL)
+        return thrd_nomem;
+    if (__m65832_context_stack(&t->ctx, M65832_THREAD_STACK_SIZE) < 0) {
+        free(t);
+        return thrd_nomem;
+    }
+#ifdef __THREAD_LOCAL_STORAGE_API
+    if (_tls_size()) {
+        size_t align = _tls_align() > sizeof(void *) ? _tls_align() : sizeof(void *);
+
+        t->tls = aligned_alloc(align, (_tls_size() + align - 1) & ~(align - 1));
+        if (t->tls == NULL) {
+            thrd_free(t);
+            return thrd_nomem;
+        }
+        _init_tls(t->tls);
+    }
+#elif defined(__THREAD_LOCAL_STORAGE)
+    t->tls = __tls;
+#endif
+    t->func = func;
+    t->arg = arg;
+    t->state = THRD_READY;
+    makecontext(&t->ctx, (void (*)(void))thrd_start, 1, (int)(uintptr_t)t);
+
+    /* Just before the current thread, so it runs after all the others */
+    p = thrd_cur;
+    while (p->next != thrd_cur)
+        p = p->next;
+    p->next = t;
+    t->next = thrd_cur;
+    *thr = t;
+    return thrd_success;
+}
+
+thrd_t
+__thrd_sched_current(void)
+{
+    return thrd_cur;
+}
+
+int
+__thrd_sched_detach(thrd_t thr)
+{
+    if (thr->detached || thr == &thrd_main)
+        return thrd_error;
+    if (thr->state == THRD_EXITED) {
+        thrd_unlink(thr);
+        thrd_free(thr);
+    } else {
+        thr->detached = 1;
+    }
+    return thrd_success;
+}
+
+int
+__thrd_sched_join(thrd_t thr, int *res)
+{
+    int ret;
+
+    if (thr == thrd_cur || thr->detached || thr == &thrd_main)
+        return thrd_error;
+    while (!thr->exited) {
+        ret = __thrd_sched_wait(&thr->exited, 0, NULL);
+        if (ret != thrd_success)
+            return ret;
+    }
+    if (res)
+        *res = thr->res;
+    thrd_unlink(thr);
+    thrd_free(thr);
+    return thrd_success;
+}
+
+void
+__thrd_sched_exit(int res)
+{
+    struct __thrd *cur = thrd_cur;
+
+    cur->res = res;
+    cur->state = THRD_EXITED;
+    cur->exited = 1;
+    __thrd_sched_wake(&cur->exited, INT_MAX);
+    if (cur->detached) {
+        thrd_unlink(cur);
+        thrd_reap = cur;
+    }
+    thrd_schedule();
+    for (;;)
+        ;
+}
+
+void
+__thrd_sched_yield(void)
+{
+    thrd_schedule();
+}
+
+int
+__thrd_sched_wait(volatile int *addr, int val, const struct timespec *abstime)
+{
+    struct __thrd *cur = thrd_cur;
+
+    if (*addr != val)
+        return thrd_success;
+    cur->state = THRD_BLOCKED;
+    cur->wait_addr = addr;
+    cur->timed = abstime != NULL;
+    if (abstime)
+        cur->deadline = *abstime;
+    thrd_schedule();
+    cur->wait_addr = NULL;
+    return cur->wait_ret;
+}
+
+void
+__thrd_sched_wake(volatile int *addr, int count)
+{
+    struct __thrd *t = thrd_cur;
+
+    do {
+        if (count <= 0)
+            break;
+        if (t->state == THRD_BLOCKED && t->wait_addr == addr) {
+            t->state = THRD_READY;
+            t->wait_ret = thrd_success;
+            count--;
+        }
+        t = t->next;
+    } while (t != thrd_cur);
+}
+
+int
+__thrd_sched_sleep(const struct timespec *duration, struct timespec *remaining)
+{
+    struct timespec abstime;
+    volatile int    never = 0;
+
+    if (duration->tv_sec < 0 || duration->tv_nsec < 0 || duration->tv_nsec >= 1000000000L)
+        return -2;
+    clock_gettime(CLOCK_REALTIME, &abstime);
+    abstime.tv_sec += duration->tv_sec;
+    abstime.tv_nsec += duration->tv_nsec;
+    if (abstime.tv_nsec >= 1000000000L) {
+        abstime.tv_nsec -= 1000000000L;
+        abstime.tv_sec++;
+    }
+    while (__thrd_sched_wait(&never, 0, &abstime) != thrd_timedout)
+        ;
+    if (remaining) {
+        remaining->tv_sec = 0;
+        remaining->tv_nsec = 0;
+    }
+    return 0;
+}
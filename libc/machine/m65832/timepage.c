@@ -0,0 +1,138 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Clock reads from the shared time page, see <machine/timepage.h>.
+ *
+ * The TIME_PAGE TRAP returns the address of the page, or -ENOSYS
+ * from emulators without one. It is asked once; the answer does not
+ * change while the program runs.
+ */
+
+#include <machine/timepage.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include "m65832_syscall.h"
+
+#define NSEC_PER_SEC 1000000000U
+
+#ifndef __M65832_TIME_PAGE
+static const volatile struct m65832_time_page *time_page;
+static bool                                    time_page_known;
+#endif
+
+const volatile struct m65832_time_page *
+__m65832_time_page(void)
+{
+#ifdef __M65832_TIME_PAGE
+    return (const volatile struct m65832_time_page *)(__M65832_TIME_PAGE);
+#else
+    if (!time_page_known) {
+        long r = __syscall0(M65832_SYS_TIME_PAGE);
+
+        /* A racing first call asks again and stores the same answer */
+        if (r != 0 && (r >= 0 || r <= -4096)
+            && ((const volatile struct m65832_time_page *)r)->version == M65832_TIME_PAGE_VERSION)
+            time_page = (const volatile struct m65832_time_page *)r;
+        time_page_known = true;
+    }
+    return time_page;
+#endif
+}
+
+static uint64_t
+read_counter(uint32_t addr)
+{
+    volatile const uint32_t *counter = (volatile const uint32_t *)(uintptr_t)addr;
+    uint32_t                 hi, lo;
+
+    /* Read the high word around the low one to catch a carry */
+    do {
+        hi = counter[1];
+        lo = counter[0];
+    } while (hi != counter[1]);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+int
+__m65832_time_page_read(bool realtime, struct timespec *tp)
+{
+    const volatile struct m65832_time_page *page = __m65832_time_page();
+    uint32_t                                seq, nsec, counter, mult, shift;
+    uint64_t                                base, delta = 0;
+    int64_t                                 sec;
+
+    if (page == NULL)
+        return -1;
+    do {
+        while ((seq = page->seq) & 1)
+            ;
+        __asm__ volatile("" ::: "memory");
+        counter = page->counter;
+        mult = page->mult;
+        shift = page->shift;
+        base = page->cycle_base;
+        if (realtime) {
+            sec = page->real_sec;
+            nsec = page->real_nsec;
+        } else {
+            sec = page->mono_sec;
+            nsec = page->mono_nsec;
+        }
+        if (counter)
+            delta = read_counter(counter) - base;
+        __asm__ volatile("" ::: "memory");
+    } while (page->seq != seq);
+
+    if (counter) {
+        /* A stale page can no longer be scaled with one multiply */
+        if (delta >> 32)
+            return -1;
+        delta = ((uint64_t)(uint32_t)delta * mult) >> shift;
+        while (delta >= NSEC_PER_SEC) {
+            delta -= NSEC_PER_SEC;
+            sec++;
+        }
+        nsec += (uint32_t)delta;
+        if (nsec >= NSEC_PER_SEC) {
+            nsec -= NSEC_PER_SEC;
+            sec++;
+        }
+    }
+    tp->tv_sec = (time_t)sec;
+    tp->tv_nsec = (long)nsec;
+    return 0;
+}
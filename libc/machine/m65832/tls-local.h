@@ -0,0 +1,16 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#ifndef _TLS_LOCAL_H_
+#define _TLS_LOCAL_H_
+
+extern void *__tls;
+
+void         _set_tls(void *);
+
+void        *__m65832_read_tp(void);
+
+#endif /* _TLS_LOCAL_H_ */
@@ -0,0 +1,34 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Thread pointer for M65832
+ *
+ * The core has no thread register, so the thread pointer is the word
+ * __tls at a fixed address. It points at the start of the current TLS
+ * block with no TCB in front, which is where local-exec offsets are
+ * measured from: crt0 sets it to __tls_base and a scheduler switches
+ * threads by calling _set_tls with the next thread's block, or by
+ * storing into __tls directly from its context switch code.
+ *
+ * Compiled code fetches it through __m65832_read_tp, which returns it
+ * in R0 and touches nothing else, so the compiler can treat the call
+ * like a load.
+ */
+
+#include <picolibc.h>
+
+#ifdef __THREAD_LOCAL_STORAGE
+
+#include "tls-local.h"
+
+void *__tls;
+
+void *
+__m65832_read_tp(void)
+{
+    return __tls;
+}
+
+#endif
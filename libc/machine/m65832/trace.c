@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * -finstrument-functions runtime for M65832, see <machine/trace.h>
+ *
+ * Each hook costs a cycle counter read and two stores. When the
+ * program is also linked with gmon (built with -pg), the entry hook
+ * passes the call on to it as a call graph arc, as gmon did itself
+ * before this file existed.
+ */
+
+#include <machine/trace.h>
+#include <machine/cycles.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NOTRACE __attribute__((no_instrument_function))
+
+/* Records in the default ring */
+#ifndef TRACE_ENTRIES
+#define TRACE_ENTRIES 2048
+#endif
+
+/* Records written per write call */
+#define TRACE_BATCH 64
+
+void __cyg_profile_func_enter(void *this_fn, void *call_site);
+void __cyg_profile_func_exit(void *this_fn, void *call_site);
+
+extern void __gmon_arc(uintptr_t frompc, uintptr_t selfpc) __weak;
+
+static struct m65832_trace_rec  trace_ring[TRACE_ENTRIES];
+static struct m65832_trace_rec *trace_buf = trace_ring;
+static unsigned                 trace_mask = TRACE_ENTRIES - 1;
+static uint32_t                 trace_next; /* records ever made */
+static volatile int             trace_on = 1;
+
+static inline NOTRACE void
+trace_put(uintptr_t fn, uint32_t exit)
+{
+    struct m65832_trace_rec *rec;
+
+    if (!trace_on)
+        return;
+    rec = &trace_buf[trace_next++ & trace_mask];
+    rec->fn = fn;
+    rec->stamp = ((uint32_t)__m65832_cycles() << 1) | exit;
+}
+
+NOTRACE void
+__cyg_profile_func_enter(void *this_fn, void *call_site)
+{
+    trace_put((uintptr_t)this_fn, 0);
+    if (__gmon_arc)
+        __gmon_arc((uintptr_t)call_site, (uintptr_t)this_fn);
+}
+
+NOTRACE void
+__cyg_profile_func_exit(void *this_fn, void *call_site)
+{
+    (void)call_site;
+    trace_put((uintptr_t)this_fn, M65832_TRACE_EXIT);
+}
+
+NOTRACE int
+__m65832_trace_buffer(struct m65832_trace_rec *buf, unsigned entries)
+{
+    int on = trace_on;
+
+    if (!entries || (entries & (entries - 1)) != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    trace_on = 0;
+    trace_buf = buf;
+    trace_mask = entries - 1;
+    trace_next = 0;
+    trace_on = on;
+    return 0;
+}
+
+NOTRACE void
+__m65832_trace_control(int on)
+{
+    trace_on = on;
+}
+
+static NOTRACE int
+trace_write(int fd, const void *buf, size_t len)
+{
+    const char *p = buf;
+
+    while (len) {
+        ssize_t r = write(fd, p, len);
+        if (r <= 0)
+            return -1;
+        p += r;
+        len -= r;
+    }
+    return 0;
+}
+
+NOTRACE int
+__m65832_trace_dump(int fd)
+{
+    struct m65832_trace_hdr hdr;
+    uint32_t                entries = trace_mask + 1;
+    uint32_t                i, n;
+    int                     on = trace_on;
+    int                     ret;
+
+    trace_on = 0;
+    memcpy(hdr.magic, M65832_TRACE_MAGIC, sizeof(hdr.magic));
+    hdr.version = M65832_TRACE_VERSION;
+    hdr.count = trace_next < entries ? trace_next : entries;
+    hdr.lost = trace_next - hdr.count;
+    ret = trace_write(fd, &hdr, sizeof(hdr));
+
+    /* Oldest first; the run may straddle the end of the ring */
+    for (i = hdr.lost; ret == 0 && i != trace_next; i += n) {
+        n = entries - (i & trace_mask);
+        if (n > trace_next - i)
+            n = trace_next - i;
+        if (n > TRACE_BATCH)
+            n = TRACE_BATCH;
+        ret = trace_write(fd, &trace_buf[i & trace_mask], n * sizeof(*trace_buf));
+    }
+    trace_on = on;
+    return ret;
+}
+
+static NOTRACE void
+trace_cleanup(void)
+{
+    static const char fail_msg[] = "trace: cannot write trace.out\n";
+    int               fd;
+
+    trace_on = 0;
+    fd = open("trace.out", O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0 || __m65832_trace_dump(fd) < 0)
+        (void)write(2, fail_msg, sizeof(fail_msg) - 1);
+    if (fd >= 0)
+        close(fd);
+}
+
+static NOTRACE __attribute__((constructor)) void
+trace_init(void)
+{
+    atexit(trace_cleanup);
+}
@@ -0,0 +1,138 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * makecontext and the context stack helper; the switches themselves
+ * are in ucontext.S.
+ *
+ * makecontext points the context at __m65832_context_start with the
+ * stack pointer just below the top of uc_stack, so that setcontext's
+ * RTS enters it like a return from getcontext, with R0 holding the
+ * ucontext. __m65832_context_start calls the function with the saved
+ * arguments and then moves on to uc_link.
+ */
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <machine/ucontext.h>
+#include <machine/heap.h>
+
+typedef void (*context_fn0)(void);
+typedef void (*context_fn1)(int);
+typedef void (*context_fn2)(int, int);
+typedef void (*context_fn3)(int, int, int);
+typedef void (*context_fn4)(int, int, int, int);
+typedef void (*context_fn5)(int, int, int, int, int);
+typedef void (*context_fn6)(int, int, int, int, int, int);
+
+void __m65832_context_start(ucontext_t *ucp);
+
+void
+__m65832_context_start(ucontext_t *ucp)
+{
+    int *a = ucp->__argv;
+
+    switch (ucp->__argc) {
+    case 0:
+        ((context_fn0)ucp->__func)();
+        break;
+    case 1:
+        ((context_fn1)ucp->__func)(a[0]);
+        break;
+    case 2:
+        ((context_fn2)ucp->__func)(a[0], a[1]);
+        break;
+    case 3:
+        ((context_fn3)ucp->__func)(a[0], a[1], a[2]);
+        break;
+    case 4:
+        ((context_fn4)ucp->__func)(a[0], a[1], a[2], a[3]);
+        break;
+    case 5:
+        ((context_fn5)ucp->__func)(a[0], a[1], a[2], a[3], a[4]);
+        break;
+    default:
+        ((context_fn6)ucp->__func)(a[0], a[1], a[2], a[3], a[4], a[5]);
+        break;
+    }
+    if (ucp->uc_link)
+        setcontext(ucp->uc_link);
+    exit(0);
+}
+
+void
+makecontext(ucontext_t *ucp, void (*func)(void), int argc, ...)
+{
+    va_list   ap;
+    uintptr_t top;
+    int       i;
+
+    if (argc < 0)
+        argc = 0;
+    if (argc > M65832_CONTEXT_ARGS)
+        argc = M65832_CONTEXT_ARGS;
+    ucp->__func = func;
+    ucp->__argc = argc;
+    va_start(ap, argc);
+    for (i = 0; i < argc; i++)
+        ucp->__argv[i] = va_arg(ap, int);
+    va_end(ap);
+
+    /*
+     * setcontext pushes the return address in the four bytes above the
+     * saved SP and pops it again, leaving SP at the first free byte
+     * below the top of the stack.
+     */
+    top = ((uintptr_t)ucp->uc_stack.ss_sp + ucp->uc_stack.ss_size) & ~(uintptr_t)3;
+    ucp->uc_mcontext.__sp = (uint32_t)(top - 5);
+    ucp->uc_mcontext.__pc = (uint32_t)(uintptr_t)__m65832_context_start - 1;
+    ucp->uc_mcontext.__r0 = (uint32_t)(uintptr_t)ucp;
+}
+
+int
+__m65832_context_stack(ucontext_t *ucp, size_t size)
+{
+    void *stack = __m65832_malloc_fast(size);
+
+    if (stack == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+    ucp->uc_stack.ss_sp = stack;
+    ucp->uc_stack.ss_size = size;
+    ucp->uc_stack.ss_flags = 0;
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * C11 condition variables. A waiter notes __seq, unlocks the mutex
+ * and blocks until __seq changes, so a signal sent between the unlock
+ * and the block is not lost.
+ */
+
+#include <sys/thrd_sched.h>
+#include <limits.h>
+
+int
+cnd_init(cnd_t *cond)
+{
+    cond->__seq = 0;
+    return thrd_success;
+}
+
+void
+cnd_destroy(cnd_t *cond)
+{
+    (void)cond;
+}
+
+int
+cnd_signal(cnd_t *cond)
+{
+    __atomic_fetch_add(&cond->__seq, 1, __ATOMIC_RELEASE);
+    __thrd_sched_wake(&cond->__seq, 1);
+    return thrd_success;
+}
+
+int
+cnd_broadcast(cnd_t *cond)
+{
+    __atomic_fetch_add(&cond->__seq, 1, __ATOMIC_RELEASE);
+    __thrd_sched_wake(&cond->__seq, INT_MAX);
+    return thrd_success;
+}
+
+int
+cnd_timedwait(cnd_t *__restrict cond, mtx_t *__restrict mtx, const struct timespec *__restrict ts)
+{
+    int seq = __atomic_load_n(&cond->__seq, __ATOMIC_ACQUIRE);
+    int ret, lock;
+
+    mtx_unlock(mtx);
+    ret = __thrd_sched_wait(&cond->__seq, seq, ts);
+    lock = mtx_lock(mtx);
+    if (ret == thrd_success)
+        ret = lock;
+    return ret;
+}
+
+int
+cnd_wait(cnd_t *cond, mtx_t *mtx)
+{
+    return cnd_timedwait(cond, mtx, NULL);
+}
@@ -0,0 +1,25 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#include <picobss.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+extern char __lazy_bss_start[]; /* Start of the __lazy_bss variables */
+extern char __lazy_bss_end[];   /* End of the __lazy_bss variables */
+
+/* Lives in .bss, so crt0 has already cleared it */
+static bool lazy_bss_done;
+
+void
+_init_lazy_bss(void)
+{
+    if (lazy_bss_done)
+        return;
+    memset(__lazy_bss_start, '\0', (uintptr_t)(__lazy_bss_end - __lazy_bss_start));
+    lazy_bss_done = true;
+}
@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * C11 mutexes. An uncontended lock or unlock is a single compare
+ * exchange or exchange on __lock; only when another thread holds the
+ * mutex does the scheduler get involved, through __thrd_sched_wait and
+ * __thrd_sched_wake on the same word.
+ */
+
+#include <sys/thrd_sched.h>
+
+int
+mtx_init(mtx_t *mtx, int type)
+{
+    mtx->__lock = 0;
+    mtx->__type = type;
+    mtx->__owner = NULL;
+    mtx->__count = 0;
+    return thrd_success;
+}
+
+void
+mtx_destroy(mtx_t *mtx)
+{
+    (void)mtx;
+}
+
+static int
+mtx_lock_slow(mtx_t *mtx, const struct timespec *ts)
+{
+    int ret;
+
+    /* Mark the mutex contended so the holder wakes us when it unlocks */
+    while (__atomic_exchange_n(&mtx->__lock, 2, __ATOMIC_ACQUIRE) != 0) {
+        ret = __thrd_sched_wait(&mtx->__lock, 2, ts);
+        if (ret != thrd_success)
+            return ret;
+    }
+    return thrd_success;
+}
+
+static int
+mtx_acquire(mtx_t *mtx, const struct timespec *ts)
+{
+    int    unlocked = 0;
+    thrd_t self;
+    int    ret;
+
+    if (__atomic_compare_exchange_n(&mtx->__lock, &unlocked, 1, 0, __ATOMIC_ACQUIRE,
+                                    __ATOMIC_RELAXED)) {
+        if (mtx->__type & mtx_recursive) {
+            mtx->__owner = __thrd_sched_current();
+            mtx->__count = 1;
+        }
+        return thrd_success;
+    }
+    if (mtx->__type & mtx_recursive) {
+        self = __thrd_sched_current();
+        if (mtx->__owner == self) {
+            mtx->__count++;
+            return thrd_success;
+        }
+        ret = mtx_lock_slow(mtx, ts);
+        if (ret == thrd_success) {
+            mtx->__owner = self;
+            mtx->__count = 1;
+        }
+        return ret;
+    }
+    return mtx_lock_slow(mtx, ts);
+}
+
+int
+mtx_lock(mtx_t *mtx)
+{
+    return mtx_acquire(mtx, NULL);
+}
+
+int
+mtx_timedlock(mtx_t *__restrict mtx, const struct timespec *__restrict ts)
+{
+    return mtx_acquire(mtx, ts);
+}
+
+int
+mtx_trylock(mtx_t *mtx)
+{
+    int unlocked = 0;
+
+    if (__atomic_compare_exchange_n(&mtx->__lock, &unlocked, 1, 0, __ATOMIC_ACQUIRE,
+                                    __ATOMIC_RELAXED)) {
+        if (mtx->__type & mtx_recursive) {
+            mtx->__owner = __thrd_sched_current();
+            mtx->__count = 1;
+        }
+        return thrd_success;
+    }
+    if ((mtx->__type & mtx_recursive) && mtx->__owner == __thrd_sched_current()) {
+        mtx->__count++;
+        return thrd_success;
+    }
+    return thrd_busy;
+}
+
+int
+mtx_unlock(mtx_t *mtx)
+{
+    if (mtx->__type & mtx_recursive) {
+        if (--mtx->__count)
+            return thrd_success;
+        mtx->__owner = NULL;
+    }
+    if (__atomic_exchange_n(&mtx->__lock, 0, __ATOMIC_RELEASE) == 2)
+        __thrd_sched_wake(&mtx->__lock, 1);
+    return thrd_success;
+}
@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#include <picostack.h>
+#include <stdint.h>
+
+extern char __stack[];       /* Top of the stack */
+extern char __stack_limit[]; /* Bottom of the stack */
+
+typedef uint32_t __attribute__((__may_alias__)) stack_word_t;
+
+/* Bytes left alone below the painting function's own locals */
+#define STACK_PAINT_GUARD 64
+
+/*
+ * Must not become a call to memset, whose frame would lie inside the
+ * region being painted
+ */
+void __noinline __no_builtin
+__stack_paint(void)
+{
+    volatile char here;
+    stack_word_t *p = (stack_word_t *)__align_up((uintptr_t)__stack_limit, sizeof(stack_word_t));
+    stack_word_t *end = (stack_word_t *)((uintptr_t)&here - STACK_PAINT_GUARD);
+
+    while (p < end)
+        *p++ = (stack_word_t)__STACK_PAINT_WORD;
+}
+
+size_t
+__stack_high_water(void)
+{
+    const stack_word_t *p
+        = (const stack_word_t *)__align_up((uintptr_t)__stack_limit, sizeof(stack_word_t));
+
+    while ((uintptr_t)p < (uintptr_t)__stack && *p == (stack_word_t)__STACK_PAINT_WORD)
+        p++;
+    return (uintptr_t)__stack - (uintptr_t)p;
+}
+
+size_t
+__stack_size(void)
+{
+    return (uintptr_t)__stack - (uintptr_t)__stack_limit;
+}
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* C11 thread management, passed on to the scheduler */
+
+#include <sys/thrd_sched.h>
+
+int
+thrd_create(thrd_t *thr, thrd_start_t func, void *arg)
+{
+    return __thrd_sched_create(thr, func, arg);
+}
+
+thrd_t
+thrd_current(void)
+{
+    return __thrd_sched_current();
+}
+
+int
+thrd_detach(thrd_t thr)
+{
+    return __thrd_sched_detach(thr);
+}
+
+int
+thrd_equal(thrd_t thr0, thrd_t thr1)
+{
+    return thr0 == thr1;
+}
+
+void
+thrd_exit(int res)
+{
+    __tss_run_dtors();
+    __thrd_sched_exit(res);
+}
+
+int
+thrd_join(thrd_t thr, int *res)
+{
+    return __thrd_sched_join(thr, res);
+}
+
+int
+thrd_sleep(const struct timespec *duration, struct timespec *remaining)
+{
+    return __thrd_sched_sleep(duration, remaining);
+}
+
+void
+thrd_yield(void)
+{
+    __thrd_sched_yield();
+}
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Single-threaded scheduler for <threads.h>, used unless the machine
+ * directory has its own thrd_sched.c. There is only the thread running
+ * main, so a wait can only end by timing out.
+ */
+
+#define _DEFAULT_SOURCE
+#include <sys/thrd_sched.h>
+#include <stdlib.h>
+#include <errno.h>
+
+struct __thrd {
+    int dummy;
+};
+
+static struct __thrd thrd_main;
+
+int
+__thrd_sched_create(thrd_t *thr, thrd_start_t func, void *arg)
+{
+    (void)thr;
+    (void)func;
+    (void)arg;
+    return thrd_error;
+}
+
+thrd_t
+__thrd_sched_current(void)
+{
+    return &thrd_main;
+}
+
+int
+__thrd_sched_detach(thrd_t thr)
+{
+    (void)thr;
+    return thrd_error;
+}
+
+int
+__thrd_sched_join(thrd_t thr, int *res)
+{
+    (void)thr;
+    (void)res;
+    return thrd_error;
+}
+
+void
+__thrd_sched_exit(int res)
+{
+    (void)res;
+    exit(EXIT_SUCCESS);
+}
+
+void
+__thrd_sched_yield(void)
+{
+}
+
+int
+__thrd_sched_sleep(const struct timespec *duration, struct timespec *remaining)
+{
+    if (nanosleep(duration, remaining) == 0)
+        return 0;
+    return errno == EINTR ? -1 : -2;
+}
+
+int
+__thrd_sched_wait(volatile int *addr, int val, const struct timespec *abstime)
+{
+    struct timespec now, rel;
+
+    if (*addr != val)
+        return thrd_success;
+    if (abstime == NULL)
+        return thrd_error;
+    for (;;) {
+        if (clock_gettime(CLOCK_REALTIME, &now) != 0)
+            return thrd_error;
+        rel.tv_sec = abstime->tv_sec - now.tv_sec;
+        rel.tv_nsec = abstime->tv_nsec - now.tv_nsec;
+        if (rel.tv_nsec < 0) {
+            rel.tv_nsec += 1000000000L;
+            rel.tv_sec--;
+        }
+        if (rel.tv_sec < 0)
+            return thrd_timedout;
+        if (nanosleep(&rel, NULL) != 0 && errno != EINTR)
+            return thrd_error;
+    }
+}
+
+void
+__thrd_sched_wake(volatile int *addr, int count)
+{
+    (void)addr;
+    (void)count;
+}
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * C11 thread-specific storage. The values live in a thread-local
+ * array, so with picolibc TLS every thread gets its own copy in its
+ * TLS block and tss_get is one indexed load. Keys and destructors are
+ * shared and change under the libc lock.
+ */
+
+#include <sys/thrd_sched.h>
+#include <sys/lock.h>
+#include <stdint.h>
+
+static __THREAD_LOCAL void *tss_values[__TSS_KEYS_MAX];
+
+static tss_dtor_t tss_dtors[__TSS_KEYS_MAX];
+static uint8_t    tss_used[__TSS_KEYS_MAX];
+
+int
+tss_create(tss_t *key, tss_dtor_t dtor)
+{
+    tss_t k;
+    int   ret = thrd_error;
+
+    __LIBC_LOCK();
+    for (k = 0; k < __TSS_KEYS_MAX; k++) {
+        if (!tss_used[k]) {
+            tss_used[k] = 1;
+            tss_dtors[k] = dtor;
+            tss_values[k] = NULL;
+            *key = k;
+            ret = thrd_success;
+            break;
+        }
+    }
+    __LIBC_UNLOCK();
+    return ret;
+}
+
+void
+tss_delete(tss_t key)
+{
+    if (key >= __TSS_KEYS_MAX)
+        return;
+    __LIBC_LOCK();
+    tss_used[key] = 0;
+    tss_dtors[key] = NULL;
+    __LIBC_UNLOCK();
+}
+
+void *
+tss_get(tss_t key)
+{
+    if (key >= __TSS_KEYS_MAX)
+        return NULL;
+    return tss_values[key];
+}
+
+int
+tss_set(tss_t key, void *val)
+{
+    if (key >= __TSS_KEYS_MAX || !tss_used[key])
+        return thrd_error;
+    tss_values[key] = val;
+    return thrd_success;
+}
+
+void
+__tss_run_dtors(void)
+{
+    int        iter, again;
+    tss_t      k;
+    tss_dtor_t dtor;
+    void      *val;
+
+    for (iter = 0; iter < TSS_DTOR_ITERATIONS; iter++) {
+        again = 0;
+        for (k = 0; k < __TSS_KEYS_MAX; k++) {
+            val = tss_values[k];
+            if (val == NULL)
+                continue;
+            tss_values[k] = NULL;
+            __LIBC_LOCK();
+            dtor = tss_used[k] ? tss_dtors[k] : NULL;
+            __LIBC_UNLOCK();
+            if (dtor != NULL) {
+                dtor(val);
+                again = 1;
+            }
+        }
+        if (!again)
+            break;
+    }
+}
@@ -226,9 +226,25 @@ matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pmatch[], int
     if (g->moffset > -1)
         start = ((dp - g->moffset) < start) ? start : dp - g->moffset;
 
+    /* every match starts with g->prefix, skip to the first one */
+    if (g->plen > 0) {
+        if (g->plen == 1)
+            dp = memchr(start, g->prefix[0], stop - start);
+        else
+            dp = memmem(start, stop - start, g->prefix, g->plen);
+        if (dp == NULL) {
+            STATETEARDOWN(m);
+            return (REG_NOMATCH);
+        }
+        start = dp;
+    }
+
     /* this loop does only one repetition except for backrefs */
     for (;;) {
-        endp = fast(m, start, stop, gf, gl);
+#ifdef REGEX_DFA
+        if (!(g->iflags & USEDFA) || !dfa_fast(g, m->beginp, start, stop, eflags, &m->coldp, &endp))
+#endif
+            endp = fast(m, start, stop, gf, gl);
         if (endp == NULL) { /* a miss */
             STATETEARDOWN(m);
             return (REG_NOMATCH);
@@ -41,14 +41,10 @@
 #include <string.h>
 #include <stdio.h>
 #include "collate.h"
+#include "posix-local.h"
 
 #define EOS           '\0'
 
-#define RANGE_MATCH   1
-#define RANGE_NOMATCH 0
-#define RANGE_ERROR   (-1)
-
-static int rangematch(const char *, char, int, char **);
 
 static int
 _fnmatch(const char *pattern, const char *string, int flags, int level)
@@ -123,7 +119,7 @@ _fnmatch(const char *pattern, const char *string, int flags, int level)
                 && (string == stringstart || ((flags & FNM_PATHNAME) && *(string - 1) == '/')))
                 return (FNM_NOMATCH);
 
-            switch (rangematch(pattern, *string, flags, &newp)) {
+            switch (__fnmatch_rangematch(pattern, *string, flags, &newp)) {
             case RANGE_ERROR:
                 goto norm;
             case RANGE_MATCH:
@@ -184,8 +180,8 @@ static const struct {
 
 #define NUM_CLASSES (sizeof(classes) / sizeof(classes[0]))
 
-static int
-rangematch(const char *pattern, char test, int flags, char **newp)
+int
+__fnmatch_rangematch(const char *pattern, char test, int flags, char **newp)
 {
     int  negate, ok;
     char c, c2;
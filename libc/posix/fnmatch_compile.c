@@ -0,0 +1,265 @@
+/*
+FUNCTION
+<<fnmatch_compile>>, <<fnmatch_exec>>, <<fnmatch_free>>---match many names against one pattern
+
+INDEX
+        fnmatch_compile
+INDEX
+        fnmatch_exec
+INDEX
+        fnmatch_free
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <fnmatch.h>
+        struct fnmatch_pattern *fnmatch_compile(const char *<[pattern]>, int <[flags]>);
+        int fnmatch_exec(const struct fnmatch_pattern *<[compiled]>,
+                         const char *<[string]>);
+        void fnmatch_free(struct fnmatch_pattern *<[compiled]>);
+
+DESCRIPTION
+<<fnmatch_compile>> parses <[pattern]> once for the <<fnmatch>>
+<[flags]> given. Each bracket expression becomes a 256-bit set of
+the bytes it accepts, so escapes, ranges and character classes are
+not looked at again. <<fnmatch_exec>> then matches <[string]> like
+<<fnmatch>>.
+
+<<fnmatch>> tries every position for the text after each <<*>>
+recursively, which is exponential for patterns like <<*a*a*a*b>>.
+<<fnmatch_exec>> only goes back to the most recent <<*>>, so it takes
+at most the pattern length times the string length steps.
+
+Character classes and <<FNM_CASEFOLD>> brackets are evaluated in the
+locale current when the pattern is compiled.
+
+<<fnmatch_free>> releases a compiled pattern.
+
+RETURNS
+<<fnmatch_compile>> returns NULL if there is not enough memory.
+<<fnmatch_exec>> returns 0 if <[string]> matches and
+<<FNM_NOMATCH>> if it does not.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <fnmatch.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "posix-local.h"
+
+enum {
+    FNM_OP_END,  /* end of the pattern */
+    FNM_OP_CHAR, /* one literal byte */
+    FNM_OP_ANY,  /* ? */
+    FNM_OP_STAR, /* one or more adjacent * */
+    FNM_OP_SET,  /* bracket expression, index into sets */
+};
+
+struct fnmatch_op {
+    unsigned char op;
+    unsigned char c;
+    unsigned      set;
+};
+
+struct fnmatch_pattern {
+    int                flags;
+    struct fnmatch_op *ops;
+    uint32_t           sets[][8];
+};
+
+#define SET_HAS(set, c) ((set)[(unsigned char)(c) >> 5] & ((uint32_t)1 << ((c) & 31)))
+
+struct fnmatch_pattern *
+fnmatch_compile(const char *pattern, int flags)
+{
+    struct fnmatch_pattern *cp;
+    struct fnmatch_op      *op;
+    size_t                  nops, nsets;
+    const char             *p;
+    char                   *newp;
+    unsigned                b;
+    int                     c;
+
+    /* Every op but the end takes at least one pattern byte, every set a '[' */
+    nsets = 0;
+    for (p = pattern; *p; p++)
+        if (*p == '[')
+            nsets++;
+    nops = (size_t)(p - pattern) + 1;
+    if (nops > (SIZE_MAX - sizeof(*cp)) / (sizeof(*op) + sizeof(*cp->sets)))
+        return NULL;
+
+    cp = malloc(sizeof(*cp) + nsets * sizeof(*cp->sets) + nops * sizeof(*op));
+    if (!cp)
+        return NULL;
+    cp->flags = flags;
+    cp->ops = (struct fnmatch_op *)(void *)(cp->sets + nsets);
+    nsets = 0;
+
+    op = cp->ops;
+    p = pattern;
+    for (;;) {
+        switch (c = *p++) {
+        case '\0':
+            op->op = FNM_OP_END;
+            return cp;
+        case '?':
+            op->op = FNM_OP_ANY;
+            break;
+        case '*':
+            while (*p == '*')
+                p++;
+            op->op = FNM_OP_STAR;
+            break;
+        case '[':
+            /* Whether the bracket is malformed does not depend on the byte */
+            if (__fnmatch_rangematch(p, 'a', flags, &newp) == RANGE_ERROR)
+                goto literal;
+            memset(cp->sets[nsets], 0, sizeof(cp->sets[nsets]));
+            for (b = 1; b < 256; b++)
+                if (__fnmatch_rangematch(p, (char)b, flags, &newp) == RANGE_MATCH)
+                    cp->sets[nsets][b >> 5] |= (uint32_t)1 << (b & 31);
+            /*
+             * When no byte matches, newp is not set. Nothing can match
+             * this bracket, so the pattern cannot match past it.
+             */
+            for (b = 1; b < 256; b++)
+                if (SET_HAS(cp->sets[nsets], b))
+                    break;
+            if (b == 256) {
+                op->op = FNM_OP_SET;
+                op->set = nsets;
+                op[1].op = FNM_OP_END;
+                return cp;
+            }
+            __fnmatch_rangematch(p, (char)b, flags, &newp);
+            p = newp;
+            op->op = FNM_OP_SET;
+            op->set = nsets++;
+            break;
+        case '\\':
+            if (!(flags & FNM_NOESCAPE) && *p)
+                c = *p++;
+            __fallthrough;
+        default:
+        literal:
+            op->op = FNM_OP_CHAR;
+            op->c = (flags & FNM_CASEFOLD) ? tolower((unsigned char)c) : c;
+            break;
+        }
+        op++;
+    }
+}
+
+/* A period which FNM_PERIOD says only a literal period may match */
+static int
+leading_period(const char *s, const char *start, int flags)
+{
+    return *s == '.' && (flags & FNM_PERIOD)
+        && (s == start || ((flags & FNM_PATHNAME) && s[-1] == '/'));
+}
+
+int
+fnmatch_exec(const struct fnmatch_pattern *cp, const char *string)
+{
+    const struct fnmatch_op *op = cp->ops;
+    const struct fnmatch_op *star_op = NULL;
+    const char              *star_s = NULL;
+    const char              *s = string;
+    int                      flags = cp->flags;
+    unsigned char            c;
+
+    for (;;) {
+        switch (op->op) {
+        case FNM_OP_STAR:
+            if (leading_period(s, string, flags))
+                goto backtrack;
+            /* Only the latest star ever needs to grow */
+            star_op = ++op;
+            star_s = s;
+            continue;
+        case FNM_OP_END:
+            if (*s == '\0' || ((flags & FNM_LEADING_DIR) && *s == '/'))
+                return 0;
+            goto backtrack;
+        }
+
+        c = *s;
+        if (c == '\0')
+            return FNM_NOMATCH;
+
+        switch (op->op) {
+        case FNM_OP_CHAR:
+            if (c != op->c
+                && !((flags & FNM_CASEFOLD) && tolower(c) == op->c))
+                goto backtrack;
+            /* With FNM_PATHNAME no star can reach back past a slash */
+            if (c == '/' && (flags & FNM_PATHNAME))
+                star_op = NULL;
+            break;
+        case FNM_OP_ANY:
+        case FNM_OP_SET:
+            if (c == '/' && (flags & FNM_PATHNAME))
+                goto backtrack;
+            if (leading_period(s, string, flags))
+                goto backtrack;
+            if (op->op == FNM_OP_SET && !SET_HAS(cp->sets[op->set], c))
+                goto backtrack;
+            break;
+        }
+        op++;
+        s++;
+        continue;
+
+    backtrack:
+        if (!star_op || *star_s == '\0' || (*star_s == '/' && (flags & FNM_PATHNAME)))
+            return FNM_NOMATCH;
+        op = star_op;
+        s = ++star_s;
+    }
+}
+
+void
+fnmatch_free(struct fnmatch_pattern *cp)
+{
+    free(cp);
+}
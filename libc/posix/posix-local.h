@@ -37,3 +37,9 @@
 #include <monetary.h>
 
 ssize_t __vstrfmon(char * __restrict buf, size_t size, const char * __restrict format, va_list ap);
+
+#define RANGE_MATCH   1
+#define RANGE_NOMATCH 0
+#define RANGE_ERROR   (-1)
+
+int __fnmatch_rangematch(const char *pattern, char test, int flags, char **newp);
@@ -0,0 +1,221 @@
+/*
+FUNCTION
+<<regcomp_cache>>---share compiled regular expressions
+
+INDEX
+        regcomp_cache
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <regex.h>
+        int regcomp_cache(size_t <[entries]>);
+
+DESCRIPTION
+<<regcomp_cache>> makes <<regcomp>> remember the last <[entries]>
+expressions it compiled, keyed by the pattern bytes, the
+<[cflags]> and the current locale. Compiling one of them again fills
+in the <<regex_t>> with the program already built instead of parsing
+the pattern and allocating a new one. Handles sharing a program can
+be used and freed independently; the program itself is freed once
+the last handle is gone and the cache has dropped it. When full, the
+cache drops the entry compiled or looked up least recently.
+
+Setting <[entries]> to 0, the initial state, turns the cache off and
+drops everything it holds. Changing the size also drops everything.
+
+RETURNS
+<<regcomp_cache>> returns 0, or -1 if there is not enough memory for
+the cache, which is then off.
+
+PORTABILITY
+<<regcomp_cache>> is a picolibc extension.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _NO_REGEX
+
+#define _DEFAULT_SOURCE
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <regex.h>
+#include <sys/lock.h>
+
+#include "utils.h"
+#include "regex2.h"
+#include "locale_private.h"
+
+/*
+ * Each slot holds one reference to its program, counted in
+ * re_guts.refs like the handles beyond the first. refs and the table
+ * are only changed under the libc lock; programs are freed after
+ * dropping it.
+ */
+struct regcache_entry {
+    struct re_guts *g; /* NULL for an empty slot */
+    char           *pattern;
+    size_t          len;
+    int             cflags;
+    locale_t        locale;
+    unsigned long   used; /* regcache_clock at the last lookup or insert */
+};
+
+static struct regcache_entry *regcache;
+static size_t                 regcache_size;
+static unsigned long          regcache_clock;
+
+/* Drop the slot's reference; returns the program if that was the last one */
+static struct re_guts *
+regcache_drop(struct regcache_entry *e)
+{
+    struct re_guts *g = e->g;
+
+    e->g = NULL;
+    if (g != NULL && g->refs) {
+        g->refs--;
+        g = NULL;
+    }
+    return g;
+}
+
+int
+regcomp_cache(size_t entries)
+{
+    struct regcache_entry *old, *table = NULL;
+    size_t                 old_size, i;
+    int                    ret = 0;
+
+    if (entries) {
+        table = calloc(entries, sizeof(*table));
+        if (table == NULL) {
+            entries = 0;
+            ret = -1;
+        }
+    }
+
+    __LIBC_LOCK();
+    old = regcache;
+    old_size = regcache_size;
+    for (i = 0; i < old_size; i++)
+        old[i].g = regcache_drop(&old[i]);
+    regcache = table;
+    regcache_size = entries;
+    __LIBC_UNLOCK();
+
+    for (i = 0; i < old_size; i++) {
+        if (old[i].g != NULL)
+            __regfree_guts(old[i].g);
+        free(old[i].pattern);
+    }
+    free(old);
+    return ret;
+}
+
+int
+__regcache_lookup(regex_t *preg, const char *pattern, size_t len, int cflags)
+{
+    locale_t        locale = __get_current_locale();
+    struct re_guts *g = NULL;
+    size_t          i;
+
+    if (regcache_size == 0)
+        return 0;
+    __LIBC_LOCK();
+    for (i = 0; i < regcache_size; i++) {
+        struct regcache_entry *e = &regcache[i];
+
+        if (e->g != NULL && e->len == len && e->cflags == cflags && e->locale == locale
+            && memcmp(e->pattern, pattern, len) == 0) {
+            g = e->g;
+            g->refs++;
+            e->used = ++regcache_clock;
+            break;
+        }
+    }
+    __LIBC_UNLOCK();
+
+    if (g == NULL)
+        return 0;
+    preg->re_nsub = g->nsub;
+    preg->re_g = g;
+    preg->re_magic = MAGIC1;
+    return 1;
+}
+
+void
+__regcache_insert(const char *pattern, size_t len, int cflags, struct re_guts *g)
+{
+    struct regcache_entry *e;
+    struct re_guts        *old_g = NULL;
+    char                  *copy, *old_pattern = NULL;
+    size_t                 i;
+
+    if (regcache_size == 0)
+        return;
+    copy = malloc(len ? len : 1);
+    if (copy == NULL)
+        return;
+    memcpy(copy, pattern, len);
+
+    __LIBC_LOCK();
+    if (regcache_size != 0) {
+        /* An empty slot, or else the least recently used one */
+        e = &regcache[0];
+        for (i = 0; i < regcache_size && e->g != NULL; i++)
+            if (regcache[i].g == NULL || regcache[i].used < e->used)
+                e = &regcache[i];
+        old_g = regcache_drop(e);
+        old_pattern = e->pattern;
+        e->g = g;
+        e->pattern = copy;
+        e->len = len;
+        e->cflags = cflags;
+        e->locale = __get_current_locale();
+        e->used = ++regcache_clock;
+        g->refs++;
+        copy = NULL;
+    }
+    __LIBC_UNLOCK();
+
+    if (old_g != NULL)
+        __regfree_guts(old_g);
+    free(old_pattern);
+    free(copy);
+}
+
+#endif /* !_NO_REGEX */
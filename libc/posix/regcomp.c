@@ -118,10 +118,14 @@ static void  dofwd(struct parse *p, sopno pos, sop value);
 static void  enlarge(struct parse *p, sopno size);
 static void  stripsnug(struct parse *p, struct re_guts *g);
 static void  findmust(struct parse *p, struct re_guts *g);
+static void  findprefix(struct parse *p, struct re_guts *g);
 static int   altoffset(sop *scan, int offset, int mccs);
 static void  computejumps(struct parse *p, struct re_guts *g);
 static void  computematchjumps(struct parse *p, struct re_guts *g);
 static sopno pluscount(struct parse *p, struct re_guts *g);
+#ifdef REGEX_DFA
+static int   dfaok(struct parse *p, struct re_guts *g);
+#endif
 
 /* ========= end header generated by ./mkh ========= */
 
@@ -203,6 +207,9 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
     } else
         len = strlen((char *)pattern);
 
+    if (__regcache_lookup(preg, pattern, len, cflags))
+        return (0);
+
     /* do the mallocs early so failure handling is easy */
     g = (struct re_guts *)malloc(sizeof(struct re_guts));
     if (g == NULL)
@@ -243,6 +250,10 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
     g->categories = &g->catspace[-(CHAR_MIN)];
     (void)memset((char *)g->catspace, 0, NC * sizeof(cat_t));
     g->backrefs = 0;
+    g->prefix = NULL;
+    g->plen = 0;
+    g->dfa = NULL;
+    g->refs = 0;
 
     /* do it */
     EMIT(OEND, 0);
@@ -260,6 +271,7 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
     categorize(p, g);
     stripsnug(p, g);
     findmust(p, g);
+    findprefix(p, g);
     /* only use Boyer-Moore algorithm if the pattern is bigger
      * than three characters
      */
@@ -272,6 +284,10 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
         }
     }
     g->nplus = pluscount(p, g);
+#ifdef REGEX_DFA
+    if (dfaok(p, g))
+        g->iflags |= USEDFA;
+#endif
     g->magic = MAGIC2;
     preg->re_nsub = g->nsub;
     preg->re_g = g;
@@ -285,6 +301,8 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
     /* win or lose, we're done */
     if (p->error != 0) /* lose */
         regfree(preg);
+    else
+        __regcache_insert(pattern, len, cflags, g);
     return (p->error);
 }
 
@@ -1762,6 +1780,51 @@ findmust(struct parse *p, struct re_guts *g)
     *cp++ = '\0'; /* just on general principles */
 }
 
+/*
+ - findprefix - find the literal string every match starts with
+ == static void findprefix(struct parse *p, struct re_guts *g);
+ *
+ * Zero-width anchors, parentheses and the first pass through a + loop
+ * do not separate the leading OCHARs.  regexec() skips straight to the
+ * first place this string occurs.
+ */
+static void
+findprefix(struct parse *p, struct re_guts *g)
+{
+    sop  *scan;
+    sop   s;
+    int   n;
+    char *cp;
+
+    /* avoid making error situations worse */
+    if (p->error != 0)
+        return;
+
+    n = 0;
+    for (scan = g->strip + 1;; scan++) {
+        s = *scan;
+        if (OP(s) == OCHAR)
+            n++;
+        else if (OP(s) != OPLUS_ && OP(s) != OLPAREN && OP(s) != ORPAREN && OP(s) != OBOL
+                 && OP(s) != OBOW)
+            break;
+    }
+    if (n == 0)
+        return;
+
+    g->prefix = malloc((size_t)n + 1);
+    if (g->prefix == NULL)
+        return;
+    g->plen = n;
+    cp = g->prefix;
+    for (scan = g->strip + 1; n > 0; scan++)
+        if (OP(s = *scan) == OCHAR) {
+            *cp++ = (char)OPND(s);
+            n--;
+        }
+    *cp = '\0';
+}
+
 /*
  - altoffset - choose biggest offset among multiple choices
  == static int altoffset(sop *scan, int offset, int mccs);
@@ -1958,6 +2021,9 @@ computematchjumps(struct parse *p, struct re_guts *g)
 /*
  - pluscount - count + nesting
  == static sopno pluscount(struct parse *p, struct re_guts *g);
+#ifdef REGEX_DFA
+static int   dfaok(struct parse *p, struct re_guts *g);
+#endif
  */
 static sopno /* nesting depth */
 pluscount(struct parse *p, struct re_guts *g)
@@ -1988,3 +2054,27 @@ pluscount(struct parse *p, struct re_guts *g)
         g->iflags |= BAD;
     return (maxnest);
 }
+
+#ifdef REGEX_DFA
+/*
+ - dfaok - can regexec() run the DFA in regdfa.c for this expression?
+ == static int dfaok(struct parse *p, struct re_guts *g);
+ *
+ * The DFA knows nothing of back references, and leaves out the word
+ * boundary steps so that it does not depend on the locale.
+ */
+static int
+dfaok(struct parse *p, struct re_guts *g)
+{
+    sopno i;
+
+    if (p->error != 0 || g->backrefs)
+        return (0);
+    if (DFA_STATESIZE(g) * DFA_MINSTATES > REGEX_DFA_MAX)
+        return (0);
+    for (i = 0; i < g->nstates; i++)
+        if (OP(g->strip[i]) == OBOW || OP(g->strip[i]) == OEOW)
+            return (0);
+    return (1);
+}
+#endif
@@ -0,0 +1,330 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A lazily built DFA standing in for fast().  This file is #included by
+ * regexec.c after the large version of engine.c, whose lstep() computes
+ * the transitions, and is only used for expressions regcomp() marked
+ * USEDFA.
+ *
+ * A DFA state is the set of NFA states fast() holds at the top of its
+ * loop, plus whether the character before it lets ^ match.  Characters
+ * are reduced to the categories regcomp() sorted them into, which step()
+ * cannot tell apart; under REG_NEWLINE '\n' gets a class of its own as it
+ * also places ^ and $.  States are added as the text reaches them until
+ * the tables hold REGEX_DFA_MAX bytes; then the cache starts over, and a
+ * search that keeps filling it goes back to fast().
+ *
+ * A regex_t may be shared between threads, so a search takes the cache
+ * out of the re_guts under the libc lock and puts it back when done.  A
+ * search finding it gone builds a private one.
+ */
+
+#define DFA_UNKNOWN (-1) /* transition not computed yet */
+#define DFA_ACCEPT  (-2) /* the expression matched */
+#define DFA_FULL    (-3) /* no room for another state */
+
+#define DFA_BOL   01 /* the previous character lets ^ match */
+#define DFA_FRESH 02 /* no match underway, the set is a fresh start */
+
+/* give up if the cache fills again within this many bytes per state */
+#define DFA_MINRUN 4
+
+struct re_dfa {
+    int            nclass;      /* input classes */
+    int            newline;     /* class of \n under REG_NEWLINE, else -1 */
+    sopno          nnfa;        /* NFA states, g->nstates */
+    size_t         setsize;     /* bytes in a packed set of NFA states */
+    int            nstate;      /* states in use */
+    int            maxstate;    /* states allocated */
+    int            limit;       /* states fitting in REGEX_DFA_MAX */
+    short         *trans;       /* [maxstate][nclass] next state */
+    uch           *sets;        /* [maxstate][setsize] packed NFA states */
+    uch           *flags;       /* [maxstate] DFA_BOL, DFA_FRESH */
+    char          *fresh;       /* [nnfa] the set fast() starts from */
+    char          *st;          /* [nnfa] work sets for lstep() */
+    char          *tmp;         /* [nnfa] */
+    uch           *pack;        /* [setsize] state being added */
+    unsigned short class[NC];   /* input class of each (uch) character */
+    char           rep[NC + 1]; /* a character of each class */
+};
+
+static size_t
+dfa_size(struct re_dfa *d, int maxstate)
+{
+    return sizeof(struct re_dfa)
+        + (size_t)maxstate * (d->nclass * sizeof(short) + d->setsize + 1) + 3 * (size_t)d->nnfa
+        + d->setsize;
+}
+
+/* point the arrays into the memory following *d */
+static void
+dfa_layout(struct re_dfa *d)
+{
+    char *p = (char *)(d + 1);
+
+    d->trans = (short *)p;
+    p += (size_t)d->maxstate * d->nclass * sizeof(short);
+    d->sets = (uch *)p;
+    p += (size_t)d->maxstate * d->setsize;
+    d->flags = (uch *)p;
+    p += d->maxstate;
+    d->fresh = p;
+    p += d->nnfa;
+    d->st = p;
+    p += d->nnfa;
+    d->tmp = p;
+    p += d->nnfa;
+    d->pack = (uch *)p;
+}
+
+static struct re_dfa *
+dfa_new(struct re_guts *g)
+{
+    struct re_dfa  d0;
+    struct re_dfa *d;
+    int            c;
+    int            k;
+
+    d0.nclass = DFA_NCLASS(g);
+    d0.newline = (g->cflags & REG_NEWLINE) ? g->ncategories : -1;
+    d0.nnfa = g->nstates;
+    d0.setsize = ((size_t)g->nstates + CHAR_BIT - 1) / CHAR_BIT;
+    d0.nstate = 0;
+    d0.maxstate = DFA_MINSTATES;
+    d0.limit = REGEX_DFA_MAX / DFA_STATESIZE(g);
+    if (d0.limit > SHRT_MAX)
+        d0.limit = SHRT_MAX;
+
+    d = malloc(dfa_size(&d0, d0.maxstate));
+    if (d == NULL)
+        return (NULL);
+    *d = d0;
+    dfa_layout(d);
+
+    for (c = CHAR_MAX; c >= CHAR_MIN; c--) {
+        k = g->categories[c];
+        if (c == '\n' && d->newline >= 0)
+            k = d->newline;
+        d->class[(uch)c] = k;
+        d->rep[k] = c;
+    }
+
+    memset(d->fresh, 0, d->nnfa);
+    d->fresh[g->firststate + 1] = 1;
+    lstep(g, g->firststate + 1, g->laststate, d->fresh, NOTHING, d->fresh);
+    return (d);
+}
+
+/* a copy of *d with room for more states, d is freed */
+static struct re_dfa *
+dfa_grow(struct re_dfa *d)
+{
+    struct re_dfa *n;
+    int            maxstate = d->maxstate * 2;
+
+    if (maxstate > d->limit)
+        maxstate = d->limit;
+    n = malloc(dfa_size(d, maxstate));
+    if (n == NULL)
+        return (NULL);
+    *n = *d;
+    n->maxstate = maxstate;
+    dfa_layout(n);
+    memcpy(n->trans, d->trans, (size_t)d->nstate * d->nclass * sizeof(short));
+    memcpy(n->sets, d->sets, (size_t)d->nstate * d->setsize);
+    memcpy(n->flags, d->flags, d->nstate);
+    memcpy(n->fresh, d->fresh, 3 * (size_t)d->nnfa + d->setsize);
+    free(d);
+    return (n);
+}
+
+/* the state for NFA states set and flags, added if new */
+static int
+dfa_add(struct re_dfa **dp, char *set, int flags)
+{
+    struct re_dfa *d = *dp;
+    sopno          i;
+    int            s;
+
+    memset(d->pack, 0, d->setsize);
+    for (i = 0; i < d->nnfa; i++)
+        if (set[i])
+            d->pack[i / CHAR_BIT] |= 1 << (i % CHAR_BIT);
+
+    for (s = 0; s < d->nstate; s++)
+        if (d->flags[s] == flags && memcmp(&d->sets[s * d->setsize], d->pack, d->setsize) == 0)
+            return (s);
+
+    if (d->nstate == d->maxstate) {
+        if (d->maxstate == d->limit || (d = dfa_grow(d)) == NULL)
+            return (DFA_FULL);
+        *dp = d;
+    }
+    s = d->nstate++;
+    memcpy(&d->sets[s * d->setsize], d->pack, d->setsize);
+    d->flags[s] = flags;
+    for (i = 0; i < d->nclass; i++)
+        d->trans[s * d->nclass + i] = DFA_UNKNOWN;
+    return (s);
+}
+
+/* unpack state s into d->st and take the ^ and $ steps fast() would */
+static void
+dfa_anchors(struct re_guts *g, struct re_dfa *d, int s, int eol)
+{
+    sopno i;
+    int   flagch = '\0';
+    int   n = 0;
+
+    for (i = 0; i < d->nnfa; i++)
+        d->st[i] = (d->sets[s * d->setsize + i / CHAR_BIT] >> (i % CHAR_BIT)) & 1;
+    if (d->flags[s] & DFA_BOL) {
+        flagch = BOL;
+        n = g->nbol;
+    }
+    if (eol) {
+        flagch = (flagch == BOL) ? BOLEOL : EOL;
+        n += g->neol;
+    }
+    for (; n > 0; n--) {
+        /*
+         * sstep() gets the set before the step by value, so it only
+         * passes the first of several anchors in a row
+         */
+        if (g->nstates <= (sopno)(CHAR_BIT * sizeof(long))) {
+            memcpy(d->tmp, d->st, d->nnfa);
+            lstep(g, g->firststate + 1, g->laststate, d->tmp, flagch, d->st);
+        } else
+            lstep(g, g->firststate + 1, g->laststate, d->st, flagch, d->st);
+    }
+}
+
+/*
+ * what fast() does with a character of class k in state s: DFA_ACCEPT,
+ * or the flags of the next state, whose NFA states are left in d->tmp
+ */
+static int
+dfa_step(struct re_guts *g, struct re_dfa *d, int s, int k)
+{
+    dfa_anchors(g, d, s, k == d->newline);
+    if (d->st[g->laststate])
+        return (DFA_ACCEPT);
+    memcpy(d->tmp, d->fresh, d->nnfa);
+    lstep(g, g->firststate + 1, g->laststate, d->st, d->rep[k], d->tmp);
+    return ((memcmp(d->tmp, d->fresh, d->nnfa) == 0 ? DFA_FRESH : 0)
+            | (k == d->newline ? DFA_BOL : 0));
+}
+
+/*
+ - dfa_fast - fast() on the DFA
+ *
+ * Returns 0 without a result if fast() should do the work after all.
+ */
+static int
+dfa_fast(struct re_guts *g, char *beginp, char *start, char *stop, int eflags, char **coldp,
+         char **endp)
+{
+    struct re_dfa *d;
+    char          *p;
+    char          *cold = start;
+    char          *flushed = NULL;
+    int            s;
+    int            t;
+    int            f;
+    int            k;
+
+    __LIBC_LOCK();
+    d = g->dfa;
+    g->dfa = NULL;
+    __LIBC_UNLOCK();
+    if (d == NULL && (d = dfa_new(g)) == NULL)
+        return (0);
+
+    if (start == beginp)
+        f = DFA_FRESH | (!(eflags & REG_NOTBOL) ? DFA_BOL : 0);
+    else
+        f = DFA_FRESH | ((start[-1] == '\n' && (g->cflags & REG_NEWLINE)) ? DFA_BOL : 0);
+    s = dfa_add(&d, d->fresh, f);
+    if (s == DFA_FULL) {
+        d->nstate = 0;
+        s = dfa_add(&d, d->fresh, f);
+    }
+
+    for (p = start;; p++) {
+        if (d->flags[s] & DFA_FRESH)
+            cold = p;
+        if (p == stop) {
+            dfa_anchors(g, d, s, !(eflags & REG_NOTEOL));
+            t = d->st[g->laststate] ? DFA_ACCEPT : DFA_UNKNOWN;
+            break;
+        }
+        k = d->class[(uch)*p];
+        t = d->trans[s * d->nclass + k];
+        if (t == DFA_UNKNOWN) {
+            t = f = dfa_step(g, d, s, k);
+            if (f != DFA_ACCEPT) {
+                t = dfa_add(&d, d->tmp, f);
+                if (t == DFA_FULL) {
+                    /* start over, unless that keeps happening */
+                    if (flushed != NULL && p - flushed < (ptrdiff_t)d->limit * DFA_MINRUN)
+                        break;
+                    flushed = p;
+                    d->nstate = 0;
+                    s = dfa_add(&d, d->tmp, f);
+                    continue;
+                }
+            }
+            d->trans[s * d->nclass + k] = t;
+        }
+        if (t == DFA_ACCEPT)
+            break;
+        s = t;
+    }
+
+    __LIBC_LOCK();
+    if (g->dfa == NULL) {
+        g->dfa = d;
+        d = NULL;
+    }
+    __LIBC_UNLOCK();
+    free(d);
+
+    if (t == DFA_FULL)
+        return (0);
+    *coldp = cold;
+    *endp = (t == DFA_ACCEPT) ? p + 1 : NULL;
+    return (1);
+}
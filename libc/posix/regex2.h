@@ -152,6 +152,7 @@ struct re_guts {
 #define USEBOL 01       /* used ^ */
 #define USEEOL 02       /* used $ */
 #define BAD    04       /* something wrong */
+#define USEDFA 010      /* regexec() may run the DFA instead of fast() */
     int    nbol;        /* number of ^ used */
     int    neol;        /* number of $ used */
     int    ncategories; /* how many character categories */
@@ -164,10 +165,37 @@ struct re_guts {
     size_t nsub;        /* copy of re_nsub */
     int    backrefs;    /* does it use back references? */
     sopno  nplus;       /* how deep does it nest +s? */
+    char  *prefix;      /* every match starts with this string */
+    int    plen;        /* length of prefix */
+    struct re_dfa *dfa; /* cached DFA, see regdfa.c */
+    unsigned refs;      /* other owners: handles and regcomp_cache slots */
     /* catspace must be last */
     cat_t  catspace[NC]; /* categories */
 };
 
+/*
+ * regexec() runs a lazily built DFA instead of fast() on expressions
+ * without back references or word boundaries, caching at most
+ * REGEX_DFA_MAX bytes of states per expression
+ */
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+#define REGEX_DFA
+#ifndef REGEX_DFA_MAX
+#define REGEX_DFA_MAX 16384
+#endif
+#define DFA_MINSTATES 8
+/* input classes, the categories plus one for \n under REG_NEWLINE */
+#define DFA_NCLASS(g) ((g)->ncategories + (((g)->cflags & REG_NEWLINE) != 0))
+/* bytes per state: transitions, packed NFA state set and flags */
+#define DFA_STATESIZE(g) \
+    (DFA_NCLASS(g) * sizeof(short) + ((size_t)(g)->nstates + CHAR_BIT - 1) / CHAR_BIT + 1)
+#endif
+
+/* regcomp_cache, see regcache.c */
+int  __regcache_lookup(regex_t *preg, const char *pattern, size_t len, int cflags);
+void __regcache_insert(const char *pattern, size_t len, int cflags, struct re_guts *g);
+void __regfree_guts(struct re_guts *g);
+
 /* misc utilities */
 #define OUT       (CHAR_MAX + 1) /* a non-character value */
 #define ISWORD(c) (isalnum((uch)(c)) || (c) == '_')
@@ -46,6 +46,7 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
  * macros that code uses.  This lets the same code operate on two different
  * representations for state sets.
  */
+#define _GNU_SOURCE
 #include <sys/types.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -53,6 +54,7 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <ctype.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -61,6 +63,11 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 static int nope = 0; /* for use in asserts; shuts lint up */
 #endif
 
+#ifdef REGEX_DFA
+static int dfa_fast(struct re_guts *g, char *beginp, char *start, char *stop, int eflags,
+                    char **coldp, char **endp);
+#endif
+
 /* macros for manipulating states, small version */
 #define states           long
 #define states1          states /* for later use in regexec() decision */
@@ -146,6 +153,10 @@ static int nope = 0; /* for use in asserts; shuts lint up */
 
 #include "engine.c"
 
+#ifdef REGEX_DFA
+#include "regdfa.c"
+#endif
+
 /*
  - regexec - interface for matching
  = extern int regexec(const regex_t *__restrict, const char *__restrict,
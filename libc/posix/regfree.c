@@ -44,6 +44,7 @@ static char sccsid[] = "@(#)regfree.c	8.3 (Berkeley) 3/20/94";
 #include <stdlib.h>
 #include <limits.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -64,7 +65,22 @@ regfree(regex_t *preg)
     if (g == NULL || g->magic != MAGIC2) /* oops again */
         return;
     preg->re_magic = 0; /* mark it invalid */
-    g->magic = 0;       /* mark it invalid */
+
+    /* Shared through regcomp_cache; someone else frees it */
+    __LIBC_LOCK();
+    if (g->refs) {
+        g->refs--;
+        g = NULL;
+    }
+    __LIBC_UNLOCK();
+    if (g != NULL)
+        __regfree_guts(g);
+}
+
+void
+__regfree_guts(struct re_guts *g)
+{
+    g->magic = 0; /* mark it invalid */
 
     if (g->strip != NULL)
         free((char *)g->strip);
@@ -78,6 +94,10 @@ regfree(regex_t *preg)
         free(g->charjump);
     if (g->matchjump != NULL)
         free(g->matchjump);
+    if (g->prefix != NULL)
+        free(g->prefix);
+    if (g->dfa != NULL)
+        free(g->dfa);
     free((char *)g);
 }
 
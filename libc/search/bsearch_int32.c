@@ -0,0 +1,163 @@
+/*
+FUNCTION
+<<bsearch_int32>>, <<bsearch_uint32>>, <<bsearch_int64>>, <<eytzinger_int32>>, <<eytzinger_bsearch_int32>>---search a sorted array of a fixed type
+
+INDEX
+        bsearch_int32
+INDEX
+        bsearch_uint32
+INDEX
+        bsearch_int64
+INDEX
+        eytzinger_int32
+INDEX
+        eytzinger_uint32
+INDEX
+        eytzinger_int64
+INDEX
+        eytzinger_bsearch_int32
+INDEX
+        eytzinger_bsearch_uint32
+INDEX
+        eytzinger_bsearch_int64
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <stdlib.h>
+        int32_t *bsearch_int32(int32_t <[key]>, const int32_t *<[base]>, size_t <[nmemb]>);
+        uint32_t *bsearch_uint32(uint32_t <[key]>, const uint32_t *<[base]>, size_t <[nmemb]>);
+        int64_t *bsearch_int64(int64_t <[key]>, const int64_t *<[base]>, size_t <[nmemb]>);
+        void eytzinger_int32(int32_t *<[tree]>, const int32_t *<[sorted]>, size_t <[nmemb]>);
+        int32_t *eytzinger_bsearch_int32(int32_t <[key]>, const int32_t *<[tree]>,
+                                         size_t <[nmemb]>);
+
+DESCRIPTION
+<<bsearch_int32>>, <<bsearch_uint32>> and <<bsearch_int64>> search
+the <[nmemb]> elements at <[base]>, which must be sorted in ascending
+order, for <[key]>, like <<bsearch>> with the obvious comparison
+function. The comparison is inlined and each step only selects the
+next position, so the loop runs exactly ceil(log2(<[nmemb]>)) times
+with no data-dependent branches.
+
+<<eytzinger_int32>> copies the <[nmemb]> ascending elements at
+<[sorted]> into <[tree]> in Eytzinger (breadth-first binary tree)
+order: element k has children 2k+1 and 2k+2. The top levels of every
+search then share the first few cache lines of <[tree]>.
+<<eytzinger_bsearch_int32>> searches such a copy for <[key]>. The
+<<uint32>> and <<int64>> versions work the same way.
+
+RETURNS
+The search functions return a pointer to an element equal to
+<[key]>, or NULL if there is none. When several elements match, the
+search may return any of them.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+
+/*
+ * This file is also the template for the other element types, which
+ * define BSEARCH_TYPE and BSEARCH_SUFFIX before including it.
+ */
+#ifndef BSEARCH_TYPE
+#define BSEARCH_TYPE   int32_t
+#define BSEARCH_SUFFIX int32
+#endif
+
+#define BSEARCH_CAT2(a, b)  a##b
+#define BSEARCH_CAT(a, b)   BSEARCH_CAT2(a, b)
+#define BSEARCH_NAME(n)     BSEARCH_CAT(n, BSEARCH_SUFFIX)
+#define BSEARCH_FILL        BSEARCH_NAME(eytzinger_fill_)
+
+BSEARCH_TYPE *
+BSEARCH_NAME(bsearch_)(BSEARCH_TYPE key, const BSEARCH_TYPE *base, size_t nmemb)
+{
+    if (nmemb == 0)
+        return NULL;
+
+    /* The last element <= key lies in [base, base + nmemb) */
+    while (nmemb > 1) {
+        size_t half = nmemb / 2;
+
+        base = (base[half] <= key) ? base + half : base;
+        nmemb -= half;
+    }
+    return *base == key ? (BSEARCH_TYPE *)base : NULL;
+}
+
+/* Store sorted[i...] at the in-order positions of the subtree at k */
+static size_t
+BSEARCH_FILL(BSEARCH_TYPE *tree, const BSEARCH_TYPE *sorted, size_t i, size_t k, size_t nmemb)
+{
+    if (k <= nmemb) {
+        i = BSEARCH_FILL(tree, sorted, i, 2 * k, nmemb);
+        tree[k - 1] = sorted[i++];
+        i = BSEARCH_FILL(tree, sorted, i, 2 * k + 1, nmemb);
+    }
+    return i;
+}
+
+void
+BSEARCH_NAME(eytzinger_)(BSEARCH_TYPE *tree, const BSEARCH_TYPE *sorted, size_t nmemb)
+{
+    (void)BSEARCH_FILL(tree, sorted, 0, 1, nmemb);
+}
+
+BSEARCH_TYPE *
+BSEARCH_NAME(eytzinger_bsearch_)(BSEARCH_TYPE key, const BSEARCH_TYPE *tree, size_t nmemb)
+{
+    size_t k = 1;
+
+    /* Descend with 1-based node numbers, going right past smaller keys */
+    while (k <= nmemb)
+        k = 2 * k + (tree[k - 1] < key);
+
+    /* Undo the right turns and the final left one to reach the first
+     * node >= key; nothing is left if every key was smaller */
+    while (k & 1)
+        k >>= 1;
+    k >>= 1;
+
+    if (k == 0 || tree[k - 1] != key)
+        return NULL;
+    return (BSEARCH_TYPE *)&tree[k - 1];
+}
@@ -49,6 +49,7 @@ BUFHEAD   *__get_buf(HTAB *, __uint32_t, BUFHEAD *, int);
 int        __get_page(HTAB *, char *, __uint32_t, int, int, int);
 int        __ibitmap(HTAB *, int, int, int);
 __uint32_t __log2(__uint32_t);
+char      *__map_page(HTAB *, __uint32_t, int);
 int        __put_page(HTAB *, char *, __uint32_t, int, int);
 void       __reclaim_buf(HTAB *, BUFHEAD *);
 int        __split_page(HTAB *, __uint32_t, __uint32_t);
@@ -33,6 +33,7 @@
 #define _DEFAULT_SOURCE
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
@@ -62,8 +63,10 @@ static void *hash_realloc(SEGMENT **, int, int);
 static int   hash_seq(const DB *, DBT *, DBT *, u_int);
 static int   hash_sync(const DB *, u_int);
 static int   hdestroy(HTAB *);
+static DB   *hash_open(const char *, int, int, const HASHINFO *, const void *, size_t);
 static HTAB *init_hash(HTAB *, const char *, const HASHINFO *);
 static int   init_htab(HTAB *, int);
+static void  map_file(HTAB *);
 #if (_BYTE_ORDER == _LITTLE_ENDIAN)
 static void swap_header(HTAB *);
 static void swap_header_copy(HASHHDR *, HASHHDR *);
@@ -95,16 +98,41 @@ static void swap_header_copy(HASHHDR *, HASHHDR *);
 int hash_accesses, hash_collisions, hash_expansions, hash_overflows;
 #endif
 
+/* Targets without mmap read pages with read(2) */
+extern void *mmap(void *, size_t, int, int, int, off_t) __weak;
+extern int   munmap(void *, size_t) __weak;
+
 /************************** INTERFACE ROUTINES ***************************/
 /* OPEN/CLOSE */
 
 extern DB *
 __hash_open(const char *file, int flags, int mode, int dflags,
             const HASHINFO *info) /* Special directives for create */
+{
+    (void)dflags;
+    return (hash_open(file, flags, mode, info, NULL, 0));
+}
+
+/*
+ * Open a table held in memory, such as one linked into flash. The
+ * table is read-only; pages are used in place where possible.
+ */
+extern DB *
+__hash_open_image(const void *image, size_t size, const HASHINFO *info)
+{
+    if (!image) {
+        errno = EINVAL;
+        return (NULL);
+    }
+    return (hash_open(NULL, O_RDONLY, 0, info, image, size));
+}
+
+static DB *
+hash_open(const char *file, int flags, int mode, const HASHINFO *info, const void *image,
+          size_t size)
 {
     HTAB *hashp;
 
-    (void)dflags;
 #ifdef __USE_INTERNAL_STAT64
     struct stat64 statbuf;
 #else
@@ -121,6 +149,8 @@ __hash_open(const char *file, int flags, int mode, int dflags,
     if (!(hashp = (HTAB *)calloc(1, sizeof(HTAB))))
         return (NULL);
     hashp->fp = -1;
+    hashp->map = image;
+    hashp->maplen = size;
 
     /*
      * Even if user wants write only, we need to be able to read
@@ -131,11 +161,11 @@ __hash_open(const char *file, int flags, int mode, int dflags,
     hashp->flags = flags;
 
     new_table = 0;
-    if (!file || (flags & O_TRUNC) ||
+    if ((!file && !image) || (file && ((flags & O_TRUNC) ||
 #ifdef __USE_INTERNAL_STAT64
-        (stat64(file, &statbuf) && (errno == ENOENT))) {
+                                       (stat64(file, &statbuf) && (errno == ENOENT))))) {
 #else
-        (stat(file, &statbuf) && (errno == ENOENT))) {
+                                       (stat(file, &statbuf) && (errno == ENOENT))))) {
 #endif
         if (errno == ENOENT)
             errno = 0; /* Just in case someone looks at errno */
@@ -169,7 +199,16 @@ __hash_open(const char *file, int flags, int mode, int dflags,
         else
             hashp->hash = __default_hash;
 
-        hdrsize = read(hashp->fp, &hashp->hdr, sizeof(HASHHDR));
+        /* Read-only tables are mapped so pages can be used in place */
+        if (file && (flags & O_ACCMODE) == O_RDONLY)
+            map_file(hashp);
+        if (hashp->map) {
+            hdrsize = sizeof(HASHHDR);
+            if (hashp->maplen < sizeof(HASHHDR))
+                hdrsize = hashp->maplen;
+            memcpy(&hashp->hdr, hashp->map, hdrsize);
+        } else
+            hdrsize = read(hashp->fp, &hashp->hdr, sizeof(HASHHDR));
 #if (_BYTE_ORDER == _LITTLE_ENDIAN)
         swap_header(hashp);
 #endif
@@ -252,8 +291,11 @@ __hash_open(const char *file, int flags, int mode, int dflags,
     return (dbp);
 
 error1:
-    if (hashp != NULL)
+    if (hashp != NULL) {
+        if (hashp->unmap)
+            (void)munmap((void *)hashp->map, hashp->maplen);
         (void)close(hashp->fp);
+    }
 
 error0:
     free(hashp);
@@ -293,6 +335,34 @@ hash_fd(const DB *dbp)
 }
 
 /************************** LOCAL CREATION ROUTINES **********************/
+static void
+map_file(HTAB *hashp)
+{
+#ifdef __USE_INTERNAL_STAT64
+    struct stat64 statbuf;
+#else
+    struct stat statbuf;
+#endif
+    void *map;
+
+    if (!mmap || !munmap)
+        return;
+#ifdef __USE_INTERNAL_STAT64
+    if (fstat64(hashp->fp, &statbuf) || statbuf.st_size < (off_t)sizeof(HASHHDR))
+#else
+    if (fstat(hashp->fp, &statbuf) || statbuf.st_size < (off_t)sizeof(HASHHDR))
+#endif
+        return;
+    if ((off_t)(size_t)statbuf.st_size != statbuf.st_size)
+        return;
+    map = mmap(NULL, (size_t)statbuf.st_size, PROT_READ, MAP_PRIVATE, hashp->fp, 0);
+    if (map == MAP_FAILED)
+        return;
+    hashp->map = map;
+    hashp->maplen = (size_t)statbuf.st_size;
+    hashp->unmap = 1;
+}
+
 static HTAB *
 init_hash(HTAB *hashp, const char *file, const HASHINFO *info)
 {
@@ -445,6 +515,8 @@ hdestroy(HTAB *hashp)
         if (hashp->mapp[i])
             free(hashp->mapp[i]);
 
+    if (hashp->unmap)
+        (void)munmap((void *)hashp->map, hashp->maplen);
     if (hashp->fp != -1)
         (void)close(hashp->fp);
 
@@ -901,7 +973,8 @@ alloc_segs(HTAB *hashp, int nsegs)
         return (-1);
     }
     hashp->dir[0] = store;
-    for (i = 1; i < nsegs; i++, hashp->nsegs++)
+    hashp->nsegs = nsegs;
+    for (i = 1; i < nsegs; i++)
         hashp->dir[i] = &store[i << hashp->SSHIFT];
     return (0);
 }
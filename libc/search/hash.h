@@ -64,6 +64,8 @@ struct _bufhead {
     BUFHEAD   *ovfl; /* Overflow page buffer header */
     __uint32_t addr; /* Address of this page */
     char      *page; /* Actual page data */
+    char      *buf;  /* Page storage, unused while page points into
+                      * a mapped image */
     char       flags;
 #define BUF_MOD    0x0001
 #define BUF_DISK   0x0002
@@ -138,6 +140,18 @@ typedef struct htab { /* Memory resident data structure */
                                 * allocate */
     BUFHEAD     bufhead;       /* Header of buffer lru list */
     SEGMENT    *dir;           /* Hash Bucket directory */
+    const char *map;           /* Read-only image of the file */
+    size_t      maplen;        /* Length of the image */
+    int         unmap;         /* Image was mapped by hash_open */
+    struct {                   /* Buffer pool statistics */
+        unsigned long hits;      /* Page found in a buffer */
+        unsigned long misses;    /* Page needed a buffer */
+        unsigned long reads;     /* Pages copied from file or image */
+        unsigned long mapped;    /* Pages used in place */
+        unsigned long writes;    /* Pages written to the file */
+        unsigned long evictions; /* Buffers reused for another page */
+        unsigned long buffers;   /* Buffers allocated */
+    } stats;
 } HTAB;
 
 /*
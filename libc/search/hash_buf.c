@@ -141,12 +141,22 @@ __get_buf(HTAB *hashp, __uint32_t addr, BUFHEAD *prev_bp,
     }
 
     if (!bp) {
+        hashp->stats.misses++;
         bp = newbuf(hashp, addr, prev_bp);
-        if (!bp || __get_page(hashp, bp->page, addr, !prev_bp, is_disk, 0))
+        if (!bp)
             return (NULL);
+        /* Read-only images are used in place when possible */
+        if (is_disk && (bp->page = __map_page(hashp, addr, !prev_bp)) != NULL)
+            hashp->stats.mapped++;
+        else {
+            bp->page = bp->buf;
+            if (__get_page(hashp, bp->page, addr, !prev_bp, is_disk, 0))
+                return (NULL);
+        }
         if (!prev_bp)
             segp[segment_ndx] = (BUFHEAD *)((ptrdiff_t)bp | (intptr_t)is_disk_mask);
     } else {
+        hashp->stats.hits++;
         BUF_REMOVE(bp);
         MRU_INSERT(bp);
     }
@@ -182,15 +192,17 @@ newbuf(HTAB *hashp, __uint32_t addr, BUFHEAD *prev_bp)
 #ifdef PURIFY
         memset(bp, 0xff, sizeof(BUFHEAD));
 #endif
-        if ((bp->page = (char *)malloc(hashp->BSIZE)) == NULL) {
+        if ((bp->buf = (char *)malloc(hashp->BSIZE)) == NULL) {
             free(bp);
             return (NULL);
         }
+        bp->page = bp->buf;
 #ifdef PURIFY
         memset(bp->page, 0xff, hashp->BSIZE);
 #endif
         if (hashp->nbufs)
             hashp->nbufs--;
+        hashp->stats.buffers++;
     } else {
         /* Kick someone out */
         BUF_REMOVE(bp);
@@ -199,6 +211,7 @@ newbuf(HTAB *hashp, __uint32_t addr, BUFHEAD *prev_bp)
          * flushed back in an overflow chain and initialized.
          */
         if ((bp->addr != 0) || (bp->flags & BUF_BUCKET)) {
+            hashp->stats.evictions++;
             /*
              * Set oaddr before __put_page so that you get it
              * before bytes are swapped.
@@ -300,6 +313,7 @@ __buf_init(HTAB *hashp, int nbytes)
      * bfp->ovfl = NULL;
      * bfp->flags = 0;
      * bfp->page = NULL;
+     * bfp->buf = NULL;
      * bfp->addr = 0;
      */
 }
@@ -321,8 +335,8 @@ __buf_free(HTAB *hashp, int do_free, int to_disk)
         }
         /* Check if we are freeing stuff */
         if (do_free) {
-            if (bp->page)
-                free(bp->page);
+            if (bp->buf)
+                free(bp->buf);
             BUF_REMOVE(bp);
             free(bp);
             bp = LRU;
@@ -36,6 +36,7 @@ static char sccsid[] = "@(#)hash_log2.c	8.2 (Berkeley) 5/31/94";
 #endif /* LIBC_SCCS and not lint */
 
 #include <sys/types.h>
+#include <stdbit.h>
 
 #include "db_local.h"
 #include "hash.h"
@@ -45,10 +46,8 @@ static char sccsid[] = "@(#)hash_log2.c	8.2 (Berkeley) 5/31/94";
 __uint32_t
 __log2(__uint32_t num)
 {
-    __uint32_t i, limit;
-
-    limit = 1;
-    for (i = 0; limit < num; limit = limit << 1, i++)
-        ;
-    return (i);
+    /* Smallest i with (1 << i) >= num */
+    if (num <= 1)
+        return 0;
+    return stdc_bit_width((__uint32_t)(num - 1));
 }
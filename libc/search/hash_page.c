@@ -40,6 +40,7 @@
  *
  * External
  *	__get_page
+ *	__map_page
  *	__add_ovflpage
  * Internal
  *	overflow_page
@@ -492,7 +493,7 @@ __get_page(HTAB *hashp, char *p, __uint32_t bucket, int is_bucket, int is_disk,
     fd = hashp->fp;
     size = hashp->BSIZE;
 
-    if ((fd == -1) || !is_disk) {
+    if (((fd == -1) && !hashp->map) || !is_disk) {
         PAGE_INIT(p);
         return (0);
     }
@@ -500,9 +501,21 @@ __get_page(HTAB *hashp, char *p, __uint32_t bucket, int is_bucket, int is_disk,
         page = BUCKET_TO_PAGE(bucket);
     else
         page = OADDR_TO_PAGE(bucket);
-    if ((lseek(fd, (off_t)page << hashp->BSHIFT, SEEK_SET) == -1)
-        || ((rsize = read(fd, p, size)) == -1))
+    if (hashp->map) {
+        /* Past the end of the image reads like EOF */
+        size_t off = (size_t)page << hashp->BSHIFT;
+
+        rsize = 0;
+        if (off < hashp->maplen) {
+            rsize = size;
+            if (hashp->maplen - off < (size_t)size)
+                rsize = hashp->maplen - off;
+            memcpy(p, hashp->map + off, rsize);
+        }
+    } else if ((lseek(fd, (off_t)page << hashp->BSHIFT, SEEK_SET) == -1)
+               || ((rsize = read(fd, p, size)) == -1))
         return (-1);
+    hashp->stats.reads++;
     bp = (__uint16_t *)p;
     if (!rsize)
         bp[0] = 0; /* We hit the EOF, so initialize a new page */
@@ -573,9 +586,42 @@ __put_page(HTAB *hashp, char *p, __uint32_t bucket, int is_bucket, int is_bitmap
         errno = EFTYPE;
         return (-1);
     }
+    hashp->stats.writes++;
     return (0);
 }
 
+/*
+ * Find a page in a read-only image so it can be used without copying.
+ * Only pages in native byte order which are entirely inside the image
+ * qualify; empty pages get initialized in a buffer instead.
+ *
+ * Returns:
+ *	pointer to the page in the image
+ *	NULL if the page has to be read with __get_page
+ */
+extern char *
+__map_page(HTAB *hashp, __uint32_t bucket, int is_bucket)
+{
+    size_t off;
+    char  *p;
+    int    page;
+
+    if (!hashp->map || hashp->LORDER != DB_BYTE_ORDER
+        || ((uintptr_t)hashp->map & (sizeof(__uint16_t) - 1)))
+        return (NULL);
+    if (is_bucket)
+        page = BUCKET_TO_PAGE(bucket);
+    else
+        page = OADDR_TO_PAGE(bucket);
+    off = (size_t)page << hashp->BSHIFT;
+    if (off >= hashp->maplen || hashp->maplen - off < (size_t)hashp->BSIZE)
+        return (NULL);
+    p = (char *)hashp->map + off;
+    if (!((__uint16_t *)p)[0])
+        return (NULL);
+    return (p);
+}
+
 #define BYTE_MASK ((1 << INT_BYTE_SHIFT) - 1)
 /*
  * Initialize a new bitmap page.  Bitmap pages are left in memory
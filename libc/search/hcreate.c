@@ -75,3 +75,9 @@ hsearch(ENTRY item, ACTION action)
 
     return retval;
 }
+
+int
+hdelete(const char *key)
+{
+    return hdelete_r(key, &htab);
+}
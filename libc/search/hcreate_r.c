@@ -29,65 +29,283 @@
  * <<Id: LICENSE_GC,v 1.1 2001/10/01 23:24:05 cgd Exp>>
  */
 
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
 /*
  * hcreate() / hsearch() / hdestroy()
  *
  * SysV/XPG4 hash table functions.
  *
- * Implementation done based on NetBSD manual page and Solaris manual page,
- * plus my own personal experience about how they're supposed to work.
- *
- * I tried to look at Knuth (as cited by the Solaris manual page), but
- * nobody had a copy in the office, so...
+ * The table is open addressed with Robin Hood linear probing. Each
+ * slot holds the 32-bit hash of the key and a pointer to a separately
+ * allocated entry, so the ENTRY pointers handed back by hsearch_r stay
+ * valid while the table grows. The table doubles when it becomes 3/4
+ * full; the old slots are then moved over a few at a time by
+ * subsequent insertions and deletions so that no single call pays for
+ * rehashing the whole table. Until that finishes, lookups check both
+ * tables.
  */
 
 #define _DEFAULT_SOURCE
-#if 0
-#if defined(LIBC_SCCS) && !defined(lint)
-#endif /* LIBC_SCCS and not lint */
-#endif
-
 #include <sys/types.h>
-#include <sys/queue.h>
 #include <errno.h>
 #include <search.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include "db_local.h"
-#include "hash.h"
-#include "page.h"
-#include "extern.h"
+
+struct __hsearch_node {
+    ENTRY  ent;
+    size_t len;
+};
+
+struct __hsearch_slot {
+    uint32_t               hash;
+    struct __hsearch_node *node;
+};
+
+/* Slot hash values with special meanings; real hashes are >= 2 */
+#define SLOT_EMPTY 0
+#define SLOT_MOVED 1
+
+#define MIN_SLOTS 16
+
+/* Old slots migrated per insertion or deletion while growing */
+#define MIGRATE_STEP 4
 
 /*
- * DO NOT MAKE THIS STRUCTURE LARGER THAN 32 BYTES (4 ptrs on 64-bit
- * ptr machine) without adjusting MAX_BUCKETS_LG2 below.
+ * A word at a time hash in the style of MurmurHash3, using only
+ * 32-bit operations so that it stays cheap on 32-bit targets.
  */
-struct internal_entry {
-    SLIST_ENTRY(internal_entry) link;
-    ENTRY ent;
-};
-SLIST_HEAD(internal_head, internal_entry);
+static uint32_t
+hsearch_hash(const char *key, size_t len)
+{
+    const unsigned char *p = (const unsigned char *)key;
+    uint32_t             h = 0x9747b28cu ^ (uint32_t)len;
+    uint32_t             k;
 
-#define MIN_BUCKETS_LG2 4
-#define MIN_BUCKETS     (1 << MIN_BUCKETS_LG2)
+    while (len >= 4) {
+        memcpy(&k, p, 4);
+        k *= 0xcc9e2d51u;
+        k = (k << 15) | (k >> 17);
+        k *= 0x1b873593u;
+        h ^= k;
+        h = (h << 13) | (h >> 19);
+        h = h * 5 + 0xe6546b64u;
+        p += 4;
+        len -= 4;
+    }
+    k = 0;
+    switch (len) {
+    case 3:
+        k ^= (uint32_t)p[2] << 16;
+        __fallthrough;
+    case 2:
+        k ^= (uint32_t)p[1] << 8;
+        __fallthrough;
+    case 1:
+        k ^= p[0];
+        k *= 0xcc9e2d51u;
+        k = (k << 15) | (k >> 17);
+        k *= 0x1b873593u;
+        h ^= k;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    if (h < 2)
+        h += 2;
+    return h;
+}
+
+static inline size_t
+slot_dist(const struct __hsearch_slot *slot, size_t pos, size_t mask)
+{
+    return (pos - slot->hash) & mask;
+}
+
+static inline int
+slot_match(const struct __hsearch_slot *slot, uint32_t hash, const char *key, size_t len)
+{
+    return slot->hash == hash && slot->node->len == len
+        && memcmp(slot->node->ent.key, key, len) == 0;
+}
 
 /*
- * max * sizeof internal_entry must fit into size_t.
- * assumes internal_entry is <= 32 (2^5) bytes.
+ * Look key up in one table, returning its slot or NULL. Moved slots
+ * only exist in the table being migrated; those are skipped, which
+ * keeps the Robin Hood early exit valid for the remaining entries.
  */
-#ifdef __MSP430X_LARGE__
-/* 20-bit size_t.  */
-#define MAX_BUCKETS_LG2 (20 - 1 - 5)
-#else
-#define MAX_BUCKETS_LG2 (sizeof(size_t) * 8 - 1 - 5)
-#endif
-#define MAX_BUCKETS ((size_t)1 << MAX_BUCKETS_LG2)
+static struct __hsearch_slot *
+table_find(struct __hsearch_slot *table, size_t size, uint32_t hash, const char *key, size_t len)
+{
+    size_t mask = size - 1;
+    size_t pos = hash & mask;
+    size_t dist;
+
+    for (dist = 0;; dist++, pos = (pos + 1) & mask) {
+        struct __hsearch_slot *slot = &table[pos];
+
+        if (slot->hash == SLOT_EMPTY)
+            return NULL;
+        if (slot->hash == SLOT_MOVED)
+            continue;
+        if (slot_dist(slot, pos, mask) < dist)
+            return NULL;
+        if (slot_match(slot, hash, key, len))
+            return slot;
+    }
+}
+
+/* Robin Hood insertion into a table which has room and no moved slots */
+static void
+table_insert(struct __hsearch_slot *table, size_t size, struct __hsearch_slot ins)
+{
+    size_t mask = size - 1;
+    size_t pos = ins.hash & mask;
+    size_t dist;
+
+    for (dist = 0;; dist++, pos = (pos + 1) & mask) {
+        struct __hsearch_slot *slot = &table[pos];
+        size_t                 d;
+
+        if (slot->hash == SLOT_EMPTY) {
+            *slot = ins;
+            return;
+        }
+        d = slot_dist(slot, pos, mask);
+        if (d < dist) {
+            struct __hsearch_slot t = *slot;
+
+            *slot = ins;
+            ins = t;
+            dist = d;
+        }
+    }
+}
+
+/* Backward shift deletion, leaving no tombstone behind */
+static void
+table_remove(struct __hsearch_slot *table, size_t size, struct __hsearch_slot *slot)
+{
+    size_t mask = size - 1;
+    size_t pos = (size_t)(slot - table);
+
+    for (;;) {
+        size_t                 next = (pos + 1) & mask;
+        struct __hsearch_slot *n = &table[next];
+
+        if (n->hash == SLOT_EMPTY || slot_dist(n, next, mask) == 0)
+            break;
+        table[pos] = *n;
+        pos = next;
+    }
+    table[pos].hash = SLOT_EMPTY;
+    table[pos].node = NULL;
+}
+
+static void
+migrate(struct hsearch_data *htab, size_t count)
+{
+    while (htab->holdtable != NULL && count--) {
+        struct __hsearch_slot *slot = &htab->holdtable[htab->holdpos];
+
+        if (slot->hash != SLOT_EMPTY && slot->hash != SLOT_MOVED) {
+            table_insert(htab->htable, htab->htablesize, *slot);
+            slot->hash = SLOT_MOVED;
+        }
+        if (++htab->holdpos == htab->holdsize) {
+            free(htab->holdtable);
+            htab->holdtable = NULL;
+            htab->holdsize = 0;
+            htab->holdpos = 0;
+        }
+    }
+}
+
+static struct __hsearch_slot *
+alloc_table(size_t size)
+{
+    if (size > SIZE_MAX / sizeof(struct __hsearch_slot))
+        return NULL;
+    return calloc(size, sizeof(struct __hsearch_slot));
+}
+
+static int
+grow(struct hsearch_data *htab)
+{
+    struct __hsearch_slot *table;
+    size_t                 size = htab->htablesize * 2;
+
+    /* Never keep more than one old table around */
+    migrate(htab, SIZE_MAX);
+
+    if (size == 0 || (table = alloc_table(size)) == NULL)
+        return 0;
+    htab->holdtable = htab->htable;
+    htab->holdsize = htab->htablesize;
+    htab->holdpos = 0;
+    htab->htable = table;
+    htab->htablesize = size;
+    return 1;
+}
+
+static struct __hsearch_slot *
+find(struct hsearch_data *htab, uint32_t hash, const char *key, size_t len,
+     struct __hsearch_slot **table, size_t *size)
+{
+    struct __hsearch_slot *slot;
+
+    *table = htab->htable;
+    *size = htab->htablesize;
+    slot = table_find(*table, *size, hash, key, len);
+    if (slot == NULL && htab->holdtable != NULL) {
+        *table = htab->holdtable;
+        *size = htab->holdsize;
+        slot = table_find(*table, *size, hash, key, len);
+    }
+    return slot;
+}
 
 int
 hcreate_r(size_t nel, struct hsearch_data *htab)
 {
-    size_t       idx;
-    unsigned int p2;
+    size_t size;
 
     /* Make sure this this isn't called when a table already exists. */
     if (htab->htable != NULL) {
@@ -95,96 +313,128 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
         return 0;
     }
 
-    /* If nel is too small, make it min sized. */
-    if (nel < MIN_BUCKETS)
-        nel = MIN_BUCKETS;
-
-    /* If it's too large, cap it. */
-    if (nel > MAX_BUCKETS)
-        nel = MAX_BUCKETS;
-
-    /* If it's is not a power of two in size, round up. */
-    if ((nel & (nel - 1)) != 0) {
-        for (p2 = 0; nel != 0; p2++)
-            nel >>= 1;
-        nel = 1 << p2;
-    }
+    /* Size the table so that nel entries fit below the growth limit */
+    size = MIN_SLOTS;
+    while (size < SIZE_MAX / 4 && size / 4 * 3 < nel)
+        size <<= 1;
 
-    /* Allocate the table. */
-    htab->htablesize = nel;
-    htab->htable = malloc(htab->htablesize * sizeof htab->htable[0]);
+    htab->htable = alloc_table(size);
     if (htab->htable == NULL) {
         errno = ENOMEM;
         return 0;
     }
+    htab->htablesize = size;
+    htab->hcount = 0;
+    htab->holdtable = NULL;
+    htab->holdsize = 0;
+    htab->holdpos = 0;
+    return 1;
+}
 
-    /* Initialize it. */
-    for (idx = 0; idx < htab->htablesize; idx++)
-        SLIST_INIT(&(htab->htable[idx]));
+static void
+free_nodes(struct __hsearch_slot *table, size_t size)
+{
+    size_t idx;
 
-    return 1;
+    for (idx = 0; idx < size; idx++)
+        if (table[idx].hash != SLOT_EMPTY && table[idx].hash != SLOT_MOVED)
+            free(table[idx].node);
+    free(table);
 }
 
 void
 hdestroy_r(struct hsearch_data *htab)
 {
-#if 0
-	struct internal_entry *ie;
-	size_t idx;
-#endif
     if (htab->htable == NULL)
         return;
 
-#if 0
-	for (idx = 0; idx < htab->htablesize; idx++) {
-		while (!SLIST_EMPTY(&(htab->htable[idx]))) {
-			ie = SLIST_FIRST(&(htab->htable[idx]));
-			SLIST_REMOVE_HEAD(&(htab->htable[idx]), link);
-                        free(ie->ent.key);
-			free(ie);
-		}
-	}
-#endif
-    free(htab->htable);
+    /* The keys belong to the application and are not freed */
+    free_nodes(htab->htable, htab->htablesize);
+    if (htab->holdtable != NULL)
+        free_nodes(htab->holdtable, htab->holdsize);
     htab->htable = NULL;
+    htab->htablesize = 0;
+    htab->hcount = 0;
+    htab->holdtable = NULL;
+    htab->holdsize = 0;
+    htab->holdpos = 0;
 }
 
 int
-hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
+hsearch_len_r(ENTRY item, size_t keylen, ACTION action, ENTRY **retval, struct hsearch_data *htab)
 {
-    struct internal_head  *head;
-    struct internal_entry *ie;
-    __uint32_t             hashval;
-    size_t                 len;
+    struct __hsearch_slot *slot, *table, ins;
+    size_t                 size;
+    uint32_t               hash;
 
-    len = strlen(item.key);
-    hashval = __default_hash(item.key, len);
+    hash = hsearch_hash(item.key, keylen);
 
-    head = &(htab->htable[hashval & (htab->htablesize - 1)]);
-    ie = SLIST_FIRST(head);
-    while (ie != NULL) {
-        if (strcmp(ie->ent.key, item.key) == 0)
-            break;
-        ie = SLIST_NEXT(ie, link);
-    }
-
-    if (ie != NULL) {
-        *retval = &ie->ent;
+    slot = find(htab, hash, item.key, keylen, &table, &size);
+    if (slot != NULL) {
+        *retval = &slot->node->ent;
         return 1;
     } else if (action == FIND) {
         *retval = NULL;
         return 0;
     }
 
-    ie = malloc(sizeof *ie);
-    if (ie == NULL) {
+    if (htab->hcount + 1 > htab->htablesize / 4 * 3 && !grow(htab)) {
+        errno = ENOMEM;
+        *retval = NULL;
+        return 0;
+    }
+
+    ins.node = malloc(sizeof(*ins.node));
+    if (ins.node == NULL) {
+        errno = ENOMEM;
         *retval = NULL;
         return 0;
     }
-    ie->ent.key = item.key;
-    ie->ent.data = item.data;
+    ins.node->ent = item;
+    ins.node->len = keylen;
+    ins.hash = hash;
 
-    SLIST_INSERT_HEAD(head, ie, link);
-    *retval = &ie->ent;
+    migrate(htab, MIGRATE_STEP);
+    table_insert(htab->htable, htab->htablesize, ins);
+    htab->hcount++;
+
+    *retval = &ins.node->ent;
     return 1;
 }
+
+int
+hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
+{
+    return hsearch_len_r(item, strlen(item.key), action, retval, htab);
+}
+
+int
+hdelete_len_r(const char *key, size_t keylen, struct hsearch_data *htab)
+{
+    struct __hsearch_slot *slot, *table;
+    size_t                 size;
+
+    slot = find(htab, hsearch_hash(key, keylen), key, keylen, &table, &size);
+    if (slot == NULL) {
+        errno = ESRCH;
+        return 0;
+    }
+
+    free(slot->node);
+    if (table == htab->holdtable) {
+        /* Entries must not move while the old table is being walked */
+        slot->hash = SLOT_MOVED;
+        slot->node = NULL;
+    } else {
+        table_remove(table, size, slot);
+    }
+    htab->hcount--;
+    migrate(htab, MIGRATE_STEP);
+    return 1;
+}
+
+int
+hdelete_r(const char *key, struct hsearch_data *htab)
+{
+    return hdelete_len_r(key, strlen(key), htab);
+}
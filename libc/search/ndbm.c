@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
+#include <limits.h>
 
 #include <ndbm.h>
 #include "hash.h"
@@ -57,16 +58,37 @@
  */
 extern DBM *
 dbm_open(const char *file, int flags, mode_t mode)
+{
+    return (dbm_open_cache(file, flags, mode, 0));
+}
+
+static void
+dbm_info(HASHINFO *info, size_t cachesize)
+{
+    info->bsize = 4096;
+    info->ffactor = 40;
+    info->nelem = 1;
+    info->cachesize = cachesize > UINT_MAX ? UINT_MAX : (u_int)cachesize;
+    info->hash = NULL;
+    info->lorder = 0;
+}
+
+/*
+ * As dbm_open, with a buffer pool of cachesize bytes instead of the
+ * default 64K. Databases opened read-only are mapped when the target
+ * provides mmap, and their pages are used in place.
+ *
+ * Returns:
+ * 	*DBM on success
+ *	 NULL on failure
+ */
+extern DBM *
+dbm_open_cache(const char *file, int flags, mode_t mode, size_t cachesize)
 {
     HASHINFO info;
     char     path[MAXPATHLEN];
 
-    info.bsize = 4096;
-    info.ffactor = 40;
-    info.nelem = 1;
-    info.cachesize = 0;
-    info.hash = NULL;
-    info.lorder = 0;
+    dbm_info(&info, cachesize);
 
     if (strlen(file) >= sizeof(path) - strlen(DBM_SUFFIX)) {
         errno = ENAMETOOLONG;
@@ -77,6 +99,24 @@ dbm_open(const char *file, int flags, mode_t mode)
     return ((DBM *)__hash_open(path, flags, mode, 0, &info));
 }
 
+/*
+ * Opens a read-only database held in memory, such as a .db file linked
+ * into flash. Pages are used in place where possible; the image must
+ * stay valid until dbm_close.
+ *
+ * Returns:
+ * 	*DBM on success
+ *	 NULL on failure
+ */
+extern DBM *
+dbm_open_image(const void *image, size_t size, size_t cachesize)
+{
+    HASHINFO info;
+
+    dbm_info(&info, cachesize);
+    return ((DBM *)__hash_open_image(image, size, &info));
+}
+
 extern void
 dbm_close(DBM *db)
 {
@@ -209,3 +249,25 @@ dbm_dirfno(DBM *db)
 {
     return (((HTAB *)db->internal)->fp);
 }
+
+/*
+ * Copies the buffer pool statistics: lookups that found their page in
+ * a buffer or needed one, pages copied from the file or image, pages
+ * used in place, pages written back, buffers reused for another page
+ * and buffers allocated so far.
+ */
+extern int
+dbm_stats(DBM *db, struct dbm_stats *stats)
+{
+    HTAB *hp;
+
+    hp = (HTAB *)db->internal;
+    stats->hits = hp->stats.hits;
+    stats->misses = hp->stats.misses;
+    stats->reads = hp->stats.reads;
+    stats->mapped = hp->stats.mapped;
+    stats->writes = hp->stats.writes;
+    stats->evictions = hp->stats.evictions;
+    stats->buffers = hp->stats.buffers;
+    return (0);
+}
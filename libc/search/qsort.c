@@ -154,6 +154,62 @@ med3(char *a, char *b, char *c, cmp_t *cmp,
                                 : (CMP(thunk, b, c) > 0 ? b : (CMP(thunk, a, c) < 0 ? a : c));
 }
 
+/*
+ * Heapsort the n elements at a. This is the fallback used when
+ * partitioning degenerates, bounding the total work to O(n log n)
+ * whatever the input is.
+ */
+static void
+heapsort_part(char *a, size_t n, size_t es, int swaptype_swap_ulong_t, int swaptype_swap_uint_t,
+              cmp_t *cmp,
+              void *thunk
+#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
+              __unused
+#endif
+)
+{
+    size_t i, root, child;
+
+    i = n / 2;
+    while (n > 1) {
+        if (i > 0) {
+            /* Build the heap */
+            root = --i;
+        } else {
+            /* Move the largest element to the end */
+            --n;
+            swap(a, a + n * es);
+            root = 0;
+        }
+        /* Sift the root element down */
+        while ((child = 2 * root + 1) < n) {
+            if (child + 1 < n && CMP(thunk, a + child * es, a + (child + 1) * es) < 0)
+                child++;
+            if (CMP(thunk, a + root * es, a + child * es) >= 0)
+                break;
+            swap(a + root * es, a + child * es);
+            root = child;
+        }
+    }
+}
+
+/*
+ * Introsort-style depth limit: 2 * floor(log2(n)) partitioning
+ * passes are allowed for a sub-array of n elements before it is
+ * finished with heapsort.
+ */
+static inline unsigned
+depth_limit(size_t n)
+{
+    unsigned depth = 0;
+
+    while (n > 1) {
+        n >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
 /*
  * Classical function call recursion wastes a lot of stack space. Each
  * recursion level requires a full stack frame comprising all local variables
@@ -170,28 +226,18 @@ med3(char *a, char *b, char *c, cmp_t *cmp,
  */
 #define PARAMETER_STACK_LEVELS 8u
 
-#if defined(I_AM_QSORT_R)
-void __bsd_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
-
-void
-__bsd_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp)
-#elif defined(I_AM_GNU_QSORT_R)
-void
-qsort_r(void *a, size_t n, size_t es, cmp_t *cmp, void *thunk)
-#else
-#define thunk NULL
-void
-qsort(void *a, size_t n, size_t es, cmp_t *cmp)
-#endif
+static void
+sort_part(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp, unsigned depth)
 {
     char  *pa, *pb, *pc, *pd, *pl, *pm, *pn;
-    size_t d, r;
+    size_t d, r, moves;
     int    cmp_result;
     int    swaptype_swap_ulong_t, swaptype_swap_uint_t, swap_cnt;
     size_t recursion_level = 0;
     struct {
-        void  *a;
-        size_t n;
+        void    *a;
+        size_t   n;
+        unsigned depth;
     } parameter_stack[PARAMETER_STACK_LEVELS];
 
     SWAPINIT(swap_ulong_t, a, es);
@@ -206,6 +252,13 @@ loop:
         goto pop;
     }
 
+    /* Too many unbalanced partitions; finish this part with heapsort. */
+    if (depth == 0) {
+        heapsort_part(a, n, es, swaptype_swap_ulong_t, swaptype_swap_uint_t, cmp, thunk);
+        goto pop;
+    }
+    depth--;
+
     /* Select a pivot element, move it to the left. */
     pm = (char *)a + (n / 2) * es;
     if (n > 7) {
@@ -257,9 +310,18 @@ loop:
         pc -= es;
     }
     if (swap_cnt == 0) { /* Switch to insertion sort */
+        /*
+         * Inputs which only look sorted could make this quadratic,
+         * so give up after n element moves and partition again; the
+         * depth limit bounds how often that can happen.
+         */
+        moves = 0;
         for (pm = (char *)a + es; pm < (char *)a + n * es; pm += es)
-            for (pl = pm; pl > (char *)a && CMP(thunk, pl - es, pl) > 0; pl -= es)
+            for (pl = pm; pl > (char *)a && CMP(thunk, pl - es, pl) > 0; pl -= es) {
+                if (++moves > n)
+                    goto loop;
                 swap(pl, pl - es);
+            }
         goto pop;
     }
 
@@ -312,6 +374,7 @@ loop:
              */
             parameter_stack[recursion_level].a = a;
             parameter_stack[recursion_level].n = n / es;
+            parameter_stack[recursion_level].depth = depth;
             recursion_level++;
             a = pa;
             n = r / es;
@@ -322,13 +385,7 @@ loop:
              * is sorted using function call recursion. The larger
              * part will be sorted after the function call returns.
              */
-#if defined(I_AM_QSORT_R)
-            __bsd_qsort_r(pa, r / es, es, thunk, cmp);
-#elif defined(I_AM_GNU_QSORT_R)
-            qsort_r(pa, r / es, es, cmp, thunk);
-#else
-            qsort(pa, r / es, es, cmp);
-#endif
+            sort_part(pa, r / es, es, thunk, cmp, depth);
         }
     }
     if (n > es) { /* The larger part needs sorting. Iterate to sort.  */
@@ -341,6 +398,26 @@ pop:
         recursion_level--;
         a = parameter_stack[recursion_level].a;
         n = parameter_stack[recursion_level].n;
+        depth = parameter_stack[recursion_level].depth;
         goto loop;
     }
 }
+
+#if defined(I_AM_QSORT_R)
+void __bsd_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
+
+void
+__bsd_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp)
+#elif defined(I_AM_GNU_QSORT_R)
+void
+qsort_r(void *a, size_t n, size_t es, cmp_t *cmp, void *thunk)
+#else
+void
+qsort(void *a, size_t n, size_t es, cmp_t *cmp)
+#endif
+{
+#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
+    void *thunk = NULL;
+#endif
+    sort_part(a, n, es, thunk, cmp, depth_limit(n));
+}
@@ -0,0 +1,235 @@
+/*
+FUNCTION
+<<qsort_int32>>, <<qsort_uint32>>, <<qsort_int64>>, <<qsort_float>>, <<qsort_double>>, <<qsort_str>>---sort an array of a fixed type
+
+INDEX
+        qsort_int32
+INDEX
+        qsort_uint32
+INDEX
+        qsort_int64
+INDEX
+        qsort_float
+INDEX
+        qsort_double
+INDEX
+        qsort_str
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <stdlib.h>
+        void qsort_int32(int32_t *<[base]>, size_t <[nmemb]>);
+        void qsort_uint32(uint32_t *<[base]>, size_t <[nmemb]>);
+        void qsort_int64(int64_t *<[base]>, size_t <[nmemb]>);
+        void qsort_float(float *<[base]>, size_t <[nmemb]>);
+        void qsort_double(double *<[base]>, size_t <[nmemb]>);
+        void qsort_str(char **<[base]>, size_t <[nmemb]>);
+
+DESCRIPTION
+These functions sort the <[nmemb]> elements at <[base]> into
+ascending order, like <<qsort>> with the obvious comparison
+function, but with the comparison inlined into the sort so that no
+function call is made per element compared.
+
+<<qsort_float>> and <<qsort_double>> order NaNs after all other
+values; -0.0 and +0.0 compare equal. <<qsort_str>> orders the
+strings as <<strcmp>> does.
+
+The sort is not stable. It is an introsort: quicksort with a
+median-of-three pivot, insertion sort for short runs and heapsort
+once the partitioning depth exceeds 2 log2(<[nmemb]>), so the worst
+case is O(n log n).
+
+RETURNS
+These functions do not return a result.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * This file is also the template for the other element types, which
+ * define QSORT_TYPE, QSORT_NAME and QSORT_LESS before including it.
+ */
+#ifndef QSORT_TYPE
+#define QSORT_TYPE       int32_t
+#define QSORT_NAME       qsort_int32
+#define QSORT_LESS(a, b) ((a) < (b))
+#endif
+
+/* Runs this short are finished with insertion sort */
+#define QSORT_INSERTION 12
+
+#define QSORT_SWAP(a, b)     \
+    do {                     \
+        QSORT_TYPE __t = a;  \
+        a = b;               \
+        b = __t;             \
+    } while (0)
+
+static void
+insertion_sort(QSORT_TYPE *a, size_t n)
+{
+    size_t i, j;
+
+    for (i = 1; i < n; i++) {
+        QSORT_TYPE t = a[i];
+
+        for (j = i; j > 0 && QSORT_LESS(t, a[j - 1]); j--)
+            a[j] = a[j - 1];
+        a[j] = t;
+    }
+}
+
+static void
+heap_sort(QSORT_TYPE *a, size_t n)
+{
+    size_t i = n / 2, root, child;
+
+    while (n > 1) {
+        if (i > 0) {
+            root = --i;
+        } else {
+            --n;
+            QSORT_SWAP(a[0], a[n]);
+            root = 0;
+        }
+        while ((child = 2 * root + 1) < n) {
+            if (child + 1 < n && QSORT_LESS(a[child], a[child + 1]))
+                child++;
+            if (!QSORT_LESS(a[root], a[child]))
+                break;
+            QSORT_SWAP(a[root], a[child]);
+            root = child;
+        }
+    }
+}
+
+void
+QSORT_NAME(QSORT_TYPE *base, size_t nmemb)
+{
+    struct {
+        QSORT_TYPE *a;
+        size_t      n;
+        unsigned    depth;
+    } stack[sizeof(size_t) * 8];
+    size_t      sp = 0;
+    QSORT_TYPE *a = base;
+    size_t      n = nmemb;
+    unsigned    depth = 0;
+
+    for (n = nmemb; n > 1; n >>= 1)
+        depth += 2;
+    n = nmemb;
+
+    for (;;) {
+        while (n > QSORT_INSERTION) {
+            QSORT_TYPE pivot;
+            size_t     i, j;
+
+            if (depth == 0) {
+                heap_sort(a, n);
+                n = 0;
+                break;
+            }
+            depth--;
+
+            /*
+             * Sort first, middle and last; the middle becomes the
+             * pivot and the ends act as sentinels for the scans
+             */
+            i = n / 2;
+            j = n - 1;
+            if (QSORT_LESS(a[i], a[0]))
+                QSORT_SWAP(a[i], a[0]);
+            if (QSORT_LESS(a[j], a[i])) {
+                QSORT_SWAP(a[j], a[i]);
+                if (QSORT_LESS(a[i], a[0]))
+                    QSORT_SWAP(a[i], a[0]);
+            }
+            pivot = a[i];
+
+            /*
+             * Hoare partition. Stopping on elements equal to the
+             * pivot keeps runs of duplicates balanced. Both parts
+             * end up non-empty: [0, j] <= pivot <= [j + 1, n)
+             */
+            i = 0;
+            for (;;) {
+                while (QSORT_LESS(a[i], pivot))
+                    i++;
+                while (QSORT_LESS(pivot, a[j]))
+                    j--;
+                if (i >= j)
+                    break;
+                QSORT_SWAP(a[i], a[j]);
+                i++;
+                j--;
+            }
+            j++;
+
+            /* Save the larger part and carry on with the smaller one */
+            if (j < n - j) {
+                stack[sp].a = a + j;
+                stack[sp].n = n - j;
+                n = j;
+            } else {
+                stack[sp].a = a;
+                stack[sp].n = j;
+                a += j;
+                n -= j;
+            }
+            stack[sp].depth = depth;
+            sp++;
+        }
+        if (n > 1)
+            insertion_sort(a, n);
+        if (sp == 0)
+            break;
+        sp--;
+        a = stack[sp].a;
+        n = stack[sp].n;
+        depth = stack[sp].depth;
+    }
+}
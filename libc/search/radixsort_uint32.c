@@ -0,0 +1,122 @@
+/*
+FUNCTION
+<<radixsort_uint32>>, <<radixsort_int32>>---sort integer keys by radix
+
+INDEX
+        radixsort_uint32
+INDEX
+        radixsort_int32
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <stdlib.h>
+        void radixsort_uint32(uint32_t *<[base]>, size_t <[nmemb]>, uint32_t *<[tmp]>);
+        void radixsort_int32(int32_t *<[base]>, size_t <[nmemb]>, int32_t *<[tmp]>);
+
+DESCRIPTION
+These functions sort the <[nmemb]> integers at <[base]> into
+ascending order using a least-significant-digit radix sort with
+8-bit digits. No comparisons are made; the running time is linear
+in <[nmemb]>, with passes skipped when every key has the same
+value in that digit. The sort is stable.
+
+<[tmp]> must point at scratch space for <[nmemb]> elements. When
+<[tmp]> is NULL, the keys are sorted in place with
+<<qsort_uint32>> or <<qsort_int32>> instead.
+
+RETURNS
+These functions do not return a result.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef RADIX_TYPE
+#define RADIX_TYPE  uint32_t
+#define RADIX_NAME  radixsort_uint32
+#define RADIX_QSORT qsort_uint32
+/* Map the key to an unsigned value with the same ordering */
+#define RADIX_KEY(x) ((uint32_t)(x))
+#endif
+
+void
+RADIX_NAME(RADIX_TYPE *base, size_t nmemb, RADIX_TYPE *tmp)
+{
+    size_t      count[256];
+    RADIX_TYPE *src = base;
+    RADIX_TYPE *dst = tmp;
+    RADIX_TYPE *t;
+    unsigned    shift;
+    size_t      i, sum, c;
+
+    if (!tmp) {
+        RADIX_QSORT(base, nmemb);
+        return;
+    }
+    if (nmemb < 2)
+        return;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        memset(count, 0, sizeof(count));
+        for (i = 0; i < nmemb; i++)
+            count[(RADIX_KEY(src[i]) >> shift) & 0xff]++;
+
+        /* Nothing to do when all keys share this digit */
+        if (count[(RADIX_KEY(src[0]) >> shift) & 0xff] == nmemb)
+            continue;
+
+        for (sum = 0, i = 0; i < 256; i++) {
+            c = count[i];
+            count[i] = sum;
+            sum += c;
+        }
+        for (i = 0; i < nmemb; i++)
+            dst[count[(RADIX_KEY(src[i]) >> shift) & 0xff]++] = src[i];
+
+        t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != base)
+        memcpy(base, src, nmemb * sizeof(RADIX_TYPE));
+}
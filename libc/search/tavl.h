@@ -0,0 +1,117 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * AVL balancing shared by tsearch and tdelete. Nodes have no parent
+ * links, so updates record the path from the root as an array of
+ * link addresses and rebalance back up along it.
+ */
+
+#ifndef _TAVL_H_
+#define _TAVL_H_
+
+#define _SEARCH_PRIVATE
+#include <search.h>
+
+/* AVL trees are at most 1.44 log2(n) high */
+#define TAVL_MAX_HEIGHT (sizeof(void *) * 8 * 3 / 2)
+
+static inline int
+tavl_height(const node_t *n)
+{
+    return n ? n->height : 0;
+}
+
+static inline void
+tavl_fix_height(node_t *n)
+{
+    int hl = tavl_height(n->llink);
+    int hr = tavl_height(n->rlink);
+
+    n->height = (hl > hr ? hl : hr) + 1;
+}
+
+static inline node_t *
+tavl_rotate_left(node_t *x)
+{
+    node_t *y = x->rlink;
+
+    x->rlink = y->llink;
+    y->llink = x;
+    tavl_fix_height(x);
+    tavl_fix_height(y);
+    return y;
+}
+
+static inline node_t *
+tavl_rotate_right(node_t *x)
+{
+    node_t *y = x->llink;
+
+    x->llink = y->rlink;
+    y->rlink = x;
+    tavl_fix_height(x);
+    tavl_fix_height(y);
+    return y;
+}
+
+/*
+ * Restore the AVL property for the subtree at *p, whose children are
+ * already balanced. Returns non-zero if the height of the subtree
+ * changed, in which case its ancestors need looking at too.
+ */
+static inline int
+tavl_rebalance(node_t **p)
+{
+    node_t *n = *p;
+    int     old = n->height;
+    int     hl = tavl_height(n->llink);
+    int     hr = tavl_height(n->rlink);
+
+    if (hl - hr > 1) {
+        if (tavl_height(n->llink->llink) < tavl_height(n->llink->rlink))
+            n->llink = tavl_rotate_left(n->llink);
+        *p = tavl_rotate_right(n);
+    } else if (hr - hl > 1) {
+        if (tavl_height(n->rlink->rlink) < tavl_height(n->rlink->llink))
+            n->rlink = tavl_rotate_right(n->rlink);
+        *p = tavl_rotate_left(n);
+    } else {
+        tavl_fix_height(n);
+    }
+    return (*p)->height != old;
+}
+
+#endif /* _TAVL_H_ */
@@ -45,46 +45,88 @@ SUCH DAMAGE.
 #endif
 
 #include <assert.h>
-#define _SEARCH_PRIVATE
-#include <search.h>
 #include <stdlib.h>
+#include "tavl.h"
 
-/* delete node with given key */
-void *
-tdelete(const void * __restrict vkey, /* key to be deleted */
-        void ** __restrict vrootp,    /* address of the root of tree */
-        int (*compar)(const void *, const void *))
+/*
+ * Unlink the node matching key and rebalance. Returns the node, or
+ * NULL if it wasn't found; *parentp is set to its former parent.
+ */
+static node_t *
+tdelete_unlink(const void *vkey, node_t **rootp, int (*compar)(const void *, const void *),
+               node_t **parentp)
 {
-    node_t **rootp = (node_t **)vrootp;
-    node_t  *p, *q, *r;
+    node_t **path[TAVL_MAX_HEIGHT + 1];
+    node_t  *p, *q;
+    int      depth = 0, top;
     int      cmp;
 
-    if (rootp == NULL || (p = *rootp) == NULL)
+    *parentp = NULL;
+    path[0] = rootp;
+    if (*rootp == NULL)
         return NULL;
 
     while ((cmp = (*compar)(vkey, (*rootp)->key)) != 0) {
-        p = *rootp;
+        *parentp = *rootp;
         rootp = (cmp < 0) ? &(*rootp)->llink : /* follow llink branch */
             &(*rootp)->rlink;                  /* follow rlink branch */
         if (*rootp == NULL)
             return NULL; /* key not found */
+        path[++depth] = rootp;
     }
-    r = (*rootp)->rlink;               /* D1: */
-    if ((q = (*rootp)->llink) == NULL) /* Left NULL? */
-        q = r;
-    else if (r != NULL) {       /* Right link is NULL? */
-        if (r->llink == NULL) { /* D2: Find successor */
-            r->llink = q;
-            q = r;
-        } else { /* D3: Find NULL link */
-            for (q = r->llink; q->llink != NULL; q = r->llink)
-                r = q;
-            r->llink = q->rlink;
-            q->llink = (*rootp)->llink;
-            q->rlink = (*rootp)->rlink;
+    p = *rootp;
+
+    if (p->llink == NULL || p->rlink == NULL) {
+        /* At most one child, which takes the node's place */
+        *rootp = p->llink ? p->llink : p->rlink;
+        top = depth;
+    } else {
+        /* Move the successor into the node's place */
+        top = depth + 1;
+        path[top] = &p->rlink;
+        while ((*path[top])->llink != NULL) {
+            path[top + 1] = &(*path[top])->llink;
+            top++;
         }
+        q = *path[top];
+        *path[top] = q->rlink;
+        q->llink = p->llink;
+        q->rlink = p->rlink;
+        q->height = p->height;
+        *rootp = q;
+        /* p->rlink is now q->rlink */
+        path[depth + 1] = &q->rlink;
     }
-    free(*rootp); /* D4: Free node */
-    *rootp = q;   /* link parent to new node */
+    while (top-- > 0 && tavl_rebalance(path[top]))
+        ;
     return p;
 }
+
+/* delete node with given key */
+void *
+tdelete(const void * __restrict vkey, /* key to be deleted */
+        void ** __restrict vrootp,    /* address of the root of tree */
+        int (*compar)(const void *, const void *))
+{
+    node_t *p, *parent;
+
+    if (vrootp == NULL)
+        return NULL;
+    p = tdelete_unlink(vkey, (node_t **)vrootp, compar, &parent);
+    if (p == NULL)
+        return NULL;
+    free(p);
+    /* There is no parent when the root went away */
+    return parent ? (void *)parent : (void *)vrootp;
+}
+
+/* remove node with given key, returning it to the caller */
+void *
+tremove(const void *vkey, void **vrootp, int (*compar)(const void *, const void *))
+{
+    node_t *parent;
+
+    if (vrootp == NULL)
+        return NULL;
+    return tdelete_unlink(vkey, (node_t **)vrootp, compar, &parent);
+}
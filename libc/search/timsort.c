@@ -0,0 +1,425 @@
+/*
+FUNCTION
+<<timsort>>, <<mergesort>>---stable sort of an array
+
+INDEX
+        timsort
+INDEX
+        mergesort
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <stdlib.h>
+        int timsort(void *<[base]>, size_t <[nmemb]>, size_t <[size]>,
+                    int (*<[compar]>)(const void *, const void *), void *<[tmp]>);
+        int mergesort(void *<[base]>, size_t <[nmemb]>, size_t <[size]>,
+                      int (*<[compar]>)(const void *, const void *));
+
+DESCRIPTION
+These functions sort the <[nmemb]> elements of <[size]> bytes at
+<[base]> into ascending order according to <[compar]>, which works
+as for <<qsort>>. Unlike <<qsort>>, the sort is stable: elements
+that compare equal keep their original order.
+
+The algorithm is a natural merge sort in the style of timsort.
+Existing ascending and strictly descending runs are found and
+extended to a minimum length with binary insertion sort, then merged
+while keeping the run lengths balanced. Input that is already sorted,
+or sorted in reverse, takes O(<[nmemb]>) comparisons; the worst case
+is O(<[nmemb]> log <[nmemb]>).
+
+<[tmp]> may point at scratch space for <[nmemb]> / 2 elements, so
+that <<timsort>> does not allocate memory. When it is NULL, the
+scratch space comes from <<malloc>>, and only when the input needs
+more than finding runs. <<mergesort>> is <<timsort>> with <[tmp]>
+NULL.
+
+RETURNS
+Zero on success. If the scratch space cannot be allocated, -1 is
+returned, <<errno>> is set to ENOMEM and the array holds its
+original elements in an unspecified order.
+
+PORTABILITY
+<<mergesort>> is a BSD extension. <<timsort>> is a picolibc
+extension.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+typedef int cmp_t(const void *, const void *);
+
+/* Shorter runs are extended to a minimum length between these */
+#define TIMSORT_MIN_MERGE 64
+
+/* Run lengths grow at least as fast as the Fibonacci numbers */
+#define TIMSORT_MAX_RUNS 85
+
+struct timsort {
+    char   *base;
+    size_t  size;
+    size_t  nmemb;
+    cmp_t  *cmp;
+    char   *tmp;
+    bool    tmp_owned;
+    bool    copy_long; /* elements are aligned unsigned longs */
+    size_t  nrun;
+    struct {
+        size_t start;
+        size_t len;
+    } run[TIMSORT_MAX_RUNS];
+};
+
+#define ELEM(p, i) ((p) + (size_t)(i) * s->size)
+
+/* Get the scratch space, either the caller's or from malloc */
+static int
+get_tmp(struct timsort *s)
+{
+    if (!s->tmp) {
+        s->tmp = malloc((s->nmemb / 2) * s->size);
+        if (!s->tmp) {
+            errno = ENOMEM;
+            return -1;
+        }
+        s->tmp_owned = true;
+    }
+    s->copy_long = s->size == sizeof(unsigned long)
+        && (uintptr_t)s->base % sizeof(unsigned long) == 0
+        && (uintptr_t)s->tmp % sizeof(unsigned long) == 0;
+    return 0;
+}
+
+static inline void
+copy_elem(struct timsort *s, char *dst, const char *src)
+{
+    if (s->copy_long)
+        *(unsigned long *)dst = *(const unsigned long *)src;
+    else
+        memcpy(dst, src, s->size);
+}
+
+static void
+reverse(struct timsort *s, char *a, size_t n)
+{
+    char *lo = a, *hi = ELEM(a, n - 1);
+
+    while (lo < hi) {
+        size_t i;
+
+        for (i = 0; i < s->size; i++) {
+            char t = lo[i];
+            lo[i] = hi[i];
+            hi[i] = t;
+        }
+        lo += s->size;
+        hi -= s->size;
+    }
+}
+
+/*
+ * Length of the run starting at a, which is at most n elements. A
+ * strictly descending run is reversed in place; requiring it to be
+ * strict keeps equal elements in order.
+ */
+static size_t
+count_run(struct timsort *s, char *a, size_t n)
+{
+    size_t i = 2;
+
+    if (n < 2)
+        return n;
+    if (s->cmp(ELEM(a, 1), a) < 0) {
+        while (i < n && s->cmp(ELEM(a, i), ELEM(a, i - 1)) < 0)
+            i++;
+        reverse(s, a, i);
+    } else {
+        while (i < n && s->cmp(ELEM(a, i), ELEM(a, i - 1)) >= 0)
+            i++;
+    }
+    return i;
+}
+
+/* Sort a[0, n) given that a[0, sorted) already is */
+static int
+binary_insertion(struct timsort *s, char *a, size_t n, size_t sorted)
+{
+    size_t i;
+
+    for (i = sorted; i < n; i++) {
+        char  *pivot = ELEM(a, i);
+        size_t lo = 0, hi = i;
+
+        /* Insert after any equal elements */
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+
+            if (s->cmp(pivot, ELEM(a, mid)) < 0)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        if (lo == i)
+            continue;
+        if (get_tmp(s) < 0)
+            return -1;
+        copy_elem(s, s->tmp, pivot);
+        memmove(ELEM(a, lo + 1), ELEM(a, lo), (i - lo) * s->size);
+        copy_elem(s, ELEM(a, lo), s->tmp);
+    }
+    return 0;
+}
+
+/* Number of elements of a[0, n) that are <= key */
+static size_t
+upper_bound(struct timsort *s, const char *key, char *a, size_t n)
+{
+    size_t lo = 0, hi = n;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (s->cmp(key, ELEM(a, mid)) < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+/* Number of elements of a[0, n) that are < key */
+static size_t
+lower_bound(struct timsort *s, const char *key, char *a, size_t n)
+{
+    size_t lo = 0, hi = n;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (s->cmp(ELEM(a, mid), key) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* Merge a[0, la) with the following b[0, lb), copying a to tmp */
+static void
+merge_lo(struct timsort *s, char *a, size_t la, char *b, size_t lb)
+{
+    char *pa = s->tmp, *dst = a;
+
+    memcpy(s->tmp, a, la * s->size);
+    while (la && lb) {
+        if (s->cmp(b, pa) < 0) {
+            copy_elem(s, dst, b);
+            b += s->size;
+            lb--;
+        } else {
+            copy_elem(s, dst, pa);
+            pa += s->size;
+            la--;
+        }
+        dst += s->size;
+    }
+    /* Whatever is left of b is already in place */
+    if (la)
+        memcpy(dst, pa, la * s->size);
+}
+
+/* Merge a[0, la) with the following b[0, lb) from the top, copying b to tmp */
+static void
+merge_hi(struct timsort *s, char *a, size_t la, char *b, size_t lb)
+{
+    size_t d = la + lb;
+
+    memcpy(s->tmp, b, lb * s->size);
+    while (la && lb) {
+        /* On ties, the element from b goes last */
+        if (s->cmp(ELEM(s->tmp, lb - 1), ELEM(a, la - 1)) < 0) {
+            copy_elem(s, ELEM(a, d - 1), ELEM(a, la - 1));
+            la--;
+        } else {
+            copy_elem(s, ELEM(a, d - 1), ELEM(s->tmp, lb - 1));
+            lb--;
+        }
+        d--;
+    }
+    /* Whatever is left of a is already in place */
+    if (lb)
+        memcpy(a, s->tmp, lb * s->size);
+}
+
+/* Merge runs k and k + 1 on the stack */
+static int
+merge_at(struct timsort *s, size_t k)
+{
+    char  *a = ELEM(s->base, s->run[k].start);
+    size_t la = s->run[k].len;
+    char  *b = ELEM(s->base, s->run[k + 1].start);
+    size_t lb = s->run[k + 1].len;
+    size_t i;
+
+    s->run[k].len = la + lb;
+    if (k + 2 < s->nrun)
+        s->run[k + 1] = s->run[k + 2];
+    s->nrun--;
+
+    /* Elements of a that are <= b[0] are already in place */
+    i = upper_bound(s, b, a, la);
+    a = ELEM(a, i);
+    la -= i;
+    if (!la)
+        return 0;
+
+    /* So are elements of b that are >= a[la - 1] */
+    lb = lower_bound(s, ELEM(a, la - 1), b, lb);
+    if (!lb)
+        return 0;
+
+    if (get_tmp(s) < 0)
+        return -1;
+    if (la <= lb)
+        merge_lo(s, a, la, b, lb);
+    else
+        merge_hi(s, a, la, b, lb);
+    return 0;
+}
+
+/*
+ * Merge runs until each is longer than the next one, and longer
+ * than the following two together.
+ */
+static int
+merge_collapse(struct timsort *s)
+{
+    while (s->nrun > 1) {
+        size_t k = s->nrun - 2;
+
+        if ((k > 0 && s->run[k - 1].len <= s->run[k].len + s->run[k + 1].len)
+            || (k > 1 && s->run[k - 2].len <= s->run[k - 1].len + s->run[k].len)) {
+            if (s->run[k - 1].len < s->run[k + 1].len)
+                k--;
+        } else if (s->run[k].len > s->run[k + 1].len) {
+            break;
+        }
+        if (merge_at(s, k) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+static size_t
+min_run(size_t n)
+{
+    size_t r = 0;
+
+    while (n >= TIMSORT_MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+int
+timsort(void *base, size_t nmemb, size_t size, cmp_t *compar, void *tmp)
+{
+    struct timsort s;
+    size_t         lo = 0, minrun;
+    int            ret = 0;
+
+    if (nmemb < 2 || size == 0)
+        return 0;
+
+    if (nmemb / 2 > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    s.base = base;
+    s.size = size;
+    s.nmemb = nmemb;
+    s.cmp = compar;
+    s.tmp = tmp;
+    s.tmp_owned = false;
+    s.copy_long = false;
+    s.nrun = 0;
+
+    minrun = min_run(nmemb);
+    while (lo < nmemb) {
+        char  *a = s.base + lo * size;
+        size_t left = nmemb - lo;
+        size_t n = count_run(&s, a, left);
+
+        if (n < minrun) {
+            size_t want = minrun < left ? minrun : left;
+
+            if (binary_insertion(&s, a, want, n) < 0) {
+                ret = -1;
+                break;
+            }
+            n = want;
+        }
+        s.run[s.nrun].start = lo;
+        s.run[s.nrun].len = n;
+        s.nrun++;
+        if (merge_collapse(&s) < 0) {
+            ret = -1;
+            break;
+        }
+        lo += n;
+    }
+
+    /* Merge what is left from the top down */
+    while (ret == 0 && s.nrun > 1) {
+        size_t k = s.nrun - 2;
+
+        if (k > 0 && s.run[k - 1].len < s.run[k + 1].len)
+            k--;
+        ret = merge_at(&s, k);
+    }
+
+    if (s.tmp_owned)
+        free(s.tmp);
+    return ret;
+}
@@ -45,22 +45,21 @@ SUCH DAMAGE.
 #endif
 
 #include <assert.h>
-#define _SEARCH_PRIVATE
-#include <search.h>
 #include <stdlib.h>
+#include "tavl.h"
 
-/* find or insert datum into search tree */
-void *
-tsearch(const void *vkey,   /* key to be located */
-        void      **vrootp, /* address of tree root */
-        int         (*compar)(const void *, const void *))
+/*
+ * Find key, or link node into the tree in its place when node is not
+ * NULL. The tree is kept AVL balanced.
+ */
+static node_t *
+tsearch_insert(const void *vkey, node_t **rootp, int (*compar)(const void *, const void *),
+               node_t *q)
 {
-    node_t  *q;
-    node_t **rootp = (node_t **)vrootp;
-
-    if (rootp == NULL)
-        return NULL;
+    node_t **path[TAVL_MAX_HEIGHT + 1];
+    int      depth = 0;
 
+    path[0] = rootp;
     while (*rootp != NULL) { /* Knuth's T1: */
         int r;
 
@@ -69,14 +68,40 @@ tsearch(const void *vkey,   /* key to be located */
 
         rootp = (r < 0) ? &(*rootp)->llink : /* T3: follow left branch */
             &(*rootp)->rlink;                /* T4: follow right branch */
+        path[++depth] = rootp;
     }
 
-    q = malloc(sizeof(node_t)); /* T5: key not found */
-    if (q != 0) {               /* make new node */
-        *rootp = q;             /* link new node to old */
+    if (q == NULL)
+        q = malloc(sizeof(node_t)); /* T5: key not found */
+    if (q != NULL) {                /* make new node */
+        *rootp = q;                 /* link new node to old */
         /* LINTED const castaway ok */
         q->key = (void *)vkey; /* initialize new node */
         q->llink = q->rlink = NULL;
+        q->height = 1;
+        while (depth-- > 0 && tavl_rebalance(path[depth]))
+            ;
     }
     return q;
 }
+
+/* find or insert datum into search tree */
+void *
+tsearch(const void *vkey,   /* key to be located */
+        void      **vrootp, /* address of tree root */
+        int         (*compar)(const void *, const void *))
+{
+    if (vrootp == NULL)
+        return NULL;
+    return tsearch_insert(vkey, (node_t **)vrootp, compar, NULL);
+}
+
+/* find datum, or insert it using the caller's node */
+void *
+tinsert(const void *vkey, void **vrootp, int (*compar)(const void *, const void *),
+        struct tnode *node)
+{
+    if (vrootp == NULL || node == NULL)
+        return NULL;
+    return tsearch_insert(vkey, (node_t **)vrootp, compar, (node_t *)node);
+}
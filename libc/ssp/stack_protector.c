@@ -6,6 +6,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <picofast.h>
 
 #if defined(__AMDGCN__) || defined(__nvptx__)
 /* Global constructors not supported on this target, yet.  */
@@ -16,7 +17,8 @@ uintptr_t __stack_chk_guard = 0x00000aff; /* 0, 0, '\n', 255  */
 #ifdef __THREAD_LOCAL_STORAGE_STACK_GUARD
 #include "machine/_ssp_tls.h"
 #else
-uintptr_t __stack_chk_guard = 0;
+/* Every protected function reads this, see m65832-fast-data */
+uintptr_t __stack_chk_guard __libc_fastdata = 0;
 #endif
 
 int  getentropy(void *, size_t) __weak;
@@ -29,18 +31,18 @@ __stack_chk_init(void)
     if (__stack_chk_guard != 0)
         return;
 
-    if (getentropy) {
-        /* Use getentropy if available */
-        getentropy(&__stack_chk_guard, sizeof(__stack_chk_guard));
-    } else {
-        /* If getentropy is not available, use the "terminator canary". */
-        ((unsigned char *)&__stack_chk_guard)[0] = 0;
-        ((unsigned char *)&__stack_chk_guard)[1] = 0;
+    /* Use getentropy if available */
+    if (getentropy && getentropy(&__stack_chk_guard, sizeof(__stack_chk_guard)) == 0
+        && __stack_chk_guard != 0)
+        return;
+
+    /* If getentropy is not available or fails, use the "terminator canary". */
+    ((unsigned char *)&__stack_chk_guard)[0] = 0;
+    ((unsigned char *)&__stack_chk_guard)[1] = 0;
 #if __SIZEOF_POINTER__ > 2
-        ((unsigned char *)&__stack_chk_guard)[2] = '\n';
-        ((unsigned char *)&__stack_chk_guard)[3] = 255;
+    ((unsigned char *)&__stack_chk_guard)[2] = '\n';
+    ((unsigned char *)&__stack_chk_guard)[3] = 255;
 #endif
-    }
 }
 #endif
 
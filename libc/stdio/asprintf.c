@@ -39,7 +39,8 @@ int __disable_sanitizer
 asprintf(char **strp, const char *fmt, ...)
 {
     va_list           ap;
-    struct __file_str f = FDEV_SETUP_STRING_ALLOC();
+    /* The literal text of the format plus room for a few conversions */
+    struct __file_str f = FDEV_SETUP_STRING_ALLOC_HINT(strlen(fmt) + 32);
     int               i;
 
     va_start(ap, fmt);
@@ -48,10 +48,12 @@ floor_log2(const uint64_t value)
 
 #else
 
+#include <stdbit.h>
+
 static inline uint32_t
 floor_log2(const uint64_t value)
 {
-    return 63 - __builtin_clzll(value);
+    return stdc_bit_width(value) - 1;
 }
 
 #endif
@@ -40,16 +40,12 @@ floor_log2(const uint32_t value)
 
 #else
 
+#include <stdbit.h>
+
 static inline uint32_t
 floor_log2(const uint32_t value)
 {
-#if __SIZEOF_INT__ >= 4
-    return 31 - __builtin_clz(value);
-#elif __SIZEOF_INT__ < 4 && __SIZEOF_LONG__ >= 4
-    return 31 - __builtin_clzl(value);
-#else
-#error no usable clz
-#endif
+    return stdc_bit_width(value) - 1;
 }
 
 #endif
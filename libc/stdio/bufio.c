@@ -56,6 +56,14 @@ __bufio_flush_locked(FILE *f)
 
     switch (bf->dir) {
     case __SWR:
+        /* Data after a seek back into the buffer goes out too */
+        backup = 0;
+        if (bf->off > bf->len) {
+            backup = bf->off - bf->len;
+            bf->len = bf->off;
+        }
+        bf->off = 0;
+
         /* Flush everything, drop contents if that doesn't work */
         buf = bf->buf;
         while (bf->len) {
@@ -69,6 +77,13 @@ __bufio_flush_locked(FILE *f)
             bf->pos += this;
             bf->len -= this;
         }
+
+        /* and then the FD goes back to the write position */
+        if (backup) {
+            bf->pos -= backup;
+            if (bufio_lseek(bf, bf->pos, SEEK_SET) < 0)
+                return _FDEV_ERR;
+        }
         break;
     case __SRD:
         /* Move the FD back to the current read position */
@@ -210,6 +225,88 @@ bail:
     return ret;
 }
 
+size_t
+__bufio_get_span(char *s, size_t len, FILE *f)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+    char                *cp = s;
+    bool                 flushed = false;
+
+again:
+    __bufio_lock(f);
+    if (__bufio_setdir_locked(f, __SRD) < 0) {
+        f->flags |= __SERR;
+        goto bail;
+    }
+
+    while (len) {
+        int this_time = bf->len - bf->off;
+
+        if (this_time) {
+            /* Drain any buffered data */
+            if (len < (size_t)this_time)
+                this_time = len;
+            memcpy(cp, bf->buf + bf->off, this_time);
+            bf->off += this_time;
+            cp += this_time;
+            len -= this_time;
+            continue;
+        }
+
+        /* Flush stdout if reading from stdin, as in __bufio_get */
+        if (!flushed) {
+            flushed = true;
+            if (&stdin != NULL && &stdout != NULL && f == stdin) {
+                __bufio_unlock(f);
+                fflush(stdout);
+                goto again;
+            }
+        }
+
+#ifdef __FAST_BUFIO
+        if (len >= (size_t)bf->size) {
+            /* Large reads go directly to the destination */
+            ssize_t got;
+
+            bf->len = 0;
+            bf->off = 0;
+            if (bf->readv_int) {
+                /* and whatever follows refills the buffer */
+                struct iovec iov[2] = {
+                    { .iov_base = cp, .iov_len = len },
+                    { .iov_base = bf->buf, .iov_len = bf->size },
+                };
+                got = bufio_readv(bf, iov, 2);
+                if (got > (ssize_t)len) {
+                    bf->len = got - len;
+                    bf->pos += bf->len;
+                    got = len;
+                }
+            } else {
+                got = bufio_read(bf, cp, len);
+            }
+            if (got <= 0) {
+                f->flags |= (got < 0) ? __SERR : __SEOF;
+                break;
+            }
+            cp += got;
+            len -= got;
+            bf->pos += got;
+            continue;
+        }
+#endif
+        /* Small reads go through the buffer */
+        int ret = __bufio_fill_locked(f);
+        if (ret) {
+            f->flags |= (ret == _FDEV_ERR) ? __SERR : __SEOF;
+            break;
+        }
+    }
+bail:
+    __bufio_unlock(f);
+    return cp - s;
+}
+
 off_t
 __bufio_seek(FILE *f, off_t offset, int whence)
 {
@@ -217,6 +314,32 @@ __bufio_seek(FILE *f, off_t offset, int whence)
     off_t                ret;
 
     __bufio_lock(f);
+
+    /*
+     * While writing, the position is known without I/O, and seeks
+     * within the pending data move where the next byte goes, so
+     * ftell and rewriting a header do not flush. Writes to an
+     * O_APPEND file always go to the end, so those streams only skip
+     * the flush for ftell.
+     */
+    if (bf->dir == __SWR) {
+        __off_t cur = bf->pos + bf->len;
+        __off_t end = bf->pos + (bf->off > bf->len ? bf->off : bf->len);
+
+        if (whence == SEEK_CUR) {
+            whence = SEEK_SET;
+            offset += cur;
+        }
+        if (whence == SEEK_SET && bf->pos <= offset && offset <= end
+            && (offset == cur || !(bf->bflags & __BAPP))) {
+            if (bf->off < bf->len)
+                bf->off = bf->len;
+            bf->len = offset - bf->pos;
+            __bufio_unlock(f);
+            return offset;
+        }
+    }
+
     if (__bufio_setdir_locked(f, __SRD) < 0) {
         ret = _FDEV_ERR;
     } else {
@@ -58,5 +58,11 @@ __bufio_close(FILE *f)
         ret = bufio_close(bf);
         free(f);
     }
+#ifdef __STDIO_FILE_POOL
+    else if (bf->bflags & __BFPOOL) {
+        ret = bufio_close(bf);
+        __bufio_pool_put(bf);
+    }
+#endif
     return ret;
 }
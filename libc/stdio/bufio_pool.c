@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+
+#ifdef __STDIO_FILE_POOL
+
+/*
+ * Static FILEs for fopen and fdopen. Slots are handed out in order
+ * the first time round; released ones go on a LIFO free list, so
+ * taking and returning a slot costs the same whatever the pool size.
+ */
+
+struct __bufio_pool_slot {
+    struct __file_bufio       bf;
+    struct __bufio_pool_slot *next; /* free list link */
+    char                      buf[__STDIO_FILE_POOL_BUFSIZ];
+};
+
+static struct __bufio_pool_slot  __bufio_pool[__STDIO_FILE_POOL];
+static struct __bufio_pool_slot *__bufio_pool_free;
+static size_t                    __bufio_pool_used; /* slots never handed out start here */
+
+struct __file_bufio *
+__bufio_pool_get(char **buf)
+{
+    struct __bufio_pool_slot *slot;
+
+    __LIBC_LOCK();
+    slot = __bufio_pool_free;
+    if (slot)
+        __bufio_pool_free = slot->next;
+    else if (__bufio_pool_used < __STDIO_FILE_POOL)
+        slot = &__bufio_pool[__bufio_pool_used++];
+    __LIBC_UNLOCK();
+
+    if (!slot)
+        return NULL;
+    *buf = slot->buf;
+    return &slot->bf;
+}
+
+void
+__bufio_pool_put(struct __file_bufio *bf)
+{
+    struct __bufio_pool_slot *slot = (struct __bufio_pool_slot *)bf;
+
+    __LIBC_LOCK();
+    slot->next = __bufio_pool_free;
+    __bufio_pool_free = slot;
+    __LIBC_UNLOCK();
+}
+
+#endif /* __STDIO_FILE_POOL */
@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+
+/*
+ * Write 'count' bytes from 'buf' to the underlying file, bypassing
+ * the buffer. Any data already in the buffer is sent first; when the
+ * file provides a writev function, both go out in a single call.
+ * Returns the number of bytes from 'buf' which were written.
+ */
+size_t
+__bufio_write_direct_locked(FILE *f, const void *buf, size_t count)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+    const char          *cp = buf;
+    size_t               done = 0;
+
+    /* After a seek back into the buffer, the flush below handles the data past len */
+    if (bf->len && bf->off <= bf->len && bf->writev_int) {
+        struct iovec iov[2] = {
+            { .iov_base = bf->buf, .iov_len = bf->len },
+            { .iov_base = (void *)cp, .iov_len = count },
+        };
+        ssize_t this = bufio_writev(bf, iov, 2);
+
+        if (this > 0) {
+            bf->pos += this;
+            if (this >= bf->len) {
+                done = this - bf->len;
+                bf->len = 0;
+            } else {
+                /* Keep the unwritten tail for the flush below */
+                memmove(bf->buf, bf->buf + this, bf->len - this);
+                bf->len -= this;
+            }
+        }
+    }
+
+    if (__bufio_flush_locked(f) < 0)
+        return done;
+
+    while (done < count) {
+        ssize_t this = bufio_write(bf, cp + done, count - done);
+        if (this <= 0)
+            break;
+        done += this;
+        bf->pos += this;
+    }
+    return done;
+}
+
+size_t
+__bufio_put_span(const char *s, size_t len, FILE *f)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+    const char          *cp = s;
+    bool                 newline = false;
+
+    __bufio_lock(f);
+    if (__bufio_setdir_locked(f, __SWR) < 0)
+        goto bail;
+
+#ifdef __FAST_BUFIO
+    if (len >= (size_t)bf->size) {
+        /* Large writes go direct, which also satisfies line buffering. */
+        cp += __bufio_write_direct_locked(f, cp, len);
+        goto bail;
+    }
+#endif
+
+    /* Small writes go through the buffer. */
+    while (len) {
+        int this_time = bf->size - bf->len;
+
+        if (this_time == 0) {
+            if (__bufio_flush_locked(f) < 0)
+                goto bail;
+            this_time = bf->size;
+        }
+        if ((size_t)this_time > len)
+            this_time = len;
+        memcpy(bf->buf + bf->len, cp, this_time);
+        if ((bf->bflags & __BLBF) && memchr(cp, '\n', this_time))
+            newline = true;
+        bf->len += this_time;
+        cp += this_time;
+        len -= this_time;
+    }
+
+    /* Flush if full, or after a newline when line buffered */
+    if ((bf->len >= bf->size || newline) && __bufio_flush_locked(f) < 0)
+        cp = s;
+bail:
+    __bufio_unlock(f);
+    return cp - s;
+}
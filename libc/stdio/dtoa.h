@@ -58,6 +58,8 @@
 #define FTOA_SCALE_UP_NUM 6
 #define FTOA_ROUND_NUM    (FTOA_MAX_DIG + 1)
 
+#define FIXED_MAX_DECIMALS 9
+
 #ifdef _NEED_IO_LONG_DOUBLE
 #if __SIZEOF_LONG_DOUBLE__ == 4
 #define _NEED_IO_FLOAT32
@@ -88,12 +90,14 @@
 #define _NEED_IO_FLOAT32
 #define FLOAT_MAX_DIG        FTOA_MAX_DIG
 #define __float_d_engine     __ftoa_engine
+#define __float_f_engine     __ftoa_fixed_engine
 #define __float_x_engine     __ftox_engine
 #define PRINTF_FLOAT_ARG(ap) (asuint(va_arg(ap, double)))
 #elif __SIZEOF_DOUBLE__ == 8
 #define _NEED_IO_FLOAT64
 #define FLOAT_MAX_DIG        DTOA_MAX_DIG
 #define __float_d_engine     __dtoa_engine
+#define __float_f_engine     __dtoa_fixed_engine
 #define __float_x_engine     __dtox_engine
 #define PRINTF_FLOAT_ARG(ap) (asuint64(va_arg(ap, double)))
 #endif
@@ -104,6 +108,7 @@
 #define PRINTF_FLOAT_ARG(ap) (va_arg(ap, uint32_t))
 #define FLOAT_MAX_DIG        FTOA_MAX_DIG
 #define __float_d_engine     __ftoa_engine
+#define __float_f_engine     __ftoa_fixed_engine
 #define __float_x_engine     __ftox_engine
 #endif
 
@@ -136,6 +141,8 @@ int __dtoa_engine(uint64_t x, struct dtoa *dtoa, int max_digits, bool fmode, int
 
 int __dtox_engine(uint64_t x, struct dtoa *dtoa, int prec, unsigned char case_convert);
 
+int __dtoa_fixed_engine(uint64_t x, struct dtoa *dtoa, int max_decimals);
+
 FLOAT64
 __atod_engine(uint64_t m10, int e10);
 #endif
@@ -145,6 +152,8 @@ int   __ftoa_engine(uint32_t val, struct dtoa *ftoa, int max_digits, bool fmode,
 
 int   __ftox_engine(uint32_t x, struct dtoa *dtoa, int prec, unsigned char case_convert);
 
+int   __ftoa_fixed_engine(uint32_t x, struct dtoa *dtoa, int max_decimals);
+
 float __atof_engine(uint32_t m10, int e10);
 #endif
 
@@ -0,0 +1,217 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DTOA_FIXED_SIZE
+#define DTOA_FIXED_SIZE 8
+#endif
+
+#include "stdio_private.h"
+
+#if DTOA_FIXED_SIZE == 4 || defined(FLOAT64)
+
+#if DTOA_FIXED_SIZE == 8
+
+#define FIXED_UINT  uint64_t
+#define SIGN_SHIFT  63
+#define EXP_SHIFT   52
+#define EXP_MASK    0x7ff
+#define SIG_BITS    52
+#define EXP_BIAS    1023
+
+#define _NEED_IO_FLOAT64
+
+#elif DTOA_FIXED_SIZE == 4
+
+#define _NEED_IO_FLOAT32
+#define __dtoa_fixed_engine __ftoa_fixed_engine
+
+#define FIXED_UINT          uint32_t
+#define SIGN_SHIFT          31
+#define EXP_SHIFT           23
+#define EXP_MASK            0xff
+#define SIG_BITS            23
+#define EXP_BIAS            127
+#endif
+
+#include "dtoa.h"
+#include "../stdlib/local-utoa.h"
+
+/*
+ * Integer-only conversion for "%.Nf" with small N and values below
+ * 2^32. The value is split into a 32-bit integer part and an exact
+ * binary fraction; fraction digits come from repeatedly multiplying
+ * the fraction by ten, and the result is rounded half-even on the
+ * exact remainder, which is what the full engines produce. Anything
+ * outside that range returns -1 so the caller can use __dtoa_engine.
+ *
+ * Values below 2^-31 always round to zero with at most nine
+ * decimals, so the fraction never needs more than SIG_BITS + 32
+ * bits.
+ */
+
+#define FIXED_INT_DIG 10 /* digits in 2^32 - 1 */
+#define FIXED_LIMBS   ((SIG_BITS + 32 + 31) / 32)
+
+static char
+fixed_digit(uint32_t *frac)
+{
+    uint32_t carry = 0;
+    int      i;
+
+    for (i = 0; i < FIXED_LIMBS; i++) {
+        uint64_t t = (uint64_t)frac[i] * 10 + carry;
+        frac[i] = (uint32_t)t;
+        carry = (uint32_t)(t >> 32);
+    }
+    return (char)('0' + carry);
+}
+
+int
+__dtoa_fixed_engine(FIXED_UINT bits, struct dtoa *dtoa, int max_decimals)
+{
+    int      exp2 = (int)((bits >> EXP_SHIFT) & EXP_MASK);
+    uint64_t sig = bits & (((FIXED_UINT)1 << SIG_BITS) - 1);
+    uint32_t frac[FIXED_LIMBS] = { 0 };
+    char     buf[1 + FIXED_INT_DIG + FIXED_MAX_DECIMALS];
+    char    *p, *end;
+    int      shift, nint, i;
+    uint32_t ipart = 0;
+    bool     up;
+
+    if (max_decimals > FIXED_MAX_DECIMALS || exp2 == EXP_MASK || exp2 - EXP_BIAS >= 32)
+        return -1;
+
+    dtoa->flags = (bits >> SIGN_SHIFT) ? DTOA_MINUS : 0;
+
+    if (exp2)
+        sig |= (uint64_t)1 << SIG_BITS;
+    else
+        exp2 = 1;
+
+    /* value = sig / 2^shift */
+    shift = EXP_BIAS + SIG_BITS - exp2;
+
+    if (sig == 0 || shift >= SIG_BITS + 32) {
+        if (sig == 0)
+            dtoa->flags |= DTOA_ZERO;
+        dtoa->digits[0] = '0';
+        dtoa->exp = 0;
+        return 1;
+    }
+
+    if (shift <= 0) {
+        ipart = (uint32_t)(sig << -shift);
+    } else {
+        uint64_t fbits = sig;
+        int      sh = FIXED_LIMBS * 32 - shift;
+
+        if (shift < 64) {
+            ipart = (uint32_t)(sig >> shift);
+            fbits &= ((uint64_t)1 << shift) - 1;
+        }
+
+        /* frac = fbits << sh, split into 32-bit limbs */
+        for (i = 0; i < FIXED_LIMBS; i++) {
+            int b = 32 * i - sh;
+
+            if (b >= 0)
+                frac[i] = b < 64 ? (uint32_t)(fbits >> b) : 0;
+            else
+                frac[i] = -b < 64 ? (uint32_t)(fbits << -b) : 0;
+        }
+    }
+
+    /* Integer digits, most significant first, after a spare carry slot */
+    p = buf + 1;
+    end = __utoa_dec_invert(ipart, p);
+    nint = end - p;
+    for (i = 0; i < nint / 2; i++) {
+        char t = p[i];
+        p[i] = p[nint - 1 - i];
+        p[nint - 1 - i] = t;
+    }
+
+    for (i = 0; i < max_decimals; i++)
+        *end++ = fixed_digit(frac);
+
+    /* Round half-even on the remaining fraction */
+    if (frac[FIXED_LIMBS - 1] != 0x80000000)
+        up = frac[FIXED_LIMBS - 1] > 0x80000000;
+    else {
+        up = ((end[-1] - '0') & 1) != 0;
+        for (i = 0; i < FIXED_LIMBS - 1; i++)
+            if (frac[i])
+                up = true;
+    }
+
+    if (up) {
+        char *q = end;
+
+        for (;;) {
+            if (q == p) {
+                *--p = '1';
+                nint++;
+                break;
+            }
+            if (*--q != '9') {
+                (*q)++;
+                break;
+            }
+            *q = '0';
+        }
+    }
+
+    /* Drop leading and trailing zeros; the printer fills them back in */
+    while (p < end && *p == '0') {
+        p++;
+        nint--;
+    }
+    if (p == end) {
+        dtoa->digits[0] = '0';
+        dtoa->exp = 0;
+        return 1;
+    }
+    while (end[-1] == '0')
+        end--;
+
+    if (end - p > DTOA_DIGITS)
+        return -1;
+
+    memcpy(dtoa->digits, p, end - p);
+    dtoa->exp = nint - 1;
+    return end - p;
+}
+
+#endif
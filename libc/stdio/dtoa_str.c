@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Format a floating point value like printf's "%.<prec><conv>" with
+ * conv one of e, E, f, F, g or G, straight into a caller buffer with
+ * snprintf's truncation and return value. This is the core of strfromd
+ * and gcvt; it runs the same digit engines and layout as vfprintf but
+ * without a FILE, format parsing or per-character put calls. A negative
+ * prec means the default of 6.
+ */
+
+#ifndef DTOA_STR_SIZE
+#define DTOA_STR_SIZE 8
+#endif
+
+#include "stdio_private.h"
+
+#if DTOA_STR_SIZE == 8
+#define _NEED_IO_DOUBLE
+#define DTOA_STR_NAME __dtoa_str
+#define DTOA_STR_TYPE double
+#elif DTOA_STR_SIZE == 4
+#define _NEED_IO_FLOAT
+#define DTOA_STR_NAME __ftoa_str
+#define DTOA_STR_TYPE float
+#endif
+
+#include "dtoa.h"
+
+#if DTOA_STR_SIZE == 8 && __SIZEOF_DOUBLE__ == 8
+#define DTOA_STR_BITS(x) asuint64(x)
+#else
+#define DTOA_STR_BITS(x) asuint(x)
+#endif
+
+#define PUT(ch)                  \
+    do {                         \
+        if (len + 1 < n)         \
+            str[len] = (ch);     \
+        len++;                   \
+    } while (0)
+
+#define TOCASE(ch) ((ch) - case_convert)
+
+int
+DTOA_STR_NAME(char *str, size_t n, DTOA_STR_TYPE x, int prec, char conv)
+{
+    struct dtoa   dtoa;
+    unsigned char case_convert = TOLOWER(conv) - conv;
+    char          c = TOLOWER(conv);
+    bool          fmode = false, fix = false;
+    int           ndigs, ndecimal = 0, exp, ndigs_exp, pos;
+    size_t        len = 0;
+    const char   *s;
+    char          out;
+
+    if (prec < 0)
+        prec = 6;
+    if (c == 'e') {
+        ndigs = prec + 1;
+    } else if (c == 'f') {
+        ndigs = FLOAT_MAX_DIG;
+        ndecimal = prec;
+        fmode = fix = true;
+    } else {
+        ndigs = prec < 1 ? 1 : prec;
+    }
+    if (ndigs > FLOAT_MAX_DIG)
+        ndigs = FLOAT_MAX_DIG;
+
+#ifdef __IO_FLOAT_FIXED
+    int nfixed = fmode ? __float_f_engine(DTOA_STR_BITS(x), &dtoa, ndecimal) : -1;
+    if (nfixed >= 0)
+        ndigs = nfixed;
+    else
+#endif
+        ndigs = __float_d_engine(DTOA_STR_BITS(x), &dtoa, ndigs, fmode, ndecimal);
+    exp = dtoa.exp;
+
+    if (dtoa.flags & DTOA_MINUS)
+        PUT('-');
+
+    if (dtoa.flags & (DTOA_NAN | DTOA_INF)) {
+        for (s = (dtoa.flags & DTOA_NAN) ? "nan" : "inf"; *s; s++)
+            PUT(TOCASE(*s));
+        goto done;
+    }
+
+    if (c == 'g') {
+        int req_prec = prec ? prec : 1;
+
+        /* As in vfprintf: drop trailing zeros, then pick f or e */
+        while (ndigs > 0 && dtoa.digits[ndigs - 1] == '0')
+            ndigs--;
+        prec = ndigs;
+        if (-4 <= exp && exp < req_prec) {
+            fix = true;
+            prec = exp < prec ? prec - (exp + 1) : 0;
+        } else {
+            prec = prec - 1;
+        }
+        c = 'e';
+    }
+
+    if (fix) {
+        /* Walk the exponent down from the leftmost digit */
+        int e = exp > 0 ? exp : 0;
+
+        for (;;) {
+            if (e == -1)
+                PUT('.');
+            out = (0 <= exp - e && exp - e < ndigs) ? dtoa.digits[exp - e] : '0';
+            if (--e < -prec)
+                break;
+            PUT(out);
+        }
+        PUT(out);
+        goto done;
+    }
+
+    PUT(dtoa.digits[0]);
+    if (prec > 0) {
+        PUT('.');
+        for (pos = 1; pos < 1 + prec; pos++)
+            PUT(pos < ndigs ? dtoa.digits[pos] : '0');
+    }
+    PUT(TOCASE(c));
+    if (exp < 0) {
+        PUT('-');
+        exp = -exp;
+    } else {
+        PUT('+');
+    }
+    ndigs_exp = 2;
+    if (exp > 99)
+        ndigs_exp = 3;
+#ifdef _NEED_IO_FLOAT64
+    if (exp > 999)
+        ndigs_exp = 4;
+    if (ndigs_exp > 3) {
+        PUT(exp / 1000 + '0');
+        exp %= 1000;
+    }
+#endif
+    if (ndigs_exp > 2) {
+        PUT(exp / 100 + '0');
+        exp %= 100;
+    }
+    PUT(exp / 10 + '0');
+    PUT(exp % 10 + '0');
+
+done:
+    if (n)
+        str[len < n ? len : n - 1] = '\0';
+    return (int)len;
+}
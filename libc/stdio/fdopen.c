@@ -43,22 +43,35 @@ fdopen(int fd, const char *mode)
     struct __file_bufio *bf;
     char                *buf;
     size_t               buf_size;
+    int                  bflags = __BFALL;
 
     stdio_flags = __stdio_flags(mode, &open_flags);
     if (stdio_flags == 0)
         return NULL;
+    if (open_flags & O_APPEND)
+        bflags |= __BAPP;
 
-    buf_size = bufio_get_buf_size(fd);
+#ifdef __STDIO_FILE_POOL
+    /* Static FILEs first, so opening a file needs no heap */
+    bf = __bufio_pool_get(&buf);
+    if (bf) {
+        buf_size = __STDIO_FILE_POOL_BUFSIZ;
+        bflags = __BFPOOL | (bflags & __BAPP);
+    } else
+#endif
+    {
+        buf_size = bufio_get_buf_size(fd);
 
-    /* Allocate file structure and necessary buffers */
-    bf = calloc(1, sizeof(struct __file_bufio) + buf_size);
+        /* Allocate file structure and necessary buffers */
+        bf = calloc(1, sizeof(struct __file_bufio) + buf_size);
 
-    if (bf == NULL)
-        return NULL;
+        if (bf == NULL)
+            return NULL;
 
-    buf = (char *)(bf + 1);
+        buf = (char *)(bf + 1);
+    }
 
-    *bf = (struct __file_bufio)FDEV_SETUP_POSIX(fd, buf, buf_size, stdio_flags, __BFALL);
+    *bf = (struct __file_bufio)FDEV_SETUP_POSIX(fd, buf, buf_size, stdio_flags, bflags);
 
     if (open_flags & O_APPEND)
         (void)fseeko(&(bf->xfile.cfile.file), 0, SEEK_END);
@@ -36,12 +36,33 @@
 #include "stdio_private.h"
 
 int
-fflush(FILE *stream)
+__STDIO_UNLOCKED(fflush)(FILE *stream)
 {
     int ret = 0;
-    __flockfile(stream);
     if (stream->flush)
         ret = (stream->flush)(stream);
     __atomic_store_ungetc(&stream->unget, 0);
-    __funlock_return(stream, ret);
+    return ret;
+}
+
+#ifdef __STDIO_LOCKING
+int
+fflush(FILE *stream)
+{
+    int ret;
+    __flockfile(stream);
+    ret = fflush_unlocked(stream);
+    __funlockfile(stream);
+    return ret;
+}
+#else
+#ifdef __strong_reference
+__strong_reference(fflush, fflush_unlocked);
+#else
+int
+fflush_unlocked(FILE *stream)
+{
+    return fflush(stream);
 }
+#endif
+#endif
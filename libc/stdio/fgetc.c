@@ -45,7 +45,7 @@ __STDIO_UNLOCKED(getc)(FILE *stream)
         return EOF;
     }
 
-    if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0)
+    if ((unget = __take_ungetc(&stream->unget)) != 0)
         return (unsigned char)(unget - 1);
 
     rv = stream->get(stream);
@@ -89,3 +89,17 @@ fgetc(FILE *stream)
     return getc(stream);
 }
 #endif
+
+#ifdef __strong_reference
+#ifdef __STDIO_LOCKING
+__strong_reference(getc_unlocked, fgetc_unlocked);
+#else
+__strong_reference(getc, fgetc_unlocked);
+#endif
+#else
+int
+fgetc_unlocked(FILE *stream)
+{
+    return getc_unlocked(stream);
+}
+#endif
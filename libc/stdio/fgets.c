@@ -32,20 +32,19 @@
 #include "stdio_private.h"
 
 char *
-fgets(char *str, int size, FILE *stream)
+__STDIO_UNLOCKED(fgets)(char *str, int size, FILE *stream)
 {
     char *cp;
     int   c;
 
-    __flockfile(stream);
     if ((stream->flags & __SRD) == 0 || size <= 0)
-        __funlock_return(stream, NULL);
+        return NULL;
 
     size--;
     for (c = 0, cp = str; c != '\n' && size > 0; size--, cp++) {
         if ((c = getc_unlocked(stream)) == EOF) {
             if (cp == str)
-                __funlock_return(stream, NULL);
+                return NULL;
             else
                 break;
         }
@@ -53,5 +52,27 @@ fgets(char *str, int size, FILE *stream)
     }
     *cp = '\0';
 
-    __funlock_return(stream, str);
+    return str;
+}
+
+#ifdef __STDIO_LOCKING
+char *
+fgets(char *str, int size, FILE *stream)
+{
+    char *ret;
+    __flockfile(stream);
+    ret = fgets_unlocked(str, size, stream);
+    __funlockfile(stream);
+    return ret;
+}
+#else
+#ifdef __strong_reference
+__strong_reference(fgets, fgets_unlocked);
+#else
+char *
+fgets_unlocked(char *str, int size, FILE *stream)
+{
+    return fgets(str, size, stream);
 }
+#endif
+#endif
@@ -48,9 +48,15 @@ __STDIO_UNLOCKED(getwc)(FILE *stream)
     if ((stream->flags & __SRD) == 0)
         return WEOF;
 
-    if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0)
+    if ((unget = __take_ungetc(&stream->unget)) != 0)
         return (wint_t)(unget - 1);
 
+    if (stream->get_span) {
+        if (stream->get_span(u.c, sizeof(wchar_t), stream) != sizeof(wchar_t))
+            return WEOF;
+        return (wint_t)u.wc;
+    }
+
     for (i = 0; i < sizeof(wchar_t); i++) {
         sc = stream->get(stream);
         if (sc < 0)
@@ -36,12 +36,33 @@
 #include "stdio_private.h"
 
 int
-fileno(FILE *stream)
+__STDIO_UNLOCKED(fileno)(FILE *stream)
 {
-    __flockfile(stream);
     if (stream->flags & __SBUF) {
         struct __file_bufio *pf = (struct __file_bufio *)stream;
-        __funlock_return(stream, (int)(intptr_t)(pf->ptr));
+        return (int)(intptr_t)(pf->ptr);
     }
-    __funlock_return(stream, -1);
+    return -1;
+}
+
+#ifdef __STDIO_LOCKING
+int
+fileno(FILE *stream)
+{
+    int ret;
+    __flockfile(stream);
+    ret = fileno_unlocked(stream);
+    __funlockfile(stream);
+    return ret;
+}
+#else
+#ifdef __strong_reference
+__strong_reference(fileno, fileno_unlocked);
+#else
+int
+fileno_unlocked(FILE *stream)
+{
+    return fileno(stream);
 }
+#endif
+#endif
@@ -50,3 +50,19 @@ __file_str_put(char c, FILE *stream)
         *sstream->pos++ = c;
     return (unsigned char)c;
 }
+
+size_t
+__file_str_put_span(const char *s, size_t len, FILE *stream)
+{
+    struct __file_str *sstream = (struct __file_str *)stream;
+    size_t             room = len;
+
+    /* Truncate like __file_str_put; a NULL end alone means no limit */
+    if (sstream->pos == sstream->end)
+        return len;
+    if (sstream->end && (size_t)(sstream->end - sstream->pos) < room)
+        room = sstream->end - sstream->pos;
+    memcpy(sstream->pos, s, room);
+    sstream->pos += room;
+    return len;
+}
@@ -34,30 +34,71 @@
  */
 
 #include "stdio_private.h"
+#include <stdint.h>
+
+#define FILE_STR_ALLOC_MIN 32
+
+/*
+ * Make room for at least 'need' more bytes after pos. The buffer grows
+ * by half each time, so building a long string costs a logarithmic
+ * number of reallocs rather than one per few bytes; the callers shrink
+ * it to fit at the end. The first allocation is at least the hint.
+ */
+static bool __disable_sanitizer
+__file_str_grow(struct __file_str *sstream, size_t need)
+{
+    size_t used = sstream->size - (sstream->end - sstream->pos);
+    size_t old_size = sstream->size;
+    char  *old = POINTER_MINUS(sstream->end, old_size);
+    size_t new_size = old_size + old_size / 2;
+    char  *new;
+
+    if (need > SIZE_MAX - used)
+        return false;
+    if (new_size < sstream->hint)
+        new_size = sstream->hint;
+    if (new_size < FILE_STR_ALLOC_MIN)
+        new_size = FILE_STR_ALLOC_MIN;
+    if (new_size < used + need)
+        new_size = used + need;
+
+    if (sstream->alloc)
+        new = realloc(old, new_size);
+    else {
+        new = malloc(new_size);
+        if (new && used)
+            memcpy(new, old, used);
+    }
+    if (!new)
+        return false;
+    sstream->size = new_size;
+    sstream->pos = new + used;
+    sstream->end = new + new_size;
+    sstream->alloc = true;
+    return true;
+}
 
 int __disable_sanitizer
 __file_str_put_alloc(char c, FILE *stream)
 {
     struct __file_str *sstream = (struct __file_str *)stream;
-    if (sstream->pos == sstream->end) {
-        size_t old_size = sstream->size;
-        char  *old = POINTER_MINUS(sstream->end, old_size);
-        size_t new_size = old_size + 32;
-        char  *new;
-        if (sstream->alloc)
-            new = realloc(old, new_size);
-        else {
-            new = malloc(new_size);
-            if (new && old_size)
-                memcpy(new, old, old_size);
-        }
-        if (!new)
-            return EOF;
-        sstream->size = new_size;
-        sstream->pos = new + old_size;
-        sstream->end = new + new_size;
-        sstream->alloc = true;
-    }
+
+    if (sstream->pos == sstream->end && !__file_str_grow(sstream, 1))
+        return EOF;
     *sstream->pos++ = c;
     return (unsigned char)c;
 }
+
+size_t __disable_sanitizer
+__file_str_put_span_alloc(const char *s, size_t len, FILE *stream)
+{
+    struct __file_str *sstream = (struct __file_str *)stream;
+
+    if (len == 0)
+        return 0;
+    if ((size_t)(sstream->end - sstream->pos) < len && !__file_str_grow(sstream, len))
+        return 0;
+    memcpy(sstream->pos, s, len);
+    sstream->pos += len;
+    return len;
+}
@@ -35,18 +35,6 @@
 
 #include "stdio_private.h"
 
-#define __MALL 0x01
-#define __MAPP 0x02
-
-struct __file_mem {
-    struct __file_ext xfile;
-    char             *buf;
-    size_t            size;    /* Current size. */
-    size_t            bufsize; /* Upper limit on size. */
-    size_t            pos;
-    uint8_t           mflags;
-};
-
 static int
 __fmem_put(char c, FILE *f)
 {
@@ -73,7 +61,7 @@ __fmem_put(char c, FILE *f)
     }
 }
 
-static int
+int
 __fmem_get(FILE *f)
 {
     struct __file_mem *mf = (struct __file_mem *)f;
@@ -86,6 +74,88 @@ __fmem_get(FILE *f)
     }
 }
 
+static size_t
+__fmem_put_span(const char *s, size_t len, FILE *f)
+{
+    size_t room;
+    char  *dst = __fmem_writeptr(f, &room);
+
+    if (!dst)
+        return 0;
+    if (len > room)
+        len = room;
+    memcpy(dst, s, len);
+    __fmem_writeptrinc(f, len);
+    return len;
+}
+
+static size_t
+__fmem_get_span(char *s, size_t len, FILE *f)
+{
+    size_t      avail;
+    const char *src = __fmem_readptr(f, &avail);
+
+    if (!src) {
+        f->flags |= (f->flags & __SRD) ? __SEOF : __SERR;
+        return 0;
+    }
+    if (len > avail) {
+        len = avail;
+        f->flags |= __SEOF;
+    }
+    memcpy(s, src, len);
+    __fmem_readptrinc(f, len);
+    return len;
+}
+
+/* Buffer windows for stdio_ext.h */
+
+const char *
+__fmem_readptr(FILE *f, size_t *sizep)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+
+    if ((f->flags & __SRD) == 0 || mf->pos >= mf->size)
+        return NULL;
+    *sizep = mf->size - mf->pos;
+    return mf->buf + mf->pos;
+}
+
+void
+__fmem_readptrinc(FILE *f, size_t increment)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+
+    mf->pos += increment;
+}
+
+char *
+__fmem_writeptr(FILE *f, size_t *sizep)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+    size_t             pos = mf->mflags & __MAPP ? mf->size : mf->pos;
+
+    if ((f->flags & __SWR) == 0 || pos >= mf->bufsize)
+        return NULL;
+    *sizep = mf->bufsize - pos;
+    return mf->buf + pos;
+}
+
+void
+__fmem_writeptrinc(FILE *f, size_t increment)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+    size_t             pos = (mf->mflags & __MAPP ? mf->size : mf->pos) + increment;
+
+    if (pos > mf->size) {
+        mf->size = pos;
+        /* Keep the buffer NUL terminated, as __fmem_put does */
+        if (mf->size < mf->bufsize)
+            mf->buf[mf->size] = '\0';
+    }
+    mf->pos = pos;
+}
+
 static int
 __fmem_flush(FILE *f)
 {
@@ -99,7 +169,7 @@ __fmem_flush(FILE *f)
     return 0;
 }
 
-static off_t
+off_t
 __fmem_seek(FILE *f, off_t pos, int whence)
 {
     struct __file_mem *mf = (struct __file_mem *)f;
@@ -192,8 +262,8 @@ fmemopen(void *buf, size_t size, const char *mode)
     }
 
     *mf = (struct __file_mem) {
-        .xfile = FDEV_SETUP_EXT(__fmem_put, __fmem_get, __fmem_flush, __fmem_close, __fmem_seek,
-                                NULL, stdio_flags),
+        .xfile = FDEV_SETUP_EXT_SPAN(__fmem_put, __fmem_get, __fmem_put_span, __fmem_get_span,
+                                     __fmem_flush, __fmem_close, __fmem_seek, NULL, stdio_flags),
         .buf = buf,
         .size = initial_size,
         .bufsize = size,
@@ -51,6 +51,13 @@ fopen(const char *pathname, const char *mode)
     if (fd < 0)
         return NULL;
 
+    /* Read-only streams can map the file instead, as in glibc */
+    if (stdio_flags == __SRD && strchr(mode, 'm')) {
+        ret = __fopen_mmap(fd);
+        if (ret != NULL)
+            return ret;
+    }
+
     ret = fdopen(fd, mode);
     if (ret == NULL)
         close(fd);
@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+#include <sys/mman.h>
+
+/*
+ * Read-only streams over a mapped file, used by fopen with an 'm'
+ * in the mode. They share the fmemopen code, so reads and the
+ * stdio_ext.h windows come straight from the mapping. mmap is weak
+ * so that targets without it fall back to a regular stream.
+ */
+
+extern void *mmap(void *, size_t, int, int, int, off_t) __weak;
+extern int   munmap(void *, size_t) __weak;
+
+static int
+__fmem_mmap_close(FILE *f)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+
+    munmap(mf->buf, mf->bufsize);
+    free(f);
+    return 0;
+}
+
+FILE *
+__fopen_mmap(int fd)
+{
+    struct __file_mem *mf;
+    off_t              size;
+    void              *buf;
+
+    if (!mmap || !munmap)
+        return NULL;
+
+    size = lseek(fd, 0, SEEK_END);
+    if (lseek(fd, 0, SEEK_SET) < 0 || size <= 0 || (off_t)(size_t)size != size)
+        return NULL;
+
+    mf = calloc(1, sizeof(struct __file_mem));
+    if (mf == NULL)
+        return NULL;
+
+    buf = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (buf == MAP_FAILED) {
+        free(mf);
+        return NULL;
+    }
+
+    /* The mapping stays valid without the descriptor */
+    close(fd);
+
+    *mf = (struct __file_mem) {
+        .xfile = FDEV_SETUP_EXT(NULL, __fmem_get, NULL, __fmem_mmap_close, __fmem_seek, NULL,
+                                __SRD),
+        .buf = buf,
+        .size = (size_t)size,
+        .bufsize = (size_t)size,
+    };
+
+    return (FILE *)mf;
+}
@@ -79,3 +79,17 @@ fputc(int c, FILE *stream)
     return putc(c, stream);
 }
 #endif
+
+#ifdef __strong_reference
+#ifdef __STDIO_LOCKING
+__strong_reference(putc_unlocked, fputc_unlocked);
+#else
+__strong_reference(putc, fputc_unlocked);
+#endif
+#else
+int
+fputc_unlocked(int c, FILE *stream)
+{
+    return putc_unlocked(c, stream);
+}
+#endif
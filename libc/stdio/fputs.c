@@ -32,25 +32,37 @@
 #include "stdio_private.h"
 
 int
-fputs(const char *str, FILE *stream)
+__STDIO_UNLOCKED(fputs)(const char *str, FILE *stream)
 {
-    int  (*put)(char, struct __file *);
-    char c;
-    int  ret = EOF;
-
-    __flockfile(stream);
     if ((stream->flags & __SWR) == 0)
-        goto fail;
+        return EOF;
 
-    put = stream->put;
+    if (__file_put_span(str, strlen(str), stream) < 0) {
+        stream->flags |= __SERR;
+        return EOF;
+    }
 
-    while ((c = *str++) != '\0')
-        if (put(c, stream) < 0) {
-            stream->flags |= __SERR;
-            goto fail;
-        }
+    return 0;
+}
 
-    ret = 0;
-fail:
-    __funlock_return(stream, ret);
+#ifdef __STDIO_LOCKING
+int
+fputs(const char *str, FILE *stream)
+{
+    int ret;
+    __flockfile(stream);
+    ret = fputs_unlocked(str, stream);
+    __funlockfile(stream);
+    return ret;
+}
+#else
+#ifdef __strong_reference
+__strong_reference(fputs, fputs_unlocked);
+#else
+int
+fputs_unlocked(const char *str, FILE *stream)
+{
+    return fputs(str, stream);
 }
+#endif
+#endif
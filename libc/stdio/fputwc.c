@@ -35,22 +35,14 @@
 wint_t
 __STDIO_UNLOCKED(putwc)(wchar_t c, FILE *stream)
 {
-    union {
-        wchar_t wc;
-        char    c[sizeof(wchar_t)];
-    } u;
-    unsigned i;
-
     __flockfile(stream);
     stream->flags |= __SWIDE;
 
     if ((stream->flags & __SWR) == 0)
         __funlock_return(stream, WEOF);
 
-    u.wc = c;
-    for (i = 0; i < sizeof(wchar_t); i++)
-        if (stream->put(u.c[i], stream) < 0)
-            __funlock_return(stream, WEOF);
+    if (__file_put_span((const char *)&c, sizeof(wchar_t), stream) < 0)
+        __funlock_return(stream, WEOF);
 
     __funlock_return(stream, (wint_t)c);
 }
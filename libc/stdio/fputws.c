@@ -34,16 +34,16 @@
 int
 fputws(const wchar_t *str, FILE *stream)
 {
-    wchar_t c;
-    int     rv = 0;
+    int rv = 0;
 
     __flockfile(stream);
+    stream->flags |= __SWIDE;
     if ((stream->flags & __SWR) == 0)
         __funlock_return(stream, EOF);
 
-    while ((c = *str++) != L'\0')
-        if (putwc_unlocked(c, stream) == WEOF)
-            rv = EOF;
+    /* Wide streams hold wchar_t as they are, so the string goes out whole */
+    if (__file_put_span((const char *)str, wcslen(str) * sizeof(wchar_t), stream) < 0)
+        rv = EOF;
 
     __funlock_return(stream, rv);
 }
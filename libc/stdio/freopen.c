@@ -71,6 +71,9 @@ freopen(const char *pathname, const char *mode, FILE *stream)
     stream->flags = (stream->flags & ~(__SRD | __SWR | __SERR | __SEOF)) | stdio_flags;
     pf->pos = 0;
     pf->ptr = (void *)(intptr_t)(fd);
+    pf->bflags &= ~__BAPP;
+    if (open_flags & O_APPEND)
+        pf->bflags |= __BAPP;
 
     /* Switch to POSIX backend */
     pf->read_int = read;
@@ -80,6 +83,13 @@ freopen(const char *pathname, const char *mode, FILE *stream)
 
     /* Reset buffer mode and size */
     buf_size = bufio_get_buf_size(fd);
+#ifdef __STDIO_FILE_POOL
+    /* Pool FILEs keep their static buffer */
+    if ((pf->bflags & (__BFPOOL | __BALL)) == __BFPOOL) {
+        buf_size = pf->size;
+        pf->bflags &= ~__BLBF;
+    }
+#endif
     if (buf_size != pf->size || (pf->bflags & __BLBF))
         (pf->xfile.setvbuf ? pf->xfile.setvbuf : __bufio_setvbuf)(stream, NULL, _IOFBF, buf_size);
 
@@ -31,70 +31,51 @@
 
 #include "stdio_private.h"
 
-#ifdef __FAST_BUFIO
 #include "../stdlib/mul_overflow.h"
-#endif
 
 size_t
-fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
+__STDIO_UNLOCKED(fwrite)(const void *ptr, size_t size, size_t nmemb, FILE *stream)
 {
     size_t         i, j;
+    size_t         bytes;
     const uint8_t *cp = (const uint8_t *)ptr;
 
-    __flockfile(stream);
     if ((stream->flags & __SWR) == 0 || size == 0)
-        __funlock_return(stream, 0);
-
-#ifdef __FAST_BUFIO
-    size_t               bytes;
-    struct __file_bufio *bf = (struct __file_bufio *)stream;
-
-    if ((stream->flags & __SBUF) != 0 && (bf->bflags & __BLBF) == 0
-        && !mul_overflow(size, nmemb, &bytes) && bytes > 0) {
-        __bufio_lock(stream);
-        __bufio_setdir_locked(stream, __SWR);
+        return 0;
 
-        if (bytes < (unsigned)bf->size) {
-            /* Small writes go through the buffer. */
-            while (bytes) {
-                int this_time = bf->size - bf->len;
-                if (this_time == 0) {
-                    int ret = __bufio_flush_locked(stream);
-                    if (ret) {
-                        stream->flags |= ret;
-                        break;
-                    }
-                }
-                if ((unsigned)this_time > bytes)
-                    this_time = bytes;
-                memcpy(bf->buf + bf->len, cp, this_time);
-                bf->len += this_time;
-                cp += this_time;
-                bytes -= this_time;
-            }
-        } else {
-            /* Large writes go direct. */
-            if (__bufio_flush_locked(stream) >= 0) {
-                while (bytes) {
-                    ssize_t len = bufio_write(bf, cp, bytes);
-                    if (len <= 0) {
-                        stream->flags |= _FDEV_ERR;
-                        break;
-                    }
-                    bytes -= len;
-                    cp += len;
-                    bf->pos += len;
-                }
-            }
-        }
-        __bufio_unlock(stream);
-        __funlock_return(stream, (cp - (uint8_t *)ptr) / size);
+    if (stream->put_span && !mul_overflow(size, nmemb, &bytes)) {
+        size_t len = stream->put_span(ptr, bytes, stream);
+        if (len < bytes)
+            stream->flags |= __SERR;
+        return len / size;
     }
-#endif
+
     for (i = 0; i < nmemb; i++)
         for (j = 0; j < size; j++)
             if (stream->put(*cp++, stream) < 0)
-                __funlock_return(stream, i);
+                return i;
+
+    return i;
+}
 
-    __funlock_return(stream, i);
+#ifdef __STDIO_LOCKING
+size_t
+fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
+{
+    size_t ret;
+    __flockfile(stream);
+    ret = fwrite_unlocked(ptr, size, nmemb, stream);
+    __funlockfile(stream);
+    return ret;
 }
+#else
+#ifdef __strong_reference
+__strong_reference(fwrite, fwrite_unlocked);
+#else
+size_t
+fwrite_unlocked(const void *ptr, size_t size, size_t nmemb, FILE *stream)
+{
+    return fwrite(ptr, size, nmemb, stream);
+}
+#endif
+#endif
@@ -38,6 +38,6 @@
 char *
 gcvt(double invalue, int ndigit, char *buf)
 {
-    __d_sprintf(buf, "%.*g", ndigit, invalue);
+    __dtoa_str(buf, SIZE_MAX, invalue, ndigit, 'g');
     return buf;
 }
@@ -38,6 +38,6 @@
 char *
 gcvtf(float invalue, int ndigit, char *buf)
 {
-    __f_sprintf(buf, "%.*g", ndigit, __printf_float(invalue));
+    __ftoa_str(buf, SIZE_MAX, invalue, ndigit, 'g');
     return buf;
 }
@@ -38,6 +38,10 @@
 char *
 gcvtl(long double invalue, int ndigit, char *buf)
 {
+#if __SIZEOF_LONG_DOUBLE__ == __SIZEOF_DOUBLE__
+    return gcvt((double)invalue, ndigit, buf);
+#else
     __d_sprintf(buf, "%.*Lg", ndigit, invalue);
     return buf;
+#endif
 }
@@ -35,40 +35,8 @@
 
 #include "stdio_private.h"
 
-#define INCR 16
-
 _ssize_t
 getdelim(char ** restrict lineptr, size_t * restrict nptr, int delim, FILE * restrict stream)
 {
-    char    *line = *lineptr;
-    size_t   n = *nptr;
-    _ssize_t count = 0;
-
-    __flockfile(stream);
-    for (;;) {
-        int c = getc_unlocked(stream);
-        if (c == EOF)
-            break;
-
-        if (count >= (_ssize_t)n) {
-            size_t newsize = n + INCR;
-            char  *newline = realloc(line, newsize);
-            if (newline == NULL) {
-                count = -1;
-                break;
-            }
-            line = newline;
-            n = newsize;
-        }
-
-        line[count++] = c;
-        if (c == delim) {
-            line[count] = '\0';
-            break;
-        }
-    }
-
-    *lineptr = line;
-    *nptr = n;
-    __funlock_return(stream, count);
+    return getdelim_max(lineptr, nptr, delim, SIZE_MAX / 2, stream);
 }
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+
+#define INCR 16
+
+/* Make room for need bytes plus a NUL, at least doubling the buffer */
+static bool
+getdelim_grow(char **line, size_t *n, size_t need)
+{
+    size_t newsize;
+    char  *newline;
+
+    if (need < *n)
+        return true;
+    newsize = *n * 2;
+    if (newsize < need + 1)
+        newsize = need + 1;
+    if (newsize < INCR)
+        newsize = INCR;
+    newline = realloc(*line, newsize);
+    if (newline == NULL)
+        return false;
+    *line = newline;
+    *n = newsize;
+    return true;
+}
+
+/*
+ * getdelim which stores at most max bytes before the NUL. A line
+ * longer than that is returned in pieces; only the last one ends with
+ * delim.
+ */
+_ssize_t
+getdelim_max(char ** restrict lineptr, size_t * restrict nptr, int delim, size_t max,
+             FILE * restrict stream)
+{
+    char  *line = *lineptr;
+    size_t n = line ? *nptr : 0;
+    size_t count = 0;
+    bool   done = false;
+
+    if (max == 0 || max > SIZE_MAX / 2) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    __flockfile(stream);
+    while (!done && count < max) {
+#ifdef __FAST_BUFIO
+        if ((stream->flags & __SBUF) != 0 && !stream->unget) {
+            struct __file_bufio *bf = (struct __file_bufio *)stream;
+            size_t               avail;
+
+            /* Copy straight out of the buffer up to the delimiter */
+            __bufio_lock(stream);
+            __bufio_setdir_locked(stream, __SRD);
+            avail = bf->len - bf->off;
+            if (avail) {
+                const char *span = bf->buf + bf->off;
+                const char *end;
+
+                if (avail > max - count)
+                    avail = max - count;
+                end = memchr(span, (unsigned char)delim, avail);
+                if (end) {
+                    avail = end - span + 1;
+                    done = true;
+                }
+                if (!getdelim_grow(&line, &n, count + avail)) {
+                    __bufio_unlock(stream);
+                    count = (size_t)-1;
+                    break;
+                }
+                memcpy(line + count, span, avail);
+                bf->off += avail;
+                count += avail;
+                __bufio_unlock(stream);
+                continue;
+            }
+            __bufio_unlock(stream);
+        }
+#endif
+        /* Refill the buffer, or read from an unbuffered stream */
+        int c = getc_unlocked(stream);
+        if (c == EOF)
+            break;
+        if (!getdelim_grow(&line, &n, count + 1)) {
+            count = (size_t)-1;
+            break;
+        }
+        line[count++] = c;
+        if (c == (unsigned char)delim)
+            done = true;
+    }
+
+    if (count == 0)
+        count = (size_t)-1;
+    else if (count != (size_t)-1)
+        line[count] = '\0';
+    *lineptr = line;
+    *nptr = n;
+    __funlock_return(stream, (_ssize_t)count);
+}
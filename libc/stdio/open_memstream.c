@@ -0,0 +1,194 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+#include <malloc.h>
+
+#define MEMSTREAM_MIN 64
+
+/*
+ * Grow the buffer to hold need bytes plus a terminating NUL unit, at
+ * least doubling it. A buffer at the end of an arena is extended in
+ * place.
+ */
+static bool
+__memstream_grow(struct __file_memstream *ms, size_t need)
+{
+    size_t newcap;
+    char  *newbuf;
+
+    if (need > SIZE_MAX / 2 - ms->unit) {
+        errno = ENOMEM;
+        return false;
+    }
+    need += ms->unit;
+    if (need <= ms->cap)
+        return true;
+    newcap = ms->cap * 2;
+    if (newcap < need)
+        newcap = need;
+    if (newcap < MEMSTREAM_MIN)
+        newcap = MEMSTREAM_MIN;
+
+    if (ms->arena) {
+        size_t avail;
+        char  *tail = __malloc_arena_tail(ms->arena, &avail);
+
+        if (ms->buf && ms->buf + ms->cap == tail && newcap - ms->cap <= avail
+            && malloc_arena_alloc(ms->arena, newcap - ms->cap, 1) == tail) {
+            newbuf = ms->buf;
+        } else {
+            newbuf = malloc_arena_alloc(ms->arena, newcap, sizeof(wchar_t));
+            if (newbuf && ms->buf)
+                memcpy(newbuf, ms->buf, ms->len);
+        }
+    } else {
+        newbuf = realloc(ms->buf, newcap);
+    }
+    if (!newbuf) {
+        errno = ENOMEM;
+        return false;
+    }
+    ms->buf = newbuf;
+    ms->cap = newcap;
+    return true;
+}
+
+/* Publish the buffer and size, NUL terminated */
+static void
+__memstream_sync(struct __file_memstream *ms)
+{
+    memset(ms->buf + ms->len, 0, ms->unit);
+    /* bufp points at a char * or a wchar_t * */
+    memcpy(ms->bufp, &ms->buf, sizeof(ms->buf));
+    *ms->sizep = (ms->pos < ms->len ? ms->pos : ms->len) / ms->unit;
+}
+
+static int
+__memstream_put(char c, FILE *f)
+{
+    struct __file_memstream *ms = (struct __file_memstream *)f;
+
+    if (ms->pos >= ms->len) {
+        if (!__memstream_grow(ms, ms->pos + 1))
+            return _FDEV_ERR;
+        /* Writing past the end after a seek leaves zeros in the gap */
+        memset(ms->buf + ms->len, 0, ms->pos - ms->len);
+        ms->len = ms->pos + 1;
+    }
+    ms->buf[ms->pos++] = c;
+    return (unsigned char)c;
+}
+
+static int
+__memstream_flush(FILE *f)
+{
+    __memstream_sync((struct __file_memstream *)f);
+    return 0;
+}
+
+static off_t
+__memstream_seek(FILE *f, off_t pos, int whence)
+{
+    struct __file_memstream *ms = (struct __file_memstream *)f;
+
+    pos *= ms->unit;
+    switch (whence) {
+    case SEEK_SET:
+        break;
+    case SEEK_CUR:
+        pos += ms->pos;
+        break;
+    case SEEK_END:
+        pos += ms->len;
+        break;
+    default:
+        errno = EINVAL;
+        return EOF;
+    }
+    if (pos < 0) {
+        errno = EINVAL;
+        return EOF;
+    }
+    ms->pos = pos;
+    return pos / ms->unit;
+}
+
+static int
+__memstream_close(FILE *f)
+{
+    __memstream_sync((struct __file_memstream *)f);
+    free(f);
+    return 0;
+}
+
+FILE *
+__open_memstream(struct malloc_arena *arena, void *bufp, size_t *sizep, uint8_t unit)
+{
+    struct __file_memstream *ms;
+
+    if (!bufp || !sizep) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    ms = calloc(1, sizeof(struct __file_memstream));
+    if (!ms)
+        return NULL;
+
+    *ms = (struct __file_memstream) {
+        .xfile = FDEV_SETUP_EXT(__memstream_put, NULL, __memstream_flush, __memstream_close,
+                                __memstream_seek, NULL, __SWR),
+        .bufp = bufp,
+        .sizep = sizep,
+        .unit = unit,
+        .arena = arena,
+    };
+    if (unit == sizeof(wchar_t))
+        ms->xfile.cfile.file.flags |= __SWIDE;
+
+    if (!__memstream_grow(ms, 0)) {
+        free(ms);
+        return NULL;
+    }
+    __memstream_sync(ms);
+    return (FILE *)ms;
+}
+
+FILE *
+open_memstream(char **bufp, size_t *sizep)
+{
+    return __open_memstream(NULL, bufp, sizep, 1);
+}
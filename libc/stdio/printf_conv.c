@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Conversions for vfprintf_desc. Each one is a separate function so
+ * that only those used by some descriptor end up in the link.
+ * printf_conv_ll.c reuses this file for the long long conversions.
+ */
+
+#include "stdio_private.h"
+
+#define PRINTF_VARIANT __IO_VARIANT_INTEGER
+
+#ifdef PRINTF_CONV_LLONG
+typedef unsigned long long ultoa_unsigned_t;
+#define SIZEOF_ULTOA __SIZEOF_LONG_LONG__
+#else
+typedef unsigned long ultoa_unsigned_t;
+#define SIZEOF_ULTOA __SIZEOF_LONG__
+#endif
+
+#include "ultoa_invert.c"
+
+static int
+printf_conv_unsigned(FILE *stream, ultoa_unsigned_t x, int base, bool neg)
+{
+    char buf[SIZEOF_ULTOA * 3];
+    int  len = __ultoa_invert(x, buf, base) - buf;
+    int  ret = len;
+
+    if (neg) {
+        if (stream->put('-', stream) < 0)
+            return -1;
+        ret++;
+    }
+    while (len)
+        if (stream->put(buf[--len], stream) < 0)
+            return -1;
+    return ret;
+}
+
+#define PRINTF_CONV_SIGNED(name, type)                                          \
+    int name(FILE *stream, va_list *ap)                                         \
+    {                                                                           \
+        type x = va_arg(*ap, type);                                             \
+                                                                                \
+        /* Use unsigned in case x is the largest negative value */              \
+        if (x < 0)                                                              \
+            return printf_conv_unsigned(stream, -(ultoa_unsigned_t)x, 10, true); \
+        return printf_conv_unsigned(stream, (ultoa_unsigned_t)x, 10, false);    \
+    }
+
+#define PRINTF_CONV_UNSIGNED(name, type, base)                                  \
+    int name(FILE *stream, va_list *ap)                                         \
+    {                                                                           \
+        return printf_conv_unsigned(stream, va_arg(*ap, type), base, false);    \
+    }
+
+#ifdef PRINTF_CONV_LLONG
+
+PRINTF_CONV_SIGNED(__printf_conv_lld, long long)
+PRINTF_CONV_UNSIGNED(__printf_conv_llu, unsigned long long, 10)
+PRINTF_CONV_UNSIGNED(__printf_conv_llx, unsigned long long, 16)
+
+#else
+
+PRINTF_CONV_SIGNED(__printf_conv_d, int)
+PRINTF_CONV_UNSIGNED(__printf_conv_u, unsigned, 10)
+PRINTF_CONV_UNSIGNED(__printf_conv_x, unsigned, 16)
+PRINTF_CONV_SIGNED(__printf_conv_ld, long)
+PRINTF_CONV_UNSIGNED(__printf_conv_lu, unsigned long, 10)
+PRINTF_CONV_UNSIGNED(__printf_conv_lx, unsigned long, 16)
+
+int
+__printf_conv_s(FILE *stream, va_list *ap)
+{
+    const char *s = va_arg(*ap, const char *);
+    size_t      len;
+
+    if (!s)
+        s = "(null)";
+    len = strlen(s);
+    if (__file_put_span(s, len, stream) < 0)
+        return -1;
+    return len;
+}
+
+int
+__printf_conv_c(FILE *stream, va_list *ap)
+{
+    if (stream->put((char)va_arg(*ap, int), stream) < 0)
+        return -1;
+    return 1;
+}
+
+#endif
@@ -34,8 +34,6 @@
 int
 puts(const char *str)
 {
-    int   (*put)(char, struct __file *);
-    char  c;
     int   ret = EOF;
     FILE *out = stdout;
 
@@ -44,12 +42,7 @@ puts(const char *str)
     if ((out->flags & __SWR) == 0)
         goto exit;
 
-    put = out->put;
-    while ((c = *str++) != '\0')
-        if (put(c, out) < 0)
-            goto flag_exit;
-
-    if (put('\n', out) < 0)
+    if (__file_put_span(str, strlen(str), out) < 0 || out->put('\n', out) < 0)
         goto flag_exit;
 
     ret = 0;
@@ -32,6 +32,17 @@
 #define HAS_UINT128
 #endif
 
+// Targets without a 64x64->128-bit multiply use kernels built only from
+// 32x32->64-bit multiplies and 32-bit carries. __IO_RYU_32BIT (set by
+// -Dio-ryu-32bit) overrides the automatic choice either way.
+#if defined(__IO_RYU_32BIT)
+#if __IO_RYU_32BIT
+#define RYU_32_BIT_KERNELS
+#endif
+#elif defined(RYU_32_BIT_PLATFORM) && !defined(HAS_UINT128)
+#define RYU_32_BIT_KERNELS
+#endif
+
 #if __SIZEOF_DOUBLE__ == 8
 #define RYU64 double
 #elif __SIZEOF_LONG_DOUBLE__ == 8
@@ -64,14 +64,66 @@ shiftright128(const uint64_t lo, const uint64_t hi, const uint32_t dist)
 #else // defined(HAS_64_BIT_INTRINSICS)
 
 uint64_t __umul128(const uint64_t a, const uint64_t b, uint64_t * const productHi);
-#define umul128(a, b, hi)           __umul128(a, b, hi)
 
 uint64_t __shiftright128(const uint64_t lo, const uint64_t hi, const uint32_t dist);
+
+// Plain C versions built from four 32x32->64-bit multiplies. With
+// RYU_32_BIT_KERNELS they are inlined so the compiler can share work
+// between the products in mulShiftAll64 and drop the unused halves in
+// umulh; otherwise the out-of-line copies keep the code small.
+static inline uint64_t
+umul128_32(const uint64_t a, const uint64_t b, uint64_t * const productHi)
+{
+    // The casts here help MSVC to avoid calls to the __allmul library function.
+    const uint32_t aLo = (uint32_t)a;
+    const uint32_t aHi = (uint32_t)(a >> 32);
+    const uint32_t bLo = (uint32_t)b;
+    const uint32_t bHi = (uint32_t)(b >> 32);
+
+    const uint64_t b00 = (uint64_t)aLo * bLo;
+    const uint64_t b01 = (uint64_t)aLo * bHi;
+    const uint64_t b10 = (uint64_t)aHi * bLo;
+    const uint64_t b11 = (uint64_t)aHi * bHi;
+
+    const uint32_t b00Lo = (uint32_t)b00;
+    const uint32_t b00Hi = (uint32_t)(b00 >> 32);
+
+    const uint64_t mid1 = b10 + b00Hi;
+    const uint32_t mid1Lo = (uint32_t)(mid1);
+    const uint32_t mid1Hi = (uint32_t)(mid1 >> 32);
+
+    const uint64_t mid2 = b01 + mid1Lo;
+    const uint32_t mid2Lo = (uint32_t)(mid2);
+    const uint32_t mid2Hi = (uint32_t)(mid2 >> 32);
+
+    const uint64_t pHi = b11 + mid1Hi + mid2Hi;
+    const uint64_t pLo = ((uint64_t)mid2Lo << 32) | b00Lo;
+
+    *productHi = pHi;
+    return pLo;
+}
+
+// Returns the lower 64 bits of (hi*2^64 + lo) >> dist, with 0 < dist < 64.
+static inline uint64_t
+shiftright128_32(const uint64_t lo, const uint64_t hi, const uint32_t dist)
+{
+    // We don't need to handle the case dist >= 64 here (see above).
+    assert(dist < 64);
+    assert(dist > 0);
+    return (hi << (64 - dist)) | (lo >> dist);
+}
+
+#if defined(RYU_32_BIT_KERNELS)
+#define umul128(a, b, hi)           umul128_32(a, b, hi)
+#define shiftright128(lo, hi, dist) shiftright128_32(lo, hi, dist)
+#else
+#define umul128(a, b, hi)           __umul128(a, b, hi)
 #define shiftright128(lo, hi, dist) __shiftright128(lo, hi, dist)
+#endif
 
 #endif // defined(HAS_64_BIT_INTRINSICS)
 
-#if defined(RYU_32_BIT_PLATFORM)
+#if defined(RYU_32_BIT_PLATFORM) || defined(RYU_32_BIT_KERNELS)
 
 // Returns the high 64 bits of the 128-bit product of a and b.
 static inline uint64_t
@@ -85,6 +137,68 @@ umulh(const uint64_t a, const uint64_t b)
     return hi;
 }
 
+#endif
+
+#if defined(RYU_32_BIT_KERNELS)
+
+// Divides x by a small constant d using only 32-bit divisions by d,
+// which compilers turn into a single 32x32->64-bit multiply each, where
+// 2^32 = q32 * d + r32. With hi = qh * d + rh and lo = ql * d + rl,
+// x / d = qh * 2^32 + rh * q32 + ql + (rh * r32 + rl) / d. Neither
+// rh * q32 nor rh * r32 + rl can overflow 32 bits for d < 2^16.
+static inline uint64_t
+divSmall(const uint64_t x, const uint32_t d, const uint32_t q32, const uint32_t r32)
+{
+    const uint32_t hi = (uint32_t)(x >> 32);
+    const uint32_t lo = (uint32_t)x;
+    if (hi == 0) {
+        return lo / d;
+    }
+    const uint32_t qh = hi / d;
+    const uint32_t rh = hi - qh * d;
+    const uint32_t ql = lo / d;
+    const uint32_t rl = lo - ql * d;
+    return ((uint64_t)qh << 32) + (uint64_t)(rh * q32) + ql + (rh * r32 + rl) / d;
+}
+
+static inline uint64_t
+div5(const uint64_t x)
+{
+    return divSmall(x, 5, 858993459u, 1);
+}
+
+static inline uint64_t
+div10(const uint64_t x)
+{
+    return divSmall(x, 10, 429496729u, 6);
+}
+
+static inline uint64_t
+div100(const uint64_t x)
+{
+    return divSmall(x, 100, 42949672u, 96);
+}
+
+static inline uint64_t
+div1e8(const uint64_t x)
+{
+    return umulh(x, 0xABCC77118461CEFDu) >> 26;
+}
+
+static inline uint64_t
+div1e9(const uint64_t x)
+{
+    return umulh(x >> 9, 0x44B82FA09B5A53u) >> 11;
+}
+
+static inline uint32_t
+mod1e9(const uint64_t x)
+{
+    return ((uint32_t)x) - 1000000000 * ((uint32_t)div1e9(x));
+}
+
+#elif defined(RYU_32_BIT_PLATFORM)
+
 // On 32-bit platforms, compilers typically generate calls to library
 // functions for 64-bit divisions, even if the divisor is a constant.
 //
@@ -0,0 +1,163 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+#include <stdio_ext.h>
+
+/*
+ * Weak so that using these functions doesn't pull fmemopen into the
+ * link; without it there can't be any fmemopen streams
+ */
+extern int __fmem_get(FILE *f) __weak;
+
+static inline bool
+__is_fmem(FILE *f)
+{
+    return &__fmem_get != NULL && f->get == __fmem_get;
+}
+
+size_t
+__fpending(FILE *f)
+{
+    size_t pending = 0;
+
+    if (f->flags & __SBUF) {
+        struct __file_bufio *bf = (struct __file_bufio *)f;
+
+        __bufio_lock(f);
+        if (bf->dir == __SWR)
+            pending = bf->off > bf->len ? bf->off : bf->len;
+        __bufio_unlock(f);
+    }
+    return pending;
+}
+
+/* The buffered input, ignoring any pending ungetc */
+static const char *
+__freadwindow(FILE *f, size_t *sizep)
+{
+    const char *ptr = NULL;
+
+    if (f->flags & __SBUF) {
+        struct __file_bufio *bf = (struct __file_bufio *)f;
+
+        __bufio_lock(f);
+        if (bf->dir == __SRD && bf->off < bf->len) {
+            *sizep = bf->len - bf->off;
+            ptr = bf->buf + bf->off;
+        }
+        __bufio_unlock(f);
+    } else if (__is_fmem(f)) {
+        ptr = __fmem_readptr(f, sizep);
+    }
+    return ptr;
+}
+
+const char *
+__freadptr(FILE *f, size_t *sizep)
+{
+    if (f->unget != 0)
+        return NULL;
+    return __freadwindow(f, sizep);
+}
+
+size_t
+__freadahead(FILE *f)
+{
+    size_t size;
+
+    if (!__freadwindow(f, &size))
+        size = 0;
+    return size + (f->unget != 0);
+}
+
+void
+__freadptrinc(FILE *f, size_t increment)
+{
+    if (f->flags & __SBUF) {
+        struct __file_bufio *bf = (struct __file_bufio *)f;
+
+        __bufio_lock(f);
+        bf->off += increment;
+        __bufio_unlock(f);
+    } else if (__is_fmem(f)) {
+        __fmem_readptrinc(f, increment);
+    }
+}
+
+char *
+__fwriteptr(FILE *f, size_t *sizep)
+{
+    char *ptr = NULL;
+
+    if ((f->flags & __SWR) == 0)
+        return NULL;
+
+    if (f->flags & __SBUF) {
+        struct __file_bufio *bf = (struct __file_bufio *)f;
+
+        __bufio_lock(f);
+        if (__bufio_setdir_locked(f, __SWR) == 0
+            && (bf->len < bf->size || __bufio_flush_locked(f) == 0)) {
+            *sizep = bf->size - bf->len;
+            ptr = bf->buf + bf->len;
+        }
+        __bufio_unlock(f);
+    } else if (__is_fmem(f)) {
+        ptr = __fmem_writeptr(f, sizep);
+    }
+    return ptr;
+}
+
+void
+__fwriteptrinc(FILE *f, size_t increment)
+{
+    if (f->flags & __SBUF) {
+        struct __file_bufio *bf = (struct __file_bufio *)f;
+        char                *added;
+
+        __bufio_lock(f);
+        added = bf->buf + bf->len;
+        bf->len += increment;
+
+        /* flush if full, or if a newline was added when linebuffered */
+        if (bf->len >= bf->size || ((bf->bflags & __BLBF) && memchr(added, '\n', increment)))
+            if (__bufio_flush_locked(f) < 0)
+                f->flags |= __SERR;
+        __bufio_unlock(f);
+    } else if (__is_fmem(f)) {
+        __fmem_writeptrinc(f, increment);
+    }
+}
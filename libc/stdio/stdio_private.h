@@ -48,6 +48,7 @@
 #include <limits.h>
 #include <stdio-bufio.h>
 #include <sys/lock.h>
+#include <sys/uio.h>
 #ifdef __FSTAT_BUFSIZ
 #include <sys/stat.h>
 #endif
@@ -57,6 +58,7 @@ struct __file_str {
     char         *pos;   /* current buffer position */
     char         *end;   /* end of buffer */
     size_t        size;  /* size of allocated storage */
+    size_t        hint;  /* expected output size, for the first allocation */
     bool          alloc; /* current storage was allocated */
 };
 
@@ -68,6 +70,12 @@ int               __file_str_put(char c, FILE *stream);
 
 int               __file_str_put_alloc(char c, FILE *stream);
 
+size_t            __file_str_put_span(const char *s, size_t len, FILE *stream);
+
+size_t            __file_str_put_span_alloc(const char *s, size_t len, FILE *stream);
+
+char             *__malloc_arena_tail(struct malloc_arena *arena, size_t *avail);
+
 extern const char __match_inf[];
 extern const char __match_inity[];
 extern const char __match_nan[];
@@ -102,26 +110,40 @@ bool              __matchcaseprefix(const char *input, const char *pattern);
 
 #define FDEV_SETUP_STRING_WRITE(_s, _end)                                    \
     {                                                                        \
-        .file = { .flags = __SWR, .put = __file_str_put, __LOCK_INIT_NONE }, \
+        .file = { .flags = __SWR,                                            \
+                  .put = __file_str_put,                                     \
+                  .put_span = __file_str_put_span,                           \
+                  __LOCK_INIT_NONE },                                        \
         .pos = (_s),                                                         \
         .end = (_end),                                                       \
     }
 
-#define FDEV_SETUP_STRING_ALLOC()                                                  \
+#define FDEV_SETUP_STRING_ALLOC() FDEV_SETUP_STRING_ALLOC_HINT(0)
+
+/* An allocating string stream whose first buffer holds _hint bytes */
+#define FDEV_SETUP_STRING_ALLOC_HINT(_hint)                                        \
     {                                                                              \
-        .file = { .flags = __SWR, .put = __file_str_put_alloc, __LOCK_INIT_NONE }, \
+        .file = { .flags = __SWR,                                                  \
+                  .put = __file_str_put_alloc,                                     \
+                  .put_span = __file_str_put_span_alloc,                           \
+                  __LOCK_INIT_NONE },                                              \
         .pos = NULL,                                                               \
         .end = NULL,                                                               \
         .size = 0,                                                                 \
+        .hint = (_hint),                                                           \
         .alloc = false,                                                            \
     }
 
 #define FDEV_SETUP_STRING_ALLOC_BUF(_buf, _size)                                   \
     {                                                                              \
-        .file = { .flags = __SWR, .put = __file_str_put_alloc, __LOCK_INIT_NONE }, \
+        .file = { .flags = __SWR,                                                  \
+                  .put = __file_str_put_alloc,                                     \
+                  .put_span = __file_str_put_span_alloc,                           \
+                  __LOCK_INIT_NONE },                                              \
         .pos = _buf,                                                               \
         .end = (char *)(_buf) + (_size),                                           \
         .size = _size,                                                             \
+        .hint = 0,                                                                 \
         .alloc = false,                                                            \
     }
 
@@ -168,6 +190,26 @@ bufio_write(struct __file_bufio *bf, const void *buf, size_t count)
     return (bf->write_ptr)((void *)bf->ptr, buf, count);
 }
 
+static inline ssize_t
+bufio_writev(struct __file_bufio *bf, const struct iovec *iov, int iovcnt)
+{
+#ifndef BUFIO_ABI_MATCHES
+    if (!(bf->bflags & __BFPTR))
+        return (bf->writev_int)(_FDEV_BUFIO_FD(bf), iov, iovcnt);
+#endif
+    return (bf->writev_ptr)((void *)bf->ptr, iov, iovcnt);
+}
+
+static inline ssize_t
+bufio_readv(struct __file_bufio *bf, const struct iovec *iov, int iovcnt)
+{
+#ifndef BUFIO_ABI_MATCHES
+    if (!(bf->bflags & __BFPTR))
+        return (bf->readv_int)(_FDEV_BUFIO_FD(bf), iov, iovcnt);
+#endif
+    return (bf->readv_ptr)((void *)bf->ptr, iov, iovcnt);
+}
+
 static inline __off_t
 bufio_lseek(struct __file_bufio *bf, __off_t offset, int whence)
 {
@@ -201,8 +243,16 @@ bufio_close(struct __file_bufio *bf)
     return ret;
 }
 
-#define FDEV_SETUP_POSIX(fd, buf, size, rwflags, bflags)                        \
-    FDEV_SETUP_BUFIO(fd, buf, size, read, write, lseek, close, rwflags, bflags)
+/*
+ * POSIX streams use readv and writev for large transfers when the
+ * system provides them; the references are weak so systems without
+ * them need not supply stubs
+ */
+extern ssize_t readv(int, const struct iovec *, int) __weak;
+extern ssize_t writev(int, const struct iovec *, int) __weak;
+
+#define FDEV_SETUP_POSIX(fd, buf, size, rwflags, bflags) \
+    FDEV_SETUP_BUFIO_IOV(fd, buf, size, read, write, readv, writev, lseek, close, rwflags, bflags)
 
 #if defined(__FSTAT_BUFSIZ) && defined(_STAT_HAS_ST_BLKSIZE)
 static inline size_t
@@ -210,6 +260,9 @@ bufio_get_buf_size(int fd)
 {
     struct stat stat;
     if (fstat(fd, &stat) == 0 && stat.st_blksize > 0) {
+        /* Terminals move a line at a time, a big buffer only costs RAM */
+        if (S_ISCHR(stat.st_mode) && stat.st_blksize > BUFSIZ)
+            return BUFSIZ;
         return stat.st_blksize;
     }
     return BUFSIZ;
@@ -220,6 +273,49 @@ bufio_get_buf_size(int fd)
 
 int __stdio_flags(const char *mode, int *optr);
 
+#ifdef __STDIO_FILE_POOL
+/* Take a free FILE slot of the fopen pool and its buffer of
+   __STDIO_FILE_POOL_BUFSIZ bytes, NULL when all are in use */
+struct __file_bufio *__bufio_pool_get(char **buf);
+void                 __bufio_pool_put(struct __file_bufio *bf);
+#endif
+
+/* fmemopen streams, identified by their get function */
+#define __MALL 0x01
+#define __MAPP 0x02
+
+struct __file_mem {
+    struct __file_ext xfile;
+    char             *buf;
+    size_t            size;    /* Current size. */
+    size_t            bufsize; /* Upper limit on size. */
+    size_t            pos;
+    uint8_t           mflags;
+};
+
+/* open_memstream, open_wmemstream and malloc_arena_open_memstream */
+struct __file_memstream {
+    struct __file_ext    xfile;
+    void                *bufp; /* caller's char ** or wchar_t ** */
+    size_t              *sizep;
+    char                *buf;
+    size_t               cap; /* allocated bytes */
+    size_t               len; /* bytes written */
+    size_t               pos;
+    struct malloc_arena *arena;
+    uint8_t              unit; /* bytes per character */
+};
+
+FILE       *__open_memstream(struct malloc_arena *arena, void *bufp, size_t *sizep, uint8_t unit);
+
+int         __fmem_get(FILE *f);
+off_t       __fmem_seek(FILE *f, off_t pos, int whence);
+FILE       *__fopen_mmap(int fd);
+const char *__fmem_readptr(FILE *f, size_t *sizep);
+void        __fmem_readptrinc(FILE *f, size_t increment);
+char       *__fmem_writeptr(FILE *f, size_t *sizep);
+void        __fmem_writeptrinc(FILE *f, size_t increment);
+
 #ifdef __STDIO_LOCKING
 void __flockfile_init(FILE *f);
 #define __LOCK_NONE      ((_LOCK_RECURSIVE_T)(uintptr_t)1)
@@ -285,6 +381,8 @@ int __l_vfprintf(FILE *__stream, const char *__fmt, va_list __ap)
     __FORMAT_ATTRIBUTE__(printf, 2, 0);
 int __m_vfprintf(FILE *__stream, const char *__fmt, va_list __ap)
     __FORMAT_ATTRIBUTE__(printf, 2, 0);
+int __s_vfprintf(FILE *__stream, const char *__fmt, va_list __ap)
+    __FORMAT_ATTRIBUTE__(printf, 2, 0);
 
 int __d_sprintf(char *__s, const char *__fmt, ...) __FORMAT_ATTRIBUTE__(printf, 2, 0);
 int __f_sprintf(char *__s, const char *__fmt, ...) __FORMAT_ATTRIBUTE__(printf, 2, 0);
@@ -298,6 +396,49 @@ int __i_snprintf(char *__s, size_t __n, const char *__fmt, ...) __FORMAT_ATTRIBU
 int __l_snprintf(char *__s, size_t __n, const char *__fmt, ...) __FORMAT_ATTRIBUTE__(printf, 3, 0);
 int __m_snprintf(char *__s, size_t __n, const char *__fmt, ...) __FORMAT_ATTRIBUTE__(printf, 3, 0);
 
+/* printf's "%.<prec><conv>" for conv in eEfFgG, without a FILE */
+int __dtoa_str(char *__s, size_t __n, double __x, int __prec, char __conv);
+int __ftoa_str(char *__s, size_t __n, float __x, int __prec, char __conv);
+
+/*
+ * Split a strfromd format, "%[.precision]conversion", for __dtoa_str.
+ * Returns false for an 'a' conversion or anything else it does not take,
+ * which then goes through snprintf. No precision gives -1.
+ */
+static inline bool
+__strfrom_format(const char *format, int *prec, char *conv)
+{
+    int p = -1;
+
+    if (*format++ != '%')
+        return false;
+    if (*format == '.') {
+        format++;
+        p = 0;
+        while ('0' <= *format && *format <= '9') {
+            if (p > (INT_MAX - 9) / 10)
+                return false;
+            p = p * 10 + (*format++ - '0');
+        }
+    }
+    switch (*format) {
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+        break;
+    default:
+        return false;
+    }
+    if (format[1] != '\0')
+        return false;
+    *prec = p;
+    *conv = *format;
+    return true;
+}
+
 int __d_vfscanf(FILE *__stream, const char *__fmt, va_list __ap) __FORMAT_ATTRIBUTE__(scanf, 2, 0);
 int __f_vfscanf(FILE *__stream, const char *__fmt, va_list __ap) __FORMAT_ATTRIBUTE__(scanf, 2, 0);
 int __i_vfscanf(FILE *__stream, const char *__fmt, va_list __ap) __FORMAT_ATTRIBUTE__(scanf, 2, 0);
@@ -818,6 +959,37 @@ void       __picolibc_non_atomic_store_ungetc(__ungetc_t *p, __ungetc_t v);
 
 #endif /* __ATOMIC_UNGETC */
 
+/*
+ * Remove and return any pending ungetc character. There rarely is
+ * one, so look with a plain load before paying for the exchange,
+ * which is an out-of-line call on targets without compare-and-swap.
+ * ungetc only ever fills an empty slot, so seeing zero here is the
+ * same as running just before it.
+ */
+static inline __ungetc_t
+__take_ungetc(__ungetc_t *p)
+{
+    if (__non_atomic_load_ungetc(p) == 0)
+        return 0;
+    return __atomic_exchange_ungetc(p, 0);
+}
+
+/*
+ * Write len bytes with one put_span call when the stream has one, or
+ * a byte at a time through put otherwise. Returns 0 or EOF; the
+ * caller records any error.
+ */
+static inline int
+__file_put_span(const char *s, size_t len, FILE *stream)
+{
+    if (stream->put_span)
+        return stream->put_span(s, len, stream) == len ? 0 : EOF;
+    while (len--)
+        if (stream->put(*s++, stream) < 0)
+            return EOF;
+    return 0;
+}
+
 /*
  * This operates like _tolower on upper case letters, but also works
  * correctly on lower case letters.
@@ -38,5 +38,10 @@
 int
 strfromd(char * restrict str, size_t n, const char * restrict format, double fp)
 {
+    int  prec;
+    char conv;
+
+    if (__strfrom_format(format, &prec, &conv))
+        return __dtoa_str(str, n, fp, prec, conv);
     return __d_snprintf(str, n, format, fp);
 }
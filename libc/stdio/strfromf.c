@@ -38,5 +38,10 @@
 int
 strfromf(char * restrict str, size_t n, const char * restrict format, float fp)
 {
+    int  prec;
+    char conv;
+
+    if (__strfrom_format(format, &prec, &conv))
+        return __ftoa_str(str, n, fp, prec, conv);
     return __f_snprintf(str, n, format, __printf_float(fp));
 }
@@ -38,6 +38,9 @@
 int
 strfroml(char * restrict str, size_t n, const char * restrict format, long double fp)
 {
+#if __SIZEOF_LONG_DOUBLE__ == __SIZEOF_DOUBLE__
+    return strfromd(str, n, format, (double)fp);
+#else
     char        nformat[32];
     const char *f;
     bool        found_percent;
@@ -78,4 +81,5 @@ strfroml(char * restrict str, size_t n, const char * restrict format, long doubl
     }
     *nf = '\0';
     return __d_snprintf(str, n, nformat, fp);
+#endif
 }
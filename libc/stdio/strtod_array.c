@@ -0,0 +1,220 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**  The strtod_array() function converts up to \a nvals numbers from
+     the \a len bytes at \a buf, storing them in \a vals.
+
+     This is meant for bulk parsing of numeric text (CSV rows, sensor
+     logs, JSON number arrays) where calling strtod once per value
+     spends most of its time in setup rather than in the conversion.
+     The grammar is fixed and independent of the locale: each number
+     is an optional \c '+' or \c '-' followed by decimal digits
+     optionally containing a \c '.', optionally followed by an exponent
+     of \c 'e' or \c 'E', an optional sign and decimal digits.
+     Infinity, NaN and hexadecimal forms are not accepted.
+
+     Numbers may be preceded by any number of separators, which are
+     the white-space characters and \c ','. The buffer need not be
+     NUL terminated; conversion stops at the end of the buffer, after
+     \a nvals numbers, or at the first character which does not start
+     a number.
+
+     The return value is the number of values stored. If \a ends is
+     not \c NULL, ends[i] is set to the offset in \a buf just past the
+     i-th number, so ends[n-1] is the length consumed by the call.
+
+     Values are rounded exactly as strtod would round them. Out of
+     range values become zero or infinity but \c errno is not set.
+ */
+
+#ifdef STRTOF_ARRAY
+#define _NEED_IO_FLOAT
+#define FLOAT          float
+#define FLOAT_MAX_EXP  __FLT_MAX_EXP__
+#define FLOAT_MANT_DIG __FLT_MANT_DIG__
+#else
+#define _NEED_IO_DOUBLE
+#define FLOAT          double
+#define FLOAT_MAX_EXP  __DBL_MAX_EXP__
+#define FLOAT_MANT_DIG __DBL_MANT_DIG__
+#endif
+
+#include "stdio_private.h"
+#include "dtoa.h"
+
+#ifdef STRTOF_ARRAY
+#define strtod_array strtof_array
+#endif
+
+#ifdef _NEED_IO_FLOAT64
+#define UINTFLOAT     uint64_t
+#define UINTDIGITSMAX 16
+#else
+#define UINTFLOAT     uint32_t
+#define UINTDIGITSMAX 8
+#endif
+
+#define MAX_POSSIBLE_EXP (FLOAT_MAX_EXP + FLOAT_MANT_DIG * 4)
+
+#define IS_DIGIT(c) ((unsigned char)((c) - '0') < 10)
+
+static inline bool
+is_sep(char c)
+{
+    return c == ' ' || c == ',' || (c >= '\t' && c <= '\r');
+}
+
+/*
+ * Convert one number at s, returning the number of bytes used or 0
+ * if s does not start with a number. The scanning and rounding
+ * mirror conv_flt so that results match strtod bit for bit.
+ */
+static size_t
+scan_one(const char *s, size_t len, FLOAT *out)
+{
+    UINTFLOAT    uint = 0;
+    unsigned int overflow = 0;
+    int          uintdigits = 0;
+    int          exp = 0;
+    bool         neg = false, any = false, dot = false, ovfl = false;
+    size_t       i = 0;
+    FLOAT        flt;
+
+    if (i < len && (s[i] == '-' || s[i] == '+'))
+        neg = s[i++] == '-';
+
+    for (; i < len; i++) {
+        unsigned char c = (unsigned char)(s[i] - '0');
+
+        if (c < 10) {
+            any = true;
+            if (!ovfl && uintdigits > UINTDIGITSMAX) {
+                ovfl = true;
+                /* Check if overflow is >= 0.5 */
+                if (c >= 5) {
+                    overflow = 2;
+                    /* Check if overflow might be == 0.5 */
+                    if (c == 5)
+                        c = 0;
+                }
+            }
+            if (ovfl) {
+                overflow |= (c != 0);
+                if (!dot)
+                    exp += 1;
+            } else {
+                if (dot)
+                    exp -= 1;
+                uint = uint * 10 + c;
+                if (uint != 0)
+                    uintdigits++;
+            }
+        } else if (s[i] == '.' && !dot) {
+            dot = true;
+        } else {
+            break;
+        }
+    }
+
+    if (!any)
+        return 0;
+
+    if (i < len && (s[i] == 'e' || s[i] == 'E')) {
+        size_t j = i + 1;
+        bool   mexp = false;
+
+        if (j < len && (s[j] == '-' || s[j] == '+'))
+            mexp = s[j++] == '-';
+        if (j < len && IS_DIGIT(s[j])) {
+            int expacc = 0;
+
+            do {
+                if (expacc < MAX_POSSIBLE_EXP)
+                    expacc = expacc * 10 + (s[j] - '0');
+            } while (++j < len && IS_DIGIT(s[j]));
+            exp += mexp ? -expacc : expacc;
+            i = j;
+        }
+    }
+
+    if (uint == 0) {
+        flt = (FLOAT)0;
+    } else {
+        /* Mix in overflow, rounding half to even (see conv_flt) */
+        overflow |= (unsigned int)(uint & 1);
+        uint += (overflow + 1) >> 2;
+
+#ifdef _NEED_IO_FLOAT64
+        if (uintdigits + exp <= -324)
+            flt = (FLOAT)0.0;
+        else if (uintdigits + exp >= 310)
+            flt = (FLOAT)INFINITY;
+        else
+            flt = (FLOAT)__atod_engine(uint, exp);
+#else
+        if (uintdigits + exp <= -46)
+            flt = (FLOAT)0.0f;
+        else if (uintdigits + exp >= 40)
+            flt = (FLOAT)INFINITY;
+        else
+            flt = (FLOAT)__atof_engine(uint, exp);
+#endif
+    }
+
+    *out = neg ? -flt : flt;
+    return i;
+}
+
+size_t
+strtod_array(const char * __restrict buf, size_t len, FLOAT * __restrict vals, size_t nvals,
+             size_t * __restrict ends)
+{
+    size_t pos = 0;
+    size_t count;
+
+    for (count = 0; count < nvals; count++) {
+        size_t used;
+
+        while (pos < len && is_sep(buf[pos]))
+            pos++;
+        used = scan_one(buf + pos, len - pos, &vals[count]);
+        if (!used)
+            break;
+        pos += used;
+        if (ends)
+            ends[count] = pos;
+    }
+    return count;
+}
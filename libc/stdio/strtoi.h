@@ -31,6 +31,7 @@
 */
 
 #include "stdio_private.h"
+#include "../stdlib/local-div64.h"
 #include <inttypes.h>
 
 #ifdef WIDE_CHARS
@@ -55,9 +56,12 @@
 #define strtoi_utype strtoi_type
 #endif
 
-#if __HAVE_BUILTIN_MUL_OVERFLOW && __HAVE_BUILTIN_ADD_OVERFLOW && !defined(strtoi_signed)
+#if __HAVE_BUILTIN_MUL_OVERFLOW && __HAVE_BUILTIN_ADD_OVERFLOW
+#define USE_CHUNKS
+#ifndef strtoi_signed
 #define USE_OVERFLOW
 #endif
+#endif
 
 strtoi_type
 strtoi(const strtoi_char * __restrict nptr, strtoi_char ** __restrict endptr, int ibase)
@@ -109,17 +113,72 @@ strtoi(const strtoi_char * __restrict nptr, strtoi_char ** __restrict endptr, in
         base = 10;
     }
 
+#ifdef USE_CHUNKS
+    /*
+     * Decimal and hex digits are gathered into 32-bit chunks, as many
+     * as fit without overflowing, and each chunk is folded into val
+     * with a single wide multiply and overflow check.
+     */
+    if (base == 10 || base == 16) {
+#ifdef strtoi_signed
+        strtoi_utype limit = (strtoi_utype)strtoi_max + flags;
+#else
+        strtoi_utype limit = strtoi_max;
+#endif
+        unsigned int max_digits = base == 10 ? 9 : 7;
+
+        for (;;) {
+            uint32_t     chunk = 0;
+            uint32_t     scale = 1;
+            unsigned int n;
+
+            for (n = 0; n < max_digits; n++) {
+                i = digit_to_val(i);
+                if (i >= base)
+                    break;
+                chunk = chunk * base + i;
+                scale *= base;
+                /* Parsed another digit */
+                nptr = (const strtoi_char *)s;
+                i = *s++;
+            }
+            if (n == 0)
+                break;
+            if (sizeof(strtoi_utype) > sizeof(uint32_t)) {
+                /* scale fits in 32 bits, skip the full 64x64 multiply */
+                uint64_t wide;
+                if (__umul64x32_overflow(val, scale, &wide))
+                    flags |= FLAG_OFLOW;
+                val = (strtoi_utype)wide;
+            } else if (__builtin_mul_overflow(val, (strtoi_utype)scale, &val)) {
+                flags |= FLAG_OFLOW;
+            }
+            if (__builtin_add_overflow(val, (strtoi_utype)chunk, &val) || val > limit)
+                flags |= FLAG_OFLOW;
+            if (n < max_digits)
+                break;
+        }
+    } else {
+#endif
+
 #ifndef USE_OVERFLOW
     /* Compute values used to detect overflow. */
 #ifdef strtoi_signed
     /* works because strtoi_min = (strtoi_type) ((strtoi_utype) strtoi_max + 1) */
     strtoi_utype ucutoff = (strtoi_utype)strtoi_max + flags;
-    strtoi_utype cutoff = ucutoff / base;
-    unsigned int cutlim = ucutoff % base;
 #else
-    strtoi_type  cutoff = strtoi_max / base;
-    unsigned int cutlim = strtoi_max % base;
+    strtoi_utype ucutoff = strtoi_max;
 #endif
+    strtoi_utype cutoff;
+    unsigned int cutlim;
+    if (sizeof(strtoi_utype) > sizeof(uint32_t)) {
+        uint32_t r;
+        cutoff = (strtoi_utype)__udiv64_32(ucutoff, base, &r);
+        cutlim = r;
+    } else {
+        cutoff = ucutoff / base;
+        cutlim = ucutoff % base;
+    }
 #endif
 
     for (;;) {
@@ -150,6 +209,9 @@ strtoi(const strtoi_char * __restrict nptr, strtoi_char ** __restrict endptr, in
         nptr = (const strtoi_char *)s;
         i = *s++;
     }
+#ifdef USE_CHUNKS
+    }
+#endif
 
     /* Mark the end of the parsed region */
     if (endptr != NULL)
@@ -160,7 +222,7 @@ strtoi(const strtoi_char * __restrict nptr, strtoi_char ** __restrict endptr, in
 
     if (flags & FLAG_OFLOW) {
 #ifdef strtoi_signed
-        val = ucutoff;
+        val = (strtoi_utype)strtoi_max + (flags & FLAG_NEG);
 #else
         val = strtoi_max;
 #endif
@@ -35,21 +35,200 @@
 
 #include "stdio_private.h"
 
+/* Create and unlink a temporary file, returning its descriptor */
+static int
+tmpfile_open(void)
+{
+    char tmpnam[L_tmpnam];
+    int  fd;
+
+    strcpy(tmpnam, "TXXXXXX");
+    fd = mkstemp(tmpnam);
+    if (fd >= 0)
+        /* Assume POSIX semantics for unlinking in-use files */
+        unlink(tmpnam);
+    return fd;
+}
+
+#ifdef __TMPFILE_RAM
+
+/*
+ * With tmpfile-ram set, the file lives in a heap buffer behind a
+ * funopen stream, so scratch data stays at memory speed on systems
+ * whose file system is slow or missing. Once it would grow past
+ * __TMPFILE_RAM bytes, the contents move to a real temporary file and
+ * the cookie forwards to that; -1 never moves them.
+ */
+
+#define TMPFILE_RAM_MIN 256
+
+struct tmpfile_ram {
+    char  *buf;
+    size_t len;  /* bytes of data */
+    size_t cap;  /* bytes allocated */
+    size_t pos;
+    int    fd;   /* spilled file, or -1 */
+};
+
+/* Move the contents to a real file, leaving its offset at pos */
+static bool
+tmpfile_spill(struct tmpfile_ram *t)
+{
+    size_t  done;
+    ssize_t n;
+    int     fd = tmpfile_open();
+
+    if (fd < 0)
+        return false;
+    for (done = 0; done < t->len; done += n) {
+        n = write(fd, t->buf + done, t->len - done);
+        if (n <= 0)
+            goto fail;
+    }
+    if (lseek(fd, (off_t)t->pos, SEEK_SET) < 0)
+        goto fail;
+    free(t->buf);
+    t->buf = NULL;
+    t->fd = fd;
+    return true;
+fail:
+    close(fd);
+    return false;
+}
+
+static ssize_t
+tmpfile_read(void *cookie, void *buf, size_t n)
+{
+    struct tmpfile_ram *t = cookie;
+
+    if (t->fd >= 0)
+        return read(t->fd, buf, n);
+    if (t->pos >= t->len)
+        return 0;
+    if (n > t->len - t->pos)
+        n = t->len - t->pos;
+    memcpy(buf, t->buf + t->pos, n);
+    t->pos += n;
+    return (ssize_t)n;
+}
+
+static ssize_t
+tmpfile_write(void *cookie, const void *buf, size_t n)
+{
+    struct tmpfile_ram *t = cookie;
+    size_t              end;
+
+    if (t->fd >= 0)
+        return write(t->fd, buf, n);
+    if (n > (size_t)PTRDIFF_MAX - t->pos) {
+        errno = EFBIG;
+        return -1;
+    }
+    end = t->pos + n;
+    if (__TMPFILE_RAM >= 0 && end > (size_t)__TMPFILE_RAM) {
+        if (!tmpfile_spill(t))
+            return -1;
+        return write(t->fd, buf, n);
+    }
+    if (end > t->cap) {
+        /* At least double the buffer, as open_memstream does */
+        size_t cap = t->cap * 2;
+        char  *nbuf;
+
+        if (cap < end)
+            cap = end;
+        if (cap < TMPFILE_RAM_MIN)
+            cap = TMPFILE_RAM_MIN;
+        nbuf = realloc(t->buf, cap);
+        if (!nbuf) {
+            errno = ENOMEM;
+            return -1;
+        }
+        t->buf = nbuf;
+        t->cap = cap;
+    }
+    /* Writing past the end after a seek leaves zeros in the gap */
+    if (t->pos > t->len)
+        memset(t->buf + t->len, 0, t->pos - t->len);
+    memcpy(t->buf + t->pos, buf, n);
+    t->pos = end;
+    if (end > t->len)
+        t->len = end;
+    return (ssize_t)n;
+}
+
+static off_t
+tmpfile_seek(void *cookie, off_t off, int whence)
+{
+    struct tmpfile_ram *t = cookie;
+
+    if (t->fd >= 0)
+        return lseek(t->fd, off, whence);
+    switch (whence) {
+    case SEEK_SET:
+        break;
+    case SEEK_CUR:
+        off += (off_t)t->pos;
+        break;
+    case SEEK_END:
+        off += (off_t)t->len;
+        break;
+    default:
+        errno = EINVAL;
+        return -1;
+    }
+    if (off < 0 || (uintmax_t)off > PTRDIFF_MAX) {
+        errno = EINVAL;
+        return -1;
+    }
+    t->pos = (size_t)off;
+    return off;
+}
+
+static int
+tmpfile_close(void *cookie)
+{
+    struct tmpfile_ram *t = cookie;
+    int                 ret = 0;
+
+    if (t->fd >= 0)
+        ret = close(t->fd);
+    free(t->buf);
+    free(t);
+    return ret;
+}
+
+FILE *
+tmpfile(void)
+{
+    struct tmpfile_ram *t;
+    FILE               *f;
+
+    t = calloc(1, sizeof(*t));
+    if (!t)
+        return NULL;
+    t->fd = -1;
+    f = funopen(t, tmpfile_read, tmpfile_write, tmpfile_seek, tmpfile_close);
+    if (!f)
+        tmpfile_close(t);
+    return f;
+}
+
+#else
+
 FILE *
 tmpfile(void)
 {
-    char  tmpnam[L_tmpnam];
     int   fd;
     FILE *f;
 
-    strcpy(tmpnam, "TXXXXXX");
-    fd = mkstemp(tmpnam);
+    fd = tmpfile_open();
     if (fd < 0)
         return NULL;
-    /* Assume POSIX semantics for unlinking in-use files */
-    unlink(tmpnam);
     f = fdopen(fd, "w+");
     if (f == NULL)
         close(fd);
     return f;
 }
+
+#endif
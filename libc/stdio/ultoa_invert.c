@@ -26,7 +26,30 @@
   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
   POSSIBILITY OF SUCH DAMAGE. */
 
-#if !IO_VARIANT_IS_FLOAT(PRINTF_VARIANT) && defined(__IO_SMALL_ULTOA)
+#include "../stdlib/local-divmod.h"
+
+#if defined(__IO_FAST_ULTOA) && !defined(__IO_SMALL_ULTOA)
+
+/*
+ * Decimal digits come from a two-digit table indexed with a
+ * reciprocal multiply by 100. The shift-and-add code is still used
+ * to peel digits off values wider than 32 bits, and octal and hex
+ * always use shifts.
+ */
+#define FAST_ULTOA
+#define FANCY_DIVMOD
+
+#include "../stdlib/local-utoa.h"
+
+#elif defined(__m65832__)
+
+/*
+ * m65832 has no divide instruction, so the shift-and-add code is
+ * much faster than soft division for every size and printf variant
+ */
+#define FANCY_DIVMOD
+
+#elif !IO_VARIANT_IS_FLOAT(PRINTF_VARIANT) && defined(__IO_SMALL_ULTOA)
 
 /*
  * Enable fancy divmod for targets where we don't expect either
@@ -38,8 +61,12 @@
  */
 
 #if SIZEOF_ULTOA > __SIZEOF_LONG__
-
 #define FANCY_DIVMOD
+#endif
+
+#endif
+
+#ifdef FANCY_DIVMOD
 
 static inline ultoa_unsigned_t
 udivmod10(ultoa_unsigned_t n, char *rp)
@@ -127,7 +154,6 @@ udivmod(ultoa_unsigned_t val, int base, char *dig)
     return udivmod10(val, dig);
 }
 
-#endif
 #endif
 
 static __noinline char *
@@ -137,14 +163,35 @@ __ultoa_invert(ultoa_unsigned_t val, char *str, int base)
 
     base &= 31;
 
+#ifdef FAST_ULTOA
+    if (base == 10) {
+#if SIZEOF_ULTOA > 4
+        while (val > UINT32_MAX) {
+            char v;
+
+            val = udivmod10(val, &v);
+            *str++ = v + '0';
+        }
+#endif
+        return __utoa_dec_invert((uint32_t)val, str);
+    }
+#endif
+
     do {
         char v;
 
 #ifdef FANCY_DIVMOD
         val = udivmod(val, base, &v);
+#elif SIZEOF_ULTOA > __SIZEOF_LONG__
+        unsigned long long r;
+
+        val = __udivmod_ull(val, base, &r);
+        v = (char)r;
 #else
-        v = val % base;
-        val /= base;
+        unsigned long r;
+
+        val = __udivmod_ul(val, base, &r);
+        v = (char)r;
 #endif
         if (v > 9)
             v += hex;
@@ -153,3 +200,29 @@ __ultoa_invert(ultoa_unsigned_t val, char *str, int base)
     } while (val);
     return str;
 }
+
+/*
+ * The number of digits __ultoa_invert would produce, for sizing calls
+ * which only need the length
+ */
+static inline int
+__ultoa_width(ultoa_unsigned_t val, int base)
+{
+    ultoa_unsigned_t p;
+    int              n = 1;
+
+    base &= 31;
+    if (base == 10) {
+        for (p = 10; val >= p; p *= 10) {
+            n++;
+            if (p > (ultoa_unsigned_t)-1 / 10)
+                break;
+        }
+    } else {
+        int shift = base == 16 ? 4 : base == 8 ? 3 : 1;
+
+        while ((val >>= shift) != 0)
+            n++;
+    }
+    return n;
+}
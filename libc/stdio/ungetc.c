@@ -44,7 +44,12 @@ ungetc(int c, FILE *stream)
     if ((stream->flags & __SRD) == 0 || c == EOF)
         __funlock_return(stream, EOF);
 
-    if (!__atomic_compare_exchange_ungetc(&stream->unget, 0, (__ungetc_t)(unsigned char)c + 1))
+    /*
+     * Pushing back what a bufio stream just read only rewinds its
+     * buffer; anything else takes the one character unget slot.
+     */
+    if (!((stream->flags & __SBUF) && !stream->unget && __bufio_unget(stream, c))
+        && !__atomic_compare_exchange_ungetc(&stream->unget, 0, (__ungetc_t)(unsigned char)c + 1))
         __funlock_return(stream, EOF);
 
     stream->flags &= ~__SEOF;
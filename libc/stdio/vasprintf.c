@@ -38,7 +38,8 @@
 int __disable_sanitizer
 vasprintf(char **strp, const char *fmt, va_list ap)
 {
-    struct __file_str f = FDEV_SETUP_STRING_ALLOC();
+    /* The literal text of the format plus room for a few conversions */
+    struct __file_str f = FDEV_SETUP_STRING_ALLOC_HINT(strlen(fmt) + 32);
     int               i;
 
     i = vfprintf(&f.file, fmt, ap);
@@ -35,12 +35,49 @@
 
 #include "stdio_private.h"
 
-#define DPRINT_BUFSIZ 32
+#ifndef __DPRINTF_BUFSIZ
+#define __DPRINTF_BUFSIZ 128
+#endif
 
-int
+/*
+ * Format the whole message before sending any of it, starting in a
+ * stack buffer and moving to the heap when that fills, so that it
+ * reaches fd in a single write however long it is. If the heap runs
+ * out, send it through a small bufio buffer instead.
+ */
+int __disable_sanitizer
 vdprintf(int fd, const char *fmt, va_list ap)
 {
-    char                buf[DPRINT_BUFSIZ];
+    char              buf[__DPRINTF_BUFSIZ];
+    struct __file_str f = FDEV_SETUP_STRING_ALLOC_BUF(buf, sizeof(buf));
+    va_list           ap_copy;
+    int               len;
+    char             *out;
+
+    va_copy(ap_copy, ap);
+    len = vfprintf(&f.file, fmt, ap_copy);
+    va_end(ap_copy);
+    out = POINTER_MINUS(f.end, f.size);
+
+    if (len >= 0) {
+        int done = 0;
+
+        while (done < len) {
+            ssize_t this = write(fd, out + done, len - done);
+            if (this <= 0) {
+                len = _FDEV_ERR;
+                break;
+            }
+            done += this;
+        }
+        if (f.alloc)
+            free(out);
+        return len;
+    }
+
+    if (f.alloc)
+        free(out);
+
     struct __file_bufio bf
         = FDEV_SETUP_BUFIO(fd, buf, sizeof(buf), NULL, write, NULL, NULL, __SWR, 0);
 
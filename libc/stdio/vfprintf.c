@@ -57,9 +57,16 @@
  *  __IO_VARIANT_FLOAT: full integer support along with float, but not double
  *
  *  __IO_VARIANT_DOUBLE: full support
+ *
+ * Defining PRINTF_CONVERSIONS to a string of conversion characters
+ * further limits the result to those conversions; everything else is
+ * output verbatim, like an unknown conversion. The comparisons against
+ * characters not in the string fold away, taking their handlers with
+ * them. scripts/picolibc-printf-select generates such a build from the
+ * format strings found in an application.
  */
 
-#if __IO_DEFAULT != PRINTF_VARIANT || defined(WIDE_CHARS)
+#if __IO_DEFAULT != PRINTF_VARIANT || defined(WIDE_CHARS) || defined(PRINTF_CONVERSIONS)
 #define vfprintf PRINTF_NAME
 #endif
 
@@ -156,6 +163,15 @@
 
 #endif
 
+#ifdef PRINTF_CONVERSIONS
+#define PRINTF_CONV(x)  (__builtin_strchr(PRINTF_CONVERSIONS, x) != NULL)
+#define PRINTF_CONV_FLOAT (__builtin_strpbrk(PRINTF_CONVERSIONS, "aAeEfFgG") != NULL)
+#else
+#define PRINTF_CONV(x)  1
+#define PRINTF_CONV_FLOAT 1
+#endif
+#define PRINTF_IS(c, x) (PRINTF_CONV(x) && (c) == (x))
+
 /* Figure out which multi-byte char support we need */
 #if defined(_NEED_IO_WCHAR) && defined(__MB_CAPABLE)
 #ifdef WIDE_CHARS
@@ -245,6 +261,31 @@ typedef long          ultoa_signed_t;
 #endif
 #endif
 
+/*
+ * Small-stack builds keep the conversion scratch out of the frame.
+ * The scratch is per-thread, so a nested printf from the same thread
+ * (e.g. from a stream's put function) may overwrite digits which the
+ * outer call has not yet written
+ */
+#ifdef __IO_SMALL_STACK
+#define PRINTF_SCRATCH static __THREAD_LOCAL
+#else
+#define PRINTF_SCRATCH
+#endif
+
+#ifdef WIDE_CHARS
+/*
+ * Wide output is collected in the frame and written with one put_span
+ * call per PRINTF_WOUT_SIZE characters instead of a putwc call, and
+ * so a lock and sizeof(wchar_t) put calls, for each of them.
+ */
+#ifdef __IO_SMALL_STACK
+#define PRINTF_WOUT_SIZE 8
+#else
+#define PRINTF_WOUT_SIZE 32
+#endif
+#endif
+
 // At the call site the address of the result_var is taken (e.g. "&ap")
 // That way, it's clear that these macros *will* modify that variable
 #define arg_to_unsigned(ap, flags, result_var) arg_to_t(ap, flags, unsigned, result_var)
@@ -335,28 +376,36 @@ typedef long          ultoa_signed_t;
 
 typedef struct {
     va_list ap;
+    int     count;            /* arguments located, -1 before the first '$' */
+    va_list pos[NL_ARGMAX];   /* copies of the va_list at each argument */
 } my_va_list;
 
 /*
- * Repeatedly scan the format string finding argument position values
- * and types to slowly walk the argument vector until it points at the
- * target_argno so that the outer printf code can then extract it.
+ * Scan the whole format string once, noting the conversion which
+ * consumes each positional argument and its size flags, then walk
+ * the argument vector once, saving a copy of it positioned at each
+ * argument. That makes every later positional fetch a single va_copy
+ * instead of a rescan of the format and a rewalk of the arguments.
  */
 static void
-skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, int target_argno)
+find_args(const CHAR *fmt, my_va_list *ap, va_list ap_orig)
 {
-    unsigned    c; /* holds a char from the format string */
-    uint16_t    flags;
-    int         current_argno = 1;
-    int         argno;
-    int         width;
-    const CHAR *fmt = fmt_orig;
+    unsigned char arg_conv[NL_ARGMAX];
+    uint16_t      arg_flags[NL_ARGMAX];
+    unsigned      c; /* holds a char from the format string */
+    uint16_t      flags;
+    int           count = 0;
+    int           argno;
+    int           num;
+    va_list       walk;
+
+    memset(arg_conv, 0, sizeof(arg_conv));
 
-    while (current_argno < target_argno) {
+    for (;;) {
         for (;;) {
             c = *fmt++;
             if (!c)
-                return;
+                goto walk;
             if (c == '%') {
                 c = *fmt++;
                 if (c != '%')
@@ -364,25 +413,17 @@ skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, int target_argno)
             }
         }
         flags = 0;
-        width = 0;
+        num = 0;
         argno = 0;
 
-        /*
-         * Scan the format string until we hit current_argno. This can
-         * either be a value, width or precision field.
-         */
         do {
             if (flags < FL_WIDTH) {
                 switch (c) {
                 case '0':
-                    continue;
                 case '+':
                 case ' ':
-                    continue;
                 case '-':
-                    continue;
                 case '#':
-                    continue;
                 case '\'':
                     continue;
                 }
@@ -390,37 +431,31 @@ skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, int target_argno)
 
             if (flags < FL_LONG) {
                 if (c >= '0' && c <= '9') {
-                    c -= '0';
-                    width = 10 * width + c;
+                    num = 10 * num + (c - '0');
                     flags |= FL_WIDTH;
                     continue;
                 }
                 if (c == '$') {
                     /*
-                     * If we've already seen the value position, any
-                     * other positions will be either width or
-                     * precisions. We can handle those in the same
-                     * fashion as they're both 'int' type
+                     * The first position is the value, any others are
+                     * width or precision, which are both 'int'
                      */
                     if (argno) {
-                        if (width == current_argno) {
-                            c = 'c';
-                            argno = width;
-                            break;
+                        if (num >= 1 && num <= NL_ARGMAX) {
+                            arg_conv[num - 1] = 'c';
+                            arg_flags[num - 1] = 0;
+                            if (num > count)
+                                count = num;
                         }
-                    } else
-                        argno = width;
-                    width = 0;
-                    continue;
-                }
-
-                if (c == '*') {
-                    width = 0;
+                    } else {
+                        argno = num;
+                        flags = 0;
+                    }
+                    num = 0;
                     continue;
                 }
-
-                if (c == '.') {
-                    width = 0;
+                if (c == '*' || c == '.') {
+                    num = 0;
                     continue;
                 }
             }
@@ -429,30 +464,70 @@ skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, int target_argno)
 
             break;
         } while ((c = *fmt++) != 0);
-        if (argno == 0)
+
+        if (!c || argno == 0)
             break;
-        if (argno == current_argno) {
-            if ((TOLOWER(c) >= 'e' && TOLOWER(c) <= 'g')
+        if (argno <= NL_ARGMAX) {
+            arg_conv[argno - 1] = c;
+            arg_flags[argno - 1] = flags;
+            if (argno > count)
+                count = argno;
+        }
+    }
+
+walk:
+    va_copy(walk, ap_orig);
+    for (argno = 0; argno < count; argno++) {
+        va_copy(ap->pos[argno], walk);
+        c = arg_conv[argno];
+        flags = arg_flags[argno];
+        if ((TOLOWER(c) >= 'e' && TOLOWER(c) <= 'g')
 #ifdef _NEED_IO_C99_FORMATS
-                || TOLOWER(c) == 'a'
+            || TOLOWER(c) == 'a'
 #endif
-            ) {
-                SKIP_FLOAT_ARG(flags, ap->ap);
-            } else if (c == 'c') {
-                (void)va_arg(ap->ap, int);
-            } else if (c == 's') {
-                (void)va_arg(ap->ap, char *);
-            } else if (c == 'd' || c == 'i') {
-                ultoa_signed_t x_s;
-                arg_to_signed(ap->ap, flags, x_s);
-            } else {
-                ultoa_unsigned_t x;
-                arg_to_unsigned(ap->ap, flags, x);
-            }
-            ++current_argno;
-            fmt = fmt_orig;
+        ) {
+            SKIP_FLOAT_ARG(flags, walk);
+        } else if (c == 's' || c == 'p' || c == 'n') {
+            (void)va_arg(walk, void *);
+        } else if (c == 'd' || c == 'i') {
+            ultoa_signed_t x_s;
+            arg_to_signed(walk, flags, x_s);
+        } else if (c == 'c' || c == 0) {
+            /* 'c', widths, precisions and any unused positions */
+            (void)va_arg(walk, int);
+        } else {
+            ultoa_unsigned_t x;
+            arg_to_unsigned(walk, flags, x);
         }
     }
+    va_end(walk);
+    ap->count = count;
+}
+
+/*
+ * Point ap->ap at argument target_argno, locating all of the
+ * arguments the first time through
+ */
+static void
+skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, va_list ap_orig, int target_argno)
+{
+    if (ap->count < 0)
+        find_args(fmt_orig, ap, ap_orig);
+    va_end(ap->ap);
+    if (target_argno >= 1 && target_argno <= ap->count)
+        va_copy(ap->ap, ap->pos[target_argno - 1]);
+    else
+        va_copy(ap->ap, ap_orig);
+}
+
+static void
+end_args(my_va_list *ap)
+{
+    int argno;
+
+    for (argno = 0; argno < ap->count; argno++)
+        va_end(ap->pos[argno]);
+    va_end(ap->ap);
 }
 #endif
 
@@ -522,7 +597,7 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 #else
 #define ap ap_orig
 #endif
-    union {
+    PRINTF_SCRATCH union {
         char buf[PRINTF_BUF_SIZE]; /* size for -1 in smallest base, without '\0'	*/
 #ifdef _NEED_IO_WCHAR
         wchar_t wbuf[PRINTF_BUF_SIZE / 2]; /* for wide char output */
@@ -540,6 +615,10 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 #endif
 
     int stream_len = 0;
+#ifdef WIDE_CHARS
+    wchar_t  wout[PRINTF_WOUT_SIZE];
+    unsigned wout_len = 0;
+#endif
 
 #ifdef VFPRINTF_S
     const char *msg;
@@ -555,20 +634,48 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 
 #ifndef my_putc
 #ifdef WIDE_CHARS
-#define my_putc(c, stream)            \
-    do {                              \
-        ++stream_len;                 \
-        if (putwc(c, stream) == WEOF) \
-            goto fail;                \
+#define my_flush(stream)                                                      \
+    do {                                                                      \
+        size_t _n = wout_len * sizeof(wchar_t);                               \
+        wout_len = 0;                                                         \
+        if (_n && __file_put_span((const char *)wout, _n, stream) < 0)        \
+            goto fail;                                                        \
+    } while (0)
+#define my_putc(c, stream)                \
+    do {                                  \
+        ++stream_len;                     \
+        wout[wout_len++] = (wchar_t)(c);  \
+        if (wout_len == PRINTF_WOUT_SIZE) \
+            my_flush(stream);             \
+    } while (0)
+#define my_puts(s, len, stream)           \
+    do {                                  \
+        const char *_s = (s);             \
+        size_t      _len = (len);         \
+        while (_len--)                    \
+            my_putc(*_s++, stream);       \
     } while (0)
+#define my_measuring() 0
 #else
+    /*
+     * A stream without a put function is a sizing call from
+     * snprintf(NULL, 0, ...): nothing is written, and conversions
+     * which know their length skip generating the text.
+     */
     int (*put)(char, FILE *) = stream->put;
-#define my_putc(c, stream)      \
-    do {                        \
-        ++stream_len;           \
-        if (put(c, stream) < 0) \
-            goto fail;          \
+#define my_putc(c, stream)               \
+    do {                                 \
+        ++stream_len;                    \
+        if (put && put(c, stream) < 0)   \
+            goto fail;                   \
     } while (0)
+#define my_puts(s, len, stream)                              \
+    do {                                                     \
+        stream_len += (len);                                 \
+        if (put && __file_put_span(s, len, stream) < 0)      \
+            goto fail;                                       \
+    } while (0)
+#define my_measuring() (put == NULL)
 #endif
 #endif
 
@@ -577,13 +684,26 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
     if ((stream->flags & __SWR) == 0)
         __funlock_return(stream, EOF);
 
+#ifdef WIDE_CHARS
+    stream->flags |= __SWIDE;
+#endif
+
 #ifdef _NEED_IO_POS_ARGS
     va_copy(ap, ap_orig);
+    my_ap.count = -1;
 #endif
 
     for (;;) {
 
         for (;;) {
+#ifndef WIDE_CHARS
+            /* Send the literal text up to the next conversion as one span */
+            pnt = fmt;
+            while (*fmt && *fmt != '%')
+                fmt++;
+            if (fmt != pnt)
+                my_puts(pnt, fmt - pnt, stream);
+#endif
             c = *fmt++;
             if (!c)
                 goto ret;
@@ -595,6 +715,55 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
             my_putc(c, stream);
         }
 
+#if (!defined(_NEED_IO_SHRINK) || defined(PRINTF_CONVERSIONS)) && !defined(VFPRINTF_S)
+        /*
+         * Conversions without flags, width, precision, length
+         * modifier or argument position are the common case for
+         * logging; emit them directly instead of going through the
+         * full parser and padding logic below. A build limited to a
+         * few conversions keeps this even in the minimal variant, as
+         * it is then only a handful of comparisons.
+         */
+        if (PRINTF_IS(c, 'd') || PRINTF_IS(c, 'i') || PRINTF_IS(c, 'u') || PRINTF_IS(c, 'x')
+            || PRINTF_IS(c, 'X')) {
+            ultoa_unsigned_t x;
+            int              base = 10;
+            int              buf_len;
+
+            if (c == 'd' || c == 'i') {
+                int x_s = va_arg(ap, int);
+
+                if (x_s < 0) {
+                    my_putc('-', stream);
+                    x = -(unsigned)x_s;
+                } else {
+                    x = (unsigned)x_s;
+                }
+            } else {
+                if (c != 'u')
+                    base = ('x' - c) | 16;
+                x = va_arg(ap, unsigned);
+            }
+            if (my_measuring()) {
+                stream_len += __ultoa_width(x, base);
+                continue;
+            }
+            buf_len = __ultoa_invert(x, u.buf, base) - u.buf;
+            while (buf_len)
+                my_putc(u.buf[--buf_len], stream);
+            continue;
+        }
+#ifndef WIDE_CHARS
+        if (PRINTF_IS(c, 's')) {
+            pnt = va_arg(ap, char *);
+            if (!pnt)
+                pnt = "(null)";
+            my_puts(pnt, strlen(pnt), stream);
+            continue;
+        }
+#endif
+#endif
+
         flags = 0;
 #ifndef _NEED_IO_SHRINK
         int width = 0;
@@ -683,9 +852,8 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
                      * are adding width or precision fields
                      */
                     if (argno) {
-                        va_end(ap);
-                        va_copy(ap, ap_orig);
-                        skip_to_arg(fmt_orig, &my_ap, (flags & FL_PREC) ? prec : width);
+                        skip_to_arg(fmt_orig, &my_ap, ap_orig,
+                                    (flags & FL_PREC) ? prec : width);
                         if (flags & FL_PREC)
                             prec = va_arg(ap, int);
                         else
@@ -708,11 +876,8 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 
 #ifdef _NEED_IO_POS_ARGS
         /* Set arg pointers for positional args */
-        if (argno) {
-            va_end(ap);
-            va_copy(ap, ap_orig);
-            skip_to_arg(fmt_orig, &my_ap, argno);
-        }
+        if (argno)
+            skip_to_arg(fmt_orig, &my_ap, ap_orig, argno);
 #endif
 
 #ifndef _NEED_IO_SHRINK
@@ -738,11 +903,12 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 #define TOCASE(c) ((c) - case_convert)
 
 #ifndef _NEED_IO_SHRINK
-        if ((TOLOWER(c) >= 'e' && TOLOWER(c) <= 'g')
+        if (PRINTF_CONV_FLOAT
+            && ((TOLOWER(c) >= 'e' && TOLOWER(c) <= 'g')
 #ifdef _NEED_IO_C99_FORMATS
-            || TOLOWER(c) == 'a'
+                || TOLOWER(c) == 'a'
 #endif
-        ) {
+                )) {
 #if IO_VARIANT_IS_FLOAT(PRINTF_VARIANT)
 #include "vfprintf_float.c"
 #else
@@ -762,16 +928,16 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
             pnt = NULL;
 #endif
 
-            if (c == 'c') {
+            if (PRINTF_IS(c, 'c')) {
 #include "vfprintf_char.c"
             }
 
-            else if (c == 's') {
+            else if (PRINTF_IS(c, 's')) {
 #include "vfprintf_str.c"
             }
 
 #if defined(__IO_PERCENT_N) || defined(VFPRINTF_S)
-            else if (c == 'n') {
+            else if (PRINTF_IS(c, 'n')) {
 #include "vfprintf_n.c"
             }
 #endif
@@ -790,11 +956,17 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
     } /* for (;;) */
 
 ret:
+#ifdef WIDE_CHARS
+    my_flush(stream);
+#endif
 #ifdef _NEED_IO_POS_ARGS
-    va_end(ap);
+    end_args(&my_ap);
 #endif
     __funlock_return(stream, stream_len);
 #undef my_putc
+#undef my_puts
+#undef my_flush
+#undef my_measuring
 #undef ap
 fail:
     stream->flags |= __SERR;
@@ -811,7 +983,7 @@ handle_error:
 #endif
 }
 
-#if !defined(VFPRINTF_S) && !defined(WIDE_CHARS)
+#if !defined(VFPRINTF_S) && !defined(WIDE_CHARS) && !defined(PRINTF_CONVERSIONS)
 #if PRINTF_VARIANT == __IO_DEFAULT
 #undef vfprintf
 #ifdef __strong_reference
@@ -139,7 +139,14 @@
             if (ndigs > FLOAT_MAX_DIG)
                 ndigs = FLOAT_MAX_DIG;
 
-            ndigs = __float_d_engine(fval, &u.dtoa, ndigs, fmode, ndecimal);
+#ifdef __IO_FLOAT_FIXED
+            /* Integer-only conversion for small '%.Nf' values */
+            int nfixed = fmode ? __float_f_engine(fval, &u.dtoa, ndecimal) : -1;
+            if (nfixed >= 0)
+                ndigs = nfixed;
+            else
+#endif
+                ndigs = __float_d_engine(fval, &u.dtoa, ndigs, fmode, ndecimal);
             exp = u.dtoa.exp;
             ndigs_exp = 2;
         }
@@ -271,6 +278,12 @@
 
         width = width > n ? width - n : 0;
 
+        /* A sizing call only needs the length */
+        if (my_measuring()) {
+            stream_len += n + width;
+            continue;
+        }
+
         /* Output before first digit	*/
         if (!(flags & (FL_LPAD | FL_ZFILL))) {
             while (width) {
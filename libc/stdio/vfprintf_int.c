@@ -30,7 +30,7 @@
   POSSIBILITY OF SUCH DAMAGE.
 */
 {
-    if (c == 'd' || c == 'i') {
+    if (PRINTF_IS(c, 'd') || PRINTF_IS(c, 'i')) {
         ultoa_signed_t x_s;
 
         arg_to_signed(ap, flags, x_s);
@@ -48,27 +48,28 @@
             buf_len = 0;
         else
 #endif
-            buf_len = __ultoa_invert(x_s, u.buf, 10) - u.buf;
+            buf_len = my_measuring() ? __ultoa_width(x_s, 10)
+                                     : __ultoa_invert(x_s, u.buf, 10) - u.buf;
     } else {
         int              base;
         ultoa_unsigned_t x;
 
-        if (c == 'u') {
+        if (PRINTF_IS(c, 'u')) {
             flags &= ~FL_ALT;
             base = 10;
-        } else if (c == 'o') {
+        } else if (PRINTF_IS(c, 'o')) {
             base = 8;
             c = '\0';
-        } else if (c == 'p') {
+        } else if (PRINTF_IS(c, 'p')) {
             base = 16;
             flags |= FL_ALT;
             c = 'x';
             if (sizeof(void *) > sizeof(int))
                 flags |= FL_LONG;
-        } else if (TOLOWER(c) == 'x') {
+        } else if (PRINTF_IS(c, 'x') || PRINTF_IS(c, 'X')) {
             base = ('x' - c) | 16;
 #ifdef _NEED_IO_PERCENT_B
-        } else if (TOLOWER(c) == 'b') {
+        } else if (PRINTF_IS(c, 'b') || PRINTF_IS(c, 'B')) {
             base = 2;
 #endif
         } else {
@@ -90,7 +91,8 @@
             buf_len = 0;
         else
 #endif
-            buf_len = __ultoa_invert(x, u.buf, base) - u.buf;
+            buf_len = my_measuring() ? __ultoa_width(x, base)
+                                     : __ultoa_invert(x, u.buf, base) - u.buf;
     }
 
 #ifndef _NEED_IO_SHRINK
@@ -174,6 +176,9 @@
 #endif
 
     /* Output value */
-    while (buf_len)
-        my_putc(u.buf[--buf_len], stream);
+    if (my_measuring())
+        stream_len += buf_len;
+    else
+        while (buf_len)
+            my_putc(u.buf[--buf_len], stream);
 }
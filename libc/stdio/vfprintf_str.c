@@ -60,9 +60,7 @@
         pnt = "(null)";
     }
 #ifdef _NEED_IO_SHRINK
-    char c;
-    while ((c = *pnt++))
-        my_putc(c, stream);
+    my_puts(pnt, strlen(pnt), stream);
 #else
     size = (flags & FL_PREC) ? (size_t)prec : SIZE_MAX;
 #ifdef _NEED_IO_MBTOWIDE
@@ -108,8 +106,7 @@ str_lpad:
             pnt += mb_len;
         }
 #else
-        while (size--)
-            my_putc(*pnt++, stream);
+        my_puts(pnt, size, stream);
 #endif
     }
 #endif
@@ -113,23 +113,39 @@ typedef long          int_scanf_t;
 #endif
 #endif
 
+/*
+ * When reading from sscanf, vsscanf or swscanf, str walks the string
+ * directly instead of calling through the FILE for every character;
+ * it is NULL for other streams.
+ */
 #ifdef WIDE_CHARS
 typedef struct {
-    int len;
-    INT unget;
+    int            len;
+    INT            unget;
+    const wchar_t *str;
 } scanf_context_t;
-#define SCANF_CONTEXT_INIT { .len = 0, .unget = MY_EOF }
-#define scanf_len(context) ((context)->len)
+#define SCANF_CONTEXT_INIT { .len = 0, .unget = MY_EOF, .str = NULL }
 #else
-typedef int scanf_context_t;
-#define SCANF_CONTEXT_INIT 0
-#define scanf_len(context) (*(context))
+typedef struct {
+    int                  len;
+    const unsigned char *str;
+} scanf_context_t;
+#define SCANF_CONTEXT_INIT { .len = 0, .str = NULL }
 #endif
+#define scanf_len(context) ((context)->len)
 
 static INT
 scanf_getc(FILE *stream, scanf_context_t *context)
 {
     INT c;
+    if (context->str) {
+        c = *context->str;
+        if (c == 0)
+            return MY_EOF;
+        context->str++;
+        ++scanf_len(context);
+        return c;
+    }
 #ifdef WIDE_CHARS
     c = context->unget;
     context->unget = MY_EOF;
@@ -144,16 +160,48 @@ scanf_getc(FILE *stream, scanf_context_t *context)
 static void
 scanf_ungetc(INT c, FILE *stream, scanf_context_t *context)
 {
-    if (!IS_EOF(c))
+    if (!IS_EOF(c)) {
         --scanf_len(context);
+        if (context->str) {
+            context->str--;
+            return;
+        }
+    }
 #ifdef WIDE_CHARS
     (void)stream;
-    context->unget = c;
+    if (!context->str)
+        context->unget = c;
 #else
-    UNGETC(c, stream);
+    if (!context->str)
+        UNGETC(c, stream);
 #endif
 }
 
+/* Take over reading from a string stream which has not been read yet */
+static void
+scanf_str_begin(FILE *stream, scanf_context_t *context)
+{
+    struct __file_str *sstream = (struct __file_str *)stream;
+
+    if (stream->unget)
+        return;
+#ifdef WIDE_CHARS
+    if (stream->get == __file_wstr_get && sstream->pos == sstream->end)
+        context->str = (const wchar_t *)sstream->pos;
+#else
+    if (stream->get == __file_str_get)
+        context->str = (const unsigned char *)sstream->pos;
+#endif
+}
+
+/* Leave the string stream where a FILE based scan would have */
+static void
+scanf_str_end(FILE *stream, scanf_context_t *context)
+{
+    if (context->str)
+        ((struct __file_str *)stream)->pos = (char *)context->str;
+}
+
 #ifdef _NEED_IO_MBTOWIDE
 static WINT
 getmb(FILE *stream, scanf_context_t *context, mbstate_t *ps, uint16_t flags)
@@ -425,6 +473,58 @@ conv_brk(FILE *stream, scanf_context_t *context, width_t width, void *addr, cons
 
 #if defined(_NEED_IO_FLOAT) || defined(_NEED_IO_DOUBLE)
 #include "conv_flt.c"
+
+/*
+ * For string sources without a width, the text is already in memory,
+ * so let strtod parse it in place rather than feeding conv_flt one
+ * character at a time. strtod only accepts hex floats like scanf does
+ * when C99 formats are enabled.
+ */
+#if defined(__IO_C99_FORMATS) && !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+#define _NEED_IO_FLT_STR
+
+#ifdef WIDE_CHARS
+#define STRTOF_STR  wcstof
+#define STRTOD_STR  wcstod
+#define STRTOLD_STR wcstold
+#else
+#define STRTOF_STR  strtof
+#define STRTOD_STR  strtod
+#define STRTOLD_STR strtold
+#endif
+
+static unsigned char
+conv_flt_str(scanf_context_t *context, void *addr, uint16_t flags)
+{
+    const CHAR *s = (const CHAR *)context->str;
+    CHAR       *end;
+    int         save_errno = errno;
+
+    (void)flags;
+
+    /* Keep strtod's ERANGE out of errno, conv_flt never sets it */
+    if (CHECK_LONG_LONG()) {
+        long double ld = STRTOLD_STR(s, &end);
+        if (addr && end != s)
+            *(long double *)addr = ld;
+    } else if (CHECK_LONG()) {
+        double d = STRTOD_STR(s, &end);
+        if (addr && end != s)
+            *(double *)addr = d;
+    } else {
+        float f = STRTOF_STR(s, &end);
+        if (addr && end != s)
+            *(float *)addr = f;
+    }
+    errno = save_errno;
+
+    if (end == s)
+        return 0;
+    context->str += end - s;
+    scanf_len(context) += end - s;
+    return 1;
+}
+#endif
 #endif
 
 static INT
@@ -443,21 +543,37 @@ skip_spaces(FILE *stream, scanf_context_t *context)
 
 typedef struct {
     va_list ap;
+    int     count;          /* pointers collected, -1 before the first '$' */
+    va_list walk;           /* the next argument to collect */
+    void   *pos[NL_ARGMAX]; /* the pointers collected so far */
 } my_va_list;
 
-static void
-skip_to_arg(my_va_list *ap, int target_argno)
+/*
+ * Fortunately, all scanf args are pointers, and so are the same size
+ * as void *. Collect them into a table as the format reaches them, so
+ * each one is fetched from the va_list only once however the
+ * positions are ordered.
+ */
+static void *
+pos_arg(my_va_list *ap, va_list ap_orig, int target_argno)
 {
-    int current_argno = 1;
-
-    /*
-     * Fortunately, all scanf args are pointers,
-     * and so are the same size as void *
-     */
-    while (current_argno < target_argno) {
-        (void)va_arg(ap->ap, void *);
-        current_argno++;
+    if (ap->count < 0) {
+        va_copy(ap->walk, ap_orig);
+        ap->count = 0;
     }
+    if (target_argno < 1 || target_argno > NL_ARGMAX)
+        return NULL;
+    while (ap->count < target_argno)
+        ap->pos[ap->count++] = va_arg(ap->walk, void *);
+    return ap->pos[target_argno - 1];
+}
+
+static void
+end_args(my_va_list *ap)
+{
+    if (ap->count >= 0)
+        va_end(ap->walk);
+    va_end(ap->ap);
 }
 
 #endif
@@ -604,8 +720,10 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
     void         *addr;
 #ifdef _NEED_IO_POS_ARGS
     my_va_list my_ap;
+    int        argno;
 #define ap my_ap.ap
     va_copy(ap, ap_orig);
+    my_ap.count = -1;
 #else
 #define ap ap_orig
 #endif
@@ -614,6 +732,7 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
     scanf_context_t context = SCANF_CONTEXT_INIT;
 
     __flockfile(stream);
+    scanf_str_begin(stream, &context);
 
     nconvs = 0;
 
@@ -636,6 +755,9 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 
         } else {
             flags = 0;
+#ifdef _NEED_IO_POS_ARGS
+            argno = 0;
+#endif
 
             if (c == '*') {
                 flags = FL_STAR;
@@ -654,9 +776,7 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 #ifdef _NEED_IO_POS_ARGS
                     if (c == '$') {
                         flags &= ~FL_WIDTH;
-                        va_end(ap);
-                        va_copy(ap, ap_orig);
-                        skip_to_arg(&my_ap, width);
+                        argno = width;
                         c = *fmt++;
                         continue;
                     }
@@ -737,7 +857,12 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
             if (!c || !strchr(CNV_LIST, c))
                 break;
 
-            addr = (flags & FL_STAR) ? 0 : va_arg(ap, void *);
+#ifdef _NEED_IO_POS_ARGS
+            if (argno)
+                addr = (flags & FL_STAR) ? 0 : pos_arg(&my_ap, ap_orig, argno);
+            else
+#endif
+                addr = (flags & FL_STAR) ? 0 : va_arg(ap, void *);
 
             if (c == 'n') {
                 putval(addr, (unsigned)scanf_len(&context), flags);
@@ -828,6 +953,12 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
                     break;
 
                 default: /* a,A,e,E,f,F,g,G */
+#ifdef _NEED_IO_FLT_STR
+                    if (context.str && width == (width_t)~0) {
+                        c = conv_flt_str(&context, addr, flags);
+                        break;
+                    }
+#endif
                     c = conv_flt(stream, &context, width, addr, flags);
                     break;
 #else
@@ -871,8 +1002,9 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
         } /* else */
     } /* while */
 #ifdef _NEED_IO_POS_ARGS
-    va_end(ap);
+    end_args(&my_ap);
 #endif
+    scanf_str_end(stream, &context);
 #ifdef WIDE_CHARS
     if (!IS_EOF(context.unget))
         UNGETC(context.unget, stream);
@@ -881,8 +1013,9 @@ vfscanf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 
 eof:
 #ifdef _NEED_IO_POS_ARGS
-    va_end(ap);
+    end_args(&my_ap);
 #endif
+    scanf_str_end(stream, &context);
 #ifdef WIDE_CHARS
     if (!IS_EOF(context.unget))
         UNGETC(context.unget, stream);
@@ -38,9 +38,12 @@ vsnprintf(char *s, size_t n, const char *fmt, va_list ap)
     struct __file_str f;
     f.file.unget = 0;
     f.file.flags = __SWR;
-    f.file.put = __file_str_put;
+    /* With no room at all, vfprintf just measures */
+    f.file.put = n ? __file_str_put : NULL;
     f.file.get = NULL;
     f.file.flush = NULL;
+    f.file.put_span = n ? __file_str_put_span : NULL;
+    f.file.get_span = NULL;
 #ifdef __STDIO_LOCKING
     __flockfile_init(&f.file);
 #endif
@@ -40,6 +40,8 @@ vsprintf(char *s, const char *fmt, va_list ap)
     f.file.put = __file_str_put;
     f.file.get = NULL;
     f.file.flush = NULL;
+    f.file.put_span = __file_str_put_span;
+    f.file.get_span = NULL;
 #ifdef __STDIO_LOCKING
     __flockfile_init(&f.file);
 #endif
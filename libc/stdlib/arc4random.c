@@ -170,8 +170,20 @@ _rs_random_buf(void *_buf, size_t n)
             n -= m;
             rs->rs_have -= m;
         }
-        if (rs->rs_have == 0)
+        if (rs->rs_have == 0) {
+            /*
+             * Generate whole blocks of a large request straight into
+             * the caller's buffer rather than through rs_buf; the
+             * rekey which follows still erases the key they came from.
+             */
+            if (n >= RSBUFSZ) {
+                m = minimum(n, REKEY_BASE) & ~(size_t)(BLOCKSZ - 1);
+                chacha_encrypt_bytes(&rsx->rs_chacha, buf, buf, (uint32_t)m);
+                buf += m;
+                n -= m;
+            }
             _rs_rekey(NULL, 0);
+        }
     }
 }
 
@@ -31,11 +31,13 @@
 
 /*
  * Implement calloc by multiplying sizes (with overflow check) and
- * calling malloc (which already sets to zero)
+ * calling malloc. Unless malloc already clears everything, zero the
+ * result here, skipping any part that is fresh from sbrk when that
+ * memory is known to be zero.
  */
 
 void *
-calloc(size_t n, size_t elem)
+MALLOC_TRACED(calloc)(size_t n, size_t elem)
 {
     size_t bytes;
 
@@ -43,5 +45,41 @@ calloc(size_t n, size_t elem)
         errno = ENOMEM;
         return NULL;
     }
+#ifdef __MALLOC_CLEAR_ALLOCATED
     return malloc(bytes);
+#else
+    char *ptr;
+#ifdef __MALLOC_SBRK_ZERO
+    char *clean;
+
+    MALLOC_LOCK;
+    clean = __malloc_sbrk_clean;
+    ptr = malloc(bytes);
+    MALLOC_UNLOCK;
+
+    if (ptr && ptr < clean)
+        memset(ptr, '\0', MIN(bytes, (size_t)(clean - ptr)));
+#else
+    ptr = malloc(bytes);
+    if (ptr)
+        memset(ptr, '\0', bytes);
+#endif
+    return ptr;
+#endif
+}
+
+#ifdef __MALLOC_PROFILE
+void *
+calloc(size_t n, size_t elem)
+{
+    void  *ptr;
+    size_t bytes;
+
+    __malloc_trace_enter();
+    ptr = __malloc_untraced_calloc(n, elem);
+    if (mul_overflow(n, elem, &bytes))
+        bytes = SIZE_MAX;
+    __malloc_trace_leave(MALLOC_TRACE_CALLOC, ptr, NULL, bytes, 0);
+    return ptr;
 }
+#endif
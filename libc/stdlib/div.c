@@ -74,14 +74,14 @@ No supporting OS subroutines are required.
  */
 
 #include <stdlib.h> /* div_t */
+#include "local-divmod.h"
 
 div_t
 div(int num, int denom)
 {
     div_t r;
 
-    r.quot = num / denom;
-    r.rem = num % denom;
+    r.quot = __divmod_i(num, denom, &r.rem);
     /*
      * The ANSI standard says that |r.quot| <= |n/d|, where
      * n/d is to be computed in infinite precision.  In other
@@ -0,0 +1,187 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * An open-addressed hash table of environ offsets, so that getenv does
+ * not compare the name against every variable. Each slot holds one
+ * more than the offset of the first variable with a given name, 0
+ * marks an empty slot, and there are always at least twice as many
+ * slots as variables.
+ *
+ * The index describes env_base[0] .. env_base[env_count - 1]. setenv
+ * adds the variables it appends and unsetenv, which moves variables
+ * down, drops the index. A program assigning a new array to environ
+ * changes env_base, and the next lookup rebuilds the index; so does
+ * one which appends to the array in place. Every hit is checked
+ * against the variable itself, so a program editing entries in place
+ * sees at worst a stale miss.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "local-env.h"
+
+#ifdef __GETENV_INDEX
+
+#define ENV_INDEX_MIN 16
+
+static char  **env_base;
+static int     env_count;
+static int    *env_slots;
+static size_t  env_mask;
+
+static size_t
+env_name_len(const char *s)
+{
+    const char *e = s;
+
+    while (*e && *e != '=')
+        e++;
+    return e - s;
+}
+
+static size_t
+env_hash(const char *name, size_t len)
+{
+    uint32_t h = 2166136261U;
+
+    while (len--) {
+        h ^= (unsigned char)*name++;
+        h *= 16777619U;
+    }
+    return h;
+}
+
+/* The slot holding name, or the empty slot where it belongs */
+static size_t
+env_slot(char **env, const char *name, size_t len)
+{
+    size_t i = env_hash(name, len) & env_mask;
+    int    off;
+
+    while ((off = env_slots[i]) != 0) {
+        const char *e = env[off - 1];
+
+        if (!strncmp(e, name, len) && e[len] == '=')
+            break;
+        i = (i + 1) & env_mask;
+    }
+    return i;
+}
+
+static void
+env_insert(char **env, int offset)
+{
+    const char *e = env[offset];
+    size_t      len = env_name_len(e);
+    size_t      i;
+
+    /* Entries without '=' never match */
+    if (e[len] != '=')
+        return;
+    i = env_slot(env, e, len);
+    if (!env_slots[i])
+        env_slots[i] = offset + 1;
+}
+
+static int
+env_build(char **env)
+{
+    size_t size = ENV_INDEX_MIN;
+    int    count, i;
+
+    env_base = NULL;
+    for (count = 0; env[count]; count++)
+        ;
+    /* Leave room for setenv to add a few variables */
+    while (size < 2 * ((size_t)count + 4))
+        size <<= 1;
+    if (!env_slots || size > env_mask + 1) {
+        int *slots = realloc(env_slots, size * sizeof(int));
+
+        if (!slots)
+            return -1;
+        env_slots = slots;
+        env_mask = size - 1;
+    }
+    memset(env_slots, 0, (env_mask + 1) * sizeof(int));
+    for (i = 0; i < count; i++)
+        env_insert(env, i);
+    env_base = env;
+    env_count = count;
+    return 0;
+}
+
+/*
+ * The offset of name in env, -1 if it is not there, or ENV_INDEX_NONE
+ * when there is not enough memory for the index
+ */
+int
+__env_index_find(char **env, const char *name, size_t len)
+{
+    if (env != env_base || env[env_count] != NULL) {
+        if (env_build(env) < 0)
+            return ENV_INDEX_NONE;
+    }
+    return env_slots[env_slot(env, name, len)] - 1;
+}
+
+/*
+ * setenv has stored a new variable at env[offset], just before the
+ * terminator, possibly after moving the array
+ */
+void
+__env_index_add(char **env, int offset)
+{
+    if (!env_base || offset != env_count)
+        env_base = NULL;
+    else if (2 * ((size_t)offset + 1) > env_mask + 1)
+        (void)env_build(env);
+    else {
+        env_base = env;
+        env_count = offset + 1;
+        env_insert(env, offset);
+    }
+}
+
+void
+__env_index_reset(void)
+{
+    env_base = NULL;
+}
+
+#endif /* __GETENV_INDEX */
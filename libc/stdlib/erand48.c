@@ -17,8 +17,29 @@ double
 _erand48_r(struct _rand48 *r, unsigned short xseed[3])
 {
     __dorand48(r, xseed);
+#if __SIZEOF_DOUBLE__ == 8
+    /*
+     * All 48 bits fit in the mantissa, so build x * 2^-48 directly
+     * instead of summing three ldexp results, which costs a handful of
+     * library calls on soft-float targets.
+     */
+    union {
+        uint64_t u;
+        double   d;
+    } v;
+    uint64_t x = (uint64_t)xseed[0] | (uint64_t)xseed[1] << 16 | (uint64_t)xseed[2] << 32;
+    int      lz;
+
+    if (x == 0)
+        return 0.0;
+    lz = __builtin_clzll(x) - 11;
+    /* x << lz has bit 52 set, which carries the exponent up by one */
+    v.u = ((uint64_t)(1023 - 1 + 4 - lz) << 52) + (x << lz);
+    return v.d;
+#else
     return ldexp((double)xseed[0], -48) + ldexp((double)xseed[1], -32)
         + ldexp((double)xseed[2], -16);
+#endif
 }
 
 double
@@ -35,7 +35,6 @@
 
 #define _DEFAULT_SOURCE
 #include <stdlib.h>
-#include <string.h>
 #include <sys/lock.h>
 #include <limits.h>
 #include "local-onexit.h"
@@ -48,22 +47,24 @@ struct on_exit {
     enum pico_onexit_kind kind;
 };
 
+/*
+ * Handlers are kept in registration order in a static table, so
+ * registering one is an append and exit pops them off the top.
+ */
 static struct on_exit on_exits[ATEXIT_MAX];
+static int            on_exit_count;
 
 int
 _on_exit(enum pico_onexit_kind kind, union on_exit_func func, void *arg)
 {
     int ret = -1;
-    int o;
     __LIBC_LOCK();
-    for (o = 0; o < ATEXIT_MAX; o++) {
-        if (on_exits[o].kind == PICO_ONEXIT_EMPTY) {
-            on_exits[o].func = func;
-            on_exits[o].arg = arg;
-            on_exits[o].kind = kind;
-            ret = 0;
-            break;
-        }
+    if (on_exit_count < ATEXIT_MAX) {
+        struct on_exit *o = &on_exits[on_exit_count++];
+        o->func = func;
+        o->arg = arg;
+        o->kind = kind;
+        ret = 0;
     }
     __LIBC_UNLOCK();
     return ret;
@@ -85,20 +86,17 @@ __call_exitprocs(int code, void *param)
 {
     (void)param;
     for (;;) {
-        int                   i;
         union on_exit_func    func = { 0 };
         enum pico_onexit_kind kind = PICO_ONEXIT_EMPTY;
         void                 *arg = 0;
 
+        /* Handlers may register more handlers; those run next */
         __LIBC_LOCK();
-        for (i = ATEXIT_MAX - 1; i >= 0; i--) {
-            kind = on_exits[i].kind;
-            if (kind != PICO_ONEXIT_EMPTY) {
-                func = on_exits[i].func;
-                arg = on_exits[i].arg;
-                memset(&on_exits[i], '\0', sizeof(struct on_exit));
-                break;
-            }
+        if (on_exit_count > 0) {
+            struct on_exit *o = &on_exits[--on_exit_count];
+            kind = o->kind;
+            func = o->func;
+            arg = o->arg;
         }
         __LIBC_UNLOCK();
         switch (kind) {
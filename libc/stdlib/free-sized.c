@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+#if MALLOC_DEBUG
+#include <assert.h>
+#endif
+
+/*
+ * C23 sized deallocation. The chunk header already gives the size
+ * class, and free of a small chunk is O(1) with __MALLOC_SIZE_BINS or
+ * __MALLOC_THREAD_CACHE. The header stays authoritative: chunks malloc
+ * could not split, or that realloc resized in place, are larger than
+ * chunk_size(size), so binning by 'size' alone would corrupt the
+ * bins. With MALLOC_DEBUG the caller's size is checked against it.
+ */
+void
+free_sized(void *ptr, size_t size)
+{
+#if MALLOC_DEBUG
+    if (ptr)
+        assert(size <= chunk_usable(ptr_to_chunk(ptr)));
+#else
+    (void)size;
+#endif
+    __malloc_free(ptr);
+}
+
+void
+free_aligned_sized(void *ptr, size_t alignment, size_t size)
+{
+#if MALLOC_DEBUG
+    assert(((uintptr_t)ptr & (alignment - 1)) == 0);
+#else
+    (void)alignment;
+#endif
+    free_sized(ptr, size);
+}
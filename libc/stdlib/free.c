@@ -35,57 +35,188 @@
  *  When free, insert the to-be-freed chunk_t into free list. The place to
  *  insert should make sure all chunks are sorted by address from low to
  *  high.  Then merge with neighbor chunks if adjacent.
+ *  With __MALLOC_FREE_TREE, the insertion point is found through a
+ *  splay tree over the free chunks instead of walking the list, so
+ *  the cost of free no longer grows with the number of fragments.
+ *  With __MALLOC_SIZE_BINS, small chunks are pushed onto the bin for
+ *  their exact size instead and only reach the address ordered list
+ *  when __malloc_bins_flush runs.
+ *  When the free chunk at the top of the heap grows past
+ *  __malloc_trim_threshold, it is returned to sbrk.
  */
 
+#ifdef __MALLOC_FREE_TREE
+
+/* Root of the splay tree indexing __malloc_free_list by address */
+chunk_t *__malloc_free_tree;
+
+/*
+ * Top-down splay. Rebuilds the tree rooted at 't' so that the node
+ * nearest to 'key' in address order is at the root and returns it.
+ */
+static chunk_t *
+__malloc_tree_splay(chunk_t *t, chunk_t *key)
+{
+    chunk_t  n, *l, *r, *y;
+
+    if (!t)
+        return t;
+    n.left = n.right = NULL;
+    l = r = &n;
+    for (;;) {
+        if (key < t) {
+            if (!t->left)
+                break;
+            if (key < t->left) {
+                /* rotate right */
+                y = t->left;
+                t->left = y->right;
+                y->right = t;
+                t = y;
+                if (!t->left)
+                    break;
+            }
+            /* link right */
+            r->left = t;
+            r = t;
+            t = t->left;
+        } else if (key > t) {
+            if (!t->right)
+                break;
+            if (key > t->right) {
+                /* rotate left */
+                y = t->right;
+                t->right = y->left;
+                y->left = t;
+                t = y;
+                if (!t->right)
+                    break;
+            }
+            /* link left */
+            l->right = t;
+            l = t;
+            t = t->right;
+        } else {
+            break;
+        }
+    }
+    /* assemble */
+    l->right = t->left;
+    r->left = t->right;
+    t->left = n.right;
+    t->right = n.left;
+    return t;
+}
+
 void
-__malloc_free(void *free_p)
+__malloc_tree_insert(chunk_t *c)
 {
-    chunk_t  *p_to_free;
-    chunk_t **p, *r;
+    chunk_t *t = __malloc_tree_splay(__malloc_free_tree, c);
 
-    if (free_p == NULL)
-        return;
+    if (!t) {
+        c->left = c->right = NULL;
+    } else if (c < t) {
+        c->left = t->left;
+        c->right = t;
+        t->left = NULL;
+    } else {
+        c->right = t->right;
+        c->left = t;
+        t->right = NULL;
+    }
+    __malloc_free_tree = c;
+}
 
-    p_to_free = ptr_to_chunk(free_p);
+void
+__malloc_tree_remove(chunk_t *c)
+{
+    chunk_t *t = __malloc_tree_splay(__malloc_free_tree, c);
 
-#ifdef __MALLOC_CLEAR_FREED
-    memset(p_to_free, 0, chunk_usable(p_to_free));
-#else
-    p_to_free->next = NULL;
-#endif
+    __malloc_validate_forget(c, NULL);
+
+    if (!t->left) {
+        __malloc_free_tree = t->right;
+    } else {
+        /* c is larger than everything on the left, so this brings the
+         * largest node there to the top with no right child */
+        chunk_t *x = __malloc_tree_splay(t->left, c);
+        x->right = t->right;
+        __malloc_free_tree = x;
+    }
+}
+
+/* 'new' takes the place of 'old', which must not change the order */
+void
+__malloc_tree_replace(chunk_t *old, chunk_t *new)
+{
+    chunk_t *t = __malloc_tree_splay(__malloc_free_tree, old);
+
+    __malloc_validate_forget(old, new);
+    new->left = t->left;
+    new->right = t->right;
+    __malloc_free_tree = new;
+}
+
+/* Free chunk immediately below 'c', NULL if none */
+static chunk_t *
+__malloc_tree_lower(chunk_t *c)
+{
+    chunk_t *t = __malloc_tree_splay(__malloc_free_tree, c);
+
+    __malloc_free_tree = t;
+    if (!t || t < c)
+        return t;
+    /* Everything below 'c' is on the left; find the largest */
+    t->left = __malloc_tree_splay(t->left, c);
+    return t->left;
+}
 
-#if MALLOC_DEBUG
-    __malloc_validate_block(p_to_free);
 #endif
 
-    MALLOC_LOCK;
+chunk_t **
+__malloc_free_pos(chunk_t *c, chunk_t **prev)
+{
+#ifdef __MALLOC_FREE_TREE
+    chunk_t *r = __malloc_tree_lower(c);
 
-    for (p = &__malloc_free_list; (r = *p) != NULL; p = &r->next) {
-        /* Insert in address order */
-        if (p_to_free <= r) {
+    *prev = r;
+    return r ? &r->next : &__malloc_free_list;
+#else
+    chunk_t **p, *r;
 
-            /* Check for double free */
-            if (p_to_free == r) {
-                errno = ENOMEM;
-                goto unlock;
-            }
+    *prev = NULL;
+    for (p = &__malloc_free_list; (r = *p) != NULL && r < c; p = &r->next)
+        *prev = r;
+    return p;
+#endif
+}
 
-            break;
-        }
+chunk_t *
+__malloc_insert_free(chunk_t *p_to_free)
+{
+    chunk_t **p, *r, *prev;
 
-        /* Merge blocks together */
-        if (chunk_after(r) == p_to_free) {
-            *_size_ref(r) += _size(p_to_free);
-            p_to_free = r;
-            r = r->next;
-            goto no_insert;
-        }
+    /* Insert in address order */
+    p = __malloc_free_pos(p_to_free, &prev);
+    r = *p;
+
+    /* Check for double free */
+    if (p_to_free == r) {
+        errno = ENOMEM;
+        return NULL;
     }
 
-    p_to_free->next = r;
-    *p = p_to_free;
+    __malloc_validate_neighbors(prev, p_to_free, r);
 
-no_insert:
+    if (prev && chunk_after(prev) == p_to_free) {
+        /* Merge blocks together */
+        *_size_ref(prev) += _size(p_to_free);
+        p_to_free = prev;
+    } else {
+        p_to_free->next = r;
+        *p = p_to_free;
+        __malloc_tree_insert(p_to_free);
+    }
 
     /* Merge blocks together */
     if (chunk_after(p_to_free) == r) {
@@ -100,9 +231,118 @@ no_insert:
 #pragma GCC diagnostic pop
 #endif
         p_to_free->next = r->next;
+        __malloc_tree_remove(r);
+    }
+    return p_to_free;
+}
+
+#ifdef __MALLOC_SIZE_BINS
+/*
+ * Move every binned chunk back to __malloc_free_list so that it can
+ * merge with its neighbours. Returns whether anything was moved.
+ * Must be called with MALLOC_LOCK held.
+ */
+bool
+__malloc_bins_flush(void)
+{
+    bool     moved = false;
+    int      bin;
+    chunk_t *r;
+
+    for (bin = 0; bin < MALLOC_NBINS; bin++) {
+        while ((r = __malloc_bins[bin]) != NULL) {
+            __malloc_bins[bin] = r->next;
+            __malloc_insert_free(r);
+            moved = true;
+        }
     }
+    return moved;
+}
+#endif
+
+/* Return a chunk to the heap. Must be called with MALLOC_LOCK held. */
+static void
+__malloc_free_locked(chunk_t *p_to_free)
+{
+    chunk_t *c;
 
-unlock:
+#ifdef __MALLOC_SIZE_BINS
+    int bin = __malloc_bin_index(_size(p_to_free));
+
+    if (bin >= 0) {
+        /* Check for an immediate double free */
+        if (__malloc_bins[bin] == p_to_free) {
+            errno = ENOMEM;
+        } else {
+            p_to_free->next = __malloc_bins[bin];
+            __malloc_bins[bin] = p_to_free;
+        }
+        return;
+    }
+#endif
+
+    /* Give the top of the heap back once enough is free there */
+    c = __malloc_insert_free(p_to_free);
+    if (c && _size(c) > __malloc_trim_threshold && chunk_end(c) == __malloc_sbrk_top)
+        (void)__malloc_trim_locked(__malloc_top_pad);
+}
+
+void
+__malloc_free(void *free_p)
+{
+    chunk_t *p_to_free;
+
+    if (free_p == NULL)
+        return;
+
+    p_to_free = ptr_to_chunk(free_p);
+
+    MALLOC_PROFILE_EVENT(MALLOC_EVENT_FREE, free_p, NULL, chunk_usable(p_to_free),
+                         -(ptrdiff_t)_size(p_to_free), __builtin_return_address(0));
+
+#ifdef __MALLOC_CLEAR_FREED
+    memset(p_to_free, 0, chunk_usable(p_to_free));
+#else
+    p_to_free->next = NULL;
+#endif
+
+#if MALLOC_DEBUG
+    __malloc_validate_block(p_to_free);
+#endif
+
+#ifdef __MALLOC_THREAD_CACHE
+    int tbin = __malloc_bin_index(_size(p_to_free));
+
+    if (tbin >= 0) {
+        /* Check for an immediate double free */
+        if (__malloc_tcache[tbin] == p_to_free) {
+            errno = ENOMEM;
+            return;
+        }
+        if (__malloc_tcache_count[tbin] < MALLOC_TCACHE_MAX) {
+            p_to_free->next = __malloc_tcache[tbin];
+            __malloc_tcache[tbin] = p_to_free;
+            __malloc_tcache_count[tbin]++;
+            return;
+        }
+
+        /* The cache is full, hand a batch back to the heap */
+        MALLOC_LOCK;
+        for (int n = 0; n < MALLOC_TCACHE_BATCH; n++) {
+            chunk_t *c = __malloc_tcache[tbin];
+
+            __malloc_tcache[tbin] = c->next;
+            __malloc_free_locked(c);
+        }
+        __malloc_tcache_count[tbin] -= MALLOC_TCACHE_BATCH;
+        __malloc_free_locked(p_to_free);
+        MALLOC_UNLOCK;
+        return;
+    }
+#endif
+
+    MALLOC_LOCK;
+    __malloc_free_locked(p_to_free);
     MALLOC_UNLOCK;
 }
 
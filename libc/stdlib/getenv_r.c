@@ -56,6 +56,7 @@ permit '=' to be in identifiers.
 #include <stddef.h>
 #include <string.h>
 #include "envlock.h"
+#include "local-env.h"
 
 extern char  **environ;
 
@@ -96,6 +97,19 @@ _findenv(register const char *name, int *offset)
     /* Identifiers may not contain an '=', so cannot match if does */
     if (*c != '=') {
         len = c - name;
+#ifdef __GETENV_INDEX
+        int i = __env_index_find(*p_environ, name, len);
+
+        if (i != ENV_INDEX_NONE) {
+            if (i >= 0) {
+                *offset = i;
+                c = (*p_environ)[i] + len + 1;
+            } else
+                c = NULL;
+            ENV_UNLOCK;
+            return (char *)c;
+        }
+#endif
         for (p = *p_environ; *p; ++p)
             if (!strncmp(*p, name, len))
                 if (*(c = *p + len) == '=') {
@@ -26,15 +26,18 @@
 
 #include <inttypes.h>
 #include <stdint.h>
+#include "local-divmod.h"
 
 /* See comments in div.c for implementation details. */
 imaxdiv_t
 imaxdiv(intmax_t numer, intmax_t denom)
 {
     imaxdiv_t retval;
+    long long rem;
 
-    retval.quot = numer / denom;
-    retval.rem = numer % denom;
+    /* intmax_t is long or long long, so long long holds it */
+    retval.quot = __divmod_ll(numer, denom, &rem);
+    retval.rem = rem;
 #if !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 199901L)
     if (numer >= 0 && retval.rem < 0) {
         retval.quot++;
@@ -74,6 +74,7 @@ No supporting OS subroutines are required.
  */
 
 #include <stdlib.h> /* ldiv_t */
+#include "local-divmod.h"
 
 ldiv_t
 ldiv(long num, long denom)
@@ -82,8 +83,7 @@ ldiv(long num, long denom)
 
     /* see div.c for comments */
 
-    r.quot = num / denom;
-    r.rem = num % denom;
+    r.quot = __divmod_l(num, denom, &r.rem);
     if (num >= 0 && r.rem < 0) {
         ++r.quot;
         r.rem -= denom;
@@ -69,6 +69,7 @@ No supporting OS subroutines are required.
  */
 
 #include <stdlib.h>
+#include "local-divmod.h"
 
 /*
  * The ANSI standard says that |r.quot| <= |n/d|, where
@@ -98,8 +99,7 @@ lldiv(long long numer, long long denom)
 {
     lldiv_t retval;
 
-    retval.quot = numer / denom;
-    retval.rem = numer % denom;
+    retval.quot = __divmod_ll(numer, denom, &retval.rem);
     if (numer >= 0 && retval.rem < 0) {
         retval.quot++;
         retval.rem -= denom;
@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * 64-bit divide and multiply helpers for libc call sites.
+ *
+ * On 32-bit targets every 64-bit '/', '%' and '*' calls a libgcc
+ * routine written for two full 64-bit operands. libc nearly always
+ * divides by a small constant or by a value known to fit in 32 bits
+ * and multiplies by a 32-bit factor, and these helpers do only the
+ * work those cases need:
+ *
+ *  - __udiv64_32 divides by any 32-bit value with one 32-bit divide
+ *    for the high word and a 32-step loop for the low one;
+ *
+ *  - __udiv64_by divides by a constant such as 10, 60, 3600 or 86400.
+ *    The power-of-two factor is shifted out and the rest, which must
+ *    be below 65536, is divided in four 16-bit steps. Each step is a
+ *    32-bit division by a constant, which the compiler turns into a
+ *    multiply by the reciprocal;
+ *
+ *  - __umul32x32 is the 32x32->64 multiply and __umul64x32_overflow
+ *    multiplies a 64-bit value by a 32-bit one using two of them.
+ *
+ * Each falls back to a single 32-bit operation when the high word of
+ * the 64-bit operand is zero.
+ */
+
+#ifndef _LOCAL_DIV64_H_
+#define _LOCAL_DIV64_H_
+
+#include <sys/cdefs.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+static inline uint64_t
+__umul32x32(uint32_t a, uint32_t b)
+{
+    return (uint64_t)a * b;
+}
+
+/* *res = a * b, returning true when the product does not fit */
+static inline bool
+__umul64x32_overflow(uint64_t a, uint32_t b, uint64_t *res)
+{
+    uint32_t ahi = (uint32_t)(a >> 32);
+    uint64_t lo = __umul32x32((uint32_t)a, b);
+    uint64_t hi;
+    uint32_t mid;
+
+    if (!ahi) {
+        *res = lo;
+        return false;
+    }
+    hi = __umul32x32(ahi, b);
+    mid = (uint32_t)(lo >> 32) + (uint32_t)hi;
+    *res = ((uint64_t)mid << 32) | (uint32_t)lo;
+    return (hi >> 32) != 0 || mid < (uint32_t)hi;
+}
+
+/* n / d and n % d for a 32-bit d */
+static inline uint64_t
+__udiv64_32(uint64_t n, uint32_t d, uint32_t *rem)
+{
+    uint32_t hi = (uint32_t)(n >> 32);
+    uint32_t lo = (uint32_t)n;
+    uint32_t qhi = 0;
+    int      i;
+
+    if (!hi) {
+        *rem = lo % d;
+        return lo / d;
+    }
+    if (hi >= d) {
+        qhi = hi / d;
+        hi %= d;
+    }
+    /* hi < d from here on, so each step yields one quotient bit */
+    for (i = 0; i < 32; i++) {
+        uint32_t carry = hi >> 31;
+
+        hi = (hi << 1) | (lo >> 31);
+        lo <<= 1;
+        if (carry || hi >= d) {
+            hi -= d;
+            lo |= 1;
+        }
+    }
+    *rem = hi;
+    return ((uint64_t)qhi << 32) | lo;
+}
+
+/* One 16-bit long division step: r < d < 65536 on entry and exit */
+#define __DIV64_STEP(q, r, digit, d)          \
+    do {                                      \
+        uint32_t __x = ((r) << 16) | (digit); \
+        (q) = __x / (d);                      \
+        (r) = __x - (q) * (d);                \
+    } while (0)
+
+/*
+ * n / d and n % d for a constant d whose odd part is below 65536.
+ * Inline so that d stays a constant in each division.
+ */
+static __always_inline uint64_t
+__udiv64_by(uint64_t n, uint32_t d, uint32_t *rem)
+{
+    unsigned s = (unsigned)__builtin_ctz(d);
+    uint32_t od = d >> s;
+    uint64_t m = n >> s;
+    uint32_t hi = (uint32_t)(m >> 32);
+    uint32_t lo = (uint32_t)m;
+    uint32_t q3, q2, q1, q0, r;
+
+    if (!hi) {
+        q0 = lo / od;
+        r = lo - q0 * od;
+        *rem = (r << s) | ((uint32_t)n & ((1U << s) - 1));
+        return q0;
+    }
+    q3 = (hi >> 16) / od;
+    r = (hi >> 16) - q3 * od;
+    __DIV64_STEP(q2, r, hi & 0xffff, od);
+    __DIV64_STEP(q1, r, lo >> 16, od);
+    __DIV64_STEP(q0, r, lo & 0xffff, od);
+    *rem = (r << s) | ((uint32_t)n & ((1U << s) - 1));
+    return ((uint64_t)((q3 << 16) | q2) << 32) | ((q1 << 16) | q0);
+}
+
+#endif /* _LOCAL_DIV64_H_ */
@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Quotient and remainder from one division.
+ *
+ * Writing n / d and n % d next to each other can cost two division
+ * calls on targets that divide in software: the compiler only merges
+ * them when it has a combined divide-and-modulo pattern, and for
+ * 64-bit operands on 32-bit targets it usually calls __divdi3 and
+ * __moddi3 separately. These helpers divide once and get the
+ * remainder back with a multiply and a subtract.
+ *
+ * Where the runtime is compiler-rt (m65832), unsigned 64-bit division
+ * goes straight to __udivmoddi4, which produces the remainder as it
+ * divides, and the signed versions divide the magnitudes with it.
+ *
+ * For division by a constant the compiler already multiplies by the
+ * reciprocal; the helpers stay inline so that still happens.
+ */
+
+#ifndef _LOCAL_DIVMOD_H_
+#define _LOCAL_DIVMOD_H_
+
+#include <sys/cdefs.h>
+
+#ifdef __m65832__
+#define __HAVE_UDIVMODDI4
+unsigned long long __udivmoddi4(unsigned long long __n, unsigned long long __d,
+                                unsigned long long *__rem);
+#endif
+
+static __always_inline int
+__divmod_i(int n, int d, int *rem)
+{
+    int q = n / d;
+
+    *rem = n - q * d;
+    return q;
+}
+
+static __always_inline long
+__divmod_l(long n, long d, long *rem)
+{
+    long q = n / d;
+
+    *rem = n - q * d;
+    return q;
+}
+
+static __always_inline unsigned long
+__udivmod_ul(unsigned long n, unsigned long d, unsigned long *rem)
+{
+    unsigned long q = n / d;
+
+    *rem = n - q * d;
+    return q;
+}
+
+static __always_inline unsigned long long
+__udivmod_ull(unsigned long long n, unsigned long long d, unsigned long long *rem)
+{
+#ifdef __HAVE_UDIVMODDI4
+    if (!__builtin_constant_p(d))
+        return __udivmoddi4(n, d, rem);
+#endif
+    unsigned long long q = n / d;
+
+    *rem = n - q * d;
+    return q;
+}
+
+static __always_inline long long
+__divmod_ll(long long n, long long d, long long *rem)
+{
+#ifdef __HAVE_UDIVMODDI4
+    if (!__builtin_constant_p(d)) {
+        unsigned long long un = n < 0 ? 0 - (unsigned long long)n : (unsigned long long)n;
+        unsigned long long ud = d < 0 ? 0 - (unsigned long long)d : (unsigned long long)d;
+        unsigned long long ur, uq;
+
+        uq = __udivmoddi4(un, ud, &ur);
+        /* C rounds toward zero: the remainder takes the sign of n */
+        *rem = (long long)(n < 0 ? 0 - ur : ur);
+        return (long long)((n < 0) != (d < 0) ? 0 - uq : uq);
+    }
+#endif
+    long long q = n / d;
+
+    *rem = n - q * d;
+    return q;
+}
+
+#endif /* _LOCAL_DIVMOD_H_ */
@@ -44,24 +44,48 @@
 #include <sys/param.h>
 #include <stdint.h>
 
+/*
+ * MALLOC_DEBUG checks the heap on every MALLOC_LOCK and MALLOC_UNLOCK.
+ * By default that walks every free chunk, which is too slow for long
+ * runs; setting MALLOC_DEBUG_STEP to K checks only the next K chunks
+ * of the free list each time, round robin, plus the list neighbours
+ * of every chunk freed. __malloc_validate still checks everything.
+ */
+#ifndef MALLOC_DEBUG_STEP
+#define MALLOC_DEBUG_STEP 0
+#endif
+
 #if MALLOC_DEBUG
+struct malloc_chunk;
 void __malloc_validate(void);
-void __malloc_validate_block(chunk_t *r);
-#define MALLOC_LOCK          \
-    do {                     \
-        __LIBC_LOCK();       \
-        __malloc_validate(); \
+void __malloc_validate_block(struct malloc_chunk *r);
+void __malloc_validate_neighbors(struct malloc_chunk *prev, struct malloc_chunk *c,
+                                 struct malloc_chunk *next);
+#if MALLOC_DEBUG_STEP > 0
+void __malloc_validate_step(void);
+void __malloc_validate_forget(struct malloc_chunk *old, struct malloc_chunk *new);
+#define __malloc_check_heap() __malloc_validate_step()
+#else
+#define __malloc_check_heap()               __malloc_validate()
+#define __malloc_validate_forget(old, new) ((void)(old), (void)(new))
+#endif
+#define MALLOC_LOCK            \
+    do {                       \
+        __LIBC_LOCK();         \
+        __malloc_check_heap(); \
     } while (0)
-#define MALLOC_UNLOCK        \
-    do {                     \
-        __malloc_validate(); \
-        __LIBC_UNLOCK();     \
+#define MALLOC_UNLOCK          \
+    do {                       \
+        __malloc_check_heap(); \
+        __LIBC_UNLOCK();       \
     } while (0)
 #else
 #define __malloc_validate()
 #define __malloc_validate_block(r)
-#define MALLOC_LOCK   __LIBC_LOCK()
-#define MALLOC_UNLOCK __LIBC_UNLOCK()
+#define __malloc_validate_neighbors(prev, c, next)
+#define __malloc_validate_forget(old, new) ((void)(old), (void)(new))
+#define MALLOC_LOCK                        __LIBC_LOCK()
+#define MALLOC_UNLOCK                      __LIBC_UNLOCK()
 #endif
 
 #if __STDC_VERSION__ >= 201112L
@@ -101,6 +125,10 @@ typedef struct malloc_head {
 
 typedef struct malloc_chunk {
     struct malloc_chunk *next;
+#ifdef __MALLOC_FREE_TREE
+    struct malloc_chunk *left;  /* free chunks at lower addresses */
+    struct malloc_chunk *right; /* free chunks at higher addresses */
+#endif
 } chunk_t;
 
 /* Alignment of allocated chunk. Compute the alignment required from a
@@ -151,7 +179,121 @@ extern char    *__malloc_sbrk_top;
 #else
 #endif
 
-bool __malloc_grow_chunk(chunk_t *c, size_t new_size);
+void *__malloc_sbrk_aligned(size_t s);
+bool  __malloc_grow_chunk(chunk_t *c, size_t new_size);
+void *__malloc_sbrk_block(size_t s);
+
+#if defined(__MALLOC_SIZE_BINS) || defined(__MALLOC_THREAD_CACHE)
+/*
+ * Small chunk size classes. Class 'n' holds chunks of exactly
+ * MALLOC_MINSIZE + n * MALLOC_BIN_STEP bytes.
+ */
+#ifndef MALLOC_NBINS
+#define MALLOC_NBINS 16
+#endif
+
+#define MALLOC_BIN_STEP    MALLOC_CHUNK_ALIGN
+#define MALLOC_BIN_MAXSIZE (MALLOC_MINSIZE + (MALLOC_NBINS - 1) * MALLOC_BIN_STEP)
+
+/* Bin for a chunk of the given size, -1 if it doesn't fit in one */
+static inline int
+__malloc_bin_index(size_t size)
+{
+    if (size > MALLOC_BIN_MAXSIZE || (size - MALLOC_MINSIZE) % MALLOC_BIN_STEP)
+        return -1;
+    return (int)((size - MALLOC_MINSIZE) / MALLOC_BIN_STEP);
+}
+#endif
+
+#ifdef __MALLOC_SIZE_BINS
+/*
+ * Segregated free lists for small chunks, one per size class, so
+ * small allocations and frees are O(1) instead of walking the address
+ * ordered __malloc_free_list. Binned chunks are not merged with their
+ * neighbours until __malloc_bins_flush hands them back to the main
+ * list, which malloc does before growing the heap.
+ */
+extern chunk_t *__malloc_bins[MALLOC_NBINS];
+
+bool __malloc_bins_flush(void);
+#endif
+
+#ifdef __MALLOC_THREAD_CACHE
+/*
+ * Per-thread LIFO caches of small chunks, one per size class. They
+ * are used without MALLOC_LOCK; malloc refills an empty cache with
+ * MALLOC_TCACHE_BATCH chunks at once and free hands MALLOC_TCACHE_BATCH
+ * chunks back once MALLOC_TCACHE_MAX are held. Chunks still cached when a thread exits are not recovered.
+ */
+#ifndef MALLOC_TCACHE_BATCH
+#define MALLOC_TCACHE_BATCH 8
+#endif
+#ifndef MALLOC_TCACHE_MAX
+#define MALLOC_TCACHE_MAX 16
+#endif
+
+extern __THREAD_LOCAL chunk_t *__malloc_tcache[MALLOC_NBINS];
+extern __THREAD_LOCAL int      __malloc_tcache_count[MALLOC_NBINS];
+#endif
+
+/* Insert a chunk into __malloc_free_list, merging with neighbours.
+ * Returns the free chunk now holding it, NULL on a double free.
+ * Must be called with MALLOC_LOCK held.
+ */
+chunk_t  *__malloc_insert_free(chunk_t *p_to_free);
+
+/*
+ * Free space at the top of the heap beyond __malloc_trim_threshold
+ * is handed back to sbrk by free, keeping __malloc_top_pad bytes.
+ * Growing the heap likewise asks sbrk for __malloc_top_pad bytes more
+ * than needed and leaves them free, so that a heap built up by many
+ * small allocations calls sbrk once every __malloc_top_pad bytes.
+ * Both are set through mallopt.
+ */
+#ifndef MALLOC_TRIM_THRESHOLD
+#define MALLOC_TRIM_THRESHOLD (128 * 1024)
+#endif
+
+#ifndef MALLOC_TOP_PAD
+#ifdef __MALLOC_TOP_PAD
+#define MALLOC_TOP_PAD __MALLOC_TOP_PAD
+#else
+#define MALLOC_TOP_PAD 0
+#endif
+#endif
+
+extern size_t __malloc_trim_threshold;
+extern size_t __malloc_top_pad;
+
+/* Release all but 'pad' bytes of free space at the top of the heap
+ * to sbrk, returning whether any was. Must be called with
+ * MALLOC_LOCK held.
+ */
+int __malloc_trim_locked(size_t pad);
+
+/* Find where 'c' belongs in __malloc_free_list: returns the link
+ * holding the first free chunk at or above 'c' and sets *prev to the
+ * free chunk below it, or NULL. Must be called with MALLOC_LOCK held.
+ */
+chunk_t **__malloc_free_pos(chunk_t *c, chunk_t **prev);
+
+#ifdef __MALLOC_FREE_TREE
+/*
+ * Splay tree over the chunks in __malloc_free_list, keyed by address,
+ * used to find list positions in O(log n). Every change to the list
+ * membership must be mirrored here.
+ */
+extern chunk_t *__malloc_free_tree;
+
+void __malloc_tree_insert(chunk_t *c);
+void __malloc_tree_remove(chunk_t *c);
+void __malloc_tree_replace(chunk_t *old, chunk_t *new);
+#else
+/* The incremental MALLOC_DEBUG checks still need to see removals */
+#define __malloc_tree_insert(c)       ((void)(c))
+#define __malloc_tree_remove(c)       __malloc_validate_forget(c, NULL)
+#define __malloc_tree_replace(old, n) __malloc_validate_forget(old, n)
+#endif
 
 /* Work around compiler optimizing away stores to 'size' field before
  * call to free.
@@ -240,3 +382,63 @@ make_free_chunk(chunk_t *c, size_t size)
     _set_size(c, size);
     __malloc_free(chunk_to_ptr(c));
 }
+
+#ifdef __MALLOC_PROFILE
+/*
+ * Record an allocator event for malloc_profile and pass it to the
+ * malloc_set_hook callback. 'delta' is the change in bytes held in
+ * allocated chunks. Must be called without MALLOC_LOCK held.
+ */
+void __malloc_profile_event(int event, void *ptr, void *old, size_t size, ptrdiff_t delta,
+                            void *caller);
+#define MALLOC_PROFILE_EVENT(event, ptr, old, size, delta, caller) \
+    __malloc_profile_event(event, ptr, old, size, delta, caller)
+
+/* Account for a block growing in place. Must be called with MALLOC_LOCK held. */
+void __malloc_profile_adjust(ptrdiff_t delta);
+#define MALLOC_PROFILE_ADJUST(delta) __malloc_profile_adjust(delta)
+
+/*
+ * malloc_trace records each call made by the application once. calloc,
+ * realloc and memalign are built as __malloc_untraced_NAME and wrapped
+ * by functions which record the call; the malloc and free events they
+ * cause inside are nested and left out. Plain malloc and free calls are
+ * recorded from their profile events.
+ */
+#define MALLOC_TRACED(name) __malloc_untraced_##name
+void *__malloc_untraced_calloc(size_t n, size_t elem);
+void *__malloc_untraced_realloc(void *ptr, size_t size);
+void *__malloc_untraced_memalign(size_t align, size_t s);
+void  __malloc_trace_enter(void);
+void  __malloc_trace_leave(int op, void *ptr, void *old, size_t size, size_t align);
+
+/* Set by malloc_trace_start, so that only programs which trace link it */
+extern void (*__malloc_trace_hook)(int op, void *ptr, void *old, size_t size, size_t align);
+#else
+#define MALLOC_PROFILE_EVENT(event, ptr, old, size, delta, caller)
+#define MALLOC_PROFILE_ADJUST(delta)
+#define MALLOC_TRACED(name) name
+#endif
+
+#if defined(__MALLOC_SBRK_ZERO) && !defined(__MALLOC_CLEAR_ALLOCATED)
+/*
+ * Memory from __malloc_sbrk_clean up to __malloc_sbrk_top came from
+ * sbrk and has never been handed out, so it is still zero. Anything
+ * the allocator gives to an application moves the mark up past it, as
+ * does any free chunk carved from fresh memory, such as the top pad,
+ * since its header and links are written there.
+ */
+extern char *__malloc_sbrk_clean;
+
+static inline void
+__malloc_mark_dirty(chunk_t *c)
+{
+    char *e = chunk_end(c);
+
+    if (e > __malloc_sbrk_clean)
+        __malloc_sbrk_clean = e;
+}
+#define MALLOC_MARK_DIRTY(c) __malloc_mark_dirty(c)
+#else
+#define MALLOC_MARK_DIRTY(c) ((void)(c))
+#endif
@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Division-free decimal conversion used by printf and utoa when
+ * picolibc is built with -Dprintf-fast-ultoa=true and
+ * -Dprintf-small-ultoa=false
+ */
+
+#ifndef _LOCAL_UTOA_H_
+#define _LOCAL_UTOA_H_
+
+#include <stdint.h>
+#include "../stdio/ryu/digit_table.h"
+
+/*
+ * Write the decimal digits of val to str, least significant digit
+ * first, and return a pointer past the last one. Digits are produced
+ * two at a time; n / 100 == (n * 0x51eb851f) >> 37 is exact for every
+ * 32-bit n, so no division is needed.
+ */
+static inline char *
+__utoa_dec_invert(uint32_t val, char *str)
+{
+    while (val >= 100) {
+        uint32_t q = (uint32_t)(((uint64_t)val * 0x51eb851fU) >> 37);
+        uint32_t r = val - q * 100;
+
+        *str++ = DIGIT_TABLE[2 * r + 1];
+        *str++ = DIGIT_TABLE[2 * r];
+        val = q;
+    }
+    if (val >= 10) {
+        *str++ = DIGIT_TABLE[2 * val + 1];
+        *str++ = DIGIT_TABLE[2 * val];
+    } else {
+        *str++ = (char)('0' + val);
+    }
+    return str;
+}
+
+#endif /* _LOCAL_UTOA_H_ */
@@ -31,6 +31,10 @@ wctomb_f __ascii_wctomb;
 mbtowc_f __utf8_mbtowc;
 wctomb_f __utf8_wctomb;
 
+int    __utf8_decode(wchar_t *pwc, const unsigned char *s, size_t n);
+size_t __utf8_mbsnrtowcs(wchar_t *dst, const char **src, size_t nms, size_t len);
+size_t __utf8_wcsnrtombs(char *dst, const wchar_t **src, size_t nwc, size_t len);
+
 #ifdef __MB_EXTENDED_CHARSETS_ISO
 extern const uint16_t __iso_8859_conv[14][0x60];
 extern const uint16_t __iso_8859_max[14];
@@ -36,6 +36,11 @@ mallinfo(void)
     size_t          free_size = 0;
     size_t          total_size;
     size_t          ordblks = 0;
+#if defined(__MALLOC_SIZE_BINS) || defined(__MALLOC_THREAD_CACHE)
+    size_t          smblks = 0;
+    size_t          fsmblks = 0;
+    int             bin;
+#endif
     struct mallinfo current_mallinfo;
     memset(&current_mallinfo, 0, sizeof(current_mallinfo));
 
@@ -55,8 +60,32 @@ mallinfo(void)
     for (pf = __malloc_free_list; pf; pf = pf->next) {
         ordblks++;
         free_size += _size(pf);
+        if (chunk_end(pf) == __malloc_sbrk_top)
+            current_mallinfo.keepcost = _size(pf);
     }
 
+#if defined(__MALLOC_SIZE_BINS) || defined(__MALLOC_THREAD_CACHE)
+    for (bin = 0; bin < MALLOC_NBINS; bin++) {
+#ifdef __MALLOC_SIZE_BINS
+        for (pf = __malloc_bins[bin]; pf; pf = pf->next) {
+            smblks++;
+            fsmblks += _size(pf);
+        }
+#endif
+#ifdef __MALLOC_THREAD_CACHE
+        /* Only the calling thread's cache is visible */
+        for (pf = __malloc_tcache[bin]; pf; pf = pf->next) {
+            smblks++;
+            fsmblks += _size(pf);
+        }
+#endif
+    }
+    /* ordblks counts only the address ordered list */
+    free_size += fsmblks;
+    current_mallinfo.smblks = smblks;
+    current_mallinfo.fsmblks = fsmblks;
+#endif
+
     current_mallinfo.ordblks = ordblks;
     current_mallinfo.arena = total_size;
     current_mallinfo.fordblks = free_size;
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+/*
+ * Arenas.
+ *
+ * An arena is a single region of memory handed out by bumping a
+ * pointer. Nothing is freed individually; the whole region is
+ * recycled by malloc_arena_rewind or malloc_arena_reset. The arena
+ * header lives at the start of the region, so creating one from a
+ * caller-supplied buffer needs no heap at all. Regions taken from the
+ * heap come from __malloc_sbrk_block and are released with free.
+ */
+
+struct malloc_arena {
+    char *base; /* first usable byte */
+    char *pos;  /* next free byte */
+    char *end;  /* end of region */
+    bool  heap; /* region was allocated by malloc_arena_create */
+};
+
+#define ARENA_HEAD __align_up(sizeof(struct malloc_arena), MALLOC_CHUNK_ALIGN)
+
+struct malloc_arena *
+malloc_arena_create(void *buf, size_t size)
+{
+    struct malloc_arena *arena;
+    char                *region;
+    char                *end;
+
+    if (buf) {
+        region = (char *)__align_up((uintptr_t)buf, MALLOC_CHUNK_ALIGN);
+        end = (char *)buf + size;
+        if (region > end || (size_t)(end - region) < ARENA_HEAD) {
+            errno = EINVAL;
+            return NULL;
+        }
+    } else {
+        if (size > MALLOC_MAXSIZE - ARENA_HEAD) {
+            errno = ENOMEM;
+            return NULL;
+        }
+        region = __malloc_sbrk_block(ARENA_HEAD + size);
+        if (!region)
+            return NULL;
+        end = region + ARENA_HEAD + size;
+    }
+
+    arena = (struct malloc_arena *)region;
+    arena->base = region + ARENA_HEAD;
+    arena->pos = arena->base;
+    arena->end = end;
+    arena->heap = buf == NULL;
+    return arena;
+}
+
+void *
+malloc_arena_alloc(struct malloc_arena *arena, size_t size, size_t align)
+{
+    uintptr_t pos;
+
+    if (align == 0)
+        align = MALLOC_CHUNK_ALIGN;
+    if (align & (align - 1)) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    pos = __align_up((uintptr_t)arena->pos, align);
+    if (pos < (uintptr_t)arena->pos || pos > (uintptr_t)arena->end
+        || size > (size_t)((uintptr_t)arena->end - pos)) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    arena->pos = (char *)pos + size;
+    return (void *)pos;
+}
+
+size_t
+malloc_arena_mark(struct malloc_arena *arena)
+{
+    return (size_t)(arena->pos - arena->base);
+}
+
+void
+malloc_arena_rewind(struct malloc_arena *arena, size_t mark)
+{
+    if (mark <= (size_t)(arena->pos - arena->base))
+        arena->pos = arena->base + mark;
+}
+
+void
+malloc_arena_reset(struct malloc_arena *arena)
+{
+    arena->pos = arena->base;
+}
+
+void
+malloc_arena_destroy(struct malloc_arena *arena)
+{
+    if (arena && arena->heap)
+        free(arena);
+}
+
+/* Unused space at the end of the arena, for malloc_arena_vasprintf */
+char *
+__malloc_arena_tail(struct malloc_arena *arena, size_t *avail)
+{
+    *avail = (size_t)(arena->end - arena->pos);
+    return arena->pos;
+}
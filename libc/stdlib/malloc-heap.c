@@ -0,0 +1,233 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+/*
+ * Independent heaps.
+ *
+ * A heap manages a caller-supplied region with the same chunks as
+ * malloc: a size word before each block, free chunks kept on a list
+ * in address order, first fit with the remainder split off, and
+ * neighbours merged on release. The heap header lives at the start of
+ * the region, followed by a single free chunk covering the rest; the
+ * region never grows. Each heap has its own lock and never touches
+ * __malloc_free_list or MALLOC_LOCK, so heaps neither share
+ * fragmentation with malloc nor wait for it.
+ */
+
+struct malloc_heap {
+    chunk_t *free_list; /* free chunks in address order */
+    char    *start;     /* first chunk header */
+    char    *end;       /* end of the last chunk */
+    size_t   in_use;    /* bytes in allocated chunks */
+    size_t   peak;
+#ifndef __SINGLE_THREAD
+    _LOCK_T lock;
+#endif
+};
+
+#ifdef __SINGLE_THREAD
+#define HEAP_LOCK(heap)   ((void)(heap))
+#define HEAP_UNLOCK(heap) ((void)(heap))
+#else
+#define HEAP_LOCK(heap)   __lock_acquire((heap)->lock)
+#define HEAP_UNLOCK(heap) __lock_release((heap)->lock)
+#endif
+
+#define HEAP_HEAD __align_up(sizeof(struct malloc_heap), MALLOC_CHUNK_ALIGN)
+
+struct malloc_heap *
+malloc_heap_create(void *buf, size_t size)
+{
+    struct malloc_heap *heap;
+    char               *region, *blob, *end;
+    chunk_t            *c;
+
+    region = (char *)__align_up((uintptr_t)buf, MALLOC_CHUNK_ALIGN);
+    end = (char *)buf + size;
+    if (!buf || region > end || (size_t)(end - region) < HEAP_HEAD) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    /* Place the first header so the storage after it is chunk aligned */
+    blob = (char *)(__align_up((uintptr_t)region + HEAP_HEAD + MALLOC_HEAD, MALLOC_CHUNK_ALIGN)
+                    - MALLOC_HEAD);
+    if (blob > end || (size_t)(end - blob) < MALLOC_MINSIZE) {
+        errno = EINVAL;
+        return NULL;
+    }
+    size = __align_down((size_t)(end - blob), MALLOC_CHUNK_ALIGN);
+
+    heap = (struct malloc_heap *)region;
+    c = blob_to_chunk(blob);
+    _set_size(c, size);
+    c->next = NULL;
+    heap->free_list = c;
+    heap->start = blob;
+    heap->end = blob + size;
+    heap->in_use = 0;
+    heap->peak = 0;
+#ifndef __SINGLE_THREAD
+    heap->lock = NULL;
+    __lock_init(heap->lock);
+#endif
+    return heap;
+}
+
+void
+malloc_heap_destroy(struct malloc_heap *heap)
+{
+#ifndef __SINGLE_THREAD
+    if (heap)
+        __lock_close(heap->lock);
+#else
+    (void)heap;
+#endif
+}
+
+/* First fit, as in malloc */
+void *
+malloc_heap_alloc(struct malloc_heap *heap, size_t s)
+{
+    chunk_t **p, *r;
+    size_t    alloc_size;
+
+    if (s > MALLOC_MAXSIZE) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    alloc_size = chunk_size(s);
+
+    HEAP_LOCK(heap);
+    for (p = &heap->free_list; (r = *p) != NULL; p = &r->next) {
+        if (_size(r) >= alloc_size) {
+            size_t rem = _size(r) - alloc_size;
+
+            if (rem >= MALLOC_MINSIZE) {
+                chunk_t *s = (chunk_t *)((char *)r + alloc_size);
+                _set_size(s, rem);
+                s->next = r->next;
+                *p = s;
+                _set_size(r, alloc_size);
+            } else {
+                *p = r->next;
+            }
+            heap->in_use += _size(r);
+            if (heap->in_use > heap->peak)
+                heap->peak = heap->in_use;
+            break;
+        }
+    }
+    HEAP_UNLOCK(heap);
+
+    if (!r) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    return chunk_to_ptr(r);
+}
+
+/* Address ordered insertion with merging, as in free */
+void
+malloc_heap_free(struct malloc_heap *heap, void *ptr)
+{
+    chunk_t **p, *r, *prev = NULL, *c;
+
+    if (ptr == NULL)
+        return;
+    c = ptr_to_chunk(ptr);
+    if ((char *)chunk_to_blob(c) < heap->start || (char *)chunk_end(c) > heap->end) {
+        errno = EINVAL;
+        return;
+    }
+
+    HEAP_LOCK(heap);
+    for (p = &heap->free_list; (r = *p) != NULL && r < c; p = &r->next)
+        prev = r;
+
+    /* Double free, or a chunk overlapping a free one */
+    if (c == r || (prev && (char *)chunk_end(prev) > (char *)chunk_to_blob(c))
+        || (r && (char *)chunk_end(c) > (char *)chunk_to_blob(r))) {
+        HEAP_UNLOCK(heap);
+        errno = ENOMEM;
+        return;
+    }
+
+    heap->in_use -= _size(c);
+    if (prev && chunk_after(prev) == c) {
+        *_size_ref(prev) += _size(c);
+        c = prev;
+    } else {
+        c->next = r;
+        *p = c;
+    }
+    if (r && chunk_after(c) == r) {
+        *_size_ref(c) += _size(r);
+        c->next = r->next;
+    }
+    HEAP_UNLOCK(heap);
+}
+
+/* Largest request chunk_size fits in 'size' bytes */
+static size_t
+heap_request_max(size_t size)
+{
+    size_t over = MALLOC_HEAD + (MALLOC_CHUNK_ALIGN - MALLOC_HEAD_ALIGN);
+
+    return size < over ? 0 : __align_down(size - over, MALLOC_CHUNK_ALIGN);
+}
+
+struct malloc_heap_info
+malloc_heap_info(struct malloc_heap *heap)
+{
+    struct malloc_heap_info info;
+    chunk_t                *r;
+
+    memset(&info, 0, sizeof(info));
+    HEAP_LOCK(heap);
+    info.size = (size_t)(heap->end - heap->start);
+    info.in_use = heap->in_use;
+    info.peak = heap->peak;
+    for (r = heap->free_list; r; r = r->next) {
+        info.nfree++;
+        info.free += _size(r);
+        if (heap_request_max(_size(r)) > info.largest)
+            info.largest = heap_request_max(_size(r));
+    }
+    HEAP_UNLOCK(heap);
+    return info;
+}
@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+/*
+ * malloc_info in the glibc XML format. Free chunks are grouped by
+ * the bit width of their size. The heap is snapshotted under the
+ * lock and printed afterwards so that the stream is free to allocate.
+ */
+
+#define MALLOC_INFO_NSIZES (sizeof(size_t) * 8)
+
+struct malloc_info_size {
+    size_t count;
+    size_t total;
+};
+
+static void
+__malloc_info_add(struct malloc_info_size *sizes, size_t size)
+{
+    unsigned bucket = 0;
+
+    while ((size >> bucket) > 1)
+        bucket++;
+    sizes[bucket].count++;
+    sizes[bucket].total += size;
+}
+
+int
+malloc_info(int options, FILE *fp)
+{
+    struct malloc_info_size sizes[MALLOC_INFO_NSIZES];
+    struct mallinfo         mi;
+    chunk_t                *pf;
+    unsigned                bucket;
+
+    if (options != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    memset(sizes, 0, sizeof(sizes));
+
+    MALLOC_LOCK;
+    mi = mallinfo();
+    for (pf = __malloc_free_list; pf; pf = pf->next)
+        __malloc_info_add(sizes, _size(pf));
+#if defined(__MALLOC_SIZE_BINS) || defined(__MALLOC_THREAD_CACHE)
+    for (int bin = 0; bin < MALLOC_NBINS; bin++) {
+#ifdef __MALLOC_SIZE_BINS
+        for (pf = __malloc_bins[bin]; pf; pf = pf->next)
+            __malloc_info_add(sizes, _size(pf));
+#endif
+#ifdef __MALLOC_THREAD_CACHE
+        for (pf = __malloc_tcache[bin]; pf; pf = pf->next)
+            __malloc_info_add(sizes, _size(pf));
+#endif
+    }
+#endif
+    MALLOC_UNLOCK;
+
+    fprintf(fp, "<malloc version=\"1\">\n<heap nr=\"0\">\n<sizes>\n");
+    for (bucket = 0; bucket < MALLOC_INFO_NSIZES; bucket++) {
+        if (!sizes[bucket].count)
+            continue;
+        fprintf(fp, "  <size from=\"%lu\" to=\"%lu\" total=\"%lu\" count=\"%lu\"/>\n",
+                (unsigned long)((size_t)1 << bucket),
+                (unsigned long)(((size_t)2 << bucket) - 1), (unsigned long)sizes[bucket].total,
+                (unsigned long)sizes[bucket].count);
+    }
+    fprintf(fp, "</sizes>\n");
+    fprintf(fp, "<total type=\"fast\" count=\"%lu\" size=\"%lu\"/>\n", (unsigned long)mi.smblks,
+            (unsigned long)mi.fsmblks);
+    fprintf(fp, "<total type=\"rest\" count=\"%lu\" size=\"%lu\"/>\n",
+            (unsigned long)mi.ordblks, (unsigned long)(mi.fordblks - mi.fsmblks));
+    fprintf(fp, "<system type=\"current\" size=\"%lu\"/>\n", (unsigned long)mi.arena);
+    fprintf(fp, "<aspace type=\"total\" size=\"%lu\"/>\n", (unsigned long)mi.arena);
+    fprintf(fp, "</heap>\n");
+#ifdef __MALLOC_PROFILE
+    struct malloc_profile prof;
+
+    malloc_profile(&prof);
+    fprintf(fp,
+            "<profile nmalloc=\"%lu\" nfail=\"%lu\" nfree=\"%lu\" nrealloc=\"%lu\" "
+            "in_use=\"%lu\" peak=\"%lu\">\n",
+            (unsigned long)prof.nmalloc, (unsigned long)prof.nfail, (unsigned long)prof.nfree,
+            (unsigned long)prof.nrealloc, (unsigned long)prof.in_use, (unsigned long)prof.peak);
+    for (bucket = 0; bucket < MALLOC_PROFILE_NHIST; bucket++) {
+        if (!prof.hist[bucket])
+            continue;
+        fprintf(fp, "  <request from=\"%lu\" count=\"%lu\"/>\n",
+                (unsigned long)(bucket ? (size_t)1 << (bucket - 1) : 0),
+                (unsigned long)prof.hist[bucket]);
+    }
+    fprintf(fp, "</profile>\n");
+#endif
+    fprintf(fp, "</malloc>\n");
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+#include "mul_overflow.h"
+
+/*
+ * Fixed-size object pools.
+ *
+ * Each slab is a regular heap chunk holding a link to the next slab
+ * followed by 'count' objects. Free objects are kept on an intrusive
+ * LIFO list threaded through their first word, so allocation and
+ * release never touch the heap free list or MALLOC_LOCK. Slabs come
+ * from __malloc_sbrk_block and malloc_pool_destroy hands them back
+ * with free.
+ */
+
+typedef struct pool_obj {
+    struct pool_obj *next;
+} pool_obj_t;
+
+struct malloc_pool {
+    pool_obj_t *free;    /* available objects */
+    void       *slabs;   /* most recently added slab */
+    size_t      objsize; /* aligned object size */
+    size_t      count;   /* objects per slab */
+    size_t      nslabs;
+    size_t      nfree;
+    size_t      peak;
+};
+
+/* Space for the slab link, keeping the objects chunk aligned */
+#define POOL_SLAB_HEAD __align_up(sizeof(void *), MALLOC_CHUNK_ALIGN)
+
+static bool
+pool_add_slab(struct malloc_pool *pool)
+{
+    size_t bytes;
+    char  *slab;
+    char  *obj;
+
+    if (mul_overflow(pool->count, pool->objsize, &bytes) || bytes > MALLOC_MAXSIZE - POOL_SLAB_HEAD) {
+        errno = ENOMEM;
+        return false;
+    }
+    slab = __malloc_sbrk_block(POOL_SLAB_HEAD + bytes);
+    if (!slab)
+        return false;
+
+    *(void **)slab = pool->slabs;
+    pool->slabs = slab;
+    pool->nslabs++;
+
+    /* Thread the objects so they are handed out in address order */
+    obj = slab + POOL_SLAB_HEAD + bytes;
+    while (obj != slab + POOL_SLAB_HEAD) {
+        obj -= pool->objsize;
+        ((pool_obj_t *)obj)->next = pool->free;
+        pool->free = (pool_obj_t *)obj;
+    }
+    pool->nfree += pool->count;
+    return true;
+}
+
+struct malloc_pool *
+malloc_pool_create(size_t size, size_t count)
+{
+    struct malloc_pool *pool;
+
+    if (count == 0 || size > MALLOC_MAXSIZE) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    pool = malloc(sizeof(*pool));
+    if (!pool)
+        return NULL;
+
+    pool->free = NULL;
+    pool->slabs = NULL;
+    pool->objsize = __align_up(MAX(size, sizeof(pool_obj_t)), MALLOC_CHUNK_ALIGN);
+    pool->count = count;
+    pool->nslabs = 0;
+    pool->nfree = 0;
+    pool->peak = 0;
+
+    if (!pool_add_slab(pool)) {
+        free(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void *
+malloc_pool_alloc(struct malloc_pool *pool)
+{
+    pool_obj_t *obj = pool->free;
+
+    if (!obj) {
+        if (!pool_add_slab(pool))
+            return NULL;
+        obj = pool->free;
+    }
+    pool->free = obj->next;
+    pool->nfree--;
+
+    size_t inuse = pool->nslabs * pool->count - pool->nfree;
+    if (inuse > pool->peak)
+        pool->peak = inuse;
+
+    return obj;
+}
+
+void
+malloc_pool_free(struct malloc_pool *pool, void *ptr)
+{
+    pool_obj_t *obj = ptr;
+
+    if (!obj)
+        return;
+    obj->next = pool->free;
+    pool->free = obj;
+    pool->nfree++;
+}
+
+void
+malloc_pool_destroy(struct malloc_pool *pool)
+{
+    void *slab, *next;
+
+    if (!pool)
+        return;
+    for (slab = pool->slabs; slab; slab = next) {
+        next = *(void **)slab;
+        free(slab);
+    }
+    free(pool);
+}
+
+struct malloc_pool_info
+malloc_pool_info(struct malloc_pool *pool)
+{
+    struct malloc_pool_info info;
+
+    info.objsize = pool->objsize;
+    info.nslabs = pool->nslabs;
+    info.nobjs = pool->nslabs * pool->count;
+    info.nfree = pool->nfree;
+    info.peak = pool->peak;
+    return info;
+}
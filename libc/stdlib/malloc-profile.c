@@ -0,0 +1,163 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+#ifdef __MALLOC_PROFILE
+
+/*
+ * Allocator statistics and the event hook for -Dmalloc-profile. The
+ * counters are updated under MALLOC_LOCK; the hook is called with the
+ * lock released so that it may use stdio or take its own locks.
+ */
+
+static struct malloc_profile __malloc_profile_data;
+static malloc_hook_t         __malloc_hook;
+
+void (*__malloc_trace_hook)(int op, void *ptr, void *old, size_t size, size_t align);
+
+/* Depth of traced calls in progress on this thread */
+static __THREAD_LOCAL unsigned __malloc_trace_nest;
+
+void
+__malloc_trace_enter(void)
+{
+    __malloc_trace_nest++;
+}
+
+void
+__malloc_trace_leave(int op, void *ptr, void *old, size_t size, size_t align)
+{
+    void (*hook)(int, void *, void *, size_t, size_t) = __malloc_trace_hook;
+
+    if (--__malloc_trace_nest == 0 && hook)
+        hook(op, ptr, old, size, align);
+}
+
+static int
+__malloc_profile_bucket(size_t size)
+{
+    int bucket = 0;
+
+    while (size && bucket < MALLOC_PROFILE_NHIST - 1) {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void
+__malloc_profile_adjust(ptrdiff_t delta)
+{
+    struct malloc_profile *prof = &__malloc_profile_data;
+
+    prof->in_use += delta;
+    if (prof->in_use > prof->peak)
+        prof->peak = prof->in_use;
+}
+
+void
+__malloc_profile_event(int event, void *ptr, void *old, size_t size, ptrdiff_t delta, void *caller)
+{
+    struct malloc_profile *prof = &__malloc_profile_data;
+    malloc_hook_t          hook;
+
+    MALLOC_LOCK;
+    switch (event) {
+    case MALLOC_EVENT_MALLOC:
+        if (!ptr) {
+            prof->nfail++;
+            break;
+        }
+        prof->nmalloc++;
+        prof->hist[__malloc_profile_bucket(size)]++;
+        break;
+    case MALLOC_EVENT_FREE:
+        prof->nfree++;
+        break;
+    case MALLOC_EVENT_REALLOC:
+        prof->nrealloc++;
+        break;
+    }
+    __malloc_profile_adjust(delta);
+    hook = __malloc_hook;
+    MALLOC_UNLOCK;
+
+    if (hook)
+        hook(event, ptr, old, size, caller);
+
+    /* Calls from the application; realloc always runs nested */
+    if (!__malloc_trace_nest && __malloc_trace_hook) {
+        if (event == MALLOC_EVENT_MALLOC)
+            __malloc_trace_hook(MALLOC_TRACE_MALLOC, ptr, NULL, size, 0);
+        else if (event == MALLOC_EVENT_FREE)
+            __malloc_trace_hook(MALLOC_TRACE_FREE, ptr, NULL, 0, 0);
+    }
+}
+
+malloc_hook_t
+malloc_set_hook(malloc_hook_t hook)
+{
+    malloc_hook_t old;
+
+    MALLOC_LOCK;
+    old = __malloc_hook;
+    __malloc_hook = hook;
+    MALLOC_UNLOCK;
+    return old;
+}
+
+void
+malloc_profile(struct malloc_profile *profile)
+{
+    MALLOC_LOCK;
+    *profile = __malloc_profile_data;
+    MALLOC_UNLOCK;
+}
+
+/* Clear the counters; peak restarts from the current in_use */
+void
+malloc_profile_reset(void)
+{
+    MALLOC_LOCK;
+    size_t in_use = __malloc_profile_data.in_use;
+
+    memset(&__malloc_profile_data, 0, sizeof(__malloc_profile_data));
+    __malloc_profile_data.in_use = in_use;
+    __malloc_profile_data.peak = in_use;
+    MALLOC_UNLOCK;
+}
+
+#endif /* __MALLOC_PROFILE */
@@ -37,5 +37,13 @@ malloc_stats(void)
     fprintf(stderr, "max system bytes = %10lu\n", (long)current_mallinfo.arena);
     fprintf(stderr, "system bytes     = %10lu\n", (long)current_mallinfo.arena);
     fprintf(stderr, "in use bytes     = %10lu\n", (long)current_mallinfo.uordblks);
-    fprintf(stderr, "free blocks      = %10lu\n", (long)current_mallinfo.ordblks);
+    fprintf(stderr, "free blocks      = %10lu\n",
+            (long)(current_mallinfo.ordblks + current_mallinfo.smblks));
+#ifdef __MALLOC_PROFILE
+    struct malloc_profile prof;
+
+    malloc_profile(&prof);
+    fprintf(stderr, "profiled in use  = %10lu\n", (long)prof.in_use);
+    fprintf(stderr, "profiled peak    = %10lu\n", (long)prof.peak);
+#endif
 }
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+#include <stdint.h>
+
+#ifdef __MALLOC_PROFILE
+
+/*
+ * Allocation trace for malloc_trace_start.
+ *
+ * The trace starts with the four bytes "MTR1", followed by one record
+ * per call: a byte holding the MALLOC_TRACE_ operation, then unsigned
+ * LEB128 numbers:
+ *
+ *   MALLOC, CALLOC   result, size
+ *   FREE             pointer
+ *   REALLOC          result, pointer, size
+ *   MEMALIGN         result, alignment, size
+ *
+ * A pointer is 0 for NULL and otherwise one more than the zigzag
+ * encoded difference from the previous non-NULL pointer in the trace,
+ * which keeps nearby pointers short. A failed call has a NULL result.
+ * calloc records the product of its arguments, SIZE_MAX when that
+ * overflows.
+ *
+ * Records are collected under MALLOC_LOCK in a small buffer which is
+ * handed to the write function when full and by malloc_trace_stop. A
+ * write error ends the trace. The write function runs with the lock
+ * held, so it must not allocate.
+ */
+
+#define MALLOC_TRACE_MAGIC  "MTR1"
+#define MALLOC_TRACE_BUF    256
+/* Longest record: the operation and three 64-bit numbers */
+#define MALLOC_TRACE_RECORD (1 + 3 * 10)
+
+static ssize_t (*__malloc_trace_write)(void *cookie, const void *buf, size_t n);
+static void         *__malloc_trace_cookie;
+static int           __malloc_trace_error;
+static uintptr_t     __malloc_trace_last;
+static size_t        __malloc_trace_len;
+static unsigned char __malloc_trace_buf[MALLOC_TRACE_BUF];
+
+/* Must be called with MALLOC_LOCK held */
+static void
+__malloc_trace_flush(void)
+{
+    const unsigned char *p = __malloc_trace_buf;
+    size_t               len = __malloc_trace_len;
+
+    while (len) {
+        ssize_t r = __malloc_trace_write(__malloc_trace_cookie, p, len);
+        if (r <= 0) {
+            __malloc_trace_error = 1;
+            __malloc_trace_write = NULL;
+            break;
+        }
+        p += r;
+        len -= r;
+    }
+    __malloc_trace_len = 0;
+}
+
+static void
+__malloc_trace_num(uintmax_t v)
+{
+    while (v >= 0x80) {
+        __malloc_trace_buf[__malloc_trace_len++] = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    __malloc_trace_buf[__malloc_trace_len++] = (unsigned char)v;
+}
+
+static void
+__malloc_trace_ptr(void *ptr)
+{
+    uintptr_t u = (uintptr_t)ptr;
+    uintptr_t d = u - __malloc_trace_last;
+
+    if (!ptr) {
+        __malloc_trace_num(0);
+        return;
+    }
+    __malloc_trace_last = u;
+    /* Zigzag: small negative differences become small numbers too */
+    d = (d << 1) ^ ((d >> (sizeof(d) * 8 - 1)) ? ~(uintptr_t)0 : 0);
+    __malloc_trace_num((uintmax_t)d + 1);
+}
+
+static void
+__malloc_trace_record(int op, void *ptr, void *old, size_t size, size_t align)
+{
+    MALLOC_LOCK;
+    if (__malloc_trace_write && __malloc_trace_len > MALLOC_TRACE_BUF - MALLOC_TRACE_RECORD)
+        __malloc_trace_flush();
+    if (__malloc_trace_write) {
+        __malloc_trace_buf[__malloc_trace_len++] = (unsigned char)op;
+        __malloc_trace_ptr(ptr);
+        switch (op) {
+        case MALLOC_TRACE_FREE:
+            break;
+        case MALLOC_TRACE_REALLOC:
+            __malloc_trace_ptr(old);
+            __malloc_trace_num(size);
+            break;
+        case MALLOC_TRACE_MEMALIGN:
+            __malloc_trace_num(align);
+            __malloc_trace_num(size);
+            break;
+        default:
+            __malloc_trace_num(size);
+            break;
+        }
+    }
+    MALLOC_UNLOCK;
+}
+
+int
+malloc_trace_start(ssize_t (*write)(void *cookie, const void *buf, size_t n), void *cookie)
+{
+    int ret;
+
+    if (!write) {
+        errno = EINVAL;
+        return -1;
+    }
+    ret = malloc_trace_stop();
+
+    MALLOC_LOCK;
+    __malloc_trace_write = write;
+    __malloc_trace_cookie = cookie;
+    __malloc_trace_last = 0;
+    memcpy(__malloc_trace_buf, MALLOC_TRACE_MAGIC, 4);
+    __malloc_trace_len = 4;
+    __malloc_trace_hook = __malloc_trace_record;
+    MALLOC_UNLOCK;
+    return ret;
+}
+
+int
+malloc_trace_stop(void)
+{
+    int ret;
+
+    MALLOC_LOCK;
+    __malloc_trace_hook = NULL;
+    if (__malloc_trace_write)
+        __malloc_trace_flush();
+    ret = __malloc_trace_error ? -1 : 0;
+    __malloc_trace_write = NULL;
+    __malloc_trace_error = 0;
+    MALLOC_UNLOCK;
+    return ret;
+}
+
+#endif /* __MALLOC_PROFILE */
@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+size_t __malloc_trim_threshold = MALLOC_TRIM_THRESHOLD;
+size_t __malloc_top_pad = MALLOC_TOP_PAD;
+
+int
+__malloc_trim_locked(size_t pad)
+{
+    chunk_t **p, *top, *prev;
+    size_t    keep, release;
+
+    if (!__malloc_sbrk_top)
+        return 0;
+
+    /* The last free chunk, if it ends at the break */
+    (void)__malloc_free_pos(blob_to_chunk(__malloc_sbrk_top), &top);
+    if (!top || chunk_end(top) != __malloc_sbrk_top)
+        return 0;
+
+    /* Someone else owns the memory past our top */
+    if (sbrk(0) != __malloc_sbrk_top)
+        return 0;
+
+    /* Whatever stays must be a valid chunk ending on an aligned break */
+    keep = 0;
+    if (pad) {
+        keep = __align_up(MAX(pad, MALLOC_MINSIZE), MALLOC_CHUNK_ALIGN);
+        if (keep >= _size(top))
+            return 0;
+    }
+    release = _size(top) - keep;
+
+    if (sbrk(-(ptrdiff_t)release) == (void *)-1)
+        return 0;
+    __malloc_sbrk_top -= release;
+
+    if (keep) {
+        _set_size(top, keep);
+    } else {
+        p = __malloc_free_pos(top, &prev);
+        *p = top->next;
+        __malloc_tree_remove(top);
+    }
+    return 1;
+}
+
+/*
+ * Return free memory at the top of the heap to sbrk, keeping 'pad'
+ * bytes for future allocations. Binned chunks are merged back first
+ * so that they can join the top chunk.
+ */
+int
+malloc_trim(size_t pad)
+{
+    int ret;
+
+    MALLOC_LOCK;
+#ifdef __MALLOC_SIZE_BINS
+    (void)__malloc_bins_flush();
+#endif
+    ret = __malloc_trim_locked(pad);
+    MALLOC_UNLOCK;
+    return ret;
+}
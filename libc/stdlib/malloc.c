@@ -27,14 +27,31 @@
  */
 
 #include "local-malloc.h"
+#include <picofast.h>
 
 /* List list header of free blocks */
-chunk_t *__malloc_free_list;
+chunk_t *__malloc_free_list __libc_fastdata;
+
+#ifdef __MALLOC_SIZE_BINS
+/* Exact-size free lists for small chunks */
+chunk_t *__malloc_bins[MALLOC_NBINS];
+#endif
+
+#ifdef __MALLOC_THREAD_CACHE
+/* Per-thread caches of small chunks, indexed like __malloc_bins */
+__THREAD_LOCAL chunk_t *__malloc_tcache[MALLOC_NBINS];
+__THREAD_LOCAL int      __malloc_tcache_count[MALLOC_NBINS];
+#endif
 
 /* Starting point of memory allocated from system */
 char    *__malloc_sbrk_start;
 char    *__malloc_sbrk_top;
 
+#if defined(__MALLOC_SBRK_ZERO) && !defined(__MALLOC_CLEAR_ALLOCATED)
+/* Start of never-used (and hence zero) memory from sbrk */
+char *__malloc_sbrk_clean;
+#endif
+
 /*
  * Algorithm:
  *   Use sbrk() to obtain more memory and ensure the storage is
@@ -42,7 +59,7 @@ char    *__malloc_sbrk_top;
  *   already aligned - only ask for extra padding after we know we
  *   need it
  */
-static void *
+void *
 __malloc_sbrk_aligned(size_t s)
 {
     char *p, *align_p;
@@ -66,6 +83,17 @@ __malloc_sbrk_aligned(size_t s)
     if (p == (void *)-1)
         return p;
 
+#if defined(__MALLOC_SBRK_ZERO) && !defined(__MALLOC_CLEAR_ALLOCATED)
+    /*
+     * Someone else moved the break; only trust the new memory. Never
+     * lower the mark: when sbrk moves to a region below it, what was
+     * handed out above must stay dirty, and the new memory is just
+     * cleared by calloc as if it had been used.
+     */
+    if (p != __malloc_sbrk_top && p > __malloc_sbrk_clean)
+        __malloc_sbrk_clean = p;
+#endif
+
     __malloc_sbrk_top = (char *)((uintptr_t)p + s);
 
     /* Adjust returned space so that the storage area
@@ -93,6 +121,35 @@ __malloc_sbrk_aligned(size_t s)
     return align_p;
 }
 
+/*
+ * Get s bytes from __malloc_sbrk_aligned, plus __malloc_top_pad when
+ * sbrk can spare them, storing the amount obtained in *got
+ */
+static void *
+__malloc_sbrk_padded(size_t s, size_t *got)
+{
+    size_t pad = __malloc_top_pad;
+    void  *blob;
+
+    if (pad) {
+        /* Make the excess big enough to stand as a free chunk */
+        pad = __align_up(MAX(pad, MALLOC_MINSIZE), MALLOC_CHUNK_ALIGN);
+        if (s + pad > s) {
+            blob = __malloc_sbrk_aligned(s + pad);
+            if (blob != (void *)-1) {
+                *got = s + pad;
+                return blob;
+            }
+        }
+    }
+    *got = s;
+    return __malloc_sbrk_aligned(s);
+}
+
+/*
+ * Grow the chunk ending at the break to at least new_size. With a top
+ * pad it may end up larger; callers split off what they don't need.
+ */
 bool
 __malloc_grow_chunk(chunk_t *c, size_t new_size)
 {
@@ -101,35 +158,42 @@ __malloc_grow_chunk(chunk_t *c, size_t new_size)
     if (chunk_e != __malloc_sbrk_top)
         return false;
     size_t add_size = MAX(MALLOC_MINSIZE, new_size - _size(c));
+    size_t got;
 
     /* Ask for the extra memory needed */
-    char  *heap = __malloc_sbrk_aligned(add_size);
+    char  *heap = __malloc_sbrk_padded(add_size, &got);
 
     /* Check if we got what we wanted */
     if (heap == chunk_e) {
-        /* Set size and return */
-        *_size_ref(c) += add_size;
+        /* Set size and return; callers split off any padding */
+        *_size_ref(c) += got;
+        MALLOC_MARK_DIRTY(c);
         return true;
     }
 
     if (heap != (char *)-1) {
         /* sbrk returned unexpected memory, free it */
-        make_free_chunk((chunk_t *)(heap + MALLOC_HEAD), add_size);
+        chunk_t *extra = blob_to_chunk(heap);
+
+        _set_size(extra, got);
+        MALLOC_MARK_DIRTY(extra);
+        __malloc_insert_free(extra);
     }
     return false;
 }
 
-/** Function malloc
- * Algorithm:
- *   Walk through the free list to find the first match. If fails to find
- *   one, call sbrk to allocate a new chunk_t.
+/*
+ * Allocate a block for a pool or arena. It is taken straight from
+ * sbrk, without searching the free list, while the heap can grow;
+ * after that it comes from malloc. Either way the result is a normal
+ * chunk that can be released with free.
  */
 void *
-malloc(size_t s)
+__malloc_sbrk_block(size_t s)
 {
-    chunk_t **p, *r;
-    char     *ptr;
-    size_t    alloc_size;
+    size_t   alloc_size;
+    void    *blob;
+    chunk_t *r;
 
     if (s > MALLOC_MAXSIZE) {
         errno = ENOMEM;
@@ -139,58 +203,193 @@ malloc(size_t s)
     alloc_size = chunk_size(s);
 
     MALLOC_LOCK;
+    blob = __malloc_sbrk_aligned(alloc_size);
+    if (blob == (void *)-1) {
+        MALLOC_UNLOCK;
+        return malloc(s);
+    }
+    r = blob_to_chunk(blob);
+    _set_size(r, alloc_size);
+    MALLOC_MARK_DIRTY(r);
+    MALLOC_UNLOCK;
+    MALLOC_PROFILE_EVENT(MALLOC_EVENT_MALLOC, chunk_to_ptr(r), NULL, s, _size(r),
+                         __builtin_return_address(0));
+    return chunk_to_ptr(r);
+}
+
+/*
+ * Find or make a chunk of alloc_size bytes, NULL with errno set if
+ * the heap is exhausted. Must be called with MALLOC_LOCK held.
+ */
+static chunk_t *
+__malloc_get_chunk(size_t alloc_size)
+{
+    chunk_t **p, *r;
+
+#ifdef __MALLOC_SIZE_BINS
+    int bin = __malloc_bin_index(alloc_size);
+
+    if (bin >= 0 && (r = __malloc_bins[bin]) != NULL) {
+        __malloc_bins[bin] = r->next;
+        goto done;
+    }
 
+retry:
+#endif
     for (p = &__malloc_free_list; (r = *p) != NULL; p = &r->next) {
-        if (_size(r) >= alloc_size) {
-            size_t rem = _size(r) - alloc_size;
-
-            if (rem >= MALLOC_MINSIZE) {
-                /* Find a chunk_t that much larger than required size, break
-                 * it into two chunks and return the first one
-                 */
-
-                chunk_t *s = (chunk_t *)((char *)r + alloc_size);
-                _set_size(s, rem);
-                s->next = r->next;
-                *p = s;
-
-                _set_size(r, alloc_size);
-            } else {
-                /* Find a chunk_t that is exactly the size or slightly bigger
-                 * than requested size, just return this chunk_t
-                 */
-                *p = r->next;
-            }
-            break;
-        }
-        if (!r->next && __malloc_grow_chunk(r, alloc_size)) {
-            /* Grow the last chunk in memory to the requested size,
-             * just return it
+        /* Grow the last chunk in memory if it ends at the break */
+        if (_size(r) < alloc_size && (r->next || !__malloc_grow_chunk(r, alloc_size)))
+            continue;
+
+        size_t rem = _size(r) - alloc_size;
+
+        if (rem >= MALLOC_MINSIZE) {
+            /* Find a chunk_t that much larger than required size, break
+             * it into two chunks and return the first one
+             */
+
+            chunk_t *s = (chunk_t *)((char *)r + alloc_size);
+            _set_size(s, rem);
+            s->next = r->next;
+            *p = s;
+            __malloc_tree_replace(r, s);
+
+            _set_size(r, alloc_size);
+        } else {
+            /* Find a chunk_t that is exactly the size or slightly bigger
+             * than requested size, just return this chunk_t
              */
             *p = r->next;
-            break;
+            __malloc_tree_remove(r);
         }
+        break;
     }
 
     /* Failed to find a appropriate chunk_t. Ask for more memory */
     if (r == NULL) {
-        void *blob = __malloc_sbrk_aligned(alloc_size);
+#ifdef __MALLOC_SIZE_BINS
+        /* Give binned chunks a chance to merge before growing the heap */
+        if (__malloc_bins_flush())
+            goto retry;
+#endif
+        size_t got;
+        void  *blob = __malloc_sbrk_padded(alloc_size, &got);
 
         /* sbrk returns -1 if fail to allocate */
         if (blob == (void *)-1) {
             errno = ENOMEM;
-            MALLOC_UNLOCK;
             return NULL;
         }
         r = blob_to_chunk(blob);
         _set_size(r, alloc_size);
+        if (got > alloc_size) {
+            /* Keep the top pad as a free chunk for later requests */
+            chunk_t *pad = chunk_after(r);
+
+            _set_size(pad, got - alloc_size);
+            __malloc_insert_free(pad);
+            /* Its header and links are no longer zero */
+            MALLOC_MARK_DIRTY(pad);
+        }
+    }
+
+#ifdef __MALLOC_SIZE_BINS
+done:
+#endif
+    MALLOC_MARK_DIRTY(r);
+    return r;
+}
+
+#ifdef __MALLOC_THREAD_CACHE
+/*
+ * The calling thread's cache for this size class is empty. Fetch a
+ * batch of chunks under a single MALLOC_LOCK, return one and keep the
+ * rest in the cache. Carving the batch from one large chunk looks
+ * attractive but makes every refill search past the small fragments
+ * that first fit would otherwise reuse. Must be called with
+ * MALLOC_LOCK held.
+ */
+static chunk_t *
+__malloc_tcache_refill(int bin, size_t alloc_size)
+{
+    chunk_t *r = __malloc_get_chunk(alloc_size);
+    chunk_t *c;
+    int      n;
+
+    if (!r)
+        return NULL;
+
+    for (n = 0; n < MALLOC_TCACHE_BATCH - 1; n++) {
+        c = __malloc_get_chunk(alloc_size);
+        if (!c)
+            break;
+        c->next = __malloc_tcache[bin];
+        __malloc_tcache[bin] = c;
+        __malloc_tcache_count[bin]++;
+    }
+    return r;
+}
+#endif
+
+/** Function malloc
+ * Algorithm:
+ *   Walk through the free list to find the first match. If fails to find
+ *   one, call sbrk to allocate a new chunk_t.
+ *   With __MALLOC_SIZE_BINS, small requests first try the bin holding
+ *   chunks of exactly the right size.
+ *   With __MALLOC_THREAD_CACHE, small requests are served from a
+ *   per-thread cache without taking MALLOC_LOCK.
+ */
+void *
+malloc(size_t s)
+{
+    chunk_t *r;
+    char    *ptr;
+    size_t   alloc_size;
+
+    if (s > MALLOC_MAXSIZE) {
+        errno = ENOMEM;
+        return NULL;
     }
 
+    alloc_size = chunk_size(s);
+
+#ifdef __MALLOC_THREAD_CACHE
+    int tbin = __malloc_bin_index(alloc_size);
+
+    if (tbin >= 0 && (r = __malloc_tcache[tbin]) != NULL) {
+        __malloc_tcache[tbin] = r->next;
+        __malloc_tcache_count[tbin]--;
+        goto got_chunk;
+    }
+#endif
+
+    MALLOC_LOCK;
+
+#ifdef __MALLOC_THREAD_CACHE
+    if (tbin >= 0)
+        r = __malloc_tcache_refill(tbin, alloc_size);
+    else
+#endif
+        r = __malloc_get_chunk(alloc_size);
+
     MALLOC_UNLOCK;
 
+    if (!r) {
+        MALLOC_PROFILE_EVENT(MALLOC_EVENT_MALLOC, NULL, NULL, s, 0, __builtin_return_address(0));
+        return NULL;
+    }
+
+#ifdef __MALLOC_THREAD_CACHE
+got_chunk:
+#endif
     ptr = chunk_to_ptr(r);
 
+#ifdef __MALLOC_CLEAR_ALLOCATED
     memset(ptr, '\0', alloc_size - MALLOC_HEAD);
+#endif
+
+    MALLOC_PROFILE_EVENT(MALLOC_EVENT_MALLOC, ptr, NULL, s, _size(r), __builtin_return_address(0));
 
     return ptr;
 }
@@ -216,6 +415,59 @@ __malloc_validate_block(chunk_t *r)
     assert(__align_up(_size(r), MALLOC_HEAD_ALIGN) == _size(r));
 }
 
+/* Check a chunk about to join the free list against its neighbours there */
+void
+__malloc_validate_neighbors(chunk_t *prev, chunk_t *c, chunk_t *next)
+{
+    __malloc_validate_block(c);
+    if (prev) {
+        __malloc_validate_block(prev);
+        assert((char *)prev + _size(prev) <= (char *)c);
+    }
+    if (next) {
+        __malloc_validate_block(next);
+        assert((char *)c + _size(c) <= (char *)next);
+    }
+}
+
+#if MALLOC_DEBUG_STEP > 0
+
+/* Next free chunk for __malloc_validate_step, NULL to start over */
+static chunk_t *__malloc_validate_cursor;
+
+/*
+ * Check the next MALLOC_DEBUG_STEP chunks of __malloc_free_list,
+ * wrapping around at the end, so each call costs the same however
+ * large the heap. Binned chunks are only checked by __malloc_validate.
+ */
+void
+__malloc_validate_step(void)
+{
+    chunk_t *r = __malloc_validate_cursor;
+    int      n;
+
+    for (n = 0; n < MALLOC_DEBUG_STEP; n++) {
+        if (!r)
+            r = __malloc_free_list;
+        if (!r)
+            break;
+        __malloc_validate_block(r);
+        assert(r->next == NULL || (char *)r + _size(r) <= (char *)r->next);
+        r = r->next;
+    }
+    __malloc_validate_cursor = r;
+}
+
+/* 'old' is leaving the free list, replaced by 'new' if not NULL */
+void
+__malloc_validate_forget(chunk_t *old, chunk_t *new)
+{
+    if (__malloc_validate_cursor == old)
+        __malloc_validate_cursor = new;
+}
+
+#endif
+
 void
 __malloc_validate(void)
 {
@@ -225,6 +477,42 @@ __malloc_validate(void)
         __malloc_validate_block(r);
         assert(r->next == NULL || (char *)r + _size(r) <= (char *)r->next);
     }
+#ifdef __MALLOC_FREE_TREE
+    /* An in-order (Morris) walk of the tree must match the list */
+    chunk_t *t = __malloc_free_tree, *pre;
+
+    r = __malloc_free_list;
+    while (t) {
+        if (!t->left) {
+            assert(t == r);
+            r = r->next;
+            t = t->right;
+            continue;
+        }
+        for (pre = t->left; pre->right && pre->right != t; pre = pre->right)
+            ;
+        if (!pre->right) {
+            pre->right = t;
+            t = t->left;
+        } else {
+            pre->right = NULL;
+            assert(t == r);
+            r = r->next;
+            t = t->right;
+        }
+    }
+    assert(r == NULL);
+#endif
+#ifdef __MALLOC_SIZE_BINS
+    int bin;
+
+    for (bin = 0; bin < MALLOC_NBINS; bin++) {
+        for (r = __malloc_bins[bin]; r; r = r->next) {
+            __malloc_validate_block(r);
+            assert(__malloc_bin_index(_size(r)) == bin);
+        }
+    }
+#endif
 }
 
 #endif
@@ -28,10 +28,28 @@
 
 #include "local-malloc.h"
 
+/*
+ * Only M_TRIM_THRESHOLD and M_TOP_PAD do anything; a negative trim
+ * threshold turns automatic trimming off. Returns 1 on success and 0
+ * for anything else.
+ */
 int
 mallopt(int parameter_number, int parameter_value)
 {
-    (void)parameter_number;
-    (void)parameter_value;
-    return 0;
+    switch (parameter_number) {
+    case M_TRIM_THRESHOLD:
+        MALLOC_LOCK;
+        __malloc_trim_threshold = parameter_value < 0 ? SIZE_MAX : (size_t)parameter_value;
+        MALLOC_UNLOCK;
+        return 1;
+    case M_TOP_PAD:
+        if (parameter_value < 0)
+            return 0;
+        MALLOC_LOCK;
+        __malloc_top_pad = (size_t)parameter_value;
+        MALLOC_UNLOCK;
+        return 1;
+    default:
+        return 0;
+    }
 }
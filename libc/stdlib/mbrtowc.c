@@ -20,6 +20,19 @@ mbrtowc(wchar_t * __restrict pwc, const char * __restrict s, size_t n, mbstate_t
     }
 #endif
 
+#ifdef __MB_CAPABLE
+    /* Decode UTF-8 directly when starting a new character */
+    if (s != NULL && n != 0 && ps->__count == 0 && __MBTOWC == __utf8_mbtowc) {
+        wchar_t wc;
+        retval = __utf8_decode(&wc, (const unsigned char *)s, n);
+        if (retval >= 0) {
+            if (pwc)
+                *pwc = wc;
+            return (size_t)retval;
+        }
+    }
+#endif
+
     if (s == NULL)
         retval = __MBTOWC(NULL, "", 1, ps);
     else
@@ -60,6 +60,7 @@ PORTABILITY
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
+#include "local.h"
 
 size_t
 mbsnrtowcs(wchar_t *dst, const char **src, size_t nms, size_t len, mbstate_t *ps)
@@ -86,6 +87,19 @@ mbsnrtowcs(wchar_t *dst, const char **src, size_t nms, size_t len, mbstate_t *ps
     }
 
     max = len;
+
+#ifdef __MB_CAPABLE
+    if (ps->__count == 0 && __MBTOWC == __utf8_mbtowc) {
+        const char *start = *src;
+
+        count = __utf8_mbsnrtowcs(ptr, src, nms, len);
+        nms -= *src - start;
+        len -= count;
+        if (dst != NULL)
+            ptr += count;
+    }
+#endif
+
     while (len > 0) {
         bytes = mbrtowc(ptr, *src, nms, ps);
         if (bytes > 0) {
@@ -58,6 +58,17 @@ mbstowcs(wchar_t * __restrict pwcs, const char * __restrict s, size_t n)
     char  *t = (char *)s;
     int    bytes;
 
+    if (__MBTOWC == __utf8_mbtowc) {
+        const char *end = t;
+
+        ret = __utf8_mbsnrtowcs(pwcs, &end, (size_t)-1, pwcs ? n : (size_t)-1);
+        t = (char *)end;
+        if (pwcs) {
+            pwcs += ret;
+            n -= ret;
+        }
+    }
+
     if (!pwcs)
         n = (size_t)1; /* Value doesn't matter as long as it's not 0. */
     while (n > 0) {
@@ -30,38 +30,132 @@
 #include "local-malloc.h"
 
 /*
- * Allocate memory block aligned at specific boundary.
- *   align: required alignment. Must be power of 2. Return NULL
- *          if not power of 2. Undefined behavior is bigger than
- *          pointer value range.
- *   s: required size.
- * Return: allocated memory pointer aligned to align
- * Algorithm: Malloc a big enough block, padding pointer to aligned
- *            address, then truncate and free the tail if too big.
- *            Record the offset of align pointer and original pointer
- *            in the padding area.
+ * Offset from the start of chunk 'c' to the first 'align' aligned
+ * address in it, leaving room for a free chunk in front if it isn't
+ * already aligned.
  */
+static size_t
+__malloc_align_offset(chunk_t *c, size_t align)
+{
+    char  *p = chunk_to_ptr(c);
+    size_t offset = (size_t)((char *)__align_up(p, align) - p);
 
-void *
-memalign(size_t align, size_t s)
+    if (offset && offset < MALLOC_MINSIZE)
+        offset += align;
+    return offset;
+}
+
+/*
+ * Search __malloc_free_list for a chunk holding an aligned block of
+ * alloc_size bytes and carve it out in place. The pieces in front and
+ * behind stay on the list where the original chunk was. Must be
+ * called with MALLOC_LOCK held.
+ */
+static chunk_t *
+__malloc_find_aligned(size_t align, size_t alloc_size)
 {
-    chunk_t *chunk_p;
-    size_t   offset, size_with_padding;
-    char    *allocated, *aligned_p;
+    chunk_t **p, *r, *c, *t = NULL;
 
-    /* Return NULL if align isn't power of 2 */
-    if ((align & (align - 1)) != 0) {
-        errno = EINVAL;
-        return NULL;
+    for (p = &__malloc_free_list; (r = *p) != NULL; p = &r->next) {
+        size_t offset = __malloc_align_offset(r, align);
+        size_t size = alloc_size;
+        size_t rem;
+
+        if (offset > _size(r) || _size(r) - offset < size)
+            continue;
+
+        rem = _size(r) - offset - size;
+        if (rem < MALLOC_MINSIZE) {
+            size += rem;
+            rem = 0;
+        }
+
+        c = (chunk_t *)((char *)r + offset);
+        _set_size(c, size);
+        if (rem) {
+            t = chunk_after(c);
+            _set_size(t, rem);
+        }
+
+        if (offset) {
+            /* r keeps its place with just the front piece */
+            _set_size(r, offset);
+            if (rem) {
+                t->next = r->next;
+                r->next = t;
+                __malloc_tree_insert(t);
+            }
+        } else if (rem) {
+            t->next = r->next;
+            *p = t;
+            __malloc_tree_replace(r, t);
+        } else {
+            *p = r->next;
+            __malloc_tree_remove(r);
+        }
+        return c;
     }
+    return NULL;
+}
 
-    align = MAX(align, MALLOC_MINSIZE);
+/*
+ * Extend the heap by just enough to place an aligned block of
+ * alloc_size bytes at the current break. The piece in front goes to
+ * the free list, where it merges with any free chunk ending at the
+ * old break. Returns NULL, after freeing the new memory, if someone
+ * else moved the break so that the block would not be aligned. Must
+ * be called with MALLOC_LOCK held.
+ */
+static chunk_t *
+__malloc_sbrk_aligned_chunk(size_t align, size_t alloc_size)
+{
+    size_t   offset = 0;
+    chunk_t *r, *c;
+    void    *blob;
 
-    if (s > MALLOC_MAXSIZE - align) {
-        errno = ENOMEM;
+    if (__malloc_sbrk_top)
+        offset = __malloc_align_offset(blob_to_chunk(__malloc_sbrk_top), align);
+
+    if (alloc_size > MALLOC_MAXSIZE - offset)
+        return NULL;
+
+    blob = __malloc_sbrk_aligned(offset + alloc_size);
+    if (blob == (void *)-1)
+        return NULL;
+
+    r = blob_to_chunk(blob);
+    _set_size(r, offset + alloc_size);
+
+    if (__malloc_align_offset(r, align) != offset) {
+        MALLOC_MARK_DIRTY(r);
+        __malloc_insert_free(r);
         return NULL;
     }
 
+    if (!offset)
+        return r;
+
+    c = (chunk_t *)((char *)r + offset);
+    _set_size(c, alloc_size);
+    _set_size(r, offset);
+    __malloc_insert_free(r);
+    return c;
+}
+
+/*
+ * Malloc a big enough block, pad the pointer to an aligned address,
+ * then free the leading fragment and the tail if too big. Used when
+ * neither the free list nor the break can supply an aligned chunk.
+ */
+static void *
+__malloc_memalign_padded(size_t align, size_t s)
+{
+    chunk_t *chunk_p;
+    size_t   offset, size_with_padding;
+    char    *allocated, *aligned_p;
+
+    align = MAX(align, MALLOC_MINSIZE);
+
     s = __align_up(MAX(s, 1), MALLOC_CHUNK_ALIGN);
 
     /* Make sure there's space to align the allocation and split
@@ -105,6 +199,87 @@ memalign(size_t align, size_t s)
     return aligned_p;
 }
 
+/*
+ * Allocate memory block aligned at specific boundary.
+ *   align: required alignment. Must be power of 2. Return NULL
+ *          if not power of 2. Undefined behavior is bigger than
+ *          pointer value range.
+ *   s: required size.
+ * Return: allocated memory pointer aligned to align
+ * Algorithm: Alignments malloc already provides are passed to malloc.
+ *            Otherwise, look for a free chunk that holds an aligned
+ *            block and split it in place, then try extending the
+ *            heap by exactly the padding needed at the break. Only
+ *            if both fail, over-allocate and trim.
+ */
+
+void *
+MALLOC_TRACED(memalign)(size_t align, size_t s)
+{
+    chunk_t *c;
+    size_t   alloc_size;
+    void    *ptr;
+
+    /* Return NULL if align isn't power of 2 */
+    if ((align & (align - 1)) != 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    if (align <= MALLOC_CHUNK_ALIGN)
+        return __malloc_malloc(s);
+
+    if (s > MALLOC_MAXSIZE - align) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    alloc_size = chunk_size(s);
+
+    MALLOC_LOCK;
+    c = __malloc_find_aligned(align, alloc_size);
+#ifdef __MALLOC_SIZE_BINS
+    /*
+     * On a miss, let binned chunks merge with their neighbours and
+     * look again; a freed aligned block is only reusable once it has
+     * rejoined the fragment that was split off in front of it.
+     */
+    if (!c && __malloc_bins_flush())
+        c = __malloc_find_aligned(align, alloc_size);
+#endif
+    if (!c)
+        c = __malloc_sbrk_aligned_chunk(align, alloc_size);
+    if (c)
+        MALLOC_MARK_DIRTY(c);
+    MALLOC_UNLOCK;
+
+    if (!c)
+        return __malloc_memalign_padded(align, s);
+
+    ptr = chunk_to_ptr(c);
+
+#ifdef __MALLOC_CLEAR_ALLOCATED
+    memset(ptr, '\0', chunk_usable(c));
+#endif
+
+    MALLOC_PROFILE_EVENT(MALLOC_EVENT_MALLOC, ptr, NULL, s, _size(c), __builtin_return_address(0));
+
+    return ptr;
+}
+
+#ifdef __MALLOC_PROFILE
+void *
+memalign(size_t align, size_t s)
+{
+    void *ptr;
+
+    __malloc_trace_enter();
+    ptr = __malloc_untraced_memalign(align, s);
+    __malloc_trace_leave(MALLOC_TRACE_MEMALIGN, ptr, NULL, s, align);
+    return ptr;
+}
+#endif
+
 #ifdef __strong_reference
 __strong_reference(memalign, aligned_alloc);
 #endif
@@ -0,0 +1,154 @@
+/*
+FUNCTION
+<<pcg32_seed>>, <<pcg32_next>>, <<pcg32_uniform>>, <<pcg32_fill>>---PCG random numbers
+
+INDEX
+        pcg32_seed
+INDEX
+        pcg32_next
+INDEX
+        pcg32_uniform
+INDEX
+        pcg32_fill
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <stdlib.h>
+        void pcg32_seed(struct pcg32 *<[state]>, uint64_t <[seed]>, uint64_t <[seq]>);
+        uint32_t pcg32_next(struct pcg32 *<[state]>);
+        uint32_t pcg32_uniform(struct pcg32 *<[state]>, uint32_t <[upper_bound]>);
+        void pcg32_fill(struct pcg32 *<[state]>, void *<[buf]>, size_t <[n]>);
+
+DESCRIPTION
+These functions run O'Neill's PCG32 generator (PCG-XSH-RR), a 64-bit
+linear congruential generator whose output is permuted down to 32
+bits. All of the generator state is in *<[state]>, so separate states
+may be used by separate threads without locking. Each step takes a
+64-bit multiplication; on targets without one, the xoshiro128pp
+functions are faster. The output is not suitable for cryptography.
+
+<<pcg32_seed>> starts sequence <[seq]> at position <[seed]>.
+Different values of <[seq]> select different, independent streams,
+which is useful for giving each of several simulations its own.
+
+<<pcg32_next>> returns the next 32 bits of output.
+
+<<pcg32_uniform>> returns a number uniformly distributed in
+[0, <[upper_bound]>), without modulo bias and without division, as
+<<xoshiro128pp_uniform>> does.
+
+<<pcg32_fill>> stores <[n]> bytes of output at <[buf]>.
+
+RETURNS
+<<pcg32_next>> returns a 32-bit random number. <<pcg32_uniform>>
+returns 0 when <[upper_bound]> is less than 2.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbit.h>
+#include <string.h>
+
+#define PCG32_MULT 6364136223846793005ULL
+
+static inline uint32_t
+pcg32_step(uint64_t *state, uint64_t inc)
+{
+    uint64_t old = *state;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    unsigned rot = (unsigned)(old >> 59);
+
+    *state = old * PCG32_MULT + inc;
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+void
+pcg32_seed(struct pcg32 *state, uint64_t seed, uint64_t seq)
+{
+    state->__state = 0;
+    state->__inc = (seq << 1) | 1;
+    (void)pcg32_step(&state->__state, state->__inc);
+    state->__state += seed;
+    (void)pcg32_step(&state->__state, state->__inc);
+}
+
+uint32_t
+pcg32_next(struct pcg32 *state)
+{
+    return pcg32_step(&state->__state, state->__inc);
+}
+
+uint32_t
+pcg32_uniform(struct pcg32 *state, uint32_t upper_bound)
+{
+    int      shift;
+    uint32_t r;
+
+    if (upper_bound < 2)
+        return 0;
+    shift = (int)stdc_leading_zeros((uint32_t)(upper_bound - 1));
+    do
+        r = pcg32_step(&state->__state, state->__inc) >> shift;
+    while (r >= upper_bound);
+    return r;
+}
+
+void
+pcg32_fill(struct pcg32 *state, void *buf, size_t n)
+{
+    unsigned char *b = buf;
+    uint64_t       s = state->__state;
+    uint64_t       inc = state->__inc;
+    uint32_t       r;
+
+    while (n >= sizeof(r)) {
+        r = pcg32_step(&s, inc);
+        memcpy(b, &r, sizeof(r));
+        b += sizeof(r);
+        n -= sizeof(r);
+    }
+    if (n) {
+        r = pcg32_step(&s, inc);
+        memcpy(b, &r, n);
+    }
+    state->__state = s;
+}
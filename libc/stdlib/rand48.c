@@ -136,21 +136,21 @@ __THREAD_LOCAL struct _rand48 _rand48 = {
     ._add = _RAND48_ADD,
 };
 
+/*
+ * x = (a * x + c) mod 2^48 as one 32 x 32 -> 64-bit multiply of the
+ * low words plus two 32-bit multiplies for the cross terms, of which
+ * only the low 16 bits survive. The generic split into 16-bit pieces
+ * needs six multiplies.
+ */
 void
 __dorand48(struct _rand48 *r, unsigned short xseed[3])
 {
-    uint32_t       accu;
-    unsigned short temp[2];
-
-    accu = (uint32_t)r->_mult[0] * (uint32_t)xseed[0] + (uint32_t)r->_add;
-    temp[0] = (unsigned short)accu; /* lower 16 bits */
-    accu >>= sizeof(unsigned short) * 8;
-    accu += (uint32_t)r->_mult[0] * (uint32_t)xseed[1] + (uint32_t)r->_mult[1] * (uint32_t)xseed[0];
-    temp[1] = (unsigned short)accu; /* middle 16 bits */
-    accu >>= sizeof(unsigned short) * 8;
-    accu += (uint32_t)r->_mult[0] * (uint32_t)xseed[2] + (uint32_t)r->_mult[1] * (uint32_t)xseed[1]
-        + (uint32_t)r->_mult[2] * (uint32_t)xseed[0];
-    xseed[0] = temp[0];
-    xseed[1] = temp[1];
-    xseed[2] = (unsigned short)accu;
+    uint32_t xl = (uint32_t)xseed[0] | (uint32_t)xseed[1] << 16;
+    uint32_t al = (uint32_t)r->_mult[0] | (uint32_t)r->_mult[1] << 16;
+    uint64_t lo = (uint64_t)al * xl + r->_add;
+    uint32_t hi = (uint32_t)(lo >> 32) + al * xseed[2] + (uint32_t)r->_mult[2] * xl;
+
+    xseed[0] = (unsigned short)lo;
+    xseed[1] = (unsigned short)(lo >> 16);
+    xseed[2] = (unsigned short)hi;
 }
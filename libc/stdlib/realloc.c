@@ -29,11 +29,12 @@
 #include "local-malloc.h"
 
 /*
- * Implement either by merging adjacent free memory
- * or by calling malloc/memcpy
+ * Implement either by merging adjacent free memory (the chunk after
+ * the block, then if needed the chunk before it, sliding the data
+ * down with memmove) or by calling malloc/memcpy
  */
 void *
-realloc(void *ptr, size_t size)
+MALLOC_TRACED(realloc)(void *ptr, size_t size)
 {
     void *mem;
 
@@ -58,52 +59,83 @@ realloc(void *ptr, size_t size)
 #endif
 
     size_t old_size = _size(p_to_realloc);
+    size_t data_size = old_size - MALLOC_HEAD;
+#ifdef __MALLOC_PROFILE
+    void *old_ptr = ptr;
+#endif
 
     /* See if we can avoid allocating new memory
      * when increasing the size
      */
     if (new_size > old_size) {
-        void *chunk_e = chunk_end(p_to_realloc);
-
         MALLOC_LOCK;
 
-        if (__malloc_grow_chunk(p_to_realloc, new_size)) {
-            /* clear new memory */
-            memset(chunk_e, '\0', new_size - old_size);
-            /* adjust chunk_t size */
-            old_size = new_size;
-        } else {
-            chunk_t **p, *r;
+        if (!__malloc_grow_chunk(p_to_realloc, new_size)) {
+            chunk_t **p, *r, *prev;
+            chunk_t  *next = chunk_after(p_to_realloc);
 
             /* Check to see if there's a chunk_t of free space just past
              * the current block, merge it in in case that's useful
              */
-            for (p = &__malloc_free_list; (r = *p) != NULL; p = &r->next) {
-                if (r == chunk_e) {
-                    size_t r_size = _size(r);
-
-                    /* remove R from the free list */
-                    *p = r->next;
-
-                    /* clear the memory from r */
-                    memset(r, '\0', r_size);
+            p = __malloc_free_pos(next, &prev);
+            r = *p;
+            if (r == next) {
+                /* remove R from the free list */
+                *p = r->next;
+                __malloc_tree_remove(r);
+
+                /* add it's size to our block */
+                _set_size(p_to_realloc, _size(p_to_realloc) + _size(r));
+            }
 
-                    /* add it's size to our block */
-                    old_size += r_size;
-                    _set_size(p_to_realloc, old_size);
-                    break;
+            /* Still not big enough? Try the free chunk just before the
+             * block as well and slide the data down into it
+             */
+            if (_size(p_to_realloc) < new_size && prev && chunk_after(prev) == p_to_realloc
+                && _size(prev) + _size(p_to_realloc) >= new_size) {
+                size_t   total = _size(prev) + _size(p_to_realloc);
+                size_t   rem = total - new_size;
+                chunk_t *c;
+
+                if (rem >= MALLOC_MINSIZE) {
+                    /* Leave the bottom of PREV on the free list */
+                    _set_size(prev, rem);
+                    c = (chunk_t *)((char *)prev + rem);
+                    total = new_size;
+                } else {
+                    /* Take all of PREV */
+                    chunk_t *pp;
+
+                    p = __malloc_free_pos(prev, &pp);
+                    *p = prev->next;
+                    __malloc_tree_remove(prev);
+                    c = prev;
                 }
-                if (p_to_realloc < r)
-                    break;
+                memmove(chunk_to_ptr(c), ptr, data_size);
+                _set_size(c, total);
+                p_to_realloc = c;
+                ptr = chunk_to_ptr(c);
             }
         }
 
+#ifdef __MALLOC_CLEAR_ALLOCATED
+        /* clear new memory */
+        memset((char *)ptr + data_size, '\0', _size(p_to_realloc) - old_size);
+#endif
+        /* adjust chunk_t size */
+        MALLOC_PROFILE_ADJUST((ptrdiff_t)(_size(p_to_realloc) - old_size));
+        old_size = _size(p_to_realloc);
+
         MALLOC_UNLOCK;
     }
 
     if (new_size <= old_size) {
         size_t extra = old_size - new_size;
 
+        /* Any split-off tail is accounted for by its free */
+        MALLOC_PROFILE_EVENT(MALLOC_EVENT_REALLOC, ptr, old_ptr, size, 0,
+                             __builtin_return_address(0));
+
 #ifdef __MALLOC_CLEAR_FREED
         if (extra > MALLOC_HEAD)
             memset((char *)ptr + new_size, 0, extra - MALLOC_HEAD);
@@ -124,8 +156,21 @@ realloc(void *ptr, size_t size)
     if (!mem)
         return NULL;
 
-    memcpy(mem, ptr, old_size - MALLOC_HEAD);
+    memcpy(mem, ptr, data_size);
     free(ptr);
 
     return mem;
 }
+
+#ifdef __MALLOC_PROFILE
+void *
+realloc(void *ptr, size_t size)
+{
+    void *mem;
+
+    __malloc_trace_enter();
+    mem = __malloc_untraced_realloc(ptr, size);
+    __malloc_trace_leave(MALLOC_TRACE_REALLOC, mem, ptr, size, 0);
+    return mem;
+}
+#endif
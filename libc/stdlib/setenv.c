@@ -22,6 +22,7 @@
 #include <string.h>
 #include <errno.h>
 #include <envlock.h>
+#include "local-env.h"
 
 /*
  * setenv --
@@ -43,6 +44,7 @@ setenv(const char *name, const char *value, int rewrite)
     register char *C;
     size_t         l_value;
     int            offset;
+    int            new_slot = 0;
 
     /* Name cannot be NULL, empty, or contain an equal sign.  */
     if (name == NULL || name[0] == '\0' || strchr(name, '=')) {
@@ -87,6 +89,7 @@ setenv(const char *name, const char *value, int rewrite)
         }
         (*p_environ)[cnt + 1] = NULL;
         offset = cnt;
+        new_slot = 1;
     }
     for (C = (char *)name; *C && *C != '='; ++C)
         ; /* no `=' in name */
@@ -100,6 +103,8 @@ setenv(const char *name, const char *value, int rewrite)
         ;
     for (*C++ = '='; (*C++ = *value++) != 0;)
         ;
+    if (new_slot)
+        __env_index_add(*p_environ, offset);
 
     ENV_UNLOCK;
 
@@ -129,6 +134,7 @@ unsetenv(const char *name)
         for (P = &(*p_environ)[offset];; ++P)
             if (!(*P = *(P + 1)))
                 break;
+        __env_index_reset();
     }
 
     ENV_UNLOCK;
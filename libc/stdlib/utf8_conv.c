@@ -0,0 +1,252 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Direct UTF-8 conversions used by mbrtowc and friends when the
+ * current locale is UTF-8, avoiding the per-character dispatch through
+ * __MBTOWC and __WCTOMB and the byte-at-a-time state machine in
+ * __utf8_mbtowc. These only handle the easy cases: complete, valid
+ * sequences starting in the initial shift state. Anything else (NUL,
+ * errors, sequences split across calls, UTF-16 surrogate pairs) is left
+ * for the general code, which produces the same results it always has.
+ */
+
+#include <stdlib.h>
+#include <wchar.h>
+#include <stdint.h>
+#include <limits.h>
+#include "local.h"
+#include "../string/local.h"
+
+#ifdef __MB_CAPABLE
+
+#if ULONG_MAX == 4294967295UL
+#define HIGH_BITS 0x80808080UL
+#else
+#define HIGH_BITS 0x8080808080808080UL
+#endif
+
+typedef unsigned long __attribute__((__may_alias__)) utf8_word_t;
+
+/* Allowed range of the second byte of a sequence */
+enum {
+    SECOND_ANY, /* 80..bf */
+    SECOND_E0,  /* a0..bf, no overlong three byte forms */
+    SECOND_ED,  /* 80..9f, no surrogates */
+    SECOND_F0,  /* 90..bf, no overlong four byte forms */
+    SECOND_F4,  /* 80..8f, nothing past 0x10ffff */
+};
+
+static const uint8_t utf8_second[][2] = {
+    [SECOND_ANY] = { 0x80, 0xbf }, [SECOND_E0] = { 0xa0, 0xbf }, [SECOND_ED] = { 0x80, 0x9f },
+    [SECOND_F0] = { 0x90, 0xbf },  [SECOND_F4] = { 0x80, 0x8f },
+};
+
+#define LEAD(len, second) ((len) | ((second) << 3))
+#define L2                LEAD(2, SECOND_ANY)
+#define L3                LEAD(3, SECOND_ANY)
+#define L4                LEAD(4, SECOND_ANY)
+
+/*
+ * Indexed by lead byte - 0xc0: the sequence length in the low three
+ * bits and the second byte range above them. Zero marks bytes which
+ * never start a sequence (c0, c1, f5..ff).
+ */
+static const uint8_t utf8_lead[0x40] = {
+    0,  0,  L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, /* c0..cf */
+    L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, L2, /* d0..df */
+    LEAD(3, SECOND_E0), L3, L3, L3, L3, L3, L3, L3, L3, L3, L3, L3, L3,
+    LEAD(3, SECOND_ED), L3, L3,                                     /* e0..ef */
+    LEAD(4, SECOND_F0), L4, L4, L4, LEAD(4, SECOND_F4), 0, 0, 0,
+    0,  0,  0,  0,  0,  0,  0,  0, /* f0..ff */
+};
+
+/*
+ * Decode one complete character from the n bytes at s. Returns its
+ * length, 0 for NUL, or -1 when the general decoder has to look at it:
+ * an invalid or truncated sequence, or one which needs a surrogate
+ * pair.
+ */
+int
+__utf8_decode(wchar_t *pwc, const unsigned char *s, size_t n)
+{
+    unsigned c = s[0];
+    unsigned lead, len, i;
+    uint32_t wc;
+
+    if (c < 0x80) {
+        *pwc = (wchar_t)c;
+        return c != 0;
+    }
+    if (c < 0xc0 || (lead = utf8_lead[c - 0xc0]) == 0)
+        return -1;
+    len = lead & 7;
+#if __SIZEOF_WCHAR_T__ == 2
+    if (len == 4)
+        return -1;
+#endif
+    if (n < len)
+        return -1;
+    if (s[1] < utf8_second[lead >> 3][0] || s[1] > utf8_second[lead >> 3][1])
+        return -1;
+    wc = ((c & (0x7f >> len)) << 6) | (s[1] & 0x3f);
+    for (i = 2; i < len; i++) {
+        if ((s[i] & 0xc0) != 0x80)
+            return -1;
+        wc = (wc << 6) | (s[i] & 0x3f);
+    }
+    *pwc = (wchar_t)wc;
+    return (int)len;
+}
+
+/*
+ * Convert up to len characters from the nms bytes at *src, stopping
+ * before anything __utf8_decode won't handle. Aligned runs of ASCII
+ * are checked and widened a word at a time. dst may be NULL to just
+ * count. Advances *src and returns the number of characters converted.
+ */
+size_t
+__utf8_mbsnrtowcs(wchar_t *dst, const char **src, size_t nms, size_t len)
+{
+    const unsigned char *s = (const unsigned char *)*src;
+    size_t               count = 0;
+    unsigned             i;
+    wchar_t              wc;
+    int                  bytes;
+
+    while (count < len && nms) {
+        if (!UNALIGNED_X(s)) {
+            while (len - count >= sizeof(utf8_word_t) && nms >= sizeof(utf8_word_t)) {
+                utf8_word_t w = *(const utf8_word_t *)s;
+
+                if ((w & HIGH_BITS) || DETECT_NULL(w))
+                    break;
+                if (dst)
+                    for (i = 0; i < sizeof(utf8_word_t); i++)
+                        dst[count + i] = (wchar_t)s[i];
+                s += sizeof(utf8_word_t);
+                nms -= sizeof(utf8_word_t);
+                count += sizeof(utf8_word_t);
+            }
+            if (count == len || !nms)
+                break;
+        }
+        bytes = __utf8_decode(&wc, s, nms);
+        if (bytes <= 0)
+            break;
+        if (dst)
+            dst[count] = wc;
+        s += bytes;
+        nms -= bytes;
+        count++;
+    }
+    *src = (const char *)s;
+    return count;
+}
+
+/*
+ * Convert up to nwc characters from *src into at most len bytes,
+ * stopping before NUL, before anything that isn't a valid scalar value
+ * (including surrogates, which the general code pairs up when wchar_t
+ * is UTF-16) and before a character which doesn't fit. Runs of ASCII
+ * are narrowed four at a time. dst may be NULL to just count. Advances
+ * *src and returns the number of bytes stored.
+ */
+size_t
+__utf8_wcsnrtombs(char *dst, const wchar_t **src, size_t nwc, size_t len)
+{
+    const wchar_t *s = *src;
+    unsigned char *d = (unsigned char *)dst;
+    size_t         n = 0;
+    uint32_t       wc;
+    size_t         bytes;
+
+    while (nwc) {
+        while (nwc >= 4 && len - n >= 4) {
+            uint32_t a = (uint32_t)s[0], b = (uint32_t)s[1], c = (uint32_t)s[2],
+                     e = (uint32_t)s[3];
+
+            /* all four in 1..0x7f */
+            if ((a | b | c | e | (a - 1) | (b - 1) | (c - 1) | (e - 1)) >= 0x80)
+                break;
+            if (d) {
+                d[n] = (unsigned char)a;
+                d[n + 1] = (unsigned char)b;
+                d[n + 2] = (unsigned char)c;
+                d[n + 3] = (unsigned char)e;
+            }
+            s += 4;
+            nwc -= 4;
+            n += 4;
+        }
+        if (!nwc)
+            break;
+        wc = (uint32_t)*s;
+        if (wc == 0 || (wc >= 0xd800 && wc <= 0xdfff) || wc > 0x10ffff)
+            break;
+        bytes = wc < 0x80 ? 1 : wc < 0x800 ? 2 : wc < 0x10000 ? 3 : 4;
+        if (len - n < bytes)
+            break;
+        if (d) {
+            switch (bytes) {
+            case 1:
+                d[n] = (unsigned char)wc;
+                break;
+            case 2:
+                d[n] = 0xc0 | (wc >> 6);
+                d[n + 1] = 0x80 | (wc & 0x3f);
+                break;
+            case 3:
+                d[n] = 0xe0 | (wc >> 12);
+                d[n + 1] = 0x80 | ((wc >> 6) & 0x3f);
+                d[n + 2] = 0x80 | (wc & 0x3f);
+                break;
+            default:
+                d[n] = 0xf0 | (wc >> 18);
+                d[n + 1] = 0x80 | ((wc >> 12) & 0x3f);
+                d[n + 2] = 0x80 | ((wc >> 6) & 0x3f);
+                d[n + 3] = 0x80 | (wc & 0x3f);
+                break;
+            }
+        }
+        s++;
+        nwc--;
+        n += bytes;
+    }
+    *src = s;
+    return n;
+}
+
+#endif /* __MB_CAPABLE */
@@ -28,6 +28,11 @@ No supporting OS subroutine calls are required.
 
 #define _DEFAULT_SOURCE
 #include <stdlib.h>
+#include <picolibc.h>
+#if defined(__IO_FAST_ULTOA) && !defined(__IO_SMALL_ULTOA)
+#include "local-utoa.h"
+#define FAST_UTOA
+#endif
 
 char *
 __utoa(unsigned value, char *str, int base)
@@ -45,6 +50,11 @@ __utoa(unsigned value, char *str, int base)
 
     /* Convert to string. Digits are in reverse order.  */
     i = 0;
+#ifdef FAST_UTOA
+    if (base == 10)
+        i = __utoa_dec_invert(value, str) - str;
+    else
+#endif
     do {
         remainder = value % base;
         str[i++] = digits[remainder];
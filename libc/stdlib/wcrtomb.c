@@ -20,6 +20,14 @@ wcrtomb(char * __restrict s, wchar_t wc, mbstate_t * __restrict ps)
     }
 #endif
 
+#ifdef __MB_CAPABLE
+    /* ASCII is the same in UTF-8 */
+    if (s != NULL && (uint32_t)wc < 0x80 && ps->__count == 0 && __WCTOMB == __utf8_wctomb) {
+        *s = (char)wc;
+        return 1;
+    }
+#endif
+
     if (s == NULL)
         retval = __WCTOMB(buf, L'\0', ps);
     else
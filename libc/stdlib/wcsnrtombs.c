@@ -70,7 +70,6 @@ PORTABILITY
 #include <stdio.h>
 #include <errno.h>
 #include "local.h"
-#include "local.h"
 
 size_t
 _wcsnrtombs_l(char *dst, const wchar_t **src, size_t nwc, size_t len, mbstate_t *ps, locale_t loc)
@@ -95,6 +94,20 @@ _wcsnrtombs_l(char *dst, const wchar_t **src, size_t nwc, size_t len, mbstate_t
     n = 0;
     pwcs = (wchar_t *)(*src);
 
+#ifdef __MB_CAPABLE
+    if (ps->__count == 0 && __WCTOMB_L(loc) == __utf8_wctomb) {
+        const wchar_t *end = pwcs;
+
+        n = __utf8_wcsnrtombs(dst, &end, nwc, len);
+        nwc -= end - pwcs;
+        pwcs = (wchar_t *)end;
+        if (dst) {
+            ptr += n;
+            *src = end;
+        }
+    }
+#endif
+
     while (n < len && nwc-- > 0) {
         int    count = ps->__count;
         wint_t wch = ps->__value.__wch;
@@ -62,6 +62,11 @@ wcstombs(char * __restrict s, const wchar_t * __restrict pwcs, size_t n)
 
     if (s == NULL) {
         size_t num_bytes = 0;
+        if (__WCTOMB == __utf8_wctomb) {
+            const wchar_t *end = pwcs;
+            num_bytes = __utf8_wcsnrtombs(NULL, &end, (size_t)-1, (size_t)-1);
+            pwcs = end;
+        }
         while (*pwcs != 0) {
             bytes = __WCTOMB(buff, *pwcs++, &state);
             if (bytes == -1)
@@ -70,6 +75,13 @@ wcstombs(char * __restrict s, const wchar_t * __restrict pwcs, size_t n)
         }
         return num_bytes;
     } else {
+        if (__WCTOMB == __utf8_wctomb) {
+            const wchar_t *end = pwcs;
+            size_t         len = __utf8_wcsnrtombs(s, &end, (size_t)-1, n);
+            pwcs = end;
+            ptr += len;
+            n -= len;
+        }
         while (n > 0) {
             bytes = __WCTOMB(buff, *pwcs, &state);
             if (bytes == -1)
@@ -0,0 +1,173 @@
+/*
+FUNCTION
+<<xoshiro128pp_seed>>, <<xoshiro128pp_next>>, <<xoshiro128pp_uniform>>, <<xoshiro128pp_fill>>---fast non-cryptographic random numbers
+
+INDEX
+        xoshiro128pp_seed
+INDEX
+        xoshiro128pp_next
+INDEX
+        xoshiro128pp_uniform
+INDEX
+        xoshiro128pp_fill
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <stdlib.h>
+        void xoshiro128pp_seed(struct xoshiro128pp *<[state]>, uint64_t <[seed]>);
+        uint32_t xoshiro128pp_next(struct xoshiro128pp *<[state]>);
+        uint32_t xoshiro128pp_uniform(struct xoshiro128pp *<[state]>,
+                                      uint32_t <[upper_bound]>);
+        void xoshiro128pp_fill(struct xoshiro128pp *<[state]>, void *<[buf]>,
+                               size_t <[n]>);
+
+DESCRIPTION
+These functions run the xoshiro128++ generator of Blackman and
+Vigna, which has 128 bits of state and a period of 2^128 - 1, using
+only 32-bit shifts, rotates, additions and exclusive-ors. All of the
+generator state is in *<[state]>, so separate states may be used by
+separate threads without locking. The output is not suitable for
+cryptography; use <<arc4random>> for that.
+
+<<xoshiro128pp_seed>> sets *<[state]> from <[seed]>, expanding it
+with SplitMix64 so that similar seeds give unrelated sequences.
+
+<<xoshiro128pp_next>> returns the next 32 bits of output.
+
+<<xoshiro128pp_uniform>> returns a number uniformly distributed
+in [0, <[upper_bound]>), without modulo bias. It takes the top bits
+of each output, as many as <[upper_bound]> - 1 needs, and draws again
+while the result is out of range, which uses no division or
+multiplication and needs fewer than two draws on average.
+
+<<xoshiro128pp_fill>> stores <[n]> bytes of output at <[buf]>.
+
+RETURNS
+<<xoshiro128pp_next>> returns a 32-bit random number.
+<<xoshiro128pp_uniform>> returns 0 when <[upper_bound]> is less than 2.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbit.h>
+#include <string.h>
+
+static inline uint32_t
+rotl(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+static inline uint32_t
+xoshiro128pp_step(uint32_t *s)
+{
+    uint32_t result = rotl(s[0] + s[3], 7) + s[0];
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 11);
+    return result;
+}
+
+void
+xoshiro128pp_seed(struct xoshiro128pp *state, uint64_t seed)
+{
+    int i;
+
+    /* SplitMix64 never returns zero twice running, so the state is not all zero */
+    for (i = 0; i < 4; i += 2) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        z ^= z >> 31;
+        state->__s[i] = (uint32_t)z;
+        state->__s[i + 1] = (uint32_t)(z >> 32);
+    }
+}
+
+uint32_t
+xoshiro128pp_next(struct xoshiro128pp *state)
+{
+    return xoshiro128pp_step(state->__s);
+}
+
+uint32_t
+xoshiro128pp_uniform(struct xoshiro128pp *state, uint32_t upper_bound)
+{
+    int      shift;
+    uint32_t r;
+
+    if (upper_bound < 2)
+        return 0;
+    shift = (int)stdc_leading_zeros((uint32_t)(upper_bound - 1));
+    do
+        r = xoshiro128pp_step(state->__s) >> shift;
+    while (r >= upper_bound);
+    return r;
+}
+
+void
+xoshiro128pp_fill(struct xoshiro128pp *state, void *buf, size_t n)
+{
+    unsigned char *b = buf;
+    uint32_t       s[4];
+    uint32_t       r;
+
+    /* Work on a copy so the state stays in registers */
+    memcpy(s, state->__s, sizeof(s));
+    while (n >= sizeof(r)) {
+        r = xoshiro128pp_step(s);
+        memcpy(b, &r, sizeof(r));
+        b += sizeof(r);
+        n -= sizeof(r);
+    }
+    if (n) {
+        r = xoshiro128pp_step(s);
+        memcpy(b, &r, n);
+    }
+    memcpy(state->__s, s, sizeof(s));
+}
@@ -29,13 +29,12 @@ DESCRIPTION
         This function compares not more than <[n]> bytes of the
         object pointed to by <[s1]> with the object pointed to by <[s2]>.
 
-        This function is identical to <<memcmp>>.
+        Unlike <<memcmp>>, it only reports whether the objects are
+        equal, so it can stop at the first differing word.
 
 RETURNS
-        The function returns an integer greater than, equal to or
-        less than zero 	according to whether the object pointed to by
-        <[s1]> is greater than, equal to or less than the object
-        pointed to by <[s2]>.
+        The function returns zero if the objects are equal and a
+        non-zero value otherwise.
 
 PORTABILITY
 <<bcmp>> requires no supporting OS subroutines.
@@ -46,10 +45,52 @@ QUICKREF
 
 #include <string.h>
 #include <strings.h>
+#include "local.h"
 
 int
 bcmp(const void *m1, const void *m2, size_t n)
-
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     return memcmp(m1, m2, n);
+#else
+    const unsigned char *s1 = (const unsigned char *)m1;
+    const unsigned char *s2 = (const unsigned char *)m2;
+
+    /* Only equality matters, so stop at the first differing word
+       without looking for the byte inside it.  */
+    if (!TOO_SMALL_BIG_BLOCK(n) && !UNALIGNED_X((uintptr_t)s1 ^ (uintptr_t)s2)) {
+        const unsigned long *a1;
+        const unsigned long *a2;
+
+        while (UNALIGNED_X(s1)) {
+            if (*s1++ != *s2++)
+                return 1;
+            n--;
+        }
+
+        a1 = (const unsigned long *)s1;
+        a2 = (const unsigned long *)s2;
+        while (!TOO_SMALL_BIG_BLOCK(n)) {
+            if ((a1[0] ^ a2[0]) | (a1[1] ^ a2[1]) | (a1[2] ^ a2[2]) | (a1[3] ^ a2[3]))
+                return 1;
+            a1 += 4;
+            a2 += 4;
+            n -= BIG_BLOCK_SIZE;
+        }
+        while (!TOO_SMALL_LITTLE_BLOCK(n)) {
+            if (*a1++ != *a2++)
+                return 1;
+            n -= LITTLE_BLOCK_SIZE;
+        }
+
+        s1 = (const unsigned char *)a1;
+        s2 = (const unsigned char *)a2;
+    }
+
+    while (n--) {
+        if (*s1++ != *s2++)
+            return 1;
+    }
+    return 0;
+#endif
 }
@@ -26,27 +26,10 @@
 
 #define _DEFAULT_SOURCE
 #include <strings.h>
+#include <stdbit.h>
 
 int
 ffsl(long i)
 {
-#if __HAVE_BUILTIN_FFSL
-    return (__builtin_ffsl(i));
-#elif __HAVE_BUILTIN_CTZL
-    if (i == 0)
-        return 0;
-    return __builtin_ctzl((unsigned long)i) + 1;
-#else
-    int r;
-
-    if (!i)
-        return 0;
-
-    r = 0;
-    for (;;) {
-        if (((1L << r++) & i) != 0)
-            return r;
-    }
-    return 0;
-#endif
+    return (int)stdc_first_trailing_one((unsigned long)i);
 }
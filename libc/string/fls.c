@@ -26,14 +26,10 @@
 
 #define _DEFAULT_SOURCE
 #include <strings.h>
-#include <limits.h>
+#include <stdbit.h>
 
 int
 fls(int i)
 {
-
-    if (i == 0)
-        return 0;
-
-    return (sizeof(i) * CHAR_BIT - __builtin_clz(i));
+    return (int)stdc_bit_width((unsigned int)i);
 }
@@ -26,14 +26,10 @@
 
 #define _DEFAULT_SOURCE
 #include <strings.h>
-#include <limits.h>
+#include <stdbit.h>
 
 int
 flsll(long long i)
 {
-
-    if (i == 0)
-        return 0;
-
-    return (sizeof(i) * CHAR_BIT - __builtin_clzll(i));
+    return (int)stdc_bit_width((unsigned long long)i);
 }
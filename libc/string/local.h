@@ -4,6 +4,15 @@
 /* internal function to compute width of wide char. */
 int   __wcwidth(wint_t);
 
+/*
+ * Unless the library prefers size over speed, __wcwidth skips the
+ * binary searches of ambiguous.t, combining.t and wide.t and reads the
+ * width from the page-indexed table mkwidth_page.py builds from them.
+ */
+#if defined(__MB_CAPABLE) && !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+#define __WCWIDTH_PAGE_TABLES
+#endif
+
 /* Reentrant version of strerror.  */
 char *_strerror_r(int, int, int *);
 
@@ -42,3 +51,53 @@ char *_strerror_r(int, int, int *);
 
 /* Returns nonzero if (unsigned long)X contains the byte used to fill (unsigned long)MASK.  */
 #define DETECT_CHAR(X, MASK) (DETECT_NULL(X ^ MASK))
+
+/*
+ * Whether the byte C is in SET. strset_init always adds the null
+ * byte, so a scan for bytes in the set also stops at the end of the
+ * string.
+ */
+#define STRSET_HAS(set, c) \
+    ((set)->__bits[(unsigned char)(c) >> 3] & (1U << ((unsigned char)(c) & 7)))
+
+/* Lower case the ASCII letter C; every other value is left alone */
+static inline int
+__ascii_tolower(int c)
+{
+    return (unsigned)(c - 'A') < 26 ? c - 'A' + 'a' : c;
+}
+
+/*
+ * Lower case the ASCII letters in the bytes of X. The high bit of each
+ * byte is cleared before the range checks so they cannot carry into
+ * the next byte, and bytes which had it set are left alone.
+ */
+static inline unsigned long
+__ascii_tolower_word(unsigned long x)
+{
+    const unsigned long ones = ~0UL / 0xff;
+    const unsigned long high = ones * 0x80;
+    unsigned long       low = x & ~high;
+    unsigned long       upper = (low + ones * (0x80 - 'A')) & ~(low + ones * (0x80 - 'Z' - 1)) & ~x & high;
+
+    return x | (upper >> 2);
+}
+
+/* strcasecmp and strncasecmp for locales where only ASCII has case */
+int __ascii_strcasecmp(const char *s1, const char *s2);
+int __ascii_strncasecmp(const char *s1, const char *s2, size_t n);
+
+/*
+ * A needle prepared by memmem_prepare: its two-way factorization and
+ * shift table, see str-two-way.h. Size-optimized builds keep only the
+ * needle and search with memmem and strstr.
+ */
+struct memmem_needle {
+    size_t        len;
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+    size_t        suffix;
+    size_t        period;
+    size_t        shift[1U << CHAR_BIT];
+#endif
+    unsigned char needle[];
+};
@@ -69,10 +69,19 @@ memcmp(const void *m1, const void *m2, size_t n)
     unsigned long *a1;
     unsigned long *a2;
 
-    /* If the size is too small, or either pointer is unaligned,
-       then we punt to the byte compare loop.  Hopefully this will
-       not turn up in inner loops.  */
-    if (!TOO_SMALL_LITTLE_BLOCK(n) && !UNALIGNED_X_Y(s1, s2)) {
+    /* If the size is too small, or the pointers are not aligned
+       alike, then we punt to the byte compare loop.  Hopefully this
+       will not turn up in inner loops.  */
+    if (!TOO_SMALL_BIG_BLOCK(n) && !UNALIGNED_X((uintptr_t)s1 ^ (uintptr_t)s2)) {
+        /* Compare bytes until both pointers are aligned */
+        while (UNALIGNED_X(s1)) {
+            if (*s1 != *s2)
+                return *s1 - *s2;
+            s1++;
+            s2++;
+            n--;
+        }
+
         /* Otherwise, load and compare the blocks of memory one
            word at a time.  */
         a1 = (unsigned long *)s1;
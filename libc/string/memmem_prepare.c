@@ -0,0 +1,153 @@
+/*
+FUNCTION
+<<memmem_prepare>>, <<memmem_prepared>>, <<strstr_prepared>>, <<memmem_prepare_free>>---search repeatedly for one needle
+
+INDEX
+        memmem_prepare
+INDEX
+        memmem_prepared
+INDEX
+        strstr_prepared
+INDEX
+        memmem_prepare_free
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <string.h>
+        struct memmem_needle *memmem_prepare(const void *<[needle]>, size_t <[len]>);
+        void *memmem_prepared(const struct memmem_needle *<[prep]>,
+                              const void *<[haystack]>, size_t <[hlen]>);
+        char *strstr_prepared(const struct memmem_needle *<[prep]>,
+                              const char *<[haystack]>);
+        void memmem_prepare_free(struct memmem_needle *<[prep]>);
+
+DESCRIPTION
+<<memmem_prepare>> copies the <[len]> bytes at <[needle]> and
+computes what <<memmem>> and <<strstr>> work out about a long needle
+on every call: its critical factorization and a 256-entry shift
+table. <<memmem_prepared>> and <<strstr_prepared>> then search like
+<<memmem>> and <<strstr>> using them, in time linear in the haystack
+and often less, with no setup per call.
+
+<<memmem_prepare_free>> releases a prepared needle.
+
+RETURNS
+<<memmem_prepare>> returns NULL if there is not enough memory.
+<<memmem_prepared>> and <<strstr_prepared>> return a pointer to the
+first occurrence of the needle, or NULL. An empty needle matches at
+the start of the haystack.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdint.h>
+#include "local.h"
+
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
+
+struct memmem_needle *
+memmem_prepare(const void *needle, size_t len)
+{
+    struct memmem_needle *prep;
+
+    if (len > SIZE_MAX - sizeof(*prep))
+        return NULL;
+    prep = malloc(sizeof(*prep) + len);
+    if (prep) {
+        prep->len = len;
+        memcpy(prep->needle, needle, len);
+    }
+    return prep;
+}
+
+void *
+memmem_prepared(const struct memmem_needle *prep, const void *haystack, size_t hlen)
+{
+    return memmem(haystack, hlen, prep->needle, prep->len);
+}
+
+#else
+
+#define RETURN_TYPE               void *
+#define AVAILABLE(h, h_l, j, n_l) ((j) <= (h_l) - (n_l))
+#include "str-two-way.h"
+
+struct memmem_needle *
+memmem_prepare(const void *needle, size_t len)
+{
+    struct memmem_needle *prep;
+
+    if (len > SIZE_MAX - sizeof(*prep))
+        return NULL;
+    prep = malloc(sizeof(*prep) + len);
+    if (prep) {
+        prep->len = len;
+        memcpy(prep->needle, needle, len);
+        if (len > 1) {
+            prep->suffix = critical_factorization(prep->needle, len, &prep->period);
+            two_way_shift_table(prep->needle, len, prep->shift);
+        }
+    }
+    return prep;
+}
+
+void *
+memmem_prepared(const struct memmem_needle *prep, const void *haystack, size_t hlen)
+{
+    if (prep->len == 0)
+        return (void *)haystack;
+    if (prep->len == 1)
+        return memchr(haystack, prep->needle[0], hlen);
+    if (hlen < prep->len)
+        return NULL;
+    return two_way_long_search(haystack, hlen, prep->needle, prep->len, prep->suffix,
+                               prep->period, prep->shift);
+}
+
+#endif
+
+void
+memmem_prepare_free(struct memmem_needle *prep)
+{
+    free(prep);
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <string.h>
+#include "memmem_set.h"
+
+/* The leftmost occurrence, see memmem_set_compile.c */
+void *
+memmem_set(const struct memmem_set *set, const void *haystack, size_t len, size_t *which)
+{
+    const unsigned char *p = haystack;
+    const unsigned char *end = p + len;
+    const unsigned char *best = NULL;
+    size_t               node = 0, out, found = 0;
+
+    if (set->empty) {
+        if (which)
+            *which = set->empty - 1;
+        return (void *)haystack;
+    }
+
+    while (p < end) {
+        if (node == 0) {
+            while (set->root[*p] == 0)
+                if (++p == end)
+                    goto done;
+            node = set->root[*p++];
+        } else
+            node = __memmem_set_step(set, node, *p++);
+
+        out = __memmem_set_out(set, node);
+        if (out && (best == NULL || p - set->depth[out] < best)) {
+            best = p - set->depth[out];
+            found = set->term[out] - 1;
+        }
+        /* Anything ending later starts after best */
+        if (best && (size_t)(p - best) + 1 >= set->maxlen)
+            break;
+    }
+done:
+    if (best && which)
+        *which = found;
+    return (void *)best;
+}
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Aho-Corasick automaton shared by memmem_set, memmem_set_next and
+ * strstr_set; the one-needle searches use str-two-way.h instead.
+ *
+ * Node 0 is the root of the trie of needles. Nodes are numbered in
+ * breadth-first order, so the children of each node are consecutive
+ * and those of node n are first[n] up to first[n + 1], sorted by the
+ * byte leading into them. The root's children are also kept in a full
+ * table, which lets a search skip bytes no needle starts with.
+ */
+
+#ifndef _MEMMEM_SET_H_
+#define _MEMMEM_SET_H_
+
+#include <string.h>
+
+struct memmem_set {
+    size_t         nnode;
+    size_t         maxlen;    /* length of the longest needle */
+    size_t         empty;     /* index + 1 of an empty needle, else 0 */
+    size_t        *first;     /* [nnode + 1] first child of each node */
+    size_t        *fail;      /* [nnode] longest proper suffix in the trie */
+    size_t        *term;      /* [nnode] index + 1 of the needle ending here */
+    size_t        *dict;      /* [nnode] longest proper suffix ending a needle */
+    size_t        *depth;     /* [nnode] length of the node's string */
+    unsigned char *label;     /* [nnode] byte leading into the node */
+    size_t         root[256]; /* child of the root for each byte, or 0 */
+};
+
+/* the node reached from node on byte c */
+static inline size_t
+__memmem_set_step(const struct memmem_set *set, size_t node, unsigned char c)
+{
+    size_t i, end;
+
+    for (; node != 0; node = set->fail[node]) {
+        end = set->first[node + 1];
+        for (i = set->first[node]; i < end && set->label[i] <= c; i++)
+            if (set->label[i] == c)
+                return i;
+    }
+    return set->root[c];
+}
+
+/* the longest needle ending at node, as a node, or 0 */
+static inline size_t
+__memmem_set_out(const struct memmem_set *set, size_t node)
+{
+    return set->term[node] ? node : set->dict[node];
+}
+
+#endif /* _MEMMEM_SET_H_ */
@@ -0,0 +1,213 @@
+/*
+FUNCTION
+<<memmem_set_compile>>, <<memmem_set>>, <<memmem_set_next>>, <<strstr_set>>, <<memmem_set_free>>---search for several byte strings at once
+
+INDEX
+        memmem_set_compile
+INDEX
+        memmem_set
+INDEX
+        memmem_set_next
+INDEX
+        strstr_set
+INDEX
+        memmem_set_free
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <string.h>
+        struct memmem_set *memmem_set_compile(const void *const *<[needles]>,
+                                              const size_t *<[lens]>, size_t <[n]>);
+        void *memmem_set(const struct memmem_set *<[set]>, const void *<[haystack]>,
+                         size_t <[len]>, size_t *<[which]>);
+        void *memmem_set_next(const struct memmem_set *<[set]>,
+                              struct memmem_set_state *<[state]>,
+                              const void *<[buf]>, size_t <[len]>, size_t *<[which]>);
+        char *strstr_set(const struct memmem_set *<[set]>, const char *<[haystack]>,
+                         size_t *<[which]>);
+        void memmem_set_free(struct memmem_set *<[set]>);
+
+DESCRIPTION
+<<memmem_set_compile>> builds an Aho-Corasick automaton for the <[n]>
+<[needles]>, the <<i>>th of which is <[lens]>[<<i>>] bytes long; if
+<[lens]> is NULL the needles are null-terminated strings. The needles
+are copied into the automaton, which then finds all of them in one
+pass over the data, however many there are.
+
+<<memmem_set>> finds the first occurrence of any of the needles in
+the <[len]> bytes at <[haystack]>: the one starting leftmost, and of
+those starting there the shortest. If <[which]> is not NULL, the
+index of the needle found is stored there; for duplicate needles it
+is the lowest. <<strstr_set>> does the same in a null-terminated
+<[haystack]>.
+
+<<memmem_set_next>> scans data arriving in pieces, reporting every
+occurrence of every non-empty needle, including those spanning
+pieces. Clear a <<struct memmem_set_state>> with
+<<MEMMEM_SET_STATE_INIT>> before the first piece. Each call stores the
+index of one needle in <[which]> and returns a pointer just past the
+end of it; pass that pointer and the bytes remaining in the piece to
+the next call. Occurrences ending at the same byte are reported
+longest first. A NULL return means the rest of the piece holds no
+more, and the state carries the partial matches on to the next piece.
+
+<<memmem_set_free>> releases an automaton.
+
+RETURNS
+<<memmem_set_compile>> returns NULL if there is not enough memory.
+<<memmem_set>> and <<strstr_set>> return a pointer to the start of
+the occurrence found, or NULL. An empty needle matches at the start
+of any haystack.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memmem_set.h"
+
+struct memmem_set *
+memmem_set_compile(const void * const *needles, const size_t *lens, size_t n)
+{
+    struct memmem_set   *set = NULL;
+    const unsigned char *needle;
+    size_t              *child, *sib, *term, *order;
+    unsigned char       *label;
+    size_t               total = 1, len, i, j, k, prev, node, nnode, head, tail;
+
+    for (i = 0; i < n; i++) {
+        len = lens ? lens[i] : strlen(needles[i]);
+        if (len > SIZE_MAX / (6 * sizeof(size_t) + 1) - total)
+            return NULL;
+        total += len;
+    }
+
+    /*
+     * Build the trie with sorted sibling lists, numbering nodes as
+     * they are created; total bounds the number of nodes
+     */
+    child = calloc(total, 4 * sizeof(size_t) + 1);
+    if (child == NULL)
+        return NULL;
+    sib = child + total;
+    term = sib + total;
+    order = term + total;
+    label = (unsigned char *)(order + total);
+
+    nnode = 1;
+    for (i = 0; i < n; i++) {
+        needle = needles[i];
+        len = lens ? lens[i] : strlen(needles[i]);
+        node = 0;
+        for (j = 0; j < len; j++) {
+            prev = 0;
+            for (k = child[node]; k != 0 && label[k] < needle[j]; k = sib[k])
+                prev = k;
+            if (k == 0 || label[k] != needle[j]) {
+                label[nnode] = needle[j];
+                sib[nnode] = k;
+                if (prev)
+                    sib[prev] = nnode;
+                else
+                    child[node] = nnode;
+                k = nnode++;
+            }
+            node = k;
+        }
+        if (term[node] == 0)
+            term[node] = i + 1;
+    }
+
+    set = malloc(sizeof(struct memmem_set) + (5 * nnode + 1) * sizeof(size_t) + nnode);
+    if (set == NULL)
+        goto out;
+    set->nnode = nnode;
+    set->first = (size_t *)(set + 1);
+    set->fail = set->first + nnode + 1;
+    set->term = set->fail + nnode;
+    set->dict = set->term + nnode;
+    set->depth = set->dict + nnode;
+    set->label = (unsigned char *)(set->depth + nnode);
+
+    /* Renumber breadth first, so that each node's children are consecutive */
+    order[0] = 0;
+    set->depth[0] = 0;
+    set->maxlen = 0;
+    for (head = 0, tail = 1; head < nnode; head++) {
+        node = order[head];
+        set->first[head] = tail;
+        set->term[head] = term[node];
+        set->label[head] = label[node];
+        for (k = child[node]; k != 0; k = sib[k]) {
+            set->depth[tail] = set->depth[head] + 1;
+            order[tail++] = k;
+        }
+        if (set->term[head] && set->depth[head] > set->maxlen)
+            set->maxlen = set->depth[head];
+    }
+    set->first[nnode] = nnode;
+
+    set->empty = set->term[0];
+    set->term[0] = 0;
+    memset(set->root, 0, sizeof(set->root));
+    for (k = set->first[0]; k < set->first[1]; k++)
+        set->root[set->label[k]] = k;
+
+    /* Suffix links, parents before children */
+    set->fail[0] = 0;
+    set->dict[0] = 0;
+    for (node = 0; node < nnode; node++)
+        for (k = set->first[node]; k < set->first[node + 1]; k++) {
+            j = node ? __memmem_set_step(set, set->fail[node], set->label[k]) : 0;
+            set->fail[k] = j;
+            set->dict[k] = __memmem_set_out(set, j);
+        }
+
+out:
+    free(child);
+    return set;
+}
+
+void
+memmem_set_free(struct memmem_set *set)
+{
+    free(set);
+}
@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <string.h>
+#include "memmem_set.h"
+
+/* Every occurrence in a stream, see memmem_set_compile.c */
+void *
+memmem_set_next(const struct memmem_set *set, struct memmem_set_state *state, const void *buf,
+                size_t len, size_t *which)
+{
+    const unsigned char *p = buf;
+    const unsigned char *end = p + len;
+    size_t               node = state->__node;
+    size_t               out = state->__out;
+
+    /* Shorter needles ending where the last one reported did */
+    if (out == 0) {
+        while (p < end) {
+            if (node == 0) {
+                while (set->root[*p] == 0)
+                    if (++p == end)
+                        goto done;
+                node = set->root[*p++];
+            } else
+                node = __memmem_set_step(set, node, *p++);
+            out = __memmem_set_out(set, node);
+            if (out)
+                break;
+        }
+    }
+done:
+    state->__node = node;
+    if (out == 0)
+        return NULL;
+    state->__out = set->dict[out];
+    if (which)
+        *which = set->term[out] - 1;
+    return (void *)p;
+}
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Copyright © 2026 M65832 Project
+#
+"""
+Build the page-indexed column width table in wcwidth_page.h
+
+The input is the interval tables wcwidth searches, ambiguous.t,
+combining.t and wide.t, so the page table always gives what the
+binary searches give. Each code point gets its width outside and
+inside a CJK locale, packed as normal | cjk << 2. Code points are
+split into pages, pages into blocks and identical pages and blocks are
+stored once; the page and block sizes are the ones giving the smallest
+tables.
+
+Usage: mkwidth_page.py [ambiguous.t [combining.t [wide.t]]] > wcwidth_page.h
+"""
+
+import re
+import sys
+
+LIMIT = 0x110000
+
+# Width 1 both ways, for code points past the table and padding
+DEFAULT = 1 | 1 << 2
+
+
+def load_intervals(name):
+    with open(name) as f:
+        return [(int(a, 16), int(b, 16))
+                for a, b in re.findall(r'\{ 0x([0-9A-Fa-f]+), 0x([0-9A-Fa-f]+) \}', f.read())]
+
+
+def mark(name):
+    flags = bytearray(LIMIT)
+    for first, last in load_intervals(name):
+        flags[first:last + 1] = b'\1' * (last + 1 - first)
+    return flags
+
+
+def widths(ambiguous, combining, wide):
+    """The width of each code point, in the order __wcwidth tests"""
+    values = []
+    for c in range(LIMIT):
+        normal = 0 if combining[c] else 2 if wide[c] else 1
+        cjk = 2 if ambiguous[c] else normal
+        values.append(normal | cjk << 2)
+    # Trim the default tail; the lookup returns DEFAULT beyond it
+    while values and values[-1] == DEFAULT:
+        values.pop()
+    return values
+
+
+def type_for(count):
+    return 'uint8_t' if count <= 0x100 else 'uint16_t'
+
+
+def split(values, size):
+    """Store each distinct size-entry run of values once"""
+    runs = {}
+    index = []
+    for i in range(0, len(values), size):
+        index.append(runs.setdefault(tuple(values[i:i + size]), len(runs)))
+    return index, [v for run in runs for v in run], len(runs)
+
+
+def build(values, page_shift, block_shift):
+    page = 1 << page_shift
+    limit = (len(values) + page - 1) & ~(page - 1)
+    values = values + [DEFAULT] * (limit - len(values))
+
+    leaf_index, leaf, nleaf = split(values, 1 << block_shift)
+    page_index, blocks, nblock = split(leaf_index, 1 << (page_shift - block_shift))
+
+    size = (len(page_index) * (1 if nblock <= 0x100 else 2) +
+            len(blocks) * (1 if nleaf <= 0x100 else 2) +
+            len(leaf))
+    return {
+        'limit': limit,
+        'page_shift': page_shift,
+        'block_shift': block_shift,
+        'page_index': page_index,
+        'blocks': blocks,
+        'leaf': leaf,
+        'size': size,
+    }
+
+
+def dump_array(ctype, name, values):
+    print('static const %s %s[%d] = {' % (ctype, name, len(values)))
+    for i in range(0, len(values), 16):
+        print('    ' + ' '.join('%d,' % v for v in values[i:i + 16]))
+    print('};')
+    print()
+
+
+def dump(t):
+    print('''/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* This file is auto-generated from mkwidth_page.py */
+/* clang-format off */
+''')
+    print('#define WCWIDTH_PAGE_LIMIT  0x%05x' % t['limit'])
+    print('#define WCWIDTH_PAGE_SHIFT  %d' % t['page_shift'])
+    print('#define WCWIDTH_BLOCK_SHIFT %d' % t['block_shift'])
+    print('#define WCWIDTH_DEFAULT     %d' % DEFAULT)
+    print()
+    dump_array(type_for(len(t['blocks']) >> (t['page_shift'] - t['block_shift'])),
+               'wcwidth_page_index', t['page_index'])
+    dump_array(type_for(len(t['leaf']) >> t['block_shift']), 'wcwidth_page_block', t['blocks'])
+    dump_array('uint8_t', 'wcwidth_page_leaf', t['leaf'])
+    print('/* %d bytes of index and block data */' % t['size'])
+
+
+def main():
+    names = sys.argv[1:] + ['ambiguous.t', 'combining.t', 'wide.t'][len(sys.argv) - 1:]
+    values = widths(*(mark(name) for name in names))
+
+    best = None
+    for page_shift in range(6, 14):
+        for block_shift in range(2, page_shift):
+            t = build(values, page_shift, block_shift)
+            if best is None or t['size'] < best['size']:
+                best = t
+    dump(best)
+
+
+if __name__ == '__main__':
+    main()
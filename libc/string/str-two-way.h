@@ -24,6 +24,10 @@
                                 is an 'unsigned char'; the result must
                                 be an 'unsigned char' as well.
 
+  Define TWO_WAY_SEARCH_ONLY to get just two_way_long_search, for
+  needles whose factorization and shift table memmem_prepare has
+  already computed.
+
   This file undefines the macros documented above, and defines
   LONG_NEEDLE_THRESHOLD.
 */
@@ -63,6 +67,7 @@
 #define CMP_FUNC memcmp
 #endif
 
+#ifndef TWO_WAY_SEARCH_ONLY
 /* Perform a critical factorization of NEEDLE, of length NEEDLE_LEN.
    Return the index of the first byte in the right half, and set
    *PERIOD to the global period of the right half.
@@ -250,41 +255,17 @@ two_way_short_needle(const unsigned char *haystack, size_t haystack_len,
     return NULL;
 }
 
-/* Return the first location of non-empty NEEDLE within HAYSTACK, or
-   NULL.  HAYSTACK_LEN is the minimum known length of HAYSTACK.  This
-   method is optimized for LONG_NEEDLE_THRESHOLD <= NEEDLE_LEN.
-   Performance is guaranteed to be linear, with an initialization cost
-   of 3 * NEEDLE_LEN + (1 << CHAR_BIT) operations.
+#endif /* !TWO_WAY_SEARCH_ONLY */
 
-   If AVAILABLE does not modify HAYSTACK_LEN (as in memmem), then at
-   most 2 * HAYSTACK_LEN - NEEDLE_LEN comparisons occur in searching,
-   and sublinear performance O(HAYSTACK_LEN / NEEDLE_LEN) is possible.
-   If AVAILABLE modifies HAYSTACK_LEN (as in strstr), then at most 3 *
-   HAYSTACK_LEN - NEEDLE_LEN comparisons occur in searching, and
-   sublinear performance is not possible.  */
-__noinline static RETURN_TYPE __used
-two_way_long_needle(const unsigned char *haystack, size_t haystack_len, const unsigned char *needle,
-                    size_t needle_len)
+/* The search of two_way_long_needle, given the factorization of
+   NEEDLE into SUFFIX and PERIOD by critical_factorization and the
+   SHIFT_TABLE built by two_way_shift_table.  */
+static inline RETURN_TYPE
+two_way_long_search(const unsigned char *haystack, size_t haystack_len, const unsigned char *needle,
+                    size_t needle_len, size_t suffix, size_t period, const size_t *shift_table)
 {
-    size_t i;                           /* Index into current byte of NEEDLE.  */
-    size_t j;                           /* Index into current window of HAYSTACK.  */
-    size_t period;                      /* The period of the right half of needle.  */
-    size_t suffix;                      /* The index of the right half of needle.  */
-    size_t shift_table[1U << CHAR_BIT]; /* See below.  */
-
-    /* Factor the needle into two halves, such that the left half is
-       smaller than the global period, and the right half is
-       periodic (with a period as large as NEEDLE_LEN - suffix).  */
-    suffix = critical_factorization(needle, needle_len, &period);
-
-    /* Populate shift_table.  For each possible byte value c,
-       shift_table[c] is the distance from the last occurrence of c to
-       the end of NEEDLE, or NEEDLE_LEN if c is absent from the NEEDLE.
-       shift_table[NEEDLE[NEEDLE_LEN - 1]] contains the only 0.  */
-    for (i = 0; i < 1U << CHAR_BIT; i++)
-        shift_table[i] = needle_len;
-    for (i = 0; i < needle_len; i++)
-        shift_table[CANON_ELEMENT(needle[i])] = needle_len - i - 1;
+    size_t i; /* Index into current byte of NEEDLE.  */
+    size_t j; /* Index into current window of HAYSTACK.  */
 
     /* Perform the search.  Each iteration compares the right half
        first.  */
@@ -369,8 +350,55 @@ two_way_long_needle(const unsigned char *haystack, size_t haystack_len, const un
     return NULL;
 }
 
+#ifndef TWO_WAY_SEARCH_ONLY
+/* Populate SHIFT_TABLE.  For each possible byte value c,
+   shift_table[c] is the distance from the last occurrence of c to
+   the end of NEEDLE, or NEEDLE_LEN if c is absent from the NEEDLE.
+   shift_table[NEEDLE[NEEDLE_LEN - 1]] contains the only 0.  */
+static inline void
+two_way_shift_table(const unsigned char *needle, size_t needle_len, size_t *shift_table)
+{
+    size_t i;
+
+    for (i = 0; i < 1U << CHAR_BIT; i++)
+        shift_table[i] = needle_len;
+    for (i = 0; i < needle_len; i++)
+        shift_table[CANON_ELEMENT(needle[i])] = needle_len - i - 1;
+}
+
+/* Return the first location of non-empty NEEDLE within HAYSTACK, or
+   NULL.  HAYSTACK_LEN is the minimum known length of HAYSTACK.  This
+   method is optimized for LONG_NEEDLE_THRESHOLD <= NEEDLE_LEN.
+   Performance is guaranteed to be linear, with an initialization cost
+   of 3 * NEEDLE_LEN + (1 << CHAR_BIT) operations.
+
+   If AVAILABLE does not modify HAYSTACK_LEN (as in memmem), then at
+   most 2 * HAYSTACK_LEN - NEEDLE_LEN comparisons occur in searching,
+   and sublinear performance O(HAYSTACK_LEN / NEEDLE_LEN) is possible.
+   If AVAILABLE modifies HAYSTACK_LEN (as in strstr), then at most 3 *
+   HAYSTACK_LEN - NEEDLE_LEN comparisons occur in searching, and
+   sublinear performance is not possible.  */
+__noinline static RETURN_TYPE __used
+two_way_long_needle(const unsigned char *haystack, size_t haystack_len, const unsigned char *needle,
+                    size_t needle_len)
+{
+    size_t period;                      /* The period of the right half of needle.  */
+    size_t suffix;                      /* The index of the right half of needle.  */
+    size_t shift_table[1U << CHAR_BIT]; /* See two_way_shift_table.  */
+
+    /* Factor the needle into two halves, such that the left half is
+       smaller than the global period, and the right half is
+       periodic (with a period as large as NEEDLE_LEN - suffix).  */
+    suffix = critical_factorization(needle, needle_len, &period);
+    two_way_shift_table(needle, needle_len, shift_table);
+    return two_way_long_search(haystack, haystack_len, needle, needle_len, suffix, period,
+                               shift_table);
+}
+#endif /* !TWO_WAY_SEARCH_ONLY */
+
 #undef AVAILABLE
 #undef CANON_ELEMENT
 #undef CMP_FUNC
 #undef MAX
 #undef RETURN_TYPE
+#undef TWO_WAY_SEARCH_ONLY
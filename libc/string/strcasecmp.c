@@ -50,11 +50,15 @@ QUICKREF
 
 #include <strings.h>
 #include <ctype.h>
+#include "local.h"
 
 int
 strcasecmp(const char *s1, const char *s2)
 {
     int d = 0;
+
+    if (__locale_ascii_case(0))
+        return __ascii_strcasecmp(s1, s2);
     for (;;) {
         const int c1 = tolower(*(unsigned char *)s1++);
         const int c2 = tolower(*(unsigned char *)s2++);
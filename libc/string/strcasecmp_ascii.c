@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <strings.h>
+#include <limits.h>
+#include "local.h"
+
+/*
+ * Case-insensitive compares for locales in which tolower only maps
+ * 'A'..'Z'. Aligned strings are compared a word at a time after
+ * folding each word to lower case; folding never turns a non-zero
+ * byte into zero, so when the folded words match and *a1 has no null
+ * in it, neither does *a2.
+ */
+
+int
+__ascii_strcasecmp(const char *s1, const char *s2)
+{
+    int d;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    if (!UNALIGNED_X_Y(s1, s2)) {
+        const unsigned long *a1 = (const unsigned long *)s1;
+        const unsigned long *a2 = (const unsigned long *)s2;
+
+        while (__ascii_tolower_word(*a1) == __ascii_tolower_word(*a2)) {
+            if (DETECT_NULL(*a1))
+                return 0;
+            a1++;
+            a2++;
+        }
+        s1 = (const char *)a1;
+        s2 = (const char *)a2;
+    }
+#endif
+
+    for (;;) {
+        const int c1 = __ascii_tolower(*(unsigned char *)s1++);
+        const int c2 = __ascii_tolower(*(unsigned char *)s2++);
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+            break;
+    }
+    return d;
+}
+
+int
+__ascii_strncasecmp(const char *s1, const char *s2, size_t n)
+{
+    int d = 0;
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && !defined(_PICOLIBC_NO_OUT_OF_BOUNDS_READS)
+    if (!UNALIGNED_X_Y(s1, s2)) {
+        const unsigned long *a1 = (const unsigned long *)s1;
+        const unsigned long *a2 = (const unsigned long *)s2;
+
+        while (n >= sizeof(long) && __ascii_tolower_word(*a1) == __ascii_tolower_word(*a2)) {
+            n -= sizeof(long);
+            if (n == 0 || DETECT_NULL(*a1))
+                return 0;
+            a1++;
+            a2++;
+        }
+        s1 = (const char *)a1;
+        s2 = (const char *)a2;
+    }
+#endif
+
+    for (; n != 0; n--) {
+        const int c1 = __ascii_tolower(*(unsigned char *)s1++);
+        const int c2 = __ascii_tolower(*(unsigned char *)s2++);
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+            break;
+    }
+    return d;
+}
@@ -40,11 +40,15 @@ QUICKREF
 #define _DEFAULT_SOURCE
 #include <strings.h>
 #include <ctype.h>
+#include "local.h"
 
 int
 strcasecmp_l(const char *s1, const char *s2, locale_t locale)
 {
     int d = 0;
+
+    if (__locale_ascii_case(locale))
+        return __ascii_strcasecmp(s1, s2);
     for (;;) {
         const int c1 = tolower_l(*(unsigned char *)s1++, locale);
         const int c2 = tolower_l(*(unsigned char *)s2++, locale);
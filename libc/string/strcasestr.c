@@ -71,12 +71,22 @@ QUICKREF
 #include <ctype.h>
 #include <string.h>
 #include <strings.h>
+#include "local.h"
+
+/* tolower, skipping the ctype tables when only ASCII has case */
+static inline int
+canon_tolower(int c)
+{
+    if (__locale_ascii_case(0))
+        return __ascii_tolower(c);
+    return tolower(c);
+}
 
 #if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
 #define RETURN_TYPE char *
 #define AVAILABLE(h, h_l, j, n_l)                                              \
     (!memchr((h) + (h_l), '\0', (j) + (n_l) - (h_l)) && ((h_l) = (j) + (n_l)))
-#define CANON_ELEMENT(c) tolower(c)
+#define CANON_ELEMENT(c) canon_tolower(c)
 #ifdef __GNUCLIKE_PRAGMA_DIAGNOSTIC
 /* strncasecmp uses signed char, CMP_FUNC is expected to use unsigned char. */
 #pragma GCC diagnostic ignored "-Wpointer-sign"
@@ -98,13 +108,13 @@ strcasestr(const char *s, const char *find)
     size_t len;
 
     if ((c = *find++) != 0) {
-        c = tolower((unsigned char)c);
+        c = canon_tolower((unsigned char)c);
         len = strlen(find);
         do {
             do {
                 if ((sc = *s++) == 0)
                     return (NULL);
-            } while ((char)tolower((unsigned char)sc) != c);
+            } while ((char)canon_tolower((unsigned char)sc) != c);
         } while (strncasecmp(s, find, len) != 0);
         s--;
     }
@@ -123,7 +133,7 @@ strcasestr(const char *s, const char *find)
        HAYSTACK is at least as long (no point processing all of a long
        NEEDLE if HAYSTACK is too short).  */
     while (*haystack && *needle)
-        ok &= (tolower((unsigned char)*haystack++) == tolower((unsigned char)*needle++));
+        ok &= (canon_tolower((unsigned char)*haystack++) == canon_tolower((unsigned char)*needle++));
     if (*needle)
         return NULL;
     if (ok)
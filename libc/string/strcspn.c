@@ -39,11 +39,13 @@ PORTABILITY
 <<strcspn>> requires no supporting OS subroutines.
  */
 
+#define _GNU_SOURCE
 #include <string.h>
 
 size_t
 strcspn(const char *s1, const char *s2)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     const char *s = s1;
     const char *c;
 
@@ -56,4 +58,13 @@ strcspn(const char *s1, const char *s2)
     }
 end:
     return s1 - s;
+#else
+    struct strset set;
+
+    /* A single character needs no table */
+    if (s2[0] == '\0' || s2[1] == '\0')
+        return strchrnul(s1, s2[0]) - s1;
+    strset_init(&set, s2);
+    return strcspn_set(s1, &set);
+#endif
 }
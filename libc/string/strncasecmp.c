@@ -51,11 +51,15 @@ QUICKREF
 
 #include <strings.h>
 #include <ctype.h>
+#include "local.h"
 
 int
 strncasecmp(const char *s1, const char *s2, size_t n)
 {
     int d = 0;
+
+    if (__locale_ascii_case(0))
+        return __ascii_strncasecmp(s1, s2, n);
     for (; n != 0; n--) {
         const int c1 = tolower(*(unsigned char *)s1++);
         const int c2 = tolower(*(unsigned char *)s2++);
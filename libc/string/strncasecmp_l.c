@@ -43,11 +43,15 @@ QUICKREF
 #define _DEFAULT_SOURCE
 #include <strings.h>
 #include <ctype.h>
+#include "local.h"
 
 int
 strncasecmp_l(const char *s1, const char *s2, size_t n, locale_t locale)
 {
     int d = 0;
+
+    if (__locale_ascii_case(locale))
+        return __ascii_strncasecmp(s1, s2, n);
     for (; n != 0; n--) {
         const int c1 = tolower_l(*(unsigned char *)s1++, locale);
         const int c2 = tolower_l(*(unsigned char *)s2++, locale);
@@ -38,11 +38,13 @@ PORTABILITY
 <<strpbrk>> requires no supporting OS subroutines.
 */
 
+#define _DEFAULT_SOURCE
 #include <string.h>
 
 char *
 strpbrk(const char *s1, const char *s2)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     const char *c = s2;
 
     while (*s1) {
@@ -54,4 +56,15 @@ strpbrk(const char *s1, const char *s2)
     }
 
     return (char *)NULL;
+#else
+    struct strset set;
+
+    /* A single character needs no table */
+    if (s2[0] == '\0')
+        return NULL;
+    if (s2[1] == '\0')
+        return strchr(s1, s2[0]);
+    strset_init(&set, s2);
+    return strpbrk_set(s1, &set);
+#endif
 }
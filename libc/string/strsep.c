@@ -2,6 +2,7 @@
 
 /* Copyright 2002, Red Hat Inc. */
 
+#define _DEFAULT_SOURCE
 #define _DEFAULT_SOURCE
 #include <string.h>
 #include "strtok_r.h"
@@ -11,3 +12,9 @@ strsep(register char **source_ptr, register const char *delim)
 {
     return __strtok_r(*source_ptr, delim, source_ptr, 0);
 }
+
+char *
+strsep_set(char **source_ptr, const struct strset *set)
+{
+    return __strtok_set(*source_ptr, set, source_ptr, 0);
+}
@@ -0,0 +1,121 @@
+/*
+FUNCTION
+<<strset_init>>, <<strspn_set>>, <<strcspn_set>>, <<strpbrk_set>>, <<strtok_set_r>>, <<strsep_set>>---span and split with a prepared character set
+
+INDEX
+        strset_init
+INDEX
+        strspn_set
+INDEX
+        strcspn_set
+INDEX
+        strpbrk_set
+INDEX
+        strtok_set_r
+INDEX
+        strsep_set
+
+SYNOPSIS
+        #define _DEFAULT_SOURCE
+        #include <string.h>
+        void strset_init(struct strset *<[set]>, const char *<[chars]>);
+        size_t strspn_set(const char *<[s]>, const struct strset *<[set]>);
+        size_t strcspn_set(const char *<[s]>, const struct strset *<[set]>);
+        char *strpbrk_set(const char *<[s]>, const struct strset *<[set]>);
+        char *strtok_set_r(char *restrict <[s]>, const struct strset *<[set]>,
+                           char **restrict <[lasts]>);
+        char *strsep_set(char **<[sp]>, const struct strset *<[set]>);
+
+DESCRIPTION
+<<strset_init>> fills <[set]> with a 256-bit map of the characters
+in the string <[chars]>. <<strspn_set>>, <<strcspn_set>>,
+<<strpbrk_set>>, <<strtok_set_r>> and <<strsep_set>> then work like
+<<strspn>>, <<strcspn>>, <<strpbrk>>, <<strtok_r>> and <<strsep>>
+with <[chars]> as the second argument, testing each character of
+<[s]> with one table lookup. A <<struct strset>> needs no cleanup
+and may be shared between threads.
+
+RETURNS
+The same values as the corresponding standard functions.
+
+PORTABILITY
+These functions are picolibc extensions.
+*/
+
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <string.h>
+#include "local.h"
+
+void
+strset_init(struct strset *set, const char *chars)
+{
+    unsigned char c;
+
+    memset(set->__bits, 0, sizeof(set->__bits));
+    set->__bits[0] = 1;
+    while ((c = (unsigned char)*chars++) != '\0')
+        set->__bits[c >> 3] |= 1U << (c & 7);
+}
+
+size_t
+strspn_set(const char *s, const struct strset *set)
+{
+    const char *start = s;
+
+    while (*s && STRSET_HAS(set, *s))
+        s++;
+    return s - start;
+}
+
+size_t
+strcspn_set(const char *s, const struct strset *set)
+{
+    const char *start = s;
+
+    while (!STRSET_HAS(set, *s))
+        s++;
+    return s - start;
+}
+
+char *
+strpbrk_set(const char *s, const struct strset *set)
+{
+    while (!STRSET_HAS(set, *s))
+        s++;
+    return *s ? (char *)s : NULL;
+}
@@ -43,11 +43,13 @@ QUICKREF
         strspn ansi pure
 */
 
+#define _DEFAULT_SOURCE
 #include <string.h>
 
 size_t
 strspn(const char *s1, const char *s2)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     const char *s = s1;
     const char *c;
 
@@ -63,4 +65,17 @@ strspn(const char *s1, const char *s2)
     }
 
     return s1 - s;
+#else
+    const char   *s = s1;
+    struct strset set;
+
+    /* A single character needs no table */
+    if (s2[0] == '\0' || s2[1] == '\0') {
+        while (*s1 == s2[0] && *s1)
+            s1++;
+        return s1 - s;
+    }
+    strset_init(&set, s2);
+    return strspn_set(s, &set);
+#endif
 }
@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <string.h>
+#include <limits.h>
+#include "local.h"
+
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
+
+char *
+strstr_prepared(const struct memmem_needle *prep, const char *haystack)
+{
+    size_t i;
+
+    /* The needle need not be null-terminated */
+    for (; *haystack; haystack++) {
+        for (i = 0; i < prep->len && haystack[i] == (char)prep->needle[i]; i++)
+            ;
+        if (i == prep->len)
+            return (char *)haystack;
+    }
+    return prep->len ? NULL : (char *)haystack;
+}
+
+#else
+
+#define TWO_WAY_SEARCH_ONLY
+#define RETURN_TYPE char *
+#define AVAILABLE(h, h_l, j, n_l)                                                            \
+    (((j) <= (h_l) - (n_l))                                                                  \
+     || ((h_l) += strnlen((const char *)(h) + (h_l), (n_l) | 2048), ((j) <= (h_l) - (n_l))))
+#include "str-two-way.h"
+
+char *
+strstr_prepared(const struct memmem_needle *prep, const char *haystack)
+{
+    size_t hlen;
+
+    if (prep->len == 0)
+        return (char *)haystack;
+    if (prep->len == 1)
+        return strchr(haystack, prep->needle[0]);
+
+    /* Make sure the haystack is at least as long as the needle */
+    hlen = strnlen(haystack, prep->len | 512);
+    if (hlen < prep->len)
+        return NULL;
+    return two_way_long_search((const unsigned char *)haystack, hlen, prep->needle, prep->len,
+                               prep->suffix, prep->period, prep->shift);
+}
+
+#endif
@@ -28,12 +28,41 @@
  */
 
 #define _DEFAULT_SOURCE
+#define _GNU_SOURCE
 #include <string.h>
+#include "local.h"
 #include "strtok_r.h"
 
+char *
+__strtok_set(char *s, const struct strset *set, char **lasts, int skip_leading_delim)
+{
+    char *tok;
+
+    if (s == NULL && (s = *lasts) == NULL)
+        return (NULL);
+
+    if (skip_leading_delim)
+        s += strspn_set(s, set);
+    if (*s == '\0') { /* no non-delimiter characters */
+        *lasts = NULL;
+        return (NULL);
+    }
+    tok = s;
+
+    s += strcspn_set(s, set);
+    if (*s == '\0') {
+        s = NULL;
+    } else {
+        *s++ = '\0';
+    }
+    *lasts = s;
+    return (tok);
+}
+
 char *
 __strtok_r(register char *s, register const char *delim, char **lasts, int skip_leading_delim)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     register char *spanp;
     register int   c, sc;
     char          *tok;
@@ -83,6 +112,39 @@ cont:
         } while (sc != 0);
     }
     /* NOTREACHED */
+#else
+    struct strset set;
+    char          d = delim[0];
+    char         *tok;
+
+    if (s == NULL && (s = *lasts) == NULL)
+        return (NULL);
+
+    if (d == '\0' || delim[1] != '\0') {
+        strset_init(&set, delim);
+        return __strtok_set(s, &set, lasts, skip_leading_delim);
+    }
+
+    /* A single delimiter needs no table */
+    if (skip_leading_delim) {
+        while (*s == d)
+            s++;
+    }
+    if (*s == '\0') {
+        *lasts = NULL;
+        return (NULL);
+    }
+    tok = s;
+
+    s = strchrnul(s, d);
+    if (*s == '\0') {
+        s = NULL;
+    } else {
+        *s++ = '\0';
+    }
+    *lasts = s;
+    return (tok);
+#endif
 }
 
 char *
@@ -91,3 +153,9 @@ strtok_r(register char * __restrict s, register const char * __restrict delim,
 {
     return __strtok_r(s, delim, lasts, 1);
 }
+
+char *
+strtok_set_r(char * __restrict s, const struct strset *set, char ** __restrict lasts)
+{
+    return __strtok_set(s, set, lasts, 1);
+}
@@ -33,4 +33,8 @@
 char *__strtok_r(register char *s, register const char *delim, char **lasts,
                  int skip_leading_delim);
 
+struct strset;
+
+char *__strtok_set(char *s, const struct strset *set, char **lasts, int skip_leading_delim);
+
 #endif /* _STRTOK_R_H_ */
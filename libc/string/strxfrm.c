@@ -64,18 +64,9 @@ QUICKREF
 size_t
 strxfrm(char * __restrict s1, const char * __restrict s2, size_t n)
 {
-    size_t res;
-    res = 0;
-    while (n-- > 0) {
-        if ((*s1++ = *s2++) != '\0')
-            ++res;
-        else
-            return res;
-    }
-    while (*s2) {
-        ++s2;
-        ++res;
-    }
+    size_t len = strlen(s2);
 
-    return res;
+    /* Collation follows strcmp, so the transform is a copy */
+    memcpy(s1, s2, len < n ? len + 1 : n);
+    return len;
 }
@@ -59,6 +59,7 @@ No supporting OS subroutines are required.
 wchar_t *
 wcschr(const wchar_t *s, wchar_t c)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     const wchar_t *p;
 
     p = s;
@@ -69,4 +70,21 @@ wcschr(const wchar_t *s, wchar_t c)
         }
     } while (*p++);
     return NULL;
+#else
+    wchar_t d;
+
+    /* Two characters per iteration */
+    for (;; s += 2) {
+        d = s[0];
+        if (d == c)
+            return (wchar_t *)s;
+        if (!d)
+            return NULL;
+        d = s[1];
+        if (d == c)
+            return (wchar_t *)s + 1;
+        if (!d)
+            return NULL;
+    }
+#endif
 }
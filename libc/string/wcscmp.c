@@ -68,9 +68,29 @@ No supporting OS subroutines are required.
 int
 wcscmp(const wchar_t *s1, const wchar_t *s2)
 {
-
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     while (*s1 == *s2++)
         if (*s1++ == 0)
             return (0);
     return (*s1 < *--s2 ? -1 : 1);
+#else
+    wchar_t c1, c2;
+
+    /* Two characters per iteration */
+    for (;;) {
+        c1 = s1[0];
+        c2 = s2[0];
+        if (c1 != c2 || !c1)
+            break;
+        c1 = s1[1];
+        c2 = s2[1];
+        if (c1 != c2 || !c1)
+            break;
+        s1 += 2;
+        s2 += 2;
+    }
+    if (c1 == c2)
+        return 0;
+    return c1 < c2 ? -1 : 1;
+#endif
 }
@@ -56,6 +56,7 @@ No supporting OS subroutines are required.
 size_t
 wcslen(const wchar_t *s)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     const wchar_t *p;
 
     p = s;
@@ -63,4 +64,20 @@ wcslen(const wchar_t *s)
         p++;
 
     return p - s;
+#else
+    const wchar_t *p = s;
+
+    /* Four characters per iteration */
+    for (;;) {
+        if (!p[0])
+            return p - s;
+        if (!p[1])
+            return p - s + 1;
+        if (!p[2])
+            return p - s + 2;
+        if (!p[3])
+            return p - s + 3;
+        p += 4;
+    }
+#endif
 }
@@ -59,7 +59,10 @@ wcswidth(const wchar_t *pwcs, size_t n)
             wi = (((wi & 0x3ff) << 10) | (wi2 & 0x3ff)) + 0x10000;
         }
 #endif /* __MB_CAPABLE */
-        if ((w = __wcwidth(wi)) < 0)
+        /* Printable ASCII needs no lookup */
+        if (wi - 0x20 < 0x5f)
+            w = 1;
+        else if ((w = __wcwidth(wi)) < 0)
             return -1;
         len += w;
     } while (*pwcs++ && --n > 0);
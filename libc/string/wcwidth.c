@@ -97,7 +97,25 @@ PORTABILITY
 #endif
 #include "local.h"
 
-#ifdef __MB_CAPABLE
+#if defined(__WCWIDTH_PAGE_TABLES)
+#include "wcwidth_page.h"
+
+#define WCWIDTH_PAGE_BLOCKS (1 << (WCWIDTH_PAGE_SHIFT - WCWIDTH_BLOCK_SHIFT))
+
+/* Width outside and inside a CJK locale, as normal | cjk << 2 */
+static unsigned
+wcwidth_page_lookup(uint32_t ucs)
+{
+    unsigned block;
+
+    if (ucs >= WCWIDTH_PAGE_LIMIT)
+        return WCWIDTH_DEFAULT;
+    block = wcwidth_page_index[ucs >> WCWIDTH_PAGE_SHIFT] * WCWIDTH_PAGE_BLOCKS
+        + ((ucs >> WCWIDTH_BLOCK_SHIFT) & (WCWIDTH_PAGE_BLOCKS - 1));
+    return wcwidth_page_leaf[(wcwidth_page_block[block] << WCWIDTH_BLOCK_SHIFT)
+                             + (ucs & ((1 << WCWIDTH_BLOCK_SHIFT) - 1))];
+}
+#elif defined(__MB_CAPABLE)
 struct interval {
     uint32_t first;
     uint32_t last;
@@ -124,7 +142,7 @@ bisearch(uint32_t ucs, const struct interval *table, int max)
 
     return 0;
 }
-#endif /* __MB_CAPABLE */
+#endif /* __WCWIDTH_PAGE_TABLES, __MB_CAPABLE */
 
 /* The following function defines the column width of an ISO 10646
  * character as follows:
@@ -168,22 +186,25 @@ __wcwidth(const wint_t _ucs)
 {
     uint32_t ucs = (uint32_t)_ucs;
 #ifdef __MB_CAPABLE
+#ifndef __WCWIDTH_PAGE_TABLES
     /* sorted list of non-overlapping intervals of East Asian Ambiguous chars */
     static const struct interval ambiguous[] =
 #include "ambiguous.t"
 
-        /* sorted list of non-overlapping intervals of non-spacing characters */
-        static const struct interval combining[] =
+    /* sorted list of non-overlapping intervals of non-spacing characters */
+    static const struct interval combining[] =
 #include "combining.t"
 
-            /* sorted list of non-overlapping intervals of wide characters,
-               ranges extended to Blocks where possible
-             */
-        static const struct interval wide[] =
+    /* sorted list of non-overlapping intervals of wide characters,
+       ranges extended to Blocks where possible
+     */
+    static const struct interval wide[] =
 #include "wide.t"
+#endif
 
-            /* Test for NUL character */
-        if (ucs == 0) return 0;
+    /* Test for NUL character */
+    if (ucs == 0)
+        return 0;
 
     /* Test for printable ASCII characters */
     if (ucs >= 0x20 && ucs < 0x7f)
@@ -200,6 +221,11 @@ __wcwidth(const wint_t _ucs)
     /* check CJK width mode (1: ambiguous-wide, 0: normal, -1: disabled) */
     int cjk_lang = __locale_cjk_lang();
 
+#ifdef __WCWIDTH_PAGE_TABLES
+    unsigned w = wcwidth_page_lookup(ucs);
+
+    return cjk_lang > 0 ? (int)(w >> 2) : (int)(w & 3);
+#else
     /* binary search in table of ambiguous characters */
     if (cjk_lang > 0 && bisearch(ucs, ambiguous, sizeof(ambiguous) / sizeof(struct interval) - 1))
         return 2;
@@ -215,6 +241,7 @@ __wcwidth(const wint_t _ucs)
         return 2;
     else
         return 1;
+#endif /* __WCWIDTH_PAGE_TABLES */
 #else  /* !__MB_CAPABLE */
     if (iswprint(ucs))
         return 1;
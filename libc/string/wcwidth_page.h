@@ -0,0 +1,580 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* This file is auto-generated from mkwidth_page.py */
+/* clang-format off */
+
+#define WCWIDTH_PAGE_LIMIT  0x110000
+#define WCWIDTH_PAGE_SHIFT  9
+#define WCWIDTH_BLOCK_SHIFT 3
+#define WCWIDTH_DEFAULT     5
+
+static const uint8_t wcwidth_page_index[2176] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+    15, 16, 17, 18, 10, 19, 20, 21, 22, 23, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 26, 27, 28, 29, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 30, 10, 10, 10, 10,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 10, 34,
+    35, 36, 10, 10, 10, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 48, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 49, 10, 50, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 51, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 52, 24, 53, 10, 10, 10, 10, 54, 10,
+    10, 10, 10, 10, 10, 10, 10, 55, 56, 57, 10, 10, 10, 58, 10, 10,
+    59, 60, 61, 10, 62, 10, 10, 10, 63, 64, 65, 66, 67, 68, 10, 10,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 69,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 69,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    70, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 71,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 71,
+};
+
+static const uint8_t wcwidth_page_block[4608] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 2, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11,
+    12, 0, 13, 14, 15, 14, 16, 6, 17, 18, 19, 0, 15, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 20, 21, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0,
+    0, 0, 27, 28, 29, 30, 27, 28, 29, 30, 0, 0, 0, 0, 0, 0,
+    12, 0, 28, 28, 28, 28, 28, 28, 28, 28, 12, 0, 0, 0, 0, 0,
+    31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 33, 26, 26, 26, 26, 34, 35, 0, 0, 0, 0, 0, 0, 0,
+    36, 0, 26, 37, 0, 0, 0, 0, 0, 31, 26, 26, 0, 0, 38, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 34, 40, 41, 0, 0,
+    0, 42, 43, 0, 0, 0, 26, 26, 26, 44, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 26, 38, 0, 0, 0, 0, 0, 0, 31, 45, 46,
+    0, 0, 39, 47, 48, 49, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+    0, 0, 32, 26, 0, 0, 0, 0, 0, 51, 26, 26, 26, 26, 26, 26,
+    44, 0, 0, 0, 0, 0, 0, 52, 33, 53, 33, 0, 54, 0, 0, 0,
+    43, 0, 0, 0, 0, 0, 0, 55, 56, 46, 0, 0, 54, 0, 0, 57,
+    58, 0, 0, 0, 0, 0, 0, 55, 59, 60, 43, 0, 0, 0, 61, 0,
+    58, 0, 0, 0, 0, 0, 0, 55, 62, 53, 0, 0, 54, 0, 0, 51,
+    43, 0, 0, 0, 0, 0, 0, 63, 56, 46, 64, 0, 54, 0, 0, 0,
+    65, 0, 0, 0, 0, 0, 0, 0, 38, 46, 0, 0, 0, 0, 0, 0,
+    66, 0, 0, 0, 0, 0, 0, 67, 68, 41, 64, 0, 54, 0, 0, 0,
+    43, 0, 0, 0, 0, 0, 0, 63, 57, 69, 0, 0, 54, 0, 0, 0,
+    32, 0, 0, 0, 0, 0, 0, 70, 56, 46, 0, 0, 54, 0, 0, 0,
+    43, 0, 0, 0, 0, 0, 0, 0, 0, 65, 71, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 72, 44, 42, 73, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 72, 74, 0, 73, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 32, 0, 0, 75, 43, 0, 0, 0, 0, 0, 0, 33, 73,
+    76, 77, 26, 33, 26, 26, 26, 74, 57, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 77, 78, 79, 0, 0, 0, 80, 38, 0, 56, 0,
+    81, 46, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 83, 0, 0, 0, 54, 0, 0, 0, 54, 0, 0, 0, 54, 0,
+    0, 0, 0, 0, 0, 0, 84, 36, 57, 33, 45, 46, 0, 0, 0, 0,
+    0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 85, 38, 65, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 42, 86, 0, 0, 0, 0, 0, 0, 57, 73, 87, 74, 31, 40,
+    0, 0, 0, 0, 0, 0, 26, 26, 26, 73, 0, 0, 0, 0, 0, 0,
+    45, 0, 0, 0, 0, 0, 67, 37, 65, 0, 0, 0, 0, 31, 45, 0,
+    32, 0, 0, 0, 88, 89, 0, 0, 0, 0, 0, 0, 57, 90, 32, 0,
+    0, 0, 0, 0, 0, 91, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 26, 78, 53, 55, 32,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26,
+    0, 31, 94, 95, 4, 96, 97, 98, 0, 0, 0, 0, 76, 26, 99, 100,
+    101, 0, 0, 0, 0, 99, 0, 0, 0, 0, 26, 26, 26, 26, 38, 0,
+    102, 12, 98, 0, 103, 14, 0, 0, 0, 0, 104, 105, 28, 106, 28, 30,
+    0, 12, 28, 30, 0, 0, 0, 30, 0, 0, 107, 0, 100, 0, 0, 0,
+    10, 108, 109, 110, 111, 112, 113, 114, 0, 115, 116, 0, 117, 118, 0, 0,
+    118, 0, 119, 12, 119, 0, 0, 100, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 116, 120, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 123, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 106, 28, 28, 28, 28, 106, 0,
+    28, 28, 124, 0, 29, 30, 118, 114, 125, 126, 30, 0, 124, 100, 0, 127,
+    128, 129, 130, 131, 0, 0, 0, 0, 132, 82, 133, 0, 134, 135, 0, 136,
+    0, 0, 137, 15, 138, 120, 0, 139, 140, 141, 142, 28, 143, 144, 145, 146,
+    147, 120, 0, 0, 0, 148, 0, 119, 0, 149, 150, 0, 0, 0, 15, 28,
+    0, 0, 151, 0, 0, 0, 148, 136, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 152, 0, 0, 0, 0, 0, 0, 153, 30, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 32, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 154, 82, 155, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 156, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 155, 82, 82, 82, 82, 82, 28, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 0, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 93, 36,
+    0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    157, 158, 0, 0, 64, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 26, 26, 32, 42,
+    0, 0, 0, 0, 39, 36, 0, 0, 42, 26, 32, 0, 82, 82, 82, 82,
+    44, 0, 0, 0, 0, 0, 159, 160, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 161, 79, 0, 158, 55, 0, 0, 0, 0, 0, 55,
+    0, 0, 0, 0, 0, 0, 162, 68, 43, 0, 0, 0, 0, 69, 57, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 53, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 26, 26, 73, 31, 26, 26, 26, 26, 26, 45,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 82, 82, 26, 26, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    163, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 148, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 0, 0, 164,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    165, 91, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77,
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 26, 38, 0, 0, 0, 0, 0,
+    88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    43, 0, 0, 0, 0, 0, 0, 26, 73, 0, 0, 0, 0, 0, 166, 42,
+    32, 0, 0, 0, 0, 0, 167, 168, 65, 46, 0, 0, 0, 0, 0, 0,
+    44, 0, 0, 0, 42, 48, 74, 0, 0, 0, 0, 0, 0, 0, 158, 0,
+    32, 0, 0, 0, 0, 0, 39, 73, 0, 169, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 42, 170, 57, 43, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 31, 44, 0, 0,
+    32, 0, 0, 0, 0, 0, 0, 70, 38, 0, 0, 0, 39, 74, 74, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 26, 71, 0, 0, 57, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 31, 171, 172, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 88, 84, 38, 0, 0, 69, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 31, 173, 38, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 174, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 77, 175, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 42, 26, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 176, 158, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 54, 38, 0, 0, 0,
+    33, 44, 0, 0, 0, 0, 31, 177, 42, 0, 161, 50, 0, 0, 0, 0,
+    0, 51, 73, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 73, 34, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 51, 26, 26, 51, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 161, 179, 34, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0,
+    32, 0, 0, 0, 0, 0, 39, 44, 180, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 26, 26, 181, 26, 36, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0,
+    0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0,
+    0, 42, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 182, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 64, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 36, 26, 26, 73, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 32, 31, 26,
+    183, 45, 0, 0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 26, 73, 31, 26, 26, 26, 26, 26, 74, 46, 0,
+    55, 0, 0, 31, 33, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    73, 26, 26, 184, 185, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 91, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 44, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0,
+    28, 187, 28, 28, 28, 188, 28, 28, 28, 28, 28, 28, 28, 30, 28, 28,
+    28, 141, 189, 190, 28, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 148, 151, 192, 82, 82, 82, 82, 82, 82, 82, 82, 193,
+    82, 82, 133, 0, 82, 82, 82, 82, 82, 194, 133, 0, 82, 82, 195, 82,
+    82, 82, 82, 82, 82, 82, 82, 155, 196, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 197,
+    82, 82, 82, 82, 82, 82, 82, 198, 0, 199, 82, 82, 82, 0, 0, 200,
+    0, 0, 127, 0, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 198, 186, 202, 203, 0, 152, 203, 204,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 133, 148, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 203, 82, 82, 82, 82, 82, 205, 192, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 198,
+    43, 0, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 188,
+};
+
+static const uint8_t wcwidth_page_leaf[1648] = {
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 9, 5, 5, 9,
+    9, 5, 9, 5, 5, 5, 9, 5, 9, 9, 9, 9, 9, 5, 9, 9,
+    9, 9, 9, 5, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5, 9, 5,
+    9, 5, 5, 5, 5, 5, 5, 9, 9, 5, 5, 5, 5, 5, 9, 9,
+    9, 9, 5, 5, 5, 5, 9, 5, 9, 9, 9, 5, 9, 9, 5, 5,
+    9, 5, 9, 9, 5, 5, 5, 9, 9, 9, 9, 5, 9, 5, 9, 5,
+    5, 9, 5, 5, 5, 5, 5, 5, 5, 9, 5, 9, 5, 5, 5, 5,
+    5, 5, 5, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 9, 9,
+    5, 9, 9, 9, 5, 5, 5, 5, 9, 9, 9, 5, 9, 5, 5, 5,
+    9, 9, 9, 9, 5, 9, 5, 5, 5, 5, 9, 9, 5, 5, 5, 5,
+    9, 5, 9, 5, 9, 5, 9, 5, 9, 5, 9, 5, 9, 5, 5, 5,
+    5, 5, 5, 5, 9, 5, 5, 9, 5, 9, 9, 9, 5, 9, 5, 5,
+    9, 5, 5, 5, 5, 5, 5, 5, 9, 9, 9, 9, 5, 9, 5, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 9, 9, 9, 9, 9,
+    9, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0,
+    0, 0, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 5, 0, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 5, 0, 5, 5, 5,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    0, 0, 0, 0, 0, 5, 5, 0, 0, 5, 0, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 5, 5,
+    0, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 0, 5, 5, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 5, 5,
+    5, 0, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    5, 5, 0, 5, 0, 5, 5, 5, 0, 5, 5, 5, 5, 0, 5, 5,
+    5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5,
+    5, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5,
+    5, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 0,
+    0, 5, 5, 0, 0, 0, 5, 5, 0, 0, 5, 5, 5, 0, 5, 5,
+    5, 0, 0, 0, 0, 0, 5, 0, 5, 5, 5, 5, 0, 5, 5, 0,
+    5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 0, 5, 5, 5, 5, 5,
+    0, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0, 0,
+    0, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 0, 0, 5, 5,
+    5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 5, 0, 5,
+    5, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 0,
+    0, 0, 0, 0, 0, 5, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 0, 5, 0, 0, 5, 5, 0, 0, 5,
+    0, 0, 5, 5, 5, 5, 0, 0, 5, 5, 0, 5, 5, 0, 0, 5,
+    10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 0, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 0, 0, 5, 0, 0, 0, 0, 5, 5, 5, 5, 0,
+    0, 5, 5, 0, 5, 5, 5, 5, 0, 5, 0, 5, 5, 0, 0, 0,
+    5, 5, 0, 0, 0, 0, 5, 5, 0, 0, 5, 0, 0, 0, 5, 5,
+    0, 0, 5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+    9, 5, 5, 9, 9, 9, 9, 5, 9, 9, 5, 5, 9, 9, 5, 5,
+    5, 5, 0, 0, 0, 0, 0, 5, 9, 5, 9, 9, 5, 9, 5, 5,
+    5, 5, 5, 9, 5, 5, 9, 5, 5, 5, 5, 5, 9, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 9, 5, 9, 9, 9, 9, 5, 5, 5,
+    5, 5, 5, 9, 5, 9, 5, 5, 5, 9, 9, 5, 5, 5, 9, 5,
+    5, 5, 5, 9, 9, 5, 5, 5, 5, 5, 5, 9, 9, 9, 9, 5,
+    9, 9, 9, 9, 5, 5, 5, 5, 5, 5, 9, 5, 9, 5, 5, 5,
+    9, 5, 5, 9, 5, 5, 5, 9, 5, 9, 5, 5, 5, 9, 5, 5,
+    5, 5, 9, 5, 5, 9, 9, 9, 9, 5, 5, 9, 5, 9, 5, 9,
+    9, 9, 9, 9, 9, 5, 9, 5, 5, 5, 5, 5, 9, 9, 9, 9,
+    5, 5, 5, 5, 9, 9, 5, 5, 9, 5, 5, 5, 9, 5, 5, 5,
+    5, 5, 9, 5, 5, 5, 5, 5, 9, 9, 5, 5, 9, 9, 9, 9,
+    5, 5, 9, 9, 5, 5, 9, 9, 5, 5, 5, 5, 5, 9, 5, 5,
+    5, 5, 10, 10, 5, 5, 5, 5, 5, 10, 10, 5, 5, 5, 5, 5,
+    5, 10, 10, 10, 10, 5, 5, 5, 10, 5, 5, 10, 5, 5, 5, 5,
+    5, 5, 9, 9, 9, 9, 5, 5, 9, 9, 5, 5, 5, 5, 9, 9,
+    9, 5, 5, 9, 5, 5, 9, 9, 5, 5, 5, 5, 5, 10, 10, 5,
+    5, 5, 5, 5, 5, 9, 9, 5, 5, 9, 5, 5, 5, 5, 9, 9,
+    5, 5, 5, 5, 10, 10, 5, 5, 5, 5, 5, 5, 9, 5, 9, 5,
+    9, 5, 9, 5, 5, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 5,
+    9, 9, 5, 9, 9, 9, 5, 9, 9, 9, 9, 5, 9, 9, 5, 9,
+    5, 5, 5, 5, 5, 5, 5, 10, 5, 5, 5, 10, 5, 5, 5, 5,
+    5, 10, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 9,
+    5, 5, 5, 5, 10, 10, 9, 9, 9, 9, 9, 9, 9, 9, 10, 9,
+    9, 9, 9, 9, 10, 9, 9, 9, 9, 9, 5, 9, 5, 5, 5, 5,
+    9, 9, 10, 9, 9, 9, 9, 9, 9, 9, 10, 10, 9, 10, 9, 9,
+    9, 9, 10, 9, 9, 10, 9, 9, 5, 5, 5, 5, 5, 10, 5, 5,
+    10, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 10, 5, 10, 5,
+    5, 5, 5, 10, 10, 10, 5, 10, 5, 5, 5, 5, 5, 10, 10, 10,
+    5, 5, 5, 10, 10, 5, 5, 5, 10, 5, 5, 5, 5, 10, 9, 9,
+    10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5,
+    10, 0, 0, 10, 10, 10, 10, 10, 5, 5, 0, 5, 5, 5, 0, 5,
+    5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 0, 0,
+    0, 0, 5, 5, 0, 0, 5, 5, 5, 0, 0, 0, 0, 0, 0, 5,
+    0, 5, 0, 0, 0, 5, 5, 0, 5, 10, 10, 10, 10, 10, 10, 10,
+    5, 0, 0, 0, 5, 9, 5, 5, 5, 0, 0, 0, 5, 0, 0, 5,
+    0, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5,
+    5, 0, 0, 5, 5, 0, 5, 5, 5, 0, 0, 0, 0, 5, 5, 0,
+    0, 0, 5, 5, 0, 5, 0, 0, 0, 5, 0, 5, 5, 5, 5, 0,
+    0, 5, 0, 0, 5, 5, 5, 5, 0, 0, 0, 5, 5, 0, 5, 0,
+    5, 5, 5, 0, 5, 0, 5, 5, 5, 5, 0, 0, 0, 0, 5, 0,
+    5, 5, 5, 0, 0, 5, 0, 5, 0, 5, 5, 0, 0, 0, 0, 5,
+    0, 5, 0, 0, 5, 0, 0, 5, 5, 5, 0, 5, 0, 0, 5, 0,
+    0, 5, 0, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 0,
+    10, 10, 10, 10, 0, 10, 10, 10, 0, 0, 0, 5, 5, 0, 0, 0,
+    0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 5, 0, 0,
+    5, 5, 5, 5, 10, 5, 5, 5, 9, 9, 9, 5, 5, 5, 5, 5,
+    9, 9, 9, 9, 9, 9, 5, 5, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5,
+    10, 10, 10, 10, 10, 10, 5, 10, 10, 10, 10, 10, 10, 5, 10, 10,
+    10, 10, 10, 5, 5, 5, 5, 10, 10, 5, 5, 5, 10, 5, 5, 5,
+    10, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 10,
+    10, 10, 10, 10, 10, 10, 5, 5, 5, 5, 5, 10, 10, 10, 10, 5,
+    5, 5, 10, 5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10,
+    10, 10, 10, 5, 5, 10, 10, 10, 5, 5, 5, 5, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 5, 5, 5, 10, 10, 10, 5, 10, 10, 10, 10,
+};
+
+/* 8432 bytes of index and block data */
@@ -63,6 +63,7 @@ No supporting OS subroutines are required.
 wchar_t *
 wmemchr(const wchar_t *s, wchar_t c, size_t n)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     size_t i;
 
     for (i = 0; i < n; i++) {
@@ -73,4 +74,22 @@ wmemchr(const wchar_t *s, wchar_t c, size_t n)
         s++;
     }
     return NULL;
+#else
+    /* Four characters per iteration */
+    for (; n >= 4; n -= 4, s += 4) {
+        if (s[0] == c)
+            return (wchar_t *)s;
+        if (s[1] == c)
+            return (wchar_t *)s + 1;
+        if (s[2] == c)
+            return (wchar_t *)s + 2;
+        if (s[3] == c)
+            return (wchar_t *)s + 3;
+    }
+    for (; n; n--, s++) {
+        if (*s == c)
+            return (wchar_t *)s;
+    }
+    return NULL;
+#endif
 }
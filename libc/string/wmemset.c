@@ -55,11 +55,13 @@ No supporting OS subroutines are required.
  *	citrus Id: wmemset.c,v 1.2 2000/12/20 14:08:31 itojun Exp
  */
 
+#include <string.h>
 #include <wchar.h>
 
 wchar_t *
 wmemset(wchar_t *s, wchar_t c, size_t n)
 {
+#if defined(__PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
     size_t   i;
     wchar_t *p;
 
@@ -69,4 +71,24 @@ wmemset(wchar_t *s, wchar_t c, size_t n)
         p++;
     }
     return s;
+#else
+    wchar_t *p = s;
+    wchar_t  bytes;
+
+    /* Zero and other fills of identical bytes are a memset */
+    memset(&bytes, (unsigned char)c, sizeof(bytes));
+    if (c == bytes)
+        return memset(s, (unsigned char)c, n * sizeof(wchar_t));
+
+    /* Four characters per iteration */
+    for (; n >= 4; n -= 4, p += 4) {
+        p[0] = c;
+        p[1] = c;
+        p[2] = c;
+        p[3] = c;
+    }
+    for (; n; n--)
+        *p++ = c;
+    return s;
+#endif
 }
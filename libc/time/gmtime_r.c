@@ -34,6 +34,7 @@ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
  */
 
 #include "local.h"
+#include "../stdlib/local-divmod.h"
 
 /* Move epoch from 01.01.1970 to 01.03.0000 (yes, Year 0) - this is the first
  * day of a 400-year long "era", right after additional day of leap year.
@@ -61,29 +62,64 @@ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
 /* number of years per era */
 #define YEARS_PER_ERA 400
 
-struct tm *
-gmtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
+/*
+ * Times within this many seconds of the epoch (shifted so the range
+ * starts at 1 March -6400) take the 32-bit path below. The shifted
+ * value has to fit in 39 bits so that dropping the power-of-two
+ * factor of SECSPERDAY (86400 = 128 * 675) leaves a 32-bit quotient.
+ * That covers the years -6400 to about 11000.
+ */
+#define FAST_SHIFT_ERAS 16
+#define FAST_SHIFT_DAYS (EPOCH_ADJUSTMENT_DAYS + FAST_SHIFT_ERAS * DAYS_PER_ERA)
+#define FAST_SHIFT_SECS ((int64_t)FAST_SHIFT_DAYS * SECSPERDAY)
+#define FAST_LIMIT      ((uint64_t)1 << 39)
+
+/*
+ * Convert days since 1 March -6400 to a civil date using only 32-bit
+ * unsigned arithmetic. This is the Euclidean affine form from Neri and
+ * Schneider, "Euclidean affine functions and their application to
+ * calendar algorithms"; every division is by a constant so the
+ * compiler turns them into multiplies and shifts.
+ */
+static void
+civil_from_days_fast(uint32_t n, struct tm *res)
+{
+    uint32_t n1, century, cday, n2, cyear, yearday, n3, month, jan_feb;
+    int      leap;
+
+    res->tm_wday = (int)((n + ADJUSTED_EPOCH_WDAY) % DAYSPERWEEK);
+
+    n1 = 4 * n + 3;
+    century = n1 / DAYS_PER_ERA;
+    cday = n1 % DAYS_PER_ERA / 4;               /* [0, 36524] */
+    n2 = 4 * cday + 3;
+    cyear = n2 / DAYS_PER_4_YEARS;              /* [0, 99] */
+    yearday = n2 % DAYS_PER_4_YEARS / 4;        /* [0, 365], from 1 March */
+    n3 = 2141 * yearday + 197913;
+    month = n3 >> 16;                           /* [3, 14] */
+    jan_feb = yearday >= DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY;
+    leap = (cyear & 3) == 0 && (cyear != 0 || (century & 3) == 0);
+
+    res->tm_mday = (int)((n3 & 0xffff) / 2141) + 1;
+    res->tm_mon = (int)(jan_feb ? month - 13 : month - 1);
+    res->tm_year = (int)(100 * century + cyear + jan_feb)
+        - FAST_SHIFT_ERAS * YEARS_PER_ERA - YEAR_BASE;
+    res->tm_yday = (int)(jan_feb
+                             ? yearday - (DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY)
+                             : yearday + DAYS_IN_JANUARY + DAYS_IN_FEBRUARY + leap);
+}
+
+/*
+ * Convert days since 1 March 0000 to a civil date for times outside
+ * the range handled by civil_from_days_fast.
+ */
+static void
+civil_from_days(time_t days, struct tm *res)
 {
-    long          rem;
-    time_t        days;
-    const time_t  lcltime = *tim_p;
     int           era, weekday, year;
     unsigned      erayear, yearday, month, day;
     unsigned long eraday;
 
-    days = lcltime / SECSPERDAY + EPOCH_ADJUSTMENT_DAYS;
-    rem = lcltime % SECSPERDAY;
-    if (rem < 0) {
-        rem += SECSPERDAY;
-        --days;
-    }
-
-    /* compute hour, min, and sec */
-    res->tm_hour = (int)(rem / SECSPERHOUR);
-    rem %= SECSPERHOUR;
-    res->tm_min = (int)(rem / SECSPERMIN);
-    res->tm_sec = (int)(rem % SECSPERMIN);
-
     /* compute day of week */
     if ((weekday = ((ADJUSTED_EPOCH_WDAY + days) % DAYSPERWEEK)) < 0)
         weekday += DAYSPERWEEK;
@@ -109,6 +145,41 @@ gmtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
     res->tm_year = year - YEAR_BASE;
     res->tm_mon = month;
     res->tm_mday = day;
+}
+
+struct tm *
+gmtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
+{
+    long         rem;
+    const time_t lcltime = *tim_p;
+    uint64_t     shifted = (uint64_t)((int64_t)lcltime + FAST_SHIFT_SECS);
+
+    if (shifted < FAST_LIMIT) {
+        /*
+         * Split off the seconds of the day with one 32-bit division
+         * instead of a 64-bit divide and modulo
+         */
+        uint32_t q = (uint32_t)(shifted >> 7);
+        uint32_t n = q / (SECSPERDAY >> 7);
+
+        rem = (long)(((q - n * (SECSPERDAY >> 7)) << 7) | ((uint32_t)shifted & 0x7f));
+        civil_from_days_fast(n, res);
+    } else {
+        long long rem_day;
+        time_t    days = __divmod_ll(lcltime, SECSPERDAY, &rem_day) + EPOCH_ADJUSTMENT_DAYS;
+
+        rem = (long)rem_day;
+        if (rem < 0) {
+            rem += SECSPERDAY;
+            --days;
+        }
+        civil_from_days(days, res);
+    }
+
+    /* compute hour, min, and sec */
+    res->tm_hour = (int)__divmod_l(rem, SECSPERHOUR, &rem);
+    res->tm_min = (int)__divmod_l(rem, SECSPERMIN, &rem);
+    res->tm_sec = (int)rem;
 
     res->tm_isdst = 0;
 
@@ -30,6 +30,21 @@ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
  */
 
 #include "local.h"
+#include "../stdlib/local-divmod.h"
+
+/*
+ * The last conversion, and the span of times around it that share its
+ * local date and UTC offset. Times within the span only need their
+ * time of day worked out, which makes repeated calls for nearby times
+ * (log timestamps, say) much cheaper.
+ */
+static struct {
+    time_t    time;
+    time_t    start, end;
+    long      sod; /* local seconds since midnight at time */
+    unsigned  gen;
+    struct tm tm;
+} last;
 
 struct tm *
 localtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
@@ -39,32 +54,43 @@ localtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
     int                   year;
     __tzinfo_type * const tz = __gettzinfo();
     const uint8_t        *ip;
+    time_t                t = *tim_p;
+    time_t                start = 0, end = 0, day;
+    int                   window = 0;
+
+    TZ_LOCK;
+    _tzset_unlocked();
+
+    if (last.gen == __tzgen && last.start <= t && t < last.end) {
+        long sod = last.sod + (long)(t - last.time);
+
+        *res = last.tm;
+        res->tm_hour = (int)__divmod_l(sod, SECSPERHOUR, &sod);
+        res->tm_min = (int)__divmod_l(sod, SECSPERMIN, &sod);
+        res->tm_sec = (int)sod;
+        TZ_UNLOCK;
+        return res;
+    }
 
     res = gmtime_r(tim_p, res);
 
     year = res->tm_year + YEAR_BASE;
     ip = __month_lengths[isleap(year)];
 
-    TZ_LOCK;
-    _tzset_unlocked();
     if (_daylight) {
-        if (year == tz->__tzyear || __tzcalc_limits(year))
-            res->tm_isdst
-                = (tz->__tznorth
-                       ? (*tim_p >= tz->__tzrule[0].change && *tim_p < tz->__tzrule[1].change)
-                       : (*tim_p >= tz->__tzrule[0].change || *tim_p < tz->__tzrule[1].change));
-        else
+        if (year == tz->__tzyear || __tzcalc_limits(year)) {
+            res->tm_isdst = __tzcalc_window(t, &start, &end);
+            window = 1;
+        } else
             res->tm_isdst = -1;
     } else
         res->tm_isdst = 0;
 
     offset = (res->tm_isdst == 1 ? tz->__tzrule[1].offset : tz->__tzrule[0].offset);
 
-    hours = (int)(offset / SECSPERHOUR);
-    offset = offset % SECSPERHOUR;
-
-    mins = (int)(offset / SECSPERMIN);
-    secs = (int)(offset % SECSPERMIN);
+    hours = (int)__divmod_l(offset, SECSPERHOUR, &offset);
+    mins = (int)__divmod_l(offset, SECSPERMIN, &offset);
+    secs = (int)offset;
 
     res->tm_sec -= secs;
     res->tm_min -= mins;
@@ -117,6 +143,23 @@ localtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
             res->tm_mday = ip[res->tm_mon];
         }
     }
+
+    if (res->tm_isdst >= 0) {
+        long sod = res->tm_hour * SECSPERHOUR + res->tm_min * SECSPERMIN + res->tm_sec;
+
+        /* Clip the offset's span to the local day */
+        day = t - sod;
+        if (!window || start < day)
+            start = day;
+        if (!window || end > day + SECSPERDAY)
+            end = day + SECSPERDAY;
+        last.time = t;
+        last.start = start;
+        last.end = end;
+        last.sod = sod;
+        last.gen = __tzgen;
+        last.tm = *res;
+    }
     TZ_UNLOCK;
 
     return (res);
@@ -33,10 +33,30 @@ isleap(int y)
 
 int                  __tzcalc_limits(int __year);
 
+long                 __days_from_civil(int __y, int __m, int __d);
+
+char                *__strptime_iso8601(const char *__buf, char __sep, struct tm *__t, long *__days);
+
 extern const uint8_t __month_lengths[2][MONSPERYEAR];
 
+/* "00" through "99", used to write two digits at a time */
+extern const char    __time_digits2[201];
+
+static inline char *
+__time_put2(char *p, unsigned v)
+{
+    p[0] = __time_digits2[2 * v];
+    p[1] = __time_digits2[2 * v + 1];
+    return p + 2;
+}
+
 void                 _tzset_unlocked(void);
 
+/* Changes whenever _tzset_unlocked parses a new TZ value */
+extern unsigned      __tzgen;
+
+int                  __tzcalc_window(time_t __t, time_t *__start, time_t *__end);
+
 /* locks for multi-threading */
 #define TZ_LOCK   __LIBC_LOCK()
 #define TZ_UNLOCK __LIBC_UNLOCK()
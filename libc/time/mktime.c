@@ -87,6 +87,25 @@ static const int16_t _DAYS_BEFORE_MONTH[12]
 
 #define _DAYS_IN_YEAR(year) (isleap(year + YEAR_BASE) ? 366 : 365)
 
+/*
+ * The leap year counts in days_before_year are taken on the year shifted
+ * by a whole number of 400-year cycles, which keeps the value positive
+ * for every year mktime accepts and leaves the count of leap days
+ * between two years unchanged.
+ */
+#define LEAP_SHIFT_YEARS 12000
+#define LEAPS_BEFORE(y)  ((y) / 4 - (y) / 100 + (y) / 400)
+
+/* Days from 1 January 1970 to 1 January of the given tm_year */
+static long
+days_before_year(int year)
+{
+    unsigned y = (unsigned)(year + YEAR_BASE - 1 + LEAP_SHIFT_YEARS);
+
+    return 365L * (year + YEAR_BASE - EPOCH_YEAR) + (long)LEAPS_BEFORE(y)
+        - LEAPS_BEFORE(EPOCH_YEAR - 1 + LEAP_SHIFT_YEARS);
+}
+
 static void
 set_tm_wday(long days, struct tm *tim_p)
 {
@@ -166,7 +185,6 @@ mktime_utc(struct tm *tim_p, long *days_p)
 {
     time_t tim = 0;
     long   days = 0;
-    int    year;
 
     /* validate structure */
     validate_structure(tim_p);
@@ -187,14 +205,7 @@ mktime_utc(struct tm *tim_p, long *days_p)
         return (time_t)-1;
 
     /* compute days in other years */
-    if ((year = tim_p->tm_year) > 70) {
-        for (year = 70; year < tim_p->tm_year; year++)
-            days += _DAYS_IN_YEAR(year);
-    } else if (year < 70) {
-        for (year = 69; year > tim_p->tm_year; year--)
-            days -= _DAYS_IN_YEAR(year);
-        days -= _DAYS_IN_YEAR(year);
-    }
+    days += days_before_year(tim_p->tm_year);
 
     /* compute total seconds */
     tim += (time_t)days * SECSPERDAY;
@@ -0,0 +1,350 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * strftime_compile() parses a strftime format once into a list of
+ * operations which strftime_compiled() then runs against a struct tm.
+ *
+ * Literal text is kept as references into the original format string,
+ * which must stay valid as long as the compiled format is used. The
+ * numeric conversions %Y %m %d %e %H %M %S %j, the composites %F %T %R
+ * and %n %t %% are run directly, writing two digits at a time. Any
+ * conversion with a flag, a field width or an E or O modifier and
+ * every other conversion is handed to strftime, so the output is
+ * always the same as strftime would produce for the whole format in
+ * the current locale.
+ *
+ * strftime_compile() returns 0 on success. It returns -1 with errno
+ * set to EINVAL if the format ends in the middle of a conversion, or
+ * to E2BIG if the format needs more than STRFTIME_FORMAT_OPS
+ * operations, is longer than 65535 bytes or contains a conversion
+ * longer than SPEC_MAX bytes.
+ */
+
+#include "local.h"
+#include <errno.h>
+#include <string.h>
+
+enum {
+    OP_LIT,     /* __arg bytes of the format at __off */
+    OP_CHAR,    /* the character __arg */
+    OP_STRFTIME,/* the __arg byte conversion at __off, run by strftime */
+    OP_YEAR,
+    OP_MON,
+    OP_MDAY,
+    OP_MDAY_SP,
+    OP_HOUR,
+    OP_MIN,
+    OP_SEC,
+    OP_YDAY,
+};
+
+/* Longest conversion passed to strftime, including the '%' */
+#define SPEC_MAX       16
+
+/* Conversions handed to strftime are formatted here first */
+#define SPEC_BUF_SIZE  128
+
+static int
+add_op(struct strftime_format *cf, unsigned op, unsigned arg, size_t off)
+{
+    if (cf->__nops >= STRFTIME_FORMAT_OPS || off > 0xffff) {
+        errno = E2BIG;
+        return -1;
+    }
+    cf->__ops[cf->__nops].__op = op;
+    cf->__ops[cf->__nops].__arg = arg;
+    cf->__ops[cf->__nops].__off = off;
+    cf->__nops++;
+    return 0;
+}
+
+int
+strftime_compile(struct strftime_format * __restrict cf, const char * __restrict fmt)
+{
+    const char *p = fmt;
+
+    cf->__fmt = fmt;
+    cf->__nops = 0;
+
+    while (*p) {
+        const char *start = p;
+        int         plain = 1;
+
+        if (*p != '%') {
+            while (*p && *p != '%')
+                p++;
+            while (start < p) {
+                size_t len = p - start;
+                if (len > 255)
+                    len = 255;
+                if (add_op(cf, OP_LIT, len, start - fmt) < 0)
+                    return -1;
+                start += len;
+            }
+            continue;
+        }
+
+        /* Skip the same flags, width and modifiers strftime accepts */
+        p++;
+        if (*p == '0' || *p == '+') {
+            p++;
+            plain = 0;
+        }
+        if (*p >= '1' && *p <= '9') {
+            while (*p >= '0' && *p <= '9')
+                p++;
+            plain = 0;
+        }
+        if (*p == 'E' || *p == 'O') {
+            p++;
+            plain = 0;
+        }
+        if (*p == '\0') {
+            errno = EINVAL;
+            return -1;
+        }
+
+        int r;
+        if (!plain)
+            r = -2;
+        else {
+            switch (*p) {
+            case 'Y':
+                r = add_op(cf, OP_YEAR, 0, 0);
+                break;
+            case 'm':
+                r = add_op(cf, OP_MON, 0, 0);
+                break;
+            case 'd':
+                r = add_op(cf, OP_MDAY, 0, 0);
+                break;
+            case 'e':
+                r = add_op(cf, OP_MDAY_SP, 0, 0);
+                break;
+            case 'H':
+                r = add_op(cf, OP_HOUR, 0, 0);
+                break;
+            case 'M':
+                r = add_op(cf, OP_MIN, 0, 0);
+                break;
+            case 'S':
+                r = add_op(cf, OP_SEC, 0, 0);
+                break;
+            case 'j':
+                r = add_op(cf, OP_YDAY, 0, 0);
+                break;
+            case 'F':
+                if ((r = add_op(cf, OP_YEAR, 0, 0)) < 0 || (r = add_op(cf, OP_CHAR, '-', 0)) < 0
+                    || (r = add_op(cf, OP_MON, 0, 0)) < 0 || (r = add_op(cf, OP_CHAR, '-', 0)) < 0)
+                    break;
+                r = add_op(cf, OP_MDAY, 0, 0);
+                break;
+            case 'T':
+            case 'R':
+                if ((r = add_op(cf, OP_HOUR, 0, 0)) < 0 || (r = add_op(cf, OP_CHAR, ':', 0)) < 0
+                    || (r = add_op(cf, OP_MIN, 0, 0)) < 0 || *p == 'R')
+                    break;
+                if ((r = add_op(cf, OP_CHAR, ':', 0)) < 0)
+                    break;
+                r = add_op(cf, OP_SEC, 0, 0);
+                break;
+            case 'n':
+                r = add_op(cf, OP_CHAR, '\n', 0);
+                break;
+            case 't':
+                r = add_op(cf, OP_CHAR, '\t', 0);
+                break;
+            case '%':
+                r = add_op(cf, OP_CHAR, '%', 0);
+                break;
+            default:
+                r = -2;
+                break;
+            }
+        }
+        p++;
+        if (r == -2) {
+            if (p - start > SPEC_MAX) {
+                errno = E2BIG;
+                return -1;
+            }
+            r = add_op(cf, OP_STRFTIME, p - start, start - fmt);
+        }
+        if (r < 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* Write v as two digits if it is in [0, 99], otherwise return NULL */
+static char *
+put2(char *d, int v)
+{
+    if ((unsigned)v > 99)
+        return NULL;
+    return __time_put2(d, (unsigned)v);
+}
+
+/*
+ * Run one conversion through strftime. The conversion is prefixed with
+ * a literal character so that a return of zero always means the output
+ * did not fit, even for conversions which may legitimately be empty.
+ */
+static size_t
+run_strftime(char *s, size_t avail, const char *spec, size_t speclen, const struct tm *t)
+{
+    char   fmt[SPEC_MAX + 2];
+    char   buf[SPEC_BUF_SIZE];
+    size_t len;
+
+    fmt[0] = '|';
+    memcpy(fmt + 1, spec, speclen);
+    fmt[speclen + 1] = '\0';
+
+    len = strftime(buf, sizeof(buf), fmt, t);
+    if (len != 0) {
+        len--;
+        if (len >= avail)
+            return (size_t)-1;
+        memcpy(s, buf + 1, len);
+        return len;
+    }
+
+    /* Longer than the local buffer; format in place */
+    len = strftime(s, avail, fmt + 1, t);
+    if (len == 0)
+        return (size_t)-1;
+    return len;
+}
+
+size_t
+strftime_compiled(char * __restrict s, size_t maxsize, const struct strftime_format * __restrict cf,
+                  const struct tm * __restrict t)
+{
+    size_t   count = 0;
+    unsigned i;
+
+    if (maxsize == 0)
+        return 0;
+
+    for (i = 0; i < cf->__nops; i++) {
+        unsigned    op = cf->__ops[i].__op;
+        unsigned    arg = cf->__ops[i].__arg;
+        const char *src = cf->__fmt + cf->__ops[i].__off;
+        char        tmp[4], *d, *e = NULL;
+        size_t      len;
+
+        /* Fast conversions write at most four bytes; use tmp near the end */
+        d = maxsize - count > sizeof(tmp) ? s + count : tmp;
+
+        switch (op) {
+        case OP_LIT:
+            if (arg >= maxsize - count)
+                return 0;
+            memcpy(s + count, src, arg);
+            count += arg;
+            continue;
+        case OP_CHAR:
+            d[0] = (char)arg;
+            e = d + 1;
+            break;
+        case OP_YEAR:
+            if (t->tm_year >= 1000 - YEAR_BASE && t->tm_year <= 9999 - YEAR_BASE) {
+                unsigned y = (unsigned)(t->tm_year + YEAR_BASE);
+                e = __time_put2(__time_put2(d, y / 100), y % 100);
+            }
+            src = "%Y";
+            break;
+        case OP_MON:
+            e = put2(d, t->tm_mon + 1);
+            src = "%m";
+            break;
+        case OP_MDAY:
+            e = put2(d, t->tm_mday);
+            src = "%d";
+            break;
+        case OP_MDAY_SP:
+            if ((unsigned)t->tm_mday <= 9) {
+                d[0] = ' ';
+                d[1] = '0' + t->tm_mday;
+                e = d + 2;
+            } else
+                e = put2(d, t->tm_mday);
+            src = "%e";
+            break;
+        case OP_HOUR:
+            e = put2(d, t->tm_hour);
+            src = "%H";
+            break;
+        case OP_MIN:
+            e = put2(d, t->tm_min);
+            src = "%M";
+            break;
+        case OP_SEC:
+            e = put2(d, t->tm_sec);
+            src = "%S";
+            break;
+        case OP_YDAY:
+            if ((unsigned)t->tm_yday <= 998) {
+                unsigned v = t->tm_yday + 1;
+                d[0] = '0' + v / 100;
+                e = __time_put2(d + 1, v % 100);
+            }
+            src = "%j";
+            break;
+        default:
+            break;
+        }
+
+        if (e) {
+            len = e - d;
+            if (d == tmp) {
+                if (len >= maxsize - count)
+                    return 0;
+                memcpy(s + count, tmp, len);
+            }
+        } else {
+            /* A general conversion or a field out of the fast range */
+            len = run_strftime(s + count, maxsize - count, src,
+                               op == OP_STRFTIME ? arg : strlen(src), t);
+            if (len == (size_t)-1)
+                return 0;
+        }
+        count += len;
+    }
+    s[count] = '\0';
+    return count;
+}
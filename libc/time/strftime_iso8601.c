@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * strftime_iso8601() formats a struct tm as "YYYY-MM-DDTHH:MM:SS",
+ * the same text as strftime with "%Y-%m-%dT%H:%M:%S".
+ *
+ * strftime_rfc3339() appends the UTC offset utcoff (in seconds east of
+ * UTC) to that, as "Z" when it is zero and as "+hh:mm" or "-hh:mm"
+ * otherwise. Any seconds in the offset are dropped.
+ *
+ * Both return the number of characters written, not counting the
+ * terminating NUL, or 0 if the result does not fit in maxsize bytes.
+ * Years from 1000 to 9999 with all fields in range are written a pair
+ * of digits at a time; anything else is passed to strftime.
+ */
+
+#include "local.h"
+#include <string.h>
+
+#define ISO8601_LEN 19
+
+static size_t
+iso8601(char *s, size_t maxsize, const struct tm *t)
+{
+    char    *p = s;
+    unsigned y = (unsigned)t->tm_year + YEAR_BASE;
+
+    if (t->tm_year < 1000 - YEAR_BASE || t->tm_year > 9999 - YEAR_BASE
+        || (unsigned)t->tm_mon > 98 || (unsigned)t->tm_mday > 99 || (unsigned)t->tm_hour > 99
+        || (unsigned)t->tm_min > 99 || (unsigned)t->tm_sec > 99) {
+        size_t len = strftime(s, maxsize, "%Y-%m-%dT%H:%M:%S", t);
+        return len ? len : (size_t)-1;
+    }
+    if (maxsize <= ISO8601_LEN)
+        return (size_t)-1;
+
+    p = __time_put2(p, y / 100);
+    p = __time_put2(p, y % 100);
+    *p++ = '-';
+    p = __time_put2(p, t->tm_mon + 1);
+    *p++ = '-';
+    p = __time_put2(p, t->tm_mday);
+    *p++ = 'T';
+    p = __time_put2(p, t->tm_hour);
+    *p++ = ':';
+    p = __time_put2(p, t->tm_min);
+    *p++ = ':';
+    p = __time_put2(p, t->tm_sec);
+    *p = '\0';
+    return ISO8601_LEN;
+}
+
+size_t
+strftime_iso8601(char * __restrict s, size_t maxsize, const struct tm * __restrict t)
+{
+    size_t len = iso8601(s, maxsize, t);
+
+    return len == (size_t)-1 ? 0 : len;
+}
+
+size_t
+strftime_rfc3339(char * __restrict s, size_t maxsize, const struct tm * __restrict t, long utcoff)
+{
+    size_t        len = iso8601(s, maxsize, t);
+    char         *p;
+    unsigned long off;
+
+    if (len == (size_t)-1)
+        return 0;
+    p = s + len;
+    if (utcoff == 0) {
+        if (maxsize - len < 2)
+            return 0;
+        *p++ = 'Z';
+    } else {
+        if (maxsize - len < 7)
+            return 0;
+        *p++ = utcoff < 0 ? '-' : '+';
+        off = utcoff < 0 ? -(unsigned long)utcoff : (unsigned long)utcoff;
+        off /= SECSPERMIN;
+        p = __time_put2(p, (off / MINSPERHOUR) % 100);
+        *p++ = ':';
+        p = __time_put2(p, off % MINSPERHOUR);
+    }
+    *p = '\0';
+    return p - s;
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * strptime_iso8601() parses "YYYY-MM-DDTHH:MM:SS", giving the same
+ * struct tm as strptime with "%Y-%m-%dT%H:%M:%S" does for that text.
+ * strptime dispatches the formats of that family to the same code.
+ *
+ * strptime_rfc3339() also accepts a lower case "t" or a space between
+ * date and time, requires the day to exist in its month and allows at
+ * most one leap second. Optional fractional seconds after "." or ","
+ * follow; only the first nine digits count. The UTC offset, "Z" or
+ * "+hh:mm" or "-hh:mm", is stored in *utcoff in seconds east of UTC,
+ * and the instant the text names in *ts. Either pointer may be NULL.
+ *
+ * Both return a pointer to the first character not parsed, or NULL if
+ * the text does not match. The fields are at fixed positions and the
+ * date goes straight to a day number, without the character by
+ * character format interpretation strptime does.
+ */
+
+#include "local.h"
+#include <string.h>
+
+#define NSEC_PER_SEC 1000000000L
+
+/* The two digits at s, or -1 */
+static int
+get2(const char *s)
+{
+    unsigned a = (unsigned char)s[0] - '0';
+    unsigned b = (unsigned char)s[1] - '0';
+
+    if (a > 9 || b > 9)
+        return -1;
+    return (int)(a * 10 + b);
+}
+
+/* Days since 1970-01-01 of a date in the proleptic Gregorian calendar */
+long
+__days_from_civil(int y, int m, int d)
+{
+    long     era;
+    unsigned yoe, doy, doe;
+
+    y -= m <= 2;
+    era = (y >= 0 ? y : y - 399) / 400;
+    yoe = (unsigned)(y - era * 400);
+    doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (long)doe - 719468;
+}
+
+char *
+__strptime_iso8601(const char *buf, char sep, struct tm *t, long *daysp)
+{
+    int  y, c, mon, mday, hour, min, sec;
+    long days;
+
+    if ((c = get2(buf)) < 0 || (y = get2(buf + 2)) < 0 || buf[4] != '-'
+        || (mon = get2(buf + 5)) < 1 || mon > 12 || buf[7] != '-' || (mday = get2(buf + 8)) < 1
+        || mday > 31)
+        return NULL;
+    if (sep ? buf[10] != sep : buf[10] != 'T' && buf[10] != 't' && buf[10] != ' ')
+        return NULL;
+    if ((hour = get2(buf + 11)) < 0 || hour > 23 || buf[13] != ':' || (min = get2(buf + 14)) < 0
+        || min > 59 || buf[16] != ':' || (sec = get2(buf + 17)) < 0 || sec > 61)
+        return NULL;
+
+    y += c * 100;
+    days = __days_from_civil(y, mon, mday);
+    memset(t, 0, sizeof(*t));
+    t->tm_year = y - YEAR_BASE;
+    t->tm_mon = mon - 1;
+    t->tm_mday = mday;
+    t->tm_hour = hour;
+    t->tm_min = min;
+    t->tm_sec = sec;
+    t->tm_yday = (int)(days - __days_from_civil(y, 1, 1));
+    t->tm_wday = (int)((days % DAYSPERWEEK + EPOCH_WDAY + DAYSPERWEEK) % DAYSPERWEEK);
+    t->tm_isdst = -1;
+    if (daysp)
+        *daysp = days;
+    return (char *)buf + 19;
+}
+
+char *
+strptime_iso8601(const char * __restrict buf, struct tm * __restrict t)
+{
+    return __strptime_iso8601(buf, 'T', t, NULL);
+}
+
+char *
+strptime_rfc3339(const char * __restrict buf, struct tm * __restrict t, long *utcoff,
+                 struct timespec *ts)
+{
+    const char *p;
+    long        days, nsec = 0, scale = NSEC_PER_SEC, off = 0;
+    int         oh, om;
+
+    p = __strptime_iso8601(buf, 0, t, &days);
+    if (!p || t->tm_sec > 60
+        || t->tm_mday > __month_lengths[isleap(t->tm_year + YEAR_BASE)][t->tm_mon])
+        return NULL;
+
+    if ((*p == '.' || *p == ',') && (unsigned)(p[1] - '0') <= 9) {
+        for (p++; (unsigned)(*p - '0') <= 9; p++) {
+            if (scale > 1) {
+                scale /= 10;
+                nsec += (*p - '0') * scale;
+            }
+        }
+    }
+
+    if (*p == 'Z' || *p == 'z') {
+        p++;
+    } else if (*p == '+' || *p == '-') {
+        if ((oh = get2(p + 1)) < 0 || oh > 23 || p[3] != ':' || (om = get2(p + 4)) < 0 || om > 59)
+            return NULL;
+        off = oh * SECSPERHOUR + om * SECSPERMIN;
+        if (*p == '-')
+            off = -off;
+        p += 6;
+    } else {
+        return NULL;
+    }
+
+    if (utcoff)
+        *utcoff = off;
+    if (ts) {
+        ts->tv_sec = (time_t)days * SECSPERDAY + t->tm_hour * SECSPERHOUR + t->tm_min * SECSPERMIN
+                     + t->tm_sec - off;
+        ts->tv_nsec = nsec;
+    }
+    return (char *)p;
+}
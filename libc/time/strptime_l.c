@@ -42,6 +42,7 @@
 #include <inttypes.h>
 #include <limits.h>
 #include "locale_private.h"
+#include "local.h"
 
 static const int _DAYS_BEFORE_MONTH[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
 
@@ -94,11 +95,8 @@ match_string(const char * __restrict *buf, const char * const *strs, int nstrs,
 static int
 first_day(int year)
 {
-    int ret = 4;
-
-    while (--year >= 1970)
-        ret = (ret + 365 + is_leap_year(year)) % 7;
-    return ret;
+    return (int)((__days_from_civil(year, 1, 1) % DAYSPERWEEK + EPOCH_WDAY + DAYSPERWEEK)
+                 % DAYSPERWEEK);
 }
 
 /*
@@ -529,9 +527,33 @@ __strptime(const char *buf, const char *format, struct tm *timeptr, locale_t loc
     return (char *)buf;
 }
 
+/* Formats parsed at fixed positions, see strptime_iso8601.c */
+static const struct {
+    char fmt[18];
+    char sep;
+} iso8601_formats[] = {
+    { "%Y-%m-%dT%H:%M:%S", 'T' },
+    { "%Y-%m-%d %H:%M:%S", ' ' },
+    { "%FT%T", 'T' },
+    { "%F %T", ' ' },
+};
+
 char *
 strptime_l(const char *buf, const char *format, struct tm *timeptr, locale_t locale)
 {
+    unsigned i;
+    char    *s;
+
+    if (format[0] == '%' && (format[1] == 'Y' || format[1] == 'F')) {
+        for (i = 0; i < sizeof(iso8601_formats) / sizeof(iso8601_formats[0]); i++) {
+            if (strcmp(format, iso8601_formats[i].fmt) == 0) {
+                s = __strptime_iso8601(buf, iso8601_formats[i].sep, timeptr, NULL);
+                if (s)
+                    return s;
+                break;
+            }
+        }
+    }
     memset(timeptr, 0, sizeof(*timeptr));
     return __strptime(buf, format, timeptr, locale);
 }
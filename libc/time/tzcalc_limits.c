@@ -11,6 +11,9 @@
 
 #include "local.h"
 
+/* UTC bounds of the year the change-over times were computed for */
+static time_t tzyear_start, tzyear_end;
+
 int
 __tzcalc_limits(int year)
 {
@@ -67,5 +70,46 @@ __tzcalc_limits(int year)
 
     tz->__tznorth = (tz->__tzrule[0].change < tz->__tzrule[1].change);
 
+    tzyear_start = (time_t)year_days * SECSPERDAY;
+    tzyear_end = tzyear_start + (time_t)(365 + isleap(year)) * SECSPERDAY;
+
     return 1;
 }
+
+/*
+ * Return whether DST is in effect at t, which must lie in the year
+ * last passed to __tzcalc_limits, and the interval [*start, *end)
+ * around t over which that stays true. The interval never extends
+ * beyond that year, whose rules are the only ones considered.
+ */
+int
+__tzcalc_window(time_t t, time_t *start, time_t *end)
+{
+    __tzinfo_type * const tz = __gettzinfo();
+    time_t                first, second;
+    int                   isdst;
+
+    /* The change-over times in order, and whether DST holds before the first */
+    if (tz->__tznorth) {
+        first = tz->__tzrule[0].change;
+        second = tz->__tzrule[1].change;
+        isdst = 0;
+    } else {
+        first = tz->__tzrule[1].change;
+        second = tz->__tzrule[0].change;
+        isdst = 1;
+    }
+
+    if (t < first) {
+        *start = tzyear_start;
+        *end = first;
+    } else if (t < second) {
+        *start = first;
+        *end = second;
+        isdst = !isdst;
+    } else {
+        *start = second;
+        *end = tzyear_end;
+    }
+    return isdst;
+}
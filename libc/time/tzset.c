@@ -99,12 +99,12 @@ Supporting OS subroutine required: None
 */
 
 #define _DEFAULT_SOURCE
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
 #include <time.h>
 #include <limits.h>
+#include <stdbool.h>
 #include "local.h"
 
 #define TZNAME_MIN 3 /* POSIX min TZ abbr size local def */
@@ -112,18 +112,137 @@ Supporting OS subroutine required: None
 static char __tzname_std[TZNAME_MAX + 2];
 static char __tzname_dst[TZNAME_MAX + 2];
 
+/*
+ * The last TZ value parsed. localtime and mktime call tzset each time,
+ * so skip parsing while TZ holds the same string. Longer values than
+ * fit are not cached.
+ */
+#define TZ_CACHE_MAX 64
+
+static char tz_cache[TZ_CACHE_MAX];
+static char tz_cache_state; /* 0: empty, 1: TZ unset, 2: tz_cache holds TZ */
+
+/* Bumped whenever the rules are parsed again */
+unsigned __tzgen;
+
+/*
+ * A small parser for the pieces of a POSIX TZ string, so that localtime
+ * does not pull in the scanf engine. Only ASCII letters and digits
+ * count, whatever the locale.
+ */
+static bool
+tz_isdigit(char c)
+{
+    return (unsigned)(c - '0') < 10;
+}
+
+static bool
+tz_isalpha(char c)
+{
+    return (unsigned)((c | 0x20) - 'a') < 26;
+}
+
+/*
+ * Copy the designation at s into name: letters, plus digits and signs
+ * when quoted in < >. Stops after TZNAME_MAX + 1 characters so that
+ * an over-long name shows up in the returned length.
+ */
+static int
+tz_parse_name(const char *s, char *name, bool quoted)
+{
+    int n = 0;
+
+    while (n <= TZNAME_MAX
+           && (tz_isalpha(s[n])
+               || (quoted && (tz_isdigit(s[n]) || s[n] == '+' || s[n] == '-')))) {
+        name[n] = s[n];
+        n++;
+    }
+    name[n] = '\0';
+    return n;
+}
+
+/* An unsigned decimal at *s, or -1 when there is no digit */
+static long
+tz_parse_num(const char **s)
+{
+    const char *p = *s;
+    long        v = 0;
+
+    if (!tz_isdigit(*p))
+        return -1;
+    while (tz_isdigit(*p)) {
+        if (v < 1000000)
+            v = v * 10 + (*p - '0');
+        p++;
+    }
+    *s = p;
+    return v;
+}
+
+/*
+ * hh[:mm[:ss]] at *s as seconds, or -1 when there is no hh. A colon
+ * not followed by digits is left unparsed.
+ */
+static long
+tz_parse_time(const char **s)
+{
+    long hh, mm = 0, ss = 0;
+
+    hh = tz_parse_num(s);
+    if (hh < 0)
+        return -1;
+    if (**s == ':' && tz_isdigit((*s)[1])) {
+        ++*s;
+        mm = tz_parse_num(s);
+        if (**s == ':' && tz_isdigit((*s)[1])) {
+            ++*s;
+            ss = tz_parse_num(s);
+        }
+    }
+    return ss + SECSPERMIN * mm + SECSPERHOUR * hh;
+}
+
+static bool
+tz_cached(const char *tzenv)
+{
+    size_t len;
+
+    if (tzenv == NULL) {
+        if (tz_cache_state == 1)
+            return true;
+        tz_cache_state = 1;
+    } else {
+        if (tz_cache_state == 2 && strcmp(tzenv, tz_cache) == 0)
+            return true;
+        len = strlen(tzenv);
+        if (len < TZ_CACHE_MAX) {
+            memcpy(tz_cache, tzenv, len + 1);
+            tz_cache_state = 2;
+        } else {
+            tz_cache_state = 0;
+        }
+    }
+    __tzgen++;
+    return false;
+}
+
 void
 _tzset_unlocked(void)
 {
-    char                               *tzenv;
-    unsigned short                      hh, mm, ss, m, w, d;
+    const char                         *tzenv;
+    long                                m, w, d, t;
     int                                 sign, n;
     int                                 i, ch;
     long                                offset0, offset1;
     __tzinfo_type                      *tz = __gettzinfo();
     static const struct __tzrule_struct default_tzrule = { 'J', 0, 0, 0, 0, (time_t)0, 0L };
 
-    if ((tzenv = getenv("TZ")) == NULL) {
+    tzenv = getenv("TZ");
+    if (tz_cached(tzenv))
+        return;
+
+    if (tzenv == NULL) {
         _timezone = 0;
         _daylight = 0;
         tzname[0] = "GMT";
@@ -149,16 +268,16 @@ _tzset_unlocked(void)
     if (*tzenv == '<') {
         ++tzenv;
 
-        /* quit if no items, too few or too many chars, or no close quote '>' */
-        if (sscanf(tzenv, "%11[-+0-9A-Za-z]%n", __tzname_std, &n) <= 0 || n < TZNAME_MIN
-            || TZNAME_MAX < n || '>' != tzenv[n])
+        /* quit if too few or too many chars, or no close quote '>' */
+        n = tz_parse_name(tzenv, __tzname_std, true);
+        if (n < TZNAME_MIN || TZNAME_MAX < n || '>' != tzenv[n])
             return;
 
         ++tzenv; /* bump for close quote '>' */
     } else {
         /* allow POSIX unquoted alphabetic tz abbr e.g. MESZ */
-        if (sscanf(tzenv, "%11[A-Za-z]%n", __tzname_std, &n) <= 0 || n < TZNAME_MIN
-            || TZNAME_MAX < n)
+        n = tz_parse_name(tzenv, __tzname_std, false);
+        if (n < TZNAME_MIN || TZNAME_MAX < n)
             return;
     }
 
@@ -171,22 +290,19 @@ _tzset_unlocked(void)
     } else if (*tzenv == '+')
         ++tzenv;
 
-    mm = 0;
-    ss = 0;
-
-    if (sscanf(tzenv, "%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n) < 1)
+    t = tz_parse_time(&tzenv);
+    if (t < 0)
         return;
 
-    offset0 = sign * (ss + SECSPERMIN * mm + SECSPERHOUR * hh);
-    tzenv += n;
+    offset0 = sign * t;
 
     /* allow POSIX angle bracket < > quoted signed alphanumeric tz abbr e.g. <MESZ+0330> */
     if (*tzenv == '<') {
         ++tzenv;
 
-        /* quit if no items, too few or too many chars, or no close quote '>' */
-        if (sscanf(tzenv, "%11[-+0-9A-Za-z]%n", __tzname_dst, &n) <= 0
-            && tzenv[0] == '>') { /* No dst */
+        /* quit if too few or too many chars, or no close quote '>' */
+        n = tz_parse_name(tzenv, __tzname_dst, true);
+        if (n == 0 && tzenv[0] == '>') { /* No dst */
             tzname[0] = __tzname_std;
             tzname[1] = tzname[0];
             tz->__tzrule[0].offset = offset0;
@@ -199,7 +315,8 @@ _tzset_unlocked(void)
         ++tzenv; /* bump for close quote '>' */
     } else {
         /* allow POSIX unquoted alphabetic tz abbr e.g. MESZ */
-        if (sscanf(tzenv, "%11[A-Za-z]%n", __tzname_dst, &n) <= 0) { /* No dst */
+        n = tz_parse_name(tzenv, __tzname_dst, false);
+        if (n == 0) { /* No dst */
             tzname[0] = __tzname_std;
             tzname[1] = tzname[0];
             tz->__tzrule[0].offset = offset0;
@@ -220,47 +337,48 @@ _tzset_unlocked(void)
     } else if (*tzenv == '+')
         ++tzenv;
 
-    hh = 0;
-    mm = 0;
-    ss = 0;
-
-    n = 0;
-    if (sscanf(tzenv, "%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n) <= 0)
+    t = tz_parse_time(&tzenv);
+    if (t < 0)
         offset1 = offset0 - 3600;
     else
-        offset1 = sign * (ss + SECSPERMIN * mm + SECSPERHOUR * hh);
-
-    tzenv += n;
+        offset1 = sign * t;
 
     for (i = 0; i < 2; ++i) {
         if (*tzenv == ',')
             ++tzenv;
 
         if (*tzenv == 'M') {
-            if (sscanf(tzenv, "M%hu%n.%hu%n.%hu%n", &m, &n, &w, &n, &d, &n) != 3 || m < 1 || m > 12
-                || w < 1 || w > 5 || d > 6)
+            ++tzenv;
+            m = tz_parse_num(&tzenv);
+            w = d = -1;
+            if (m >= 0 && *tzenv == '.') {
+                ++tzenv;
+                w = tz_parse_num(&tzenv);
+                if (w >= 0 && *tzenv == '.') {
+                    ++tzenv;
+                    d = tz_parse_num(&tzenv);
+                }
+            }
+            if (m < 1 || m > 12 || w < 1 || w > 5 || d < 0 || d > 6)
                 return;
 
             tz->__tzrule[i].ch = 'M';
             tz->__tzrule[i].m = m;
             tz->__tzrule[i].n = w;
             tz->__tzrule[i].d = d;
-
-            tzenv += n;
         } else {
-            char *end;
             if (*tzenv == 'J') {
                 ch = 'J';
                 ++tzenv;
             } else
                 ch = 'D';
 
-            d = strtoul(tzenv, &end, 10);
+            d = tz_parse_num(&tzenv);
 
             /* if unspecified, default to US settings */
             /* From 1987-2006, US was M4.1.0,M10.5.0, but starting in 2007 is
              * M3.2.0,M11.1.0 (2nd Sunday March through 1st Sunday November)  */
-            if (end == tzenv) {
+            if (d < 0) {
                 if (i == 0) {
                     tz->__tzrule[0].ch = 'M';
                     tz->__tzrule[0].m = 3;
@@ -276,27 +394,23 @@ _tzset_unlocked(void)
                 tz->__tzrule[i].ch = ch;
                 tz->__tzrule[i].d = d;
             }
-
-            tzenv = end;
         }
 
         /* default time is 02:00:00 am */
-        hh = 2;
-        mm = 0;
-        ss = 0;
-        n = 0;
+        t = 2 * SECSPERHOUR;
 
-        if (*tzenv == '/')
-            if (sscanf(tzenv, "/%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n) <= 0) {
+        if (*tzenv == '/') {
+            ++tzenv;
+            t = tz_parse_time(&tzenv);
+            if (t < 0) {
                 /* error in time format, restore tz rules to default and return */
                 tz->__tzrule[0] = default_tzrule;
                 tz->__tzrule[1] = default_tzrule;
                 return;
             }
+        }
 
-        tz->__tzrule[i].s = ss + SECSPERMIN * mm + SECSPERHOUR * hh;
-
-        tzenv += n;
+        tz->__tzrule[i].s = t;
     }
 
     tz->__tzrule[0].offset = offset0;
@@ -306,4 +306,24 @@ const char *__ubsan_type_check_to_string(unsigned char type_check_kind);
 
 const char *__ubsan_cfi_type_check_to_string(unsigned char cfi_type_check_kind);
 
+/*
+ * Minimal runtime: each failing location is noted once in a ring of
+ * UBSAN_RECORDS entries, marked as seen by setting its column to
+ * UBSAN_SEEN, and __ubsan_report prints them later.
+ */
+
+#define UBSAN_RECORDS 16
+#define UBSAN_SEEN    (~0U)
+
+struct ubsan_record {
+    struct source_location *location;
+    unsigned int            column;
+    const char             *fail;
+};
+
+extern struct ubsan_record __ubsan_records[UBSAN_RECORDS];
+extern unsigned int        __ubsan_recorded;
+
+void __ubsan_record(struct source_location *source, const char *fail);
+
 #endif /* _UBSAN_H_ */
@@ -0,0 +1,208 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Minimal UBSan runtime: handlers which note the failing location with
+ * __ubsan_record and let the program carry on. Operands are ignored so
+ * that a failed check costs no more than the call.
+ */
+
+#include "ubsan.h"
+
+void
+__ubsan_handle_add_overflow(void *_data, void *lhs, void *rhs)
+{
+    (void)lhs;
+    (void)rhs;
+    __ubsan_record(&((struct overflow_data *)_data)->location, "add_overflow");
+}
+
+void
+__ubsan_handle_alignment_assumption(void *_data, void *ptr, void *align, void *offset)
+{
+    (void)ptr;
+    (void)align;
+    (void)offset;
+    __ubsan_record(&((struct alignment_assumption_data *)_data)->location, "alignment_assumption");
+}
+
+void
+__ubsan_handle_cfi_bad_type(void *_data, void *vtable, void *valid_vtable, void *opts)
+{
+    (void)vtable;
+    (void)valid_vtable;
+    (void)opts;
+    __ubsan_record(&((struct cfi_check_fail_data *)_data)->location, "cfi_bad_type");
+}
+
+void
+__ubsan_handle_cfi_check_fail(void *_data, void *function, void *vtable_is_valid)
+{
+    (void)function;
+    (void)vtable_is_valid;
+    __ubsan_record(&((struct cfi_check_fail_data *)_data)->location, "cfi_check_fail");
+}
+
+void
+__ubsan_handle_divrem_overflow(void *_data, void *lhs, void *rhs)
+{
+    (void)lhs;
+    (void)rhs;
+    __ubsan_record(&((struct overflow_data *)_data)->location, "divrem_overflow");
+}
+
+void
+__ubsan_handle_dynamic_type_cache_miss(void *_data, void *pointer, void *hash)
+{
+    (void)pointer;
+    (void)hash;
+    __ubsan_record(&((struct dynamic_type_cache_miss_data *)_data)->location, "dynamic_type_cache_miss");
+}
+
+void
+__ubsan_handle_float_cast_overflow(void *_data, void *from)
+{
+    (void)from;
+    __ubsan_record(&((struct float_cast_overflow_data *)_data)->location, "float_cast_overflow");
+}
+
+void
+__ubsan_handle_function_type_mismatch(void *_data, void *ptr)
+{
+    (void)ptr;
+    __ubsan_record(&((struct function_type_mismatch_data *)_data)->location, "function_type_mismatch");
+}
+
+void
+__ubsan_handle_implicit_conversion(void *_data, void *src, void *dst)
+{
+    (void)src;
+    (void)dst;
+    __ubsan_record(&((struct implicit_conversion_data *)_data)->location, "implicit_conversion");
+}
+
+void
+__ubsan_handle_invalid_builtin(void *_data)
+{
+    __ubsan_record(&((struct invalid_builtin_data *)_data)->location, "invalid_builtin");
+}
+
+void
+__ubsan_handle_invalid_objc_cast(void *_data, void *pointer)
+{
+    (void)pointer;
+    __ubsan_record(&((struct invalid_objc_cast_data *)_data)->location, "invalid_objc_cast");
+}
+
+void
+__ubsan_handle_load_invalid_value(void *_data, void *val)
+{
+    (void)val;
+    __ubsan_record(&((struct invalid_value_data *)_data)->location, "load_invalid_value");
+}
+
+void
+__ubsan_handle_mul_overflow(void *_data, void *lhs, void *rhs)
+{
+    (void)lhs;
+    (void)rhs;
+    __ubsan_record(&((struct overflow_data *)_data)->location, "mul_overflow");
+}
+
+void
+__ubsan_handle_negate_overflow(void *_data, void *val)
+{
+    (void)val;
+    __ubsan_record(&((struct overflow_data *)_data)->location, "negate_overflow");
+}
+
+void
+__ubsan_handle_nonnull_arg(void *_data)
+{
+    __ubsan_record(&((struct nonnull_arg_data *)_data)->location, "nonnull_arg");
+}
+
+void
+__ubsan_handle_nonnull_return(void *_data)
+{
+    __ubsan_record(&((struct nonnull_return_data *)_data)->location, "nonnull_return");
+}
+
+void
+__ubsan_handle_nonnull_return_v1(void *_data, void *location)
+{
+    (void)location;
+    __ubsan_record(&((struct nonnull_return_data *)_data)->location, "nonnull_return_v1");
+}
+
+void
+__ubsan_handle_nullability_arg(void *_data)
+{
+    __ubsan_record(&((struct nonnull_arg_data *)_data)->location, "nullability_arg");
+}
+
+void
+__ubsan_handle_nullability_return(void *_data)
+{
+    __ubsan_record(&((struct nonnull_return_data *)_data)->location, "nullability_return");
+}
+
+void
+__ubsan_handle_nullability_return_v1(void *_data, void *location)
+{
+    (void)location;
+    __ubsan_record(&((struct nonnull_return_data *)_data)->location, "nullability_return_v1");
+}
+
+void
+__ubsan_handle_out_of_bounds(void *_data, void *index)
+{
+    (void)index;
+    __ubsan_record(&((struct out_of_bounds_data *)_data)->location, "out_of_bounds");
+}
+
+void
+__ubsan_handle_pointer_overflow(void *_data, void *val, void *result)
+{
+    (void)val;
+    (void)result;
+    __ubsan_record(&((struct pointer_overflow_data *)_data)->location, "pointer_overflow");
+}
+
+void
+__ubsan_handle_shift_out_of_bounds(void *_data, void *lhs, void *rhs)
+{
+    (void)lhs;
+    (void)rhs;
+    __ubsan_record(&((struct shift_out_of_bounds_data *)_data)->location, "shift_out_of_bounds");
+}
+
+void
+__ubsan_handle_sub_overflow(void *_data, void *lhs, void *rhs)
+{
+    (void)lhs;
+    (void)rhs;
+    __ubsan_record(&((struct overflow_data *)_data)->location, "sub_overflow");
+}
+
+void
+__ubsan_handle_type_mismatch(void *_data, void *ptr)
+{
+    (void)ptr;
+    __ubsan_record(&((struct type_mismatch_data *)_data)->location, "type_mismatch");
+}
+
+void
+__ubsan_handle_type_mismatch_v1(void *_data, void *ptr)
+{
+    (void)ptr;
+    __ubsan_record(&((struct type_mismatch_data_v1 *)_data)->location, "type_mismatch_v1");
+}
+
+void
+__ubsan_handle_vla_bound_not_positive(void *_data, void *bound)
+{
+    (void)bound;
+    __ubsan_record(&((struct vla_bound_data *)_data)->location, "vla_bound_not_positive");
+}
@@ -0,0 +1,29 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Minimal UBSan runtime: the two checks after which execution cannot
+ * go on report everything noted so far and abort. They live apart from
+ * ubsan_minimal.c so that only programs using them pull in stdio.
+ */
+
+#include "ubsan.h"
+#include <picoubsan.h>
+#include <stdlib.h>
+
+void
+__ubsan_handle_builtin_unreachable(void *_data)
+{
+    __ubsan_record(&((struct unreachable_data *)_data)->location, "builtin_unreachable");
+    (void)__ubsan_report();
+    abort();
+}
+
+void
+__ubsan_handle_missing_return(void *_data)
+{
+    __ubsan_record(&((struct unreachable_data *)_data)->location, "missing_return");
+    (void)__ubsan_report();
+    abort();
+}
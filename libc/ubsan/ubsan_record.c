@@ -0,0 +1,25 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#include "ubsan.h"
+
+struct ubsan_record __ubsan_records[UBSAN_RECORDS];
+unsigned int        __ubsan_recorded;
+
+void
+__ubsan_record(struct source_location *source, const char *fail)
+{
+    struct ubsan_record *r;
+    unsigned int         column = source->column;
+
+    if (column == UBSAN_SEEN)
+        return;
+    source->column = UBSAN_SEEN;
+    r = &__ubsan_records[__ubsan_recorded++ % UBSAN_RECORDS];
+    r->location = source;
+    r->column = column;
+    r->fail = fail;
+}
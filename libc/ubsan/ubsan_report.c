@@ -0,0 +1,29 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#include "ubsan.h"
+#include <picoubsan.h>
+#include <stdio.h>
+
+static unsigned int reported;
+
+int
+__ubsan_report(void)
+{
+    unsigned int recorded = __ubsan_recorded;
+    int          count = (int)(recorded - reported);
+
+    if (recorded - reported > UBSAN_RECORDS) {
+        fprintf(stderr, "UBSAN: %u failures lost\n", recorded - reported - UBSAN_RECORDS);
+        reported = recorded - UBSAN_RECORDS;
+    }
+    for (; reported != recorded; reported++) {
+        struct ubsan_record *r = &__ubsan_records[reported % UBSAN_RECORDS];
+        fprintf(stderr, "UBSAN: %s %s:%u:%u\n", r->fail, r->location->file_name,
+                r->location->line, r->column);
+    }
+    return count;
+}
@@ -42,6 +42,8 @@
 #include <wchar.h>
 #include <errno.h>
 #include <stdint.h>
+#include <limits.h>
+#include "../string/local.h"
 
 #define HIGH_SURROGATE_FIRST 0xd800
 #define HIGH_SURROGATE_LAST  0xdbff
@@ -121,4 +123,106 @@ char32_is_valid(char32_t c)
     return c <= 0x10ffff && !char32_is_surrogate(c);
 }
 
+/*
+ * Kernels for the string converters. The input has a length rather
+ * than a terminator, so NUL is converted like any other character.
+ */
+
+#if ULONG_MAX == 4294967295UL
+#define UCHAR_HIGH_BITS 0x80808080UL
+#else
+#define UCHAR_HIGH_BITS 0x8080808080808080UL
+#endif
+
+typedef unsigned long __attribute__((__may_alias__)) uchar_word_t;
+
+/* True when the aligned word at p holds only ASCII bytes */
+static inline bool
+char8_ascii_word(const char8_t *p)
+{
+    return (*(const uchar_word_t *)p & UCHAR_HIGH_BITS) == 0;
+}
+
+/*
+ * Decode one UTF-8 character from the n > 0 bytes at s, rejecting
+ * overlong forms, surrogates and values past 0x10ffff. Returns its
+ * length, 0 when the bytes are a valid but incomplete sequence, or
+ * -1 when they are invalid.
+ */
+static inline int
+char8_decode(char32_t *pc32, const char8_t *s, size_t n)
+{
+    char32_t c = s[0];
+    char8_t  lo = 0x80, hi = 0xbf;
+    int      len, i;
+
+    if (char8_is_one_byte(c)) {
+        *pc32 = c;
+        return 1;
+    }
+    if (c < 0xc2 || c > 0xf4)
+        return -1;
+    if (c < 0xe0) {
+        len = 2;
+        c &= 0x1f;
+    } else if (c < 0xf0) {
+        len = 3;
+        if (c == 0xe0)
+            lo = 0xa0;
+        else if (c == 0xed)
+            hi = 0x9f;
+        c &= 0x0f;
+    } else {
+        len = 4;
+        if (c == 0xf0)
+            lo = 0x90;
+        else if (c == 0xf4)
+            hi = 0x8f;
+        c &= 0x07;
+    }
+    for (i = 1; i < len; i++) {
+        if ((size_t)i == n)
+            return 0;
+        if (s[i] < lo || s[i] > hi)
+            return -1;
+        c = (c << 6) | (s[i] & 0x3f);
+        lo = 0x80;
+        hi = 0xbf;
+    }
+    *pc32 = c;
+    return len;
+}
+
+/* Encode the valid character c as UTF-8 at s, returning the length */
+static inline int
+char32_encode(char8_t *s, char32_t c)
+{
+    if (c < 0x80) {
+        s[0] = (char8_t)c;
+        return 1;
+    }
+    if (c < 0x800) {
+        s[0] = 0xc0 | (c >> 6);
+        s[1] = 0x80 | (c & 0x3f);
+        return 2;
+    }
+    if (c < 0x10000) {
+        s[0] = 0xe0 | (c >> 12);
+        s[1] = 0x80 | ((c >> 6) & 0x3f);
+        s[2] = 0x80 | (c & 0x3f);
+        return 3;
+    }
+    s[0] = 0xf0 | (c >> 18);
+    s[1] = 0x80 | ((c >> 12) & 0x3f);
+    s[2] = 0x80 | ((c >> 6) & 0x3f);
+    s[3] = 0x80 | (c & 0x3f);
+    return 4;
+}
+
+static inline size_t
+char32_encoded_length(char32_t c)
+{
+    return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
 #endif /* _UCHAR_LOCAL_H_ */
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "uchar-local.h"
+
+/*
+ * Convert the *srclen units of UTF-16 at *src to UTF-8 at *dst, which
+ * has room for *dstlen bytes, advancing both and reducing both lengths
+ * by what was consumed and produced. Runs of ASCII are narrowed four
+ * units at a time.
+ *
+ * Returns 0 once all of the input is converted. Otherwise returns -1
+ * with *src at the character that stopped the conversion and errno
+ * set to EILSEQ for an unpaired surrogate, EINVAL for a high surrogate
+ * ending the input or E2BIG when the output is full.
+ */
+int
+utf16_to_utf8(const char16_t ** __restrict src, size_t * __restrict srclen,
+              char8_t ** __restrict dst, size_t * __restrict dstlen)
+{
+    const char16_t *s = *src;
+    char8_t        *d = *dst;
+    size_t          slen = *srclen, dlen = *dstlen;
+    char32_t        c;
+    size_t          units, bytes;
+    int             ret = 0;
+
+    while (slen) {
+        while (slen >= 4 && dlen >= 4 && (s[0] | s[1] | s[2] | s[3]) < 0x80) {
+            d[0] = (char8_t)s[0];
+            d[1] = (char8_t)s[1];
+            d[2] = (char8_t)s[2];
+            d[3] = (char8_t)s[3];
+            s += 4;
+            slen -= 4;
+            d += 4;
+            dlen -= 4;
+        }
+        if (!slen)
+            break;
+        c = s[0];
+        units = 1;
+        if (char16_is_surrogate(c)) {
+            if (char16_is_low_surrogate(c)) {
+                errno = EILSEQ;
+                ret = -1;
+                break;
+            }
+            if (slen < 2) {
+                errno = EINVAL;
+                ret = -1;
+                break;
+            }
+            if (!char16_is_low_surrogate(s[1])) {
+                errno = EILSEQ;
+                ret = -1;
+                break;
+            }
+            c = 0x10000 + ((c - HIGH_SURROGATE_FIRST) << 10) + (s[1] - LOW_SURROGATE_FIRST);
+            units = 2;
+        }
+        bytes = char32_encoded_length(c);
+        if (dlen < bytes) {
+            errno = E2BIG;
+            ret = -1;
+            break;
+        }
+        char32_encode(d, c);
+        s += units;
+        slen -= units;
+        d += bytes;
+        dlen -= bytes;
+    }
+    *src = s;
+    *srclen = slen;
+    *dst = d;
+    *dstlen = dlen;
+    return ret;
+}
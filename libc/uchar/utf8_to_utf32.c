@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "uchar-local.h"
+
+/*
+ * Convert the *srclen bytes of UTF-8 at *src to UTF-32 at *dst, which
+ * has room for *dstlen characters, advancing both and reducing both
+ * lengths by what was consumed and produced. Aligned runs of ASCII are
+ * widened a word at a time.
+ *
+ * Returns 0 once all of the input is converted. Otherwise returns -1
+ * with *src at the character that stopped the conversion and errno
+ * set to EILSEQ for an invalid sequence, EINVAL for one cut off by
+ * the end of the input or E2BIG when the output is full.
+ */
+int
+utf8_to_utf32(const char8_t ** __restrict src, size_t * __restrict srclen,
+              char32_t ** __restrict dst, size_t * __restrict dstlen)
+{
+    const char8_t *s = *src;
+    char32_t      *d = *dst;
+    size_t         slen = *srclen, dlen = *dstlen;
+    unsigned       i;
+    int            len, ret = 0;
+
+    while (slen) {
+        if (!UNALIGNED_X(s)) {
+            while (slen >= sizeof(uchar_word_t) && dlen >= sizeof(uchar_word_t)
+                   && char8_ascii_word(s)) {
+                for (i = 0; i < sizeof(uchar_word_t); i++)
+                    d[i] = s[i];
+                s += sizeof(uchar_word_t);
+                slen -= sizeof(uchar_word_t);
+                d += sizeof(uchar_word_t);
+                dlen -= sizeof(uchar_word_t);
+            }
+            if (!slen)
+                break;
+        }
+        if (!dlen) {
+            errno = E2BIG;
+            ret = -1;
+            break;
+        }
+        len = char8_decode(d, s, slen);
+        if (len <= 0) {
+            errno = len ? EILSEQ : EINVAL;
+            ret = -1;
+            break;
+        }
+        d++;
+        dlen--;
+        s += len;
+        slen -= len;
+    }
+    *src = s;
+    *srclen = slen;
+    *dst = d;
+    *dstlen = dlen;
+    return ret;
+}
@@ -47,6 +47,99 @@
 
 #include "xdr_private.h"
 
+/*
+ * The size of the elements handled by elproc when it moves a plain
+ * 32- or 64-bit integer, float or double whose memory layout is the
+ * host-order version of its XDR encoding, or 0.
+ */
+static u_int
+xdr_word_size(xdrproc_t elproc)
+{
+    if ((sizeof(int) == 4 && (elproc == (xdrproc_t)xdr_int || elproc == (xdrproc_t)xdr_u_int))
+        || (sizeof(long) == 4
+            && (elproc == (xdrproc_t)xdr_long || elproc == (xdrproc_t)xdr_u_long))
+        || elproc == (xdrproc_t)xdr_int32_t || elproc == (xdrproc_t)xdr_uint32_t
+        || elproc == (xdrproc_t)xdr_u_int32_t
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+        || elproc == (xdrproc_t)xdr_float
+#endif
+    )
+        return 4;
+    if (elproc == (xdrproc_t)xdr_int64_t || elproc == (xdrproc_t)xdr_uint64_t
+        || elproc == (xdrproc_t)xdr_u_int64_t || elproc == (xdrproc_t)xdr_hyper
+        || elproc == (xdrproc_t)xdr_u_hyper || elproc == (xdrproc_t)xdr_longlong_t
+        || elproc == (xdrproc_t)xdr_u_longlong_t
+#if (defined(__IEEE_LITTLE_ENDIAN) && _BYTE_ORDER == _LITTLE_ENDIAN) \
+    || (defined(__IEEE_BIG_ENDIAN) && _BYTE_ORDER == _BIG_ENDIAN)
+#if !defined(_DOUBLE_IS_32BITS)
+        || elproc == (xdrproc_t)xdr_double
+#endif
+#endif
+    )
+        return 8;
+    return 0;
+}
+
+/*
+ * Move nelem elements of one of the types above between addr and the
+ * stream with a single bounds check, byte-swapping them straight
+ * into or out of the stream's buffer. Returns FALSE, having done
+ * nothing, when the stream cannot provide that much buffer inline;
+ * the caller then falls back to calling elproc per element.
+ */
+static bool_t
+xdr_words(XDR *xdrs, char *addr, u_int nelem, u_int elsize, xdrproc_t elproc)
+{
+    u_int32_t *buf;
+    u_int      i;
+
+    if (xdr_word_size(elproc) != elsize || nelem > UINT_MAX / elsize)
+        return FALSE;
+    if (xdrs->x_op == XDR_FREE)
+        return TRUE;
+    buf = (u_int32_t *)(void *)XDR_INLINE(xdrs, nelem * elsize);
+    if (buf == NULL)
+        return FALSE;
+
+#if _BYTE_ORDER == _BIG_ENDIAN
+    if (xdrs->x_op == XDR_ENCODE)
+        memcpy(buf, addr, nelem * elsize);
+    else
+        memcpy(addr, buf, nelem * elsize);
+    (void)i;
+#else
+    if (elsize == 4) {
+        u_int32_t *w = (u_int32_t *)(void *)addr;
+        u_int32_t *src = xdrs->x_op == XDR_ENCODE ? w : buf;
+        u_int32_t *dst = xdrs->x_op == XDR_ENCODE ? buf : w;
+
+        for (i = 0; i + 4 <= nelem; i += 4) {
+            u_int32_t a = src[i], b = src[i + 1], c = src[i + 2], d = src[i + 3];
+
+            dst[i] = xdr_ntohl(a);
+            dst[i + 1] = xdr_ntohl(b);
+            dst[i + 2] = xdr_ntohl(c);
+            dst[i + 3] = xdr_ntohl(d);
+        }
+        for (; i < nelem; i++)
+            dst[i] = xdr_ntohl(src[i]);
+    } else {
+        /* The high word of each 64-bit value goes first */
+        u_int32_t *w = (u_int32_t *)(void *)addr;
+        u_int32_t *src = xdrs->x_op == XDR_ENCODE ? w : buf;
+        u_int32_t *dst = xdrs->x_op == XDR_ENCODE ? buf : w;
+
+        for (i = 0; i < 2 * nelem; i += 2) {
+            u_int32_t lo = src[i], hi = src[i + 1];
+
+            dst[i] = xdr_ntohl(hi);
+            dst[i + 1] = xdr_ntohl(lo);
+        }
+    }
+#endif
+    return TRUE;
+}
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -101,6 +194,8 @@ xdr_array(XDR *xdrs, caddr_t *addrp, u_int *sizep, u_int maxsize, u_int elsize,
     /*
      * now we xdr each element of array
      */
+    if (xdr_words(xdrs, target, c, elsize, elproc))
+        c = 0;
     for (i = 0; (i < c) && stat; i++) {
         stat = (*elproc)(xdrs, target);
         target += elsize;
@@ -132,6 +227,8 @@ xdr_vector(XDR *xdrs, char *basep, u_int nelem, u_int elemsize, xdrproc_t xdr_el
     u_int i;
     char *elptr;
 
+    if (xdr_words(xdrs, basep, nelem, elemsize, xdr_elem))
+        return TRUE;
     elptr = basep;
     for (i = 0; i < nelem; i++) {
         if (!(*xdr_elem)(xdrs, elptr)) {
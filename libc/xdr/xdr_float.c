@@ -77,43 +77,40 @@ xdr_float(XDR *xdrs, float *fp)
 }
 
 #if !defined(_DOUBLE_IS_32BITS)
+
+/* Index of the 32-bit half of a double holding the sign and exponent */
+#if defined(__IEEE_BIG_ENDIAN)
+#define DOUBLE_HI 0
+#else /* must be __IEEE_LITTLE_ENDIAN */
+#define DOUBLE_HI 1
+#endif
+
 bool_t
 xdr_double(XDR *xdrs, double *dp)
 {
-    int32_t *i32p;
-    bool_t   rv;
+    int32_t   *i32p = (int32_t *)(void *)dp;
+    u_int32_t *buf;
 
     switch (xdrs->x_op) {
 
     case XDR_ENCODE:
-        i32p = (int32_t *)(void *)dp;
-#if defined(__IEEE_BIG_ENDIAN)
-        rv = XDR_PUTINT32(xdrs, i32p);
-        if (!rv)
-            return (rv);
-        rv = XDR_PUTINT32(xdrs, i32p + 1);
-#else  /* must be __IEEE_LITTLE_ENDIAN */
-        rv = XDR_PUTINT32(xdrs, i32p + 1);
-        if (!rv)
-            return (rv);
-        rv = XDR_PUTINT32(xdrs, i32p);
-#endif /* __IEEE_LITTLE_ENDIAN */
-        return (rv);
+        /* Both words with a single bounds check when the stream allows */
+        buf = (u_int32_t *)(void *)XDR_INLINE(xdrs, 2 * BYTES_PER_XDR_UNIT);
+        if (buf) {
+            buf[0] = xdr_htonl((u_int32_t)i32p[DOUBLE_HI]);
+            buf[1] = xdr_htonl((u_int32_t)i32p[1 - DOUBLE_HI]);
+            return TRUE;
+        }
+        return XDR_PUTINT32(xdrs, i32p + DOUBLE_HI) && XDR_PUTINT32(xdrs, i32p + 1 - DOUBLE_HI);
 
     case XDR_DECODE:
-        i32p = (int32_t *)(void *)dp;
-#if defined(__IEEE_BIG_ENDIAN)
-        rv = XDR_GETINT32(xdrs, i32p);
-        if (!rv)
-            return (rv);
-        rv = XDR_GETINT32(xdrs, i32p + 1);
-#else  /* must be __IEEE_LITTLE_ENDIAN */
-        rv = XDR_GETINT32(xdrs, i32p + 1);
-        if (!rv)
-            return (rv);
-        rv = XDR_GETINT32(xdrs, i32p);
-#endif /* __IEEE_LITTLE_ENDIAN */
-        return (rv);
+        buf = (u_int32_t *)(void *)XDR_INLINE(xdrs, 2 * BYTES_PER_XDR_UNIT);
+        if (buf) {
+            i32p[DOUBLE_HI] = (int32_t)xdr_ntohl(buf[0]);
+            i32p[1 - DOUBLE_HI] = (int32_t)xdr_ntohl(buf[1]);
+            return TRUE;
+        }
+        return XDR_GETINT32(xdrs, i32p + DOUBLE_HI) && XDR_GETINT32(xdrs, i32p + 1 - DOUBLE_HI);
 
     case XDR_FREE:
         return TRUE;
@@ -44,6 +44,11 @@
 
 #include "xdr_private.h"
 
+#ifdef __FAST_BUFIO
+#include <string.h>
+#include "../stdio/stdio_private.h"
+#endif
+
 #ifndef ntohl
 #define ntohl(x) xdr_ntohl(x)
 #endif
@@ -109,6 +114,13 @@ xdrstdio_getlong(XDR *xdrs, long *lp)
 {
     u_int32_t temp;
 
+#ifdef __FAST_BUFIO
+    int32_t *buf = xdrstdio_inline(xdrs, sizeof(int32_t));
+    if (buf) {
+        *lp = (long)(int32_t)ntohl(*buf);
+        return TRUE;
+    }
+#endif
     if (fread(&temp, sizeof(int32_t), 1, (FILE *)xdrs->x_private) != 1)
         return FALSE;
     *lp = (long)(int32_t)ntohl(temp);
@@ -120,6 +132,13 @@ xdrstdio_putlong(XDR *xdrs, const long *lp)
 {
     u_int32_t temp = htonl((u_int32_t)*lp);
 
+#ifdef __FAST_BUFIO
+    int32_t *buf = xdrstdio_inline(xdrs, sizeof(int32_t));
+    if (buf) {
+        *buf = (int32_t)temp;
+        return TRUE;
+    }
+#endif
     if (fwrite(&temp, sizeof(int32_t), 1, (FILE *)xdrs->x_private) != 1)
         return FALSE;
     return TRUE;
@@ -153,6 +172,75 @@ xdrstdio_setpos(XDR *xdrs, u_int pos)
     return ((fseek((FILE *)xdrs->x_private, (long)pos, 0) < 0) ? FALSE : TRUE);
 }
 
+#ifdef __FAST_BUFIO
+/*
+ * With fast bufio, the stdio buffer of a buffered stream is directly
+ * reachable, so inline requests are answered with a pointer into it:
+ * decoding returns the next len bytes, reading more first if needed,
+ * and encoding reserves len bytes, flushing first if they don't fit.
+ * The pointer stays valid until the next operation on the stream.
+ * Anything else (unbuffered streams, pending ungetc, a request bigger
+ * than the buffer or a misaligned position) returns NULL and the
+ * caller falls back to the get/put routines.
+ */
+static int32_t *
+xdrstdio_inline(XDR *xdrs, u_int len)
+{
+    FILE                *file = (FILE *)xdrs->x_private;
+    struct __file_bufio *bf = (struct __file_bufio *)file;
+    int32_t             *buf = NULL;
+    int                  have;
+    ssize_t              got;
+
+    if (!(file->flags & __SBUF) || len == 0 || len >= (u_int)bf->size)
+        return NULL;
+
+    __flockfile(file);
+    __bufio_lock(file);
+    if (xdrs->x_op == XDR_DECODE) {
+        if (!(file->flags & __SRD) || file->unget != 0)
+            goto bail;
+        if (__bufio_setdir_locked(file, __SRD) < 0)
+            goto bail;
+        have = bf->len - bf->off;
+        if ((u_int)have < len) {
+            /* Move the tail to the start of the buffer and read the rest */
+            memmove(bf->buf, bf->buf + bf->off, have);
+            bf->off = 0;
+            bf->len = have;
+            while ((u_int)bf->len < len) {
+                got = bufio_read(bf, bf->buf + bf->len, bf->size - bf->len);
+                if (got <= 0) {
+                    file->flags |= (got < 0) ? __SERR : __SEOF;
+                    goto bail;
+                }
+                bf->len += got;
+                bf->pos += got;
+            }
+        }
+        if ((uintptr_t)(bf->buf + bf->off) % BYTES_PER_XDR_UNIT == 0) {
+            buf = (int32_t *)(void *)(bf->buf + bf->off);
+            bf->off += len;
+        }
+    } else if (xdrs->x_op == XDR_ENCODE) {
+        if (!(file->flags & __SWR))
+            goto bail;
+        if (__bufio_setdir_locked(file, __SWR) < 0)
+            goto bail;
+        /* Leave room for __bufio_put, which stores before flushing */
+        if ((u_int)(bf->size - bf->len) <= len && __bufio_flush_locked(file) < 0)
+            goto bail;
+        if ((uintptr_t)(bf->buf + bf->len) % BYTES_PER_XDR_UNIT == 0) {
+            buf = (int32_t *)(void *)(bf->buf + bf->len);
+            bf->len += len;
+        }
+    }
+bail:
+    __bufio_unlock(file);
+    __funlockfile(file);
+    return buf;
+}
+#else
 /* ARGSUSED */
 static int32_t *
 xdrstdio_inline(XDR *xdrs, u_int len)
@@ -170,12 +258,20 @@ xdrstdio_inline(XDR *xdrs, u_int len)
      */
     return NULL;
 }
+#endif
 
 static bool_t
 xdrstdio_getint32(XDR *xdrs, int32_t *ip)
 {
     int32_t temp;
 
+#ifdef __FAST_BUFIO
+    int32_t *buf = xdrstdio_inline(xdrs, sizeof(int32_t));
+    if (buf) {
+        *ip = ntohl(*buf);
+        return TRUE;
+    }
+#endif
     if (fread(&temp, sizeof(int32_t), 1, (FILE *)xdrs->x_private) != 1)
         return FALSE;
     *ip = ntohl(temp);
@@ -187,6 +283,13 @@ xdrstdio_putint32(XDR *xdrs, const int32_t *ip)
 {
     int32_t temp = htonl(*ip);
 
+#ifdef __FAST_BUFIO
+    int32_t *buf = xdrstdio_inline(xdrs, sizeof(int32_t));
+    if (buf) {
+        *buf = temp;
+        return TRUE;
+    }
+#endif
     if (fwrite(&temp, sizeof(int32_t), 1, (FILE *)xdrs->x_private) != 1)
         return FALSE;
     return TRUE;
@@ -170,6 +170,8 @@
 
 #ifdef _NEED_FLOAT64
 extern __int32_t __rem_pio2(__float64, __float64 *);
+extern __int32_t __sincospi_reduce(__float64, __float64 *);
+extern __float64 __gamma_exact(__float64);
 
 /* fdlibm kernel function */
 extern __float64 __kernel_sin(__float64, __float64, int);
@@ -179,6 +181,8 @@ extern int       __kernel_rem_pio2(__float64 *, __float64 *, int, int, int, cons
 #endif
 
 extern int   __rem_pio2f(float, float *);
+extern int   __sincospif_reduce(float, float *);
+extern float __gamma_exactf(float);
 
 /* float versions of fdlibm kernel functions */
 extern float __kernel_sinf(float, float, int);
@@ -35,11 +35,36 @@
 #include <fenv.h>
 #include <float.h>
 
+/*
+ * Sources built into libmfast (-Dmath-fast-lib=true) set neither
+ * errno nor exception flags and assume round-to-nearest.
+ */
+#ifdef __MATH_FAST_LIB
+#ifndef __FLOAT_NOEXCEPT
+#define __FLOAT_NOEXCEPT
+#endif
+#ifndef __DOUBLE_NOEXCEPT
+#define __DOUBLE_NOEXCEPT
+#endif
+#ifndef __LONG_DOUBLE_NOEXCEPT
+#define __LONG_DOUBLE_NOEXCEPT
+#endif
+#ifndef WANT_ROUNDING
+#define WANT_ROUNDING 0
+#endif
+#endif
+
+#if !defined(WANT_ROUNDING) && !defined(FE_UPWARD) && !defined(FE_DOWNWARD) \
+    && !defined(FE_TOWARDZERO)
+/* Round-to-nearest is the only mode */
+#define WANT_ROUNDING 0
+#endif
+
 #ifndef WANT_ROUNDING
 /* Correct special case results in non-nearest rounding modes.  */
 #define WANT_ROUNDING 1
 #endif
-#ifdef __IEEE_LIBM
+#if defined(__IEEE_LIBM) || defined(__MATH_FAST_LIB)
 #define WANT_ERRNO   0
 #define _LIB_VERSION _IEEE_
 #else
@@ -461,6 +486,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_d_id_to_f(name)  _MATH_ALIAS_d_to_f(name)
 #define _MATH_ALIAS_d_di_to_f(name)  _MATH_ALIAS_d_to_f(name)
 #define _MATH_ALIAS_d_dj_to_f(name)  _MATH_ALIAS_d_to_f(name)
+#define _MATH_ALIAS_d_dk_to_f(name)  _MATH_ALIAS_d_to_f(name)
 #define _MATH_ALIAS_i_d_to_f(name)   _MATH_ALIAS_d_to_f(name)
 #define _MATH_ALIAS_j_d_to_f(name)   _MATH_ALIAS_d_to_f(name)
 #define _MATH_ALIAS_k_d_to_f(name)   _MATH_ALIAS_d_to_f(name)
@@ -532,6 +558,11 @@ force_eval_long_double(long double x)
     {                                                   \
         return (double)__FLOAT_NAME(name)((float)x, n); \
     }
+#define _MATH_ALIAS_d_dk_to_f(name)                     \
+    double _D_NAME(name)(double x, long long n)         \
+    {                                                   \
+        return (double)__FLOAT_NAME(name)((float)x, n); \
+    }
 #define _MATH_ALIAS_i_d_to_f(name)           \
     int _D_NAME(name)(double x)              \
     {                                        \
@@ -572,6 +603,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_d_id_to_f(name)
 #define _MATH_ALIAS_d_di_to_f(name)
 #define _MATH_ALIAS_d_dj_to_f(name)
+#define _MATH_ALIAS_d_dk_to_f(name)
 #define _MATH_ALIAS_i_d_to_f(name)
 #define _MATH_ALIAS_j_d_to_f(name)
 #define _MATH_ALIAS_k_d_to_f(name)
@@ -600,6 +632,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_l_il_to_f(name)  _MATH_ALIAS_l_to_f(name)
 #define _MATH_ALIAS_l_li_to_f(name)  _MATH_ALIAS_l_to_f(name)
 #define _MATH_ALIAS_l_lj_to_f(name)  _MATH_ALIAS_l_to_f(name)
+#define _MATH_ALIAS_l_lk_to_f(name)  _MATH_ALIAS_l_to_f(name)
 #define _MATH_ALIAS_i_l_to_f(name)   _MATH_ALIAS_l_to_f(name)
 #define _MATH_ALIAS_j_l_to_f(name)   _MATH_ALIAS_l_to_f(name)
 #define _MATH_ALIAS_k_l_to_f(name)   _MATH_ALIAS_l_to_f(name)
@@ -666,6 +699,11 @@ force_eval_long_double(long double x)
     {                                                       \
         return (long double)_FLOAT_NAME(name)((float)x, n); \
     }
+#define _MATH_ALIAS_l_lk_to_f(name)                         \
+    long double _LD_NAME(name)(long double x, long long n)  \
+    {                                                       \
+        return (long double)_FLOAT_NAME(name)((float)x, n); \
+    }
 #define _MATH_ALIAS_i_l_to_f(name)          \
     int _LD_NAME(name)(long double x)       \
     {                                       \
@@ -704,6 +742,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_l_il_to_d(name)
 #define _MATH_ALIAS_l_li_to_d(name)
 #define _MATH_ALIAS_l_lj_to_d(name)
+#define _MATH_ALIAS_l_lk_to_d(name)
 #define _MATH_ALIAS_i_l_to_d(name)
 #define _MATH_ALIAS_j_l_to_d(name)
 #define _MATH_ALIAS_k_l_to_d(name)
@@ -721,6 +760,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_l_il_to_f(name)
 #define _MATH_ALIAS_l_li_to_f(name)
 #define _MATH_ALIAS_l_lj_to_f(name)
+#define _MATH_ALIAS_l_lk_to_f(name)
 #define _MATH_ALIAS_i_l_to_f(name)
 #define _MATH_ALIAS_j_l_to_f(name)
 #define _MATH_ALIAS_k_l_to_f(name)
@@ -739,6 +779,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_l_il_to_d(name)  _MATH_ALIAS_l_to_d(name)
 #define _MATH_ALIAS_l_li_to_d(name)  _MATH_ALIAS_l_to_d(name)
 #define _MATH_ALIAS_l_lj_to_d(name)  _MATH_ALIAS_l_to_d(name)
+#define _MATH_ALIAS_l_lk_to_d(name)  _MATH_ALIAS_l_to_d(name)
 #define _MATH_ALIAS_i_l_to_d(name)   _MATH_ALIAS_l_to_d(name)
 #define _MATH_ALIAS_j_l_to_d(name)   _MATH_ALIAS_l_to_d(name)
 #define _MATH_ALIAS_k_l_to_d(name)   _MATH_ALIAS_l_to_d(name)
@@ -805,6 +846,11 @@ force_eval_long_double(long double x)
     {                                                    \
         return (long double)_D_NAME(name)((double)x, j); \
     }
+#define _MATH_ALIAS_l_lk_to_d(name)                        \
+    long double _LD_NAME(name)(long double x, long long j) \
+    {                                                      \
+        return (long double)_D_NAME(name)((double)x, j);   \
+    }
 #define _MATH_ALIAS_i_l_to_d(name)       \
     int _LD_NAME(name)(long double x)    \
     {                                    \
@@ -868,6 +914,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_l_il_to_f(name)
 #define _MATH_ALIAS_l_li_to_f(name)
 #define _MATH_ALIAS_l_lj_to_f(name)
+#define _MATH_ALIAS_l_lk_to_f(name)
 #define _MATH_ALIAS_i_l_to_f(name)
 #define _MATH_ALIAS_j_l_to_f(name)
 #define _MATH_ALIAS_k_l_to_f(name)
@@ -885,6 +932,7 @@ force_eval_long_double(long double x)
 #define _MATH_ALIAS_l_il_to_d(name)
 #define _MATH_ALIAS_l_li_to_d(name)
 #define _MATH_ALIAS_l_lj_to_d(name)
+#define _MATH_ALIAS_l_lk_to_d(name)
 #define _MATH_ALIAS_i_l_to_d(name)
 #define _MATH_ALIAS_j_l_to_d(name)
 #define _MATH_ALIAS_k_l_to_d(name)
@@ -959,6 +1007,8 @@ force_eval_long_double(long double x)
 
 #define _MATH_ALIAS_f_fj(name)  _MATH_ALIAS_d_dj_to_f(name) _MATH_ALIAS_l_lj_to_f(name)
 
+#define _MATH_ALIAS_f_fk(name)  _MATH_ALIAS_d_dk_to_f(name) _MATH_ALIAS_l_lk_to_f(name)
+
 #define _MATH_ALIAS_i_f(name)   _MATH_ALIAS_i_d_to_f(name) _MATH_ALIAS_i_l_to_f(name)
 
 #define _MATH_ALIAS_j_f(name)   _MATH_ALIAS_j_d_to_f(name) _MATH_ALIAS_j_l_to_f(name)
@@ -995,6 +1045,8 @@ force_eval_long_double(long double x)
 
 #define _MATH_ALIAS_d_dj(name)  _MATH_ALIAS_l_lj_to_d(name)
 
+#define _MATH_ALIAS_d_dk(name)  _MATH_ALIAS_l_lk_to_d(name)
+
 #define _MATH_ALIAS_i_d(name)   _MATH_ALIAS_i_l_to_d(name)
 
 #define _MATH_ALIAS_j_d(name)   _MATH_ALIAS_j_l_to_d(name)
@@ -1087,6 +1139,94 @@ float __math_denormf(float x);
 #define __math_denormf(x) (x)
 #endif
 
+/*
+ * Without an FPU (_SOFT_FLOAT) every float operation is a library
+ * call, so the rounding functions (floor, ceil, trunc, round, rint,
+ * lrint) work on the bits alone. Exceptions are then raised through
+ * __math_set_*, which compile away unless fenv support is enabled.
+ */
+#ifdef _SOFT_FLOAT
+#define __MATH_INT_ROUNDING 1
+#else
+#define __MATH_INT_ROUNDING 0
+#endif
+
+/*
+ * Whether a value with non-zero discarded bits rounds away from zero
+ * in the current rounding mode
+ */
+static inline int
+__math_round_away(int above_half, int at_half, int odd, int neg)
+{
+#if WANT_ROUNDING
+    switch (fegetround()) {
+#ifdef FE_UPWARD
+    case FE_UPWARD:
+        return !neg;
+#endif
+#ifdef FE_DOWNWARD
+    case FE_DOWNWARD:
+        return neg;
+#endif
+#ifdef FE_TOWARDZERO
+    case FE_TOWARDZERO:
+        return 0;
+#endif
+    default:
+        break;
+    }
+#else
+    (void)neg;
+#endif
+    return above_half || (at_half && odd);
+}
+
+/* x + x for infinite or NaN x */
+static inline float
+__math_quietf(float x)
+{
+#if __MATH_INT_ROUNDING
+    if (issignalingf_inline(x)) {
+        __math_set_invalidf();
+        if (_IEEE_754_2008_SNAN)
+            return asfloat(asuint(x) | 0x00400000);
+    }
+    return x;
+#else
+    return x + x;
+#endif
+}
+
+/* Bits of rintf(x) for finite x with |x| < 2**23 */
+static inline uint32_t
+__math_rintf_bits(uint32_t ix)
+{
+    int      e = _exponent32(ix) - 0x7f;
+    uint32_t mask, rem, half, one;
+    int      odd;
+
+    if (e < 0) {
+        /* Result is 0 or 1, compare against 0.5 */
+        mask = 0x7fffffff;
+        half = 0x3f000000;
+        one = 0x3f800000;
+        odd = 0;
+    } else {
+        mask = 0x007fffff >> e;
+        half = (mask >> 1) + 1;
+        one = mask + 1;
+        odd = (ix & one) != 0;
+    }
+    rem = ix & mask;
+    if (rem == 0)
+        return ix;
+    __math_set_inexactf();
+    ix &= ~mask;
+    if (__math_round_away(rem > half, rem == half, odd, ix >> 31))
+        ix += one;
+    return ix;
+}
+
 #ifdef _NEED_FLOAT64
 /* The result overflows.  */
 HIDDEN __float64 __math_oflow(uint32_t);
@@ -1147,6 +1287,60 @@ __float64 __math_denorm(__float64 x);
 #define __math_denorm(x) (x)
 #endif
 
+/* x + x for infinite or NaN x */
+static inline __float64
+__math_quiet64(__float64 x)
+{
+#if __MATH_INT_ROUNDING
+    if (issignaling64_inline(x)) {
+        __math_set_invalid();
+        if (_IEEE_754_2008_SNAN)
+            return asfloat64(asuint64(x) | 0x0008000000000000ULL);
+    }
+    return x;
+#else
+    return x + x;
+#endif
+}
+
+/* Bits of rint(x) for finite x with |x| < 2**52 */
+static inline uint64_t
+__math_rint64_bits(uint64_t ix)
+{
+    int      e = _exponent64(ix) - 0x3ff;
+    uint64_t mask, rem, half, one;
+    int      odd;
+
+    if (e < 0) {
+        /* Result is 0 or 1, compare against 0.5 */
+        mask = 0x7fffffffffffffffULL;
+        half = 0x3fe0000000000000ULL;
+        one = 0x3ff0000000000000ULL;
+        odd = 0;
+    } else {
+        mask = 0x000fffffffffffffULL >> e;
+        half = (mask >> 1) + 1;
+        one = mask + 1;
+        odd = (ix & one) != 0;
+    }
+    rem = ix & mask;
+    if (rem == 0)
+        return ix;
+    __math_set_inexact64();
+    ix &= ~mask;
+    if (__math_round_away(rem > half, rem == half, odd, ix >> 63))
+        ix += one;
+    return ix;
+}
+
+/*
+ * Round y, within 4 ULP of the exact f(x), to float. hard[] lists, in
+ * order, the x whose f(x) lies within 7 ULP of the midpoint of two
+ * floats, and bit i of up[] is set when hard[i] rounds away from zero.
+ */
+HIDDEN float __math_cr_roundf(float x, __float64 y, const uint32_t *hard, const uint8_t *up,
+                              int n);
+
 #endif /* _NEED_FLOAT64 */
 
 #ifdef __HAVE_LONG_DOUBLE
@@ -1343,10 +1537,12 @@ extern int __signgam;
 #define atan264         _NAME_64(atan2)
 #define cbrt64          _NAME_64(cbrt)
 #define ceil64          _NAME_64(ceil)
+#define compoundn64     _NAME_64(compoundn)
 #define copysign64      _NAME_64(copysign)
 #define cos64           _NAME_64(cos)
 #define _cos64          _NAME_64(_cos)
 #define cosh64          _NAME_64(cosh)
+#define cospi64         _NAME_64(cospi)
 #define drem64          _NAME_64(drem)
 #define erf64           _NAME_64(erf)
 #define erfc64          _NAME_64(erfc)
@@ -1403,9 +1599,12 @@ extern int __signgam;
 #define pow64           _NAME_64(pow)
 #define _pow64          _NAME_64(_pow)
 #define pow1064         _NAME_64(pow10)
+#define pown64          _NAME_64(pown)
+#define powr64          _NAME_64(powr)
 #define remainder64     _NAME_64(remainder)
 #define remquo64        _NAME_64(remquo)
 #define rint64          _NAME_64(rint)
+#define rootn64         _NAME_64(rootn)
 #define round64         _NAME_64(round)
 #define scalb64         _NAME_64(scalb)
 #define scalbn64        _NAME_64(scalbn)
@@ -1415,7 +1614,9 @@ extern int __signgam;
 #define sin64           _NAME_64(sin)
 #define _sin64          _NAME_64(_sin)
 #define sincos64        _NAME_64(sincos)
+#define sincospi64      _NAME_64(sincospi)
 #define sinh64          _NAME_64(sinh)
+#define sinpi64         _NAME_64(sinpi)
 #define sqrt64          _NAME_64(sqrt)
 #define tan64           _NAME_64(tan)
 #define tanh64          _NAME_64(tanh)
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ */
+
+#include "math_config.h"
+
+#ifdef _NEED_FLOAT64
+
+/*
+ * A float rounding boundary within CR_ULP of y is one within 7 ULP of
+ * the exact result, as long as y is off by 4 ULP at most
+ */
+#define CR_ULP 3
+
+float
+__math_cr_roundf(float x, __float64 y, const uint32_t *hard, const uint8_t *up, int n)
+{
+    uint64_t iy = asuint64(y);
+    uint32_t ix;
+    float    lo, hi;
+    int      l, h, m;
+
+    if ((iy << 1) == 0)
+        return (float)y;
+
+    /* Everything within the error bound rounds the same way */
+    lo = (float)asfloat64(iy - CR_ULP);
+    hi = (float)asfloat64(iy + CR_ULP);
+    if (asuint(lo) == asuint(hi))
+        return lo;
+
+#if WANT_ROUNDING
+    if (fegetround() != FE_TONEAREST)
+        return (float)y;
+#endif
+
+    /* Near a midpoint, so x must be one of the hard cases */
+    ix = asuint(x);
+    l = 0;
+    h = n - 1;
+    while (l <= h) {
+        m = (l + h) >> 1;
+        if (hard[m] == ix)
+            return ((up[m >> 3] >> (m & 7)) & 1) ? hi : lo;
+        if (hard[m] < ix)
+            l = m + 1;
+        else
+            h = m - 1;
+    }
+    return (float)y;
+}
+
+#endif /* _NEED_FLOAT64 */
@@ -32,6 +32,7 @@
 #include <math.h>
 #include <stdint.h>
 #include "math_config.h"
+#include "pown.h"
 
 /*
 Worst-case error: 0.54 ULP (~= ulperr_exp + 1024*Ln2*relerr_log*2^53)
@@ -301,11 +302,17 @@ pow(double x, double y)
     uint32_t sign_bias = 0;
     uint64_t ix, iy;
     uint32_t topx, topy;
+    int      pn;
 
     ix = asuint64(x);
     iy = asuint64(y);
     topx = top12(x);
     topy = top12(y);
+
+    /* y is a small integer and x^y stays normal: multiply */
+    pn = __pown_small_y(iy >> 32, (uint32_t)iy);
+    if (pn != 0 && (topx & 0x7ff) - 0x37f < 0x100)
+        return __pown_small(x, pn);
     if (unlikely(topx - 0x001 >= 0x7ff - 0x001 || (topy & 0x7ff) - 0x3be >= 0x43e - 0x3be)) {
         /* Note: if |y| > 1075 * ln2 * 2^53 ~= 0x1.749p62 then pow(x,y) = inf/0
            and if |y| < 2^-54 / 1075 ~= 0x1.e7b6p-65 then pow(x,y) = +-1.  */
@@ -0,0 +1,276 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer powers by square-and-multiply, shared by pow and powf for
+ * small integer exponents and by the C23 pown, rootn and compoundn.
+ *
+ * The double code keeps the running power as an unevaluated sum
+ * hi + lo (double-double), so each multiply adds an error near 2^-104
+ * and the only rounding that shows is the last one. The general form
+ * also keeps hi in [0.5, 1] and the binary exponent in an int, so no
+ * intermediate can overflow or underflow whatever n is.
+ *
+ * Float callers do the same in plain double, which already carries 29
+ * bits more than a float needs.
+ */
+
+#ifndef _POWN_H_
+#define _POWN_H_
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+/* Beyond this the final scalbn overflows or underflows anyway */
+#define __POWN_EXP_LIMIT (1 << 20)
+
+static inline int
+__pown_add_exp(int a, int b)
+{
+    int s = a + b;
+
+    if (s > __POWN_EXP_LIMIT)
+        s = __POWN_EXP_LIMIT;
+    if (s < -__POWN_EXP_LIMIT)
+        s = -__POWN_EXP_LIMIT;
+    return s;
+}
+
+/*
+ * Recognize y = +-2 .. +-7 from the high and low words of a double
+ * or the bits of a float and return it as an int, 0 for anything else.
+ * Every other integer either has a cheaper special case already or
+ * costs more multiplies than the log/exp path.
+ */
+static inline int
+__pown_small_y(__uint32_t hy, __uint32_t ly)
+{
+    __uint32_t iy = hy & 0x7fffffff;
+    int        n;
+
+    if (ly != 0 || iy < 0x40000000 || iy >= 0x40200000)
+        return 0;
+    if (iy < 0x40100000) {
+        if (iy & 0x7ffff)
+            return 0;
+        n = 2 + (int)(iy >> 19 & 1);
+    } else {
+        if (iy & 0x3ffff)
+            return 0;
+        n = 4 + (int)(iy >> 18 & 3);
+    }
+    return (hy & 0x80000000) ? -n : n;
+}
+
+static inline int
+__pown_small_yf(__uint32_t hy)
+{
+    __uint32_t iy = hy & 0x7fffffff;
+    int        n;
+
+    if (iy < 0x40000000 || iy >= 0x41000000)
+        return 0;
+    if (iy < 0x40800000) {
+        if (iy & 0x3fffff)
+            return 0;
+        n = 2 + (int)(iy >> 22 & 1);
+    } else {
+        if (iy & 0x1fffff)
+            return 0;
+        n = 4 + (int)(iy >> 21 & 3);
+    }
+    return (hy & 0x80000000) ? -n : n;
+}
+
+#ifdef _NEED_FLOAT64
+
+/* hi + *lo = a * b exactly */
+static inline __float64
+__pown_two_prod(__float64 a, __float64 b, __float64 *lo)
+{
+    __float64 hi = a * b;
+    /* m65832 has an integer fma, far cheaper than the split below */
+#if __HAVE_FAST_FMA || defined(__m65832__)
+    *lo = fma64(a, b, -hi);
+#else
+    /* Dekker: split each factor into two 26-bit halves */
+    const __float64 c = _F_64(0x1p27) + 1;
+    __float64       t, ah, al, bh, bl;
+
+    t = c * a;
+    ah = t - (t - a);
+    al = a - ah;
+    t = c * b;
+    bh = t - (t - b);
+    bl = b - bh;
+    *lo = ((ah * bh - hi) + ah * bl + al * bh) + al * bl;
+#endif
+    return hi;
+}
+
+/* (*h + *l) *= (bh + bl) */
+static inline void
+__pown_mul(__float64 *h, __float64 *l, __float64 bh, __float64 bl)
+{
+    __float64 lo, hi = __pown_two_prod(*h, bh, &lo);
+
+    lo += *h * bl + *l * bh;
+    *h = hi + lo;
+    *l = lo - (*h - hi);
+}
+
+/* 1 / (h + l), rounded once */
+static inline __float64
+__pown_recip(__float64 h, __float64 l)
+{
+    __float64 q = 1 / h, pe, p = __pown_two_prod(q, h, &pe);
+
+    return q + q * (((1 - p) - pe) - q * l);
+}
+
+/*
+ * x^n for 2 <= |n| <= 7 and x far enough from the ends of the range
+ * that neither the result nor any intermediate leaves the normal
+ * numbers, which is what the pow fast path checks before calling.
+ */
+static inline __float64
+__pown_small(__float64 x, int n)
+{
+    __float64 bh = x, bl = 0, rh = 1, rl = 0;
+    unsigned  k = n < 0 ? -n : n;
+
+    if (n == 2)
+        return x * x;
+    if (k & 1)
+        rh = x;
+    for (k >>= 1; k; k >>= 1) {
+        __pown_mul(&bh, &bl, bh, bl);
+        if (k & 1)
+            __pown_mul(&rh, &rl, bh, bl);
+    }
+    if (n < 0)
+        return __pown_recip(rh, rl);
+    return rh + rl;
+}
+
+/* The float version of __pown_small, with |x| in [2^-16, 2^16) */
+static inline float
+__pownf_small(float x, int n)
+{
+    __float64 b = x, r = 1;
+    unsigned  k = n < 0 ? -n : n;
+
+    if (k & 1)
+        r = b;
+    for (k >>= 1; k; k >>= 1) {
+        b *= b;
+        if (k & 1)
+            r *= b;
+    }
+    if (n < 0)
+        r = 1 / r;
+    return (float)r;
+}
+
+/*
+ * (xh + xl)^n as *rh + *rl times 2^return, with *rh in [0.5, 1].
+ * xh must be finite, positive and nonzero, n nonzero.
+ */
+static inline int
+__pown_core(__float64 xh, __float64 xl, unsigned long long n, __float64 *rh, __float64 *rl)
+{
+    __float64 bh, bl, h = _F_64(0.5), l = 0;
+    int       be, e = 1;
+
+    bh = frexp64(xh, &be);
+    bl = scalbn64(xl, -be);
+    for (;;) {
+        if (n & 1) {
+            __pown_mul(&h, &l, bh, bl);
+            e = __pown_add_exp(e, be);
+            if (h < _F_64(0.5)) {
+                h *= 2;
+                l *= 2;
+                e--;
+            }
+        }
+        n >>= 1;
+        if (!n)
+            break;
+        __pown_mul(&bh, &bl, bh, bl);
+        be = __pown_add_exp(be, be);
+        if (bh < _F_64(0.5)) {
+            bh *= 2;
+            bl *= 2;
+            be--;
+        }
+    }
+    *rh = h;
+    *rl = l;
+    return e;
+}
+
+/* (xh + xl)^n or its reciprocal, with overflow and underflow from scalbn */
+static inline __float64
+__pown(__float64 xh, __float64 xl, unsigned long long n, int recip)
+{
+    __float64 h, l;
+    int       e = __pown_core(xh, xl, n, &h, &l);
+
+    if (recip)
+        return scalbn64(__pown_recip(h, l), -e);
+    return scalbn64(h + l, e);
+}
+
+/*
+ * x^n in plain double for the float functions, as a value in
+ * [0.5, 1] times 2^return. x must be finite, positive and nonzero.
+ */
+static inline int
+__pownf_core(__float64 x, unsigned long long n, __float64 *r)
+{
+    __float64 b, p = _F_64(0.5);
+    int       be, e = 1;
+
+    b = frexp64(x, &be);
+    for (;;) {
+        if (n & 1) {
+            p *= b;
+            e = __pown_add_exp(e, be);
+            if (p < _F_64(0.5)) {
+                p *= 2;
+                e--;
+            }
+        }
+        n >>= 1;
+        if (!n)
+            break;
+        b *= b;
+        be = __pown_add_exp(be, be);
+        if (b < _F_64(0.5)) {
+            b *= 2;
+            be--;
+        }
+    }
+    *r = p;
+    return e;
+}
+
+/* Round a double result to float, reporting overflow and underflow */
+static inline float
+__pown_to_float(__float64 r)
+{
+    float f = (float)r;
+
+    if (isinf(f) && !isinf(r))
+        return __math_oflowf(signbit(r));
+    if (f == 0 && r != 0)
+        return __math_uflowf(signbit(r));
+    return f;
+}
+
+#endif /* _NEED_FLOAT64 */
+
+#endif /* _POWN_H_ */
@@ -64,6 +64,40 @@ ANSI C, POSIX
 
 #ifdef _NEED_FLOAT64
 
+#if __MATH_INT_ROUNDING
+
+long int
+lrint64(__float64 x)
+{
+    uint64_t ix = asuint64(x);
+    int      e = _exponent64(ix) - 0x3ff;
+    int      sx = ix >> 63;
+    uint64_t m;
+
+    if (e < 52) {
+        ix = __math_rint64_bits(ix);
+        e = _exponent64(ix) - 0x3ff;
+        if (e < 0)
+            return 0;
+    }
+    if (e >= (int)(sizeof(long int) * 8) - 1) {
+        /* Out of range, inf or NaN, except for LONG_MIN itself */
+        if (!sx || e != (int)(sizeof(long int) * 8) - 1 || _significand64(ix) != 0) {
+            __math_set_invalid();
+            return sx ? LONG_MIN : LONG_MAX;
+        }
+        return LONG_MIN;
+    }
+    m = _significand64(ix) | 0x0010000000000000ULL;
+    if (e >= 52)
+        m <<= e - 52;
+    else
+        m >>= 52 - e;
+    return sx ? -(long int)(unsigned long)m : (long int)(unsigned long)m;
+}
+
+#else
+
 static const __float64
 
     /* Adding a double, x, to 2^52 will cause the result to be rounded based on
@@ -162,6 +196,8 @@ lrint64(__float64 x)
     return sx ? -result : result;
 }
 
+#endif /* __MATH_INT_ROUNDING */
+
 _MATH_ALIAS_j_d(lrint)
 
 #endif /* _NEED_FLOAT64 */
@@ -69,6 +69,24 @@ SEEALSO
 
 #ifdef _NEED_FLOAT64
 
+#if __MATH_INT_ROUNDING
+
+__float64
+rint64(__float64 x)
+{
+    uint64_t ix = asuint64(x);
+    int      e = _exponent64(ix) - 0x3ff;
+
+    if (e >= 52) {
+        if (e == 0x400)
+            return __math_quiet64(x); /* inf or NaN */
+        return x;                     /* x is integral */
+    }
+    return asfloat64(__math_rint64_bits(ix));
+}
+
+#else
+
 static const __float64 TWO52[2] = {
     _F_64(4.50359962737049600000e+15),  /* 0x43300000, 0x00000000 */
     _F_64(-4.50359962737049600000e+15), /* 0xC3300000, 0x00000000 */
@@ -133,6 +151,8 @@ rint64(__float64 x)
     return w - TWO52[sx];
 }
 
+#endif /* __MATH_INT_ROUNDING */
+
 _MATH_ALIAS_d_d(rint)
 
 #endif /* _NEED_FLOAT64 */
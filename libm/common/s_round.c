@@ -77,7 +77,7 @@ round64(__float64 x)
     } else if (exponent_less_1023 > 51) {
         if (exponent_less_1023 == 1024)
             /* x is NaN or infinite. */
-            return x + x;
+            return __math_quiet64(x);
         else
             return x;
     } else {
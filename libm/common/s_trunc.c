@@ -54,7 +54,7 @@ trunc64(__float64 x)
 
     /* Inf/NaN, evaluate value */
     if (unlikely(exp == 1024))
-        return x + x;
+        return __math_quiet64(x);
 
     /* compute portion of value with useful bits */
     if (exp < 0)
@@ -29,9 +29,7 @@
 #include "fdlibm.h"
 #if !__OBSOLETE_MATH_FLOAT
 
-#include <math.h>
-#include <stdint.h>
-#include "math_config.h"
+#include "sf_exp.h"
 
 /*
 EXP2F_TABLE_BITS = 5
@@ -43,24 +41,11 @@ Wrong count: 170635 (all nearest rounding wrong results with fma.)
 Non-nearest ULP error: 1 (rounded ULP error)
 */
 
-#define N       (1 << EXP2F_TABLE_BITS)
-#define InvLn2N __exp2f_data.invln2_scaled
-#define T       __exp2f_data.tab
-#define C       __exp2f_data.poly_scaled
-
-static inline uint32_t
-top12(float x)
-{
-    return asuint(x) >> 20;
-}
-
 float
 expf(float x)
 {
     uint32_t abstop;
-    uint64_t ki, t;
-    /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
-    double_t kd, xd, z, r, r2, y, s;
+    double_t xd;
 
     xd = (double_t)x;
     abstop = top12(x) & 0x7ff;
@@ -80,32 +65,6 @@ expf(float x)
 #endif
     }
 
-    /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  */
-    z = InvLn2N * xd;
-
-    /* Round and convert z to int, the result is in [-150*N, 128*N] and
-       ideally ties-to-even rule is used, otherwise the magnitude of r
-       can be bigger which gives larger approximation error.  */
-#if TOINT_INTRINSICS
-    kd = roundtoint(z);
-    ki = converttoint(z);
-#else
-#define SHIFT __exp2f_data.shift
-    kd = (double)(z + SHIFT); /* Rounding to double precision is required.  */
-    ki = asuint64(kd);
-    kd -= SHIFT;
-#endif
-    r = z - kd;
-
-    /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
-    t = T[ki % N];
-    t += ki << (52 - EXP2F_TABLE_BITS);
-    s = asfloat64(t);
-    z = C[0] * r + C[1];
-    r2 = r * r;
-    y = C[2] * r + 1;
-    y = z * r2 + y;
-    y = y * s;
-    return (float)y;
+    return expf_inline(xd);
 }
 #endif /* !__OBSOLETE_MATH_FLOAT */
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Correctly rounded exp2f for the __cr_ tier (__cr_exp2f): exp2 in
+ * double precision, rounded to float by __math_cr_roundf. hard[] holds
+ * the 11 arguments, found by an exhaustive search against extended
+ * precision, whose 2**x lies within 7 double ULP of the midpoint of
+ * two floats.
+ */
+
+#include "math_config.h"
+
+#ifdef _NEED_FLOAT64
+
+static const uint32_t hard[] = {
+    0x33b8aa3b, 0x36879cf7, 0x3a07857c, 0x3b429d37, 0x3c02a9ad, 0x3dc9abe2,
+    0xb52d1f9a, 0xb8d3d026, 0xbaec2b40, 0xbcf3a937, 0xbe1f29de,
+};
+
+/* Bit i set when hard[i] rounds away from zero */
+static const uint8_t up[] = {
+    0x2b, 0x07,
+};
+
+#define NHARD (sizeof(hard) / sizeof(hard[0]))
+
+float
+__cr_exp2f(float x)
+{
+    uint32_t ix = asuint(x);
+    float    r;
+
+    if (ix == 0xff800000)
+        return 0.0f;
+    if ((ix & 0x7f800000) == 0x7f800000)
+        return __math_quietf(x);
+    r = __math_cr_roundf(x, exp264((__float64)x), hard, up, NHARD);
+    if (isinf(r))
+        return __math_oflowf(0);
+    if (r == 0.0f)
+        return __math_uflowf(0);
+    return r;
+}
+
+#else
+
+float
+__cr_exp2f(float x)
+{
+    return exp2f(x);
+}
+
+#endif /* _NEED_FLOAT64 */
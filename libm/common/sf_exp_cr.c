@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Correctly rounded expf for the __cr_ tier (__cr_expf): exp in
+ * double precision, rounded to float by __math_cr_roundf. hard[] holds
+ * the 11 arguments, found by an exhaustive search against extended
+ * precision, whose exp lies within 7 double ULP of the midpoint of
+ * two floats.
+ */
+
+#include "math_config.h"
+
+#ifdef _NEED_FLOAT64
+
+static const uint32_t hard[] = {
+    0x377eff81, 0x383a3ef1, 0x38e69cc1, 0x39c6be5b, 0x3d1a274e, 0x4001b249,
+    0x40315b33, 0xb3000000, 0xbae0e25c, 0xbbf0edf1, 0xc16912cd,
+};
+
+/* Bit i set when hard[i] rounds away from zero */
+static const uint8_t up[] = {
+    0xcb, 0x06,
+};
+
+#define NHARD (sizeof(hard) / sizeof(hard[0]))
+
+float
+__cr_expf(float x)
+{
+    uint32_t ix = asuint(x);
+    float    r;
+
+    if (ix == 0xff800000)
+        return 0.0f;
+    if ((ix & 0x7f800000) == 0x7f800000)
+        return __math_quietf(x);
+    r = __math_cr_roundf(x, exp64((__float64)x), hard, up, NHARD);
+    if (isinf(r))
+        return __math_oflowf(0);
+    if (r == 0.0f)
+        return __math_uflowf(0);
+    return r;
+}
+
+#else
+
+float
+__cr_expf(float x)
+{
+    return expf(x);
+}
+
+#endif /* _NEED_FLOAT64 */
@@ -29,9 +29,7 @@
 #include "fdlibm.h"
 #if !__OBSOLETE_MATH_FLOAT
 
-#include <math.h>
-#include <stdint.h>
-#include "math_config.h"
+#include "sf_log.h"
 
 /*
 LOGF_TABLE_BITS = 4
@@ -41,19 +39,10 @@ ULP error: 0.818 (nearest rounding.)
 Relative error: 1.957 * 2^-26 (before rounding.)
 */
 
-#define T   __logf_data.tab
-#define A   __logf_data.poly
-#define Ln2 __logf_data.ln2
-#define N   (1 << LOGF_TABLE_BITS)
-#define OFF 0x3f330000
-
 float
 logf(float x)
 {
-    /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
-    double_t z, r, r2, y, y0, invc, logc;
-    uint32_t ix, iz, tmp;
-    int      k, i;
+    uint32_t ix;
 
     ix = asuint(x);
 #if WANT_ROUNDING
@@ -74,26 +63,6 @@ logf(float x)
         ix -= (int32_t)23 << 23;
     }
 
-    /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.
-       The range is split into N subintervals.
-       The ith subinterval contains z and c is near its center.  */
-    tmp = ix - OFF;
-    i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
-    k = (int32_t)tmp >> 23; /* arithmetic shift */
-    iz = ix - (tmp & (uint32_t)0x1ff << 23);
-    invc = T[i].invc;
-    logc = T[i].logc;
-    z = (double_t)asfloat(iz);
-
-    /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
-    r = z * invc - 1;
-    y0 = logc + (double_t)k * Ln2;
-
-    /* Pipelined polynomial evaluation to approximate log1p(r).  */
-    r2 = r * r;
-    y = A[1] * r + A[2];
-    y = A[0] * r2 + y;
-    y = y * r2 + (y0 + r);
-    return (float)y;
+    return logf_inline(ix);
 }
 #endif /* !__OBSOLETE_MATH_FLOAT */
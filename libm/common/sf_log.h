@@ -0,0 +1,75 @@
+/* Inline single-precision log kernel shared by logf and vlogf.
+   Copyright (c) 2017 Arm Ltd.  All rights reserved.
+
+   SPDX-License-Identifier: BSD-3-Clause
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+   3. The name of the company may not be used to endorse or promote
+      products derived from this software without specific prior written
+      permission.
+
+   THIS SOFTWARE IS PROVIDED BY ARM LTD ``AS IS'' AND ANY EXPRESS OR IMPLIED
+   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+   IN NO EVENT SHALL ARM LTD BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#ifndef _SF_LOG_H_
+#define _SF_LOG_H_
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#define T   __logf_data.tab
+#define A   __logf_data.poly
+#define Ln2 __logf_data.ln2
+#define N   (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+
+/* log of the positive, normal float with representation ix, without
+   special cases.  */
+static inline float
+logf_inline(uint32_t ix)
+{
+    /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+    double_t z, r, r2, y, y0, invc, logc;
+    uint32_t iz, tmp;
+    int      k, i;
+
+    /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.
+       The range is split into N subintervals.
+       The ith subinterval contains z and c is near its center.  */
+    tmp = ix - OFF;
+    i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+    k = (int32_t)tmp >> 23; /* arithmetic shift */
+    iz = ix - (tmp & (uint32_t)0x1ff << 23);
+    invc = T[i].invc;
+    logc = T[i].logc;
+    z = (double_t)asfloat(iz);
+
+    /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
+    r = z * invc - 1;
+    y0 = logc + (double_t)k * Ln2;
+
+    /* Pipelined polynomial evaluation to approximate log1p(r).  */
+    r2 = r * r;
+    y = A[1] * r + A[2];
+    y = A[0] * r2 + y;
+    y = y * r2 + (y0 + r);
+    return (float)y;
+}
+
+#endif /* _SF_LOG_H_ */
@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Correctly rounded log2f for the __cr_ tier (__cr_log2f): log2 in
+ * double precision, rounded to float by __math_cr_roundf. hard[] holds
+ * the 162 arguments, found by an exhaustive search against extended
+ * precision, whose log2 lies within 7 double ULP of the midpoint of
+ * two floats.
+ */
+
+#include "math_config.h"
+
+#ifdef _NEED_FLOAT64
+
+static const uint32_t hard[] = {
+    0x002452a4, 0x0048a548, 0x00914a90, 0x01114a90, 0x01914a90, 0x02114a90,
+    0x02914a90, 0x03114a90, 0x03914a90, 0x04114a90, 0x04914a90, 0x05114a90,
+    0x05914a90, 0x06114a90, 0x06914a90, 0x07114a90, 0x07914a90, 0x08114a90,
+    0x08914a90, 0x09114a90, 0x09914a90, 0x0a114a90, 0x0a914a90, 0x0b114a90,
+    0x0b914a90, 0x0c114a90, 0x0c914a90, 0x0d114a90, 0x0d914a90, 0x0e114a90,
+    0x0e914a90, 0x0f114a90, 0x0f914a90, 0x10114a90, 0x10914a90, 0x11114a90,
+    0x11914a90, 0x12114a90, 0x12914a90, 0x13114a90, 0x13914a90, 0x14114a90,
+    0x14914a90, 0x15114a90, 0x15914a90, 0x16114a90, 0x16914a90, 0x17114a90,
+    0x17914a90, 0x18114a90, 0x18914a90, 0x19114a90, 0x19914a90, 0x1a114a90,
+    0x1a914a90, 0x1b114a90, 0x1b914a90, 0x1c114a90, 0x1c914a90, 0x1d114a90,
+    0x1d914a90, 0x1e114a90, 0x1e914a90, 0x1f114a90, 0x2fd54996, 0x30554996,
+    0x30d54996, 0x31554996, 0x31d54996, 0x32554996, 0x32d54996, 0x33554996,
+    0x33d54996, 0x34554996, 0x34d54996, 0x35554996, 0x35d54996, 0x36554996,
+    0x36d54996, 0x37554996, 0x3ea07ab9, 0x40207ab9, 0x47d54996, 0x48554996,
+    0x48d54996, 0x49554996, 0x49d54996, 0x4a554996, 0x4ad54996, 0x4b554996,
+    0x4bd54996, 0x4c554996, 0x4cd54996, 0x4d554996, 0x4dd54996, 0x4e554996,
+    0x4ed54996, 0x4f554996, 0x5f914a90, 0x60114a90, 0x60914a90, 0x61114a90,
+    0x61914a90, 0x62114a90, 0x62914a90, 0x63114a90, 0x63914a90, 0x64114a90,
+    0x64914a90, 0x65114a90, 0x65914a90, 0x66114a90, 0x66914a90, 0x67114a90,
+    0x67914a90, 0x68114a90, 0x68914a90, 0x69114a90, 0x69914a90, 0x6a114a90,
+    0x6a914a90, 0x6b114a90, 0x6b914a90, 0x6c114a90, 0x6c914a90, 0x6d114a90,
+    0x6d914a90, 0x6e114a90, 0x6e914a90, 0x6f114a90, 0x6f914a90, 0x70114a90,
+    0x70914a90, 0x71114a90, 0x71914a90, 0x72114a90, 0x72914a90, 0x73114a90,
+    0x73914a90, 0x74114a90, 0x74914a90, 0x75114a90, 0x75914a90, 0x76114a90,
+    0x76914a90, 0x77114a90, 0x77914a90, 0x78114a90, 0x78914a90, 0x79114a90,
+    0x79914a90, 0x7a114a90, 0x7a914a90, 0x7b114a90, 0x7b914a90, 0x7c114a90,
+    0x7c914a90, 0x7d114a90, 0x7d914a90, 0x7e114a90, 0x7e914a90, 0x7f114a90,
+};
+
+/* Bit i set when hard[i] rounds away from zero */
+static const uint8_t up[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#define NHARD (sizeof(hard) / sizeof(hard[0]))
+
+float
+__cr_log2f(float x)
+{
+    uint32_t ix = asuint(x);
+
+    if ((ix << 1) == 0)
+        return __math_divzerof(1);
+    if (ix >= 0x7f800000) {
+        if (ix == 0x7f800000 || (ix & 0x7fffffff) > 0x7f800000)
+            return __math_quietf(x);
+        return __math_invalidf(x);
+    }
+    return __math_cr_roundf(x, log264((__float64)x), hard, up, NHARD);
+}
+
+#else
+
+float
+__cr_log2f(float x)
+{
+    return log2f(x);
+}
+
+#endif /* _NEED_FLOAT64 */
@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Correctly rounded logf for the __cr_ tier (__cr_logf): log in
+ * double precision, rounded to float by __math_cr_roundf. hard[] holds
+ * the 61 arguments, found by an exhaustive search against extended
+ * precision, whose log lies within 7 double ULP of the midpoint of
+ * two floats.
+ */
+
+#include "math_config.h"
+
+#ifdef _NEED_FLOAT64
+
+static const uint32_t hard[] = {
+    0x022ae487, 0x064cb44b, 0x07c060fa, 0x0dc8bba4, 0x0f61ff63, 0x111c87f8,
+    0x145cb6d4, 0x14907055, 0x158772eb, 0x16c5ee7a, 0x18b06f2a, 0x1a8446cb,
+    0x1aac80dc, 0x1b81ab52, 0x1dc9e7c1, 0x1f116ab8, 0x22925ad4, 0x22f6d580,
+    0x2423c085, 0x25be734f, 0x25f12e61, 0x2758eec4, 0x27a51454, 0x28e3fa26,
+    0x29e6126b, 0x29fd22f8, 0x2c4c24b7, 0x2e492984, 0x38dcbe38, 0x39c31348,
+    0x3bf86ef0, 0x3c413d3a, 0x3e2b3421, 0x3fd364d7, 0x41178feb, 0x464d5b2b,
+    0x4665a9a6, 0x46ca6c75, 0x4b77325a, 0x4bf70db3, 0x4c5d65a5, 0x4d604ebe,
+    0x4e85f412, 0x54af989d, 0x5d800341, 0x5d8b2d5b, 0x5ee8984e, 0x5f64c24a,
+    0x62b467ba, 0x64e27fa3, 0x65d890d3, 0x66a8c860, 0x66abbd63, 0x6914cb96,
+    0x6d1f23eb, 0x6e7054f2, 0x6f31a8ec, 0x736cc271, 0x7405dee8, 0x79e7ec37,
+    0x7d98b8f4,
+};
+
+/* Bit i set when hard[i] rounds away from zero */
+static const uint8_t up[] = {
+    0x7c, 0xdd, 0xfe, 0x5c, 0xc0, 0x23, 0x0d, 0x11,
+};
+
+#define NHARD (sizeof(hard) / sizeof(hard[0]))
+
+float
+__cr_logf(float x)
+{
+    uint32_t ix = asuint(x);
+
+    if ((ix << 1) == 0)
+        return __math_divzerof(1);
+    if (ix >= 0x7f800000) {
+        if (ix == 0x7f800000 || (ix & 0x7fffffff) > 0x7f800000)
+            return __math_quietf(x);
+        return __math_invalidf(x);
+    }
+    return __math_cr_roundf(x, log64((__float64)x), hard, up, NHARD);
+}
+
+#else
+
+float
+__cr_logf(float x)
+{
+    return logf(x);
+}
+
+#endif /* _NEED_FLOAT64 */
@@ -24,6 +24,40 @@
 #include "fdlibm.h"
 #include <limits.h>
 
+#if __MATH_INT_ROUNDING
+
+long int
+lrintf(float x)
+{
+    uint32_t      ix = asuint(x);
+    int           e = _exponent32(ix) - 0x7f;
+    int           sx = ix >> 31;
+    unsigned long m;
+
+    if (e < 23) {
+        ix = __math_rintf_bits(ix);
+        e = _exponent32(ix) - 0x7f;
+        if (e < 0)
+            return 0;
+    }
+    if (e >= (int)(sizeof(long int) * 8) - 1) {
+        /* Out of range, inf or NaN, except for LONG_MIN itself */
+        if (!sx || e != (int)(sizeof(long int) * 8) - 1 || _significand32(ix) != 0) {
+            __math_set_invalidf();
+            return sx ? LONG_MIN : LONG_MAX;
+        }
+        return LONG_MIN;
+    }
+    m = (unsigned long)(_significand32(ix) | 0x800000);
+    if (e >= 23)
+        m <<= e - 23;
+    else
+        m >>= 23 - e;
+    return sx ? -(long int)m : (long int)m;
+}
+
+#else
+
 static const float
     /* Adding a float, x, to 2^23 will cause the result to be rounded based on
        the fractional part of x, according to the implementation's current rounding
@@ -77,4 +111,6 @@ lrintf(float x)
     return sx ? -result : result;
 }
 
+#endif /* __MATH_INT_ROUNDING */
+
 _MATH_ALIAS_j_f(lrint)
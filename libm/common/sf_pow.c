@@ -32,6 +32,7 @@
 #include <math.h>
 #include <stdint.h>
 #include "math_config.h"
+#include "pown.h"
 
 /*
 POWF_LOG2_POLY_ORDER = 5
@@ -157,9 +158,15 @@ powf(float x, float y)
 {
     uint32_t sign_bias = 0;
     uint32_t ix, iy;
+    int      pn;
 
     ix = asuint(x);
     iy = asuint(y);
+
+    /* y is a small integer and x^y stays normal: multiply in double */
+    pn = __pown_small_yf(iy);
+    if (pn != 0 && (ix & 0x7fffffff) - 0x37800000 < 0x10000000)
+        return __pownf_small(x, pn);
     if (__builtin_expect(ix - 0x00800000 >= 0x7f800000 - 0x00800000 || zeroinfnan(iy), 0)) {
         /* Either (x < 0x1p-126 or inf or nan) or (y is 0 or inf or nan).  */
         if (__builtin_expect(zeroinfnan(iy), 0)) {
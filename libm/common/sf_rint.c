@@ -15,6 +15,24 @@
 
 #include "fdlibm.h"
 
+#if __MATH_INT_ROUNDING
+
+float
+rintf(float x)
+{
+    uint32_t ix = asuint(x);
+    int      e = _exponent32(ix) - 0x7f;
+
+    if (e >= 23) {
+        if (e == 0x80)
+            return __math_quietf(x); /* inf or NaN */
+        return x;                    /* x is integral */
+    }
+    return asfloat(__math_rintf_bits(ix));
+}
+
+#else
+
 static const float TWO23[2] = {
     8.3886080000e+06,  /* 0x4b000000 */
     -8.3886080000e+06, /* 0xcb000000 */
@@ -63,4 +81,6 @@ rintf(float x)
     return w - TWO23[sx];
 }
 
+#endif /* __MATH_INT_ROUNDING */
+
 _MATH_ALIAS_f_f(rint)
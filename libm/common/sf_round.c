@@ -41,7 +41,7 @@ roundf(float x)
     } else {
         if (exponent_less_127 == 128)
             /* x is NaN or infinite. */
-            return x + x;
+            return __math_quietf(x);
         else
             return x;
     }
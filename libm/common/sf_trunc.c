@@ -21,7 +21,7 @@ truncf(float x)
     exp = _exponent32(ix) - 127;
 
     if (unlikely(exp == 128))
-        return x + x;
+        return __math_quietf(x);
 
     /* compute portion of value with useful bits */
     if (exp < 0)
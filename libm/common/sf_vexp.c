@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Batch expf
+ *
+ * Arguments below 88 in magnitude use the expf kernel inline; the rest
+ * go through expf itself. The results match expf exactly.
+ */
+
+#include "fdlibm.h"
+#include <vecmath.h>
+
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "sf_exp.h"
+
+void
+vexpf(float *out, const float *in, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        float x = in[i];
+
+        if (unlikely((top12(x) & 0x7ff) >= top12(88.0f)))
+            out[i] = expf(x);
+        else
+            out[i] = expf_inline((double_t)x);
+    }
+}
+
+#else
+
+void
+vexpf(float *out, const float *in, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = expf(in[i]);
+}
+
+#endif
@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Batch logf
+ *
+ * Positive normal arguments use the logf kernel inline; the rest go
+ * through logf itself. The results match logf exactly.
+ */
+
+#include "fdlibm.h"
+#include <vecmath.h>
+
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "sf_log.h"
+
+void
+vlogf(float *out, const float *in, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        uint32_t ix = asuint(in[i]);
+
+        if (unlikely(ix - 0x00800000 >= 0x7f800000 - 0x00800000))
+            out[i] = logf(in[i]);
+        else
+            out[i] = logf_inline(ix);
+    }
+}
+
+#else
+
+void
+vlogf(float *out, const float *in, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = logf(in[i]);
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Batch sinf
+ *
+ * Arguments between 2^-12 and 120 in magnitude take the sinf fast
+ * path inline; the rest go through sinf itself. The results match sinf
+ * exactly.
+ */
+
+#include "fdlibm.h"
+#include <vecmath.h>
+
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "sincosf.h"
+
+void
+vsinf(float *out, const float *in, size_t n)
+{
+    const sincos_t *p0 = &__sincosf_table[0];
+    size_t          i;
+
+    for (i = 0; i < n; i++) {
+        float           y = in[i];
+        const sincos_t *p = p0;
+        double          x;
+        int             q;
+
+        /* one unsigned compare catches both tiny and large arguments */
+        if (unlikely(abstop12(y) - abstop12(0x1p-12f) >= abstop12(120.0f) - abstop12(0x1p-12f))) {
+            out[i] = sinf(y);
+            continue;
+        }
+        x = reduce_fast((double)y, p0, &q);
+        if (q & 2)
+            p = &__sincosf_table[1];
+        out[i] = sinf_poly(x * p0->sign[q & 3], x * x, p, q);
+    }
+}
+
+#else
+
+void
+vsinf(float *out, const float *in, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = sinf(in[i]);
+}
+
+#endif
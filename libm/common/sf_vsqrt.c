@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Batch sqrtf
+ */
+
+#include "fdlibm.h"
+#include <vecmath.h>
+
+void
+vsqrtf(float *out, const float *in, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = sqrtf(in[i]);
+}
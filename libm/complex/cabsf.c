@@ -39,6 +39,12 @@ POSSIBILITY OF SUCH DAMAGE.
 float
 cabsf(float complex z)
 {
+#if defined(__MATH_FAST_LIB) && !defined(_SOFT_FLOAT)
+    /* Without an FPU the integer hypotf is quicker than this */
+    float x = crealf(z), y = cimagf(z);
 
+    return sqrtf(x * x + y * y);
+#else
     return hypotf(crealf(z), cimagf(z));
+#endif
 }
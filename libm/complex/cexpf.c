@@ -32,16 +32,21 @@
  * Marco Atzeri <marco_atzeri@yahoo.it>
  */
 
+#define _GNU_SOURCE
 #include <complex.h>
 #include <math.h>
 
+/* The sine and cosine of the imaginary part come from one reduction */
 float complex
 cexpf(float complex z)
 {
-    float r, x, y;
+    float r, s, c;
 
-    x = crealf(z);
-    y = cimagf(z);
-    r = expf(x);
-    return (float complex)(r * cosf(y)) + r * sinf(y) * I;
+    r = expf(crealf(z));
+    sincosf(cimagf(z), &s, &c);
+#ifdef __MATH_FAST_LIB
+    return CMPLXF(r * c, r * s);
+#else
+    return (float complex)(r * c) + r * s * I;
+#endif
 }
@@ -38,10 +38,17 @@
 float complex
 clogf(float complex z)
 {
+#ifdef __MATH_FAST_LIB
+    /* log |z| straight from x^2 + y^2, which may overflow */
+    float x = crealf(z), y = cimagf(z);
+
+    return CMPLXF(0.5f * logf(x * x + y * y), atan2f(y, x));
+#else
     float p, rr;
 
     rr = cabsf(z);
     p = logf(rr);
     rr = atan2f(cimagf(z), crealf(z));
     return (float complex)p + rr * I;
+#endif
 }
@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Float complex divide for libmfast, replacing the runtime library
+ * __divsc3 like __mulsc3 in mulsc3.c. Smith's method keeps the
+ * intermediate values in range; one reciprocal of the denominator
+ * replaces two divisions, and there is no Annex G infinity or NaN
+ * recovery.
+ */
+
+#include <complex.h>
+#include <math.h>
+
+#ifdef __MATH_FAST_LIB
+
+float complex __divsc3(float a, float b, float c, float d);
+
+float complex
+__divsc3(float a, float b, float c, float d)
+{
+    float r, t;
+
+    if (fabsf(c) >= fabsf(d)) {
+        r = d / c;
+        t = 1.0f / (c + d * r);
+        return CMPLXF((a + b * r) * t, (b - a * r) * t);
+    }
+    r = c / d;
+    t = 1.0f / (c * r + d);
+    return CMPLXF((a * r + b) * t, (b * r - a) * t);
+}
+
+#endif
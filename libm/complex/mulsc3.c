@@ -0,0 +1,26 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Float complex multiply for libmfast. The compiler calls __mulsc3
+ * for a complex product unless built with -ffast-math or
+ * -fcx-limited-range; the runtime library version then spends most of
+ * its time recovering infinities from NaN results as Annex G asks.
+ * This one is the plain four multiplies and two adds, so code linked
+ * with -lmfast gets the -ffast-math product without rebuilding.
+ */
+
+#include <complex.h>
+
+#ifdef __MATH_FAST_LIB
+
+float complex __mulsc3(float a, float b, float c, float d);
+
+float complex
+__mulsc3(float a, float b, float c, float d)
+{
+    return CMPLXF(a * c - b * d, a * d + b * c);
+}
+
+#endif
@@ -0,0 +1,21 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Internal helpers for the Q15/Q31 fixed-point functions
+ */
+
+#ifndef _FIXED_LOCAL_H_
+#define _FIXED_LOCAL_H_
+
+#include <fixmath.h>
+
+/* High half of a 32 x 32-bit product */
+static inline uint32_t
+__q_mul32(uint32_t a, uint32_t b)
+{
+    return (uint32_t)(((uint64_t)a * b) >> 32);
+}
+
+#endif /* _FIXED_LOCAL_H_ */
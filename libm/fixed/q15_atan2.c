@@ -0,0 +1,15 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q15 atan2 divided by pi, rounded from the Q31 result
+ */
+
+#include "local.h"
+
+q15_t
+q15_atan2(q15_t y, q15_t x)
+{
+    return q15_from_q31(q31_atan2(q31_from_q15(y), q31_from_q15(x)));
+}
@@ -0,0 +1,15 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q15 cosine of pi x, rounded from the Q31 result
+ */
+
+#include "local.h"
+
+q15_t
+q15_cos(q15_t x)
+{
+    return q15_from_q31(q31_cos(q31_from_q15(x)));
+}
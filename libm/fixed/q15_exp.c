@@ -0,0 +1,15 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q15 exp(16 x), rounded from the Q31 exp(32 x) of x / 2
+ */
+
+#include "local.h"
+
+q15_t
+q15_exp(q15_t x)
+{
+    return q15_from_q31(q31_exp((q31_t)x * 32768));
+}
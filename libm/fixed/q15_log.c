@@ -0,0 +1,20 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q15 ln(x) / 16, rounded from the Q31 ln(x) / 32
+ */
+
+#include "local.h"
+
+q15_t
+q15_log(q15_t x)
+{
+    q31_t l;
+
+    if (x <= 0)
+        return Q15_MIN;
+    l = q31_log(q31_from_q15(x));
+    return q15_sat((l >> 15) + ((l >> 14) & 1));
+}
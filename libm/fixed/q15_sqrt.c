@@ -0,0 +1,35 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q15 square root, rounded to nearest
+ *
+ * The root of x 2^15 is found a bit at a time in 32-bit arithmetic.
+ */
+
+#include "local.h"
+
+q15_t
+q15_sqrt(q15_t x)
+{
+    uint32_t v, r = 0, one = 1UL << 30;
+
+    if (x <= 0)
+        return 0;
+    v = (uint32_t)x << 15;
+    while (one > v)
+        one >>= 2;
+    while (one) {
+        if (v >= r + one) {
+            v -= r + one;
+            r = (r >> 1) + one;
+        } else {
+            r >>= 1;
+        }
+        one >>= 2;
+    }
+    if (v > r)
+        r++;
+    return (q15_t)r;
+}
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q31 atan2 divided by pi
+ *
+ * The arguments are folded into the first octant and scaled up to 61
+ * bits, then 32 CORDIC vectoring steps rotate (x, y) onto the x axis
+ * while summing the angles in Q40. Only shifts and adds are needed.
+ */
+
+#include "local.h"
+
+/* atan(2^-i) / pi in Q40 */
+static const int64_t atan_tab[32] = {
+    274877906944LL, 162269903676LL, 85738960574LL, 43522435132LL,
+    21845673501LL, 10933486258LL, 5468077240LL, 2734205476LL,
+    1367123598LL, 683564406LL, 341782529LL, 170891305LL,
+    85445658LL, 42722830LL, 21361415LL, 10680707LL,
+    5340354LL, 2670177LL, 1335088LL, 667544LL,
+    333772LL, 166886LL, 83443LL, 41722LL,
+    20861LL, 10430LL, 5215LL, 2608LL,
+    1304LL, 652LL, 326LL, 163LL,
+};
+
+q31_t
+q31_atan2(q31_t y, q31_t x)
+{
+    int64_t  ax = x < 0 ? -(int64_t)x : x;
+    int64_t  ay = y < 0 ? -(int64_t)y : y;
+    int64_t  t, z = 0;
+    uint32_t a;
+    int      i, sh, swap = 0;
+
+    if (ax == 0 && ay == 0)
+        return 0;
+    if (ay > ax) {
+        t = ax;
+        ax = ay;
+        ay = t;
+        swap = 1;
+    }
+
+    /* ax into [2^60, 2^61) leaves room for the CORDIC gain of 1.65 */
+    sh = __builtin_clzll((uint64_t)ax) - 3;
+    ax <<= sh;
+    ay <<= sh;
+    for (i = 0; i < 32; i++) {
+        t = ax;
+        if (ay >= 0) {
+            ax += ay >> i;
+            ay -= t >> i;
+            z += atan_tab[i];
+        } else {
+            ax -= ay >> i;
+            ay += t >> i;
+            z -= atan_tab[i];
+        }
+    }
+
+    /* angle in the first quadrant, in [0, 2^30] */
+    a = (uint32_t)((z + (1 << 8)) >> 9);
+    if (swap)
+        a = 0x40000000 - a;
+    if (x < 0)
+        a = 0x80000000 - a;
+    if (y < 0)
+        return -(int32_t)(a - 1) - 1;
+    return a > Q31_MAX ? Q31_MAX : (q31_t)a;
+}
@@ -0,0 +1,15 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q31 cosine of pi x, as the sine of pi (x + 1/2)
+ */
+
+#include "local.h"
+
+q31_t
+q31_cos(q31_t x)
+{
+    return q31_sin((q31_t)((uint32_t)x + 0x40000000));
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q31 exp(32 x)
+ *
+ * exp(32 x) = 2^-k 2^r with r in [0, 1). 2^r is 2^(j/16) from a table
+ * times exp(r ln2 - j ln2 / 16), a degree 5 series in Q32.
+ */
+
+#include "local.h"
+
+/* 2^(j/16) in unsigned Q31 */
+static const uint32_t exp2_tab[16] = {
+    2147483648, 2242560872, 2341847524, 2445529972, 2553802834, 2666869345, 2784941738, 2908241642,
+    3037000500, 3171459999, 3311872529, 3458501653, 3611622603, 3771522796, 3938502376, 4112874773,
+};
+
+#define LOG2E_Q30 1549082005ULL /* log2(e) */
+#define LN2_Q32   2977044472U   /* ln(2) */
+
+q31_t
+q31_exp(q31_t x)
+{
+    uint64_t p, f, m;
+    uint32_t r, q, e;
+    int      k, j;
+
+    if (x >= 0)
+        return Q31_MAX;
+
+    /* -32 x log2(e) in Q56 = k + f */
+    p = (uint64_t)(-(int64_t)x) * LOG2E_Q30;
+    k = (int)(p >> 56);
+    f = p & ((1ULL << 56) - 1);
+    r = 0;
+    if (f) {
+        /* 2^-(k + f) = 2^-(k + 1) 2^(1 - f) */
+        k++;
+        f = ((1ULL << 56) - f + (1ULL << 23)) >> 24;
+        if (f >> 32)
+            k--;
+        else
+            r = (uint32_t)f;
+    }
+    if (k == 0)
+        return Q31_MAX;
+    if (k > 33)
+        return 0;
+
+    j = r >> 28;
+    q = __q_mul32(r & 0x0fffffff, LN2_Q32);
+    e = __q_mul32(q, 35791394);        /* q / 120 */
+    e = __q_mul32(q, 178956971 + e);   /* q (1/24 + ...) */
+    e = __q_mul32(q, 715827883 + e);   /* q (1/6 + ...) */
+    e = __q_mul32(q, 2147483648U + e); /* q (1/2 + ...) */
+    e = q + __q_mul32(q, e);           /* exp(q) - 1 */
+    m = exp2_tab[j] + (uint64_t)__q_mul32(exp2_tab[j], e);
+
+    m = (m + (1ULL << (k - 1))) >> k;
+    return m > Q31_MAX ? Q31_MAX : (q31_t)m;
+}
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q31 ln(x) / 32
+ *
+ * x = m 2^-(n+1) with m in [1, 2). A 16-entry table of c ~ 1/m gives
+ * w = m c - 1 with |w| < 1/32, and ln(m) = ln(1 + w) - ln(c) with
+ * ln(1 + w) a degree 5 series, all in Q32.
+ */
+
+#include "local.h"
+
+/* 1 / (1 + (j + 1/2) / 16) in Q31 */
+static const uint32_t log_inv[16] = {
+    2082408386, 1963413621, 1857283155, 1762037865, 1676084798, 1598127366, 1527099483, 1462116526,
+    1402438301, 1347440720, 1296593901, 1249445032, 1205604855, 1164736894, 1126548799, 1090785345,
+};
+
+/* -ln(log_inv[j] / 2^31) in Q32 */
+static const uint32_t log_tab[16] = {
+    132163267,  384881291,  623551984,  849655098,  1064448220, 1269009131, 1464268541, 1651035676,
+    1830018542, 2001840148, 2167051564, 2326142614, 2479550612, 2627667610, 2770846445, 2909405794,
+};
+
+#define LN2_Q32 2977044472LL /* ln(2) */
+
+#define MUL32(a, b) (((a) * (b)) >> 32)
+
+q31_t
+q31_log(q31_t x)
+{
+    uint32_t m;
+    int64_t  w, p;
+    int      n, j;
+
+    if (x <= 0)
+        return Q31_MIN;
+
+    n = __builtin_clz((uint32_t)x) - 1;
+    m = (uint32_t)x << n;
+    j = (m >> 26) & 15;
+    w = (int64_t)(((uint64_t)m * log_inv[j]) >> 29) - (1LL << 32);
+
+    /* ln(1 + w) = w (1 - w (1/2 - w (1/3 - w (1/4 - w / 5)))) */
+    p = 1073741824 - MUL32(w, 858993459);
+    p = 1431655765 - MUL32(w, p);
+    p = 2147483648LL - MUL32(w, p);
+    p = (1LL << 32) - MUL32(w, p);
+    p = MUL32(w, p);
+
+    p += log_tab[j] - (n + 1) * LN2_Q32;
+    return (q31_t)((p + 32) >> 6);
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q31 sine of pi x
+ *
+ * The top two bits of x pick the quadrant, leaving sin(pi/2 t) for t
+ * in [0, 1]. Below t = 1/2 that is a Taylor series in t, above it the
+ * cosine series in 1 - t; both are evaluated in Q32.
+ */
+
+#include "local.h"
+
+/* (-1)^k (pi/2)^(2k+1) / (2k+1)! in Q32 */
+static const int64_t sin_coef[6] = {
+    6746518852LL, -2774394673LL, 342277223LL, -20107981LL, 689090LL, -15457LL,
+};
+
+/* (-1)^k (pi/2)^(2k) / (2k)! in Q32 */
+static const int64_t cos_coef[7] = {
+    4294967296LL, -5298703516LL, 1089502240LL, -89607968LL, 3948193LL, -108242LL, 2023LL,
+};
+
+/* sin(pi/2 t) for t in Q31, 0 <= t <= 2^31, as an unsigned Q31 value */
+static uint32_t
+sin_quadrant(uint32_t t)
+{
+    const int64_t *c = sin_coef;
+    int64_t        t2, p;
+    int            k = 5;
+
+    /* t in Q32 below 1/2 */
+    if (t > 0x40000000) {
+        t = 0x80000000 - t;
+        c = cos_coef;
+        k = 6;
+    }
+    t <<= 1;
+    t2 = (int64_t)(((uint64_t)t * t + (1U << 31)) >> 32);
+    p = c[k];
+    while (--k >= 0)
+        p = c[k] + ((p * t2 + (1U << 31)) >> 32);
+    if (c == cos_coef)
+        return (uint32_t)((p + 1) >> 1);
+    /* p is in [2^32, 1.58 * 2^32], so the product fits */
+    return (uint32_t)(((uint64_t)p * t + (1ULL << 32)) >> 33);
+}
+
+q31_t
+q31_sin(q31_t x)
+{
+    uint32_t u = (uint32_t)x;
+    uint32_t t = (u & 0x3fffffff) << 1;
+    uint32_t r;
+
+    if (u & 0x40000000)
+        t = 0x80000000 - t;
+    r = sin_quadrant(t);
+    if (u & 0x80000000)
+        return -(int32_t)(r - 1) - 1;
+    return r > Q31_MAX ? Q31_MAX : (q31_t)r;
+}
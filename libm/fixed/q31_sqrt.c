@@ -0,0 +1,36 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Q31 square root, rounded to nearest
+ *
+ * The root of x 2^31 is found a bit at a time.
+ */
+
+#include "local.h"
+
+q31_t
+q31_sqrt(q31_t x)
+{
+    uint64_t v, r = 0, one = 1ULL << 62;
+
+    if (x <= 0)
+        return 0;
+    v = (uint64_t)x << 31;
+    while (one > v)
+        one >>= 2;
+    while (one) {
+        if (v >= r + one) {
+            v -= r + one;
+            r = (r >> 1) + one;
+        } else {
+            r >>= 1;
+        }
+        one >>= 2;
+    }
+    /* v = x 2^31 - r^2 exceeds r when the root is above r + 1/2 */
+    if (v > r)
+        r++;
+    return (q31_t)r;
+}
@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Out-of-line copies of the <machine/fenv.h> functions, the shared
+ * environment word and the compiler-rt soft-float hooks that use it.
+ * compiler-rt provides weak versions of the hooks that always round to
+ * nearest and drop FE_INEXACT; these replace them whenever a program
+ * touches the floating point environment. The hooks are __used so that
+ * an LTO build keeps them although only compiler-rt calls them.
+ */
+
+#include <sys/cdefs.h>
+
+#define _GNU_SOURCE
+#define __declare_fenv_inline(type) type
+#ifdef __GNUCLIKE_PRAGMA_DIAGNOSTIC
+#pragma GCC diagnostic ignored "-Wpragmas"
+#pragma GCC diagnostic ignored "-Wunknown-warning-option"
+/* We're not declaring the functions before defining them */
+#pragma GCC diagnostic ignored "-Wmissing-declarations"
+#pragma GCC diagnostic ignored "-Wmissing-prototypes"
+#endif
+#include <fenv.h>
+
+fenv_t __m65832_fenv;
+
+/* Returns a CRT_FE_ROUND_MODE, which numbers the modes as fenv.h does */
+int __used
+__fe_getround(void)
+{
+    return fegetround();
+}
+
+int __used
+__fe_raise_inexact(void)
+{
+    return feraiseexcept(FE_INEXACT);
+}
@@ -0,0 +1,311 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point helpers for the m65832 math functions
+ *
+ * m65832 has no FPU, so every float add or multiply in the generic
+ * code is a compiler-rt call. The functions here unpack their argument
+ * once, do all of their work in 32 and 64-bit integers and pack the
+ * result once. sqrtf and sqrt are always built this way; the other
+ * fast variants are selected with -Dm65832-fast-math-float=true.
+ */
+
+#ifndef _M65832_FIXF_H_
+#define _M65832_FIXF_H_
+
+#include "fdlibm.h"
+#include "math_config.h"
+#include <stdint.h>
+
+/* 1/sqrt(a) in Q15 for a in [1, 4), indexed by floor(32 a) - 32 */
+extern const uint16_t __m65832_rsqrt_tab[96] HIDDEN;
+
+/* 2^(j/64) in Q31 */
+extern const uint32_t __m65832_exp2_tab[64] HIDDEN;
+
+/* 1/c in Q31 and log(c) in Q55 for the 32 subintervals of __fixf_log */
+extern const uint32_t __m65832_log_invc[32] HIDDEN;
+extern const int64_t  __m65832_log_logc[32] HIDDEN;
+
+/* High halves of 32 x 32 and 64 x 64-bit products; the second drops
+   the low x low partial product, so it may be up to 2 below the exact
+   value */
+static inline uint32_t
+__fixf_mul32(uint32_t a, uint32_t b)
+{
+    return (uint32_t)(((uint64_t)a * b) >> 32);
+}
+
+static inline uint64_t
+__fixf_mul64(uint64_t a, uint64_t b)
+{
+    uint64_t ah = a >> 32, al = (uint32_t)a, bh = b >> 32, bl = (uint32_t)b;
+
+    return ah * bh + ((ah * bl) >> 32) + ((al * bh) >> 32);
+}
+
+/* Q30 and Q31 products of two fixed-point values */
+#define FIXF_MUL30(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 30))
+#define FIXF_MUL31(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 31))
+
+/*
+ * Round sign * v * 2^e2 to the nearest float, ties to even. v must be
+ * non-zero. Results too small for a subnormal become zero and results
+ * too large become infinity.
+ */
+static inline float
+__fixf_pack(uint32_t sign, uint64_t v, int e2)
+{
+    int      top = 63 - __builtin_clzll(v);
+    int      biased = top + e2 + 127;
+    int      shift = top - 23;
+    uint32_t m, bits;
+    float    r;
+
+    /* Subnormal results keep fewer mantissa bits */
+    if (biased < 1) {
+        shift += 1 - biased;
+        biased = 1;
+    }
+    if (shift > 0) {
+        uint64_t rest, half;
+
+        if (shift > 63) {
+            m = 0;
+        } else {
+            rest = v & (((uint64_t)1 << shift) - 1);
+            half = (uint64_t)1 << (shift - 1);
+            m = (uint32_t)(v >> shift);
+            if (rest > half || (rest == half && (m & 1)))
+                m++;
+        }
+    } else {
+        m = (uint32_t)(v << -shift);
+    }
+
+    /* A carry out of the mantissa moves into the exponent on its own */
+    if (biased >= 0xff || (bits = ((uint32_t)(biased - 1) << 23) + m) >= 0x7f800000)
+        bits = 0x7f800000;
+    SET_FLOAT_WORD(r, bits | sign);
+    return r;
+}
+
+/*
+ * 2^(n/64) * exp(r) for r = r31 * 2^-31 with |r| <= ln2/128, rounded
+ * to a float with the given sign. exp(r) - 1 comes from its degree 4
+ * series in Q31. Results that underflow are 0 and results that
+ * overflow are infinity.
+ */
+static inline float
+__fixf_exp(uint32_t sign, int32_t n, int32_t r31)
+{
+    int32_t  p = 89478485;
+    uint32_t t = __m65832_exp2_tab[n & 63];
+
+    /* exp(r) - 1 = r + r^2/2 + r^3/6 + r^4/24 */
+    p = 357913941 + FIXF_MUL31(r31, p);
+    p = 0x40000000 + FIXF_MUL31(r31, p);
+    p = r31 + FIXF_MUL31(r31, FIXF_MUL31(r31, p));
+    return __fixf_pack(sign, ((uint64_t)t << 31) + (int64_t)t * p, (n >> 6) - 62);
+}
+
+#define FIXF_LOG_OFF 0x3f330000
+
+/* ln2 in Q55 */
+#define FIXF_LN2_Q55 0x58b90bfbe8e7bdLL
+
+/*
+ * Split the bits ix of a positive finite x into 2^k * c * (1 + w):
+ * z = x / 2^k lies in [OFF, 2 OFF) and c is the center of one of 32
+ * subintervals. 1/c is rounded to Q31 so that w = z/c - 1 is exact in
+ * Q55 and log(c) is tabulated for that rounded value. The subinterval
+ * around 1 uses c = 1 and log(c) = 0. Returns the subinterval and
+ * sets k and w.
+ */
+static inline int
+__fixf_log_reduce(int32_t ix, int32_t *k, int64_t *w)
+{
+    int32_t  tmp, i;
+    uint32_t iz;
+    int      lz;
+
+    if (FLT_UWORD_IS_SUBNORMAL(ix)) {
+        lz = __builtin_clz(ix) - 8;
+        ix = ((1 - lz) * (1 << 23)) + ((ix << lz) & 0x7fffff);
+    }
+
+    tmp = ix - FIXF_LOG_OFF;
+    i = (tmp >> 18) & 31;
+    *k = tmp >> 23;
+    iz = ix - (tmp & 0xff800000);
+
+    /* z in Q24 times 1/c in Q31 */
+    *w = (int64_t)((uint64_t)(((iz & 0x7fffff) | 0x800000) << (iz >> 23 == 0x7f))
+                   * __m65832_log_invc[i])
+         - ((int64_t)1 << 55);
+    return i;
+}
+
+/*
+ * log(x) for the bits ix of a positive finite x, as sign * v * 2^e2
+ * with v = 0 when x is 1. Returns the sign. log1p(w) is w times a
+ * series in Q30, so results near 1 keep their relative precision.
+ */
+static inline uint32_t
+__fixf_log(int32_t ix, uint64_t *v, int *e2)
+{
+    int32_t  k, i, w30, q;
+    uint32_t wm;
+    int64_t  w, s;
+    uint64_t aw, b;
+    int      lz;
+
+    i = __fixf_log_reduce(ix, &k, &w);
+
+    /* log1p(w) = w (1 - w/2 + w^2/3 - w^3/4 + w^4/5 - w^5/6) */
+    w30 = (int32_t)(w >> 25);
+    q = -178956971;
+    q = 214748365 + FIXF_MUL30(w30, q);
+    q = -0x10000000 + FIXF_MUL30(w30, q);
+    q = 357913941 + FIXF_MUL30(w30, q);
+    q = -0x20000000 + FIXF_MUL30(w30, q);
+    q = 0x40000000 + FIXF_MUL30(w30, q);
+
+    s = k * FIXF_LN2_Q55 + __m65832_log_logc[i];
+    aw = w < 0 ? -w : w;
+    if (aw) {
+        lz = __builtin_clzll(aw);
+        wm = (uint32_t)((aw << lz) >> 32);
+        b = (uint64_t)wm * (uint32_t)q;
+
+        /* b is |log1p(w)| scaled by 2^(53+lz) */
+        if (s == 0) {
+            *v = b;
+            *e2 = -53 - lz;
+            return w < 0 ? 0x80000000 : 0;
+        }
+        s += w < 0 ? -(int64_t)(b >> (lz - 2)) : (int64_t)(b >> (lz - 2));
+    }
+    *e2 = -55;
+    if (s < 0) {
+        *v = -s;
+        return 0x80000000;
+    }
+    *v = s;
+    return 0;
+}
+
+/* 2/pi, most significant bit first, after a word of zeros */
+static const uint32_t __fixf_two_over_pi[] = {
+    0x00000000, 0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0,
+    0xdb629599, 0x3c439041, 0xfe5163ab, 0xdebbc561,
+};
+
+/* pi/4 in Q32 */
+#define FIXF_PIO4_Q32 0xc90fdaa2u
+
+/*
+ * Reduce |x| (bits ix, finite, at least 2^-12) to k * pi/2 + r with
+ * |r| <= pi/4. Returns k mod 4 and r as (-1)^*neg * rm * 2^(re-32)
+ * with the top bit of rm set.
+ *
+ * Larger arguments are multiplied by a 96-bit window of 2/pi chosen
+ * from the exponent (Payne-Hanek), leaving x * 2/pi mod 4 in Q62 with
+ * an error below 2^-69, which keeps about 30 significant bits in r
+ * even for the floats closest to a multiple of pi/2.
+ */
+static inline int
+__fixf_rem_pio2(uint32_t ix, uint32_t *rm, int *re, int *neg)
+{
+    uint32_t m = (ix & 0x7fffff) | 0x800000;
+    int      e = (int)(ix >> 23) - 150;
+    uint32_t w0, w1, w2, ah;
+    uint64_t y, a, prod;
+    int      k, q, sh, lz;
+
+    if (ix <= 0x3f490fdb) {
+        *rm = m << 8;
+        *re = e + 24;
+        *neg = 0;
+        return 0;
+    }
+
+    q = e + 30;
+    sh = q & 31;
+    q >>= 5;
+    w0 = __fixf_two_over_pi[q];
+    w1 = __fixf_two_over_pi[q + 1];
+    w2 = __fixf_two_over_pi[q + 2];
+    if (sh) {
+        w0 = (w0 << sh) | (w1 >> (32 - sh));
+        w1 = (w1 << sh) | (w2 >> (32 - sh));
+        w2 = (w2 << sh) | (__fixf_two_over_pi[q + 3] >> (32 - sh));
+    }
+    y = ((uint64_t)m * w0 << 32) + (uint64_t)m * w1 + ((uint64_t)m * w2 >> 32);
+
+    /* Nearest quadrant; the remainder is in [-1/2, 1/2] */
+    k = (int)((y + ((uint64_t)1 << 61)) >> 62);
+    a = y - ((uint64_t)k << 62);
+    *neg = (int64_t)a < 0;
+    if (*neg)
+        a = -a;
+    a |= 1;
+
+    /* r = a * 2^-62 * pi/2, renormalized */
+    lz = __builtin_clzll(a);
+    ah = (uint32_t)((a << lz) >> 32);
+    prod = (uint64_t)ah * FIXF_PIO4_Q32;
+    *re = 3 - lz;
+    if (!(prod >> 63)) {
+        prod <<= 1;
+        (*re)--;
+    }
+    *rm = (uint32_t)(prod >> 32);
+    return k & 3;
+}
+
+/* r^2 in Q30 for r = rm * 2^(re-32), re <= 0 */
+static inline int32_t
+__fixf_square(uint32_t rm, int re)
+{
+    int shift = 34 - 2 * re;
+
+    if (shift >= 64)
+        return 0;
+    return (int32_t)(((uint64_t)rm * rm) >> shift);
+}
+
+/*
+ * sin(r) for r = (-1)^neg * rm * 2^(re-32) and z = r^2 in Q30:
+ * r * (1 - z/3! + z^2/5! - z^3/7! + z^4/9!). The series is truncated
+ * below 2^-28 of the result.
+ */
+static inline float
+__fixf_sin(uint32_t neg, uint32_t rm, int re, int32_t z)
+{
+    int32_t p = 2959;
+
+    p = -213040 + FIXF_MUL30(z, p);
+    p = 8947849 + FIXF_MUL30(z, p);
+    p = -178956971 + FIXF_MUL30(z, p);
+    p = 0x40000000 + FIXF_MUL30(z, p);
+    return __fixf_pack(neg << 31, (uint64_t)rm * (uint32_t)p, re - 62);
+}
+
+/* cos(r) for z = r^2 in Q30: 1 - z/2! + z^2/4! - ... - z^5/10! */
+static inline float
+__fixf_cos(uint32_t neg, int32_t z)
+{
+    int32_t p = -296;
+
+    p = 26631 + FIXF_MUL30(z, p);
+    p = -1491308 + FIXF_MUL30(z, p);
+    p = 44739243 + FIXF_MUL30(z, p);
+    p = -0x20000000 + FIXF_MUL30(z, p);
+    p = 0x40000000 + FIXF_MUL30(z, p);
+    return __fixf_pack(neg << 31, (uint32_t)p, -30);
+}
+
+#endif /* _M65832_FIXF_H_ */
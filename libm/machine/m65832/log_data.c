@@ -0,0 +1,33 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Tables shared by the fixed-point logf, log2f and powf
+ */
+
+#include "fixf.h"
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* 1/c in Q31 */
+const uint32_t __m65832_log_invc[32] = {
+    0xb509e68b, 0xb11fd3b8, 0xad602b58, 0xa9c84a48, 0xa655c439, 0xa3065e40, 0x9fd809fe, 0x9cc8e161,
+    0x99d722db, 0x97012e02, 0x94458094, 0x91a2b3c5, 0x8f1779da, 0x8ca29c04, 0x8a42f870, 0x87f78088,
+    0x85bf3761, 0x83993052, 0x81848da9, 0x80000000, 0x7b301ecc, 0x77975b90, 0x7432d63e, 0x70fe3c07,
+    0x6df5b0f7, 0x6b15c06b, 0x685b4fe6, 0x65c393e0, 0x634c0635, 0x60f25deb, 0x5eb48824, 0x5c90a1fd,
+};
+
+/* log(c) in Q55 */
+const int64_t __m65832_log_logc[32] = {
+    -12490478242781330LL, -11702932192254072LL, -10932233350423086LL, -10177675996262824LL,
+    -9438597826463174LL,  -8714376523349990LL,  -8004426519678833LL,  -7308196213003876LL,
+    -6625165387189363LL,  -5954842842609037LL,  -5296764329034042LL,  -4650490558364167LL,
+    -4015605457888658LL,  -3391714589176312LL,  -2778443663603506LL,  -2175437174844959LL,
+    -1582357161848534LL,  -998882108806494LL,   -424705865386539LL,   0LL,
+    1380582584463192LL,   2448180603108720LL,   3485052072414608LL,   4492916315649373LL,
+    5473352250068852LL,   6427813279420957LL,   7357640288417123LL,   8264072932866961LL,
+    9148259555057794LL,   10011266014589942LL,  10854083318053546LL,  11677634548527426LL,
+};
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Bit-level helpers for the m65832 classification, min/max and
+ * rounding functions
+ *
+ * m65832 has no FPU, so a float compare or a NaN-quieting x + x in the
+ * generic code becomes a compiler-rt call. These work on the IEEE bit
+ * patterns instead and never leave integer code.
+ */
+
+#ifndef _M65832_BITS_H_
+#define _M65832_BITS_H_
+
+#include "fdlibm.h"
+#include "math_config.h"
+#include <stdint.h>
+
+/*
+ * Unsigned keys which order like the values they come from, with -0
+ * just below +0. Negative values have their bits inverted, positive
+ * ones get the sign bit set. Only meaningful for non-NaN values.
+ */
+static inline uint32_t
+__m65832_orderf(uint32_t ix)
+{
+    return (ix & 0x80000000) ? ~ix : ix | 0x80000000;
+}
+
+static inline uint64_t
+__m65832_order(uint64_t ix)
+{
+    return (ix & 0x8000000000000000ULL) ? ~ix : ix | 0x8000000000000000ULL;
+}
+
+/* The result of x + x for an infinite or NaN x: NaNs come back quiet */
+static inline float
+__m65832_quietf(uint32_t ix)
+{
+    if ((ix & 0x7fffffff) > 0x7f800000)
+        ix |= 0x00400000;
+    return asfloat(ix);
+}
+
+#ifdef _NEED_FLOAT64
+static inline __float64
+__m65832_quiet(uint64_t ix)
+{
+    if ((ix & 0x7fffffffffffffffULL) > 0x7ff0000000000000ULL)
+        ix |= 0x0008000000000000ULL;
+    return asfloat64(ix);
+}
+#endif
+
+#endif /* _M65832_BITS_H_ */
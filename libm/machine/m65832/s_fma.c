@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer fma, correctly rounded (m65832 only rounds to nearest)
+ *
+ * The generic code splits both factors in half and sums the pieces
+ * with error-free transforms, a few dozen compiler-rt calls. Here the
+ * 53 x 53-bit product is formed exactly in a pair of 64-bit words from
+ * four 32 x 32-bit multiplies, z is aligned to it with a sticky bit,
+ * and the sum is rounded once.
+ */
+
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+#include "m65832_bits.h"
+
+/* The mantissa of a finite, nonzero |x| with its exponent in *e */
+static inline uint64_t
+__fma_unpack(uint64_t ax, int *e)
+{
+    int lz;
+
+    if (ax < 0x0010000000000000ULL) {
+        lz = __builtin_clzll(ax) - 11;
+        *e = 1 - lz;
+        return ax << lz;
+    }
+    *e = (int)(ax >> 52);
+    return (ax & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+}
+
+/* *h:*l = a * b */
+static inline void
+__fma_mul(uint64_t a, uint64_t b, uint64_t *h, uint64_t *l)
+{
+    uint64_t a1 = a >> 32, a0 = (uint32_t)a, b1 = b >> 32, b0 = (uint32_t)b;
+    uint64_t t = a0 * b0, m1 = a1 * b0, m2 = a0 * b1;
+    uint64_t mid = (t >> 32) + (uint32_t)m1 + (uint32_t)m2;
+
+    *l = (mid << 32) | (uint32_t)t;
+    *h = a1 * b1 + (m1 >> 32) + (m2 >> 32) + (mid >> 32);
+}
+
+/* *h:*l >>= n, with any bits shifted out ORed into bit 0 */
+static inline void
+__fma_shr(uint64_t *h, uint64_t *l, int n)
+{
+    uint64_t s;
+
+    if (n == 0)
+        return;
+    if (n < 64) {
+        s = (*l << (64 - n)) != 0;
+        *l = (*h << (64 - n)) | (*l >> n) | s;
+        *h >>= n;
+    } else if (n < 128) {
+        s = *l != 0 || (n > 64 && (*h << (128 - n)) != 0);
+        *l = (*h >> (n - 64)) | s;
+        *h = 0;
+    } else {
+        *l = (*h | *l) != 0;
+        *h = 0;
+    }
+}
+
+/* Round (-1)^sign * h:l * 2^e to the nearest double, ties to even */
+static inline __float64
+__fma_pack(uint32_t sign, uint64_t h, uint64_t l, int e)
+{
+    int      top = h ? 127 - __builtin_clzll(h) : 63 - __builtin_clzll(l);
+    int      biased = top + e + 1023;
+    int      shift = top - 52;
+    uint64_t g, m, bits;
+
+    /* Subnormal results keep fewer mantissa bits */
+    if (biased < 1) {
+        shift += 1 - biased;
+        biased = 1;
+    }
+
+    /* g is the result with a round bit and a sticky bit below it */
+    if (shift < 2) {
+        g = l << (2 - shift);
+    } else {
+        __fma_shr(&h, &l, shift - 2);
+        g = l;
+    }
+    m = g >> 2;
+    if ((g & 3) > 2 || ((g & 3) == 2 && (m & 1)))
+        m++;
+
+    if (m == 0)
+        return __math_uflow(sign);
+    /* A carry out of the mantissa moves into the exponent on its own */
+    if (biased >= 0x7ff || (bits = ((uint64_t)(biased - 1) << 52) + m) >= 0x7ff0000000000000ULL)
+        return __math_oflow(sign);
+    return asfloat64(bits | (uint64_t)sign << 63);
+}
+
+__float64
+fma64(__float64 x, __float64 y, __float64 z)
+{
+    uint64_t ix = asuint64(x), iy = asuint64(y), iz = asuint64(z);
+    uint64_t ax = ix & 0x7fffffffffffffffULL, ay = iy & 0x7fffffffffffffffULL;
+    uint64_t az = iz & 0x7fffffffffffffffULL;
+    uint32_t sp = (uint32_t)((ix ^ iy) >> 63), sz = (uint32_t)(iz >> 63), sign;
+    uint64_t ph, pl, qh, ql, h, l;
+    int      ex, ey, ez, ep, eq, d;
+
+    /* An infinite or NaN factor makes x * y exact, inf * 0 invalid */
+    if (ax >= 0x7ff0000000000000ULL || ay >= 0x7ff0000000000000ULL)
+        return x * y + z;
+    if (az >= 0x7ff0000000000000ULL)
+        return __m65832_quiet(iz);
+    if (ax == 0 || ay == 0) {
+        /* 0 + z is z, and +0 unless both zeros are -0 */
+        if (az == 0)
+            return asfloat64((uint64_t)(sp & sz) << 63);
+        return z;
+    }
+
+    /* x * y = ph:pl * 2^ep exactly, with the top bit at 124 or 125 */
+    __fma_mul(__fma_unpack(ax, &ex) << 10, __fma_unpack(ay, &ey) << 10, &ph, &pl);
+    ep = ex + ey - 2150 - 20;
+    if (az == 0)
+        return __fma_pack(sp, ph, pl, ep);
+
+    /* z = qh:ql * 2^eq with the top bit at 124 */
+    qh = __fma_unpack(az, &ez) << 8;
+    ql = 0;
+    eq = ez - 1075 - 72;
+
+    /*
+     * Shift the smaller one down. Bits can only drop out when it is at
+     * least 20 places below the other, so the sum keeps its top bit
+     * within two of bit 124 and the sticky bit stays far below the
+     * rounding point.
+     */
+    d = ep - eq;
+    if (d >= 0) {
+        __fma_shr(&qh, &ql, d);
+    } else {
+        __fma_shr(&ph, &pl, -d);
+        ep = eq;
+    }
+
+    sign = sp;
+    if (sp == sz) {
+        l = pl + ql;
+        h = ph + qh + (l < pl);
+    } else if (ph > qh || (ph == qh && pl >= ql)) {
+        l = pl - ql;
+        h = ph - qh - (pl < ql);
+    } else {
+        l = ql - pl;
+        h = qh - ph - (ql < pl);
+        sign = sz;
+    }
+    /* Exact cancellation gives +0 */
+    if ((h | l) == 0)
+        return _F_64(0.0);
+
+    return __fma_pack(sign, h, l, ep);
+}
+
+_MATH_ALIAS_d_ddd(fma)
+
+#endif /* _NEED_FLOAT64 */
@@ -0,0 +1,31 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer fmin: compares ordering keys instead of calling compiler-rt
+ */
+
+#include "m65832_bits.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+fmin64(__float64 x, __float64 y)
+{
+    uint64_t ix = asuint64(x), iy = asuint64(y);
+    int      nx = (ix & 0x7fffffffffffffffULL) > 0x7ff0000000000000ULL;
+    int      ny = (iy & 0x7fffffffffffffffULL) > 0x7ff0000000000000ULL;
+
+    if (nx | ny) {
+        /* A signaling NaN gives a quiet NaN, as x + y would */
+        if (issignaling64_inline(x) || issignaling64_inline(y))
+            return __m65832_quiet(nx ? ix : iy);
+        return nx ? y : x;
+    }
+    return __m65832_order(ix) < __m65832_order(iy) ? x : y;
+}
+
+_MATH_ALIAS_d_dd(fmin)
+
+#endif /* _NEED_FLOAT64 */
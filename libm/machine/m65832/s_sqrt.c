@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer sqrt, correctly rounded (m65832 only rounds to nearest)
+ *
+ * The generic code produces one bit per pass over a pair of 32-bit
+ * words, 54 passes in all. Here x = m * 2^2e with m in [1, 4):
+ *
+ *  - r ~ 1/sqrt(m) comes from a 7-bit table and two Newton steps in
+ *    32-bit Q30/Q32 arithmetic, good to about 2^-28;
+ *  - one coupled step s = m r (3 - m r^2) / 2 in 64-bit arithmetic
+ *    gives sqrt(m) in Q62 to within 2^-57;
+ *  - with S the truncation of s to 52 fraction bits, the nearest
+ *    result is S, S + 1 or S + 2. Each step up is decided exactly by
+ *    the sign of m 2^104 - S^2 - S, which is small enough to compute
+ *    modulo 2^64.
+ */
+
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+#include "fixf.h"
+
+__float64
+sqrt64(__float64 x)
+{
+    uint64_t ix, mant, m62, n, rr, s, u;
+    uint32_t m32, r, s32, u32;
+    int64_t  d;
+    int      e, odd, i;
+
+    ix = asuint64(x);
+    e = (int)(ix >> 52);
+
+    /* take care of Inf and NaN */
+    if ((e & 0x7ff) == 0x7ff) {
+        if ((ix >> 63) && !isnan(x))
+            return __math_invalid(x); /* sqrt(-inf)=sNaN */
+        return x + x;                 /* sqrt(NaN)=NaN, sqrt(+inf)=+inf */
+    }
+    /* take care of zero and -ves */
+    if ((ix << 1) == 0)
+        return x; /* sqrt(+-0) = +-0 */
+    if (ix >> 63)
+        return __math_invalid(x); /* sqrt(-ve) = sNaN */
+
+    /* normalize x to m * 2^(2e), m = mant * 2^(odd - 52) */
+    mant = ix & 0xfffffffffffffULL;
+    if (e == 0) { /* subnormal x */
+        i = __builtin_clzll(mant) - 11;
+        mant <<= i;
+        e = 1 - i;
+    } else {
+        mant |= 1ULL << 52;
+    }
+    e -= 1023; /* unbias exponent */
+    odd = e & 1;
+    e >>= 1;
+    m62 = mant << (10 + odd);
+
+    /* r = 1/sqrt(m) in Q32, s = sqrt(m) in Q30 */
+    m32 = (uint32_t)(m62 >> 32);
+    r = (uint32_t)__m65832_rsqrt_tab[(m32 >> 25) - 32] << 17;
+    s32 = __fixf_mul32(m32, r);
+    for (i = 0; i < 2; i++) {
+        u32 = 0xc0000000 - __fixf_mul32(s32, r);
+        r = __fixf_mul32(r, u32) << 1;
+        s32 = __fixf_mul32(s32, u32) << 1;
+    }
+
+    /* s = sqrt(m) in Q62 */
+    rr = (uint64_t)r << 32;
+    s = __fixf_mul64(m62, rr);
+    u = 0xc000000000000000ULL - __fixf_mul64(s, rr);
+    s = __fixf_mul64(s, u) << 1;
+
+    /* Round to nearest: step up while (S + 1/2)^2 < m 2^104 */
+    s >>= 10;
+    n = mant << (52 + odd);
+    d = (int64_t)(n - s * s - s);
+    if (d > 0) {
+        s++;
+        d -= 2 * s;
+        if (d > 0)
+            s++;
+    }
+
+    return asfloat64(((uint64_t)(e + 1022) << 52) + s);
+}
+
+_MATH_ALIAS_d_d(sqrt)
+
+#endif /* _NEED_FLOAT64 */
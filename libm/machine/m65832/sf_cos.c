@@ -0,0 +1,14 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * cosf is the generic code unless m65832-fast-math-float makes it an
+ * alias of the fixed-point __fast_cosf in sf_cos_fast.c
+ */
+
+#include "fdlibm.h"
+
+#if !__M65832_FAST_MATH_FLOAT
+#include "../../math/sf_cos.c"
+#endif
@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point cosf for the fast tier (__fast_cosf), within 0.54 ULP
+ * of the exact result
+ */
+
+#include "fdlibm.h"
+#include "fixf.h"
+
+float
+__fast_cosf(float x)
+{
+    uint32_t ix, rm;
+    int      re, neg, k;
+    int32_t  z;
+
+    GET_FLOAT_WORD(ix, x);
+    ix &= 0x7fffffff;
+
+    /* cos(Inf or NaN) is NaN */
+    if (!FLT_UWORD_IS_FINITE(ix))
+        return __math_invalidf(x);
+
+    /* |x| < 2^-12: 1 - x^2/2 rounds to 1 */
+    if (ix < 0x39800000)
+        return 1.0f;
+
+    k = __fixf_rem_pio2(ix, &rm, &re, &neg);
+    z = __fixf_square(rm, re);
+    switch (k) {
+    case 0:
+        return __fixf_cos(0, z);
+    case 1:
+        return __fixf_sin(neg ^ 1, rm, re, z);
+    case 2:
+        return __fixf_cos(1, z);
+    default:
+        return __fixf_sin(neg, rm, re, z);
+    }
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default cosf too */
+#if defined(__GNUCLIKE_PRAGMA_DIAGNOSTIC) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmissing-attributes"
+#endif
+__strong_reference(__fast_cosf, cosf);
+__strong_reference(__fast_cosf, _cosf);
+
+_MATH_ALIAS_f_f(cos)
+
+#endif
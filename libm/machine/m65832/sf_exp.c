@@ -0,0 +1,14 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * expf is the generic code unless m65832-fast-math-float makes it an
+ * alias of the fixed-point __fast_expf in sf_exp_fast.c
+ */
+
+#include "fdlibm.h"
+
+#if !__M65832_FAST_MATH_FLOAT
+#include "../../math/sf_exp.c"
+#endif
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point exp2f for the fast tier (__fast_exp2f)
+ *
+ * x = n/64 + r with |r| <= 1/128 is exact in Q48 for every
+ * |x| >= 2^-25, so only r * ln2 is rounded before __fixf_exp
+ * evaluates 2^(n/64) * exp(r * ln2).
+ */
+
+#include "fdlibm.h"
+#include "math_config.h"
+#include "fixf.h"
+
+/* ln2 in Q32 */
+#define LN2_Q32 0xb17217f8LL
+
+float
+__fast_exp2f(float x)
+{
+    int32_t  sx, n, r31;
+    uint32_t hx, ix;
+    int64_t  xq, r;
+    float    y;
+
+    GET_FLOAT_WORD(sx, x);
+    hx = sx & 0x7fffffff;
+
+    /* filter out non-finite argument */
+    if (FLT_UWORD_IS_NAN(hx))
+        return x + x; /* NaN */
+    if (FLT_UWORD_IS_INFINITE(hx))
+        return (sx >= 0) ? x : 0.0f; /* exp2(+-inf)={inf,0} */
+    if (sx >= 0x43000000)
+        return __math_oflowf(0); /* x >= 128 */
+    if (sx < 0 && hx > 0x43160000)
+        return __math_uflowf(0); /* x < -150 */
+
+    /* |x| < 2^-25: 1 + x ln2 rounds to 1 */
+    if (hx < 0x33000000)
+        return 1.0f;
+
+    xq = (int64_t)((hx & 0x7fffff) | 0x800000) << ((hx >> 23) - 102);
+    if (sx < 0)
+        xq = -xq;
+
+    n = (int32_t)((xq + ((int64_t)1 << 41)) >> 42);
+    r = xq - ((int64_t)n << 42);
+    /* r in Q37 times ln2 in Q32, rounded to Q31 */
+    r31 = (int32_t)(((r >> 11) * LN2_Q32 + ((int64_t)1 << 37)) >> 38);
+
+    y = __fixf_exp(0, n, r31);
+
+    GET_FLOAT_WORD(ix, y);
+    if (ix == 0)
+        return __math_uflowf(0);
+    if (ix == 0x7f800000)
+        return __math_oflowf(0);
+    return y;
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default exp2f too */
+__strong_reference(__fast_exp2f, exp2f);
+
+_MATH_ALIAS_f_f(exp2)
+
+#endif
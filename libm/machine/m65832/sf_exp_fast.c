@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point expf for the fast tier (__fast_expf), within 0.52 ULP
+ * of the exact result
+ *
+ * x = n * ln2/64 + r with |r| <= ln2/128 in Q48, which holds every
+ * |x| >= 2^-25 exactly. exp(x) = 2^(n/64) * exp(r), which __fixf_exp
+ * evaluates with a table of 2^(j/64) and a degree 4 series.
+ */
+
+#include "fdlibm.h"
+#include "math_config.h"
+#include "fixf.h"
+
+/* 64/ln2 in Q16 and ln2/64 in Q54 */
+#define INVLN2_64_Q16 6051102
+#define LN2_64_Q54    0xb17217f7d1cfLL
+
+float
+__fast_expf(float x)
+{
+    int32_t  sx, n, r31;
+    uint32_t hx, ix;
+    int64_t  xq, r;
+    float    y;
+
+    GET_FLOAT_WORD(sx, x);
+    hx = sx & 0x7fffffff;
+
+    /* filter out non-finite argument */
+    if (FLT_UWORD_IS_NAN(hx))
+        return x + x; /* NaN */
+    if (FLT_UWORD_IS_INFINITE(hx))
+        return (sx >= 0) ? x : 0.0f; /* exp(+-inf)={inf,0} */
+    if (sx > FLT_UWORD_LOG_MAX)
+        return __math_oflowf(0); /* overflow */
+    if (sx < 0 && hx > FLT_UWORD_LOG_MIN)
+        return __math_uflowf(0); /* underflow */
+
+    /* |x| < 2^-25: 1 + x rounds to 1 */
+    if (hx < 0x33000000)
+        return 1.0f;
+
+    xq = (int64_t)((hx & 0x7fffff) | 0x800000) << ((hx >> 23) - 102);
+    if (sx < 0)
+        xq = -xq;
+
+    n = (int32_t)(((xq >> 16) * INVLN2_64_Q16 + ((int64_t)1 << 47)) >> 48);
+    r = xq - ((n * LN2_64_Q54 + 32) >> 6);
+    r31 = (int32_t)(r >> 17);
+
+    y = __fixf_exp(0, n, r31);
+
+    GET_FLOAT_WORD(ix, y);
+    if (ix == 0)
+        return __math_uflowf(0);
+    if (ix == 0x7f800000)
+        return __math_oflowf(0);
+    return y;
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default expf too */
+__strong_reference(__fast_expf, expf);
+
+_MATH_ALIAS_f_f(exp)
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer floorf: clears the fraction bits, stepping negative values
+ * down first; NaNs are quieted without a soft-float add
+ */
+
+#include "m65832_bits.h"
+
+float
+floorf(float x)
+{
+    uint32_t ix = asuint(x), m;
+    int      e = (int)((ix >> 23) & 0xff) - 127;
+
+    if (e >= 23)
+        return e == 128 ? __m65832_quietf(ix) : x;
+    if (e < 0) {
+        /* |x| < 1: -1 for negative non-zero x, otherwise +-0 */
+        if ((ix & 0x80000000) && (ix & 0x7fffffff))
+            ix = 0xbf800000;
+        else
+            ix &= 0x80000000;
+    } else {
+        m = 0x007fffff >> e;
+        if ((ix & m) == 0)
+            return x;
+        if (ix & 0x80000000)
+            ix += 0x00800000 >> e;
+        ix &= ~m;
+    }
+    return asfloat(ix);
+}
+
+_MATH_ALIAS_f_f(floor)
@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer fmaf, correctly rounded (m65832 only rounds to nearest)
+ *
+ * The generic code splits both factors and sums the pieces with a
+ * dozen double operations, each of them a compiler-rt call. Here the
+ * 24 x 24-bit product is exact in a uint64_t, z is aligned to it with
+ * a sticky bit, and the sum is rounded once by __fixf_pack.
+ */
+
+#include "fixf.h"
+#include "m65832_bits.h"
+
+/* The mantissa of a finite, nonzero |x| with its exponent in *e */
+static inline uint32_t
+__fmaf_unpack(uint32_t ax, int *e)
+{
+    int lz;
+
+    if (ax < 0x00800000) {
+        lz = __builtin_clz(ax) - 8;
+        *e = 1 - lz;
+        return ax << lz;
+    }
+    *e = (int)(ax >> 23);
+    return (ax & 0x007fffff) | 0x00800000;
+}
+
+/* v >> n, with any bits shifted out ORed into bit 0 */
+static inline uint64_t
+__fmaf_shr(uint64_t v, int n)
+{
+    if (n >= 64)
+        return v != 0;
+    return (v >> n) | ((v & (((uint64_t)1 << n) - 1)) != 0);
+}
+
+float
+fmaf(float x, float y, float z)
+{
+    uint32_t ix = asuint(x), iy = asuint(y), iz = asuint(z);
+    uint32_t ax = ix & 0x7fffffff, ay = iy & 0x7fffffff, az = iz & 0x7fffffff;
+    uint32_t sp = (ix ^ iy) & 0x80000000, sz = iz & 0x80000000, sign;
+    uint64_t p, q, v;
+    int      ex, ey, ez, ep, eq, d;
+    float    r;
+
+    /* An infinite or NaN factor makes x * y exact, inf * 0 invalid */
+    if (ax >= 0x7f800000 || ay >= 0x7f800000)
+        return x * y + z;
+    if (az >= 0x7f800000)
+        return __m65832_quietf(iz);
+    if (ax == 0 || ay == 0) {
+        /* 0 + z is z, and +0 unless both zeros are -0 */
+        if (az == 0)
+            return asfloat(sp & sz);
+        return z;
+    }
+
+    /* x * y = p * 2^ep exactly, with the top bit of p at 61 or 62 */
+    p = (uint64_t)__fmaf_unpack(ax, &ex) * __fmaf_unpack(ay, &ey) << 15;
+    ep = ex + ey - 300 - 15;
+    sign = sp;
+    v = p;
+
+    if (az != 0) {
+        /* z = q * 2^eq with the top bit at 61 */
+        q = (uint64_t)__fmaf_unpack(az, &ez) << 38;
+        eq = ez - 150 - 38;
+
+        /*
+         * Shift the smaller one down. Bits can only drop out when it
+         * is at least 15 places below the other, so the sum keeps its
+         * top bit within two of bit 61 and the sticky bit stays far
+         * below the rounding point.
+         */
+        d = ep - eq;
+        if (d >= 0) {
+            q = __fmaf_shr(q, d);
+        } else {
+            p = __fmaf_shr(p, -d);
+            ep = eq;
+        }
+        if (sp == sz) {
+            v = p + q;
+        } else if (p >= q) {
+            v = p - q;
+        } else {
+            v = q - p;
+            sign = sz;
+        }
+        /* Exact cancellation gives +0 */
+        if (v == 0)
+            return 0.0f;
+    }
+
+    r = __fixf_pack(sign, v, ep);
+    if ((asuint(r) & 0x7fffffff) == 0x7f800000)
+        return __math_oflowf(sign != 0);
+    if ((asuint(r) & 0x7fffffff) == 0)
+        return __math_uflowf(sign != 0);
+    return r;
+}
+
+_MATH_ALIAS_f_fff(fma)
@@ -0,0 +1,27 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer fminf: compares ordering keys instead of calling compiler-rt
+ */
+
+#include "m65832_bits.h"
+
+float
+fminf(float x, float y)
+{
+    uint32_t ix = asuint(x), iy = asuint(y);
+    int      nx = (ix & 0x7fffffff) > 0x7f800000;
+    int      ny = (iy & 0x7fffffff) > 0x7f800000;
+
+    if (nx | ny) {
+        /* A signaling NaN gives a quiet NaN, as x + y would */
+        if (issignalingf_inline(x) || issignalingf_inline(y))
+            return __m65832_quietf(nx ? ix : iy);
+        return nx ? y : x;
+    }
+    return __m65832_orderf(ix) < __m65832_orderf(iy) ? x : y;
+}
+
+_MATH_ALIAS_f_ff(fmin)
@@ -0,0 +1,24 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * __fpclassifyf from the magnitude bits alone, with one comparison per
+ * class instead of the generic code's pairs of signed ranges
+ */
+
+#include "m65832_bits.h"
+
+int
+__fpclassifyf(float x)
+{
+    uint32_t ax = asuint(x) & 0x7fffffff;
+
+    if (ax >= 0x7f800000)
+        return ax == 0x7f800000 ? FP_INFINITE : FP_NAN;
+    if (ax >= 0x00800000)
+        return FP_NORMAL;
+    return ax ? FP_SUBNORMAL : FP_ZERO;
+}
+
+_MATH_ALIAS_i_f(__fpclassify)
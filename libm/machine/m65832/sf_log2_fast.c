@@ -0,0 +1,50 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point log2f for the fast tier (__fast_log2f)
+ *
+ * __fixf_log gives log(x) with at least 53 significant bits, which is
+ * scaled by 1/ln2 in Q63 before the single rounding to float. Powers
+ * of two come out exact.
+ */
+
+#include "fdlibm.h"
+#include "fixf.h"
+
+/* 1/ln2 in Q63 */
+#define INVLN2_Q63 0xb8aa3b295c17f0bcULL
+
+float
+__fast_log2f(float x)
+{
+    int32_t  ix;
+    uint32_t sign;
+    uint64_t v;
+    int      e2, lz;
+
+    GET_FLOAT_WORD(ix, x);
+
+    if (FLT_UWORD_IS_ZERO(ix & 0x7fffffff))
+        return __math_divzerof(1); /* log2(+-0)=-inf */
+    if (ix < 0)
+        return __math_invalidf(x); /* log2(-#) = NaN */
+    if (!FLT_UWORD_IS_FINITE(ix))
+        return x + x;
+
+    sign = __fixf_log(ix, &v, &e2);
+    if (v == 0)
+        return 0.0f;
+    lz = __builtin_clzll(v);
+    return __fixf_pack(sign, __fixf_mul64(v << lz, INVLN2_Q63), e2 - lz + 1);
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default log2f too */
+__strong_reference(__fast_log2f, log2f);
+
+_MATH_ALIAS_f_f(log2)
+
+#endif
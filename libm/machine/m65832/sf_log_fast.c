@@ -0,0 +1,47 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point logf for the fast tier (__fast_logf), within 0.52 ULP
+ * of the exact result
+ *
+ * __fixf_log in fixf.h does the work: a 32-entry table of 1/c gives an
+ * exact w = z/c - 1 and log1p(w) comes from a short series, so results
+ * near 1 keep full precision.
+ */
+
+#include "fdlibm.h"
+#include "fixf.h"
+
+float
+__fast_logf(float x)
+{
+    int32_t  ix;
+    uint32_t sign;
+    uint64_t v;
+    int      e2;
+
+    GET_FLOAT_WORD(ix, x);
+
+    if (FLT_UWORD_IS_ZERO(ix & 0x7fffffff))
+        return __math_divzerof(1); /* log(+-0)=-inf */
+    if (ix < 0)
+        return __math_invalidf(x); /* log(-#) = NaN */
+    if (!FLT_UWORD_IS_FINITE(ix))
+        return x + x;
+
+    sign = __fixf_log(ix, &v, &e2);
+    if (v == 0)
+        return 0.0f;
+    return __fixf_pack(sign, v, e2);
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default logf too */
+__strong_reference(__fast_logf, logf);
+
+_MATH_ALIAS_f_f(log)
+
+#endif
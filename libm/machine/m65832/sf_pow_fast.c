@@ -0,0 +1,213 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point powf for the fast tier (__fast_powf)
+ *
+ * x^y = exp(y log(x)). log(x) uses the reduction of __fixf_log with a
+ * degree 7 series in Q62, good to about 2^-45 relative, so the product
+ * with y keeps its accuracy up to the overflow and underflow
+ * thresholds. y log(x) is formed in Q55 and goes through the same
+ * n * ln2/64 + r reduction and __fixf_exp evaluation as expf.
+ */
+
+#include "fdlibm.h"
+#include "math_config.h"
+#include "fixf.h"
+
+/* 64/ln2 in Q16 and ln2/64 in Q55 */
+#define INVLN2_64_Q16 6051102
+#define LN2_64_Q55    390207173010335LL
+
+/* (-1)^j / (j + 1) in Q62: log1p(w) = w * sum(c[j] w^j) */
+static const int64_t log1p_c[8] = {
+    4611686018427387904LL, -2305843009213693952LL, 1537228672809129301LL,
+    -1152921504606846976LL, 922337203685477581LL,  -768614336404564651LL,
+    658812288346769701LL,   -576460752303423488LL,
+};
+
+/* (a * b) >> 64 for signed a and b */
+static inline int64_t
+smul64(int64_t a, int64_t b)
+{
+    uint64_t p = __fixf_mul64(a < 0 ? -(uint64_t)a : (uint64_t)a, b < 0 ? -(uint64_t)b : (uint64_t)b);
+
+    return (a ^ b) < 0 ? -(int64_t)p : (int64_t)p;
+}
+
+/*
+ * log(x) for the bits ix of a positive finite x, as sign * m * 2^e
+ * with the top bit of m set, or m = 0 when x is 1. Returns the sign.
+ */
+static uint32_t
+pow_log(int32_t ix, uint64_t *m, int *e)
+{
+    int32_t  k, i, j;
+    int64_t  w, ws, q, s;
+    uint64_t a, b;
+    int      lz;
+
+    i = __fixf_log_reduce(ix, &k, &w);
+    s = k * FIXF_LN2_Q55 + __m65832_log_logc[i];
+
+    if (w) {
+        /* log1p(w) / w in Q62, with w in Q68 (|w| < 2^-5) */
+        ws = w * 8192;
+        q = log1p_c[7];
+        for (j = 6; j >= 0; j--)
+            q = log1p_c[j] + (smul64(q, ws) >> 4);
+
+        a = w < 0 ? -w : w;
+        lz = __builtin_clzll(a);
+        /* b is |log1p(w)| scaled by 2^(53+lz) */
+        b = __fixf_mul64(a << lz, (uint64_t)q);
+        if (s == 0) {
+            int bz = __builtin_clzll(b);
+
+            *m = b << bz;
+            *e = -53 - lz - bz;
+            return w < 0 ? 0x80000000 : 0;
+        }
+        s += w < 0 ? -(int64_t)(b >> (lz - 2)) : (int64_t)(b >> (lz - 2));
+    }
+    if (s == 0) {
+        *m = 0;
+        return 0;
+    }
+    a = s < 0 ? -s : s;
+    lz = __builtin_clzll(a);
+    *m = a << lz;
+    *e = -55 - lz;
+    return s < 0 ? 0x80000000 : 0;
+}
+
+/* Returns 0 if not int, 1 if odd int, 2 if even int.  The argument is
+   the bit representation of a non-zero finite floating-point value.  */
+static inline int
+checkint(uint32_t iy)
+{
+    int e = iy >> 23 & 0xff;
+    if (e < 0x7f)
+        return 0;
+    if (e > 0x7f + 23)
+        return 2;
+    if (iy & (((uint32_t)1 << (0x7f + 23 - e)) - 1))
+        return 0;
+    if (iy & ((uint32_t)1 << (0x7f + 23 - e)))
+        return 1;
+    return 2;
+}
+
+static inline int
+zeroinfnan(uint32_t ix)
+{
+    return 2 * ix - 1 >= 2u * (uint32_t)0x7f800000 - 1;
+}
+
+float
+__fast_powf(float x, float y)
+{
+    uint32_t sign = 0, ix, iy, ym, lsign, rbits;
+    uint64_t lm, p, tq;
+    int64_t  t, r;
+    int32_t  n, r31;
+    int      le, ey, sh, lz;
+    float    z;
+
+    ix = asuint(x);
+    iy = asuint(y);
+    if (ix - 0x00800000 >= 0x7f800000 - 0x00800000 || zeroinfnan(iy)) {
+        /* Either (x < 0x1p-126 or inf or nan) or (y is 0 or inf or nan).  */
+        if (zeroinfnan(iy)) {
+            if (2 * iy == 0)
+                return issignalingf_inline(x) ? x + y : 1.0f;
+            if (ix == 0x3f800000)
+                return issignalingf_inline(y) ? x + y : 1.0f;
+            if (2 * ix > 2u * (uint32_t)0x7f800000 || 2 * iy > 2u * (uint32_t)0x7f800000)
+                return x + y;
+            if (2 * ix == 2 * (uint32_t)0x3f800000)
+                return 1.0f;
+            if ((2 * ix < 2 * (uint32_t)0x3f800000) == !(iy & (uint32_t)0x80000000))
+                return 0.0f; /* |x|<1 && y==inf or |x|>1 && y==-inf.  */
+            return y * y;
+        }
+        if (zeroinfnan(ix)) {
+            float x2 = x * x;
+            if (ix & 0x80000000 && checkint(iy) == 1) {
+                x2 = -x2;
+                sign = 1;
+            }
+            if (!(iy & 0x80000000))
+                return opt_barrier_float(x2);
+#if WANT_ERRNO
+            if (2 * ix == 0)
+                return __math_divzerof(sign);
+#endif
+            return 1 / x2;
+        }
+        /* x and y are non-zero finite.  */
+        if (ix & 0x80000000) {
+            /* Finite x < 0.  */
+            int yint = checkint(iy);
+            if (yint == 0)
+                return __math_invalidf(x);
+            if (yint == 1)
+                sign = 1;
+            ix &= 0x7fffffff;
+        }
+    }
+
+    lsign = pow_log((int32_t)ix, &lm, &le);
+    if (lm == 0)
+        return sign ? -1.0f : 1.0f;
+
+    /* |y| = ym * 2^(ey - 23) with bit 23 of ym set */
+    ey = (int)(iy >> 23 & 0xff);
+    ym = iy & 0x7fffff;
+    if (ey == 0) {
+        lz = __builtin_clz(ym) - 8;
+        ym <<= lz;
+        ey = 1 - lz;
+    } else {
+        ym |= 0x800000;
+    }
+    ey -= 127;
+
+    /* |y log(x)| = p * 2^(sh - 55) with p in [2^62, 2^64) */
+    p = __fixf_mul64(lm, (uint64_t)ym << 40);
+    sh = le + ey + 56;
+    lsign ^= iy & 0x80000000;
+    if (sh <= -64)
+        tq = 0;
+    else if (sh >= 0 || (tq = p >> -sh) >= ((uint64_t)1 << 62))
+        /* |y log(x)| >= 128 */
+        return lsign ? __math_uflowf(sign) : __math_oflowf(sign);
+    t = lsign ? -(int64_t)tq : (int64_t)tq;
+
+    n = (int32_t)(((t >> 23) * INVLN2_64_Q16 + ((int64_t)1 << 47)) >> 48);
+    r = t - n * LN2_64_Q55;
+    r31 = (int32_t)((r + ((int64_t)1 << 23)) >> 24);
+
+    z = __fixf_exp(sign << 31, n, r31);
+
+    rbits = asuint(z) & 0x7fffffff;
+    if (rbits == 0)
+        return __math_uflowf(sign);
+    if (rbits == 0x7f800000)
+        return __math_oflowf(sign);
+    return z;
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default powf too */
+#if defined(__GNUCLIKE_PRAGMA_DIAGNOSTIC) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmissing-attributes"
+#endif
+__strong_reference(__fast_powf, powf);
+__strong_reference(__fast_powf, _powf);
+
+_MATH_ALIAS_f_ff(pow)
+
+#endif
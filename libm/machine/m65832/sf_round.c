@@ -0,0 +1,33 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer roundf: adds half a unit at the integer position and clears
+ * the fraction bits; NaNs are quieted without a soft-float add
+ */
+
+#include "m65832_bits.h"
+
+float
+roundf(float x)
+{
+    uint32_t ix = asuint(x), m;
+    int      e = (int)((ix >> 23) & 0xff) - 127;
+
+    if (e >= 23)
+        return e == 128 ? __m65832_quietf(ix) : x;
+    if (e < 0) {
+        /* |x| < 1: +-1 from 0.5 up, otherwise +-0 */
+        ix = (ix & 0x80000000) | (e == -1 ? 0x3f800000 : 0);
+    } else {
+        m = 0x007fffff >> e;
+        if ((ix & m) == 0)
+            return x;
+        ix += 0x00400000 >> e;
+        ix &= ~m;
+    }
+    return asfloat(ix);
+}
+
+_MATH_ALIAS_f_f(round)
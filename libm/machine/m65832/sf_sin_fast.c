@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fixed-point sinf for the fast tier (__fast_sinf), within 0.54 ULP
+ * of the exact result
+ */
+
+#include "fdlibm.h"
+#include "fixf.h"
+
+float
+__fast_sinf(float x)
+{
+    uint32_t hx, ix, rm, sign;
+    int      re, neg, k;
+    int32_t  z;
+
+    GET_FLOAT_WORD(hx, x);
+    ix = hx & 0x7fffffff;
+    sign = hx >> 31;
+
+    /* sin(Inf or NaN) is NaN */
+    if (!FLT_UWORD_IS_FINITE(ix))
+        return __math_invalidf(x);
+
+    /* |x| < 2^-12: x - x^3/6 rounds to x */
+    if (ix < 0x39800000)
+        return x;
+
+    k = __fixf_rem_pio2(ix, &rm, &re, &neg);
+    z = __fixf_square(rm, re);
+    switch (k) {
+    case 0:
+        return __fixf_sin(sign ^ neg, rm, re, z);
+    case 1:
+        return __fixf_cos(sign, z);
+    case 2:
+        return __fixf_sin(sign ^ neg ^ 1, rm, re, z);
+    default:
+        return __fixf_cos(sign ^ 1, z);
+    }
+}
+
+#if __M65832_FAST_MATH_FLOAT
+
+/* m65832-fast-math-float makes this the default sinf too */
+#if defined(__GNUCLIKE_PRAGMA_DIAGNOSTIC) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmissing-attributes"
+#endif
+__strong_reference(__fast_sinf, sinf);
+__strong_reference(__fast_sinf, _sinf);
+
+_MATH_ALIAS_f_f(sin)
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer sqrtf, correctly rounded (m65832 only rounds to nearest)
+ *
+ * Two Newton steps on 1/sqrt from a 7-bit table replace the 25 passes
+ * of the generic bit-by-bit loop; the root is then fixed up and
+ * rounded by comparing squares.
+ */
+
+#include "fixf.h"
+
+float
+sqrtf(float x)
+{
+    float    z;
+    uint32_t hx, s;
+    int32_t  ix, m;
+    uint64_t y, y2, xx;
+    int      i;
+
+    GET_FLOAT_WORD(ix, x);
+    hx = ix & 0x7fffffff;
+
+    /* take care of Inf and NaN */
+    if (!FLT_UWORD_IS_FINITE(hx)) {
+        if (ix < 0 && !isnanf(x))
+            return __math_invalidf(x); /* sqrt(-inf)=sNaN */
+        return x + x;                  /* sqrt(NaN)=NaN, sqrt(+inf)=+inf */
+    }
+
+    /* take care of zero and -ves */
+    if (FLT_UWORD_IS_ZERO(hx))
+        return x; /* sqrt(+-0) = +-0 */
+    if (ix < 0)
+        return __math_invalidf(x); /* sqrt(-ve) = sNaN */
+
+    /* normalize x to a * 2^(2m) with a = ix/2^23 in [1, 4) */
+    m = (ix >> 23);
+    if (FLT_UWORD_IS_SUBNORMAL(hx)) { /* subnormal x */
+        i = __builtin_clz(ix) - 8;
+        ix <<= i;
+        m -= i - 1;
+    }
+    m -= 127; /* unbias exponent */
+    ix = (ix & 0x007fffffL) | 0x00800000L;
+    if (m & 1) /* odd m, double x to make it even */
+        ix += ix;
+    m >>= 1; /* m = [m/2] */
+
+    /* y = 1/sqrt(a) in Q30 */
+    y = (uint32_t)__m65832_rsqrt_tab[(ix >> 18) - 32] << 15;
+    for (i = 0; i < 2; i++) {
+        y2 = (y * y) >> 30;
+        y = (y * ((3ULL << 30) - (((uint64_t)ix * y2) >> 23))) >> 31;
+    }
+
+    /* s = floor(sqrt(ix * 2^23)), then round to nearest */
+    s = (uint32_t)(((uint64_t)ix * y) >> 30);
+    xx = (uint64_t)ix << 23;
+    while ((uint64_t)s * s > xx)
+        s--;
+    while ((uint64_t)(s + 1) * (s + 1) <= xx)
+        s++;
+    if (xx - (uint64_t)s * s > s)
+        s++;
+
+    SET_FLOAT_WORD(z, s + ((uint32_t)(m + 126) << 23));
+    return z;
+}
+
+_MATH_ALIAS_f_f(sqrt)
@@ -0,0 +1,27 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Integer truncf: clears the fraction bits; NaNs are quieted without a
+ * soft-float add
+ */
+
+#include "m65832_bits.h"
+
+float
+truncf(float x)
+{
+    uint32_t ix = asuint(x);
+    int      e = (int)((ix >> 23) & 0xff) - 127;
+
+    if (e >= 23)
+        return e == 128 ? __m65832_quietf(ix) : x;
+    if (e < 0)
+        ix &= 0x80000000;
+    else
+        ix &= ~(0x007fffff >> e);
+    return asfloat(ix);
+}
+
+_MATH_ALIAS_f_f(trunc)
@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * __gamma_exact(x)
+ * Return Gamma(x), correctly rounded, when x is one of 1/2, 1, 3/2,
+ * ..., 24, and zero otherwise. These are the factorials and the
+ * double factorials times sqrt(pi) that statistics code keeps asking
+ * for; a table lookup saves tgamma and lgamma their full evaluation.
+ */
+
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+#define NGAMMA 48
+
+/* Gamma(k/2) for k = 1 .. NGAMMA */
+static const __float64 gamma_half[NGAMMA] = {
+    _F_64(1.77245385090551610396e+00), /* 0x3FFC5BF8, 0x91B4EF6B */
+    _F_64(1.00000000000000000000e+00), /* 0x3FF00000, 0x00000000 */
+    _F_64(8.86226925452758051982e-01), /* 0x3FEC5BF8, 0x91B4EF6B */
+    _F_64(1.00000000000000000000e+00), /* 0x3FF00000, 0x00000000 */
+    _F_64(1.32934038817913702246e+00), /* 0x3FF544FA, 0x6D47B390 */
+    _F_64(2.00000000000000000000e+00), /* 0x40000000, 0x00000000 */
+    _F_64(3.32335097044784255615e+00), /* 0x400A9639, 0x0899A074 */
+    _F_64(6.00000000000000000000e+00), /* 0x40180000, 0x00000000 */
+    _F_64(1.16317283965674480584e+01), /* 0x40274371, 0xE7866C65 */
+    _F_64(2.40000000000000000000e+01), /* 0x40380000, 0x00000000 */
+    _F_64(5.23427777845535189272e+01), /* 0x404A2BE0, 0x247739F2 */
+    _F_64(1.20000000000000000000e+02), /* 0x405E0000, 0x00000000 */
+    _F_64(2.87885277815044332783e+02), /* 0x4071FE2A, 0x1911F7D6 */
+    _F_64(7.20000000000000000000e+02), /* 0x40868000, 0x00000000 */
+    _F_64(1.87125430579778844731e+03), /* 0x409D3D04, 0x68BD32BD */
+    _F_64(5.04000000000000000000e+03), /* 0x40B3B000, 0x00000000 */
+    _F_64(1.40344072934834130137e+04), /* 0x40CB6934, 0x22315F91 */
+    _F_64(4.03200000000000000000e+04), /* 0x40E3B000, 0x00000000 */
+    _F_64(1.19292461994609009707e+05), /* 0x40FD1FC7, 0x6454758A */
+    _F_64(3.62880000000000000000e+05), /* 0x41162600, 0x00000000 */
+    _F_64(1.13327838894878560677e+06), /* 0x41314ADE, 0x639225CA */
+    _F_64(3.62880000000000000000e+06), /* 0x414BAF80, 0x00000000 */
+    _F_64(1.18994230839622486383e+07), /* 0x4166B243, 0xE2AFD199 */
+    _F_64(3.99168000000000000000e+07), /* 0x418308A8, 0x00000000 */
+    _F_64(1.36843365465565860271e+08), /* 0x41A05020, 0xCAEE5EA6 */
+    _F_64(4.79001600000000000000e+08), /* 0x41BC8CFC, 0x00000000 */
+    _F_64(1.71054206831957316399e+09), /* 0x41D97D33, 0x3D1473E3 */
+    _F_64(6.22702080000000000000e+09), /* 0x41F7328C, 0xC0000000 */
+    _F_64(2.30923179223142395020e+10), /* 0x421581A3, 0x3B8941C8 */
+    _F_64(8.71782912000000000000e+10), /* 0x42344C3B, 0x28000000 */
+    _F_64(3.34838609873556457520e+11), /* 0x42537D7B, 0xEDF4639D */
+    _F_64(1.30767436800000000000e+12), /* 0x42730777, 0x75800000 */
+    _F_64(5.18999845304012500000e+12), /* 0x4292E190, 0x0E84C080 */
+    _F_64(2.09227898880000000000e+13), /* 0x42B30777, 0x75800000 */
+    _F_64(8.56349744751620625000e+13), /* 0x42D3789C, 0x8EF8E684 */
+    _F_64(3.55687428096000000000e+14), /* 0x42F437EE, 0xECD80000 */
+    _F_64(1.49861205331533600000e+15), /* 0x43154BEB, 0x3C603C20 */
+    _F_64(6.40237370572800000000e+15), /* 0x4336BEEC, 0xCA730000 */
+    _F_64(2.77243229863337200000e+16), /* 0x43589FC7, 0xFDCF4586 */
+    _F_64(1.21645100408832000000e+17), /* 0x437B02B9, 0x30689000 */
+    _F_64(5.40624298233507520000e+17), /* 0x439E02BB, 0xBD549CBB */
+    _F_64(2.43290200817664000000e+18), /* 0x43C0E1B3, 0xBE415A00 */
+    _F_64(1.10827981137869045760e+19), /* 0x43E339C0, 0x454A3468 */
+    _F_64(5.10909421717094400000e+19), /* 0x4406283B, 0xE9B5C620 */
+    _F_64(2.38280159446418423808e+20), /* 0x4429D59A, 0x5D1BB66B */
+    _F_64(1.12400072777760768000e+21), /* 0x444E7752, 0x6159F06C */
+    _F_64(5.36130358754441428992e+21), /* 0x44722A30, 0x89777C43 */
+    _F_64(2.58520167388849782129e+22)  /* 0x4495E5C3, 0x35F8A4CE */
+};
+
+__float64
+__gamma_exact(__float64 x)
+{
+    __float64 t = x + x;
+    __int32_t k;
+
+    if (!(t >= _F_64(1.0) && t <= (__float64)NGAMMA))
+        return _F_64(0.0);
+    k = (__int32_t)t;
+    if ((__float64)k != t)
+        return _F_64(0.0);
+    return gamma_half[k - 1];
+}
+
+#endif /* _NEED_FLOAT64 */
@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * __sincospi_reduce(x, y)
+ * Reduce x for sinpi and cospi: x = n/2 + r with |r| <= 1/4, and
+ * return n (only n mod 4 is meaningful) with pi r in y[0] + y[1], ready
+ * for __kernel_sin and __kernel_cos. x must be finite with
+ * |x| < 2^52.
+ *
+ * r is exact. pi r is exact in its leading part: the top 21 bits of r
+ * times the top 21 bits of pi, so no reduction by pi/2 is needed.
+ */
+
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+static const __float64 two52 = _F_64(4.50359962737049600000e+15), /* 0x43300000, 0x00000000 */
+    half = _F_64(5.00000000000000000000e-01),                     /* 0x3FE00000, 0x00000000 */
+    pi_hi = _F_64(3.14159202575683593750e+00),                    /* 0x400921FB, 0x00000000 */
+    pi_lo = _F_64(6.27832957300962622257e-07);                    /* 0x3EA5110B, 0x4611A626 */
+
+__int32_t
+__sincospi_reduce(__float64 x, __float64 *y)
+{
+    __float64  t, w, r, rh, a, b;
+    __int32_t  hx, ix;
+    __uint32_t n;
+
+    GET_HIGH_WORD(hx, x);
+    ix = hx & 0x7fffffff;
+    t = fabs64(x + x);
+    if (ix >= 0x43200000) { /* |x| >= 2^51, 2x is an integer */
+        GET_LOW_WORD(n, t);
+        r = 0;
+    } else {
+        /* round 2|x| to an integer n, leaving n in the low word of w */
+        w = t + two52;
+        GET_LOW_WORD(n, w);
+        w -= two52;
+        r = fabs64(x) - w * half;
+        if (hx < 0)
+            r = -r;
+    }
+    if (hx < 0)
+        n = -n;
+
+    /* pi r = pi_hi rh + (pi_hi (r - rh) + pi_lo r) */
+    rh = r;
+    SET_LOW_WORD(rh, 0);
+    a = pi_hi * rh;
+    b = pi_hi * (r - rh) + pi_lo * r;
+    y[0] = a + b;
+    y[1] = b - (y[0] - a);
+    return (__int32_t)(n & 3);
+}
+
+#endif /* _NEED_FLOAT64 */
@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * __gamma_exactf(x)
+ * Float version of __gamma_exact.
+ */
+
+#include "fdlibm.h"
+
+#define NGAMMA 48
+
+/* Gamma(k/2) for k = 1 .. NGAMMA */
+static const float gamma_half[NGAMMA] = {
+    1.7724539042e+00f, /* 0x3fe2dfc5 */
+    1.0000000000e+00f, /* 0x3f800000 */
+    8.8622695208e-01f, /* 0x3f62dfc5 */
+    1.0000000000e+00f, /* 0x3f800000 */
+    1.3293403387e+00f, /* 0x3faa27d3 */
+    2.0000000000e+00f, /* 0x40000000 */
+    3.3233509064e+00f, /* 0x4054b1c8 */
+    6.0000000000e+00f, /* 0x40c00000 */
+    1.1631728172e+01f, /* 0x413a1b8f */
+    2.4000000000e+01f, /* 0x41c00000 */
+    5.2342777252e+01f, /* 0x42515f01 */
+    1.2000000000e+02f, /* 0x42f00000 */
+    2.8788528442e+02f, /* 0x438ff151 */
+    7.2000000000e+02f, /* 0x44340000 */
+    1.8712542725e+03f, /* 0x44e9e823 */
+    5.0400000000e+03f, /* 0x459d8000 */
+    1.4034407227e+04f, /* 0x465b49a1 */
+    4.0320000000e+04f, /* 0x471d8000 */
+    1.1929246094e+05f, /* 0x47e8fe3b */
+    3.6288000000e+05f, /* 0x48b13000 */
+    1.1332783750e+06f, /* 0x498a56f3 */
+    3.6288000000e+06f, /* 0x4a5d7c00 */
+    1.1899423000e+07f, /* 0x4b35921f */
+    3.9916800000e+07f, /* 0x4c184540 */
+    1.3684336000e+08f, /* 0x4d028106 */
+    4.7900160000e+08f, /* 0x4de467e0 */
+    1.7105420800e+09f, /* 0x4ecbe99a */
+    6.2270208000e+09f, /* 0x4fb99466 */
+    2.3092318208e+10f, /* 0x50ac0d1a */
+    8.7178289152e+10f, /* 0x51a261d9 */
+    3.3483859558e+11f, /* 0x529bebdf */
+    1.3076744110e+12f, /* 0x53983bbc */
+    5.1899982152e+12f, /* 0x54970c80 */
+    2.0922790576e+13f, /* 0x55983bbc */
+    8.5634970550e+13f, /* 0x569bc4e4 */
+    3.5568741463e+14f, /* 0x57a1bf77 */
+    1.4986120685e+15f, /* 0x58aa5f5a */
+    6.4023735304e+15f, /* 0x59b5f766 */
+    2.7724323133e+16f, /* 0x5ac4fe40 */
+    1.2164510459e+17f, /* 0x5bd815ca */
+    5.4062430110e+17f, /* 0x5cf015de */
+    2.4329020232e+18f, /* 0x5e070d9e */
+    1.1082797932e+19f, /* 0x5f19ce02 */
+    5.1090940837e+19f, /* 0x603141df */
+    2.3828016104e+20f, /* 0x614eacd3 */
+    1.1240007248e+21f, /* 0x6273ba93 */
+    5.3613034210e+21f, /* 0x63915184 */
+    2.5852017445e+22f  /* 0x64af2e1a */
+};
+
+float
+__gamma_exactf(float x)
+{
+    float     t = x + x;
+    __int32_t k;
+
+    if (!(t >= 1.0f && t <= (float)NGAMMA))
+        return 0.0f;
+    k = (__int32_t)t;
+    if ((float)k != t)
+        return 0.0f;
+    return gamma_half[k - 1];
+}
@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * __sincospif_reduce(x, y)
+ * Float version of __sincospi_reduce; x must be finite with
+ * |x| < 2^23.
+ */
+
+#include "fdlibm.h"
+
+static const float two23 = 8.3886080000e+06f, /* 0x4b000000 */
+    half = 5.0000000000e-01f,                 /* 0x3f000000 */
+    pi_hi = 3.1406250000e+00f,                /* 0x40490000 */
+    pi_lo = 9.6765358467e-04f;                /* 0x3a7daa22 */
+
+int
+__sincospif_reduce(float x, float *y)
+{
+    float      t, w, r, rh, a, b;
+    __int32_t  hx, ix;
+    __uint32_t n;
+
+    GET_FLOAT_WORD(hx, x);
+    ix = hx & 0x7fffffff;
+    t = fabsf(x + x);
+    if (ix >= 0x4a800000) { /* |x| >= 2^22, 2x is an integer */
+        GET_FLOAT_WORD(n, t);
+        r = 0;
+    } else {
+        /* round 2|x| to an integer n, leaving n in the low bits of w */
+        w = t + two23;
+        GET_FLOAT_WORD(n, w);
+        w -= two23;
+        r = fabsf(x) - w * half;
+        if (hx < 0)
+            r = -r;
+    }
+    if (hx < 0)
+        n = -n;
+
+    /* pi r = pi_hi rh + (pi_hi (r - rh) + pi_lo r) */
+    GET_FLOAT_WORD(ix, r);
+    SET_FLOAT_WORD(rh, ix & 0xfffff000);
+    a = pi_hi * rh;
+    b = pi_hi * (r - rh) + pi_lo * r;
+    y[0] = a + b;
+    y[1] = b - (y[0] - a);
+    return (int)(n & 3);
+}
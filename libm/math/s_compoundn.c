@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * compoundn(x, n) = (1 + x)^n for integer n
+ *
+ * Method: 1 + x is formed exactly as a double-double sum, so a small
+ * rate x loses nothing, and raised to n by square-and-multiply
+ * (pown.h) with one rounding at the end.
+ *
+ * Special cases:
+ *	compoundn(x, n) is NaN, invalid, for x < -1;
+ *	compoundn(x, 0) is 1 for x >= -1 or NaN;
+ *	compoundn(-1, n) is +0 for n > 0 and +inf with a divide-by-zero
+ *	    exception for n < 0;
+ *	compoundn(+inf, n) is +inf for n > 0 and +0 for n < 0;
+ *	compoundn(NaN, n) is NaN for n != 0.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+#include "pown.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+compoundn64(__float64 x, long long n)
+{
+    unsigned long long k = n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+    __float64          h, l, t;
+
+    if (x < -1)
+        return __math_invalid(x);
+    if (n == 0)
+        return _F_64(1.0);
+    if (isnan(x))
+        return x + x;
+    if (x == -1)
+        return n < 0 ? __math_divzero(0) : _F_64(0.0);
+    if (isinf(x))
+        return n < 0 ? _F_64(0.0) : x;
+
+    /* h + l = 1 + x exactly (two-sum) */
+    h = 1 + x;
+    t = h - x;
+    l = (1 - t) + (x - (h - t));
+    return __pown(h, l, k, n < 0);
+}
+
+_MATH_ALIAS_d_dk(compoundn)
+
+#endif /* _NEED_FLOAT64 */
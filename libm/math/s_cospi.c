@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * cospi(x) = cos(pi x), without the cost or error of reducing pi x
+ *
+ * Method: as for sinpi.
+ *
+ * Special cases: cospi(n + 1/2) for integer n is +0; cospi(+-inf) and
+ * cospi(NaN) are NaN.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+cospi64(__float64 x)
+{
+    __float64  y[2], z;
+    __int32_t  ix, n;
+    __uint32_t lx;
+
+    GET_HIGH_WORD(ix, x);
+    ix &= 0x7fffffff;
+
+    /* cospi(Inf or NaN) is NaN */
+    if (ix >= 0x7ff00000)
+        return __math_invalid(x);
+
+    /* |x| >= 2^52 is an integer, even from 2^53 */
+    if (ix >= 0x43300000) {
+        GET_LOW_WORD(lx, x);
+        return ix < 0x43400000 && (lx & 1) ? _F_64(-1.0) : _F_64(1.0);
+    }
+
+    n = __sincospi_reduce(x, y);
+    switch (n) {
+    case 0:
+        z = __kernel_cos(y[0], y[1]);
+        break;
+    case 1:
+        z = -__kernel_sin(y[0], y[1], 1);
+        break;
+    case 2:
+        z = -__kernel_cos(y[0], y[1]);
+        break;
+    default:
+        z = __kernel_sin(y[0], y[1], 1);
+        break;
+    }
+    if (z == 0)
+        return _F_64(0.0);
+    return z;
+}
+
+_MATH_ALIAS_d_d(cospi)
+
+#endif /* _NEED_FLOAT64 */
@@ -92,7 +92,7 @@ floor64(__float64 x)
         }
     } else if (j0 > 51) {
         if (j0 == 0x400)
-            return x + x; /* inf or NaN */
+            return __math_quiet64(x); /* inf or NaN */
         else
             return x; /* x is integral */
     } else {
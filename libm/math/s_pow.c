@@ -58,6 +58,7 @@
  */
 
 #include "fdlibm.h"
+#include "pown.h"
 
 #if __OBSOLETE_MATH_DOUBLE
 
@@ -99,7 +100,7 @@ pow64(__float64 x, __float64 y)
 {
     __float64  z, ax, z_h, z_l, p_h, p_l;
     __float64  y1, t1, t2, r, s, t, u, v, w;
-    __int32_t  i, j, k, yisint, n;
+    __int32_t  i, j, k, yisint, n, pn;
     __int32_t  hx, hy, ix, iy;
     __uint32_t lx, ly;
 
@@ -173,6 +174,11 @@ pow64(__float64 x, __float64 y)
         }
     }
 
+    /* y is a small integer and x^y stays normal: multiply */
+    pn = __pown_small_y(hy, ly);
+    if (pn != 0 && ix >= 0x37f00000 && ix < 0x47f00000)
+        return __pown_small(x, pn);
+
     ax = fabs64(x);
     /* special value of x */
     if (lx == 0) {
@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * pown(x, n) = x^n for integer n
+ *
+ * Method: square-and-multiply in double-double (pown.h), one rounding
+ * at the end. That is a handful of multiplies for the small n that
+ * generic code feeds pow, where pow spends a full log and exp.
+ *
+ * Special cases:
+ *	pown(x, 0) is 1 for any x, even NaN;
+ *	pown(+-0, n) is +-0 for odd n > 0 and +0 for even n > 0;
+ *	pown(+-0, n) is +-inf for odd n < 0 and +inf for even n < 0,
+ *	    with a divide-by-zero exception;
+ *	pown(+-inf, n) is +-inf for odd n > 0, +inf for even n > 0,
+ *	    +-0 for odd n < 0 and +0 for even n < 0;
+ *	pown(NaN, n) is NaN for n != 0.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+#include "pown.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+pown64(__float64 x, long long n)
+{
+    unsigned long long k = n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+    __float64          r;
+
+    if (n == 0)
+        return _F_64(1.0);
+    if (isnan(x))
+        return x + x;
+    if (x == 0) {
+        if (n < 0)
+            return __math_divzero(signbit(x) && (k & 1));
+        return (k & 1) ? x : _F_64(0.0);
+    }
+    if (isinf(x)) {
+        r = (n < 0) ? _F_64(0.0) : fabs64(x);
+        return (signbit(x) && (k & 1)) ? -r : r;
+    }
+    r = __pown(fabs64(x), 0, k, n < 0);
+    return (signbit(x) && (k & 1)) ? -r : r;
+}
+
+_MATH_ALIAS_d_dk(pown)
+
+#endif /* _NEED_FLOAT64 */
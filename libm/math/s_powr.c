@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * powr(x, y) = x^y defined as exp(y log(x)), so only for x >= 0
+ *
+ * Method: pow once the cases where powr differs from it are settled.
+ *
+ * Special cases:
+ *	powr(x, y) is NaN, invalid, for x < 0;
+ *	powr(+-0, +-0) and powr(+inf, +-0) are NaN, invalid;
+ *	powr(1, +-inf) is NaN, invalid;
+ *	powr(+-0, y) is +inf with divide-by-zero for finite y < 0,
+ *	    +inf for y = -inf and +0 for y > 0;
+ *	powr(x, +-0) is 1 for finite x > 0;
+ *	powr(NaN, y) and powr(x, NaN) are NaN.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+powr64(__float64 x, __float64 y)
+{
+    if (isnan(x) || isnan(y))
+        return x + y;
+    if (x < 0)
+        return __math_invalid(x);
+    if (x == 0) {
+        if (y == 0)
+            return __math_invalid(y);
+        if (y < 0)
+            return isinf(y) ? -y : __math_divzero(0);
+        return _F_64(0.0);
+    }
+    if (y == 0) {
+        if (isinf(x))
+            return __math_invalid(y);
+        return _F_64(1.0);
+    }
+    if (x == 1 && isinf(y))
+        return __math_invalid(y);
+    return pow64(x, y);
+}
+
+_MATH_ALIAS_d_dd(powr)
+
+#endif /* _NEED_FLOAT64 */
@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * rootn(x, n) = x^(1/n) for integer n
+ *
+ * Method: n = 1, -1, 2 and 3 are x, 1/x, sqrt and cbrt. Otherwise
+ * r = pow(|x|, 1/|n|) is close, but 1/|n| is rounded and that error is
+ * multiplied by log(x), so one Newton step
+ *
+ *	r += r * (|x| / r^|n| - 1) / |n|
+ *
+ * with r^|n| from pown.h brings it back to within an ulp. For n < 0
+ * the result is 1/r.
+ *
+ * Special cases:
+ *	rootn(x, 0) is NaN, invalid;
+ *	rootn(x, n) is NaN, invalid, for x < 0 and even n;
+ *	rootn(+-0, n) is +-0 for odd n > 0 and +0 for even n > 0;
+ *	rootn(+-0, n) is +-inf for odd n < 0 and +inf for even n < 0,
+ *	    with a divide-by-zero exception;
+ *	rootn(+-inf, n) is +-inf for odd n > 0, +inf for even n > 0,
+ *	    +-0 for odd n < 0 and +0 for even n < 0;
+ *	rootn(NaN, n) is NaN.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+#include "pown.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+rootn64(__float64 x, long long n)
+{
+    unsigned long long k = n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+    __float64          ax, r, h, l;
+    int                neg = signbit(x), e;
+
+    if (n == 0)
+        return __math_invalid(_F_64(0.0));
+    if (isnan(x))
+        return x + x;
+    if (neg && !(k & 1) && x != 0)
+        return __math_invalid(x);
+    if (x == 0) {
+        if (n < 0)
+            return __math_divzero(neg && (k & 1));
+        return (k & 1) ? x : _F_64(0.0);
+    }
+    if (isinf(x)) {
+        r = (n < 0) ? _F_64(0.0) : fabs64(x);
+        return neg ? -r : r;
+    }
+
+    switch (n) {
+    case 1:
+        return x;
+    case -1:
+        return 1 / x;
+    case 2:
+        return sqrt64(x);
+    case 3:
+        return cbrt64(x);
+    }
+
+    ax = fabs64(x);
+    r = pow64(ax, 1 / (__float64)k);
+    e = __pown_core(r, 0, k, &h, &l);
+    r += r * (scalbn64(ax, -e) / (h + l) - 1) / (__float64)k;
+    if (n < 0)
+        r = 1 / r;
+    return neg ? -r : r;
+}
+
+_MATH_ALIAS_d_dk(rootn)
+
+#endif /* _NEED_FLOAT64 */
@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * sincospi(x, s, c) computes sinpi(x) and cospi(x) from one reduction
+ */
+
+#define _GNU_SOURCE
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+void
+sincospi64(__float64 x, __float64 *sinx, __float64 *cosx)
+{
+    __float64  y[2], s, c;
+    __int32_t  ix, n;
+    __uint32_t lx;
+
+    GET_HIGH_WORD(ix, x);
+    ix &= 0x7fffffff;
+
+    /* sincospi(Inf or NaN) is NaN */
+    if (ix >= 0x7ff00000) {
+        *sinx = *cosx = __math_invalid(x);
+        return;
+    }
+
+    /* |x| >= 2^52 is an integer, even from 2^53 */
+    if (ix >= 0x43300000) {
+        GET_LOW_WORD(lx, x);
+        *sinx = x * _F_64(0.0);
+        *cosx = ix < 0x43400000 && (lx & 1) ? _F_64(-1.0) : _F_64(1.0);
+        return;
+    }
+
+    n = __sincospi_reduce(x, y);
+    s = __kernel_sin(y[0], y[1], 1);
+    c = __kernel_cos(y[0], y[1]);
+    switch (n) {
+    case 0:
+        *sinx = s;
+        *cosx = c;
+        break;
+    case 1:
+        *sinx = c;
+        *cosx = -s;
+        break;
+    case 2:
+        *sinx = -s;
+        *cosx = -c;
+        break;
+    default:
+        *sinx = -c;
+        *cosx = s;
+        break;
+    }
+    if (*sinx == 0)
+        *sinx = x * _F_64(0.0);
+    if (*cosx == 0)
+        *cosx = _F_64(0.0);
+}
+
+_MATH_ALIAS_v_dDD(sincospi)
+
+#endif /* _NEED_FLOAT64 */
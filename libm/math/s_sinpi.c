@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * sinpi(x) = sin(pi x), without the cost or error of reducing pi x
+ *
+ * Method: x = n/2 + r exactly with |r| <= 1/4 (__sincospi_reduce), then
+ * the sin or cos kernel on pi r depending on n mod 4.
+ *
+ * Special cases: sinpi(+-0) and sinpi(n) for integer n are zero with
+ * the sign of x; sinpi(+-inf) and sinpi(NaN) are NaN.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+
+#ifdef _NEED_FLOAT64
+
+__float64
+sinpi64(__float64 x)
+{
+    __float64 y[2], z;
+    __int32_t ix, n;
+
+    GET_HIGH_WORD(ix, x);
+    ix &= 0x7fffffff;
+
+    /* sinpi(Inf or NaN) is NaN */
+    if (ix >= 0x7ff00000)
+        return __math_invalid(x);
+
+    /* |x| >= 2^52 is an integer */
+    if (ix >= 0x43300000)
+        return x * _F_64(0.0);
+
+    n = __sincospi_reduce(x, y);
+    switch (n) {
+    case 0:
+        z = __kernel_sin(y[0], y[1], 1);
+        break;
+    case 1:
+        z = __kernel_cos(y[0], y[1]);
+        break;
+    case 2:
+        z = -__kernel_sin(y[0], y[1], 1);
+        break;
+    default:
+        z = -__kernel_cos(y[0], y[1]);
+        break;
+    }
+    if (z == 0)
+        return x * _F_64(0.0);
+    return z;
+}
+
+_MATH_ALIAS_d_d(sinpi)
+
+#endif /* _NEED_FLOAT64 */
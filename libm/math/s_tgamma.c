@@ -15,7 +15,8 @@
 /* tgamma(x)
  * Gamma function. Returns gamma(x)
  *
- * Method: See lgamma_r
+ * Method: Look up integers and half-integers up to 24 in a table,
+ *	   otherwise see lgamma_r
  */
 
 #include "fdlibm.h"
@@ -27,11 +28,15 @@ tgamma64(__float64 x)
 {
     int signgam_local;
     int divzero = 0;
+    __float64 y = __gamma_exact(x);
+
+    if (y != _F_64(0.0))
+        return y;
 
     if (isless(x, _F_64(0.0)) && clang_barrier_double(rint64(x)) == x)
         return __math_invalid(x);
 
-    __float64 y = exp64(__math_lgamma_r(x, &signgam_local, &divzero));
+    y = exp64(__math_lgamma_r(x, &signgam_local, &divzero));
     if (signgam_local < 0)
         y = -y;
     if (isinf(y) && finite64(x) && !divzero)
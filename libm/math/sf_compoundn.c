@@ -0,0 +1,42 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * compoundnf(x, n) = (1 + x)^n for integer n; see s_compoundn.c for
+ * the special cases. 1 + x and its power are carried in double-double
+ * as in compoundn and rounded to float once.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+#include "pown.h"
+
+float
+compoundnf(float x, long long n)
+{
+    unsigned long long k = n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+
+    if (x < -1)
+        return __math_invalidf(x);
+    if (n == 0)
+        return 1.0f;
+    if (isnan(x))
+        return x + x;
+    if (x == -1)
+        return n < 0 ? __math_divzerof(0) : 0.0f;
+    if (isinf(x))
+        return n < 0 ? 0.0f : x;
+#ifdef _NEED_FLOAT64
+    {
+        /* h + l = 1 + x exactly (two-sum) */
+        __float64 h = 1 + (__float64)x, t = h - x, l = (1 - t) + (x - (h - t));
+
+        return __pown_to_float(__pown(h, l, k, n < 0));
+    }
+#else
+    return powf(1 + x, (float)n);
+#endif
+}
+
+_MATH_ALIAS_f_fk(compoundn)
@@ -0,0 +1,20 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier cosf: the default cosf built as __fast_cosf without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_cosf, none of the aliases of cosf */
+#undef __strong_reference
+#undef _MATH_ALIAS_f_f
+#define _MATH_ALIAS_f_f(name)
+#define cosf __fast_cosf
+
+#include "sf_cos.c"
@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier exp2f: the default exp2f built as __fast_exp2f without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_exp2f, none of the aliases of exp2f */
+#undef _MATH_ALIAS_f_f
+#define _MATH_ALIAS_f_f(name)
+#define exp2f __fast_exp2f
+
+#include "sf_exp2.c"
@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier expf: the default expf built as __fast_expf without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_expf, none of the aliases of expf */
+#undef _MATH_ALIAS_f_f
+#define _MATH_ALIAS_f_f(name)
+#define expf __fast_expf
+
+#include "sf_exp.c"
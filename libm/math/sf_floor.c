@@ -49,7 +49,7 @@ floorf(float x)
         }
     } else {
         if (!FLT_UWORD_IS_FINITE(ix))
-            return x + x; /* inf or NaN */
+            return __math_quietf(x); /* inf or NaN */
         else
             return x; /* x is integral */
     }
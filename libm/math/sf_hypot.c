@@ -15,6 +15,137 @@
 
 #include "fdlibm.h"
 
+#if __MATH_INT_ROUNDING || (!__OBSOLETE_MATH_FLOAT && defined(_NEED_FLOAT64))
+
+/* |a| >= |b| as bits, a infinite or NaN: infinity wins over a quiet NaN */
+static float
+hypotf_nonfinite(float a, float b)
+{
+    if (isinf(a) && !issignalingf_inline(b))
+        return a;
+    if (isinf(b) && !issignalingf_inline(a))
+        return b;
+    return __math_quietf(issignalingf_inline(b) ? b : a);
+}
+
+#endif
+
+#if __MATH_INT_ROUNDING
+
+/*
+ * Without an FPU, scale by taking the exponents apart: a^2 + b^2 is
+ * formed exactly from the 24-bit significands, b's square shifted
+ * down by twice the exponent difference, and one integer square root
+ * gives the result rounded once.
+ */
+float
+hypotf(float x, float y)
+{
+    uint32_t ha = asuint(x) & 0x7fffffff, hb = asuint(y) & 0x7fffffff, t;
+    uint32_t ma, mb, m, low, half, base, bits;
+    uint64_t s, sb, r, bit;
+    int      ea, eb, d, e, sh, sticky;
+
+    if (hb > ha) {
+        t = ha;
+        ha = hb;
+        hb = t;
+    }
+    if (ha >= 0x7f800000)
+        return hypotf_nonfinite(asfloat(ha), asfloat(hb));
+    if (hb == 0)
+        return asfloat(ha);
+
+    /* a = ma * 2^(ea - 150), b = mb * 2^(eb - 150), ma and mb in [2^23, 2^24) */
+    ea = (int)(ha >> 23);
+    ma = ha & 0x007fffff;
+    if (ea == 0) {
+        sh = __builtin_clz(ma) - 8;
+        ma <<= sh;
+        ea = 1 - sh;
+    } else
+        ma |= 0x00800000;
+    eb = (int)(hb >> 23);
+    mb = hb & 0x007fffff;
+    if (eb == 0) {
+        sh = __builtin_clz(mb) - 8;
+        mb <<= sh;
+        eb = 1 - sh;
+    } else
+        mb |= 0x00800000;
+    d = 2 * (ea - eb);
+
+    /* s = (a^2 + b^2) * 2^(304 - 2 ea), in [2^50, 2^53) */
+    s = ((uint64_t)ma * ma) << 4;
+    sb = ((uint64_t)mb * mb) << 4;
+    if (d < 64) {
+        sticky = (sb & ((1ULL << d) - 1)) != 0;
+        s += sb >> d;
+    } else
+        sticky = 1;
+
+    /* r = floor(sqrt(s)), in [2^25, 2^27) */
+    r = 0;
+    bit = s >= (1ULL << 52) ? 1ULL << 52 : 1ULL << 50;
+    while (bit) {
+        if (s >= r + bit) {
+            s -= r + bit;
+            r = (r >> 1) + bit;
+        } else
+            r >>= 1;
+        bit >>= 2;
+    }
+    sticky |= s != 0;
+
+    /* hypot = r * 2^(ea - 152); e is its biased exponent */
+    sh = (r >> 26) ? 3 : 2;
+    e = ea + sh - 2;
+    if (e < 1) {
+        sh += 1 - e;
+        base = 0;
+    } else
+        base = (uint32_t)(e - 1);
+    m = (uint32_t)(r >> sh);
+    low = (uint32_t)r & ((1U << sh) - 1);
+    half = 1U << (sh - 1);
+    if (low | sticky) {
+        if (__math_round_away(low > half || (low == half && sticky), low == half && !sticky, m & 1, 0))
+            m++;
+        __math_set_inexactf();
+    }
+
+    bits = (base << 23) + m;
+    if (bits >= 0x7f800000)
+        return __math_oflowf(0);
+    if (bits < 0x00800000 && (low | sticky))
+        return __math_denormf(asfloat(bits));
+    return asfloat(bits);
+}
+
+#elif !__OBSOLETE_MATH_FLOAT && defined(_NEED_FLOAT64)
+
+/*
+ * The squares of two floats and their sum fit in a double without
+ * scaling, so one double square root rounds the result just once
+ * before the conversion to float.
+ */
+float
+hypotf(float x, float y)
+{
+    uint32_t ha = asuint(x) & 0x7fffffff, hb = asuint(y) & 0x7fffffff;
+    __float64 a, b;
+
+    if (ha >= 0x7f800000 || hb >= 0x7f800000)
+        return ha >= hb ? hypotf_nonfinite(asfloat(ha), asfloat(hb))
+                        : hypotf_nonfinite(asfloat(hb), asfloat(ha));
+    a = asfloat(ha);
+    b = asfloat(hb);
+    return check_oflowf((float)sqrt64(a * a + b * b));
+}
+
+#else
+
+
 float
 hypotf(float x, float y)
 {
@@ -89,4 +220,6 @@ hypotf(float x, float y)
     return check_oflowf(w);
 }
 
+#endif
+
 _MATH_ALIAS_f_ff(hypot)
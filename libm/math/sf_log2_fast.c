@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier log2f: the default log2f built as __fast_log2f without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_log2f, none of the aliases of log2f */
+#undef _MATH_ALIAS_f_f
+#define _MATH_ALIAS_f_f(name)
+#define log2f __fast_log2f
+
+#include "sf_log2.c"
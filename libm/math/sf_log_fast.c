@@ -0,0 +1,19 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier logf: the default logf built as __fast_logf without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_logf, none of the aliases of logf */
+#undef _MATH_ALIAS_f_f
+#define _MATH_ALIAS_f_f(name)
+#define logf __fast_logf
+
+#include "sf_log.c"
@@ -15,6 +15,7 @@
 
 #include "fdlibm.h"
 #include "math_config.h"
+#include "pown.h"
 
 #if __OBSOLETE_MATH_FLOAT
 
@@ -58,7 +59,7 @@ powf(float x, float y)
 {
     float     z, ax, z_h, z_l, p_h, p_l;
     float     y1, t1, t2, r, s, t, u, v, w;
-    __int32_t i, j, k, yisint, n;
+    __int32_t i, j, k, yisint, n, pn;
     __int32_t hx, hy, ix, iy, is;
 
     GET_FLOAT_WORD(hx, x);
@@ -121,6 +122,12 @@ powf(float x, float y)
         if (hx >= 0)        /* x >= +0 */
             return sqrtf(x);
     }
+#ifdef _NEED_FLOAT64
+    /* y is a small integer and x^y stays normal: multiply in double */
+    pn = __pown_small_yf(hy);
+    if (pn != 0 && ix >= 0x37800000 && ix < 0x47800000)
+        return __pownf_small(x, pn);
+#endif
 
     ax = fabsf(x);
     /* special value of x */
@@ -0,0 +1,20 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier powf: the default powf built as __fast_powf without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_powf, none of the aliases of powf */
+#undef __strong_reference
+#undef _MATH_ALIAS_f_ff
+#define _MATH_ALIAS_f_ff(name)
+#define powf __fast_powf
+
+#include "sf_pow.c"
@@ -0,0 +1,58 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * pownf(x, n) = x^n for integer n; see s_pown.c for the special cases.
+ * The product is formed in double, with the exponent kept apart so it
+ * cannot overflow, and rounded to float once.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+#include "pown.h"
+
+float
+pownf(float x, long long n)
+{
+    unsigned long long k = n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+    int                odd = signbit(x) && (k & 1);
+    float              r;
+
+    if (n == 0)
+        return 1.0f;
+    if (isnan(x))
+        return x + x;
+    if (x == 0) {
+        if (n < 0)
+            return __math_divzerof(odd);
+        return (k & 1) ? x : 0.0f;
+    }
+    if (isinf(x)) {
+        r = (n < 0) ? 0.0f : fabsf(x);
+        return odd ? -r : r;
+    }
+#ifdef _NEED_FLOAT64
+    {
+        __float64 p;
+        int       e = __pownf_core(fabsf(x), k, &p);
+
+        if (n < 0) {
+            p = 1 / p;
+            e = -e;
+        }
+        if (e > FLT_MAX_EXP + 1)
+            return __math_oflowf(odd);
+        if (e < FLT_MIN_EXP - FLT_MANT_DIG - 1)
+            return __math_uflowf(odd);
+        r = __pown_to_float(scalbn64(odd ? -p : p, e));
+    }
+#else
+    r = powf(fabsf(x), (float)n);
+    if (odd)
+        r = -r;
+#endif
+    return r;
+}
+
+_MATH_ALIAS_f_fk(pown)
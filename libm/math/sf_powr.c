@@ -0,0 +1,37 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * powrf(x, y) = x^y defined as exp(y log(x)); see s_powr.c for the
+ * special cases.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+
+float
+powrf(float x, float y)
+{
+    if (isnan(x) || isnan(y))
+        return x + y;
+    if (x < 0)
+        return __math_invalidf(x);
+    if (x == 0) {
+        if (y == 0)
+            return __math_invalidf(y);
+        if (y < 0)
+            return isinf(y) ? -y : __math_divzerof(0);
+        return 0.0f;
+    }
+    if (y == 0) {
+        if (isinf(x))
+            return __math_invalidf(y);
+        return 1.0f;
+    }
+    if (x == 1 && isinf(y))
+        return __math_invalidf(y);
+    return powf(x, y);
+}
+
+_MATH_ALIAS_f_ff(powr)
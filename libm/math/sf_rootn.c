@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * rootnf(x, n) = x^(1/n) for integer n; see s_rootn.c for the special
+ * cases. Where double is available the root is taken there and
+ * rounded to float once, which leaves room for the Newton step's
+ * error; otherwise it is powf with 1/n.
+ */
+
+#define _ISOC23_SOURCE
+#include "fdlibm.h"
+#include "pown.h"
+
+float
+rootnf(float x, long long n)
+{
+#ifdef _NEED_FLOAT64
+    __float64 r;
+
+    if (n == -1 && x != 0)
+        return __pown_to_float(1 / (__float64)x);
+    r = rootn64((__float64)x, n);
+    return (float)r;
+#else
+    unsigned long long k = n < 0 ? -(unsigned long long)n : (unsigned long long)n;
+    int                neg = signbit(x);
+    float              r;
+
+    if (n == 0)
+        return __math_invalidf(0.0f);
+    if (isnan(x))
+        return x + x;
+    if (neg && !(k & 1) && x != 0)
+        return __math_invalidf(x);
+    if (x == 0) {
+        if (n < 0)
+            return __math_divzerof(neg && (k & 1));
+        return (k & 1) ? x : 0.0f;
+    }
+    if (n == 1)
+        return x;
+    r = powf(fabsf(x), 1.0f / (float)n);
+    return neg ? -r : r;
+#endif
+}
+
+_MATH_ALIAS_f_fk(rootn)
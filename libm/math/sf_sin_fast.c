@@ -0,0 +1,20 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fast tier sinf: the default sinf built as __fast_sinf without
+ * errno, exception or directed rounding handling. Targets with a
+ * quicker kernel replace this file.
+ */
+
+#define __MATH_FAST_LIB 1
+#include "fdlibm.h"
+
+/* Only __fast_sinf, none of the aliases of sinf */
+#undef __strong_reference
+#undef _MATH_ALIAS_f_f
+#define _MATH_ALIAS_f_f(name)
+#define sinf __fast_sinf
+
+#include "sf_sin.c"
@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Float version of s_sincospi.c
+ */
+
+#define _GNU_SOURCE
+#include "fdlibm.h"
+
+void
+sincospif(float x, float *sinx, float *cosx)
+{
+    float     y[2], s, c;
+    __int32_t ix, n;
+
+    GET_FLOAT_WORD(ix, x);
+    ix &= 0x7fffffff;
+
+    /* sincospi(Inf or NaN) is NaN */
+    if (ix >= 0x7f800000) {
+        *sinx = *cosx = __math_invalidf(x);
+        return;
+    }
+
+    /* |x| >= 2^23 is an integer, even from 2^24 */
+    if (ix >= 0x4b000000) {
+        *sinx = x * 0.0f;
+        *cosx = ix < 0x4b800000 && (ix & 1) ? -1.0f : 1.0f;
+        return;
+    }
+
+    n = __sincospif_reduce(x, y);
+    s = __kernel_sinf(y[0], y[1], 1);
+    c = __kernel_cosf(y[0], y[1]);
+    switch (n) {
+    case 0:
+        *sinx = s;
+        *cosx = c;
+        break;
+    case 1:
+        *sinx = c;
+        *cosx = -s;
+        break;
+    case 2:
+        *sinx = -s;
+        *cosx = -c;
+        break;
+    default:
+        *sinx = -c;
+        *cosx = s;
+        break;
+    }
+    if (*sinx == 0)
+        *sinx = x * 0.0f;
+    if (*cosx == 0)
+        *cosx = 0.0f;
+}
+
+_MATH_ALIAS_v_fFF(sincospi)
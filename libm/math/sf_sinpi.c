@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Float version of s_sinpi.c
+ */
+
+#include "fdlibm.h"
+
+float
+sinpif(float x)
+{
+    float     y[2], z;
+    __int32_t ix, n;
+
+    GET_FLOAT_WORD(ix, x);
+    ix &= 0x7fffffff;
+
+    /* sinpi(Inf or NaN) is NaN */
+    if (ix >= 0x7f800000)
+        return __math_invalidf(x);
+
+    /* |x| >= 2^23 is an integer */
+    if (ix >= 0x4b000000)
+        return x * 0.0f;
+
+    n = __sincospif_reduce(x, y);
+    switch (n) {
+    case 0:
+        z = __kernel_sinf(y[0], y[1], 1);
+        break;
+    case 1:
+        z = __kernel_cosf(y[0], y[1]);
+        break;
+    case 2:
+        z = -__kernel_sinf(y[0], y[1], 1);
+        break;
+    default:
+        z = -__kernel_cosf(y[0], y[1]);
+        break;
+    }
+    if (z == 0)
+        return x * 0.0f;
+    return z;
+}
+
+_MATH_ALIAS_f_f(sinpi)
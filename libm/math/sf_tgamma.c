@@ -27,11 +27,15 @@ tgammaf(float x)
 {
     int signgam_local;
     int divzero = 0;
+    float y = __gamma_exactf(x);
+
+    if (y != 0.0f)
+        return y;
 
     if (isless(x, 0.0f) && clang_barrier_float(rintf(x)) == x)
         return __math_invalidf(x);
 
-    float y = expf(__math_lgammaf_r(x, &signgam_local, &divzero));
+    y = expf(__math_lgammaf_r(x, &signgam_local, &divzero));
     if (signgam_local < 0)
         y = -y;
     if (isinff(y) && finitef(x) && !divzero)
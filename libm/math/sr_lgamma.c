@@ -70,7 +70,10 @@
  *	Note: one should avoid compute pi*(-x) directly in the
  *	      computation of sin(pi*(-x)).
  *
- *   5. Special Cases
+ *   5. Positive integers and half-integers up to 24 take the log
+ *	of their Gamma, found in a table by __gamma_exact.
+ *
+ *   6. Special Cases
  *		lgamma(2+s) ~ s*(1-Euler) for tiny s
  *		lgamma(1)=lgamma(2)=0
  *		lgamma(x) ~ -log(x) for tiny x
@@ -238,6 +241,9 @@ __math_lgamma_r(__float64 x, int *signgamp, int *divzero)
         } else
             return -log64(x);
     }
+    /* integers and half-integers up to 24 have Gamma in a table */
+    if (hx > 0 && (t = __gamma_exact(x)) != zero)
+        return log64(t);
     if (hx < 0) {
         if (ix >= 0x43300000) { /* |x|>=2**52, must be -integer */
             *divzero = 1;
@@ -171,6 +171,9 @@ __math_lgammaf_r(float x, int *signgamp, int *divzero)
         } else
             return -logf(x);
     }
+    /* integers and half-integers up to 24 have Gamma in a table */
+    if (hx > 0 && (t = __gamma_exactf(x)) != zero)
+        return logf(t);
     if (hx < 0) {
         if (ix >= 0x4b000000) { /* |x|>=2**23, must be -integer */
             *divzero = 1;
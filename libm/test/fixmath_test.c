@@ -0,0 +1,204 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check the Q15 and Q31 functions from <fixmath.h> against the double
+ * precision functions: the q31 results must be within 2 units in the
+ * last place and the q15 ones within 1, over every q15 argument and a
+ * pseudo-random set of q31 arguments.
+ */
+
+#include <fixmath.h>
+#include <math.h>
+#include <stdio.h>
+
+#define SAMPLES 20000
+
+static uint32_t seed = 0x2545f491;
+
+static q31_t
+next_q31(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return (q31_t)seed;
+}
+
+static double
+ref_sin(double x)
+{
+    return sin(M_PI * x);
+}
+
+static double
+ref_cos(double x)
+{
+    return cos(M_PI * x);
+}
+
+static double
+ref_sqrt(double x)
+{
+    return x < 0 ? 0 : sqrt(x);
+}
+
+static double
+ref_exp31(double x)
+{
+    return exp(32 * x);
+}
+
+static double
+ref_log31(double x)
+{
+    return log(x) / 32;
+}
+
+static double
+ref_exp15(double x)
+{
+    return exp(16 * x);
+}
+
+static double
+ref_log15(double x)
+{
+    return log(x) / 16;
+}
+
+struct func {
+    const char *name;
+    q31_t (*q31)(q31_t);
+    q15_t (*q15)(q15_t);
+    double (*ref)(double);
+    int positive; /* only check positive arguments */
+};
+
+static const struct func funcs[] = {
+    { "q31_sin", q31_sin, NULL, ref_sin, 0 },
+    { "q31_cos", q31_cos, NULL, ref_cos, 0 },
+    { "q31_sqrt", q31_sqrt, NULL, ref_sqrt, 0 },
+    { "q31_exp", q31_exp, NULL, ref_exp31, 0 },
+    { "q31_log", q31_log, NULL, ref_log31, 1 },
+    { "q15_sin", NULL, q15_sin, ref_sin, 0 },
+    { "q15_cos", NULL, q15_cos, ref_cos, 0 },
+    { "q15_sqrt", NULL, q15_sqrt, ref_sqrt, 0 },
+    { "q15_exp", NULL, q15_exp, ref_exp15, 0 },
+    { "q15_log", NULL, q15_log, ref_log15, 1 },
+};
+
+#define NFUNCS (sizeof(funcs) / sizeof(funcs[0]))
+
+/* Error of got against want in units of scale, saturating want */
+static double
+q_error(int32_t got, double want, double scale)
+{
+    double max = scale - 1;
+
+    want *= scale;
+    if (want > max)
+        want = max;
+    if (want < -scale)
+        want = -scale;
+    return fabs(got - want);
+}
+
+static int
+report(const char *name, double worst, double arg, double bound)
+{
+    printf("%-10s max error %.3f at %.10f\n", name, worst, arg);
+    if (worst > bound) {
+        printf("%s: error above %.0f\n", name, bound);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    unsigned i;
+    int      s, ret = 0;
+
+    for (i = 0; i < NFUNCS; i++) {
+        const struct func *fn = &funcs[i];
+        double             worst = 0, worst_x = 0, err, x;
+
+        if (fn->q31) {
+            for (s = 0; s < SAMPLES; s++) {
+                q31_t q = next_q31();
+
+                if (fn->positive && q <= 0)
+                    q = q == Q31_MIN ? 1 : -q;
+                if (s < 32) /* small arguments */
+                    q = (q >> (s & 31)) | (fn->positive ? 1 : 0);
+                x = q31_to_double(q);
+                err = q_error(fn->q31(q), fn->ref(x), 2147483648.0);
+                if (err > worst) {
+                    worst = err;
+                    worst_x = x;
+                }
+            }
+            ret |= report(fn->name, worst, worst_x, 2);
+        } else {
+            for (s = fn->positive ? 1 : Q15_MIN; s <= Q15_MAX; s++) {
+                x = q15_to_float((q15_t)s);
+                err = q_error(fn->q15((q15_t)s), fn->ref(x), 32768.0);
+                if (err > worst) {
+                    worst = err;
+                    worst_x = x;
+                }
+            }
+            ret |= report(fn->name, worst, worst_x, 1);
+        }
+    }
+
+    /* atan2 around the circle, including the axes */
+    {
+        double worst = 0, worst_x = 0, err, y, x;
+
+        for (s = 0; s < SAMPLES; s++) {
+            q31_t qy = next_q31(), qx = next_q31();
+
+            if (s < 8) {
+                qy = s & 1 ? 0 : qy;
+                qx = s & 2 ? 0 : qx;
+            }
+            y = q31_to_double(qy);
+            x = q31_to_double(qx);
+            err = q_error(q31_atan2(qy, qx), atan2(y, x) / M_PI, 2147483648.0);
+            if (err > worst) {
+                worst = err;
+                worst_x = atan2(y, x);
+            }
+        }
+        ret |= report("q31_atan2", worst, worst_x, 2);
+
+        worst = 0;
+        for (s = 0; s < SAMPLES; s++) {
+            q15_t qy = (q15_t)next_q31(), qx = (q15_t)next_q31();
+
+            y = q15_to_float(qy);
+            x = q15_to_float(qx);
+            err = q_error(q15_atan2(qy, qx), atan2(y, x) / M_PI, 32768.0);
+            if (err > worst) {
+                worst = err;
+                worst_x = atan2(y, x);
+            }
+        }
+        ret |= report("q15_atan2", worst, worst_x, 1);
+    }
+
+    /* saturating arithmetic */
+    if (q15_add(Q15_MAX, 1) != Q15_MAX || q15_sub(Q15_MIN, 1) != Q15_MIN
+        || q15_mul(Q15_MIN, Q15_MIN) != Q15_MAX || q15_neg(Q15_MIN) != Q15_MAX
+        || q31_add(Q31_MAX, 1) != Q31_MAX || q31_sub(Q31_MIN, 1) != Q31_MIN
+        || q31_mul(Q31_MIN, Q31_MIN) != Q31_MAX || q31_abs(Q31_MIN) != Q31_MAX
+        || q31_mul(0x40000000, 0x40000000) != 0x20000000 || q15_from_q31(0x7fffffff) != Q15_MAX) {
+        printf("saturating arithmetic\n");
+        ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Report the worst error in ULP of each accuracy tier (default,
+ * __fast_ and __cr_) of the functions in <sys/_mathtier.h> against
+ * double precision over a pseudo-random set of arguments, along with
+ * the cycles per call where the target can count them (the m65832
+ * emulator). The fast tier must stay within 4 ULP and the correctly
+ * rounded one within half an ULP.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef __m65832__
+#include <machine/cycles.h>
+#define cycles() __m65832_cycles()
+#else
+#define cycles() 0
+#endif
+
+#define SAMPLES  1000
+
+#define FAST_ULP 4.0
+#define CR_ULP   0.5001
+
+static uint32_t seed = 0x2545f491;
+
+static uint32_t
+next_u32(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+/* Uniform in [lo, hi], or any positive finite float when lo == hi */
+static float
+next_arg(float lo, float hi)
+{
+    union {
+        uint32_t u;
+        float    f;
+    } v;
+
+    if (lo == hi) {
+        do
+            v.u = next_u32() & 0x7fffffff;
+        while (v.u == 0 || v.u >= 0x7f800000);
+        return v.f;
+    }
+    return lo + (hi - lo) * (float)(next_u32() >> 8) * 0x1p-24f;
+}
+
+static double
+ref_exp2(double x)
+{
+    return exp2(x);
+}
+
+static double
+ref_log2(double x)
+{
+    return log2(x);
+}
+
+struct func {
+    const char *name;
+    float (*tier[3])(float);
+    double (*ref)(double);
+    float lo, hi;
+};
+
+static const char *const tier_names[3] = { "default", "fast", "cr" };
+
+static const struct func funcs[] = {
+    { "expf", { expf, __fast_expf, __cr_expf }, exp, -87.0f, 88.0f },
+    { "exp2f", { exp2f, __fast_exp2f, __cr_exp2f }, ref_exp2, -125.0f, 127.0f },
+    { "logf", { logf, __fast_logf, __cr_logf }, log, 0.0f, 0.0f },
+    { "log2f", { log2f, __fast_log2f, __cr_log2f }, ref_log2, 0.0f, 0.0f },
+    { "sinf", { sinf, __fast_sinf, NULL }, sin, -100.0f, 100.0f },
+    { "cosf", { cosf, __fast_cosf, NULL }, cos, -100.0f, 100.0f },
+};
+
+#define NFUNCS (sizeof(funcs) / sizeof(funcs[0]))
+
+static float  args[SAMPLES], args2[SAMPLES];
+static double want[SAMPLES];
+
+/* Error of got in units in the last place of the float nearest want */
+static double
+ulp_error(float got, double want)
+{
+    int e;
+
+    (void)frexp(want, &e);
+    if (e < -125)
+        e = -125;
+    return fabs((double)got - want) / ldexp(1.0, e - 24);
+}
+
+static int
+report(const char *name, int t, double worst, float arg, uint64_t cost)
+{
+    double bound = t == 1 ? FAST_ULP : t == 2 ? CR_ULP : 0;
+
+    printf("%-6s %-8s max error %.3f ULP at %a", name, tier_names[t], worst, (double)arg);
+    if (cost)
+        printf(", %lu cycles", (unsigned long)(cost / SAMPLES));
+    printf("\n");
+    if (bound && worst > bound) {
+        printf("%s %s: error above %g ULP\n", name, tier_names[t], bound);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    volatile float sink;
+    unsigned       i, t;
+    int            s, ret = 0;
+
+    if (sizeof(double) < 8) {
+        printf("no double precision reference\n");
+        return 0;
+    }
+
+    for (i = 0; i < NFUNCS; i++) {
+        const struct func *fn = &funcs[i];
+
+        for (s = 0; s < SAMPLES; s++) {
+            args[s] = next_arg(fn->lo, fn->hi);
+            want[s] = fn->ref(args[s]);
+        }
+        for (t = 0; t < 3; t++) {
+            float (*f)(float) = fn->tier[t];
+            double   worst = 0, err;
+            float    worst_x = 0;
+            uint64_t start, cost;
+
+            if (!f)
+                continue;
+            start = cycles();
+            for (s = 0; s < SAMPLES; s++)
+                sink = f(args[s]);
+            cost = cycles() - start;
+            for (s = 0; s < SAMPLES; s++) {
+                err = ulp_error(f(args[s]), want[s]);
+                if (err > worst) {
+                    worst = err;
+                    worst_x = args[s];
+                }
+            }
+            ret |= report(fn->name, t, worst, worst_x, cost);
+        }
+    }
+
+    /* powf, with results inside the normal range */
+    {
+        float (*const pow_tier[2])(float, float) = { powf, __fast_powf };
+
+        for (s = 0; s < SAMPLES; s++) {
+            args[s] = next_arg(0.01f, 100.0f);
+            args2[s] = next_arg(-15.0f, 15.0f);
+            want[s] = pow(args[s], args2[s]);
+        }
+        for (t = 0; t < 2; t++) {
+            float (*f)(float, float) = pow_tier[t];
+            double   worst = 0, err;
+            float    worst_x = 0;
+            uint64_t start, cost;
+
+            start = cycles();
+            for (s = 0; s < SAMPLES; s++)
+                sink = f(args[s], args2[s]);
+            cost = cycles() - start;
+            for (s = 0; s < SAMPLES; s++) {
+                err = ulp_error(f(args[s], args2[s]), want[s]);
+                if (err > worst) {
+                    worst = err;
+                    worst_x = args[s];
+                }
+            }
+            ret |= report("powf", t, worst, worst_x, cost);
+        }
+    }
+    (void)sink;
+    return ret;
+}
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+"""
+Instruction-trace profiler for picolibc on M65832
+
+Runs an ELF on m65832emu with instruction tracing enabled, maps every
+traced PC to a function using the ELF symbol table and writes two files
+per run:
+
+  NAME.prof    flat profile: self and inclusive cost of each function
+  NAME.folded  collapsed stacks, one "a;b;c weight" line per stack,
+               ready for flamegraph.pl or speedscope
+
+The emulator has no call-stack output, so stacks are rebuilt from the
+PC stream: entering a function at its first instruction is a call,
+moving to a function that is already on the stack is a return, and
+any other change of function replaces the top of the stack (a tail
+call or longjmp).
+
+Tracing is requested with the emulator arguments in M65832_TRACE_ARGS
+(default "--trace"). Every output line that matches M65832_TRACE_RE is
+one executed instruction: group 1 is the PC in hex and an optional
+group 2 is the emulator's running cycle counter. With the counter,
+costs are in cycles, otherwise in instructions. All other lines are
+passed back to the caller as normal emulator output.
+
+Usage: ./m65832_profile.py ELF [NAME]   profile ELF, writing NAME.prof and NAME.folded
+"""
+
+import bisect
+import os
+import re
+import shlex
+import subprocess
+import sys
+import threading
+from collections import defaultdict
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+TRACE_ARGS = shlex.split(os.environ.get("M65832_TRACE_ARGS", "--trace"))
+TRACE_RE = re.compile(
+    os.environ.get(
+        "M65832_TRACE_RE",
+        r"^\s*(?:PC[:=]\s*)?\$?([0-9A-Fa-f]{4,8})\b(?:.*?\b(?:CYC|cyc|cycles)[:=]\s*([0-9]+))?",
+    )
+)
+
+# Tracing slows the emulator down a lot
+PROFILE_TIMEOUT = int(os.environ.get("M65832_PROFILE_TIMEOUT", "1800"))
+
+UNKNOWN = "[unknown]"
+
+
+class Symbols:
+    """Function address ranges of an ELF, read with llvm-nm."""
+
+    def __init__(self, nm: str, elf_path: str):
+        self.starts: List[int] = []
+        self.ends: List[int] = []
+        self.names: List[str] = []
+        result = subprocess.run(
+            [nm, "--numeric-sort", "--print-size", "--defined-only", elf_path],
+            capture_output=True, text=True,
+        )
+        syms = []
+        for line in result.stdout.splitlines():
+            fields = line.split()
+            if len(fields) == 4:
+                addr, size, kind, name = fields
+            elif len(fields) == 3:
+                addr, kind, name = fields
+                size = None
+            else:
+                continue
+            if kind not in "tTwW":
+                continue
+            syms.append((int(addr, 16), int(size, 16) if size else None, name))
+        for i, (addr, size, name) in enumerate(syms):
+            if self.starts and self.starts[-1] == addr:
+                # Aliases of one function: keep the first name
+                continue
+            end = addr + size if size else (syms[i + 1][0] if i + 1 < len(syms) else addr + 1)
+            self.starts.append(addr)
+            self.ends.append(end)
+            self.names.append(name)
+
+    def lookup(self, pc: int) -> int:
+        """Index of the function containing pc, or -1."""
+        i = bisect.bisect_right(self.starts, pc) - 1
+        if i >= 0 and pc < self.ends[i]:
+            return i
+        return -1
+
+    def name(self, index: int) -> str:
+        return self.names[index] if index >= 0 else UNKNOWN
+
+
+class Profile:
+    """Accumulates a PC trace into per-stack costs."""
+
+    def __init__(self, symbols: Symbols):
+        self.symbols = symbols
+        self.folded: Dict[str, int] = defaultdict(int)
+        self.unit = "instructions"
+        # Stack of (function index, collapsed stack key)
+        self.stack: List[Tuple[int, str]] = []
+        self.lo = self.hi = 0
+        self.pending: Optional[str] = None
+        self.last_cycles: Optional[int] = None
+
+    def _enter(self, func: int, pc: int):
+        stack = self.stack
+        is_call = func >= 0 and pc == self.symbols.starts[func]
+        if stack and stack[-1][0] == func and not is_call:
+            return
+        if not stack:
+            stack.append((func, self.symbols.name(func)))
+        elif is_call:
+            stack.append((func, stack[-1][1] + ";" + self.symbols.name(func)))
+        else:
+            for depth in range(len(stack) - 2, -1, -1):
+                if stack[depth][0] == func:
+                    del stack[depth + 1:]
+                    break
+            else:
+                parent = stack[-2][1] + ";" if len(stack) > 1 else ""
+                stack[-1] = (func, parent + self.symbols.name(func))
+        if func >= 0:
+            self.lo, self.hi = self.symbols.starts[func], self.symbols.ends[func]
+        else:
+            self.lo = self.hi = 0
+
+    def add(self, pc: int, cycles: Optional[int] = None):
+        """Account one traced instruction."""
+        # The first instruction of the current function is looked up again
+        # so that recursion shows up as a call
+        if not (self.lo < pc < self.hi):
+            self._enter(self.symbols.lookup(pc), pc)
+        if cycles is None:
+            self.folded[self.stack[-1][1]] += 1
+            return
+        # The counter is the total before this instruction, so it closes
+        # the cost of the previous one
+        self.unit = "cycles"
+        if self.pending is not None:
+            self.folded[self.pending] += cycles - self.last_cycles
+        self.pending = self.stack[-1][1]
+        self.last_cycles = cycles
+
+    def finish(self):
+        if self.pending is not None:
+            self.folded[self.pending] += 1
+            self.pending = None
+
+    def flat(self) -> List[Tuple[str, int, int]]:
+        """(function, self, inclusive) sorted by self cost."""
+        self_cost: Dict[str, int] = defaultdict(int)
+        incl_cost: Dict[str, int] = defaultdict(int)
+        for key, weight in self.folded.items():
+            frames = key.split(";")
+            self_cost[frames[-1]] += weight
+            for frame in set(frames):
+                incl_cost[frame] += weight
+        return sorted(((f, self_cost[f], incl_cost[f]) for f in incl_cost),
+                      key=lambda x: (-x[1], -x[2], x[0]))
+
+    def total(self) -> int:
+        return sum(self.folded.values())
+
+    def write(self, base: Path, title: str = "", limit: int = 0):
+        """Write base.prof and base.folded."""
+        base.parent.mkdir(parents=True, exist_ok=True)
+        total = self.total() or 1
+        with open(f"{base}.prof", "w") as f:
+            f.write(f"# Flat profile{' of ' + title if title else ''}: {self.total()} {self.unit}\n")
+            f.write(f"#  self%          self  total%         total  function\n")
+            rows = self.flat()
+            for name, s, t in rows[:limit] if limit else rows:
+                f.write(f"{s * 100.0 / total:7.2f} {s:13} {t * 100.0 / total:7.2f} {t:13}  {name}\n")
+        with open(f"{base}.folded", "w") as f:
+            for key, weight in sorted(self.folded.items()):
+                if weight:
+                    f.write(f"{key} {weight}\n")
+
+
+def run_profiled(cmd: List[str], nm: str, base: Path, title: str = "",
+                 timeout: int = PROFILE_TIMEOUT) -> Tuple[str, Profile]:
+    """Run an emulator command line (ending in the ELF path) with tracing on,
+    profile it and write the profile files. Returns (emulator output
+    without the trace lines, profile)."""
+    elf_path = cmd[-1]
+    profile = Profile(Symbols(nm, elf_path))
+    proc = subprocess.Popen(cmd[:-1] + TRACE_ARGS + [elf_path],
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    timer = threading.Timer(timeout, proc.kill)
+    timer.start()
+    output = []
+    last_trace = None
+    match_trace = TRACE_RE.match
+    add = profile.add
+    try:
+        for raw in proc.stdout:
+            line = raw.decode("utf-8", errors="replace")
+            m = match_trace(line)
+            if m:
+                add(int(m.group(1), 16), int(m.group(2)) if m.group(2) else None)
+                last_trace = line
+            else:
+                output.append(line)
+        proc.wait()
+    finally:
+        timed_out = not timer.is_alive()
+        timer.cancel()
+    if timed_out:
+        raise subprocess.TimeoutExpired(cmd, timeout)
+    profile.finish()
+    profile.write(base, title)
+    # The final register dump looks like a trace line; keep it for callers
+    # that read the exit code from it
+    if last_trace is not None:
+        output.append(last_trace)
+    return "".join(output), profile
+
+
+def main():
+    import run_picolibc_gtest as rt
+
+    if len(sys.argv) < 2:
+        print(__doc__.strip().splitlines()[-1])
+        return 1
+    elf_path = sys.argv[1]
+    base = Path(sys.argv[2] if len(sys.argv) > 2 else Path(elf_path).with_suffix(""))
+    cmd = [str(rt.EMU), "--system", "--sandbox", rt.get_sandbox_dir(),
+           "-c", str(rt.MAX_CYCLES), "-s", elf_path]
+    output, profile = run_profiled(cmd, str(rt.NM), base, Path(elf_path).name)
+    sys.stdout.write(output)
+    print(f"{profile.total()} {profile.unit} profiled, written to {base}.prof and {base}.folded")
+    rt.cleanup_sandbox()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Function trace decoder for picolibc on M65832
+
+Reads the trace.out written at exit by a program built with
+-finstrument-functions (see <machine/trace.h>), maps the function
+addresses to names using the ELF symbol table and writes three files:
+
+  NAME.timeline  one line per entry and exit, indented by call depth,
+                 with the cycle stamp and the duration of each call
+  NAME.prof      flat profile: self and inclusive cycles of each
+                 function, as written by m65832_profile.py
+  NAME.folded    collapsed stacks weighted by self cycles, ready for
+                 flamegraph.pl or speedscope
+
+The ring only holds the latest calls, so a trace usually starts inside
+functions whose entries were overwritten. Exits without a matching
+entry show which ones, and the replay starts with them on the stack.
+Traces made without a cycle counter have all stamps 0; the timeline
+still shows the call order but the profiles are empty.
+
+Usage: ./m65832_trace.py ELF [TRACE] [NAME]   decode TRACE (default trace.out) into NAME.*
+"""
+
+import struct
+import sys
+from collections import defaultdict
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+from m65832_profile import Profile, Symbols
+
+MAGIC = b"m6tr"
+VERSION = 1
+EXIT = 0x1
+
+HDR = struct.Struct("<4sIII")
+REC = struct.Struct("<II")
+
+
+def read_trace(path: str) -> Tuple[int, List[Tuple[int, int, bool]]]:
+    """(records lost, [(function address, cycles, is_exit)]) with the
+    31-bit stamps unwrapped into a running cycle count."""
+    data = Path(path).read_bytes()
+    magic, version, count, lost = HDR.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f"{path}: not an m65832 trace")
+    recs = []
+    base = 0
+    last = None
+    for i in range(count):
+        fn, stamp = REC.unpack_from(data, HDR.size + i * REC.size)
+        low = stamp >> 1
+        if last is not None and low < last:
+            base += 1 << 31
+        last = low
+        recs.append((fn, base + low, bool(stamp & EXIT)))
+    return lost, recs
+
+
+def open_at_start(recs: List[Tuple[int, int, bool]]) -> List[int]:
+    """Functions already running at the first record, outermost first:
+    those whose exits have no matching entry."""
+    stack: List[int] = []
+    outer: List[int] = []
+    for fn, _, is_exit in recs:
+        if not is_exit:
+            stack.append(fn)
+        elif fn in stack:
+            # Frames above the match were left without an exit (longjmp)
+            del stack[len(stack) - 1 - stack[::-1].index(fn):]
+        else:
+            stack.clear()
+            outer.append(fn)
+    return outer[::-1]
+
+
+def decode(symbols: Symbols, recs: List[Tuple[int, int, bool]],
+           timeline) -> Tuple[Profile, Dict[str, int]]:
+    """Replay the records, writing the timeline and charging the cycles
+    between records to the function on top of the stack."""
+    profile = Profile(symbols)
+    profile.unit = "cycles"
+    calls: Dict[str, int] = defaultdict(int)
+    # Stack of (function address, collapsed stack key, entry cycles or None)
+    stack: List[Tuple[int, str, Optional[int]]] = []
+    for fn in open_at_start(recs):
+        name = symbols.name(symbols.lookup(fn))
+        stack.append((fn, stack[-1][1] + ";" + name if stack else name, None))
+    start = recs[0][1] if recs else 0
+    prev = start
+
+    for fn, cycles, is_exit in recs:
+        if stack:
+            profile.folded[stack[-1][1]] += cycles - prev
+        prev = cycles
+        name = symbols.name(symbols.lookup(fn))
+        if not is_exit:
+            key = stack[-1][1] + ";" + name if stack else name
+            timeline.write(f"{cycles - start:12}  {'  ' * len(stack)}> {name}\n")
+            stack.append((fn, key, cycles))
+            calls[name] += 1
+            continue
+        for depth in range(len(stack) - 1, -1, -1):
+            if stack[depth][0] == fn:
+                break
+        else:
+            # Cannot happen after open_at_start, bar a corrupt trace
+            continue
+        del stack[depth + 1:]
+        entered = stack.pop()[2]
+        took = f"  +{cycles - entered}" if entered is not None else ""
+        timeline.write(f"{cycles - start:12}  {'  ' * len(stack)}< {name}{took}\n")
+    return profile, calls
+
+
+def main():
+    import run_picolibc_gtest as rt
+
+    if len(sys.argv) < 2:
+        print(__doc__.strip().splitlines()[-1])
+        return 1
+    elf_path = sys.argv[1]
+    trace_path = sys.argv[2] if len(sys.argv) > 2 else "trace.out"
+    base = Path(sys.argv[3] if len(sys.argv) > 3 else Path(elf_path).with_suffix(""))
+    lost, recs = read_trace(trace_path)
+    symbols = Symbols(str(rt.NM), elf_path)
+    base.parent.mkdir(parents=True, exist_ok=True)
+    with open(f"{base}.timeline", "w") as timeline:
+        if lost:
+            timeline.write(f"# {lost} earlier records were overwritten\n")
+        profile, calls = decode(symbols, recs, timeline)
+    profile.write(base, Path(elf_path).name)
+    busiest = sorted(calls.items(), key=lambda x: (-x[1], x[0]))[:10]
+    print(f"{len(recs)} records ({lost} lost), {profile.total()} cycles, written to "
+          f"{base}.timeline, {base}.prof and {base}.folded")
+    for name, n in busiest:
+        print(f"{n:10}  {name}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -91,6 +91,67 @@ int sys_semihost_get_cmdline(char *buf, int size);
 #define CONSTRUCTORS 1
 #endif
 
+/* Machines may replace the bulk copy of .data and the clearing of
+ * .bss, e.g. to use block-move instructions or to skip work that a
+ * loader has already done */
+#ifndef CRT0_COPY_DATA
+#define CRT0_COPY_DATA(dst, src, len) memcpy(dst, src, len)
+#endif
+
+#ifndef CRT0_CLEAR_BSS
+#define CRT0_CLEAR_BSS(dst, len) memset(dst, '\0', len)
+#endif
+
+#if !defined(NO_FLASH) && defined(__PICOCRT_COMPRESSED_DATA)
+
+/* Length of the LZ4 block which scripts/picolibc-pack-data has stored
+ * at __data_source in place of the .data image, zero when there is none */
+extern char __data_lz_size[];
+
+#define __data_compressed() (*(const volatile uint32_t *)(void *)__data_lz_size != 0)
+
+/* Expand one LZ4 block into len bytes at dst. The symbol also tells
+ * picolibc-pack-data that this crt0 can handle a packed image */
+void __data_lz4_decode(unsigned char *dst, const unsigned char *src, uintptr_t len);
+
+void __used
+__data_lz4_decode(unsigned char *dst, const unsigned char *src, uintptr_t len)
+{
+    unsigned char *end = dst + len;
+
+    for (;;) {
+        unsigned             token = *src++;
+        uintptr_t            n = token >> 4;
+        unsigned             b;
+        const unsigned char *match;
+
+        if (n == 15)
+            do
+                n += (b = *src++);
+            while (b == 255);
+        while (n--)
+            *dst++ = *src++;
+        if (dst >= end)
+            break;
+
+        match = dst - (src[0] | ((uintptr_t)src[1] << 8));
+        src += 2;
+        n = token & 15;
+        if (n == 15)
+            do
+                n += (b = *src++);
+            while (b == 255);
+        n += 4;
+        while (n--)
+            *dst++ = *match++;
+    }
+}
+#endif
+
+#ifdef __PICOCRT_STACK_PAINT
+#include <picostack.h>
+#endif
+
 #if defined(CRT0_GET_CMDLINE)
 /* Hook for OS to provide command-line */
 int get_cmdline(char *buffer, int size);
@@ -101,13 +162,24 @@ __start(void)
 {
 #ifndef NO_FLASH
     /* Initialize .data from FLASH when enabled */
-    memcpy(__data_start, __data_source, (uintptr_t)__data_size);
+#ifdef __PICOCRT_COMPRESSED_DATA
+    if (__data_compressed())
+        __data_lz4_decode((unsigned char *)__data_start, (const unsigned char *)__data_source,
+                          (uintptr_t)__data_size);
+    else
+#endif
+        CRT0_COPY_DATA(__data_start, __data_source, (uintptr_t)__data_size);
 #endif
-    memset(__bss_start, '\0', (uintptr_t)__bss_size);
+    CRT0_CLEAR_BSS(__bss_start, (uintptr_t)__bss_size);
 #ifdef POST_MEMORY_SETUP
     POST_MEMORY_SETUP();
 #endif
 
+#ifdef __PICOCRT_STACK_PAINT
+    /* Everything from here on counts towards __stack_high_water */
+    __stack_paint();
+#endif
+
 #ifdef __THREAD_LOCAL_STORAGE
 #ifdef INIT_TLS
     _init_tls(__tls_base);
@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * M65832 startup code
+ *
+ * The reset vector or loader sets up the stack and jumps to _start.
+ * .data is copied and .bss cleared with 32-bit accumulator moves, 32
+ * bytes per iteration, without the size and alignment dispatch of
+ * memcpy and memset; the linker script aligns the start of both
+ * segments.
+ *
+ * A loader which has already done part of that work says so in R0:
+ * M65832_BOOT_MAGIC in the upper 24 bits and any of the flags below in
+ * the low byte. Any other value, such as whatever R0 holds after a
+ * watchdog reset, makes _start do everything. .data is also left alone
+ * when it is linked to run where it is loaded.
+ *
+ *   M65832_BOOT_BSS_ZERO     .bss is already zero
+ *   M65832_BOOT_DATA_LOADED  .data already holds its initial values
+ */
+
+#include <stdint.h>
+#include <sys/cdefs.h>
+
+#define M65832_BOOT_MAGIC       0x4d363500
+#define M65832_BOOT_MAGIC_MASK  0xffffff00
+#define M65832_BOOT_BSS_ZERO    0x01
+#define M65832_BOOT_DATA_LOADED 0x02
+
+/* _start does the memory setup itself, before calling __start */
+#define CRT0_COPY_DATA(dst, src, len) ((void)0)
+#define CRT0_CLEAR_BSS(dst, len)      ((void)0)
+
+/*
+ * Seed the stack protector guard as soon as memory is set up, before
+ * any constructor runs with a protected frame; the reference is weak
+ * so programs without protected code do not pull it in.
+ */
+extern void __stack_chk_init(void) __weak;
+
+#if defined(CRT0_SEMIHOST) && defined(__ARM_SEMIHOST) && defined(__PICOCRT_RUNTIME_SIZE)
+#include <machine/heap.h>
+
+/* From <semihost.h>, which is not on the crt0 include path */
+struct sys_semihost_block {
+    void *heap_base;
+    void *heap_limit;
+    void *stack_base;
+    void *stack_limit;
+};
+
+void sys_semihost_heapinfo(struct sys_semihost_block *block);
+
+/*
+ * Hand sbrk the heap the emulator reports, if any. Emulators without
+ * semihosting leave the block zero.
+ */
+static void
+__m65832_crt0_heapinfo(void)
+{
+    struct sys_semihost_block block = { 0 };
+
+    sys_semihost_heapinfo(&block);
+    if (block.heap_base && (uintptr_t)block.heap_limit > (uintptr_t)block.heap_base)
+        __m65832_heap_add(block.heap_base,
+                          (uintptr_t)block.heap_limit - (uintptr_t)block.heap_base,
+                          M65832_HEAP_FAST);
+}
+#define CRT0_HEAPINFO() __m65832_crt0_heapinfo()
+#else
+#define CRT0_HEAPINFO() ((void)0)
+#endif
+
+#ifdef __M65832_ROMLIB
+/*
+ * An image using the shared ROM libc checks the ROM and hands it the
+ * image's heap before anything can call into libc, see
+ * <machine/romlib.h>
+ */
+#include <machine/romlib.h>
+#define CRT0_ROMLIB() __m65832_romlib_init()
+#else
+#define CRT0_ROMLIB() ((void)0)
+#endif
+
+#define POST_MEMORY_SETUP()     \
+    do {                        \
+        CRT0_ROMLIB();          \
+        if (__stack_chk_init)   \
+            __stack_chk_init(); \
+        CRT0_HEAPINFO();        \
+    } while (0)
+
+#include "../../crt0.h"
+
+typedef uint32_t __attribute__((__may_alias__)) m65832_word_t;
+
+static __always_inline __no_builtin void
+__m65832_crt0_copy(void *dst, const void *src, uintptr_t len)
+{
+    m65832_word_t       *wd = dst;
+    const m65832_word_t *ws = src;
+    unsigned char       *bd;
+    const unsigned char *bs;
+
+    while (len >= 32) {
+        wd[0] = ws[0];
+        wd[1] = ws[1];
+        wd[2] = ws[2];
+        wd[3] = ws[3];
+        wd[4] = ws[4];
+        wd[5] = ws[5];
+        wd[6] = ws[6];
+        wd[7] = ws[7];
+        wd += 8;
+        ws += 8;
+        len -= 32;
+    }
+    while (len >= sizeof(m65832_word_t)) {
+        *wd++ = *ws++;
+        len -= sizeof(m65832_word_t);
+    }
+    bd = (unsigned char *)wd;
+    bs = (const unsigned char *)ws;
+    while (len--)
+        *bd++ = *bs++;
+}
+
+static __always_inline __no_builtin void
+__m65832_crt0_clear(void *dst, uintptr_t len)
+{
+    m65832_word_t *wd = dst;
+    unsigned char *bd;
+
+    while (len >= 32) {
+        wd[0] = 0;
+        wd[1] = 0;
+        wd[2] = 0;
+        wd[3] = 0;
+        wd[4] = 0;
+        wd[5] = 0;
+        wd[6] = 0;
+        wd[7] = 0;
+        wd += 8;
+        len -= 32;
+    }
+    while (len >= sizeof(m65832_word_t)) {
+        *wd++ = 0;
+        len -= sizeof(m65832_word_t);
+    }
+    bd = (unsigned char *)wd;
+    while (len--)
+        *bd++ = 0;
+}
+
+void __section(".init") __used
+_start(void)
+{
+    register uint32_t r0 __asm__("r0");
+    uint32_t          boot;
+
+    /* Pick up the loader's value before anything else uses R0 */
+    __asm__ volatile("" : "=r"(r0));
+    boot = r0;
+    if ((boot & M65832_BOOT_MAGIC_MASK) != M65832_BOOT_MAGIC)
+        boot = 0;
+
+#ifndef NO_FLASH
+    /* __start expands a compressed image */
+    if (!(boot & M65832_BOOT_DATA_LOADED) && (uintptr_t)__data_start != (uintptr_t)__data_source
+#ifdef __PICOCRT_COMPRESSED_DATA
+        && !__data_compressed()
+#endif
+        )
+        __m65832_crt0_copy(__data_start, __data_source, (uintptr_t)__data_size);
+#endif
+    if (!(boot & M65832_BOOT_BSS_ZERO))
+        __m65832_crt0_clear(__bss_start, (uintptr_t)__bss_size);
+
+    __start();
+}
@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+"""
+Malloc Trace Replay for M65832
+
+Plays an allocation trace recorded with malloc_trace_start (a picolibc
+build with -Dmalloc-profile=true) back through one or more picolibc
+builds on m65832emu, normally builds of different allocator variants
+(-Dmalloc-free-tree, -Dmalloc-size-bins, -Dmalloc-thread-cache). For
+each build it reports the emulator cycles taken by the replay, the
+peak heap size, the peak of the bytes requested by live blocks and the
+fragmentation, 1 - peak live / peak heap.
+
+The trace is converted to a table in malloc-replay-data.h for
+bench/malloc-replay.c, which is described there; the cycles are those
+of a full replay minus those of a build which replays nothing.
+
+Usage: ./run_malloc_replay.py TRACE [--build=DIR]... [--limit=N] [--json=FILE]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+import run_picolibc_gtest as rt
+from run_picolibc_gtest import BOLD, GREEN, RED, RESET, YELLOW
+
+REPLAY_SRC = rt.PICOLIBC_ROOT / "bench" / "malloc-replay.c"
+REPLAY_DATA = "malloc-replay-data.h"
+REPLAY_RE = re.compile(r"REPLAY (\d+) (\d+) (\d+) (\d+)")
+
+TRACE_MAGIC = b"MTR1"
+# MALLOC_TRACE_ values from malloc.h
+OP_MALLOC, OP_FREE, OP_REALLOC, OP_MEMALIGN, OP_CALLOC = range(5)
+OP_NAMES = ["malloc", "free", "realloc", "memalign", "calloc"]
+
+# REPLAY_NONE in malloc-replay.c
+NONE = 0xFFFFFFFF
+
+
+class TraceError(Exception):
+    pass
+
+
+def decode_trace(data: bytes) -> List[Tuple[int, int, int, int, int]]:
+    """Decode a trace into (op, result, old, size, align) records,
+    with the pointers as integers and 0 for NULL."""
+    if data[:4] != TRACE_MAGIC:
+        raise TraceError("not a malloc trace (bad magic)")
+    pos = 4
+    last = 0
+
+    def num() -> int:
+        nonlocal pos
+        v = 0
+        shift = 0
+        while True:
+            if pos >= len(data):
+                raise TraceError("trace ends inside a record")
+            c = data[pos]
+            pos += 1
+            v |= (c & 0x7F) << shift
+            if not c & 0x80:
+                return v
+            shift += 7
+
+    def ptr() -> int:
+        nonlocal last
+        v = num()
+        if not v:
+            return 0
+        v -= 1
+        last += (v >> 1) ^ -(v & 1)
+        return last
+
+    records = []
+    while pos < len(data):
+        op = data[pos]
+        pos += 1
+        result = ptr()
+        old = size = align = 0
+        if op == OP_FREE:
+            old, result = result, 0
+        elif op == OP_REALLOC:
+            old = ptr()
+            size = num()
+        elif op == OP_MEMALIGN:
+            align = num()
+            size = num()
+        elif op in (OP_MALLOC, OP_CALLOC):
+            size = num()
+        else:
+            raise TraceError(f"unknown operation {op} at offset {pos - 1}")
+        records.append((op, result, old, size, align))
+    return records
+
+
+def assign_slots(records) -> Tuple[List[Tuple[int, int, int, int, int]], int]:
+    """Replace pointers by slot numbers. Returns (ops, number of slots)."""
+    live: Dict[int, int] = {}
+    free_slots: List[int] = []
+    nslots = 0
+    ops = []
+
+    def new_slot(p: int) -> int:
+        nonlocal nslots
+        if free_slots:
+            s = free_slots.pop()
+        else:
+            s = nslots
+            nslots += 1
+        live[p] = s
+        return s
+
+    for op, result, old, size, align in records:
+        old_slot = live.pop(old, NONE) if old else NONE
+        if op == OP_FREE:
+            if old_slot != NONE:
+                free_slots.append(old_slot)
+            ops.append((op, NONE, old_slot, 0, 0))
+            continue
+        if op == OP_REALLOC and old_slot != NONE:
+            if size == 0:
+                free_slots.append(old_slot)
+                slot = NONE
+            else:
+                # Resized or, when it failed, left alone: same slot
+                slot = old_slot
+                live[result or old] = slot
+            ops.append((op, slot, old_slot, size, 0))
+            continue
+        slot = new_slot(result) if result else NONE
+        ops.append((op, slot, old_slot, size & 0xFFFFFFFF, align & 0xFFFFFFFF))
+    return ops, max(nslots, 1)
+
+
+def write_data(path: Path, ops, nslots: int):
+    with open(path, "w") as f:
+        f.write("/* Generated by run_malloc_replay.py */\n\n")
+        f.write(f"#define REPLAY_SLOTS {nslots}\n\n")
+        f.write("static const struct replay_op replay_ops[] = {\n")
+        for op, slot, old, size, align in ops:
+            f.write(f"    {{ {op}, {slot:#x}, {old:#x}, {size}, {align} }},\n")
+        if not ops:
+            f.write(f"    {{ {OP_FREE}, {NONE:#x}, {NONE:#x}, 0, 0 }},\n")
+        f.write("};\n")
+
+
+def build_replay(work_dir: str, tag: str, opt: str, defines: List[str]) -> Tuple[bool, str, str]:
+    """Compile and link malloc-replay.c against rt.PICOLIBC_BUILD."""
+    obj_path = os.path.join(work_dir, f"malloc-replay-{tag}.o")
+    cmd = [
+        str(rt.CLANG),
+        "-target",
+        "m65832-elf",
+        opt,
+        "-ffreestanding",
+        "-fno-builtin",
+        f"-I{rt.PICOLIBC_ROOT}/newlib/libc/include",
+        f"-I{rt.PICOLIBC_ROOT}/libc/include",
+        f"-I{rt.PICOLIBC_BUILD}",
+        f"-I{work_dir}",
+        *[f"-D{d}" for d in defines],
+        "-c",
+        str(REPLAY_SRC),
+        "-o",
+        obj_path,
+    ]
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        return False, "", result.stderr
+    return rt.link_test(obj_path, work_dir)
+
+
+def run_replay(work_dir: str, tag: str, opt: str, defines: List[str]) -> Tuple[Optional[str], str]:
+    """Build and run one replay program. Returns (output, error)."""
+    ok, elf, err = build_replay(work_dir, tag, opt, defines)
+    if not ok:
+        return None, err.strip().splitlines()[-1] if err.strip() else "build failed"
+    try:
+        ok, exit_code, output = rt.run_test(elf)
+    except subprocess.TimeoutExpired:
+        return None, "timeout"
+    if not ok or exit_code != 0:
+        return None, f"run failed (exit {exit_code})"
+    return output, ""
+
+
+def measure(work_dir: str, index: int, opt: str, nops: int) -> Tuple[Optional[dict], str]:
+    """Replay against rt.PICOLIBC_BUILD: cycles, then statistics."""
+    cycles = []
+    for n in (0, nops):
+        output, err = run_replay(work_dir, f"{index}-{n}", opt, [f"REPLAY_OPS={n}"])
+        if output is None:
+            return None, err
+        match = rt.CYCLES_RE.search(output)
+        if not match:
+            return None, "no cycle count in emulator output"
+        cycles.append(int(match.group(1)))
+
+    output, err = run_replay(work_dir, f"{index}-stats", opt, [f"REPLAY_OPS={nops}", "REPLAY_STATS"])
+    if output is None:
+        return None, err
+    match = REPLAY_RE.search(output)
+    if not match:
+        return None, "no REPLAY line in the output"
+    ops, failed, peak_heap, peak_live = (int(g) for g in match.groups())
+    return {
+        "ops": ops,
+        "cycles": cycles[1] - cycles[0],
+        "cycles_per_op": (cycles[1] - cycles[0]) / max(ops, 1),
+        "failed": failed,
+        "peak_heap": peak_heap,
+        "peak_live": peak_live,
+        "fragmentation": 1 - peak_live / peak_heap if peak_heap else 0.0,
+    }, ""
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Replay a malloc trace through picolibc builds on M65832",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s app.mtr                           Replay with $PICOLIBC_BUILD
+  %(prog)s app.mtr --build=../pl-list --build=../pl-bins
+                                             Compare two allocator builds
+  %(prog)s app.mtr --summary                 Only describe the trace
+""",
+    )
+    parser.add_argument("trace", help="Trace written through malloc_trace_start")
+    parser.add_argument("--build", "-b", action="append", default=[],
+                        help="picolibc build directory to replay with (repeatable, "
+                             "default $PICOLIBC_BUILD)")
+    parser.add_argument("--limit", type=int, help="Replay only the first N records")
+    parser.add_argument("--opt", default="-O2", help="Optimization flag for the replay program")
+    parser.add_argument("--summary", action="store_true", help="Describe the trace and exit")
+    parser.add_argument("--json", help="Also write the results to this file")
+    parser.add_argument("--server", action="store_true",
+                        help="Run every build on one long-lived emulator (needs --serve)")
+    args = parser.parse_args()
+
+    try:
+        records = decode_trace(Path(args.trace).read_bytes())
+    except (OSError, TraceError) as e:
+        print(f"{RED}{args.trace}: {e}{RESET}")
+        return 1
+    if args.limit is not None:
+        records = records[:args.limit]
+    ops, nslots = assign_slots(records)
+
+    counts = [0] * len(OP_NAMES)
+    for op, *_ in records:
+        counts[op] += 1
+    print(f"{BOLD}{args.trace}:{RESET} {len(records)} records, at most {nslots} live blocks")
+    print("  " + ", ".join(f"{OP_NAMES[i]} {c}" for i, c in enumerate(counts) if c))
+    if args.summary:
+        return 0
+
+    if args.server:
+        rt.USE_SERVER = rt.server_supported()
+        if not rt.USE_SERVER:
+            print(f"{YELLOW}{rt.EMU} has no --serve mode, starting one emulator per run{RESET}")
+
+    builds = [Path(b).resolve() for b in args.build] or [rt.PICOLIBC_BUILD]
+    results = {}
+    failed = 0
+    with tempfile.TemporaryDirectory() as work_dir:
+        write_data(Path(work_dir) / REPLAY_DATA, ops, nslots)
+        print(f"\n{'build':<32} {'cycles':>12} {'cyc/op':>8} {'peak heap':>10} "
+              f"{'peak live':>10} {'frag':>6}")
+        for index, build in enumerate(builds):
+            rt.PICOLIBC_BUILD = build
+            res, err = measure(work_dir, index, args.opt, len(ops))
+            if res is None:
+                print(f"{RED}[  FAILED  ]{RESET} {build.name} ({err})")
+                failed += 1
+                continue
+            results[str(build)] = res
+            print(f"{build.name:<32} {res['cycles']:>12} {res['cycles_per_op']:>8.1f} "
+                  f"{res['peak_heap']:>10} {res['peak_live']:>10} "
+                  f"{res['fragmentation'] * 100:>5.1f}%")
+            if res["failed"]:
+                print(f"{YELLOW}  {res['failed']} allocations failed during the replay{RESET}")
+
+    if args.json and results:
+        with open(args.json, "w") as f:
+            json.dump({"trace": args.trace, "records": len(records), "results": results}, f, indent=2)
+        print(f"\n{GREEN}Results saved to:{RESET} {args.json}")
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    finally:
+        rt.stop_servers()
+        rt.cleanup_sandbox()
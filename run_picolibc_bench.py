@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+"""
+Picolibc Microbenchmark Runner for M65832
+
+Builds the benchmarks in bench/ against the picolibc build directory,
+runs them on m65832emu and reports emulator cycles per operation and
+per byte. Results are written as JSON to bench-results/ so that two
+commits can be compared.
+
+Usage: ./run_picolibc_bench.py [--filter=PATTERN] [--list] [--compare=FILE] [--profile]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+from datetime import datetime
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+import run_picolibc_gtest as rt
+from run_picolibc_gtest import BOLD, GREEN, RED, RESET, YELLOW
+
+BENCH_DIR = rt.PICOLIBC_ROOT / "bench"
+BENCH_RESULTS_DIR = rt.PICOLIBC_ROOT / "bench-results"
+BENCH_PROFILE_DIR = BENCH_RESULTS_DIR / "profile"
+
+
+def find_bench_files() -> List[Path]:
+    return sorted(BENCH_DIR.glob("bench-*.c"))
+
+
+def compile_bench(src: Path, work_dir: str, tag: str, opt: str,
+                  defines: List[str]) -> Tuple[bool, str, str]:
+    """Compile and link one build of a benchmark. Returns (success, elf_path, error_msg)."""
+    obj_path = os.path.join(work_dir, f"{src.stem}-{tag}.o")
+    includes = [
+        f"-I{rt.PICOLIBC_ROOT}/newlib/libc/include",
+        f"-I{rt.PICOLIBC_ROOT}/libc/include",
+        f"-I{rt.PICOLIBC_BUILD}",
+        f"-I{BENCH_DIR}",
+    ]
+    cmd = [
+        str(rt.CLANG),
+        "-target",
+        "m65832-elf",
+        opt,
+        "-ffreestanding",
+        "-fno-builtin",
+        *includes,
+        *[f"-D{d}" for d in defines],
+        "-c",
+        str(src),
+        "-o",
+        obj_path,
+    ]
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        return False, "", result.stderr
+    return rt.link_test(obj_path, work_dir)
+
+
+def run_elf(elf_path: str, profile_base: Optional[Path] = None) -> Tuple[bool, int, Optional[int], str]:
+    """Run an ELF, profiling it into profile_base if given.
+    Returns (success, exit_code, cycles, output)."""
+    try:
+        success, exit_code, output = rt.run_test(elf_path, profile_base=profile_base)
+    except subprocess.TimeoutExpired:
+        return False, -1, None, "Timeout"
+    match = rt.CYCLES_RE.search(output)
+    cycles = int(match.group(1)) if match else None
+    return success, exit_code, cycles, output
+
+
+def list_cases(src: Path, work_dir: str, opt: str) -> Tuple[List[Tuple[int, str, int, int]], str]:
+    """Build the listing variant of a benchmark file and return its cases."""
+    ok, elf, err = compile_bench(src, work_dir, "list", opt, [])
+    if not ok:
+        return [], err
+    ok, exit_code, _, output = run_elf(elf)
+    if not ok or exit_code != 0:
+        return [], output
+    cases = []
+    for m in re.finditer(r"^BENCH (\d+) (\S+) (\d+) (\d+)", output, re.MULTILINE):
+        cases.append((int(m.group(1)), m.group(2), int(m.group(3)), int(m.group(4))))
+    return cases, ""
+
+
+def run_case(src: Path, work_dir: str, opt: str, index: int, iters: int,
+             profile_base: Optional[Path] = None) -> Tuple[Optional[dict], str]:
+    """Measure one case: a run with no operations and a run with iters operations.
+    With profile_base, the second run is also profiled."""
+    cycles = []
+    for n in (0, iters):
+        ok, elf, err = compile_bench(src, work_dir, f"{index}-{n}", opt,
+                                     [f"BENCH_CASE={index}", f"BENCH_ITERS={n}"])
+        if not ok:
+            return None, err.strip().splitlines()[-1] if err.strip() else "build failed"
+        ok, exit_code, c, output = run_elf(elf, profile_base if n else None)
+        if not ok or exit_code != 0:
+            return None, f"run failed (exit {exit_code})"
+        if c is None:
+            return None, "no cycle count in emulator output"
+        cycles.append(c)
+    return {"base_cycles": cycles[0], "cycles": cycles[1] - cycles[0]}, ""
+
+
+def run_benchmarks(files: List[Path], pattern: Optional["re.Pattern"], opt: str, scale: float,
+                   list_only: bool = False, profile: bool = False) -> Tuple[Dict[str, dict], int]:
+    """Run the cases of files matching pattern against rt.PICOLIBC_BUILD.
+    Returns (results by case name, number of failures)."""
+    results = {}
+    failed = 0
+    with tempfile.TemporaryDirectory() as work_dir:
+        for src in files:
+            group = src.stem[len("bench-"):]
+            cases, err = list_cases(src, work_dir, opt)
+            if not cases:
+                print(f"{RED}[  FAILED  ]{RESET} {group}: could not list cases")
+                if err:
+                    print(f"  {err.strip()[:200]}")
+                failed += 1
+                continue
+            for index, name, nbytes, iters in cases:
+                full = f"{group}.{name}"
+                if pattern and not pattern.search(full):
+                    continue
+                if list_only:
+                    print(f"  {full:40} {nbytes:6} bytes {iters:6} ops")
+                    continue
+                iters = max(1, int(iters * scale))
+                profile_base = BENCH_PROFILE_DIR / full if profile else None
+                res, err = run_case(src, work_dir, opt, index, iters, profile_base)
+                if res is None:
+                    print(f"{RED}[  FAILED  ]{RESET} {full} ({err})")
+                    failed += 1
+                    continue
+                res["iters"] = iters
+                res["bytes"] = nbytes
+                res["cycles_per_op"] = res["cycles"] / iters
+                if nbytes:
+                    res["cycles_per_byte"] = res["cycles_per_op"] / nbytes
+                results[full] = res
+                per_byte = f" {res['cycles_per_byte']:8.2f} cyc/byte" if nbytes else ""
+                print(f"{GREEN}[       OK ]{RESET} {full:40} {res['cycles_per_op']:12.1f} cyc/op{per_byte}")
+    return results, failed
+
+
+def load_results(path: Path) -> Dict[str, dict]:
+    with open(path) as f:
+        return json.load(f)["results"]
+
+
+def git_revision() -> str:
+    result = subprocess.run(["git", "rev-parse", "--short", "HEAD"], cwd=rt.PICOLIBC_ROOT,
+                            capture_output=True, text=True)
+    rev = result.stdout.strip() if result.returncode == 0 else "unknown"
+    result = subprocess.run(["git", "status", "--porcelain", "--untracked-files=no"],
+                            cwd=rt.PICOLIBC_ROOT, capture_output=True, text=True)
+    if result.returncode == 0 and result.stdout.strip():
+        rev += "-dirty"
+    return rev
+
+
+def save_results(doc: dict) -> Path:
+    """Save a result document. Returns the output file path."""
+    BENCH_RESULTS_DIR.mkdir(exist_ok=True)
+    timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
+    output_file = BENCH_RESULTS_DIR / f"bench_{timestamp}_{doc['revision']}.json"
+    with open(output_file, "w") as f:
+        json.dump(doc, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+    latest = BENCH_RESULTS_DIR / "latest.json"
+    if latest.is_symlink():
+        latest.unlink()
+    latest.symlink_to(output_file.name)
+    return output_file
+
+
+def print_comparison(old: Dict[str, dict], new: Dict[str, dict], threshold: float) -> int:
+    """Print per-case changes in cycles per operation. Returns the number of regressions."""
+    regressions = 0
+    print(f"\n{BOLD}{'benchmark':40} {'old':>12} {'new':>12} {'change':>8}{RESET}")
+    for name in sorted(set(old) | set(new)):
+        o = old.get(name, {}).get("cycles_per_op")
+        n = new.get(name, {}).get("cycles_per_op")
+        if o is None or n is None:
+            old_s = f"{o:12.1f}" if o is not None else f"{'-':>12}"
+            new_s = f"{n:12.1f}" if n is not None else f"{'-':>12}"
+            print(f"{name:40} {old_s} {new_s}")
+            continue
+        change = (n - o) * 100.0 / o if o else 0.0
+        color = ""
+        if change > threshold:
+            color = RED
+            regressions += 1
+        elif change < -threshold:
+            color = GREEN
+        print(f"{color}{name:40} {o:12.1f} {n:12.1f} {change:+7.1f}%{RESET}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run picolibc microbenchmarks on M65832",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s                               Run all benchmarks
+  %(prog)s --filter='memcpy*'            Run benchmarks matching 'memcpy*'
+  %(prog)s --file=string                 Run only bench/bench-string.c
+  %(prog)s --compare=bench-results/X.json
+                                         Compare against an earlier run
+  %(prog)s --list                        List all benchmarks
+  %(prog)s --profile --filter='strtod*'  Profile the strtod cases
+""",
+    )
+    parser.add_argument("--filter", "-f", help="Filter benchmarks by pattern (e.g., 'mem*')")
+    parser.add_argument("--file", help="Run only bench/bench-FILE.c")
+    parser.add_argument("--list", "-l", action="store_true", help="List benchmarks without running")
+    parser.add_argument("--scale", type=float, default=1.0,
+                        help="Multiply the default operation counts by this factor")
+    parser.add_argument("--opt", default="-O2", help="Optimization flag for the benchmarks (default -O2)")
+    parser.add_argument("--compare", "-c", help="Result file to compare against")
+    parser.add_argument("--threshold", type=float, default=2.0,
+                        help="Percentage change reported as a regression (default 2)")
+    parser.add_argument("--no-save", action="store_true", help="Do not write a result file")
+    parser.add_argument("--profile", action="store_true",
+                        help="Also write a flat profile and collapsed stacks of each case "
+                             "to bench-results/profile/")
+    parser.add_argument("--server", action="store_true",
+                        help="Run every build on one long-lived emulator (needs --serve)")
+    args = parser.parse_args()
+
+    if args.server:
+        rt.USE_SERVER = rt.server_supported()
+        if not rt.USE_SERVER:
+            print(f"{YELLOW}{rt.EMU} has no --serve mode, starting one emulator per run{RESET}")
+
+    # Read the baseline first; it may be the latest.json that this run replaces
+    baseline = load_results(Path(args.compare)) if args.compare else None
+
+    files = find_bench_files()
+    if args.file:
+        files = [f for f in files if f.stem == f"bench-{args.file}"]
+    pattern = re.compile(args.filter.replace("*", ".*"), re.IGNORECASE) if args.filter else None
+
+    results, failed = run_benchmarks(files, pattern, args.opt, args.scale,
+                                     list_only=args.list, profile=args.profile)
+    if args.list:
+        return 0
+
+    doc = {
+        "revision": git_revision(),
+        "date": datetime.now().isoformat(timespec="seconds"),
+        "opt": args.opt,
+        "scale": args.scale,
+        "results": results,
+    }
+    if not args.no_save and results:
+        output_file = save_results(doc)
+        print(f"\n{BOLD}Results saved to:{RESET} {output_file}")
+
+    regressions = 0
+    if baseline is not None:
+        regressions = print_comparison(baseline, results, args.threshold)
+        if regressions:
+            print(f"\n{YELLOW}{regressions} benchmark(s) slower by more than {args.threshold}%{RESET}")
+
+    return 1 if failed or regressions else 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    finally:
+        rt.stop_servers()
+        rt.cleanup_sandbox()
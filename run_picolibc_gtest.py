@@ -3,7 +3,8 @@
 Picolibc Test Suite Runner for M65832
 Outputs in Google Test (gtest) format
 
-Usage: ./run_picolibc_gtest.py [--filter=PATTERN] [--list] [--verbose] [--no-rebuild]
+Usage: ./run_picolibc_gtest.py [--filter=PATTERN] [--list] [--verbose] [--no-rebuild] [-j N]
+                              [--cycle-threshold=PCT] [--update-baseline] [--profile]
 """
 
 import os
@@ -13,12 +14,19 @@ import tempfile
 import shutil
 import time
 import argparse
+import hashlib
+import json
 import re
+import select
+import threading
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 from dataclasses import dataclass
-from typing import List, Optional, Tuple
+from typing import Dict, List, Optional, Tuple
 from datetime import datetime
 
+import m65832_profile
+
 # Paths
 PICOLIBC_ROOT = Path(__file__).resolve().parent
 PROJECTS_ROOT = PICOLIBC_ROOT.parent
@@ -34,6 +42,7 @@ LLVM_BUILD = Path(
 )
 CLANG = LLVM_BUILD / "clang"
 LLD = LLVM_BUILD / "ld.lld"
+NM = LLVM_BUILD / "llvm-nm"
 EMU = PROJECTS_ROOT / "m65832" / "emu" / "m65832emu"
 SYSROOT = PROJECTS_ROOT / "m65832-sysroot"
 # Use picolibc build directory for libs/crt instead of sysroot (allows testing WIP builds)
@@ -44,6 +53,16 @@ CUSTOM_TESTS = PROJECTS_ROOT / "m65832" / "emu" / "c_tests" / "baremetal" / "pic
 COMPILER_RT_DIR = LLVM_ROOT / "m65832-stdlib" / "compiler-rt"
 # Test results directory for saving timestamped outputs
 TEST_RESULTS_DIR = PICOLIBC_ROOT / "test-results"
+# Emulator cycles of every passing test, compared against each run
+CYCLES_BASELINE = TEST_RESULTS_DIR / "cycles_baseline.json"
+# Flat profiles and collapsed stacks written with --profile
+PROFILE_DIR = TEST_RESULTS_DIR / "profile"
+# Cached test objects and ELFs, reused while their inputs are unchanged
+TEST_CACHE_DIR = Path(os.environ.get("TEST_CACHE_DIR", str(PICOLIBC_ROOT / "test-cache")))
+# Extra libraries for every test link, e.g. the profile runtime for PGO training
+EXTRA_LINK_LIBS = os.environ.get("PICOLIBC_LINK_LIBS", "").split()
+# Sandbox kept after the run, so files the tests write can be collected
+KEEP_SANDBOX_DIR = os.environ.get("M65832_SANDBOX")
 
 # Colors (gtest style)
 GREEN = "\033[32m"
@@ -54,16 +73,21 @@ RESET = "\033[0m"
 
 MAX_CYCLES = 500000000  # 500M - many picolibc tests have 100K+ iterations
 
+# The emulator prints its statistics with -s; the cycle count is taken
+# from the first line that matches this
+CYCLES_RE = re.compile(r"[Cc]ycles\s*[:=]\s*([0-9]+)")
+
 
-def rebuild_compiler_rt() -> bool:
+def rebuild_compiler_rt(clean: bool = False) -> bool:
     """Rebuild compiler-rt library. Returns True on success."""
     print(f"{BOLD}Rebuilding compiler-rt...{RESET}")
-    result = subprocess.run(
-        ["make", "clean"],
-        cwd=COMPILER_RT_DIR,
-        capture_output=True,
-        text=True
-    )
+    if clean:
+        result = subprocess.run(
+            ["make", "clean"],
+            cwd=COMPILER_RT_DIR,
+            capture_output=True,
+            text=True
+        )
     result = subprocess.run(
         ["make", "-j8"],
         cwd=COMPILER_RT_DIR,
@@ -78,42 +102,60 @@ def rebuild_compiler_rt() -> bool:
     return True
 
 
-def rebuild_picolibc() -> bool:
-    """Clean rebuild picolibc using meson. Returns True on success."""
+def rebuild_picolibc(clean: bool = False, options: List[str] = []) -> bool:
+    """Rebuild picolibc using meson. An existing build directory is reused
+    unless clean is set; options (-Dname=value) are applied to it on top
+    of the defaults below. Returns True on success."""
     import shutil
     
-    print(f"{BOLD}Rebuilding picolibc (clean build)...{RESET}")
+    print(f"{BOLD}Rebuilding picolibc{' (clean build)' if clean else ''}...{RESET}")
     
     # Cross-compilation file
     cross_file = LLVM_ROOT / "m65832-stdlib" / "picolibc" / "cross-m65832.txt"
     
     # Remove old build directory for clean build
-    if PICOLIBC_BUILD.exists():
+    if clean and PICOLIBC_BUILD.exists():
         print(f"  Removing old build: {PICOLIBC_BUILD}")
         shutil.rmtree(PICOLIBC_BUILD)
     
-    # Reconfigure with meson
-    print(f"  Configuring with meson...")
-    result = subprocess.run(
-        [
-            "meson", "setup", str(PICOLIBC_BUILD), str(PICOLIBC_ROOT),
-            f"--cross-file={cross_file}",
-            "--buildtype=plain",
-            "-Ddebug=false",
-            "-Doptimization=1",
-            "-Dmultilib=false",
-            "-Dtests=false",
-            "-Dspecsdir=none",
-            "-Dfreestanding=true",
-            "-Dio-float-exact=false",  # Disable dtoa_ryu.c which causes regalloc crash
-        ],
-        capture_output=True,
-        text=True
-    )
-    if result.returncode != 0:
-        print(f"{RED}Failed to configure picolibc:{RESET}")
-        print(result.stderr)
-        return False
+    # Configure with meson unless there is a configured build to reuse;
+    # ninja re-runs meson by itself when the build files change
+    if not (PICOLIBC_BUILD / "build.ninja").exists():
+        print(f"  Configuring with meson...")
+        result = subprocess.run(
+            [
+                "meson", "setup", str(PICOLIBC_BUILD), str(PICOLIBC_ROOT),
+                f"--cross-file={cross_file}",
+                "--buildtype=plain",
+                "-Ddebug=false",
+                "-Doptimization=1",
+                "-Dmultilib=false",
+                "-Dtests=false",
+                "-Dspecsdir=none",
+                "-Dfreestanding=true",
+                "-Dfast-bufio=true",
+                "-Dfstat-bufsiz=true",
+                "-Dio-float-exact=false",  # Disable dtoa_ryu.c which causes regalloc crash
+                "-Dopt-profile=balanced",
+                *options,
+            ],
+            capture_output=True,
+            text=True
+        )
+        if result.returncode != 0:
+            print(f"{RED}Failed to configure picolibc:{RESET}")
+            print(result.stderr)
+            return False
+    elif options:
+        result = subprocess.run(
+            ["meson", "configure", str(PICOLIBC_BUILD), *options],
+            capture_output=True,
+            text=True
+        )
+        if result.returncode != 0:
+            print(f"{RED}Failed to configure picolibc:{RESET}")
+            print(result.stderr)
+            return False
     
     # Build with ninja
     print(f"  Building with ninja...")
@@ -184,6 +226,7 @@ class TestResult:
     error_msg: Optional[str] = None
     skipped: bool = False
     skip_reason: Optional[str] = None
+    cycles: Optional[int] = None
 
 
 def extract_expected_value(filepath: str) -> Optional[int]:
@@ -283,8 +326,157 @@ def find_test_files() -> List[Tuple[str, str, str]]:
 USE_SYSROOT = False
 
 
+class BuildCache:
+    """Cache of test objects and ELFs.
+
+    An object is keyed by its compile command and source file. The
+    headers it read, taken from the compiler's dependency output, are
+    recorded with their hashes and checked on each lookup. An ELF is
+    keyed by its link command with every input file (objects, crt0,
+    linker script and the libraries found through -L/-l) replaced by
+    its hash, so rebuilding libc.a relinks every test but recompiles
+    none of them.
+    """
+
+    def __init__(self, root: Path):
+        self.root = root
+        (root / "obj").mkdir(parents=True, exist_ok=True)
+        (root / "elf").mkdir(parents=True, exist_ok=True)
+        self._hashes = {}
+        self._lock = threading.Lock()
+        self.hits = 0
+        self.misses = 0
+
+    def file_hash(self, path: str) -> str:
+        """Hash a file's contents, remembering it for as long as the file is unchanged."""
+        try:
+            st = os.stat(path)
+        except OSError:
+            return "missing"
+        memo = (path, st.st_mtime_ns, st.st_size)
+        with self._lock:
+            if memo in self._hashes:
+                return self._hashes[memo]
+        h = hashlib.sha256()
+        with open(path, "rb") as f:
+            for block in iter(lambda: f.read(1 << 20), b""):
+                h.update(block)
+        digest = h.hexdigest()
+        with self._lock:
+            self._hashes[memo] = digest
+        return digest
+
+    @staticmethod
+    def _key(parts: List[str]) -> str:
+        return hashlib.sha256("\0".join(parts).encode()).hexdigest()
+
+    def _count(self, hit: bool):
+        with self._lock:
+            if hit:
+                self.hits += 1
+            else:
+                self.misses += 1
+
+    @staticmethod
+    def _store(src: str, dst: Path):
+        """Copy a file into the cache; the rename keeps concurrent readers safe."""
+        tmp = dst.with_name(f"{dst.name}.{os.getpid()}.{threading.get_ident()}.tmp")
+        shutil.copy(src, tmp)
+        os.replace(tmp, dst)
+
+    @staticmethod
+    def _parse_depfile(path: str) -> List[str]:
+        with open(path) as f:
+            text = f.read().replace("\\\n", " ")
+        _, _, deps = text.partition(": ")
+        return [d for d in deps.split() if d]
+
+    def compile(self, cmd: List[str], src_path: str, obj_path: str) -> Tuple[bool, str]:
+        """Compile with cmd (which must not name the output) into obj_path."""
+        key = self._key(cmd + [self.file_hash(src_path)])
+        entry = self.root / "obj" / f"{key}.o"
+        manifest = self.root / "obj" / f"{key}.deps"
+
+        if entry.exists() and manifest.exists():
+            try:
+                with open(manifest) as f:
+                    deps = json.load(f)
+                if all(self.file_hash(p) == h for p, h in deps.items()):
+                    shutil.copyfile(entry, obj_path)
+                    self._count(True)
+                    return True, ""
+            except (OSError, ValueError):
+                pass
+
+        self._count(False)
+        dep_file = obj_path + ".d"
+        result = subprocess.run(cmd + ["-MD", "-MF", dep_file, "-o", obj_path],
+                                capture_output=True, text=True)
+        if result.returncode != 0:
+            return False, result.stderr
+        try:
+            deps = {p: self.file_hash(p) for p in self._parse_depfile(dep_file)}
+            self._store(obj_path, entry)
+            tmp = manifest.with_name(f"{manifest.name}.{os.getpid()}.{threading.get_ident()}.tmp")
+            with open(tmp, "w") as f:
+                json.dump(deps, f)
+            os.replace(tmp, manifest)
+        except OSError:
+            pass
+        return True, ""
+
+    def link(self, cmd: List[str], elf_path: str) -> Tuple[bool, str]:
+        """Link with cmd (which must not name the output) into elf_path."""
+        lib_dirs = [a[2:] for a in cmd if a.startswith("-L")]
+        parts = []
+        for a in cmd:
+            if a.startswith("-T"):
+                parts.append("-T" + self.file_hash(a[2:]))
+            elif a.startswith("-l"):
+                lib = next((os.path.join(d, f"lib{a[2:]}.a") for d in lib_dirs
+                            if os.path.isfile(os.path.join(d, f"lib{a[2:]}.a"))), None)
+                parts.append(a + "=" + (self.file_hash(lib) if lib else "missing"))
+            elif a.startswith("-L"):
+                continue
+            elif os.path.isfile(a):
+                parts.append(self.file_hash(a))
+            else:
+                parts.append(a)
+        entry = self.root / "elf" / f"{self._key(parts)}.elf"
+
+        if entry.exists():
+            shutil.copy(entry, elf_path)
+            self._count(True)
+            return True, ""
+
+        self._count(False)
+        result = subprocess.run(cmd + ["-o", elf_path], capture_output=True, text=True)
+        if result.returncode != 0:
+            return False, result.stderr
+        try:
+            self._store(elf_path, entry)
+        except OSError:
+            pass
+        return True, ""
+
+
+# Set by main() unless --no-cache is given
+BUILD_CACHE: Optional[BuildCache] = None
+# Set by main() with --profile
+PROFILE = False
+
+
+# Serializes _build_m65832_runtime when tests are linked in parallel
+_RUNTIME_LOCK = threading.Lock()
+
+
 def _build_m65832_runtime(build_dir: Path, picolibc_dir: Path):
     """Build M65832-specific runtime files (crt0.o, libsys.a) into build dir on demand."""
+    with _RUNTIME_LOCK:
+        _build_m65832_runtime_locked(build_dir, picolibc_dir)
+
+
+def _build_m65832_runtime_locked(build_dir: Path, picolibc_dir: Path):
     crt0_path = build_dir / "m65832-crt0.o"
     libsys_path = build_dir / "libsys.a"
 
@@ -343,11 +535,13 @@ def compile_test(src_path: str, work_dir: str) -> Tuple[bool, str, str]:
         *includes,
         "-c",
         src_path,
-        "-o",
-        obj_path,
     ]
 
-    result = subprocess.run(cmd, capture_output=True, text=True)
+    if BUILD_CACHE is not None:
+        success, err = BUILD_CACHE.compile(cmd, src_path, obj_path)
+        return success, obj_path if success else "", err
+
+    result = subprocess.run(cmd + ["-o", obj_path], capture_output=True, text=True)
     if result.returncode != 0:
         return False, "", result.stderr
     return True, obj_path, ""
@@ -369,8 +563,6 @@ def link_test(obj_path: str, work_dir: str) -> Tuple[bool, str, str]:
             "-lc",
             "-lsys",
             "-lcompiler_rt",
-            "-o",
-            elf_path,
         ]
     else:
         # Use freshly built picolibc and compiler-rt from build directories
@@ -388,12 +580,15 @@ def link_test(obj_path: str, work_dir: str) -> Tuple[bool, str, str]:
             f"-L{COMPILER_RT_DIR}",
             "-lsys",          # Our baremetal overrides first (e.g. _exit)
             "-lc",            # Then picolibc
+            *EXTRA_LINK_LIBS,
             "-lcompiler_rt",
-            "-o",
-            elf_path,
         ]
 
-    result = subprocess.run(cmd, capture_output=True, text=True)
+    if BUILD_CACHE is not None:
+        success, err = BUILD_CACHE.link(cmd, elf_path)
+        return success, elf_path if success else "", err
+
+    result = subprocess.run(cmd + ["-o", elf_path], capture_output=True, text=True)
     if result.returncode != 0:
         return False, "", result.stderr
     return True, elf_path, ""
@@ -406,22 +601,132 @@ def get_sandbox_dir() -> str:
     """Get (or create) the shared sandbox directory for this test run."""
     global _SANDBOX_DIR
     if _SANDBOX_DIR is None:
-        _SANDBOX_DIR = tempfile.mkdtemp(prefix="m65832_sandbox_")
+        if KEEP_SANDBOX_DIR:
+            os.makedirs(KEEP_SANDBOX_DIR, exist_ok=True)
+            _SANDBOX_DIR = KEEP_SANDBOX_DIR
+        else:
+            _SANDBOX_DIR = tempfile.mkdtemp(prefix="m65832_sandbox_")
     return _SANDBOX_DIR
 
 def cleanup_sandbox():
     """Remove the sandbox directory at the end of the test run."""
     global _SANDBOX_DIR
-    if _SANDBOX_DIR and os.path.isdir(_SANDBOX_DIR):
+    if _SANDBOX_DIR and _SANDBOX_DIR != KEEP_SANDBOX_DIR and os.path.isdir(_SANDBOX_DIR):
         shutil.rmtree(_SANDBOX_DIR, ignore_errors=True)
     _SANDBOX_DIR = None
 
-def run_test(elf_path: str) -> Tuple[bool, int, str]:
+# With --server, each worker thread keeps one emulator running and sends
+# it test after test instead of starting a process per test. The
+# emulator reads one request per line on stdin, tab separated:
+#
+#   run<TAB>CYCLES<TAB>SANDBOX<TAB>ELF
+#
+# resets the machine, loads ELF and prints what a --system -s run would,
+# followed by a line holding only SERVER_END.
+SERVER_END = b"@@end"
+SERVER_TIMEOUT = 60
+USE_SERVER = False
+_SERVER_LOCAL = threading.local()
+_SERVERS: List["EmulatorServer"] = []
+_SERVERS_LOCK = threading.Lock()
+
+
+class EmulatorServer:
+    """One m65832emu --serve process."""
+
+    def __init__(self):
+        self.proc = subprocess.Popen(
+            [str(EMU), "--system", "--serve", "-s"],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.STDOUT,
+        )
+
+    def alive(self) -> bool:
+        return self.proc.poll() is None
+
+    def run(self, elf_path: str, sandbox_dir: str) -> Tuple[Optional[bytes], bool]:
+        """Run one ELF. Returns (output, timed_out); output is None when the
+        server stopped or timed out, which also shuts it down."""
+        request = f"run\t{MAX_CYCLES}\t{sandbox_dir}\t{elf_path}\n"
+        try:
+            self.proc.stdin.write(request.encode())
+            self.proc.stdin.flush()
+        except OSError:
+            self.close()
+            return None, False
+
+        fd = self.proc.stdout.fileno()
+        deadline = time.time() + SERVER_TIMEOUT
+        end = b"\n" + SERVER_END + b"\n"
+        buf = b"\n"
+        while True:
+            pos = buf.find(end)
+            if pos >= 0:
+                return buf[1:pos + 1], False
+            remaining = deadline - time.time()
+            if remaining <= 0:
+                self.close()
+                return None, True
+            ready, _, _ = select.select([fd], [], [], remaining)
+            if not ready:
+                continue
+            chunk = os.read(fd, 65536)
+            if not chunk:
+                self.close()
+                return None, False
+            buf += chunk
+
+    def close(self):
+        if self.alive():
+            self.proc.kill()
+        self.proc.wait()
+
+
+def server_supported() -> bool:
+    """Whether the emulator understands --serve."""
+    try:
+        result = subprocess.run([str(EMU), "--help"], capture_output=True, timeout=10)
+    except (OSError, subprocess.TimeoutExpired):
+        return False
+    return b"--serve" in result.stdout + result.stderr
+
+
+def run_on_server(elf_path: str, sandbox_dir: str) -> Optional[str]:
+    """Run a test on this thread's emulator server. Returns None when the
+    test should be run in a process of its own instead."""
+    server = getattr(_SERVER_LOCAL, "server", None)
+    if server is None or not server.alive():
+        server = EmulatorServer()
+        _SERVER_LOCAL.server = server
+        with _SERVERS_LOCK:
+            _SERVERS.append(server)
+    output, timed_out = server.run(elf_path, sandbox_dir)
+    if timed_out:
+        return f"Timeout after {SERVER_TIMEOUT}s on the emulator server"
+    if output is None:
+        # The server went away, maybe because of this test; a fresh one
+        # is started for the next test
+        return None
+    return output.decode("utf-8", errors="replace")
+
+
+def stop_servers():
+    with _SERVERS_LOCK:
+        for server in _SERVERS:
+            server.close()
+        _SERVERS.clear()
+
+
+def run_test(elf_path: str, sandbox_dir: Optional[str] = None,
+             profile_base: Optional[Path] = None) -> Tuple[bool, int, str]:
     """Run a test on the emulator using system mode with sandbox for real I/O.
-    Returns (success, exit_code, output)."""
+    With profile_base, the run is traced and profiled into profile_base.prof
+    and profile_base.folded. Returns (success, exit_code, output)."""
     # Use system mode with sandbox so TRAP syscalls (I/O, exit) work properly.
     # The sandbox provides a filesystem root and routes stdout/stderr to host.
-    sandbox_dir = get_sandbox_dir()
+    if sandbox_dir is None:
+        sandbox_dir = get_sandbox_dir()
     cmd = [
         str(EMU),
         "--system",
@@ -431,12 +736,18 @@ def run_test(elf_path: str) -> Tuple[bool, int, str]:
         elf_path,
     ]
 
-    result = subprocess.run(cmd, capture_output=True, timeout=60)
-    # Handle possible binary output from emulator
-    try:
-        output = result.stdout.decode('utf-8', errors='replace') + result.stderr.decode('utf-8', errors='replace')
-    except:
-        output = str(result.stdout) + str(result.stderr)
+    output = None
+    if profile_base is not None:
+        output, _ = m65832_profile.run_profiled(cmd, str(NM), profile_base, Path(elf_path).stem)
+    elif USE_SERVER:
+        output = run_on_server(elf_path, sandbox_dir)
+    if output is None:
+        result = subprocess.run(cmd, capture_output=True, timeout=60)
+        # Handle possible binary output from emulator
+        try:
+            output = result.stdout.decode('utf-8', errors='replace') + result.stderr.decode('utf-8', errors='replace')
+        except:
+            output = str(result.stdout) + str(result.stderr)
 
     # In system mode, EXIT: field shows the exit code from SYS_EXIT syscall
     match = re.search(r"EXIT:\s*([0-9A-Fa-f]+)", output)
@@ -453,7 +764,20 @@ def run_test(elf_path: str) -> Tuple[bool, int, str]:
     return False, -1, output
 
 
-def run_single_test(suite: str, src_path: str, work_dir: str) -> TestResult:
+def run_isolated_test(suite: str, src_path: str, work_dir: str) -> TestResult:
+    """Run a single test with its own build and sandbox directories, so that
+    several tests can run at the same time."""
+    test_dir = tempfile.mkdtemp(prefix=f"{suite}_{Path(src_path).stem}_", dir=work_dir)
+    sandbox_dir = tempfile.mkdtemp(prefix="m65832_sandbox_")
+    try:
+        return run_single_test(suite, src_path, test_dir, sandbox_dir)
+    finally:
+        shutil.rmtree(sandbox_dir, ignore_errors=True)
+        shutil.rmtree(test_dir, ignore_errors=True)
+
+
+def run_single_test(suite: str, src_path: str, work_dir: str,
+                    sandbox_dir: Optional[str] = None) -> TestResult:
     """Run a single test and return result."""
     name = Path(src_path).stem
     start_time = time.time()
@@ -533,8 +857,11 @@ def run_single_test(suite: str, src_path: str, work_dir: str) -> TestResult:
 
     # Run
     try:
-        success, exit_code, output = run_test(elf_path)
+        profile_base = PROFILE_DIR / f"{suite}.{name}" if PROFILE else None
+        success, exit_code, output = run_test(elf_path, sandbox_dir, profile_base)
         elapsed = (time.time() - start_time) * 1000
+        match = CYCLES_RE.search(output)
+        cycles = int(match.group(1)) if match else None
 
         # DEBUG: Show raw results for debugging
         if os.environ.get("M65832_DEBUG"):
@@ -556,7 +883,8 @@ def run_single_test(suite: str, src_path: str, work_dir: str) -> TestResult:
         if expected is not None:
             # Test has explicit expected value
             if exit_code == expected:
-                return TestResult(name=name, suite=suite, passed=True, time_ms=elapsed)
+                return TestResult(name=name, suite=suite, passed=True, time_ms=elapsed,
+                                  cycles=cycles)
             else:
                 return TestResult(
                     name=name,
@@ -568,7 +896,8 @@ def run_single_test(suite: str, src_path: str, work_dir: str) -> TestResult:
         else:
             # Standard: exit_code 0 = pass, 77 = skip (autotools convention), non-zero = fail
             if exit_code == 0:
-                return TestResult(name=name, suite=suite, passed=True, time_ms=elapsed)
+                return TestResult(name=name, suite=suite, passed=True, time_ms=elapsed,
+                                  cycles=cycles)
             elif exit_code == 77:
                 return TestResult(
                     name=name,
@@ -616,9 +945,10 @@ def print_gtest_run(suite: str, name: str, desc: str = ""):
         print(f"{GREEN}[ RUN      ]{RESET} {suite}.{name}")
 
 
-def print_gtest_ok(suite: str, name: str, time_ms: float):
+def print_gtest_ok(suite: str, name: str, time_ms: float, cycles: Optional[int] = None):
     """Print gtest-style test pass."""
-    print(f"{GREEN}[       OK ]{RESET} {suite}.{name} ({time_ms:.0f} ms)")
+    cycles_s = f", {cycles} cycles" if cycles is not None else ""
+    print(f"{GREEN}[       OK ]{RESET} {suite}.{name} ({time_ms:.0f} ms{cycles_s})")
 
 
 def print_gtest_failed(suite: str, name: str, time_ms: float, msg: str = ""):
@@ -662,6 +992,46 @@ def print_gtest_footer(results: List[TestResult], total_time: float):
         print(f" {failed} FAILED TEST{'S' if failed != 1 else ''}")
 
 
+def load_cycles(path: Path) -> Dict[str, int]:
+    """Read a cycle file written by save_cycles."""
+    try:
+        with open(path) as f:
+            return json.load(f)["cycles"]
+    except (OSError, ValueError, KeyError):
+        return {}
+
+
+def save_cycles(path: Path, cycles: Dict[str, int]):
+    """Write per-test cycle counts, keyed by suite.name."""
+    path.parent.mkdir(exist_ok=True)
+    doc = {"date": datetime.now().isoformat(timespec="seconds"), "cycles": cycles}
+    tmp = path.with_name(path.name + ".tmp")
+    with open(tmp, "w") as f:
+        json.dump(doc, f, indent=2, sort_keys=True)
+        f.write("\n")
+    os.replace(tmp, path)
+
+
+def result_cycles(results: List[TestResult]) -> Dict[str, int]:
+    """Cycle counts of the passing tests in a run."""
+    return {f"{r.suite}.{r.name}": r.cycles for r in results if r.passed and r.cycles is not None}
+
+
+def compare_cycles(baseline: Dict[str, int], current: Dict[str, int],
+                   threshold: float) -> List[Tuple[str, int, int, float]]:
+    """Return (test, baseline, current, change %) for every test slower than
+    the baseline by more than threshold percent."""
+    regressions = []
+    for name, new in sorted(current.items()):
+        old = baseline.get(name)
+        if not old:
+            continue
+        change = (new - old) * 100.0 / old
+        if change > threshold:
+            regressions.append((name, old, new, change))
+    return regressions
+
+
 def save_results(output: str, results: List[TestResult]) -> str:
     """Save timestamped test results. Returns the output file path."""
     TEST_RESULTS_DIR.mkdir(exist_ok=True)
@@ -692,12 +1062,19 @@ def save_results(output: str, results: List[TestResult]) -> str:
         latest_summary.unlink()
     latest_link.symlink_to(output_file.name)
     latest_summary.symlink_to(summary_file.name)
+
+    # And the cycle counts, for comparing two runs by hand
+    save_cycles(TEST_RESULTS_DIR / f"cycles_{timestamp}.json", result_cycles(results))
+    latest_cycles = TEST_RESULTS_DIR / "latest_cycles.json"
+    if latest_cycles.is_symlink():
+        latest_cycles.unlink()
+    latest_cycles.symlink_to(f"cycles_{timestamp}.json")
     
     return str(output_file)
 
 
 def main():
-    global USE_SYSROOT
+    global USE_SYSROOT, BUILD_CACHE, PROFILE, USE_SERVER
     
     parser = argparse.ArgumentParser(
         description="Run picolibc tests on M65832",
@@ -713,6 +1090,11 @@ Examples:
   %(prog)s --list                   List all available tests
   %(prog)s --list --suite=picolibc  List tests in picolibc suite
   %(prog)s --no-rebuild             Skip rebuilding libraries (use existing build dir)
+  %(prog)s --clean                  Clean rebuild of the libraries and every test
+  %(prog)s -j 8                     Build and run 8 tests at a time
+  %(prog)s --server                 Run the tests on long-lived emulator processes
+  %(prog)s --update-baseline        Record this run's cycle counts as the baseline
+  %(prog)s --profile malloc         Profile test 'malloc' into test-results/profile/
 """,
     )
     parser.add_argument("tests", nargs="*", help="Specific test names to run")
@@ -722,10 +1104,37 @@ Examples:
     parser.add_argument("--verbose", "-v", action="store_true", help="Verbose output")
     parser.add_argument("--no-rebuild", action="store_true", help="Skip rebuilding compiler-rt and picolibc")
     parser.add_argument("--use-sysroot", action="store_true", help="Use sysroot picolibc instead of rebuilding")
+    parser.add_argument("--clean", action="store_true",
+                        help="Rebuild compiler-rt and picolibc from scratch and ignore cached test builds")
+    parser.add_argument("--no-cache", action="store_true", help="Do not use or update the test build cache")
+    parser.add_argument("--jobs", "-j", type=int, default=1,
+                        help="Number of tests to build and run at once (0 = one per CPU)")
+    parser.add_argument("--cycle-baseline", default=str(CYCLES_BASELINE),
+                        help="Cycle baseline file (default test-results/cycles_baseline.json)")
+    parser.add_argument("--cycle-threshold", type=float, default=5.0,
+                        help="Percentage cycle increase reported as a regression (default 5)")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Store the cycle counts of the passing tests in the baseline")
+    parser.add_argument("--server", action="store_true",
+                        help="Keep one emulator per job running and load every test into it "
+                             "(needs an emulator with --serve)")
+    parser.add_argument("--profile", action="store_true",
+                        help="Trace each test and write a flat profile and collapsed stacks "
+                             "to test-results/profile/")
     args = parser.parse_args()
     
     # Set global flag for sysroot mode
     USE_SYSROOT = args.use_sysroot
+    PROFILE = args.profile
+    if args.server:
+        USE_SERVER = server_supported()
+        if not USE_SERVER:
+            print(f"{YELLOW}{EMU} has no --serve mode, starting one emulator per test{RESET}")
+
+    if not args.no_cache:
+        if args.clean and TEST_CACHE_DIR.exists():
+            shutil.rmtree(TEST_CACHE_DIR)
+        BUILD_CACHE = BuildCache(TEST_CACHE_DIR)
 
     # Find all tests
     all_tests = find_test_files()
@@ -783,10 +1192,10 @@ Examples:
         print(f"\n{BOLD}=== Using sysroot picolibc (no rebuild) ==={RESET}\n")
     elif not args.no_rebuild:
         print(f"\n{BOLD}=== Rebuilding libraries to match current compiler ==={RESET}\n")
-        if not rebuild_compiler_rt():
+        if not rebuild_compiler_rt(args.clean):
             print(f"{RED}Aborting: compiler-rt build failed{RESET}")
             return 1
-        if not rebuild_picolibc():
+        if not rebuild_picolibc(args.clean):
             print(f"{RED}Aborting: picolibc build failed{RESET}")
             return 1
         print()
@@ -810,6 +1219,18 @@ Examples:
         print_gtest_header(len(all_tests))
         print()
 
+        # With -j, every test is queued up front and runs in its own build
+        # and sandbox directories; results are still reported in order.
+        jobs = args.jobs if args.jobs > 0 else (os.cpu_count() or 1)
+        executor = None
+        futures = {}
+        if jobs > 1:
+            executor = ThreadPoolExecutor(max_workers=jobs)
+            for suite_name, test_items in sorted(suites.items()):
+                for src_path, desc in test_items:
+                    futures[src_path] = executor.submit(run_isolated_test, suite_name, src_path,
+                                                        work_dir)
+
         for suite_name, test_items in sorted(suites.items()):
             suite_start = time.time()
             print_gtest_suite_start(suite_name, len(test_items))
@@ -819,13 +1240,16 @@ Examples:
 
                 print_gtest_run(suite_name, name, desc)
 
-                result = run_single_test(suite_name, src_path, work_dir)
+                if executor:
+                    result = futures[src_path].result()
+                else:
+                    result = run_single_test(suite_name, src_path, work_dir)
                 results.append(result)
 
                 if result.skipped:
                     print_gtest_skipped(suite_name, name, result.skip_reason)
                 elif result.passed:
-                    print_gtest_ok(suite_name, name, result.time_ms)
+                    print_gtest_ok(suite_name, name, result.time_ms, result.cycles)
                 else:
                     print_gtest_failed(suite_name, name, result.time_ms, result.error_msg)
 
@@ -834,8 +1258,34 @@ Examples:
             passed_count = sum(1 for r in suite_results if r.passed)
             print_gtest_suite_end(suite_name, passed_count, suite_time)
 
+        if executor:
+            executor.shutdown()
+
         total_time = (time.time() - total_start) * 1000
         print_gtest_footer(results, total_time)
+        if PROFILE:
+            print(f"{BOLD}Profiles written to:{RESET} {PROFILE_DIR}")
+        if BUILD_CACHE is not None and args.verbose:
+            print(f"Build cache: {BUILD_CACHE.hits} hits, {BUILD_CACHE.misses} misses")
+
+        # Compare emulator cycles with the baseline. The emulator is
+        # deterministic, so unlike time_ms any change comes from the code.
+        baseline_path = Path(args.cycle_baseline)
+        baseline = load_cycles(baseline_path)
+        current = result_cycles(results)
+        regressions = compare_cycles(baseline, current, args.cycle_threshold)
+        if regressions:
+            print(f"{RED}[  SLOWER  ]{RESET} {len(regressions)} tests over the cycle baseline "
+                  f"by more than {args.cycle_threshold}%:")
+            for name, old, new, change in regressions:
+                print(f"{RED}[  SLOWER  ]{RESET} {name} ({old} -> {new} cycles, {change:+.1f}%)")
+        if args.update_baseline or not baseline_path.exists():
+            # Only replace the entries of the tests that ran, so a filtered
+            # run keeps the baseline of everything else
+            baseline.update(current)
+            save_cycles(baseline_path, baseline)
+            print(f"{BOLD}Cycle baseline updated:{RESET} {baseline_path}")
+            regressions = []
 
         # Save timestamped results
         passed = sum(1 for r in results if r.passed)
@@ -861,11 +1311,12 @@ Examples:
                 print(f"{BOLD}To diff with previous:{RESET} diff {summaries[-2]} {summaries[-1]}")
 
         # Return exit code
-        return 1 if failed > 0 else 0
+        return 1 if failed > 0 or regressions else 0
 
 
 if __name__ == "__main__":
     try:
         sys.exit(main())
     finally:
+        stop_servers()
         cleanup_sandbox()
@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+"""
+Picolibc Size and Cycle Report for M65832
+
+Builds picolibc for M65832 once for each of a set of meson option
+combinations, records the ROM and RAM size of every object and
+function in each libc.a and, unless --no-bench is given, the cycles
+per operation of the benchmarks in bench/. The results go to
+report-results/ as JSON and as a sorted table with one line per
+measurement, both named after the git revision, so that the report of
+one commit can be compared with, or simply diffed against, that of the
+previous one.
+
+Usage: ./run_picolibc_report.py [--config=NAME] [--no-bench] [--compare-rev=HEAD~1]
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+from collections import defaultdict
+from datetime import datetime
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+import run_picolibc_bench as bench
+import run_picolibc_gtest as rt
+from run_picolibc_gtest import BOLD, GREEN, RED, RESET, YELLOW
+
+REPORT_RESULTS_DIR = rt.PICOLIBC_ROOT / "report-results"
+REPORT_BUILD_ROOT = rt.PROJECTS_ROOT / "picolibc-build-m65832-report"
+
+PROFILE_DIR = rt.PICOLIBC_ROOT / "scripts"
+
+
+def profile_options(path: Path) -> List[str]:
+    """The [project options] of a build profile machine file as -D
+    options, so the profile can be applied to an existing build."""
+    options = []
+    section = None
+    for line in path.read_text().splitlines():
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        if line.startswith("["):
+            section = line
+            continue
+        if section != "[project options]":
+            continue
+        name, value = (part.strip() for part in line.split("=", 1))
+        if value.startswith("["):
+            value = ",".join(v.strip().strip("'") for v in value.strip("[]").split(",") if v.strip())
+        options.append(f"-D{name}={value.strip(chr(39))}")
+    return options
+
+
+# Option sets built by default, each on top of the options that
+# run_picolibc_gtest.py builds with, then one per build profile in
+# scripts/profile-m65832-*.txt. --config NAME=OPTIONS adds to or
+# replaces these.
+CONFIGS: Dict[str, List[str]] = {
+    "default": [],
+    "printf-integer": ["-Dformat-default=integer"],
+    "printf-float": ["-Dformat-default=float"],
+    "io-long-long": ["-Dio-long-long=true"],
+    "no-small-ultoa": ["-Dprintf-small-ultoa=false"],
+    "small-strcmp": ["-Dfast-strcmp=false"],
+}
+for _profile in sorted(PROFILE_DIR.glob("profile-m65832-*.txt")):
+    CONFIGS[_profile.stem[len("profile-"):]] = profile_options(_profile)
+
+# llvm-nm symbol types by where they live. Initialized data takes
+# space in both ROM (its image) and RAM.
+ROM_TYPES = set("TtWRrDdGgVv")
+RAM_TYPES = set("DdGgVvBbSsC")
+
+NM_RE = re.compile(r"^[^:]*:([^:]+):\s*[0-9a-fA-F]+\s+([0-9a-fA-F]+)\s+(\w)\s+(\S+)$")
+
+
+def measure_sizes(archive: Path) -> Tuple[Dict[str, dict], Dict[str, int]]:
+    """Sizes from the symbol table of archive. Returns (objects, functions):
+    {object: {"rom": n, "ram": n}} and {"object:function": bytes}.
+    Symbols without a size, from assembly without .size, are not counted."""
+    result = subprocess.run([str(rt.NM), "-A", "-S", "--defined-only", str(archive)],
+                            capture_output=True, text=True)
+    if result.returncode != 0:
+        raise RuntimeError(result.stderr.strip() or f"{rt.NM} failed")
+    objects: Dict[str, dict] = defaultdict(lambda: {"rom": 0, "ram": 0})
+    functions: Dict[str, int] = {}
+    for line in result.stdout.splitlines():
+        m = NM_RE.match(line)
+        if not m:
+            continue
+        obj, size, kind, name = m.group(1), int(m.group(2), 16), m.group(3), m.group(4)
+        if kind in ROM_TYPES:
+            objects[obj]["rom"] += size
+        if kind in RAM_TYPES:
+            objects[obj]["ram"] += size
+        if kind in "TtW":
+            key = f"{obj}:{name}"
+            functions[key] = functions.get(key, 0) + size
+    return dict(objects), functions
+
+
+def run_config(name: str, options: List[str], args) -> Tuple[Optional[dict], str]:
+    """Build one configuration and measure it."""
+    build = Path(args.build_root).resolve() / name
+    rt.PICOLIBC_BUILD = build
+    print(f"\n{BOLD}== {name}{RESET} {' '.join(options) or '(defaults)'}")
+    if not rt.rebuild_picolibc(args.clean, options):
+        return None, "build failed"
+    try:
+        objects, functions = measure_sizes(build / "libc.a")
+    except (OSError, RuntimeError) as e:
+        return None, str(e)
+    res = {
+        "options": options,
+        "rom": sum(o["rom"] for o in objects.values()),
+        "ram": sum(o["ram"] for o in objects.values()),
+        "objects": objects,
+        "functions": functions,
+        "bench": {},
+    }
+    print(f"  libc.a: {res['rom']} bytes ROM, {res['ram']} bytes RAM")
+    if not args.no_bench:
+        pattern = re.compile(args.filter.replace("*", ".*"), re.IGNORECASE) if args.filter else None
+        results, failed = bench.run_benchmarks(bench.find_bench_files(), pattern, args.opt, args.scale)
+        res["bench"] = {case: r["cycles_per_op"] for case, r in results.items()}
+        if failed:
+            return res, f"{failed} benchmark(s) failed"
+    return res, ""
+
+
+def write_table(doc: dict, path: Path):
+    """Write doc as sorted tab separated lines: config, kind, name, values.
+    Lines only change where a measurement did, so the tables of two
+    commits diff cleanly."""
+    lines = []
+    for config, res in doc["configs"].items():
+        lines.append(f"{config}\ttotal\tlibc.a\t{res['rom']}\t{res['ram']}")
+        for obj, o in res["objects"].items():
+            lines.append(f"{config}\tobject\t{obj}\t{o['rom']}\t{o['ram']}")
+        for fn, size in res["functions"].items():
+            lines.append(f"{config}\tfunction\t{fn}\t{size}")
+        for case, cycles in res["bench"].items():
+            lines.append(f"{config}\tbench\t{case}\t{cycles:.1f}")
+    with open(path, "w") as f:
+        f.write("\n".join(sorted(lines)) + "\n")
+
+
+def save_report(doc: dict) -> Path:
+    """Save doc as JSON and as a table. Returns the JSON file path."""
+    REPORT_RESULTS_DIR.mkdir(exist_ok=True)
+    output_file = REPORT_RESULTS_DIR / f"report_{doc['revision']}.json"
+    with open(output_file, "w") as f:
+        json.dump(doc, f, indent=2, sort_keys=True)
+        f.write("\n")
+    write_table(doc, output_file.with_suffix(".tsv"))
+
+    latest = REPORT_RESULTS_DIR / "latest.json"
+    if latest.is_symlink():
+        latest.unlink()
+    latest.symlink_to(output_file.name)
+    return output_file
+
+
+def report_for_revision(rev: str) -> Optional[Path]:
+    """The saved report of a git revision, if there is one."""
+    result = subprocess.run(["git", "rev-parse", "--short", rev], cwd=rt.PICOLIBC_ROOT,
+                            capture_output=True, text=True)
+    if result.returncode != 0:
+        return None
+    path = REPORT_RESULTS_DIR / f"report_{result.stdout.strip()}.json"
+    return path if path.exists() else None
+
+
+def print_changes(title: str, old: Dict[str, float], new: Dict[str, float], top: int, fmt: str):
+    """Print the entries that changed, the largest changes first."""
+    changed = []
+    for key in set(old) | set(new):
+        o, n = old.get(key), new.get(key)
+        if o != n:
+            changed.append((abs((n or 0) - (o or 0)), key, o, n))
+    if not changed:
+        return
+    changed.sort(key=lambda c: (-c[0], c[1]))
+    print(f"  {title}:")
+    for _, key, o, n in changed[:top]:
+        old_s = format(o, fmt) if o is not None else "-"
+        new_s = format(n, fmt) if n is not None else "-"
+        delta = f"{n - o:+{fmt}}" if o is not None and n is not None else ""
+        print(f"    {key:52} {old_s:>10} {new_s:>10} {delta:>9}")
+    if len(changed) > top:
+        print(f"    ... {len(changed) - top} more")
+
+
+def print_comparison(old: dict, new: dict, threshold: float, top: int) -> int:
+    """Print the differences between two reports. Returns the number of
+    benchmarks slower by more than threshold percent."""
+    regressions = 0
+    for config in sorted(set(old["configs"]) | set(new["configs"])):
+        o, n = old["configs"].get(config), new["configs"].get(config)
+        if o is None or n is None:
+            print(f"\n{BOLD}{config}{RESET}: only in the {'new' if o is None else 'old'} report")
+            continue
+        print(f"\n{BOLD}{config}{RESET}: ROM {o['rom']} -> {n['rom']} ({n['rom'] - o['rom']:+}), "
+              f"RAM {o['ram']} -> {n['ram']} ({n['ram'] - o['ram']:+})")
+        print_changes("objects (ROM)", {k: v["rom"] for k, v in o["objects"].items()},
+                      {k: v["rom"] for k, v in n["objects"].items()}, top, "d")
+        print_changes("objects (RAM)", {k: v["ram"] for k, v in o["objects"].items()},
+                      {k: v["ram"] for k, v in n["objects"].items()}, top, "d")
+        print_changes("functions", o["functions"], n["functions"], top, "d")
+        for case in sorted(set(o["bench"]) & set(n["bench"])):
+            oc, nc = o["bench"][case], n["bench"][case]
+            change = (nc - oc) * 100.0 / oc if oc else 0.0
+            if abs(change) <= threshold:
+                continue
+            color = RED if change > 0 else GREEN
+            if change > 0:
+                regressions += 1
+            print(f"{color}    {case:52} {oc:10.1f} {nc:10.1f} {change:+8.1f}%{RESET}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Report picolibc size and benchmark cycles for a matrix of M65832 builds",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s                               Build and measure every configuration
+  %(prog)s --no-bench --compare-rev=HEAD~1
+                                         Sizes only, against the previous commit
+  %(prog)s --config=printf-integer       One of the built-in configurations
+  %(prog)s --config='lto=-Db_lto=true'   An extra configuration
+  %(prog)s --list                        List the configurations
+""",
+    )
+    parser.add_argument("--config", action="append", default=[],
+                        help="Configuration to build: NAME for a built-in one, or "
+                             "NAME=OPTIONS to define one (repeatable, default all built-in)")
+    parser.add_argument("--list", "-l", action="store_true", help="List the configurations and exit")
+    parser.add_argument("--build-root", default=str(REPORT_BUILD_ROOT),
+                        help="Directory holding one build directory per configuration")
+    parser.add_argument("--clean", action="store_true", help="Configure every build from scratch")
+    parser.add_argument("--no-bench", action="store_true", help="Only measure sizes")
+    parser.add_argument("--filter", "-f", help="Run only benchmarks matching this pattern")
+    parser.add_argument("--scale", type=float, default=1.0,
+                        help="Multiply the default benchmark operation counts by this factor")
+    parser.add_argument("--opt", default="-O2", help="Optimization flag for the benchmarks (default -O2)")
+    parser.add_argument("--compare", "-c", help="Report file to compare against")
+    parser.add_argument("--compare-rev", help="Compare against the saved report of this git revision")
+    parser.add_argument("--threshold", type=float, default=2.0,
+                        help="Percentage slowdown reported as a regression (default 2)")
+    parser.add_argument("--top", type=int, default=20,
+                        help="Changed objects and functions to show per configuration (default 20)")
+    parser.add_argument("--no-save", action="store_true", help="Do not write a report file")
+    args = parser.parse_args()
+
+    configs: Dict[str, List[str]] = {}
+    for spec in args.config:
+        name, sep, options = spec.partition("=")
+        if sep:
+            configs[name] = options.split()
+        elif name in CONFIGS:
+            configs[name] = CONFIGS[name]
+        else:
+            print(f"{RED}Unknown configuration {name}{RESET}")
+            return 1
+    if not configs:
+        configs = dict(CONFIGS)
+    if args.list:
+        for name, options in configs.items():
+            print(f"  {name:20} {' '.join(options)}")
+        return 0
+
+    baseline_path = Path(args.compare) if args.compare else None
+    if args.compare_rev:
+        baseline_path = report_for_revision(args.compare_rev)
+        if baseline_path is None:
+            print(f"{YELLOW}No saved report for {args.compare_rev}, nothing to compare with{RESET}")
+    baseline = None
+    if baseline_path is not None:
+        with open(baseline_path) as f:
+            baseline = json.load(f)
+
+    doc = {
+        "revision": bench.git_revision(),
+        "date": datetime.now().isoformat(timespec="seconds"),
+        "opt": args.opt,
+        "scale": args.scale,
+        "configs": {},
+    }
+    failed = 0
+    for name, options in configs.items():
+        res, err = run_config(name, options, args)
+        if err:
+            print(f"{RED}[  FAILED  ]{RESET} {name} ({err})")
+            failed += 1
+        if res is not None:
+            doc["configs"][name] = res
+
+    if not args.no_save and doc["configs"]:
+        output_file = save_report(doc)
+        print(f"\n{BOLD}Report saved to:{RESET} {output_file} and {output_file.with_suffix('.tsv').name}")
+
+    regressions = 0
+    if baseline is not None:
+        print(f"\n{BOLD}Changes since {baseline['revision']}{RESET}")
+        regressions = print_comparison(baseline, doc, args.threshold, args.top)
+        if regressions:
+            print(f"\n{YELLOW}{regressions} benchmark(s) slower by more than {args.threshold}%{RESET}")
+
+    return 1 if failed or regressions else 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    finally:
+        rt.stop_servers()
+        rt.cleanup_sandbox()
@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Fill the atexit table with a mix of atexit, on_exit and __cxa_atexit
+ * handlers, check that one more is refused, and that exit runs them
+ * newest first, including a handler registered while exiting.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <limits.h>
+
+int __cxa_atexit(void (*func)(void *), void *arg, void *d);
+
+#define NHANDLER (ATEXIT_MAX - 1)
+
+static int  next = NHANDLER - 1;
+static int  late_ran;
+static int  errors;
+static long args[NHANDLER];
+
+static void
+ran(int i)
+{
+    /* The handler registered during exit runs before the rest */
+    if (i != next || (i < NHANDLER - 2 && !late_ran)) {
+        printf("handler %d ran, expected %d\n", i, next);
+        errors++;
+    }
+    next--;
+}
+
+static void
+late(void)
+{
+    late_ran = 1;
+}
+
+static void
+by_atexit(void)
+{
+    static int count;
+
+    /* atexit handlers sit at every third slot from the top down */
+    ran(NHANDLER - 1 - 3 * count++);
+}
+
+static void
+by_on_exit(int code, void *arg)
+{
+    /* With init/fini arrays, on_exit handlers don't see the exit code */
+    (void)code;
+    ran((int)*(long *)arg);
+}
+
+static void
+by_cxa_atexit(void *arg)
+{
+    int i = (int)*(long *)arg;
+
+    if (i == NHANDLER - 2 && atexit(late) != 0) {
+        printf("atexit during exit failed\n");
+        errors++;
+    }
+    ran(i);
+}
+
+static void
+check(void)
+{
+    if (next != -1) {
+        printf("%d handlers did not run\n", next + 1);
+        errors++;
+    }
+    if (!late_ran) {
+        printf("handler registered during exit did not run\n");
+        errors++;
+    }
+    _exit(errors != 0);
+}
+
+int
+main(void)
+{
+    int i, ret;
+
+    if (atexit(check) != 0) {
+        printf("atexit(check) failed\n");
+        return 1;
+    }
+    for (i = 0; i < NHANDLER; i++) {
+        args[i] = i;
+        switch ((NHANDLER - 1 - i) % 3) {
+        case 0:
+            ret = atexit(by_atexit);
+            break;
+        case 1:
+            ret = __cxa_atexit(by_cxa_atexit, &args[i], NULL);
+            break;
+        default:
+            ret = on_exit(by_on_exit, &args[i]);
+            break;
+        }
+        if (ret != 0) {
+            printf("registering handler %d failed\n", i);
+            _exit(1);
+        }
+    }
+    if (atexit(late) == 0) {
+        printf("registered more than ATEXIT_MAX handlers\n");
+        _exit(1);
+    }
+    /* Need to call exit explicitly so that native
+     * tests (which use glibc crt0) get picolibc exit
+     */
+    exit(1);
+}
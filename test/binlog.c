@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * The m65832 binary log must print each record as printf would have:
+ * check integers of every length, doubles, strings, '*' widths, %%,
+ * records wrapping around the ring, refused formats and the count of
+ * records dropped when the ring is full.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __m65832__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <machine/binlog.h>
+
+#define WORDS 32
+
+static uintptr_t            words[WORDS];
+static struct m65832_binlog binlog;
+static char                 out[512];
+static int                  error;
+
+static void
+check(const char *want)
+{
+    FILE *f = fmemopen(out, sizeof(out), "w");
+
+    if (!f) {
+        printf("fmemopen failed\n");
+        exit(1);
+    }
+    __m65832_binlog_flush(&binlog, f);
+    fclose(f);
+    if (strcmp(out, want) != 0) {
+        printf("got \"%s\" want \"%s\"\n", out, want);
+        error = 1;
+    }
+}
+
+int
+main(void)
+{
+    int i;
+
+    if (__m65832_binlog_init(&binlog, words, 12) == 0) {
+        printf("init accepted 12 words\n");
+        error = 1;
+    }
+    __m65832_binlog_init(&binlog, words, WORDS);
+
+    __m65832_binlog(&binlog, "plain\n");
+    __m65832_binlog(&binlog, "%d %u %x %ld %lld %c|", -5, 7u, 0xbeefu, -70000L, -(1LL << 40), 'q');
+    __m65832_binlog(&binlog, "%hhd %zu %jd %td|", 300, (size_t)9, (intmax_t)-3, (ptrdiff_t)4);
+    check("plain\n-5 7 beef -70000 -1099511627776 q|44 9 -3 4|");
+
+    __m65832_binlog(&binlog, "%.3f %g %e|", 3.14159, 0.5, 1e10);
+    __m65832_binlog(&binlog, "%s-%*d-%-*.*s-%%|", "str", 4, 42, 5, 2, "abcdef");
+    check("3.142 0.5 1.000000e+10|str-  42-ab   -%|");
+
+    /* Records straddle the end of the ring from here on */
+    for (i = 0; i < 10; i++) {
+        char want[32];
+
+        snprintf(want, sizeof(want), "%d.%lld ", i, 1LL << 33);
+        __m65832_binlog(&binlog, "%d.%lld ", i, 1LL << 33);
+        check(want);
+    }
+    __m65832_binlog(&binlog, "a%d", 1);
+    __m65832_binlog(&binlog, "b%d", 2);
+    check("a1b2");
+
+    if (__m65832_binlog(&binlog, "%n", &i) == 0 || __m65832_binlog(&binlog, "%1$d", 1) == 0) {
+        printf("refused format was logged\n");
+        error = 1;
+    }
+
+    /* Each record takes four words, so eight fit */
+    for (i = 0; i < 10; i++)
+        __m65832_binlog(&binlog, "%d%d", i, i);
+    if (binlog.dropped != 2) {
+        printf("dropped %u want 2\n", binlog.dropped);
+        error = 1;
+    }
+    check("0011223344556677");
+
+    return error;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("binlog is m65832 only, skipping\n");
+    return 77;
+}
+
+#endif
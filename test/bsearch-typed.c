@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check the typed branch-free bsearch and the Eytzinger search against
+ * bsearch for every array size up to MAX_N, with and without duplicate
+ * keys, probing every key and the gaps around them.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#define MAX_N 70
+
+static int
+cmp_int64(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int
+check(const char *what, size_t n, int64_t key, int found, int64_t got, int want_found)
+{
+    if (found != want_found || (found && got != key)) {
+        printf("%s: n %zu key %lld: found %d (%lld) want %d\n", what, n, (long long)key, found,
+               (long long)got, want_found);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    static int64_t  sorted[MAX_N], tree[MAX_N];
+    static int32_t  s32[MAX_N], t32[MAX_N];
+    static uint32_t su32[MAX_N], tu32[MAX_N];
+    int             ret = 0;
+    size_t          n, i;
+    int             dup;
+    int64_t         key;
+
+    for (dup = 0; dup < 2; dup++) {
+        for (n = 0; n <= MAX_N; n++) {
+            /* Odd keys, spread to need the full width, or in pairs */
+            for (i = 0; i < n; i++) {
+                sorted[i] = 2 * (int64_t)(dup ? i / 2 : i) + 1 - (int64_t)MAX_N;
+                if (dup)
+                    sorted[i] *= (int64_t)1 << 33;
+                s32[i] = (int32_t)(2 * (dup ? i / 2 : i) + 1) - MAX_N;
+                su32[i] = 2 * (uint32_t)(dup ? i / 2 : i) + 0x80000001u;
+            }
+            eytzinger_int64(tree, sorted, n);
+            eytzinger_int32(t32, s32, n);
+            eytzinger_uint32(tu32, su32, n);
+
+            if (n == 0) {
+                if (bsearch_int64(0, sorted, 0) || eytzinger_bsearch_int64(0, tree, 0)
+                    || bsearch_int32(0, s32, 0) || eytzinger_bsearch_uint32(0, tu32, 0)) {
+                    printf("search of an empty array found something\n");
+                    ret = 1;
+                }
+                continue;
+            }
+
+            for (i = 0; i <= n; i++) {
+                int k;
+
+                /* The key at i and the gap below it */
+                for (k = 0; k < 2; k++) {
+                    int64_t  *p, *e;
+                    int32_t  *p32, *e32;
+                    uint32_t *pu, *eu;
+                    int       want;
+
+                    if (i == n && k == 0)
+                        continue;
+                    key = (i < n ? sorted[i] : sorted[n - 1] + 2) - k;
+                    want = bsearch(&key, sorted, n, sizeof(sorted[0]), cmp_int64) != NULL;
+                    p = bsearch_int64(key, sorted, n);
+                    e = eytzinger_bsearch_int64(key, tree, n);
+                    ret |= check("bsearch_int64", n, key, p != NULL, p ? *p : 0, want);
+                    ret |= check("eytzinger_bsearch_int64", n, key, e != NULL, e ? *e : 0, want);
+
+                    int32_t k32 = (i < n ? s32[i] : s32[n - 1] + 2) - k;
+                    p32 = bsearch_int32(k32, s32, n);
+                    e32 = eytzinger_bsearch_int32(k32, t32, n);
+                    ret |= check("bsearch_int32", n, k32, p32 != NULL, p32 ? *p32 : 0, k == 0);
+                    ret |= check("eytzinger_bsearch_int32", n, k32, e32 != NULL, e32 ? *e32 : 0,
+                                 k == 0);
+
+                    uint32_t ku = (i < n ? su32[i] : su32[n - 1] + 2) - k;
+                    pu = bsearch_uint32(ku, su32, n);
+                    eu = eytzinger_bsearch_uint32(ku, tu32, n);
+                    ret |= check("bsearch_uint32", n, ku, pu != NULL, pu ? *pu : 0, k == 0);
+                    ret |= check("eytzinger_bsearch_uint32", n, ku, eu != NULL, eu ? *eu : 0,
+                                 k == 0);
+                }
+            }
+        }
+    }
+    return ret;
+}
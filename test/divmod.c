@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * div, ldiv, lldiv and imaxdiv against the / and % operators over
+ * mixed-sign edge values, plus the conversions that now split
+ * quotient and remainder with one division: gmtime_r outside the
+ * 32-bit fast range and integer formatting in every base.
+ */
+
+#define _DEFAULT_SOURCE
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static int error;
+
+#define N(a) (sizeof(a) / sizeof((a)[0]))
+
+static const long long values[] = {
+    0,         1,          -1,         2,          -2,        3,        -3,
+    7,         -7,         10,         -10,        99,        -99,      1000003,
+    -1000003,  INT_MAX,    INT_MIN,    INT_MAX - 1, INT_MIN + 1, LLONG_MAX, LLONG_MIN,
+    LLONG_MAX - 1, LLONG_MIN + 1, 0x123456789abcdefLL, -0x123456789abcdefLL,
+    86400,     -86400,     1LL << 32,  -(1LL << 32), (1LL << 32) + 1,
+};
+
+#define CHECK(fn, type, div_t, tmin, tmax)                                           \
+    do {                                                                              \
+        size_t i, j;                                                                  \
+        for (i = 0; i < N(values); i++) {                                             \
+            for (j = 0; j < N(values); j++) {                                         \
+                type  n = (type)values[i], d = (type)values[j];                       \
+                div_t r;                                                              \
+                if (values[i] < tmin || values[i] > tmax || values[j] < tmin          \
+                    || values[j] > tmax || d == 0 || (n == tmin && d == -1))          \
+                    continue;                                                         \
+                r = fn(n, d);                                                         \
+                if (r.quot != n / d || r.rem != n % d) {                              \
+                    printf(#fn "(%lld, %lld) = { %lld, %lld } want { %lld, %lld }\n", \
+                           (long long)n, (long long)d, (long long)r.quot,             \
+                           (long long)r.rem, (long long)(n / d), (long long)(n % d)); \
+                    error = 1;                                                        \
+                }                                                                     \
+            }                                                                         \
+        }                                                                             \
+    } while (0)
+
+/* seconds in 400 Gregorian years, after which the calendar repeats */
+#define SECS_PER_ERA (146097LL * 86400)
+
+static void
+check_gmtime(time_t t)
+{
+    static const int eras[] = { 50, -50, 1000, -1000 };
+    struct tm        base, far;
+    size_t           i;
+
+    gmtime_r(&t, &base);
+    for (i = 0; i < N(eras); i++) {
+        time_t f = t + (time_t)eras[i] * SECS_PER_ERA;
+
+        gmtime_r(&f, &far);
+        if (far.tm_year != base.tm_year + eras[i] * 400 || far.tm_mon != base.tm_mon
+            || far.tm_mday != base.tm_mday || far.tm_hour != base.tm_hour
+            || far.tm_min != base.tm_min || far.tm_sec != base.tm_sec
+            || far.tm_yday != base.tm_yday || far.tm_wday != base.tm_wday) {
+            printf("gmtime_r(%lld): %d-%02d-%02d %02d:%02d:%02d, want year %d %02d-%02d "
+                   "%02d:%02d:%02d\n",
+                   (long long)f, far.tm_year, far.tm_mon, far.tm_mday, far.tm_hour,
+                   far.tm_min, far.tm_sec, base.tm_year + eras[i] * 400, base.tm_mon,
+                   base.tm_mday, base.tm_hour, base.tm_min, base.tm_sec);
+            error = 1;
+        }
+    }
+}
+
+static void
+check_fmt(const char *fmt, unsigned long long v, const char *want)
+{
+    char buf[64];
+
+    snprintf(buf, sizeof(buf), fmt, v);
+    if (strcmp(buf, want) != 0) {
+        printf("\"%s\" %llu: got \"%s\" want \"%s\"\n", fmt, v, buf, want);
+        error = 1;
+    }
+}
+
+int
+main(void)
+{
+    static const time_t times[] = {
+        0, 1, -1, 86399, 86400, -86400, -86401, 951782399, 951868800, 1709251199,
+        -62135596801LL, 253402300799LL,
+    };
+    size_t i;
+
+    CHECK(div, int, div_t, INT_MIN, INT_MAX);
+    CHECK(ldiv, long, ldiv_t, LONG_MIN, LONG_MAX);
+    CHECK(lldiv, long long, lldiv_t, LLONG_MIN, LLONG_MAX);
+    CHECK(imaxdiv, intmax_t, imaxdiv_t, INTMAX_MIN, INTMAX_MAX);
+
+    if (sizeof(time_t) >= 8)
+        for (i = 0; i < N(times); i++)
+            check_gmtime(times[i]);
+
+    check_fmt("%llu", 18446744073709551615ULL, "18446744073709551615");
+    check_fmt("%llo", 18446744073709551615ULL, "1777777777777777777777");
+    check_fmt("%llx", 0x123456789abcdefULL, "123456789abcdef");
+    check_fmt("%llu", 4294967296ULL, "4294967296");
+    check_fmt("%llu", 0, "0");
+    check_fmt("%llo", 4294967295ULL, "37777777777");
+    check_fmt("%llX", 0xfedcba98ULL, "FEDCBA98");
+
+    return error;
+}
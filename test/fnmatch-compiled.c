@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check fnmatch_exec against fnmatch for random patterns and names
+ * over a small alphabet, and that a pattern with many stars which
+ * fails only at the end does not take exponential time.
+ */
+
+#define _GNU_SOURCE
+#include <fnmatch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ROUNDS 20000
+
+static unsigned long seed = 1;
+
+static unsigned
+next(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16);
+}
+
+static const char *const pieces[] = {
+    "a", "b", "A", ".", "/", "?", "*", "**", "[ab]", "[!a]", "[a-c]", "[[:upper:]]", "\\*", "\\a",
+    "[", "]", "[/]", "[]a]",
+};
+
+#define NPIECES (sizeof(pieces) / sizeof(pieces[0]))
+
+static const struct {
+    const char *pattern;
+    const char *string;
+    int         flags;
+    int         expected;
+} checks[] = {
+    { "*.c", "main.c", 0, 0 },
+    { "*.c", ".c", FNM_PERIOD, FNM_NOMATCH },
+    { "?c", ".c", FNM_PERIOD, FNM_NOMATCH },
+    { "a/*", "a/.b", FNM_PATHNAME | FNM_PERIOD, FNM_NOMATCH },
+    { "a/.*", "a/.b", FNM_PATHNAME | FNM_PERIOD, 0 },
+    { "*/b", "a/b", FNM_PATHNAME, 0 },
+    { "*", "a/b", FNM_PATHNAME, FNM_NOMATCH },
+    { "*", "a/b", 0, 0 },
+    { "a", "a/b", FNM_LEADING_DIR, 0 },
+    { "*", "a/b", FNM_PATHNAME | FNM_LEADING_DIR, 0 },
+    { "A*", "abc", FNM_CASEFOLD, 0 },
+    { "[A-C]x", "bx", FNM_CASEFOLD, 0 },
+    { "[a/b]", "a", FNM_PATHNAME, FNM_NOMATCH },
+    { "[ab", "[ab", 0, 0 },
+    { "\\", "\\", 0, 0 },
+    { "\\*", "\\*", FNM_NOESCAPE, 0 },
+};
+
+#define NCHECKS (sizeof(checks) / sizeof(checks[0]))
+
+int
+main(void)
+{
+    static const int        flag_sets[] = { 0, FNM_PATHNAME, FNM_NOESCAPE, FNM_CASEFOLD,
+                                            FNM_LEADING_DIR, FNM_PATHNAME | FNM_LEADING_DIR };
+    struct fnmatch_pattern *cp;
+    char                    pattern[64], name[32], slow[160];
+    unsigned                i, j, n, stars;
+    int                     flags, want, got;
+    int                     ret = 0;
+
+    for (i = 0; i < NCHECKS; i++) {
+        cp = fnmatch_compile(checks[i].pattern, checks[i].flags);
+        if (!cp) {
+            printf("fnmatch_compile failed\n");
+            return 1;
+        }
+        got = fnmatch_exec(cp, checks[i].string);
+        if (got != checks[i].expected) {
+            printf("\"%s\" \"%s\" %#x: got %d expected %d\n", checks[i].pattern,
+                   checks[i].string, checks[i].flags, got, checks[i].expected);
+            ret = 1;
+        }
+        fnmatch_free(cp);
+    }
+
+    for (i = 0; i < ROUNDS; i++) {
+        /* At most three stars keep fnmatch well inside its recursion limit */
+        pattern[0] = '\0';
+        stars = 0;
+        n = next() % 6;
+        for (j = 0; j < n; j++) {
+            const char *piece = pieces[next() % NPIECES];
+            if (piece[0] == '*' && ++stars > 3)
+                piece = "a";
+            strcat(pattern, piece);
+        }
+        n = next() % 8;
+        for (j = 0; j < n; j++)
+            name[j] = "abA./*["[next() % 7];
+        name[n] = '\0';
+        flags = flag_sets[next() % (sizeof(flag_sets) / sizeof(flag_sets[0]))];
+
+        cp = fnmatch_compile(pattern, flags);
+        if (!cp) {
+            printf("fnmatch_compile failed\n");
+            return 1;
+        }
+        want = fnmatch(pattern, name, flags) == 0;
+        got = fnmatch_exec(cp, name) == 0;
+        if (want != got) {
+            printf("\"%s\" \"%s\" %#x: fnmatch %d fnmatch_exec %d\n", pattern, name, flags,
+                   want, got);
+            ret = 1;
+        }
+        fnmatch_free(cp);
+    }
+
+    /* Exponential for a backtracking matcher */
+    memset(slow, 'a', sizeof(slow) - 1);
+    slow[sizeof(slow) - 1] = '\0';
+    cp = fnmatch_compile("*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*b", 0);
+    if (!cp || fnmatch_exec(cp, slow) != FNM_NOMATCH) {
+        printf("many stars\n");
+        ret = 1;
+    }
+    fnmatch_free(cp);
+    return ret;
+}
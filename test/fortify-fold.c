@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * The fortify wrappers call memcpy and snprintf directly when the
+ * length provably fits; check that lengths which only fit at run time
+ * still work and that those which do not still reach __chk_fail.
+ */
+
+#include <setjmp.h>
+#include <ssp/ssp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static jmp_buf         fail_jmp;
+static volatile int    failed;
+static volatile size_t len = 8;
+static volatile size_t extra = 1;
+static const char      src[32] = "0123456789abcdefghijklmnopqrstu";
+static char            buf[8];
+static char           *p;
+
+static void
+fortify_fail(int sig)
+{
+    (void)sig;
+    failed = 1;
+    longjmp(fail_jmp, 1);
+}
+
+/* Run one call and report whether it reached __chk_fail */
+static int
+fails(void (*call)(void))
+{
+    failed = 0;
+    if (setjmp(fail_jmp) == 0)
+        call();
+    return failed;
+}
+
+static void
+buf_fits(void)
+{
+    memcpy(buf, src, len);
+}
+
+/* Object sizes are only known when optimizing */
+#if __SSP_FORTIFY_LEVEL > 0 && defined(__OPTIMIZE__)
+static void
+buf_over(void)
+{
+    memcpy(buf, src, len + extra);
+}
+#endif
+
+static void
+heap_fits(void)
+{
+    size_t n = len;
+
+    p = malloc(n);
+    if (p) {
+        memcpy(p, src, n);
+        snprintf(p, n, "%d", 1234567);
+    }
+}
+
+/* Sizes of malloc'd objects need __builtin_dynamic_object_size */
+#if __SSP_FORTIFY_LEVEL > 2 && defined(__OPTIMIZE__)
+static void
+heap_over(void)
+{
+    size_t n = len;
+
+    p = malloc(n);
+    if (p)
+        memcpy(p, src, n + extra);
+}
+
+static void
+heap_snprintf_over(void)
+{
+    size_t n = len;
+
+    p = malloc(n);
+    if (p)
+        snprintf(p, n + extra, "%d", 1);
+}
+#endif
+
+int
+main(void)
+{
+    int ret = 0;
+
+    set_fortify_handler(fortify_fail);
+
+    if (fails(buf_fits)) {
+        printf("memcpy of %zu bytes into buf[8] failed\n", len);
+        ret = 1;
+    }
+#if __SSP_FORTIFY_LEVEL > 0 && defined(__OPTIMIZE__)
+    if (!fails(buf_over)) {
+        printf("memcpy of %zu bytes into buf[8] passed\n", len + extra);
+        ret = 1;
+    }
+#endif
+    if (fails(heap_fits) || !p || strcmp(p, "1234567") != 0) {
+        printf("memcpy and snprintf of %zu bytes into malloc(%zu) failed\n", len, len);
+        ret = 1;
+    }
+    free(p);
+#if __SSP_FORTIFY_LEVEL > 2 && defined(__OPTIMIZE__)
+    if (!fails(heap_over)) {
+        printf("memcpy of %zu bytes into malloc(%zu) passed\n", len + extra, len);
+        ret = 1;
+    }
+    free(p);
+    if (!fails(heap_snprintf_over)) {
+        printf("snprintf of %zu bytes into malloc(%zu) passed\n", len + extra, len);
+        ret = 1;
+    }
+    free(p);
+#endif
+    return ret;
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * ftell on a stream being written, and fseek within the data not yet
+ * written, should not flush. Check that the file still ends up with
+ * the right contents, whether the data is overwritten in the buffer,
+ * flushed with a seek pending, or sent after a seek outside it.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#define SPACE 256
+
+static char   file_data[SPACE];
+static size_t file_len, file_pos;
+static int    writes;
+
+static ssize_t
+mem_write(void *cookie, const void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > SPACE - file_pos)
+        n = SPACE - file_pos;
+    memcpy(file_data + file_pos, buf, n);
+    file_pos += n;
+    if (file_pos > file_len)
+        file_len = file_pos;
+    writes++;
+    return n;
+}
+
+static ssize_t
+mem_read(void *cookie, void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > file_len - file_pos)
+        n = file_len - file_pos;
+    memcpy(buf, file_data + file_pos, n);
+    file_pos += n;
+    return n;
+}
+
+static __off_t
+mem_seek(void *cookie, __off_t off, int whence)
+{
+    (void)cookie;
+    if (whence == SEEK_CUR)
+        off += file_pos;
+    else if (whence == SEEK_END)
+        off += file_len;
+    if (off < 0 || off > SPACE)
+        return -1;
+    file_pos = off;
+    return off;
+}
+
+#define check(cond)                                 \
+    do {                                            \
+        if (!(cond)) {                              \
+            printf("%d: %s failed\n", __LINE__, #cond); \
+            ret = 1;                                \
+        }                                           \
+    } while (0)
+
+int
+main(void)
+{
+    static const char expect[] = "HDR2rec0rec1rec2XYZ3tail";
+    FILE             *f;
+    long              offsets[4];
+    char              buf[32];
+    int               i, ret = 0;
+
+    f = funopen(NULL, mem_read, mem_write, mem_seek, NULL);
+    if (!f) {
+        printf("funopen failed\n");
+        return 1;
+    }
+    setvbuf(f, NULL, _IOFBF, 64);
+
+    /* An index built as records are written costs no I/O */
+    fputs("HDR0", f);
+    for (i = 0; i < 4; i++) {
+        offsets[i] = ftell(f);
+        fprintf(f, "rec%d", i);
+    }
+    check(writes == 0);
+    check(offsets[0] == 4 && offsets[3] == 16);
+
+    /* Rewrite the header and one record inside the buffer */
+    check(fseek(f, 3, SEEK_SET) == 0);
+    check(ftell(f) == 3);
+    fputc('2', f);
+    check(fseek(f, offsets[3], SEEK_SET) == 0);
+    fputs("XYZ", f);
+    check(ftell(f) == 19);
+    check(writes == 0);
+
+    /* Flushing with data past the write position keeps both */
+    check(fflush(f) == 0);
+    check(writes != 0);
+    check(file_len == 20 && file_pos == 19);
+    check(ftell(f) == 19);
+
+    /* Seeking back past the flushed data goes to the file */
+    check(fseek(f, 0, SEEK_END) == 0);
+    fputs("tail", f);
+    check(ftell(f) == 24);
+    check(fseek(f, 0, SEEK_SET) == 0);
+    check(fread(buf, 1, sizeof(buf), f) == 24);
+    check(memcmp(buf, expect, 24) == 0);
+    check(memcmp(file_data, expect, 24) == 0);
+
+    /* Seeking relative to the write position */
+    check(fseek(f, 4, SEEK_SET) == 0);
+    fputs("REC0", f);
+    check(fseek(f, -2, SEEK_CUR) == 0);
+    fputs("c", f);
+    check(ftell(f) == 7);
+    fclose(f);
+    check(memcmp(file_data, "HDR2REc0", 8) == 0);
+    check(memcmp(file_data + 8, expect + 8, 16) == 0);
+    return ret;
+}
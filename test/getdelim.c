@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Read lines with getline, getdelim and getdelim_max from a buffered
+ * stream fed in short reads, so lines cross buffer refills, and from
+ * an unbuffered fmemopen stream.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdio.h>
+#include <stdio-bufio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char text[] = "one\n"
+                           "\n"
+                           "a line which is longer than the stream buffer\n"
+                           "x,y,z\n"
+                           "no newline";
+
+struct source {
+    const char *pos;
+    size_t      left;
+};
+
+static ssize_t
+source_read(void *ptr, void *buf, size_t count)
+{
+    struct source *src = ptr;
+
+    if (count > 7)
+        count = 7;
+    if (count > src->left)
+        count = src->left;
+    memcpy(buf, src->pos, count);
+    src->pos += count;
+    src->left -= count;
+    return count;
+}
+
+static int
+check(const char *what, ssize_t got, const char *line, const char *want)
+{
+    if (got == (ssize_t)strlen(want) && !strcmp(line, want))
+        return 0;
+    printf("%s: got %zd \"%s\" want \"%s\"\n", what, got, got < 0 ? "" : line, want);
+    return 1;
+}
+
+static int
+read_lines(FILE *f)
+{
+    char   *line = NULL;
+    size_t  n = 0;
+    int     ret = 0;
+    ssize_t got;
+
+    got = getline(&line, &n, f);
+    ret |= check("getline", got, line, "one\n");
+    got = getline(&line, &n, f);
+    ret |= check("empty", got, line, "\n");
+    got = getdelim_max(&line, &n, '\n', 20, f);
+    ret |= check("max 1", got, line, "a line which is long");
+    got = getdelim_max(&line, &n, '\n', 20, f);
+    ret |= check("max 2", got, line, "er than the stream b");
+    got = getdelim_max(&line, &n, '\n', 20, f);
+    ret |= check("max 3", got, line, "uffer\n");
+    got = getdelim(&line, &n, ',', f);
+    ret |= check("comma", got, line, "x,");
+    got = getline(&line, &n, f);
+    ret |= check("rest", got, line, "y,z\n");
+    got = getline(&line, &n, f);
+    ret |= check("last", got, line, "no newline");
+    got = getline(&line, &n, f);
+    if (got != -1 || !feof(f)) {
+        printf("eof: got %zd\n", got);
+        ret = 1;
+    }
+    errno = 0;
+    if (getdelim_max(&line, &n, '\n', 0, f) != -1 || errno != EINVAL) {
+        printf("max 0 accepted\n");
+        ret = 1;
+    }
+    free(line);
+    return ret;
+}
+
+int
+main(void)
+{
+    static char          buf[16];
+    struct source        src = { text, sizeof(text) - 1 };
+    struct __file_bufio  bf = FDEV_SETUP_BUFIO_PTR(&src, buf, sizeof(buf), source_read, NULL, NULL,
+                                                   NULL, __SRD, 0);
+    FILE                *f;
+    int                  ret;
+
+    ret = read_lines(&bf.xfile.cfile.file);
+
+    f = fmemopen((void *)text, sizeof(text) - 1, "r");
+    if (!f) {
+        printf("fmemopen failed\n");
+        return 1;
+    }
+    ret |= read_lines(f);
+    fclose(f);
+    return ret;
+}
@@ -0,0 +1,151 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check getenv against a table of expected values while setenv,
+ * putenv and unsetenv change a few hundred variables, and after the
+ * program points environ at arrays of its own, as the getenv index
+ * must follow all of these.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NVAR 300
+
+extern char **environ;
+
+static char names[NVAR][16];
+static char values[NVAR][32];
+static int  set[NVAR];
+static int  errors;
+
+static void
+check(const char *what)
+{
+    int i;
+
+    for (i = 0; i < NVAR; i++) {
+        const char *v = getenv(names[i]);
+
+        if (set[i] ? !v || strcmp(v, values[i]) : v != NULL) {
+            printf("%s: getenv(%s) = %s, want %s\n", what, names[i], v ? v : "(null)",
+                   set[i] ? values[i] : "(null)");
+            errors++;
+        }
+    }
+}
+
+static void
+expect(const char *name, const char *want)
+{
+    const char *v = getenv(name);
+
+    if (want ? !v || strcmp(v, want) : v != NULL) {
+        printf("getenv(%s) = %s, want %s\n", name, v ? v : "(null)", want ? want : "(null)");
+        errors++;
+    }
+}
+
+int
+main(void)
+{
+    static char putbuf[NVAR][48];
+    char      **own;
+    int         i;
+
+    for (i = 0; i < NVAR; i++)
+        snprintf(names[i], sizeof(names[i]), "VAR_%d", i);
+
+    /* Grow the environment one variable at a time */
+    for (i = 0; i < NVAR; i++) {
+        snprintf(values[i], sizeof(values[i]), "value %d", i);
+        if (setenv(names[i], values[i], 0) != 0) {
+            printf("setenv(%s) failed\n", names[i]);
+            return 1;
+        }
+        set[i] = 1;
+        if (i % 37 == 0)
+            check("setenv");
+    }
+    check("setenv");
+
+    /* Prefixes of one name must not match another */
+    expect("VAR_", NULL);
+    expect("VAR_1=", NULL);
+    expect("VAR_29", "value 29");
+    expect("VAR_299", "value 299");
+
+    /* Rewrite some values in place and some with longer strings */
+    for (i = 0; i < NVAR; i += 3) {
+        snprintf(values[i], sizeof(values[i]), i & 1 ? "v%d" : "a longer value %d", i);
+        setenv(names[i], values[i], 1);
+    }
+    setenv(names[1], "not replaced", 0);
+    check("rewrite");
+
+    /* Remove a third of them, then put some back with putenv */
+    for (i = 0; i < NVAR; i += 3) {
+        unsetenv(names[i]);
+        set[i] = 0;
+    }
+    check("unsetenv");
+    for (i = 0; i < NVAR; i += 6) {
+        snprintf(values[i], sizeof(values[i]), "put %d", i);
+        snprintf(putbuf[i], sizeof(putbuf[i]), "%s=%s", names[i], values[i]);
+        putenv(putbuf[i]);
+        set[i] = 1;
+    }
+    check("putenv");
+
+    /* A new array with duplicates and an entry without '=' */
+    own = malloc(6 * sizeof(char *));
+    if (!own)
+        return 1;
+    own[0] = "NOEQUALS";
+    own[1] = "DUP=first";
+    own[2] = "OTHER=x";
+    own[3] = "DUP=second";
+    own[4] = "VAR_7=seven";
+    own[5] = NULL;
+    environ = own;
+    memset(set, 0, sizeof(set));
+    strcpy(values[7], "seven");
+    set[7] = 1;
+    check("environ");
+    expect("DUP", "first");
+    expect("NOEQUALS", NULL);
+    expect("OTHER", "x");
+
+    /* unsetenv removes every copy */
+    unsetenv("DUP");
+    expect("DUP", NULL);
+    expect("OTHER", "x");
+
+    /* A shorter array */
+    own = malloc(3 * sizeof(char *));
+    if (!own)
+        return 1;
+    own[0] = "A=1";
+    own[1] = "B=2";
+    own[2] = NULL;
+    environ = own;
+    expect("OTHER", NULL);
+    expect("VAR_7", NULL);
+    expect("B", "2");
+    set[7] = 0;
+
+    setenv("OTHER", "y", 1);
+    expect("OTHER", "y");
+    for (i = 0; i < NVAR; i += 5) {
+        snprintf(values[i], sizeof(values[i]), "again %d", i);
+        setenv(names[i], values[i], 1);
+        set[i] = 1;
+    }
+    check("setenv again");
+
+    return errors != 0;
+}
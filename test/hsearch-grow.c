@@ -0,0 +1,131 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <search.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+
+/*
+ * Exercise hsearch_r growth, deletion and the length-based lookups:
+ * start from a tiny table, insert far more keys than it was sized
+ * for, and check that every entry can still be found through the
+ * same ENTRY pointer it was returned with.
+ */
+
+#define NKEYS 3000
+
+static char   keys[NKEYS][16];
+static ENTRY *ents[NKEYS];
+
+#define TEST(e)                                                   \
+    do {                                                          \
+        if (!(e)) {                                               \
+            printf("%s:%d: %s failed\n", __FILE__, __LINE__, #e); \
+            return 1;                                             \
+        }                                                         \
+    } while (0)
+
+int
+main(void)
+{
+    struct hsearch_data htab;
+    ENTRY               e, *ep;
+    int                 i;
+    char                buf[32];
+
+    memset(&htab, 0, sizeof(htab));
+    TEST(hcreate_r(4, &htab));
+
+    for (i = 0; i < NKEYS; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "key%d", i * 7919);
+        e.key = keys[i];
+        e.data = (void *)(uintptr_t)i;
+        TEST(hsearch_r(e, ENTER, &ents[i], &htab));
+        TEST(ents[i]->key == keys[i]);
+
+        /* Entering again returns the existing entry */
+        e.data = NULL;
+        TEST(hsearch_r(e, ENTER, &ep, &htab) && ep == ents[i]);
+    }
+
+    for (i = 0; i < NKEYS; i++) {
+        /* Use a copy of the key so pointer equality can't help */
+        strcpy(buf, keys[i]);
+        e.key = buf;
+        TEST(hsearch_r(e, FIND, &ep, &htab));
+        TEST(ep == ents[i] && (uintptr_t)ep->data == (uintptr_t)i);
+    }
+
+    /* Length-based lookup of a key which isn't NUL terminated */
+    memcpy(buf, keys[42], strlen(keys[42]));
+    strcpy(buf + strlen(keys[42]), "junk");
+    e.key = buf;
+    TEST(hsearch_len_r(e, strlen(keys[42]), FIND, &ep, &htab) && ep == ents[42]);
+    TEST(!hsearch_len_r(e, strlen(keys[42]) + 1, FIND, &ep, &htab) && ep == NULL);
+
+    /* Remove every other key */
+    for (i = 0; i < NKEYS; i += 2)
+        TEST(hdelete_r(keys[i], &htab));
+    errno = 0;
+    TEST(!hdelete_r(keys[0], &htab) && errno == ESRCH);
+
+    for (i = 0; i < NKEYS; i++) {
+        e.key = keys[i];
+        if (i & 1) {
+            TEST(hsearch_r(e, FIND, &ep, &htab) && ep == ents[i]);
+        } else {
+            TEST(!hsearch_r(e, FIND, &ep, &htab));
+        }
+    }
+
+    /* Put them back */
+    for (i = 0; i < NKEYS; i += 2) {
+        e.key = keys[i];
+        e.data = (void *)(uintptr_t)(i + 1);
+        TEST(hsearch_r(e, ENTER, &ents[i], &htab));
+    }
+    for (i = 0; i < NKEYS; i++) {
+        e.key = keys[i];
+        TEST(hsearch_r(e, FIND, &ep, &htab) && ep == ents[i]);
+        TEST((uintptr_t)ep->data == (uintptr_t)(i + !(i & 1)));
+    }
+
+    hdestroy_r(&htab);
+    return 0;
+}
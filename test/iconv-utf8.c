@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check the direct iconv conversions between UTF-8 and UCS-2, UCS-4
+ * and ISO-8859-1 against known encodings, converting all at once and
+ * a few bytes at a time, and check that //IGNORE drops invalid input.
+ */
+
+#include <errno.h>
+#include <iconv.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEXT_ASCII "ASCII text long enough to cover several words "
+
+static const char utf8[] = TEXT_ASCII "\xc3\xa9t\xc3\xa9 \xe2\x82\xac!";
+static const uint32_t code[] = { 0xe9, 't', 0xe9, ' ', 0x20ac, '!' };
+#define NASCII (sizeof(TEXT_ASCII) - 1)
+#define NCODE  (sizeof(code) / sizeof(code[0]))
+
+static size_t
+encode(unsigned char *out, const char *to, size_t n)
+{
+    unsigned width = strstr(to, "UCS-2") ? 2 : strstr(to, "UCS-4") ? 4 : 1;
+    int      big = strstr(to, "BE") != NULL;
+    size_t   i, len = 0;
+    unsigned b;
+
+    for (i = 0; i < NASCII + n; i++) {
+        uint32_t c = i < NASCII ? (unsigned char)TEXT_ASCII[i] : code[i - NASCII];
+        for (b = 0; b < width; b++)
+            out[len++] = c >> (8 * (big ? width - 1 - b : b));
+    }
+    return len;
+}
+
+static int
+convert(const char *to, const char *from, const char *in, size_t inlen, const char *want,
+        size_t wantlen, size_t chunk)
+{
+    iconv_t ic = iconv_open(to, from);
+    char    out[256];
+    char   *ip = (char *)in, *op = out;
+    size_t  il = inlen, ol, r;
+
+    if (ic == (iconv_t)-1) {
+        printf("iconv_open %s %s: %s\n", to, from, strerror(errno));
+        return 1;
+    }
+    while (il) {
+        ol = chunk;
+        r = iconv(ic, &ip, &il, &op, &ol);
+        if (r == (size_t)-1) {
+            printf("%s from %s: %s\n", to, from, strerror(errno));
+            iconv_close(ic);
+            return 1;
+        }
+    }
+    /* Flush any buffered partial character */
+    ol = 8;
+    iconv(ic, &ip, &il, &op, &ol);
+    iconv_close(ic);
+    if ((size_t)(op - out) != wantlen || memcmp(out, want, wantlen) != 0) {
+        printf("%s from %s (chunk %zu): %zu bytes, want %zu\n", to, from, chunk,
+               (size_t)(op - out), wantlen);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    static const char *targets[] = {
+#ifdef __MB_EXTENDED_CHARSETS_UCS
+        "UCS-2LE", "UCS-2BE", "UCS-4LE", "UCS-4BE",
+#endif
+#ifdef __MB_EXTENDED_CHARSETS_ISO
+        "ISO-8859-1",
+#endif
+        NULL,
+    };
+    unsigned char other[256];
+    size_t        t, len, n, chunk;
+    int           ret = 0;
+
+#if defined(__PICOLIBC__) && !defined(__MB_CAPABLE)
+    printf("skipping, no multibyte support\n");
+    return 77;
+#endif
+    for (t = 0; targets[t]; t++) {
+        /* ISO-8859-1 has no euro sign, stop before it */
+        n = strcmp(targets[t], "ISO-8859-1") ? NCODE : 4;
+        len = encode(other, targets[t], n);
+        for (chunk = 1; chunk <= 200; chunk += chunk < 8 ? 1 : 64) {
+            ret |= convert(targets[t], "UTF-8", utf8, n == NCODE ? sizeof(utf8) - 1 : NASCII + 6,
+                           (char *)other, len, chunk);
+            ret |= convert("UTF-8", targets[t], (char *)other, len, utf8,
+                           n == NCODE ? sizeof(utf8) - 1 : NASCII + 6, chunk);
+        }
+    }
+    ret |= convert("UTF-8//IGNORE", "UTF-8", "ab\xff" "cd", 5, "abcd", 4, 64);
+    return ret;
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that __noinit and __lazy_bss variables are placed outside of
+ * the .bss range crt0 clears and that _init_lazy_bss() zeroes the
+ * __lazy_bss ones on its first call only.
+ */
+
+#include <picobss.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+extern char __bss_start[], __bss_end[];
+
+static volatile unsigned char lazy[300] __lazy_bss;
+static volatile unsigned char keep[64]  __noinit;
+static volatile unsigned char plain[64];
+
+static int
+outside_bss(const char *name, const volatile void *p, size_t size)
+{
+    uintptr_t a = (uintptr_t)p;
+
+    if (a + size <= (uintptr_t)__bss_start || a >= (uintptr_t)__bss_end)
+        return 0;
+    printf("%s at %p overlaps .bss %p-%p\n", name, (void *)a, __bss_start, __bss_end);
+    return 1;
+}
+
+int
+main(void)
+{
+    int    ret = 0;
+    size_t i;
+
+    ret |= outside_bss("lazy", lazy, sizeof(lazy));
+    ret |= outside_bss("keep", keep, sizeof(keep));
+    for (i = 0; i < sizeof(plain); i++)
+        ret |= plain[i] != 0;
+
+    memset((void *)lazy, 0x5a, sizeof(lazy));
+    memset((void *)keep, 0xa5, sizeof(keep));
+    _init_lazy_bss();
+    for (i = 0; i < sizeof(lazy); i++) {
+        if (lazy[i] != 0) {
+            printf("lazy[%zu] = %#x after _init_lazy_bss\n", i, lazy[i]);
+            ret = 1;
+            break;
+        }
+    }
+
+    /* Only the first call clears */
+    lazy[0] = 1;
+    _init_lazy_bss();
+    if (lazy[0] != 1) {
+        printf("second _init_lazy_bss cleared again\n");
+        ret = 1;
+    }
+    for (i = 0; i < sizeof(keep); i++) {
+        if (keep[i] != 0xa5) {
+            printf("keep[%zu] changed\n", i);
+            ret = 1;
+            break;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <malloc.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static char buf_a[1024] __attribute__((aligned(16)));
+static char buf_b[4096 + 3];
+
+#define NBLOCKS 64
+
+static int
+check_heap(struct malloc_heap *heap, const char *which, char *buf, size_t size)
+{
+    struct malloc_heap_info info, start;
+    void                   *p[NBLOCKS];
+    char                   *a, *b, *c;
+    int                     result = 0;
+    int                     n, i;
+
+    start = malloc_heap_info(heap);
+    if (start.nfree != 1 || start.free != start.size || start.in_use != 0 || start.size > size) {
+        printf("%s: fresh heap size %zu free %zu in %zu blocks\n", which, start.size, start.free,
+               start.nfree);
+        result = 1;
+    }
+
+    /* Fill the heap, checking each block is inside it and aligned */
+    for (n = 0; n < NBLOCKS; n++) {
+        p[n] = malloc_heap_alloc(heap, 8 + n * 4);
+        if (!p[n])
+            break;
+        if ((char *)p[n] < buf || (char *)p[n] + 8 + n * 4 > buf + size
+            || (uintptr_t)p[n] % _Alignof(max_align_t) != 0) {
+            printf("%s: block %d at %p outside the heap\n", which, n, p[n]);
+            result = 1;
+        }
+        memset(p[n], n, 8 + n * 4);
+    }
+    if (n == NBLOCKS || errno != ENOMEM) {
+        printf("%s: heap did not run out (%d blocks)\n", which, n);
+        result = 1;
+    }
+    for (i = 0; i < n; i++) {
+        unsigned char *q = p[i];
+        if (q[0] != i || q[8 + i * 4 - 1] != i) {
+            printf("%s: block %d overwritten\n", which, i);
+            result = 1;
+        }
+    }
+
+    /* Release every other block, then the rest; all must merge again */
+    for (i = 0; i < n; i += 2)
+        malloc_heap_free(heap, p[i]);
+    info = malloc_heap_info(heap);
+    if (info.nfree < (size_t)n / 2 || info.in_use == 0) {
+        printf("%s: %zu free blocks after releasing half\n", which, info.nfree);
+        result = 1;
+    }
+    for (i = 1; i < n; i += 2)
+        malloc_heap_free(heap, p[i]);
+    info = malloc_heap_info(heap);
+    if (info.nfree != 1 || info.free != start.free || info.in_use != 0 || info.peak == 0) {
+        printf("%s: after freeing all, %zu free in %zu blocks\n", which, info.free, info.nfree);
+        result = 1;
+    }
+
+    /* Merging with both neighbours at once */
+    a = malloc_heap_alloc(heap, 40);
+    b = malloc_heap_alloc(heap, 40);
+    c = malloc_heap_alloc(heap, 40);
+    malloc_heap_free(heap, a);
+    malloc_heap_free(heap, c);
+    malloc_heap_free(heap, b);
+    info = malloc_heap_info(heap);
+    if (info.nfree != 1 || info.free != start.free) {
+        printf("%s: three blocks did not merge\n", which);
+        result = 1;
+    }
+
+    /* Double free and foreign pointers are refused */
+    a = malloc_heap_alloc(heap, 16);
+    b = malloc_heap_alloc(heap, 16);
+    malloc_heap_free(heap, a);
+    errno = 0;
+    malloc_heap_free(heap, a);
+    if (errno != ENOMEM) {
+        printf("%s: double free not detected\n", which);
+        result = 1;
+    }
+    errno = 0;
+    malloc_heap_free(heap, buf_a == buf ? buf_b + 64 : buf_a + 64);
+    if (errno != EINVAL) {
+        printf("%s: foreign pointer not detected\n", which);
+        result = 1;
+    }
+    malloc_heap_free(heap, b);
+
+    info = malloc_heap_info(heap);
+    if (malloc_heap_alloc(heap, info.largest) == NULL || malloc_heap_alloc(heap, 1) != NULL) {
+        printf("%s: largest %zu is wrong\n", which, info.largest);
+        result = 1;
+    }
+    return result;
+}
+
+int
+main(void)
+{
+    struct malloc_heap *a, *b;
+    void               *p;
+    int                 result = 0;
+
+    a = malloc_heap_create(buf_a, sizeof(buf_a));
+    /* Deliberately misaligned */
+    b = malloc_heap_create(buf_b + 3, sizeof(buf_b) - 3);
+    if (!a || !b) {
+        printf("malloc_heap_create failed\n");
+        return 1;
+    }
+
+    /* The heaps and malloc do not share memory */
+    p = malloc(100);
+    result |= check_heap(a, "a", buf_a, sizeof(buf_a));
+    result |= check_heap(b, "b", buf_b, sizeof(buf_b));
+    free(p);
+
+    if (malloc_heap_create(buf_a, 8) != NULL || malloc_heap_create(NULL, 1024) != NULL) {
+        printf("malloc_heap_create accepted a bad region\n");
+        result = 1;
+    }
+
+    malloc_heap_destroy(a);
+    malloc_heap_destroy(b);
+    return result;
+}
@@ -0,0 +1,213 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <malloc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __MALLOC_PROFILE
+
+static unsigned char trace[1024];
+static size_t        trace_len;
+static size_t        trace_pos;
+static uintptr_t     trace_last;
+
+/* Short writes, to cover the buffer flushing */
+static ssize_t
+trace_write(void *cookie, const void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > 5)
+        n = 5;
+    if (n > sizeof(trace) - trace_len)
+        return -1;
+    memcpy(trace + trace_len, buf, n);
+    trace_len += n;
+    return n;
+}
+
+static ssize_t
+full_write(void *cookie, const void *buf, size_t n)
+{
+    (void)cookie;
+    (void)buf;
+    (void)n;
+    return -1;
+}
+
+static uintmax_t
+get_num(void)
+{
+    uintmax_t v = 0;
+    unsigned  shift = 0;
+
+    while (trace_pos < trace_len) {
+        unsigned char c = trace[trace_pos++];
+        v |= (uintmax_t)(c & 0x7f) << shift;
+        if (!(c & 0x80))
+            break;
+        shift += 7;
+    }
+    return v;
+}
+
+static uintptr_t
+get_ptr(void)
+{
+    uintptr_t d = get_num();
+
+    if (!d)
+        return 0;
+    d--;
+    d = (d >> 1) ^ -(d & 1);
+    trace_last += d;
+    return trace_last;
+}
+
+static int
+check(int op, uintptr_t ptr, uintptr_t old, size_t align, size_t size)
+{
+    int       got_op;
+    uintptr_t got_ptr, got_old = 0;
+    size_t    got_align = 0, got_size = 0;
+
+    if (trace_pos >= trace_len) {
+        printf("trace ends before op %d\n", op);
+        return 1;
+    }
+    got_op = trace[trace_pos++];
+    got_ptr = get_ptr();
+    switch (got_op) {
+    case MALLOC_TRACE_FREE:
+        break;
+    case MALLOC_TRACE_REALLOC:
+        got_old = get_ptr();
+        got_size = get_num();
+        break;
+    case MALLOC_TRACE_MEMALIGN:
+        got_align = get_num();
+        got_size = get_num();
+        break;
+    default:
+        got_size = get_num();
+        break;
+    }
+    if (got_op != op || got_ptr != ptr || got_old != old || got_align != align
+        || got_size != size) {
+        printf("record %d %#lx %#lx %zu %zu, want %d %#lx %#lx %zu %zu\n", got_op,
+               (unsigned long)got_ptr, (unsigned long)got_old, got_align, got_size, op,
+               (unsigned long)ptr, (unsigned long)old, align, size);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    int       result = 0;
+    void     *p, *q, *r;
+    uintptr_t up, uq, uo, ur, un;
+    int       i;
+
+    if (malloc_trace_start(NULL, NULL) != -1) {
+        printf("malloc_trace_start accepted no write function\n");
+        result = 1;
+    }
+
+    if (malloc_trace_start(trace_write, NULL) != 0) {
+        printf("malloc_trace_start failed\n");
+        return 1;
+    }
+    p = malloc(24);
+    q = calloc(3, 8);
+    uo = (uintptr_t)q;
+    q = realloc(q, 100);
+    r = memalign(64, 32);
+    un = (uintptr_t)malloc(SIZE_MAX / 2);
+    up = (uintptr_t)p;
+    uq = (uintptr_t)q;
+    ur = (uintptr_t)r;
+    free(p);
+    free(q);
+    free(r);
+    if (malloc_trace_stop() != 0) {
+        printf("malloc_trace_stop failed\n");
+        result = 1;
+    }
+    /* Not traced */
+    free(malloc(10));
+
+    if (trace_len < 4 || memcmp(trace, "MTR1", 4) != 0) {
+        printf("trace magic missing\n");
+        return 1;
+    }
+    trace_pos = 4;
+    result |= check(MALLOC_TRACE_MALLOC, up, 0, 0, 24);
+    result |= check(MALLOC_TRACE_CALLOC, uo, 0, 0, 24);
+    result |= check(MALLOC_TRACE_REALLOC, uq, uo, 0, 100);
+    result |= check(MALLOC_TRACE_MEMALIGN, ur, 0, 64, 32);
+    result |= check(MALLOC_TRACE_MALLOC, un, 0, 0, SIZE_MAX / 2);
+    result |= check(MALLOC_TRACE_FREE, up, 0, 0, 0);
+    result |= check(MALLOC_TRACE_FREE, uq, 0, 0, 0);
+    result |= check(MALLOC_TRACE_FREE, ur, 0, 0, 0);
+    if (trace_pos != trace_len) {
+        printf("%zu bytes left in the trace\n", trace_len - trace_pos);
+        result = 1;
+    }
+
+    /* A failing write ends the trace and is reported by the stop */
+    malloc_trace_start(full_write, NULL);
+    for (i = 0; i < 100; i++)
+        free(malloc(16));
+    if (malloc_trace_stop() != -1) {
+        printf("malloc_trace_stop missed the write error\n");
+        result = 1;
+    }
+    return result;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("malloc tracing not enabled, skipping\n");
+    return 77;
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that free memory at the top of the heap goes back to sbrk,
+ * from malloc_trim and automatically past the mallopt threshold, and
+ * that the heap grows again normally afterwards.
+ */
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t
+arena(void)
+{
+    return mallinfo().arena;
+}
+
+int
+main(void)
+{
+    int    ret = 0;
+    char  *pin, *p;
+    size_t base;
+
+    /* The first checks expect no top pad, whatever the build default */
+    if (mallopt(M_TOP_PAD, 0) != 1) {
+        printf("mallopt rejected M_TOP_PAD 0\n");
+        return 1;
+    }
+
+    pin = malloc(64);
+    if (!pin)
+        return 1;
+    base = arena();
+
+    /* Below the default threshold nothing is released */
+    p = malloc(16 * 1024);
+    free(p);
+    if (arena() == base) {
+        printf("16k allocation didn't grow the heap\n");
+        ret = 1;
+    }
+    if (mallinfo().keepcost < 16 * 1024) {
+        printf("keepcost %zu after freeing 16k at the top\n", (size_t)mallinfo().keepcost);
+        ret = 1;
+    }
+
+    /* malloc_trim releases it, and reports when there's nothing left */
+    if (malloc_trim(0) != 1 || arena() != base) {
+        printf("malloc_trim(0) left the heap at %zu, not %zu\n", arena(), base);
+        ret = 1;
+    }
+    if (malloc_trim(0) != 0) {
+        printf("malloc_trim(0) released memory twice\n");
+        ret = 1;
+    }
+
+    /* Past the threshold, free trims down to the top pad */
+    if (mallopt(M_TRIM_THRESHOLD, 4096) != 1 || mallopt(M_TOP_PAD, 1024) != 1) {
+        printf("mallopt rejected trim settings\n");
+        ret = 1;
+    }
+    p = malloc(32 * 1024);
+    if (p) {
+        memset(p, 0x55, 32 * 1024);
+        free(p);
+    }
+    if (arena() > base + 2048) {
+        printf("free left the heap at %zu past the top pad\n", arena() - base);
+        ret = 1;
+    }
+
+    /* The heap still grows, and the remaining block is intact */
+    p = malloc(64 * 1024);
+    if (!p) {
+        printf("malloc after trimming failed\n");
+        ret = 1;
+    } else {
+        memset(p, 0xaa, 64 * 1024);
+        free(p);
+    }
+    memset(pin, 0x11, 64);
+    free(pin);
+
+    if (mallopt(M_TOP_PAD, -1) != 0 || mallopt(M_MXFAST, 0) != 0) {
+        printf("mallopt accepted an unsupported setting\n");
+        ret = 1;
+    }
+    return ret;
+}
@@ -34,6 +34,7 @@
  */
 
 #define _GNU_SOURCE
+#define _ISOC23_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
@@ -85,7 +86,22 @@ main(void)
         printf("memalign(128, 237) unaligned (%p)\n", r);
         result = 1;
     }
-    free(r);
+    free_aligned_sized(r, 128, 237);
+
+    /* Sized frees of small and large blocks must reuse them like free */
+    for (pow = 0; pow < 12; pow++) {
+        size_t n = (size_t)1 << pow;
+
+        r = malloc(n);
+        free_sized(r, n);
+        q = malloc(n);
+        free_sized(q, n);
+        if (!r || !q) {
+            printf("malloc(%zu) after free_sized failed\n", n);
+            result = 1;
+        }
+    }
+    free_sized(NULL, 0);
 
     r = NULL;
     err = posix_memalign(&r, 128, 237);
@@ -238,6 +254,52 @@ main(void)
     }
 #endif
 
+    /* calloc must clear recycled memory even when malloc does not */
+    wrong = 0;
+    char *czero = malloc(128);
+    if (czero) {
+        memset(czero, 0xa5, 128);
+        free(czero);
+        czero = calloc(1, 128);
+        if (czero) {
+            for (pow = 0; pow < 128; pow++)
+                if (czero[pow] != 0)
+                    wrong++;
+        }
+        free(czero);
+    }
+    if (wrong) {
+        printf("calloc: %d bytes of memory not cleared\n", wrong);
+        result = 1;
+    }
+
+    /* realloc may grow into free space on either side of the block */
+    wrong = 0;
+    char *before = malloc(256);
+    char *grow = malloc(64);
+    char *after = malloc(64);
+    if (before && grow && after) {
+        for (pow = 0; pow < 64; pow++)
+            grow[pow] = pow + 3;
+        free(before);
+        free(after);
+        char *grown = realloc(grow, 320);
+        if (grown) {
+            grow = grown;
+            for (pow = 0; pow < 64; pow++)
+                if (grow[pow] != (char)(pow + 3))
+                    wrong++;
+        }
+        before = after = NULL;
+    }
+    free(before);
+    free(grow);
+    free(after);
+    if (wrong) {
+        printf("realloc: %d bytes of data lost while growing\n", wrong);
+        result = 1;
+    }
+
     /* make sure realloc doesn't read past the source */
 
     void *big = malloc(1024);
@@ -253,7 +315,7 @@ main(void)
             char *med = realloc(small, 1024);
             if (med) {
 //                                printf("med %p\n", med);
-#ifdef __NANO_MALLOC
+#if defined(__NANO_MALLOC) && defined(__MALLOC_CLEAR_ALLOCATED)
                 int i;
                 for (i = 128; i < 1024; i++)
                     if (med[i] != 0) {
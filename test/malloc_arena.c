@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <malloc.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static char buffer[256] __attribute__((aligned(16)));
+
+static int
+check_arena(struct malloc_arena *arena, const char *which, size_t size)
+{
+    int    result = 0;
+    char  *a, *b, *s;
+    size_t mark;
+
+    a = malloc_arena_alloc(arena, 10, 0);
+    b = malloc_arena_alloc(arena, 10, 0);
+    if (!a || !b || b < a + 10 || (uintptr_t)b % _Alignof(max_align_t) != 0) {
+        printf("%s: bad allocations %p %p\n", which, a, b);
+        result = 1;
+    }
+
+    mark = malloc_arena_mark(arena);
+    if (malloc_arena_asprintf(arena, &s, "%s-%d", "abc", 42) != 6 || strcmp(s, "abc-42") != 0) {
+        printf("%s: malloc_arena_asprintf failed\n", which);
+        result = 1;
+    }
+    malloc_arena_rewind(arena, mark);
+    if (malloc_arena_alloc(arena, 1, 1) != s) {
+        printf("%s: rewind did not reclaim string\n", which);
+        result = 1;
+    }
+
+    if (malloc_arena_alloc(arena, 8, 3) != NULL) {
+        printf("%s: non power of two alignment accepted\n", which);
+        result = 1;
+    }
+
+    if (malloc_arena_alloc(arena, size, 1) != NULL) {
+        printf("%s: oversized allocation succeeded\n", which);
+        result = 1;
+    }
+
+    malloc_arena_reset(arena);
+    if (malloc_arena_alloc(arena, 10, 0) != a) {
+        printf("%s: reset did not reclaim arena\n", which);
+        result = 1;
+    }
+    return result;
+}
+
+int
+main(void)
+{
+    struct malloc_arena *arena;
+    int                  result = 0;
+
+    arena = malloc_arena_create(buffer, sizeof(buffer));
+    if (!arena) {
+        printf("malloc_arena_create from buffer failed\n");
+        return 1;
+    }
+    result += check_arena(arena, "buffer", sizeof(buffer));
+    malloc_arena_destroy(arena);
+
+    arena = malloc_arena_create(NULL, 1024);
+    if (!arena) {
+        printf("malloc_arena_create from heap failed\n");
+        return 1;
+    }
+    result += check_arena(arena, "heap", 1024);
+    malloc_arena_destroy(arena);
+
+    if (malloc_arena_create(buffer, 1) != NULL) {
+        printf("malloc_arena_create from tiny buffer succeeded\n");
+        result = 1;
+    }
+
+    return result != 0;
+}
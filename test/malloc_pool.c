@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <malloc.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define OBJ_SIZE  24
+#define OBJ_COUNT 16
+#define NUM_OBJ   (OBJ_COUNT * 3 + 5)
+
+static unsigned char *objs[NUM_OBJ];
+
+int
+main(void)
+{
+    struct malloc_pool     *pool;
+    struct malloc_pool_info info;
+    int                     i, j;
+    int                     result = 0;
+
+    pool = malloc_pool_create(OBJ_SIZE, OBJ_COUNT);
+    if (!pool) {
+        printf("malloc_pool_create failed\n");
+        return 1;
+    }
+
+    info = malloc_pool_info(pool);
+    if (info.objsize < OBJ_SIZE || info.nslabs != 1 || info.nobjs != OBJ_COUNT
+        || info.nfree != OBJ_COUNT) {
+        printf("bad initial pool info: size %zu slabs %zu objs %zu free %zu\n", info.objsize,
+               info.nslabs, info.nobjs, info.nfree);
+        result = 1;
+    }
+
+    /* Allocate enough to force the pool to grow */
+    for (i = 0; i < NUM_OBJ; i++) {
+        objs[i] = malloc_pool_alloc(pool);
+        if (!objs[i]) {
+            printf("malloc_pool_alloc %d failed\n", i);
+            return 1;
+        }
+        if ((uintptr_t)objs[i] % _Alignof(max_align_t) != 0) {
+            printf("object %d misaligned %p\n", i, objs[i]);
+            result = 1;
+        }
+        memset(objs[i], i, OBJ_SIZE);
+    }
+
+    for (i = 0; i < NUM_OBJ; i++)
+        for (j = 0; j < OBJ_SIZE; j++)
+            if (objs[i][j] != (unsigned char)i) {
+                printf("object %d overwritten at %d\n", i, j);
+                result = 1;
+                break;
+            }
+
+    info = malloc_pool_info(pool);
+    if (info.nslabs != 4 || info.nfree != info.nobjs - NUM_OBJ || info.peak != NUM_OBJ) {
+        printf("bad pool info: slabs %zu objs %zu free %zu peak %zu\n", info.nslabs, info.nobjs,
+               info.nfree, info.peak);
+        result = 1;
+    }
+
+    /* Freed objects are reused before the pool grows again */
+    for (i = 0; i < NUM_OBJ; i += 2)
+        malloc_pool_free(pool, objs[i]);
+    malloc_pool_free(pool, NULL);
+    for (i = 0; i < NUM_OBJ; i += 2)
+        objs[i] = malloc_pool_alloc(pool);
+
+    info = malloc_pool_info(pool);
+    if (info.nslabs != 4 || info.peak != NUM_OBJ) {
+        printf("pool grew when reusing objects: slabs %zu peak %zu\n", info.nslabs, info.peak);
+        result = 1;
+    }
+
+    malloc_pool_destroy(pool);
+
+    if (malloc_pool_create(OBJ_SIZE, 0) != NULL) {
+        printf("malloc_pool_create with zero count succeeded\n");
+        result = 1;
+    }
+
+    return result;
+}
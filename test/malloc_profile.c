@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char info[4096];
+
+#ifdef __MALLOC_PROFILE
+static int   hook_events[3];
+static void *hook_ptr;
+
+static void
+hook(int event, void *ptr, void *old, size_t size, void *caller)
+{
+    (void)old;
+    (void)size;
+    (void)caller;
+    if (event >= 0 && event < 3)
+        hook_events[event]++;
+    hook_ptr = ptr;
+}
+#endif
+
+int
+main(void)
+{
+    int   result = 0;
+    FILE *f;
+    char *p;
+
+    p = malloc(100);
+    free(malloc(1000));
+
+    errno = 0;
+    if (malloc_info(1, stdout) != -1 || errno != EINVAL) {
+        printf("malloc_info accepted bad options\n");
+        result = 1;
+    }
+
+    f = fmemopen(info, sizeof(info) - 1, "w");
+    if (!f) {
+        printf("fmemopen failed\n");
+        return 1;
+    }
+    if (malloc_info(0, f) != 0) {
+        printf("malloc_info failed\n");
+        result = 1;
+    }
+    fclose(f);
+    if (strncmp(info, "<malloc version=\"1\">", 20) != 0 || !strstr(info, "</malloc>")) {
+        printf("malloc_info output malformed:\n%s\n", info);
+        result = 1;
+    }
+
+#ifdef __MALLOC_PROFILE
+    struct malloc_profile prof;
+    char                 *q;
+
+    malloc_profile_reset();
+    malloc_set_hook(hook);
+
+    q = malloc(40);
+    if (hook_ptr != q) {
+        printf("hook missed malloc\n");
+        result = 1;
+    }
+    q = realloc(q, 30);
+    free(q);
+    if (hook_ptr != q) {
+        printf("hook missed free\n");
+        result = 1;
+    }
+    if (malloc_set_hook(NULL) != hook) {
+        printf("malloc_set_hook returned the wrong hook\n");
+        result = 1;
+    }
+    if (hook_events[MALLOC_EVENT_MALLOC] < 1 || hook_events[MALLOC_EVENT_FREE] < 1
+        || hook_events[MALLOC_EVENT_REALLOC] != 1) {
+        printf("hook events %d %d %d\n", hook_events[0], hook_events[1], hook_events[2]);
+        result = 1;
+    }
+
+    malloc_profile(&prof);
+    if (prof.nmalloc < 1 || prof.nfree < 1 || prof.nrealloc != 1 || prof.hist[6] < 1) {
+        printf("profile counts %lu %lu %lu\n", (unsigned long)prof.nmalloc,
+               (unsigned long)prof.nfree, (unsigned long)prof.nrealloc);
+        result = 1;
+    }
+    if (prof.peak < 40 || prof.in_use > prof.peak) {
+        printf("profile in_use %lu peak %lu\n", (unsigned long)prof.in_use,
+               (unsigned long)prof.peak);
+        result = 1;
+    }
+#endif
+
+    free(p);
+    return result;
+}
@@ -145,10 +145,13 @@ check_malloc(size_t in_use)
         printf("non-free bytes in arena %zu free %zu\n", info.arena, info.fordblks);
         result++;
     }
+#if !defined(__MALLOC_SIZE_BINS) && !defined(__MALLOC_THREAD_CACHE)
+    /* Binned and cached chunks stay apart from the free list */
     if (in_use == 0 && info.ordblks != 1) {
         printf("%zd blocks free\n", info.ordblks);
         result++;
     }
+#endif
     if (info.uordblks < in_use) {
         printf("expected at least %zu in use (%zu)\n", in_use, info.uordblks);
         result++;
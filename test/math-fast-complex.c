@@ -0,0 +1,47 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Linked against libmfast: complex float products and quotients, which
+ * the compiler turns into __mulsc3 and __divsc3 calls, and cexpf,
+ * clogf and cabsf must give the usual results for finite arguments.
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+
+static volatile float complex a = CMPLXF(3.0f, -4.0f), b = CMPLXF(0.5f, 2.0f);
+static volatile float complex tiny = CMPLXF(1e-30f, -2e-30f);
+
+static int
+near(float complex got, float complex want, const char *what)
+{
+    float err = cabsf(got - want);
+
+    if (!(err <= 1e-5f * cabsf(want))) {
+        printf("%s: got %g%+gi want %g%+gi\n", what, (double)crealf(got), (double)cimagf(got),
+               (double)crealf(want), (double)cimagf(want));
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    int ret = 0;
+
+    ret |= near(a * b, CMPLXF(9.5f, 4.0f), "a * b");
+    ret |= near(a / b, CMPLXF(-6.5f / 4.25f, -8.0f / 4.25f), "a / b");
+    ret |= near(b / a, CMPLXF(-6.5f / 25.0f, 8.0f / 25.0f), "b / a");
+    ret |= near(a / tiny, CMPLXF(2.2e30f, 0.4e30f), "a / tiny");
+    ret |= near(cexpf(b), CMPLXF(expf(0.5f) * cosf(2.0f), expf(0.5f) * sinf(2.0f)), "cexpf");
+    ret |= near(clogf(a), CMPLXF(logf(5.0f), atan2f(-4.0f, 3.0f)), "clogf");
+    if (fabsf(cabsf(a) - 5.0f) > 1e-6f) {
+        printf("cabsf: got %g\n", (double)cabsf(a));
+        ret = 1;
+    }
+    return ret;
+}
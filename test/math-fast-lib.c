@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Linked against libmfast: error cases must return the IEEE results
+ * without touching errno, and math_errhandling must say so.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+
+static volatile double zero = 0.0, big = 1000.0, neg = -1.0;
+static volatile float  zerof = 0.0f, bigf = 200.0f, negf = -1.0f;
+
+#define CHECK(expr, good)                                    \
+    do {                                                     \
+        errno = 0;                                           \
+        if (!(good)) {                                       \
+            printf("%s: wrong value\n", #expr);              \
+            ret = 1;                                         \
+        }                                                    \
+        if (errno != 0) {                                    \
+            printf("%s: errno set to %d\n", #expr, errno);   \
+            ret = 1;                                         \
+        }                                                    \
+    } while (0)
+
+int
+main(void)
+{
+    int ret = 0;
+
+    if (math_errhandling != 0) {
+        printf("math_errhandling is %d\n", math_errhandling);
+        ret = 1;
+    }
+
+    CHECK(log(0), log(zero) == -INFINITY);
+    CHECK(exp(1000), exp(big) == INFINITY);
+    CHECK(exp(-1000), exp(-big) == 0.0);
+    CHECK(sqrt(-1), isnan(sqrt(neg)));
+    CHECK(pow(0, -1), pow(zero, neg) == INFINITY);
+    CHECK(acos(-2), isnan(acos(2 * neg)));
+    CHECK(logf(0), logf(zerof) == -INFINITY);
+    CHECK(expf(200), expf(bigf) == INFINITY);
+    CHECK(sqrtf(-1), isnan(sqrtf(negf)));
+    CHECK(powf(0, -1), powf(zerof, negf) == INFINITY);
+
+    CHECK(exp(1), fabs(exp(-neg) - M_E) < 1e-15);
+    CHECK(sinf(0), sinf(zerof) == 0.0f);
+    return ret;
+}
@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check the error of sinf, cosf, expf, exp2f, logf, log2f, sqrtf and
+ * powf against the double precision functions over a pseudo-random
+ * set of arguments.
+ * This covers both the generic code and the m65832 fixed-point
+ * variants, which are documented to stay below 0.54 ULP.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SAMPLES 2000
+
+static uint32_t seed = 0x12345678;
+
+static uint32_t
+next_bits(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed ^ (seed >> 15);
+}
+
+static float
+from_bits(uint32_t b)
+{
+    float f;
+
+    memcpy(&f, &b, sizeof(f));
+    return f;
+}
+
+/* Error of got in units of the last place of want */
+static double
+ulp_error(float got, double want)
+{
+    int e;
+
+    if (isnan(want))
+        return isnan(got) ? 0.0 : 1e9;
+    if (isinf(got))
+        return (isinf(want) || fabs(want) > 0x1.fffffep127) && (got > 0) == (want > 0) ? 0.0 : 1e9;
+    if (fabs(want) < 0x1p-126)
+        e = -149;
+    else {
+        (void)frexp(want, &e);
+        e -= 24;
+    }
+    return fabs((double)got - want) / ldexp(1.0, e);
+}
+
+struct func {
+    const char *name;
+    float (*f)(float);
+    double (*d)(double);
+    uint32_t lo, hi; /* argument bit patterns */
+    double   bound;
+};
+
+static const struct func funcs[] = {
+    { "sinf", sinf, sin, 0x00000000, 0x7f7fffff, 1.0 },
+    { "sinf", sinf, sin, 0x3c000000, 0x43000000, 1.0 },
+    { "cosf", cosf, cos, 0x00000000, 0x7f7fffff, 1.0 },
+    { "cosf", cosf, cos, 0x3c000000, 0x43000000, 1.0 },
+    { "expf", expf, exp, 0x00000000, 0x42b17216, 1.0 },
+    { "expf", expf, exp, 0x80000000, 0xc2cff1b4, 1.0 },
+    { "logf", logf, log, 0x00000001, 0x7f7fffff, 1.0 },
+    { "logf", logf, log, 0x3f400000, 0x3fa00000, 1.0 },
+    { "exp2f", exp2f, exp2, 0x00000000, 0x42fffffe, 1.0 },
+    { "exp2f", exp2f, exp2, 0x80000000, 0xc3160000, 1.0 },
+    { "log2f", log2f, log2, 0x00000001, 0x7f7fffff, 1.0 },
+    { "log2f", log2f, log2, 0x3f400000, 0x3fa00000, 1.0 },
+    { "sqrtf", sqrtf, sqrt, 0x00000001, 0x7f7fffff, 0.5 },
+};
+
+#define NFUNCS (sizeof(funcs) / sizeof(funcs[0]))
+
+static const float specials[] = {
+    0.0f, -0.0f, 1.0f, -1.0f, 0x1p-149f, 0x1.fffffep127f, INFINITY, -INFINITY,
+};
+
+#define NSPECIALS (sizeof(specials) / sizeof(specials[0]))
+
+int
+main(void)
+{
+    unsigned i, s;
+    int      ret = 0;
+
+    for (i = 0; i < NFUNCS; i++) {
+        const struct func *fn = &funcs[i];
+        double             worst = 0.0;
+        float              worst_x = 0.0f;
+
+        for (s = 0; s < SAMPLES + NSPECIALS; s++) {
+            float  x;
+            double err;
+
+            if (s < NSPECIALS)
+                x = specials[s];
+            else
+                x = from_bits(fn->lo + next_bits() % (fn->hi - fn->lo + 1));
+            err = ulp_error(fn->f(x), fn->d(x));
+            if (err > worst) {
+                worst = err;
+                worst_x = x;
+            }
+        }
+        printf("%-6s [%a, %a]: max error %.3f ULP at %a\n", fn->name, (double)from_bits(fn->lo),
+               (double)from_bits(fn->hi), worst, (double)worst_x);
+        if (worst > fn->bound) {
+            printf("%s: error above %.1f ULP\n", fn->name, fn->bound);
+            ret = 1;
+        }
+    }
+
+    /* powf with y chosen so that |y log(x)| < 100 */
+    {
+        double worst = 0.0;
+        float  worst_x = 0.0f, worst_y = 0.0f;
+
+        for (s = 0; s < SAMPLES; s++) {
+            float  x = from_bits(0x00800000 + next_bits() % 0x7f000000);
+            double l = log(x), err;
+            float  y;
+
+            if (l == 0.0)
+                continue;
+            y = (float)((double)(int32_t)next_bits() / 0x1p31 * 100.0 / l);
+            err = ulp_error(powf(x, y), pow(x, y));
+            if (err > worst) {
+                worst = err;
+                worst_x = x;
+                worst_y = y;
+            }
+        }
+        printf("powf: max error %.3f ULP at %a, %a\n", worst, (double)worst_x, (double)worst_y);
+        if (worst > 1.0) {
+            printf("powf: error above 1.0 ULP\n");
+            ret = 1;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check tgamma and lgamma at the integers and half-integers they look
+ * up in a table: factorials must come back exact, half-integers within
+ * rounding of the double factorial times sqrt(pi), and lgamma must be
+ * the log of the same value with a positive signgam.
+ */
+
+#define _DEFAULT_SOURCE
+#include <math.h>
+#include <stdio.h>
+
+#define SQRT_PI 1.77245385090551602730
+
+int
+main(void)
+{
+    int    ret = 0;
+    int    n;
+    double fact = 1, dfact = 1;
+
+    for (n = 1; n <= 23; n++) {
+        double x = n, half = n - 0.5;
+        double want_half = dfact * SQRT_PI;
+
+        /* fact = (n-1)!, exact in double up to 22! */
+        if (tgamma(x) != fact) {
+            printf("tgamma(%g) = %a, want %a\n", x, tgamma(x), fact);
+            ret = 1;
+        }
+        if (tgammaf((float)x) != (float)fact) {
+            printf("tgammaf(%g) = %a, want %a\n", x, (double)tgammaf((float)x), (double)(float)fact);
+            ret = 1;
+        }
+        /* Gamma(n - 1/2) = (2n-3)!! / 2^(n-1) sqrt(pi), rounded along the way */
+        if (fabs(tgamma(half) - want_half) > want_half * 0x1p-47) {
+            printf("tgamma(%g) = %a, want %a\n", half, tgamma(half), want_half);
+            ret = 1;
+        }
+        if (fabsf(tgammaf((float)half) - (float)want_half) > (float)want_half * 0x1p-22f) {
+            printf("tgammaf(%g) = %a, want %a\n", half, (double)tgammaf((float)half),
+                   (double)(float)want_half);
+            ret = 1;
+        }
+        signgam = 0;
+        if (lgamma(x) != log(tgamma(x)) || lgamma(half) != log(tgamma(half)) || signgam != 1) {
+            printf("lgamma(%g) = %a, lgamma(%g) = %a, signgam %d\n", x, lgamma(x), half,
+                   lgamma(half), signgam);
+            ret = 1;
+        }
+        if (lgammaf((float)x) != logf(tgammaf((float)x))) {
+            printf("lgammaf(%g) = %a\n", x, (double)lgammaf((float)x));
+            ret = 1;
+        }
+        fact *= n;
+        dfact *= half;
+    }
+    return ret;
+}
@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check pown, powr, rootn and compoundn: the C23 special cases, exact
+ * powers and roots that must come out exact, and the small-integer
+ * fast path in pow and powf agreeing with pown and with plain
+ * repeated multiplication.
+ */
+
+#define _ISOC23_SOURCE
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SAMPLES 2000
+
+static uint32_t seed = 0x2545f491;
+
+static uint32_t
+next_bits(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static int
+same(double a, double b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0 || (isnan(a) && isnan(b));
+}
+
+static int ret;
+
+#define CHECK(expr, want)                                                      \
+    do {                                                                       \
+        double got_ = (expr);                                                  \
+        if (!same(got_, (want))) {                                             \
+            printf("%s = %a, want %a\n", #expr, got_, (double)(want));         \
+            ret = 1;                                                           \
+        }                                                                      \
+    } while (0)
+
+#define CHECKF(expr, want)                                                     \
+    do {                                                                       \
+        float got_ = (expr);                                                   \
+        if (!same(got_, (float)(want))) {                                      \
+            printf("%s = %a, want %a\n", #expr, (double)got_, (double)(want)); \
+            ret = 1;                                                           \
+        }                                                                      \
+    } while (0)
+
+/* within n ulps of want */
+static int
+close_to(double got, double want, int n)
+{
+    if (got == want)
+        return 1;
+    return fabs(got - want) <= n * (nextafter(fabs(want), INFINITY) - fabs(want));
+}
+
+int
+main(void)
+{
+    unsigned i;
+
+    CHECK(pown(NAN, 0), 1.0);
+    CHECK(pown(-0.0, 3), -0.0);
+    CHECK(pown(-0.0, 2), 0.0);
+    CHECK(pown(-0.0, -3), -INFINITY);
+    CHECK(pown(-0.0, -2), INFINITY);
+    CHECK(pown(-INFINITY, 3), -INFINITY);
+    CHECK(pown(-INFINITY, -3), -0.0);
+    CHECK(pown(-INFINITY, -2), 0.0);
+    CHECK(pown(3.0, 33), 5559060566555523.0);
+    CHECK(pown(-3.0, 33), -5559060566555523.0);
+    CHECK(pown(1.5, 20), 3486784401.0 / 1048576.0);
+    CHECK(pown(0.5, -3), 8.0);
+    CHECK(pown(-2.0, -3), -0.125);
+    CHECK(pown(2.0, -1074), 0x1p-1074);
+    CHECK(pown(2.0, 1023), 0x1p1023);
+    CHECK(pown(2.0, 1024), INFINITY);
+    CHECK(pown(-2.0, 1025), -INFINITY);
+    CHECK(pown(2.0, -1080), 0.0);
+    CHECK(pown(1.0, 0x7fffffffffffffffLL), 1.0);
+    CHECK(pown(-1.0, 0x7fffffffffffffffLL), -1.0);
+    CHECK(pown(-1.0, (long long)-0x7fffffffffffffffLL - 1), 1.0);
+    /* e^(1 - 2^-53), needs every bit of the double-double product */
+    CHECK(pown(1 + 0x1p-52, 1LL << 52), 0x1.5bf0a8b145769p+1);
+
+    CHECK(rootn(8.0, 0), NAN);
+    CHECK(rootn(-8.0, 2), NAN);
+    CHECK(rootn(-INFINITY, 4), NAN);
+    CHECK(rootn(-0.0, 3), -0.0);
+    CHECK(rootn(-0.0, 4), 0.0);
+    CHECK(rootn(-0.0, -3), -INFINITY);
+    CHECK(rootn(-0.0, -4), INFINITY);
+    CHECK(rootn(-INFINITY, 3), -INFINITY);
+    CHECK(rootn(-INFINITY, -3), -0.0);
+    CHECK(rootn(-27.0, 3), -3.0);
+    CHECK(rootn(1024.0, 10), 2.0);
+    CHECK(rootn(1024.0, -10), 0.5);
+    CHECK(rootn(5559060566555523.0, 33), 3.0);
+    CHECK(rootn(-5559060566555523.0, 33), -3.0);
+    CHECK(rootn(0x1p-1074, 1074), 0.5);
+    CHECK(rootn(0x1p-1074, -1074), 2.0);
+    CHECK(rootn(0x1p1000, 125), 256.0);
+
+    CHECK(powr(-1.0, 2.0), NAN);
+    CHECK(powr(0.0, 0.0), NAN);
+    CHECK(powr(-0.0, -0.0), NAN);
+    CHECK(powr(INFINITY, 0.0), NAN);
+    CHECK(powr(1.0, INFINITY), NAN);
+    CHECK(powr(1.0, 3.5), 1.0);
+    CHECK(powr(-0.0, -1.0), INFINITY);
+    CHECK(powr(0.0, -INFINITY), INFINITY);
+    CHECK(powr(-0.0, 3.0), 0.0);
+    CHECK(powr(INFINITY, -1.0), 0.0);
+    CHECK(powr(2.0, 0.0), 1.0);
+    CHECK(powr(2.0, 10.0), 1024.0);
+
+    CHECK(compoundn(-2.0, 1), NAN);
+    CHECK(compoundn(NAN, 0), 1.0);
+    CHECK(compoundn(NAN, 1), NAN);
+    CHECK(compoundn(-1.0, 2), 0.0);
+    CHECK(compoundn(-1.0, -1), INFINITY);
+    CHECK(compoundn(INFINITY, -1), 0.0);
+    CHECK(compoundn(1.0, 10), 1024.0);
+    CHECK(compoundn(0.5, 3), 3.375);
+    CHECK(compoundn(-0.5, -2), 4.0);
+    CHECK(compoundn(1.0, 1024), INFINITY);
+    /* 1 + 2^-60 is not a double, but (1 + 2^-60)^(2^60) is about e */
+    if (!close_to(compoundn(0x1p-60, 1LL << 60), M_E, 1)) {
+        printf("compoundn(0x1p-60, 2^60) = %a, want %a\n", compoundn(0x1p-60, 1LL << 60), M_E);
+        ret = 1;
+    }
+
+    CHECKF(pownf(-0.0f, -3), -INFINITY);
+    CHECKF(pownf(-2.0f, 3), -8.0f);
+    CHECKF(pownf(3.0f, 15), 14348907.0f);
+    CHECKF(pownf(2.0f, -149), 0x1p-149f);
+    CHECKF(pownf(2.0f, 128), INFINITY);
+    CHECKF(pownf(0.5f, 151), 0.0f);
+    CHECKF(rootnf(-27.0f, 3), -3.0f);
+    CHECKF(rootnf(-4.0f, 2), NAN);
+    CHECKF(rootnf(0x1p-149f, -1), INFINITY);
+    CHECKF(rootnf(14348907.0f, 15), 3.0f);
+    CHECKF(powrf(-1.0f, 2.0f), NAN);
+    CHECKF(powrf(2.0f, 10.0f), 1024.0f);
+    CHECKF(compoundnf(0.5f, 3), 3.375f);
+    CHECKF(compoundnf(-1.0f, -1), INFINITY);
+    CHECKF(compoundnf(1.0f, 128), INFINITY);
+
+    for (i = 0; i < SAMPLES; i++) {
+        uint32_t b = next_bits();
+        double   x = ldexp(1 + (double)(b >> 8) / 0x1p24, (int)(b & 0xff) % 64 - 32);
+        float    xf = (float)x;
+        int      n = 2 + (int)(next_bits() % 6), k;
+        double   m = x, p;
+        float    pf;
+
+        if (b & 0x80)
+            x = -x;
+        for (k = 1, m = x; k < n; k++)
+            m *= x;
+
+        p = pow(x, n);
+        if (!same(p, pown(x, n)) || !close_to(p, m, n)) {
+            printf("pow(%a, %d) = %a, pown %a, product %a\n", x, n, p, pown(x, n), m);
+            ret = 1;
+        }
+        p = pow(x, -n);
+        if (!same(p, pown(x, -n)) || !close_to(p, 1 / m, n + 1)) {
+            printf("pow(%a, %d) = %a, pown %a, 1/product %a\n", x, -n, p, pown(x, -n), 1 / m);
+            ret = 1;
+        }
+
+        xf = (float)x;
+        pf = powf(xf, (float)n);
+        if (!close_to(pf, (float)pown(xf, n), 1) || !close_to(pownf(xf, n), pf, 1)) {
+            printf("powf(%a, %d) = %a, pownf %a\n", (double)xf, n, (double)pf,
+                   (double)pownf(xf, n));
+            ret = 1;
+        }
+
+        p = fabs(x);
+        if (!close_to(pown(rootn(p, n + 3), n + 3), p, 2 * (n + 3))) {
+            printf("rootn(%a, %d) = %a\n", p, n + 3, rootn(p, n + 3));
+            ret = 1;
+        }
+    }
+    return ret;
+}
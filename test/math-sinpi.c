@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check sinpi, cospi and sincospi: exact values at multiples of 1/2
+ * with the signs C23 requires, agreement with sin and cos of pi * x
+ * where that product is exact enough to compare, and sincospi
+ * matching the separate functions bit for bit.
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SAMPLES 2000
+
+static uint32_t seed = 0x2545f491;
+
+static uint32_t
+next_bits(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static int
+same(double a, double b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0 || (isnan(a) && isnan(b));
+}
+
+static int
+samef(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0 || (isnan(a) && isnan(b));
+}
+
+struct exact {
+    double x, sin, cos;
+};
+
+static const struct exact exact[] = {
+    { 0.0, 0.0, 1.0 },
+    { -0.0, -0.0, 1.0 },
+    { 0.5, 1.0, 0.0 },
+    { -0.5, -1.0, 0.0 },
+    { 1.0, 0.0, -1.0 },
+    { -1.0, -0.0, -1.0 },
+    { 1.5, -1.0, 0.0 },
+    { 2.0, 0.0, 1.0 },
+    { -7.0, -0.0, -1.0 },
+    { 0.25, 0.70710678118654752440, 0.70710678118654752440 },
+    { 0x1p23 + 1, 0.0, -1.0 },
+    { 0x1p53, 0.0, 1.0 },
+    { -0x1p60, -0.0, 1.0 },
+};
+
+#define NEXACT (sizeof(exact) / sizeof(exact[0]))
+
+int
+main(void)
+{
+    unsigned i;
+    int      ret = 0;
+
+    for (i = 0; i < NEXACT; i++) {
+        const struct exact *e = &exact[i];
+        double              s, c;
+        float               sf, cf;
+
+        sincospi(e->x, &s, &c);
+        if (!same(sinpi(e->x), e->sin) || !same(cospi(e->x), e->cos) || !same(s, e->sin)
+            || !same(c, e->cos)) {
+            printf("sincospi(%a) = %a %a, want %a %a\n", e->x, sinpi(e->x), cospi(e->x), e->sin,
+                   e->cos);
+            ret = 1;
+        }
+        sincospif((float)e->x, &sf, &cf);
+        if (!samef(sinpif((float)e->x), (float)e->sin) || !samef(cospif((float)e->x), (float)e->cos)
+            || !samef(sf, (float)e->sin) || !samef(cf, (float)e->cos)) {
+            printf("sincospif(%a) = %a %a, want %a %a\n", e->x, (double)sinpif((float)e->x),
+                   (double)cospif((float)e->x), e->sin, e->cos);
+            ret = 1;
+        }
+    }
+
+    if (!isnan(sinpi(INFINITY)) || !isnan(cospi(-INFINITY)) || !isnan(sinpi(NAN))
+        || !isnan(sinpif(INFINITY)) || !isnan(cospif(NAN))) {
+        printf("sinpi/cospi of inf or nan\n");
+        ret = 1;
+    }
+
+    for (i = 0; i < SAMPLES; i++) {
+        uint32_t b = next_bits();
+        double   x = (double)(int32_t)b / 0x1p28; /* |x| < 8 */
+        float    xf = (float)x;
+        double   s, c, ws, wc;
+        float    sf, cf;
+
+        sincospi(x, &s, &c);
+        if (!same(s, sinpi(x)) || !same(c, cospi(x))) {
+            printf("sincospi(%a) differs from sinpi/cospi\n", x);
+            ret = 1;
+        }
+        sincospif(xf, &sf, &cf);
+        if (!samef(sf, sinpif(xf)) || !samef(cf, cospif(xf))) {
+            printf("sincospif(%a) differs from sinpif/cospif\n", (double)xf);
+            ret = 1;
+        }
+
+        /* pi * x is off by about one ulp of pi * x; compare loosely */
+        ws = sin(M_PI * x);
+        wc = cos(M_PI * x);
+        if (fabs(s - ws) > 0x1p-46 || fabs(c - wc) > 0x1p-46) {
+            printf("sincospi(%a) = %a %a, want about %a %a\n", x, s, c, ws, wc);
+            ret = 1;
+        }
+        if (fabs(sf - ws) > 0x1p-20 || fabs(cf - wc) > 0x1p-20) {
+            printf("sincospif(%a) = %a %a, want about %a %a\n", (double)xf, (double)sf,
+                   (double)cf, ws, wc);
+            ret = 1;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that sqrt is correctly rounded over a pseudo-random set of
+ * arguments. r = sqrt(x) rounds to nearest when x lies between the
+ * squares of the midpoints around r, which is r*r - x <= r * d below
+ * and x - r*r <= r * u above, with d and u the gaps to the neighbours
+ * of r, up to terms of their squares / 4. r*r is split exactly into
+ * two doubles with Dekker's product rather than fma, which libm does
+ * not always get exactly right. Perfect squares must come back exact.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SAMPLES 2000
+
+static uint64_t seed = 0x123456789abcdef1ULL;
+
+static uint64_t
+next_bits(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+static double
+from_bits(uint64_t b)
+{
+    double d;
+
+    memcpy(&d, &b, sizeof(d));
+    return d;
+}
+
+/* Veltkamp's split of a into hi + lo with 26 bit halves */
+static void
+split(double a, double *hi, double *lo)
+{
+    double c = 0x1p27 * a + a;
+
+    *hi = c - (c - a);
+    *lo = a - *hi;
+}
+
+/* r * r - x, with r * r computed exactly as p + q */
+static double
+residual(double r, double x)
+{
+    double h, l, p, q;
+
+    split(r, &h, &l);
+    p = r * r;
+    q = ((h * h - p) + 2 * h * l) + l * l;
+    /* p is within a factor of two of x, so p - x is exact */
+    return (p - x) + q;
+}
+
+static int
+check(double x)
+{
+    double r = sqrt(x);
+    double u, d, e;
+
+    if (x < 0x1p-900)
+        x *= 0x1p200, r *= 0x1p100; /* keep the residual normal */
+    else if (x > 0x1p900)
+        x *= 0x1p-200, r *= 0x1p-100; /* keep r * r finite */
+    u = nextafter(r, INFINITY) - r;
+    d = r - nextafter(r, 0.0);
+    e = residual(r, x);
+    if (e > r * d || -e > r * u) {
+        printf("sqrt(%a) = %a, residual %a\n", x, r, e);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    unsigned s;
+    int      ret = 0;
+
+    for (s = 0; s < SAMPLES; s++) {
+        uint64_t b = next_bits() & 0x7fffffffffffffffULL;
+        uint32_t k = (uint32_t)next_bits() >> 6;
+        double   sq = (double)k * k;
+
+        if ((b >> 52) == 0x7ff)
+            b &= ~(1ULL << 62);
+        if (b == 0)
+            b = 1;
+        ret |= check(from_bits(b));
+        /* near the bottom of the binade and subnormal arguments */
+        ret |= check(from_bits(b & 0x001fffffffffffffULL));
+        ret |= check(from_bits((b & 0x000fffffffffffffULL) | 1));
+
+        if (sqrt(sq) != k) {
+            printf("sqrt(%a) = %a, want %a\n", sq, sqrt(sq), (double)k);
+            ret = 1;
+        }
+        ret |= check(nextafter(sq, 0.0));
+        ret |= check(nextafter(sq, INFINITY));
+    }
+    if (sqrt(0.0) != 0.0 || !signbit(sqrt(-0.0)) || sqrt(INFINITY) != INFINITY
+        || !isnan(sqrt(-1.0)) || !isnan(sqrt(NAN))) {
+        printf("sqrt special cases\n");
+        ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that the batch functions from <vecmath.h> give exactly the
+ * results of the scalar functions, over special values and a
+ * pseudo-random set of arguments, including in-place use.
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vecmath.h>
+
+#define N 512
+
+static uint32_t seed = 0x9e3779b9;
+
+static uint32_t
+next_bits(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static const float specials[] = {
+    0.0f,     -0.0f,    1.0f,           -1.0f,     0x1p-149f, 0x1p-13f, 0x1p-12f, 0x1.921fb6p-1f,
+    119.9f,   120.0f,   -120.0f,        88.0f,     -88.0f,    88.72f,   -104.0f,  0x1p-126f,
+    INFINITY, -INFINITY, NAN,
+};
+
+#define NSPECIALS (sizeof(specials) / sizeof(specials[0]))
+
+static float in[N], out[N], out2[N];
+
+static int
+same(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0 || (isnan(a) && isnan(b));
+}
+
+static int
+check(const char *name, float (*f)(float), void (*vf)(float *, const float *, size_t))
+{
+    unsigned i;
+    int      ret = 0;
+
+    vf(out, in, N);
+    memcpy(out2, in, sizeof(in));
+    vf(out2, out2, N);
+    for (i = 0; i < N; i++) {
+        float want = f(in[i]);
+
+        if (!same(out[i], want) || !same(out2[i], want)) {
+            printf("%s(%a) = %a, want %a\n", name, (double)in[i], (double)out[i], (double)want);
+            ret = 1;
+        }
+    }
+    return ret;
+}
+
+int
+main(void)
+{
+    unsigned i;
+    int      ret = 0;
+
+    for (i = 0; i < N; i++) {
+        if (i < NSPECIALS)
+            in[i] = specials[i];
+        else if (i & 1) {
+            uint32_t b = next_bits();
+
+            memcpy(&in[i], &b, sizeof(b));
+        } else {
+            in[i] = (float)(int32_t)next_bits() * 0x1p-24f; /* in [-128, 128) */
+        }
+    }
+
+    ret |= check("vsinf", sinf, vsinf);
+    ret |= check("vcosf", cosf, vcosf);
+    ret |= check("vexpf", expf, vexpf);
+    ret |= check("vlogf", logf, vlogf);
+    ret |= check("vsqrtf", sqrtf, vsqrtf);
+
+    vsincosf(out, out2, in, N);
+    for (i = 0; i < N; i++) {
+        float s, c;
+
+        sincosf(in[i], &s, &c);
+        if (!same(out[i], s) || !same(out2[i], c)) {
+            printf("vsincosf(%a) = %a %a, want %a %a\n", (double)in[i], (double)out[i],
+                   (double)out2[i], (double)s, (double)c);
+            ret = 1;
+        }
+    }
+    return ret;
+}
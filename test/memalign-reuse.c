@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * memalign carves aligned blocks out of free chunks in place and pads
+ * the break by only what alignment needs. Check that freed aligned
+ * blocks are reused for the same requests without growing the heap,
+ * and that nothing around them is disturbed.
+ */
+
+#include <malloc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NBLOCK 16
+
+static void  *aligned[NBLOCK];
+static char  *pins[NBLOCK];
+
+static size_t
+block_align(int i)
+{
+    return (size_t)16 << (i % 7);
+}
+
+static size_t
+block_size(int i)
+{
+    return 8 + (size_t)i * 37;
+}
+
+static int
+alloc_aligned(const char *round)
+{
+    int ret = 0;
+    int i;
+
+    for (i = 0; i < NBLOCK; i++) {
+        aligned[i] = memalign(block_align(i), block_size(i));
+        if (!aligned[i] || ((uintptr_t)aligned[i] & (block_align(i) - 1))) {
+            printf("%s: memalign(%zu, %zu) returned %p\n", round, block_align(i), block_size(i),
+                   aligned[i]);
+            ret = 1;
+            continue;
+        }
+        memset(aligned[i], 0xa0 + i, block_size(i));
+    }
+    return ret;
+}
+
+static int
+check_pins(const char *round)
+{
+    int i, j;
+
+    for (i = 0; i < NBLOCK; i++) {
+        if (!pins[i])
+            continue;
+        for (j = 0; j < 24; j++) {
+            if (pins[i][j] != (char)i) {
+                printf("%s: pin %d damaged\n", round, i);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    int    ret = 0;
+    int    i;
+    size_t arena;
+
+    /* Interleave aligned blocks with small ones that stay allocated */
+    for (i = 0; i < NBLOCK; i++) {
+        aligned[i] = memalign(block_align(i), block_size(i));
+        if (!aligned[i] || ((uintptr_t)aligned[i] & (block_align(i) - 1))) {
+            printf("memalign(%zu, %zu) returned %p\n", block_align(i), block_size(i), aligned[i]);
+            ret = 1;
+        }
+        pins[i] = malloc(24);
+        if (pins[i])
+            memset(pins[i], i, 24);
+    }
+
+    arena = mallinfo().arena;
+
+    /* The same requests fit back into the holes they left */
+    for (i = 0; i < NBLOCK; i++)
+        free(aligned[i]);
+    ret |= alloc_aligned("refill");
+    ret |= check_pins("refill");
+#ifndef __MALLOC_THREAD_CACHE
+    /* Blocks held in the thread cache aren't back in the heap */
+    if (mallinfo().arena > arena) {
+        printf("heap grew from %zu to %zu refilling aligned holes\n", arena,
+               (size_t)mallinfo().arena);
+        ret = 1;
+    }
+#else
+    (void)arena;
+#endif
+
+    /* Alignments malloc already provides don't need padding */
+    for (i = 0; i < NBLOCK; i++) {
+        void *p = memalign(sizeof(void *), block_size(i));
+
+        if (!p || ((uintptr_t)p & (sizeof(void *) - 1))) {
+            printf("memalign(%zu, %zu) returned %p\n", sizeof(void *), block_size(i), p);
+            ret = 1;
+        }
+        free(p);
+    }
+
+    for (i = 0; i < NBLOCK; i++) {
+        if (aligned[i]) {
+            unsigned char *b = aligned[i];
+            size_t         j;
+
+            for (j = 0; j < block_size(i); j++)
+                if (b[j] != 0xa0 + i) {
+                    printf("aligned block %d damaged\n", i);
+                    ret = 1;
+                    break;
+                }
+        }
+        free(aligned[i]);
+        free(pins[i]);
+    }
+
+#if !defined(__MALLOC_SIZE_BINS) && !defined(__MALLOC_THREAD_CACHE)
+    if (mallinfo().ordblks > 1) {
+        printf("%zu free fragments left\n", (size_t)mallinfo().ordblks);
+        ret = 1;
+    }
+#endif
+    return ret;
+}
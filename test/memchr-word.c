@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check rawmemchr and strnlen at every alignment, length and match
+ * position in a small buffer, including bytes next to the match that
+ * can confuse a word-at-a-time scan.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#define LEN 24
+
+int
+main(void)
+{
+    static unsigned char buf[LEN + 8] __attribute__((aligned(4)));
+    size_t               off, pos, n;
+    int                  ret = 0;
+
+    for (off = 0; off < 4; off++) {
+        for (pos = 0; pos < LEN; pos++) {
+            unsigned char *s = buf + off;
+
+            memset(buf, 0x01, sizeof(buf));
+            s[pos] = 0x80;
+            if (pos)
+                s[pos - 1] = 0x81;
+            if (rawmemchr(s, 0x80) != s + pos) {
+                printf("rawmemchr offset %zu at %zu\n", off, pos);
+                ret = 1;
+            }
+
+            s[pos] = 0;
+            for (n = 0; n <= LEN; n++) {
+                size_t want = n < pos ? n : pos;
+                if (strnlen((char *)s, n) != want) {
+                    printf("strnlen offset %zu nul at %zu max %zu is %zu\n", off, pos, n,
+                           strnlen((char *)s, n));
+                    ret = 1;
+                }
+            }
+        }
+    }
+    return ret;
+}
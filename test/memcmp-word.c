@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check the sign of memcmp and strncmp and whether bcmp is zero for
+ * every pair of alignments, length and position of the first
+ * difference in a small buffer.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#define LEN 40
+
+static int
+sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+int
+main(void)
+{
+    static unsigned char a[LEN + 8] __attribute__((aligned(4)));
+    static unsigned char b[LEN + 8] __attribute__((aligned(4)));
+    size_t               oa, ob, n, pos, i;
+    int                  ret = 0;
+
+    for (oa = 0; oa < 4; oa++) {
+        for (ob = 0; ob < 4; ob++) {
+            unsigned char *s1 = a + oa, *s2 = b + ob;
+
+            for (i = 0; i < LEN; i++)
+                s1[i] = s2[i] = 'a' + i % 23;
+            for (n = 0; n <= LEN; n++) {
+                if (memcmp(s1, s2, n) || bcmp(s1, s2, n)
+                    || strncmp((char *)s1, (char *)s2, n)) {
+                    printf("offsets %zu %zu length %zu equal\n", oa, ob, n);
+                    ret = 1;
+                }
+            }
+            for (pos = 0; pos < LEN; pos++) {
+                /* 0x80 and 0x01 catch signed and borrow mistakes */
+                s2[pos] = 0x80;
+                for (n = pos + 1; n <= LEN; n += 3) {
+                    if (sign(memcmp(s1, s2, n)) != -1 || sign(memcmp(s2, s1, n)) != 1
+                        || !bcmp(s1, s2, n) || sign(strncmp((char *)s1, (char *)s2, n)) != -1) {
+                        printf("offsets %zu %zu length %zu differ at %zu\n", oa, ob, n, pos);
+                        ret = 1;
+                    }
+                    if (memcmp(s1, s2, pos) || bcmp(s1, s2, pos)
+                        || strncmp((char *)s1, (char *)s2, pos)) {
+                        printf("offsets %zu %zu length %zu before %zu\n", oa, ob, n, pos);
+                        ret = 1;
+                    }
+                }
+                s2[pos] = 0;
+                s1[pos] = 0;
+                if (pos + 1 < LEN)
+                    s1[pos + 1] = 0x01;
+                if (strncmp((char *)s1, (char *)s2, LEN)) {
+                    printf("offsets %zu %zu strncmp past nul at %zu\n", oa, ob, pos);
+                    ret = 1;
+                }
+                s1[pos] = s2[pos] = 'a' + pos % 23;
+                if (pos + 1 < LEN)
+                    s1[pos + 1] = 'a' + (pos + 1) % 23;
+            }
+        }
+    }
+    return ret;
+}
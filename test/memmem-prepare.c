@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check memmem_prepared and strstr_prepared against memmem and strstr.
+ * Needles are cut from the haystack or built by repeating a short
+ * period, so that the periodic and non-periodic searches both run.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HAYLEN 600
+#define ROUNDS 4000
+
+static unsigned long seed = 1;
+
+static unsigned
+next(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16);
+}
+
+int
+main(void)
+{
+    static char           hay[HAYLEN + 1];
+    static char           needle[HAYLEN + 1];
+    struct memmem_needle *prep;
+    int                   errors = 0;
+    int                   round;
+
+    for (round = 0; round < ROUNDS; round++) {
+        unsigned alpha = 2 + next() % 4;
+        size_t   hlen = next() % HAYLEN;
+        size_t   nlen, period, i;
+        void    *want, *got;
+
+        for (i = 0; i < hlen; i++)
+            hay[i] = (char)('a' + next() % alpha);
+        hay[hlen] = '\0';
+
+        nlen = next() % 80;
+        switch (next() % 3) {
+        case 0:
+            if (nlen <= hlen) {
+                memcpy(needle, hay + next() % (hlen - nlen + 1), nlen);
+                break;
+            }
+            /* fall through */
+        case 1:
+            period = 1 + next() % 5;
+            for (i = 0; i < nlen; i++)
+                needle[i] = i < period ? (char)('a' + next() % alpha) : needle[i - period];
+            break;
+        default:
+            for (i = 0; i < nlen; i++)
+                needle[i] = (char)('a' + next() % alpha);
+            break;
+        }
+        needle[nlen] = '\0';
+
+        prep = memmem_prepare(needle, nlen);
+        if (!prep) {
+            printf("memmem_prepare failed\n");
+            return 1;
+        }
+
+        /* Search several haystacks with one prepared needle */
+        for (i = 0; i < 4; i++) {
+            size_t off = next() % (hlen + 1);
+
+            want = memmem(hay + off, hlen - off, needle, nlen);
+            got = memmem_prepared(prep, hay + off, hlen - off);
+            if (want != got) {
+                printf("memmem_prepared(\"%s\", \"%s\"): %p, want %p\n", needle, hay + off,
+                       got, want);
+                errors++;
+            }
+            want = strstr(hay + off, needle);
+            got = strstr_prepared(prep, hay + off);
+            if (want != got) {
+                printf("strstr_prepared(\"%s\", \"%s\"): %p, want %p\n", needle, hay + off,
+                       got, want);
+                errors++;
+            }
+        }
+        memmem_prepare_free(prep);
+        if (errors > 10)
+            break;
+    }
+
+    /* Embedded nulls stop strstr_prepared but not memmem_prepared */
+    prep = memmem_prepare("ab\0cd", 5);
+    if (!prep)
+        return 1;
+    if (memmem_prepared(prep, "xxab\0cdx", 8) == NULL) {
+        printf("memmem_prepared missed a needle holding a null\n");
+        errors++;
+    }
+    if (strstr_prepared(prep, "xxab") != NULL) {
+        printf("strstr_prepared matched past the end of the haystack\n");
+        errors++;
+    }
+    memmem_prepare_free(prep);
+
+    return errors != 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check memmem_set and strstr_set against memmem run once per needle,
+ * and memmem_set_next, fed the haystack in random pieces, against a
+ * list of every occurrence of every needle. Needles come from a small
+ * alphabet so that they overlap and share prefixes and suffixes.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NNEEDLE 12
+#define HAYLEN  300
+
+static unsigned long seed = 1;
+
+static unsigned
+next(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16);
+}
+
+static char
+random_byte(void)
+{
+    return "abca\0\xff"[next() % 6];
+}
+
+int
+main(void)
+{
+    static char    needle[NNEEDLE][8];
+    static char    hay[HAYLEN + 1];
+    const void    *needles[NNEEDLE];
+    size_t         lens[NNEEDLE];
+    size_t         n, i, j, len, which, found;
+    const char    *expect, *got, *p, *end;
+    int            iter, errors = 0;
+    unsigned char  seen[HAYLEN + 1][NNEEDLE];
+
+    for (iter = 0; iter < 3000; iter++) {
+        struct memmem_set      *set;
+        struct memmem_set_state state = MEMMEM_SET_STATE_INIT;
+
+        n = 1 + next() % NNEEDLE;
+        for (i = 0; i < n; i++) {
+            lens[i] = (iter % 50 == 0 ? 0 : 1) + next() % sizeof(needle[i]);
+            for (j = 0; j < lens[i]; j++)
+                needle[i][j] = random_byte();
+            needles[i] = needle[i];
+        }
+        set = memmem_set_compile(needles, lens, n);
+        if (set == NULL) {
+            printf("memmem_set_compile failed\n");
+            return 1;
+        }
+
+        len = next() % HAYLEN;
+        for (j = 0; j < len; j++)
+            hay[j] = random_byte();
+        hay[len] = '\0';
+
+        /* The leftmost start, then the shortest, then the lowest index */
+        expect = NULL;
+        found = 0;
+        for (i = 0; i < n; i++) {
+            p = memmem(hay, len, needle[i], lens[i]);
+            if (p && (!expect || p < expect
+                      || (p == expect && lens[i] < lens[found]))) {
+                expect = p;
+                found = i;
+            }
+        }
+        which = (size_t)-1;
+        got = memmem_set(set, hay, len, &which);
+        if (got != expect || (got && which != found)) {
+            printf("iter %d: memmem_set got %td/%zu expect %td/%zu\n", iter,
+                   got ? got - hay : -1, which, expect ? expect - hay : -1, found);
+            errors++;
+        }
+
+        /* strstr_set stops at the first null */
+        expect = NULL;
+        for (i = 0; i < n; i++) {
+            if (memchr(needle[i], '\0', lens[i]))
+                continue;
+            p = memmem(hay, strlen(hay), needle[i], lens[i]);
+            if (p && (!expect || p < expect
+                      || (p == expect && lens[i] < lens[found]))) {
+                expect = p;
+                found = i;
+            }
+        }
+        if (expect == NULL) {
+            /* needles containing null bytes may still match the terminator */
+        } else {
+            got = strstr_set(set, hay, &which);
+            if (got != expect || which != found) {
+                printf("iter %d: strstr_set got %td expect %td\n", iter, got ? got - hay : -1,
+                       expect - hay);
+                errors++;
+            }
+        }
+
+        /* Every occurrence of a non-empty needle, by end position */
+        memset(seen, 0, sizeof(seen));
+        p = hay;
+        end = hay + len;
+        while (p < end) {
+            const char *piece = p + next() % 20;
+            const char *lastend = NULL;
+            size_t      last = 0;
+
+            if (piece > end)
+                piece = end;
+            while ((got = memmem_set_next(set, &state, p, piece - p, &which)) != NULL) {
+                if (got == lastend && lens[which] > last) {
+                    printf("iter %d: memmem_set_next reported %zu after %zu\n", iter,
+                           lens[which], last);
+                    errors++;
+                }
+                last = lens[which];
+                lastend = got;
+                seen[got - hay][which] = 1;
+                p = got;
+            }
+            p = piece;
+        }
+        for (j = 0; j <= len; j++)
+            for (i = 0; i < n; i++) {
+                int want = lens[i] != 0 && j >= lens[i]
+                    && memcmp(hay + j - lens[i], needle[i], lens[i]) == 0;
+                /* duplicates are reported once, under the lowest index */
+                for (size_t k = 0; k < i && want; k++)
+                    if (lens[k] == lens[i] && memcmp(needle[k], needle[i], lens[i]) == 0)
+                        want = 0;
+                if (seen[j][i] != want) {
+                    printf("iter %d: needle %zu ending at %zu %s\n", iter, i, j,
+                           want ? "missed" : "reported wrongly");
+                    errors++;
+                }
+            }
+        memmem_set_free(set);
+    }
+
+    printf("memmem-set: %d errors\n", errors);
+    return errors != 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Build strings with open_memstream, open_wmemstream and
+ * malloc_arena_open_memstream and check the published buffer and size
+ * after fflush and fclose.
+ */
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define LINES 200
+
+static int
+check_lines(const char *what, const char *buf, size_t size)
+{
+    char   line[32];
+    size_t off = 0;
+    int    i;
+
+    for (i = 0; i < LINES; i++) {
+        size_t len = (size_t)snprintf(line, sizeof(line), "line %d\n", i);
+        if (off + len > size || memcmp(buf + off, line, len) != 0) {
+            printf("%s: line %d wrong\n", what, i);
+            return 1;
+        }
+        off += len;
+    }
+    if (off != size || buf[size] != '\0') {
+        printf("%s: size %zu want %zu\n", what, size, off);
+        return 1;
+    }
+    return 0;
+}
+
+static int
+test_narrow(void)
+{
+    char  *buf = NULL;
+    size_t size = 1;
+    FILE  *f = open_memstream(&buf, &size);
+    int    ret = 0;
+    int    i;
+
+    if (!f) {
+        printf("open_memstream failed\n");
+        return 1;
+    }
+    if (!buf || size != 0 || buf[0] != '\0') {
+        printf("open_memstream: initial buffer not empty\n");
+        ret = 1;
+    }
+    for (i = 0; i < LINES; i++)
+        fprintf(f, "line %d\n", i);
+    fflush(f);
+    ret |= check_lines("fflush", buf, size);
+
+    /* Seek back, overwrite, then seek past the end */
+    fseek(f, 0, SEEK_SET);
+    fputs("LINE", f);
+    fflush(f);
+    if (size != 4 || memcmp(buf, "LINE 0\n", 7) != 0) {
+        printf("overwrite: size %zu\n", size);
+        ret = 1;
+    }
+    fseek(f, 3, SEEK_END);
+    fputc('!', f);
+    fclose(f);
+    if (buf[size - 4] != '\0' || buf[size - 2] != '\0' || buf[size - 1] != '!' || buf[size] != '\0') {
+        printf("gap not zero filled\n");
+        ret = 1;
+    }
+    free(buf);
+    return ret;
+}
+
+static int
+test_wide(void)
+{
+    wchar_t *buf = NULL;
+    size_t   size = 0;
+    FILE    *f = open_wmemstream(&buf, &size);
+    int      ret = 0;
+
+    if (!f) {
+        printf("open_wmemstream failed\n");
+        return 1;
+    }
+    fwprintf(f, L"%d %ls", 42, L"wide");
+    fclose(f);
+    if (size != 7 || wcscmp(buf, L"42 wide") != 0) {
+        printf("open_wmemstream: size %zu\n", size);
+        ret = 1;
+    }
+    free(buf);
+    return ret;
+}
+
+static int
+test_arena(void)
+{
+    static char          space[8192];
+    struct malloc_arena *arena = malloc_arena_create(space, sizeof(space));
+    char                *buf = NULL;
+    size_t               size = 0;
+    FILE                *f;
+    int                  ret = 0;
+    int                  i;
+
+    if (!arena) {
+        printf("malloc_arena_create failed\n");
+        return 1;
+    }
+    f = malloc_arena_open_memstream(arena, &buf, &size);
+    if (!f) {
+        printf("malloc_arena_open_memstream failed\n");
+        return 1;
+    }
+    for (i = 0; i < LINES; i++)
+        fprintf(f, "line %d\n", i);
+    fclose(f);
+    ret |= check_lines("arena", buf, size);
+    if (buf < space || buf + size >= space + sizeof(space)) {
+        printf("arena: buffer outside the arena\n");
+        ret = 1;
+    }
+    malloc_arena_destroy(arena);
+    return ret;
+}
+
+int
+main(void)
+{
+    return test_narrow() | test_wide() | test_arena();
+}
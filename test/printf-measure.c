@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * snprintf(NULL, 0, ...) measures the output without generating it:
+ * check that it returns the same length as formatting into a buffer,
+ * for integers, strings and floats with every kind of flag, width and
+ * precision.
+ */
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static char buf[512];
+static int  ret;
+
+static void
+check(const char *fmt, ...)
+{
+    va_list ap;
+    int     want, got;
+
+    va_start(ap, fmt);
+    want = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    va_start(ap, fmt);
+    got = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    if (want != got || (size_t)want != strlen(buf)) {
+        printf("\"%s\": measured %d, formatted %d \"%s\"\n", fmt, got, want, buf);
+        ret = 1;
+    }
+}
+
+static unsigned long rnd_state = 1;
+
+static unsigned long
+rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return rnd_state >> 8;
+}
+
+int
+main(void)
+{
+    static const char *const int_fmts[] = {
+        "%d", "%i", "%u", "%x", "%X", "%o", "%5d", "%-7d|", "%+d", "% d", "%05d", "%.3d",
+        "%.0d", "%#x", "%#o", "%#.0o", "%10.4X", "%-+8.2d|", "%ld", "%lu", "%lx", "%hd", "%hhu",
+    };
+    static const char *const float_fmts[] = {
+        "%f", "%e", "%g", "%E", "%G", "%.0f", "%.0e", "%.0g", "%#.0f", "%#g", "%.10f", "%.17g",
+        "%12.3f", "%-12.3e|", "%+g", "% .2f", "%08.3f", "%a", "%.3a", "%20g|",
+    };
+    static const double specials[] = {
+        0.0, -0.0, 1.0, 9.5, 9.9999999, 99.5, 0.5, 1e-5, 9.9999e-5, 123456789.0, 1e21, 1e100,
+        -1e-300, 1.7976931348623157e308, 4.9e-324, 1.0 / 0.0, -1.0 / 0.0, 0.0 / 0.0,
+    };
+    unsigned i, j;
+
+    check("plain text");
+    check("");
+    check("%%");
+    check("%s|%10s|%-10s|%.3s|%10.2s", "str", "str", "str", "string", "string");
+    check("%s", (char *)NULL);
+    check("%c%5c%-5c|", 'a', 'b', 'c');
+    check("%p", (void *)&ret);
+    check("%lld %llx", LLONG_MIN, ULLONG_MAX);
+    check("%d %u %x", INT_MIN, UINT_MAX, UINT_MAX);
+
+    for (i = 0; i < 2000; i++) {
+        unsigned long v = rnd() ^ (rnd() << 16);
+        int           shift = rnd() % 32;
+
+        v >>= shift;
+        for (j = 0; j < sizeof(int_fmts) / sizeof(int_fmts[0]); j++) {
+            if (strchr(int_fmts[j], 'l'))
+                check(int_fmts[j], (i & 1) ? -(long)v : (long)v);
+            else
+                check(int_fmts[j], (i & 1) ? -(int)v : (int)v);
+        }
+    }
+
+    for (i = 0; i < sizeof(specials) / sizeof(specials[0]) + 1000; i++) {
+        double d;
+
+        if (i < sizeof(specials) / sizeof(specials[0])) {
+            d = specials[i];
+        } else {
+            uint64_t bits = ((uint64_t)rnd() << 40) ^ ((uint64_t)rnd() << 20) ^ rnd();
+
+            memcpy(&d, &bits, sizeof(d));
+        }
+        for (j = 0; j < sizeof(float_fmts) / sizeof(float_fmts[0]); j++)
+            check(float_fmts[j], d);
+        check("%.*f %*.*e", (int)(rnd() % 20), d, (int)(rnd() % 30), (int)(rnd() % 20), d);
+    }
+    return ret;
+}
@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check xoshiro128++ and PCG32 against reference output, that the
+ * fill functions produce the same stream as repeated next calls, that
+ * the uniform functions stay in range without visible bias, and that
+ * arc4random_buf fills large and unaligned buffers.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* SplitMix64-expanded seed 12345 */
+static const uint32_t xoshiro_ref[] = {
+    0xc9c8548f, 0x11ca377a, 0x0c8942f1, 0x70439841, 0x7f2e0d7e, 0x3cd940c7,
+};
+
+/* pcg32-demo, seed 42, sequence 54 */
+static const uint32_t pcg_ref[] = {
+    0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e,
+};
+
+#define NREF   (sizeof(pcg_ref) / sizeof(pcg_ref[0]))
+#define NDRAW  60000
+#define FILLSZ 67
+
+static int errors;
+
+static void
+check_uniform(const char *name, const unsigned *count, uint32_t bound)
+{
+    uint32_t i;
+
+    for (i = 0; i < bound; i++) {
+        /* About 6 standard deviations */
+        unsigned want = NDRAW / bound;
+
+        if (count[i] < want - want / 10 || count[i] > want + want / 10) {
+            printf("%s(%lu): %lu hits for %lu, want about %u\n", name, (unsigned long)bound,
+                   (unsigned long)count[i], (unsigned long)i, want);
+            errors++;
+        }
+    }
+}
+
+int
+main(void)
+{
+    static const uint32_t bounds[] = { 2, 3, 6, 7, 10, 17 };
+    struct xoshiro128pp   x, x2;
+    struct pcg32          p, p2;
+    unsigned char         buf[FILLSZ + 3], want[FILLSZ + 3];
+    static unsigned char  big[5003];
+    unsigned              count[17];
+    size_t                i, b, off, n;
+    uint32_t              r;
+
+    xoshiro128pp_seed(&x, 12345);
+    pcg32_seed(&p, 42, 54);
+    for (i = 0; i < NREF; i++) {
+        r = xoshiro128pp_next(&x);
+        if (r != xoshiro_ref[i]) {
+            printf("xoshiro128pp_next %lu: %08lx, want %08lx\n", (unsigned long)i,
+                   (unsigned long)r, (unsigned long)xoshiro_ref[i]);
+            errors++;
+        }
+        r = pcg32_next(&p);
+        if (r != pcg_ref[i]) {
+            printf("pcg32_next %lu: %08lx, want %08lx\n", (unsigned long)i, (unsigned long)r,
+                   (unsigned long)pcg_ref[i]);
+            errors++;
+        }
+    }
+
+    /* fill gives the bytes of successive outputs, dropping any unused tail */
+    for (off = 0; off < 3; off++) {
+        for (n = 0; n <= FILLSZ; n += 7) {
+            x2 = x;
+            p2 = p;
+            for (i = 0; i < n; i += 4) {
+                r = xoshiro128pp_next(&x2);
+                memcpy(want + i, &r, n - i < 4 ? n - i : 4);
+            }
+            xoshiro128pp_fill(&x, buf + off, n);
+            if (memcmp(buf + off, want, n) || memcmp(&x, &x2, sizeof(x))) {
+                printf("xoshiro128pp_fill(%lu) at offset %lu differs\n", (unsigned long)n,
+                       (unsigned long)off);
+                errors++;
+            }
+            for (i = 0; i < n; i += 4) {
+                r = pcg32_next(&p2);
+                memcpy(want + i, &r, n - i < 4 ? n - i : 4);
+            }
+            pcg32_fill(&p, buf + off, n);
+            if (memcmp(buf + off, want, n) || memcmp(&p, &p2, sizeof(p))) {
+                printf("pcg32_fill(%lu) at offset %lu differs\n", (unsigned long)n,
+                       (unsigned long)off);
+                errors++;
+            }
+        }
+    }
+
+    for (b = 0; b < sizeof(bounds) / sizeof(bounds[0]); b++) {
+        uint32_t bound = bounds[b];
+
+        memset(count, 0, sizeof(count));
+        for (i = 0; i < NDRAW; i++) {
+            r = xoshiro128pp_uniform(&x, bound);
+            if (r >= bound) {
+                printf("xoshiro128pp_uniform(%lu) = %lu\n", (unsigned long)bound,
+                       (unsigned long)r);
+                return 1;
+            }
+            count[r]++;
+        }
+        check_uniform("xoshiro128pp_uniform", count, bound);
+
+        memset(count, 0, sizeof(count));
+        for (i = 0; i < NDRAW; i++) {
+            r = pcg32_uniform(&p, bound);
+            if (r >= bound) {
+                printf("pcg32_uniform(%lu) = %lu\n", (unsigned long)bound, (unsigned long)r);
+                return 1;
+            }
+            count[r]++;
+        }
+        check_uniform("pcg32_uniform", count, bound);
+    }
+    if (xoshiro128pp_uniform(&x, 0) != 0 || pcg32_uniform(&p, 1) != 0) {
+        printf("uniform with a bound below 2 is not 0\n");
+        errors++;
+    }
+    for (i = 0; i < 1000; i++) {
+        if (xoshiro128pp_uniform(&x, 0x80000001U) > 0x80000000U
+            || pcg32_uniform(&p, UINT32_MAX) >= UINT32_MAX) {
+            printf("uniform out of range for a large bound\n");
+            errors++;
+            break;
+        }
+    }
+
+    /*
+     * A large unaligned arc4random_buf request goes straight to the
+     * caller's buffer; check that every part of it was written
+     */
+    for (off = 0; off < 3; off++) {
+        unsigned zeros = 0;
+
+        memset(big, 0, sizeof(big));
+        arc4random_buf(big + off, sizeof(big) - 3);
+        for (i = off; i < off + sizeof(big) - 3; i += 64) {
+            size_t j, end = i + 64 < off + sizeof(big) - 3 ? i + 64 : off + sizeof(big) - 3;
+
+            for (j = i; j < end && !big[j]; j++)
+                ;
+            if (j == end)
+                zeros++;
+        }
+        if (zeros) {
+            printf("arc4random_buf left %u zero blocks\n", zeros);
+            errors++;
+        }
+        if (big[off + sizeof(big) - 3] || (off && big[off - 1])) {
+            printf("arc4random_buf wrote outside the buffer\n");
+            errors++;
+        }
+    }
+
+    return errors != 0;
+}
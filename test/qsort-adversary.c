@@ -0,0 +1,196 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+/*
+ * Make sure qsort stays O(n log n) on hostile input. The comparison
+ * function below is McIlroy's "killer adversary" which decides the
+ * ordering of values lazily so that every pivot chosen ends up
+ * being close to the minimum; plain quicksort goes quadratic on it.
+ */
+
+#define N_ADV 2048
+
+static int      adv_val[N_ADV];
+static int      adv_ptr[N_ADV];
+static int      adv_gas;
+static int      adv_nsolid;
+static int      adv_candidate;
+static unsigned long ncmp;
+
+static int
+adv_freeze(int x)
+{
+    adv_val[x] = adv_nsolid++;
+    return x;
+}
+
+static int
+adv_cmp(const void *pa, const void *pb)
+{
+    int a = *(const int *)pa;
+    int b = *(const int *)pb;
+
+    ncmp++;
+    if (adv_val[a] == adv_gas && adv_val[b] == adv_gas) {
+        if (a == adv_candidate)
+            adv_freeze(a);
+        else
+            adv_freeze(b);
+    }
+    if (adv_val[a] == adv_gas)
+        adv_candidate = a;
+    else if (adv_val[b] == adv_gas)
+        adv_candidate = b;
+    return adv_val[a] - adv_val[b];
+}
+
+static unsigned long
+adversary(int n)
+{
+    int i;
+
+    adv_gas = n - 1;
+    adv_nsolid = 0;
+    adv_candidate = 0;
+    for (i = 0; i < n; i++) {
+        adv_ptr[i] = i;
+        adv_val[i] = adv_gas;
+    }
+    ncmp = 0;
+    qsort(adv_ptr, n, sizeof(adv_ptr[0]), adv_cmp);
+    return ncmp;
+}
+
+#define N_SORT 1000
+
+static unsigned char buf[N_SORT * 8];
+
+static int
+cmp_bytes(const void *a, const void *b, void *arg)
+{
+    ncmp++;
+    return memcmp(a, b, *(size_t *)arg);
+}
+
+static uint32_t seed = 1;
+
+static uint32_t
+next_rand(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+static void
+fill(int pattern, size_t n, size_t es)
+{
+    size_t i, j;
+
+    for (i = 0; i < n; i++) {
+        uint32_t v;
+
+        switch (pattern) {
+        case 0: /* ascending */
+            v = (uint32_t)i;
+            break;
+        case 1: /* descending */
+            v = (uint32_t)(n - i);
+            break;
+        case 2: /* organ pipe */
+            v = (uint32_t)(i < n / 2 ? i : n - i);
+            break;
+        case 3: /* all equal */
+            v = 7;
+            break;
+        case 4: /* few distinct values */
+            v = next_rand() % 4;
+            break;
+        default: /* random */
+            v = next_rand();
+            break;
+        }
+        /* Store big-endian so memcmp matches numeric order */
+        for (j = 0; j < es; j++)
+            buf[i * es + j] = (unsigned char)(j < 4 ? v >> (8 * (3 - (j % 4))) : i);
+    }
+}
+
+int
+main(void)
+{
+    static const size_t sizes[] = { 1, 3, 4, 8 };
+    int                 errors = 0;
+    unsigned long       limit, got;
+    size_t              s, i, lg;
+    int                 pattern;
+
+    for (lg = 0; (1u << lg) < N_ADV; lg++)
+        ;
+    limit = 6UL * N_ADV * lg;
+    got = adversary(N_ADV);
+    if (got > limit) {
+        printf("adversary: %lu compares for %d elements (limit %lu)\n", got, N_ADV, limit);
+        errors++;
+    }
+    for (i = 0; i + 1 < N_ADV; i++)
+        if (adv_val[adv_ptr[i]] > adv_val[adv_ptr[i + 1]]) {
+            printf("adversary: not sorted at %zu\n", i);
+            errors++;
+            break;
+        }
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t es = sizes[s];
+
+        for (pattern = 0; pattern < 6; pattern++) {
+            fill(pattern, N_SORT, es);
+            qsort_r(buf, N_SORT, es, cmp_bytes, &es);
+            for (i = 0; i + 1 < N_SORT; i++)
+                if (memcmp(buf + i * es, buf + (i + 1) * es, es) > 0) {
+                    printf("size %zu pattern %d: not sorted at %zu\n", es, pattern, i);
+                    errors++;
+                    break;
+                }
+        }
+    }
+
+    return errors != 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Check the typed sort functions against qsort with the equivalent
+ * comparison function for a range of sizes and data patterns.
+ */
+
+#define N 1500
+
+static uint32_t seed = 1;
+
+static uint32_t
+next_rand(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+static uint32_t
+value(int pattern, size_t i, size_t n)
+{
+    switch (pattern) {
+    case 0:
+        return (uint32_t)i;
+    case 1:
+        return (uint32_t)(n - i);
+    case 2:
+        return (uint32_t)(i < n / 2 ? i : n - i);
+    case 3:
+        return 7;
+    case 4:
+        return next_rand() % 5;
+    default:
+        return next_rand() * 2654435761u;
+    }
+}
+
+static int
+cmp_i32(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int
+cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int
+cmp_i64(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int
+cmp_str(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int32_t  i32[N], i32_ref[N], i32_tmp[N];
+static uint32_t u32[N], u32_ref[N], u32_tmp[N];
+static int64_t  i64[N], i64_ref[N];
+static float    f32[N];
+static double   f64[N];
+static char     strs[N][12];
+static char    *str[N], *str_ref[N];
+
+#define CHECK(name, a, b, n)                                       \
+    do {                                                           \
+        if (memcmp(a, b, (n) * sizeof((a)[0])) != 0) {             \
+            printf("%s: n %zu pattern %d mismatch\n", name, n, p); \
+            errors++;                                              \
+        }                                                          \
+    } while (0)
+
+static int
+check_floats(size_t n, int p)
+{
+    size_t i;
+    int    errors = 0;
+
+    for (i = 0; i + 1 < n; i++) {
+        int nan_a = isnan(f64[i]), nan_b = isnan(f64[i + 1]);
+        if ((nan_a && !nan_b) || (!nan_a && !nan_b && f64[i] > f64[i + 1])) {
+            printf("qsort_double: n %zu pattern %d not sorted at %zu\n", n, p, i);
+            errors++;
+            break;
+        }
+    }
+    for (i = 0; i + 1 < n; i++) {
+        int nan_a = isnan(f32[i]), nan_b = isnan(f32[i + 1]);
+        if ((nan_a && !nan_b) || (!nan_a && !nan_b && f32[i] > f32[i + 1])) {
+            printf("qsort_float: n %zu pattern %d not sorted at %zu\n", n, p, i);
+            errors++;
+            break;
+        }
+    }
+    return errors;
+}
+
+int
+main(void)
+{
+    static const size_t sizes[] = { 0, 1, 2, 3, 12, 13, 100, N };
+    int                 errors = 0;
+    size_t              s, i, n;
+    int                 p;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        n = sizes[s];
+        for (p = 0; p < 6; p++) {
+            for (i = 0; i < n; i++) {
+                uint32_t v = value(p, i, n);
+
+                i32[i] = i32_ref[i] = (int32_t)v;
+                u32[i] = u32_ref[i] = v;
+                i64[i] = i64_ref[i] = (int64_t)(int32_t)v * 65537;
+                f32[i] = (float)(int32_t)v;
+                f64[i] = (double)(int32_t)v / 3.0;
+                if (p == 5 && (v & 15) == 0) {
+                    f32[i] = NAN;
+                    f64[i] = -NAN;
+                }
+                snprintf(strs[i], sizeof(strs[i]), "%lu", (unsigned long)v);
+                str[i] = str_ref[i] = strs[i];
+            }
+
+            qsort(i32_ref, n, sizeof(i32_ref[0]), cmp_i32);
+            qsort(u32_ref, n, sizeof(u32_ref[0]), cmp_u32);
+            qsort(i64_ref, n, sizeof(i64_ref[0]), cmp_i64);
+            qsort(str_ref, n, sizeof(str_ref[0]), cmp_str);
+
+            qsort_int64(i64, n);
+            CHECK("qsort_int64", i64, i64_ref, n);
+            qsort_float(f32, n);
+            qsort_double(f64, n);
+            errors += check_floats(n, p);
+            qsort_str(str, n);
+            for (i = 0; i < n; i++)
+                if (strcmp(str[i], str_ref[i]) != 0) {
+                    printf("qsort_str: n %zu pattern %d mismatch at %zu\n", n, p, i);
+                    errors++;
+                    break;
+                }
+
+            radixsort_uint32(u32, n, u32_tmp);
+            CHECK("radixsort_uint32", u32, u32_ref, n);
+            radixsort_int32(i32, n, i32_tmp);
+            CHECK("radixsort_int32", i32, i32_ref, n);
+
+            /* Sort again from scratch with the comparison sorts */
+            for (i = 0; i < n; i++) {
+                uint32_t v = i32_ref[n - 1 - i];
+                i32[i] = (int32_t)v;
+                u32[i] = v;
+            }
+            qsort_int32(i32, n);
+            CHECK("qsort_int32", i32, i32_ref, n);
+            qsort_uint32(u32, n);
+            CHECK("qsort_uint32", u32, u32_ref, n);
+        }
+    }
+
+    return errors != 0;
+}
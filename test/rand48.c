@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * The rand48 family must keep producing exactly the SUS sequence:
+ * check the default and srand48 streams, the caller-seeded variants,
+ * lcong48 with an all-ones multiplier and the drand48 conversion of
+ * small and zero states against reference output.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+
+static int error;
+
+static void
+check_d(const char *name, double got, double want)
+{
+    if (got != want) {
+        printf("%s: got %a want %a\n", name, got, want);
+        error = 1;
+    }
+}
+
+static void
+check_l(const char *name, long got, long want)
+{
+    if (got != want) {
+        printf("%s: got %ld want %ld\n", name, got, want);
+        error = 1;
+    }
+}
+
+static const double drand_ref[] = {
+    0x1.95fadc954404p-2,
+    0x1.ae54192cc6fp-1,
+    0x1.69d0f018a88cp-2,
+};
+
+static const long lrand_ref[] = { 959030623, 684387517, 1903590565 };
+static const long mrand_ref[] = { 66927828, -1786318902, 684483038 };
+
+static const double srand_ref[] = {
+    0x1.cd79090a8808p-3,
+    0x1.d69f29c4c6fp-1,
+    0x1.a79c63115118p-3,
+};
+
+static const double erand_ref[] = {
+    0x1.fff44226333cp-1,
+    0x1.f499f930dbe6p-1,
+    0x1.bfc8a5804418p-1,
+};
+static const long nrand_ref[] = { 579858406, 2007681753, 62444218 };
+static const long jrand_ref[] = { 906991427, -779470306, -442549552 };
+
+#define NREF 3
+
+int
+main(void)
+{
+    unsigned short x[3] = { 0xffff, 0xffff, 0xffff };
+    unsigned short p[7] = { 1, 2, 3, 0xffff, 0xffff, 0xffff, 0xffff };
+    int            i;
+
+    for (i = 0; i < NREF; i++)
+        check_d("drand48", drand48(), drand_ref[i]);
+    for (i = 0; i < NREF; i++)
+        check_l("lrand48", lrand48(), lrand_ref[i]);
+    for (i = 0; i < NREF; i++)
+        check_l("mrand48", mrand48(), mrand_ref[i]);
+
+    srand48(12345);
+    for (i = 0; i < NREF; i++)
+        check_d("srand48", drand48(), srand_ref[i]);
+
+    for (i = 0; i < NREF; i++) {
+        check_d("erand48", erand48(x), erand_ref[i]);
+        check_l("nrand48", nrand48(x), nrand_ref[i]);
+        check_l("jrand48", jrand48(x), jrand_ref[i]);
+    }
+
+    /* x = 0xffff - x alternates between two states */
+    lcong48(p);
+    for (i = 0; i < NREF; i++) {
+        check_d("lcong48 drand48", drand48(), 0x1.fff9fffdfffcp-1);
+        check_l("lcong48 mrand48", mrand48(), 196610);
+    }
+
+    /* States that step to 0x1234 and to zero */
+    srand48(0);
+    x[0] = 0x352d;
+    x[1] = 0xfae3;
+    x[2] = 0xa162;
+    check_d("erand48 small", erand48(x), 0x1.234p-36);
+    x[0] = 0x2aa9;
+    x[1] = 0x0e46;
+    x[2] = 0x615c;
+    check_d("erand48 zero", erand48(x), 0.0);
+
+    return error;
+}
@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that regcomp_cache shares programs between handles for the
+ * same pattern and flags, evicts the least recently used pattern, and
+ * that handles keep working after the cache drops their program.
+ */
+
+#define _DEFAULT_SOURCE
+#include <regex.h>
+#include <stdio.h>
+
+static int
+check(const regex_t *re, const char *s, int want, const char *what)
+{
+    if ((regexec(re, s, 0, NULL, 0) == 0) != want) {
+        printf("%s: \"%s\" should %smatch\n", what, s, want ? "" : "not ");
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    regex_t a, b, c, d, e, f;
+    int     ret = 0;
+
+    if (regcomp_cache(2) != 0) {
+        printf("regcomp_cache failed\n");
+        return 1;
+    }
+    if (regcomp(&a, "ab+c", REG_EXTENDED) || regcomp(&b, "ab+c", REG_EXTENDED)
+        || regcomp(&c, "ab+c", 0)) {
+        printf("regcomp failed\n");
+        return 1;
+    }
+    if (a.re_g != b.re_g) {
+        printf("same pattern not shared\n");
+        ret = 1;
+    }
+    if (a.re_g == c.re_g) {
+        printf("different flags shared\n");
+        ret = 1;
+    }
+
+    /* Free one sharer; the other still works */
+    regfree(&a);
+    ret |= check(&b, "xabbbc", 1, "shared");
+    ret |= check(&c, "ab+c", 1, "basic");
+
+    /* Using the ERE again leaves the BRE least recently used */
+    if (regcomp(&e, "ab+c", REG_EXTENDED) || regcomp(&d, "x[0-9]*y", REG_EXTENDED)) {
+        printf("regcomp failed\n");
+        return 1;
+    }
+    if (e.re_g != b.re_g) {
+        printf("recently used pattern evicted\n");
+        ret = 1;
+    }
+    regfree(&e);
+    if (regcomp(&e, "ab+c", 0) || regcomp(&f, "q", 0)) {
+        printf("regcomp failed\n");
+        return 1;
+    }
+    if (e.re_g == c.re_g) {
+        printf("evicted pattern still shared\n");
+        ret = 1;
+    }
+    ret |= check(&c, "ab+c", 1, "evicted");
+    ret |= check(&e, "abbc", 0, "recompiled");
+    regfree(&c);
+    regfree(&e);
+
+    /* Turning the cache off leaves the handles to free the programs */
+    regcomp_cache(0);
+    ret |= check(&b, "abc", 1, "after off");
+    ret |= check(&d, "x12y", 1, "after off");
+    ret |= check(&f, "q", 1, "after off");
+    regfree(&b);
+    regfree(&d);
+    regfree(&f);
+
+    if (regcomp(&a, "ab+c", REG_EXTENDED) || regcomp(&b, "ab+c", REG_EXTENDED)) {
+        printf("regcomp failed\n");
+        return 1;
+    }
+    if (a.re_g == b.re_g) {
+        printf("shared with the cache off\n");
+        ret = 1;
+    }
+    regfree(&a);
+    regfree(&b);
+    return ret;
+}
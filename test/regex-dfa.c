@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Matches which depend on the context regexec keeps between characters:
+ * anchors around newlines, REG_NOTBOL and REG_NOTEOL, literal prefixes
+ * and expressions with more states than the DFA cache holds. Each
+ * expression is run many times so that cached states get reused.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <regex.h>
+
+struct test {
+    const char *pattern;
+    int         cflags;
+    const char *string;
+    int         eflags;
+    int         ret;
+    regoff_t    so, eo;
+};
+
+static const struct test tests[] = {
+    { "^b", REG_EXTENDED | REG_NEWLINE, "a\nb", 0, 0, 2, 3 },
+    { "^b", REG_EXTENDED, "a\nb", 0, REG_NOMATCH, 0, 0 },
+    { "a$", REG_EXTENDED | REG_NEWLINE, "ba\nb", 0, 0, 1, 2 },
+    { "a$", REG_EXTENDED, "ba\nb", 0, REG_NOMATCH, 0, 0 },
+    { "a$", REG_EXTENDED, "ba", REG_NOTEOL, REG_NOMATCH, 0, 0 },
+    { "^a", REG_EXTENDED, "ab", REG_NOTBOL, REG_NOMATCH, 0, 0 },
+    { "^a", REG_EXTENDED | REG_NEWLINE, "ab\nab", REG_NOTBOL, 0, 3, 4 },
+    { "^$", REG_EXTENDED | REG_NEWLINE, "a\n\nb", 0, 0, 2, 2 },
+    { "b.c", REG_EXTENDED | REG_NEWLINE, "b\nc bxc", 0, 0, 4, 7 },
+    { "b.c", REG_EXTENDED, "b\nc bxc", 0, 0, 0, 3 },
+    { "foo(bar|baz)+x", REG_EXTENDED, "foobar foobarbazx", 0, 0, 7, 17 },
+    { "(ab)+c", REG_EXTENDED, "abab ababc", 0, 0, 5, 10 },
+    { "^abc", REG_EXTENDED | REG_NEWLINE, "xabc\nabc", 0, 0, 5, 8 },
+    { "hello", REG_EXTENDED, "hell hello", 0, 0, 5, 10 },
+    { "hello", REG_EXTENDED, "hell", 0, REG_NOMATCH, 0, 0 },
+    { "x", REG_EXTENDED, "abcx", 0, 0, 3, 4 },
+    { "[[:<:]]ab", REG_EXTENDED, "cab ab", 0, 0, 4, 6 },
+    { "\\(a*\\)b\\1", 0, "aabaa", 0, 0, 0, 5 },
+    { "\xe9+t", REG_EXTENDED, "a\xe9\xe9t", 0, 0, 1, 4 },
+    { "a[^b]*b", REG_EXTENDED | REG_ICASE, "xAzzB", 0, 0, 1, 5 },
+};
+
+#define NTEST (sizeof(tests) / sizeof(tests[0]))
+
+/* (a|b)*a(a|b){n} matches when an 'a' has at least n more letters after it */
+static int
+check_long(void)
+{
+    static char string[4096];
+    regex_t     regex;
+    regmatch_t  match;
+    unsigned    seed = 1;
+    int         errors = 0;
+    int         i, len, iter, ret, expect;
+
+    if (regcomp(&regex, "(a|b)*a(a|b){12}$", REG_EXTENDED) != 0) {
+        printf("long expression failed to compile\n");
+        return 1;
+    }
+    for (iter = 0; iter < 50; iter++) {
+        len = 1 + iter * 80;
+        for (i = 0; i < len; i++) {
+            seed = seed * 1103515245 + 12345;
+            string[i] = (seed >> 16) & 1 ? 'a' : 'b';
+        }
+        string[len] = '\0';
+        expect = len > 12 && string[len - 13] == 'a';
+        ret = regexec(&regex, string, 1, &match, 0);
+        if ((ret == 0) != expect || (ret == 0 && match.rm_eo != len)) {
+            printf("long string %d: got %d expect %d\n", len, ret, !expect);
+            errors++;
+        }
+    }
+    regfree(&regex);
+    return errors;
+}
+
+int
+main(void)
+{
+    unsigned   t;
+    int        errors = 0;
+    int        ret;
+    int        rep;
+    regex_t    regex;
+    regmatch_t match;
+
+    for (t = 0; t < NTEST; t++) {
+        ret = regcomp(&regex, tests[t].pattern, tests[t].cflags);
+        if (ret != 0) {
+            printf("expression \"%s\" failed to compile: %d\n", tests[t].pattern, ret);
+            errors++;
+            continue;
+        }
+        for (rep = 0; rep < 3; rep++) {
+            ret = regexec(&regex, tests[t].string, rep == 1 ? 0 : 1, &match, tests[t].eflags);
+            if (ret != tests[t].ret) {
+                printf("match \"%s\" with \"%s\" bad result got %d != expect %d\n",
+                       tests[t].pattern, tests[t].string, ret, tests[t].ret);
+                errors++;
+            } else if (ret == 0 && rep != 1
+                       && (match.rm_so != tests[t].so || match.rm_eo != tests[t].eo)) {
+                printf("match \"%s\" with \"%s\" got (%ld,%ld) expect (%ld,%ld)\n",
+                       tests[t].pattern, tests[t].string, (long)match.rm_so, (long)match.rm_eo,
+                       (long)tests[t].so, (long)tests[t].eo);
+                errors++;
+            }
+        }
+        regfree(&regex);
+    }
+    errors += check_long();
+    printf("regex-dfa: %d errors\n", errors);
+    return errors != 0;
+}
@@ -46,6 +46,38 @@ func(jmp_buf env, int param)
 
 static volatile int been_here;
 
+static jmp_buf outer_env, inner_env;
+
+static void
+recurse(int depth)
+{
+    volatile char pad[16];
+
+    if (depth < 0)
+        return;
+    pad[0] = (char)depth;
+    if (depth == 0)
+        longjmp(inner_env, 3);
+    recurse(pad[0] - 1);
+}
+
+static void
+nested(void)
+{
+    int ret = setjmp(inner_env);
+
+    printf("inner setjmp returns %d\n", ret);
+    if (!ret)
+        recurse(10);
+    longjmp(outer_env, ret + 1);
+}
+
+static void
+quiet_jump(jmp_buf env, int val)
+{
+    longjmp(env, val);
+}
+
 int
 main(void)
 {
@@ -71,5 +103,26 @@ main(void)
         printf("func returned\n");
         return 1;
     }
+
+    /* longjmp out of a nested setjmp/longjmp pair */
+    ret = setjmp(outer_env);
+    printf("setjmp 3 returns %d\n", ret);
+    if (!ret) {
+        nested();
+        printf("nested returned\n");
+        return 1;
+    }
+    if (ret != 4) {
+        printf("nested longjmp returned %d instead of 4\n", ret);
+        return 3;
+    }
+
+    /* Many round trips must leave the stack pointer where it was */
+    ret = setjmp(env);
+    if (ret < 100)
+        quiet_jump(env, ret + 1);
+    printf("setjmp 4 returns %d\n", ret);
+    if (ret != 100)
+        return 4;
     return 0;
 }
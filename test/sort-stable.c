@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that mergesort and timsort sort stably for several sizes,
+ * element widths and input patterns, and that sorted and reversed
+ * input takes a linear number of comparisons.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_N 3000
+
+struct rec {
+    int32_t key;
+    int32_t seq;
+};
+
+struct wide {
+    int32_t key;
+    int32_t seq;
+    char    pad[5];
+};
+
+static unsigned long compares;
+static uint32_t      rng = 1;
+
+static uint32_t
+next_rand(void)
+{
+    rng = rng * 1103515245 + 12345;
+    return rng >> 8;
+}
+
+static int
+cmp_rec(const void *a, const void *b)
+{
+    int32_t x = ((const struct rec *)a)->key, y = ((const struct rec *)b)->key;
+
+    compares++;
+    return (x > y) - (x < y);
+}
+
+static int
+cmp_wide(const void *a, const void *b)
+{
+    int32_t x = ((const struct wide *)a)->key, y = ((const struct wide *)b)->key;
+
+    compares++;
+    return (x > y) - (x < y);
+}
+
+enum { RANDOM, FEW_KEYS, SORTED, REVERSED, MOSTLY_SORTED, SAWTOOTH, NPATTERN };
+
+static const char *const pattern_name[NPATTERN] = {
+    "random", "few keys", "sorted", "reversed", "mostly sorted", "sawtooth",
+};
+
+static int32_t
+pattern_key(int pattern, size_t i, size_t n)
+{
+    switch (pattern) {
+    case RANDOM:
+        return (int32_t)(next_rand() % (n + 1));
+    case FEW_KEYS:
+        return (int32_t)(next_rand() % 4);
+    case SORTED:
+        return (int32_t)i;
+    case REVERSED:
+        return (int32_t)(n - i);
+    case MOSTLY_SORTED:
+        return (int32_t)i + ((next_rand() % 16) == 0 ? (int32_t)(next_rand() % 64) - 32 : 0);
+    default:
+        return (int32_t)(i % 97);
+    }
+}
+
+static struct rec  recs[MAX_N];
+static struct wide wides[MAX_N];
+static struct rec  scratch[MAX_N / 2];
+
+int
+main(void)
+{
+    static const size_t sizes[] = { 0, 1, 2, 3, 31, 63, 64, 65, 200, 1000, MAX_N };
+    int                 ret = 0;
+    unsigned            s;
+    int                 pattern, use_tmp;
+    size_t              i;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+
+        for (pattern = 0; pattern < NPATTERN; pattern++) {
+            for (use_tmp = 0; use_tmp < 3; use_tmp++) {
+                int r;
+
+                for (i = 0; i < n; i++) {
+                    recs[i].key = wides[i].key = pattern_key(pattern, i, n);
+                    recs[i].seq = wides[i].seq = (int32_t)i;
+                }
+
+                compares = 0;
+                if (use_tmp == 2)
+                    r = timsort(wides, n, sizeof(wides[0]), cmp_wide, NULL);
+                else if (use_tmp)
+                    r = timsort(recs, n, sizeof(recs[0]), cmp_rec, scratch);
+                else
+                    r = mergesort(recs, n, sizeof(recs[0]), cmp_rec);
+                if (r != 0) {
+                    printf("%s %zu: sort returned %d\n", pattern_name[pattern], n, r);
+                    ret = 1;
+                    continue;
+                }
+
+                for (i = 1; i < n; i++) {
+                    int32_t k0 = use_tmp == 2 ? wides[i - 1].key : recs[i - 1].key;
+                    int32_t k1 = use_tmp == 2 ? wides[i].key : recs[i].key;
+                    int32_t s0 = use_tmp == 2 ? wides[i - 1].seq : recs[i - 1].seq;
+                    int32_t s1 = use_tmp == 2 ? wides[i].seq : recs[i].seq;
+
+                    if (k0 > k1 || (k0 == k1 && s0 > s1)) {
+                        printf("%s %zu (%d): out of order at %zu\n", pattern_name[pattern], n,
+                               use_tmp, i);
+                        ret = 1;
+                        break;
+                    }
+                }
+
+                if ((pattern == SORTED || pattern == REVERSED) && n > 1 && compares >= n) {
+                    printf("%s %zu: %lu comparisons\n", pattern_name[pattern], n, compares);
+                    ret = 1;
+                }
+            }
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Without a width, sscanf parses floats with strtod directly on the
+ * string. Check that it agrees with the character at a time parser,
+ * used when a width is given, on the value stored, the number of
+ * conversions, how much input was consumed, and that errno is left
+ * alone.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *const inputs[] = {
+    "0",      "1.5",     "-2.25e3",  "  +7",    ".5x",      "5.",     "1e",      "1e+",
+    "1e-3y",  "1e400",   "-1e-400",  "1e-310",  "0x1.8p1",  "0x",     "0xg",     "-0x1p-2",
+    "inf",    "-INFINITY", "infx",   "nan",     "nan(1)",   "in",     "-",       ".",
+    "e5",     "",        "   ",      "123456789012345678901234567890", "3.4028236e38",
+};
+
+#define NINPUTS (sizeof(inputs) / sizeof(inputs[0]))
+
+int
+main(void)
+{
+    unsigned i;
+    int      ret = 0;
+
+    for (i = 0; i < NINPUTS; i++) {
+        float  ff = 0, fs = 0;
+        double df = 0, ds = 0;
+        int    rf, rs, nf = -1, ns = -1;
+
+        errno = 0;
+        rf = sscanf(inputs[i], "%f%n", &ff, &nf);
+        rs = sscanf(inputs[i], "%100f%n", &fs, &ns);
+        if (rf != rs || nf != ns || memcmp(&ff, &fs, sizeof(ff)) != 0) {
+            printf("%%f \"%s\": %d %d %a, expected %d %d %a\n", inputs[i], rf, nf, (double)ff,
+                   rs, ns, (double)fs);
+            ret = 1;
+        }
+
+        nf = ns = -1;
+        rf = sscanf(inputs[i], "%lf%n", &df, &nf);
+        rs = sscanf(inputs[i], "%100lf%n", &ds, &ns);
+        if (rf != rs || nf != ns || memcmp(&df, &ds, sizeof(df)) != 0) {
+            printf("%%lf \"%s\": %d %d %a, expected %d %d %a\n", inputs[i], rf, nf, df, rs, ns,
+                   ds);
+            ret = 1;
+        }
+
+        /* Suppressed assignment */
+        nf = ns = -1;
+        rf = sscanf(inputs[i], "%*g%n", &nf);
+        rs = sscanf(inputs[i], "%*100g%n", &ns);
+        if (rf != rs || nf != ns) {
+            printf("%%*g \"%s\": %d %d, expected %d %d\n", inputs[i], rf, nf, rs, ns);
+            ret = 1;
+        }
+
+        if (errno != 0) {
+            printf("\"%s\": errno %d\n", inputs[i], errno);
+            ret = 1;
+        }
+    }
+    return ret;
+}
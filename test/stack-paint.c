@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that __stack_high_water sees stack used after __stack_paint
+ * and that painting again resets it.
+ */
+
+#include <picostack.h>
+#include <stdio.h>
+
+#define USE 512
+
+static size_t __noinline
+use_stack(void)
+{
+    volatile char buf[USE];
+    size_t        i;
+
+    for (i = 0; i < sizeof(buf); i++)
+        buf[i] = (char)i;
+    return __stack_high_water();
+}
+
+int
+main(void)
+{
+    int    ret = 0;
+    size_t before, during, after;
+
+    __stack_paint();
+    before = __stack_high_water();
+    during = use_stack();
+    after = __stack_high_water();
+
+    if (before > __stack_size() || after > __stack_size()) {
+        printf("high water %zu/%zu beyond stack size %zu\n", before, after, __stack_size());
+        ret = 1;
+    }
+    if (during < USE || during <= before) {
+        printf("high water %zu after using %d bytes, %zu before\n", during, USE, before);
+        ret = 1;
+    }
+    if (after != during) {
+        printf("high water moved from %zu to %zu on return\n", during, after);
+        ret = 1;
+    }
+
+    __stack_paint();
+    if (__stack_high_water() >= during) {
+        printf("repainting left high water at %zu\n", __stack_high_water());
+        ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * <stdbit.h>: every operation on every type against bit-at-a-time
+ * reference versions, through the type-generic macros, the inline
+ * per-type names and the out-of-line functions.
+ */
+
+#include <stdbit.h>
+#include <stdio.h>
+
+typedef unsigned long long ull;
+
+static int error;
+
+static unsigned
+ref_clz(ull x, int w)
+{
+    unsigned n = 0;
+
+    while (w-- > 0 && !((x >> w) & 1))
+        n++;
+    return n;
+}
+
+static unsigned
+ref_ctz(ull x, int w)
+{
+    unsigned n = 0;
+    int      i;
+
+    for (i = 0; i < w && !((x >> i) & 1); i++)
+        n++;
+    return n;
+}
+
+static unsigned
+ref_popcount(ull x)
+{
+    unsigned n = 0;
+
+    for (; x; x >>= 1)
+        n += x & 1;
+    return n;
+}
+
+static ull
+ref_bit_ceil(ull x, ull mask)
+{
+    ull c = 1;
+
+    while (c < x && c)
+        c <<= 1;
+    return c > mask ? 0 : c;
+}
+
+#define check(expr, want)                                                                        \
+    do {                                                                                         \
+        ull got_ = (ull)(expr), want_ = (ull)(want);                                             \
+        if (got_ != want_) {                                                                     \
+            printf("%s(0x%llx): got 0x%llx want 0x%llx\n", #expr, (ull)x, got_, want_);          \
+            error = 1;                                                                           \
+        }                                                                                        \
+    } while (0)
+
+#define test_type(type, sfx, v)                                                                  \
+    do {                                                                                         \
+        type     x = (type)(v);                                                                  \
+        int      w = (int)sizeof(type) * __CHAR_BIT__;                                           \
+        ull      mask = w == 64 ? ~0ULL : (1ULL << w) - 1;                                       \
+        ull      inv = ~(ull)x & mask;                                                           \
+        check(stdc_leading_zeros(x), ref_clz(x, w));                                             \
+        check(stdc_leading_ones(x), ref_clz(inv, w));                                            \
+        check(stdc_trailing_zeros(x), ref_ctz(x, w));                                            \
+        check(stdc_trailing_ones(x), ref_ctz(inv, w));                                           \
+        check(stdc_first_leading_zero(x), inv ? ref_clz(inv, w) + 1 : 0);                        \
+        check(stdc_first_leading_one(x), x ? ref_clz(x, w) + 1 : 0);                             \
+        check(stdc_first_trailing_zero(x), inv ? ref_ctz(inv, w) + 1 : 0);                       \
+        check(stdc_first_trailing_one(x), x ? ref_ctz(x, w) + 1 : 0);                            \
+        check(stdc_count_zeros(x), w - ref_popcount(x));                                         \
+        check(stdc_count_ones(x), ref_popcount(x));                                              \
+        check(stdc_has_single_bit(x), ref_popcount(x) == 1);                                     \
+        check(stdc_bit_width(x), w - ref_clz(x, w));                                             \
+        check(stdc_bit_floor(x), x ? 1ULL << (w - 1 - ref_clz(x, w)) : 0);                       \
+        check(stdc_bit_ceil(x), ref_bit_ceil(x, mask));                                          \
+        check(stdc_leading_zeros_##sfx(x), ref_clz(x, w));                                       \
+        check(stdc_count_ones_##sfx(x), ref_popcount(x));                                        \
+        check((stdc_trailing_zeros_##sfx)(x), ref_ctz(x, w));                                    \
+        check((stdc_first_leading_zero_##sfx)(x), inv ? ref_clz(inv, w) + 1 : 0);                \
+        check((stdc_bit_ceil_##sfx)(x), ref_bit_ceil(x, mask));                                  \
+    } while (0)
+
+static const ull values[] = {
+    0,
+    1,
+    2,
+    3,
+    0x7f,
+    0x80,
+    0x81,
+    0xff,
+    0x100,
+    0x7fff,
+    0x8000,
+    0xffff,
+    0x10001,
+    0x12345678,
+    0x7fffffff,
+    0x80000000,
+    0x80000001,
+    0xffffffff,
+    0x100000000ULL,
+    0x123456789abcdef0ULL,
+    0x8000000000000000ULL,
+    0xf0f0f0f0f0f0f0f0ULL,
+    ~0ULL,
+};
+
+int
+main(void)
+{
+    unsigned i;
+    int      s;
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        test_type(unsigned char, uc, values[i]);
+        test_type(unsigned short, us, values[i]);
+        test_type(unsigned int, ui, values[i]);
+        test_type(unsigned long, ul, values[i]);
+        test_type(unsigned long long, ull, values[i]);
+    }
+
+    /* Every single-bit value, and its neighbours */
+    for (s = 0; s < 64; s++) {
+        test_type(unsigned long long, ull, 1ULL << s);
+        test_type(unsigned long long, ull, (1ULL << s) - 1);
+        test_type(unsigned long long, ull, (1ULL << s) + 1);
+        test_type(unsigned int, ui, 1ULL << s);
+        test_type(unsigned int, ui, (1ULL << s) - 1);
+    }
+
+    return error;
+}
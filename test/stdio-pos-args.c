@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * printf and scanf locate positional arguments in one pass over the
+ * format; check out of order, repeated and width/precision positions
+ * of every argument size.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+static int
+check(const char *what, const char *got, const char *want)
+{
+    if (!strcmp(got, want))
+        return 0;
+    printf("%s: got \"%s\" want \"%s\"\n", what, got, want);
+    return 1;
+}
+
+int
+main(void)
+{
+    int    ret = 0;
+    char   buf[128];
+    int    a = 0, b = 0, c = 0;
+    long   l = 0;
+    char   s[16];
+    double d = 0;
+
+    snprintf(buf, sizeof(buf), "%3$s %1$d %2$s", 1, "two", "three");
+    ret |= check("reorder", buf, "three 1 two");
+
+    snprintf(buf, sizeof(buf), "%2$lld %1$d %2$lld", 7, 123456789012LL);
+    ret |= check("repeat", buf, "123456789012 7 123456789012");
+
+    snprintf(buf, sizeof(buf), "%4$c%1$*2$.*3$f%4$c", 3.14159, 8, 2, '|');
+    ret |= check("width and precision", buf, "|    3.14|");
+
+    snprintf(buf, sizeof(buf), "%5$s%4$s%3$s%2$s%1$s", "a", "b", "c", "d", "e");
+    ret |= check("reverse", buf, "edcba");
+
+    snprintf(buf, sizeof(buf), "%2$p %1$lu", 5UL, (void *)0);
+    snprintf(s, sizeof(s), "%p", (void *)0);
+    strcat(s, " 5");
+    ret |= check("pointer", buf, s);
+
+    if (sscanf("1 2 3", "%3$d %1$d %2$d", &a, &b, &c) != 3 || a != 2 || b != 3 || c != 1) {
+        printf("sscanf reorder: %d %d %d\n", a, b, c);
+        ret = 1;
+    }
+    if (sscanf("xy 7 2.5 9", "%2$s %1$ld %3$lf %*d", &l, s, &d) != 3 || l != 7 || d != 2.5
+        || strcmp(s, "xy")) {
+        printf("sscanf mixed: %ld %s %g\n", l, s, d);
+        ret = 1;
+    }
+
+    return ret;
+}
@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that fputs, fwrite, fread and the literal text and strings in
+ * printf move whole spans through put_span and get_span, and that the
+ * string, allocating string, fmemopen and bufio streams still produce
+ * the same bytes, truncation and end of file as a byte at a time.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdio-bufio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char   out[256];
+static size_t out_len;
+static int    puts_calls, span_calls;
+
+static int
+count_put(char c, FILE *f)
+{
+    (void)f;
+    puts_calls++;
+    if (out_len >= sizeof(out))
+        return EOF;
+    out[out_len++] = c;
+    return (unsigned char)c;
+}
+
+static size_t
+count_put_span(const char *s, size_t len, FILE *f)
+{
+    (void)f;
+    span_calls++;
+    if (len > sizeof(out) - out_len)
+        len = sizeof(out) - out_len;
+    memcpy(out + out_len, s, len);
+    out_len += len;
+    return len;
+}
+
+static const char *in_pos = "0123456789abcdefghij";
+
+static int
+count_get(FILE *f)
+{
+    (void)f;
+    if (!*in_pos)
+        return _FDEV_EOF;
+    return (unsigned char)*in_pos++;
+}
+
+static size_t
+count_get_span(char *s, size_t len, FILE *f)
+{
+    size_t avail = strlen(in_pos);
+
+    span_calls++;
+    if (len > avail) {
+        len = avail;
+        f->flags |= __SEOF;
+    }
+    memcpy(s, in_pos, len);
+    in_pos += len;
+    return len;
+}
+
+static FILE span_out = FDEV_SETUP_STREAM_SPAN(count_put, NULL, count_put_span, NULL, NULL,
+                                              _FDEV_SETUP_WRITE);
+static FILE span_in = FDEV_SETUP_STREAM_SPAN(NULL, count_get, NULL, count_get_span, NULL,
+                                             _FDEV_SETUP_READ);
+
+static int
+check(const char *what, const char *got, size_t len, const char *want)
+{
+    if (len == strlen(want) && !memcmp(got, want, len))
+        return 0;
+    printf("%s: got \"%.*s\" want \"%s\"\n", what, (int)len, got, want);
+    return 1;
+}
+
+struct sink {
+    char   data[256];
+    size_t len;
+};
+
+static ssize_t
+sink_write(void *ptr, const void *buf, size_t count)
+{
+    struct sink *s = ptr;
+
+    if (count > sizeof(s->data) - s->len)
+        return -1;
+    memcpy(s->data + s->len, buf, count);
+    s->len += count;
+    return count;
+}
+
+int
+main(void)
+{
+    int    ret = 0;
+    char   buf[64];
+    char  *str;
+    FILE  *f;
+    size_t n;
+
+    /* Each literal run and %s is one span, conversions go per byte */
+    fputs("hello, ", &span_out);
+    fwrite("world", 1, 5, &span_out);
+    fprintf(&span_out, " [%s] %d items of %s\n", "span", 42, "text");
+    ret |= check("span stream", out, out_len, "hello, world [span] 42 items of text\n");
+    if (span_calls != 8 || puts_calls != 2) {
+        printf("span stream: %d span calls, %d put calls\n", span_calls, puts_calls);
+        ret = 1;
+    }
+
+    /* fread takes a pending ungetc first, then one span */
+    span_calls = 0;
+    if (getc(&span_in) != '0' || ungetc('0', &span_in) != '0') {
+        printf("getc/ungetc on span stream failed\n");
+        ret = 1;
+    }
+    n = fread(buf, 1, 8, &span_in);
+    ret |= check("span read", buf, n, "01234567");
+    n = fread(buf, 4, 4, &span_in);
+    ret |= check("span read to eof", buf, n * 4, "89abcdefghij");
+    if (!feof(&span_in) || span_calls != 2) {
+        printf("span read: eof %d, %d span calls\n", feof(&span_in) != 0, span_calls);
+        ret = 1;
+    }
+
+    /* String streams truncate spans like bytes */
+    memset(buf, 'x', sizeof(buf));
+    n = snprintf(buf, 10, "abc%sdef%s", "0123", "gh");
+    if (n != 12 || strcmp(buf, "abc0123de")) {
+        printf("snprintf: %zu \"%s\"\n", n, buf);
+        ret = 1;
+    }
+    if (snprintf(NULL, 0, "literal %s", "string") != 14) {
+        printf("snprintf(NULL, 0) miscounted\n");
+        ret = 1;
+    }
+    sprintf(buf, "%s and %s", "this", "that");
+    ret |= check("sprintf", buf, strlen(buf), "this and that");
+
+    /* Allocating streams grow by whole spans */
+    if (asprintf(&str, "%s-%s-%s", "a string longer than the 32 byte growth step", "b", "c") < 0) {
+        printf("asprintf failed\n");
+        ret = 1;
+    } else {
+        ret |= check("asprintf", str, strlen(str),
+                     "a string longer than the 32 byte growth step-b-c");
+        free(str);
+    }
+
+    /* fmemopen stops at the end of its buffer and flags the error */
+    memset(buf, 0, sizeof(buf));
+    f = fmemopen(buf, 8, "w");
+    if (f) {
+        if (fputs("abcdefghijk", f) != EOF || !ferror(f))
+            printf("fmemopen overflow not reported\n"), ret = 1;
+        fclose(f);
+        ret |= check("fmemopen write", buf, 8, "abcdefgh");
+    }
+    strcpy(buf, "0123456789");
+    f = fmemopen(buf, 10, "r");
+    if (f) {
+        char rd[16];
+
+        n = fread(rd, 1, 4, f);
+        ret |= check("fmemopen read", rd, n, "0123");
+        n = fread(rd, 1, sizeof(rd), f);
+        ret |= check("fmemopen read to eof", rd, n, "456789");
+        if (!feof(f))
+            printf("fmemopen eof not set\n"), ret = 1;
+        fclose(f);
+    }
+
+    /* Line buffered bufio streams flush a span holding a newline */
+    {
+        static char         sbuf[16];
+        static struct sink  sink;
+        struct __file_bufio bf = FDEV_SETUP_BUFIO_PTR(&sink, sbuf, sizeof(sbuf), NULL, sink_write,
+                                                      NULL, NULL, __SWR, __BLBF);
+        FILE               *bfile = &bf.xfile.cfile.file;
+
+        fputs("no newline", bfile);
+        if (sink.len != 0)
+            printf("bufio: flushed without a newline\n"), ret = 1;
+        fprintf(bfile, " %s\n", "then");
+        ret |= check("bufio line", sink.data, sink.len, "no newline then\n");
+        fputs("and a span longer than the buffer", bfile);
+        fflush(bfile);
+        ret |= check("bufio flush", sink.data, sink.len,
+                     "no newline then\nand a span longer than the buffer");
+    }
+
+    return ret;
+}
@@ -0,0 +1,136 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Drive the *_unlocked stdio functions through small buffered streams
+ * while holding the FILE lock, so getc_unlocked and putc_unlocked hit
+ * both the inline buffer path and the refill and flush paths.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdio-bufio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char text[] = "first line\nsecond\nabcdefghijklmnopqrstuvwxyz";
+
+struct sink {
+    char   data[256];
+    size_t len;
+    int    writes;
+};
+
+static ssize_t
+source_read(void *ptr, void *buf, size_t count)
+{
+    const char **pos = ptr;
+    size_t       left = strlen(*pos);
+
+    if (count > 5)
+        count = 5;
+    if (count > left)
+        count = left;
+    memcpy(buf, *pos, count);
+    *pos += count;
+    return count;
+}
+
+static ssize_t
+sink_write(void *ptr, const void *buf, size_t count)
+{
+    struct sink *s = ptr;
+
+    if (count > sizeof(s->data) - s->len)
+        return -1;
+    memcpy(s->data + s->len, buf, count);
+    s->len += count;
+    s->writes++;
+    return count;
+}
+
+static int
+check(const char *what, const char *got, size_t len, const char *want)
+{
+    if (len == strlen(want) && !memcmp(got, want, len))
+        return 0;
+    printf("%s: got \"%.*s\" want \"%s\"\n", what, (int)len, got, want);
+    return 1;
+}
+
+static int
+test_read(void)
+{
+    static char         buf[8];
+    const char         *pos = text;
+    struct __file_bufio bf = FDEV_SETUP_BUFIO_PTR(&pos, buf, sizeof(buf), source_read, NULL, NULL,
+                                                  NULL, __SRD, 0);
+    FILE               *f = &bf.xfile.cfile.file;
+    char                line[32];
+    int                 c, ret = 0;
+    size_t              n;
+
+    flockfile(f);
+    if (!fgets_unlocked(line, sizeof(line), f))
+        line[0] = '\0';
+    ret |= check("fgets_unlocked", line, strlen(line), "first line\n");
+    n = 0;
+    while ((c = getc_unlocked(f)) != '\n' && c != EOF)
+        line[n++] = (char)c;
+    ret |= check("getc_unlocked", line, n, "second");
+    c = fgetc_unlocked(f);
+    ungetc(c, f);
+    n = fread_unlocked(line, 1, 10, f);
+    ret |= check("fread_unlocked", line, n, "abcdefghij");
+    n = 0;
+    while ((c = getc_unlocked(f)) != EOF)
+        line[n++] = (char)c;
+    ret |= check("rest", line, n, "klmnopqrstuvwxyz");
+    if (!feof_unlocked(f)) {
+        printf("no eof\n");
+        ret = 1;
+    }
+    funlockfile(f);
+    return ret;
+}
+
+static int
+test_write(uint8_t bflags)
+{
+    static char         buf[8];
+    struct sink         s = { .len = 0 };
+    struct __file_bufio bf = FDEV_SETUP_BUFIO_PTR(&s, buf, sizeof(buf), NULL, sink_write, NULL,
+                                                  NULL, __SWR, bflags);
+    FILE               *f = &bf.xfile.cfile.file;
+    const char         *p;
+    int                 ret = 0;
+
+    flockfile(f);
+    for (p = "abc\n"; *p; p++)
+        putc_unlocked(*p, f);
+    if (bflags & __BLBF)
+        ret |= check("line buffered", s.data, s.len, "abc\n");
+    fputs_unlocked("0123456789", f);
+    fputc_unlocked('!', f);
+    fwrite_unlocked("xyz\n", 1, 4, f);
+    fflush_unlocked(f);
+    ret |= check(bflags & __BLBF ? "line" : "full", s.data, s.len, "abc\n0123456789!xyz\n");
+    if (ferror_unlocked(f)) {
+        printf("error set\n");
+        ret = 1;
+    }
+    funlockfile(f);
+    return ret;
+}
+
+int
+main(void)
+{
+    int ret = 0;
+
+    ret |= test_read();
+    ret |= test_write(0);
+    ret |= test_write(__BLBF);
+    return ret;
+}
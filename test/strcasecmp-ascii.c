@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Compare strcasecmp, strncasecmp and strcasestr against byte at a
+ * time versions built on tolower, from every pair of alignments and
+ * with the bytes on either side of the ASCII letters, so the word at a
+ * time folding and its boundaries get exercised.
+ */
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+static const char alphabet[] = "aAzZ@[`{09 -\x80\xc1\xe1\xff";
+
+static int
+ref_strncasecmp(const char *s1, const char *s2, size_t n)
+{
+    int d = 0;
+
+    for (; n != 0; n--) {
+        const int c1 = tolower(*(unsigned char *)s1++);
+        const int c2 = tolower(*(unsigned char *)s2++);
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+            break;
+    }
+    return d;
+}
+
+static char *
+ref_strcasestr(const char *s, const char *find)
+{
+    size_t n = strlen(find);
+
+    for (; *s; s++)
+        if (ref_strncasecmp(s, find, n) == 0)
+            return (char *)s;
+    return n ? NULL : (char *)s;
+}
+
+static unsigned long seed = 1;
+
+static unsigned
+next(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16);
+}
+
+static char
+flip(char c)
+{
+    return isalpha((unsigned char)c) && (unsigned char)c < 0x80 ? c ^ 0x20 : c;
+}
+
+int
+main(void)
+{
+    static char b1[64 + 8], b2[64 + 8];
+    char        find[8];
+    unsigned    o1, o2, i, iter;
+    int         ret = 0;
+
+    for (iter = 0; iter < 4000; iter++) {
+        unsigned n = next() % 40;
+        unsigned m = next() % 5;
+        size_t   k = next() % 48;
+
+        o1 = iter % 8;
+        o2 = (iter / 8) % 8;
+        for (i = 0; i < n; i++) {
+            b1[o1 + i] = alphabet[next() % (sizeof(alphabet) - 1)];
+            b2[o2 + i] = next() & 1 ? flip(b1[o1 + i]) : b1[o1 + i];
+        }
+        b1[o1 + n] = '\0';
+        b2[o2 + n] = '\0';
+        if (n && next() % 4 == 0)
+            b2[o2 + next() % n] = alphabet[next() % (sizeof(alphabet) - 1)];
+
+        const char *s1 = b1 + o1, *s2 = b2 + o2;
+
+        if ((strcasecmp(s1, s2) > 0) != (ref_strncasecmp(s1, s2, SIZE_MAX) > 0)
+            || (strcasecmp(s1, s2) < 0) != (ref_strncasecmp(s1, s2, SIZE_MAX) < 0)) {
+            printf("strcasecmp \"%s\" \"%s\"\n", s1, s2);
+            ret = 1;
+        }
+        if ((strncasecmp(s1, s2, k) > 0) != (ref_strncasecmp(s1, s2, k) > 0)
+            || (strncasecmp(s1, s2, k) < 0) != (ref_strncasecmp(s1, s2, k) < 0)) {
+            printf("strncasecmp \"%s\" \"%s\" %zu\n", s1, s2, k);
+            ret = 1;
+        }
+
+        /* Look for a case-flipped piece of s1, or something random */
+        if (n > m && next() & 1) {
+            unsigned p = next() % (n - m);
+            for (i = 0; i < m; i++)
+                find[i] = flip(s1[p + i]);
+        } else {
+            for (i = 0; i < m; i++)
+                find[i] = alphabet[next() % (sizeof(alphabet) - 1)];
+        }
+        find[m] = '\0';
+        if (strcasestr(s1, find) != ref_strcasestr(s1, find)) {
+            printf("strcasestr \"%s\" \"%s\"\n", s1, find);
+            ret = 1;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strfromd and gcvt format without going through snprintf: check that
+ * they produce exactly what snprintf does, for every precision and
+ * conversion strfromd accepts, including truncation, the return value,
+ * infinities, NaNs and formats they hand back to snprintf.
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const double vals[] = {
+    0.0,    -0.0,    1.0,         -1.5,    0.1,      123456.789, 1e-5,     9.9999999e-5,
+    1e300,  -1e-300, 2.5,         0.5,     999999.5, 1e16,       3.14159265358979,
+    1e22,   0.000123, 99.95,      INFINITY, -INFINITY, NAN,
+};
+
+static int error;
+
+static void
+compare(const char *fmt, double v, size_t n)
+{
+    char a[400], b[400];
+    int  ra, rb;
+
+    memset(a, 'x', sizeof(a));
+    memset(b, 'x', sizeof(b));
+    ra = strfromd(a, n, fmt, v);
+    rb = snprintf(b, n, fmt, v);
+    if (ra != rb || memcmp(a, b, sizeof(a)) != 0) {
+        printf("strfromd(%zu, \"%s\", %g): \"%.60s\" (%d), snprintf \"%.60s\" (%d)\n", n, fmt, v,
+               a, ra, b, rb);
+        error = 1;
+    }
+}
+
+int
+main(void)
+{
+    static const char convs[] = "eEfFgG";
+    char              fmt[16], a[400], b[400];
+    unsigned          i;
+    const char       *c;
+    int               p;
+
+    for (i = 0; i < sizeof(vals) / sizeof(vals[0]); i++) {
+        for (c = convs; *c; c++) {
+            for (p = -1; p < 20; p++) {
+                if (p < 0)
+                    snprintf(fmt, sizeof(fmt), "%%%c", *c);
+                else
+                    snprintf(fmt, sizeof(fmt), "%%.%d%c", p, *c);
+                compare(fmt, vals[i], sizeof(a));
+                compare(fmt, vals[i], 0);
+                compare(fmt, vals[i], 4);
+            }
+            snprintf(fmt, sizeof(fmt), "%%.%c", *c);
+            compare(fmt, vals[i], sizeof(a));
+        }
+        compare("%a", vals[i], sizeof(a));
+        compare("%.3A", vals[i], sizeof(a));
+        for (p = 0; p < 18; p++) {
+            gcvt(vals[i], p, a);
+            snprintf(b, sizeof(b), "%.*g", p, vals[i]);
+            if (strcmp(a, b) != 0) {
+                printf("gcvt(%g, %d): \"%s\", snprintf \"%s\"\n", vals[i], p, a, b);
+                error = 1;
+            }
+        }
+    }
+    return error;
+}
@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* The first NUMERIC formats only use numeric fields and can be given out of range values */
+#define NUMERIC 4
+
+static const char *const formats[] = {
+    "%Y-%m-%dT%H:%M:%S",
+    "%F %T",
+    "[%e/%j] %R%n%t%%",
+    "%+4Y-%m-%d %3H %5j",
+    "%a %b %d %Y %I:%M:%S %p %Z",
+    "%OM %EY %_d %k",
+    "plain text only",
+    "%y%C%G%g%V%u%w%U%W%s%z",
+    "%c | %x | %X | %D | %r | %h %A %B",
+    "%%%%",
+    "",
+    "a rather long piece of literal text which is longer than two hundred and fifty five "
+    "bytes so that the compiler has to split it into more than one operation, this keeps "
+    "going for a while longer just to make sure we get past that limit with some margin %Y"
+    " done",
+};
+
+static unsigned long rnd_state = 1;
+
+static int
+rnd(int lo, int hi)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return lo + (int)((rnd_state >> 8) % (unsigned long)(hi - lo + 1));
+}
+
+static void
+random_tm(struct tm *tm, int wild)
+{
+    memset(tm, 0, sizeof(*tm));
+    if (wild) {
+        tm->tm_sec = rnd(-5, 120);
+        tm->tm_min = rnd(-5, 120);
+        tm->tm_hour = rnd(-5, 120);
+        tm->tm_mday = rnd(-5, 120);
+        tm->tm_mon = rnd(-3, 110);
+        tm->tm_wday = rnd(0, 6);
+        tm->tm_year = rnd(-12000, 12000);
+        tm->tm_yday = rnd(-3, 1200);
+    } else {
+        tm->tm_sec = rnd(0, 60);
+        tm->tm_min = rnd(0, 59);
+        tm->tm_hour = rnd(0, 23);
+        tm->tm_mday = rnd(1, 31);
+        tm->tm_mon = rnd(0, 11);
+        tm->tm_year = rnd(-1900, 8099);
+        tm->tm_yday = rnd(0, 365);
+    }
+    tm->tm_wday = rnd(0, 6);
+    tm->tm_isdst = rnd(-1, 1);
+}
+
+int
+main(void)
+{
+    struct strftime_format cf;
+    char                   want[512], got[512];
+    int                    ret = 0;
+    unsigned               f;
+    int                    i;
+
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+
+    for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        if (strftime_compile(&cf, formats[f]) != 0) {
+            printf("strftime_compile(\"%s\") failed\n", formats[f]);
+            ret = 1;
+            continue;
+        }
+        for (i = 0; i < 2000; i++) {
+            struct tm tm;
+            size_t    wlen, glen, max;
+
+            random_tm(&tm, f < NUMERIC && (i & 1));
+            wlen = strftime(want, sizeof(want), formats[f], &tm);
+            glen = strftime_compiled(got, sizeof(got), &cf, &tm);
+            if (wlen != glen || strcmp(want, got) != 0) {
+                printf("\"%s\": got \"%s\" (%zu) want \"%s\" (%zu)\n", formats[f], got, glen,
+                       want, wlen);
+                ret = 1;
+                break;
+            }
+            if (strftime_compiled(got, 0, &cf, &tm) != 0) {
+                printf("\"%s\" max 0 did not fail\n", formats[f]);
+                ret = 1;
+                break;
+            }
+            /* Both must give up in exactly the same place */
+            for (max = 1; max <= wlen + 1 && (i & 63) == 0; max++) {
+                wlen = strftime(want, max, formats[f], &tm);
+                glen = strftime_compiled(got, max, &cf, &tm);
+                if (wlen != glen) {
+                    printf("\"%s\" max %zu: got %zu want %zu\n", formats[f], max, glen, wlen);
+                    ret = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Errors */
+    errno = 0;
+    if (strftime_compile(&cf, "abc %Y %") != -1 || errno != EINVAL) {
+        printf("trailing %% accepted\n");
+        ret = 1;
+    }
+    errno = 0;
+    if (strftime_compile(&cf, "%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y%Y")
+            != -1
+        || errno != E2BIG) {
+        printf("too many operations accepted\n");
+        ret = 1;
+    }
+
+    /* ISO 8601 and RFC 3339 */
+    for (i = 0; i < 20000; i++) {
+        struct tm tm;
+        size_t    wlen, glen;
+        long      off = rnd(-50400, 50400);
+
+        random_tm(&tm, (i & 3) == 0);
+        wlen = strftime(want, sizeof(want), "%Y-%m-%dT%H:%M:%S", &tm);
+        glen = strftime_iso8601(got, sizeof(got), &tm);
+        if (wlen != glen || strcmp(want, got) != 0) {
+            printf("iso8601: got \"%s\" want \"%s\"\n", got, want);
+            ret = 1;
+            break;
+        }
+        if ((i & 7) == 0)
+            off = 0;
+        long am = (off < 0 ? -off : off) / 60;
+        if (off == 0)
+            strcat(want, "Z");
+        else
+            sprintf(want + wlen, "%c%02ld:%02ld", off < 0 ? '-' : '+', am / 60, am % 60);
+        glen = strftime_rfc3339(got, sizeof(got), &tm, off);
+        if (glen != strlen(want) || strcmp(want, got) != 0) {
+            printf("rfc3339: got \"%s\" want \"%s\"\n", got, want);
+            ret = 1;
+            break;
+        }
+        if (strftime_rfc3339(got, glen, &tm, off) != 0 || strftime_iso8601(got, wlen, &tm) != 0) {
+            printf("truncated output not rejected\n");
+            ret = 1;
+            break;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * strptime parses the ISO 8601 formats at fixed positions: check that
+ * it gives what the general parser does, that strptime_rfc3339 finds
+ * the right instant, fraction and offset, and that both reject text
+ * which does not fit.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static unsigned long rnd_state = 1;
+
+static int
+rnd(int lo, int hi)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return lo + (int)((rnd_state >> 8) % (unsigned long)(hi - lo + 1));
+}
+
+static int
+same_tm(const struct tm *a, const struct tm *b)
+{
+    return a->tm_year == b->tm_year && a->tm_mon == b->tm_mon && a->tm_mday == b->tm_mday
+        && a->tm_hour == b->tm_hour && a->tm_min == b->tm_min && a->tm_sec == b->tm_sec
+        && a->tm_yday == b->tm_yday && a->tm_wday == b->tm_wday && a->tm_isdst == b->tm_isdst;
+}
+
+static const struct {
+    const char *text;
+    time_t      sec;
+    long        nsec;
+    long        utcoff;
+    size_t      len;
+} rfc3339[] = {
+    { "1970-01-01T00:00:00Z", 0, 0, 0, 20 },
+    { "2000-03-01T12:34:56.789+05:30", 951894296, 789000000, 19800, 29 },
+    { "1969-12-31 23:59:59,5-01:00 trailing", 3599, 500000000, -3600, 27 },
+    { "2024-02-29t00:00:00.1234567891z", 1709164800, 123456789, 0, 31 },
+    { "2016-12-31T23:59:60Z", 1483228800, 0, 0, 20 },
+};
+
+static const char *const bad_rfc3339[] = {
+    "2023-02-29T00:00:00Z", "2024-04-31T00:00:00Z", "2024-01-01T00:00:61Z",
+    "2024-01-01T00:00:00",  "2024-01-01T00:00:00.Z", "2024-01-01T00:00:00+1:00",
+    "2024-01-01T24:00:00Z", "2024-01-01X00:00:00Z", "2024-1-01T00:00:00Z",
+};
+
+int
+main(void)
+{
+    static const char *const formats[] = {
+        "%Y-%m-%dT%H:%M:%S", "%Y-%m-%d %H:%M:%S", "%FT%T", "%F %T",
+    };
+    struct tm       want, got;
+    struct timespec ts;
+    char            text[64];
+    char           *w, *g;
+    long            off;
+    int             ret = 0;
+    unsigned        i, f;
+
+    for (i = 0; i < 20000; i++) {
+        snprintf(text, sizeof(text), "%04d-%02d-%02d%c%02d:%02d:%02d%s", rnd(0, 9999), rnd(1, 12),
+                 rnd(1, 31), (i & 1) ? 'T' : ' ', rnd(0, 23), rnd(0, 59), rnd(0, 61),
+                 (i & 2) ? ".5Z" : "");
+        if ((i & 255) == 0)
+            text[rnd(0, 18)] = "x-:9 "[rnd(0, 4)];
+        for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+            char general[32];
+
+            /* A trailing space keeps strptime off the fixed position path */
+            snprintf(general, sizeof(general), "%s ", formats[f]);
+            w = strptime(text, general, &want);
+            g = strptime(text, formats[f], &got);
+            if (w != g || (w && !same_tm(&want, &got))) {
+                printf("strptime \"%s\" \"%s\" differs\n", text, formats[f]);
+                ret = 1;
+            }
+        }
+        if (text[10] == 'T') {
+            w = strptime(text, "%Y-%m-%dT%H:%M:%S ", &want);
+            g = strptime_iso8601(text, &got);
+            if (w != g || (w && !same_tm(&want, &got))) {
+                printf("strptime_iso8601 \"%s\" differs\n", text);
+                ret = 1;
+            }
+        }
+    }
+
+    for (i = 0; i < sizeof(rfc3339) / sizeof(rfc3339[0]); i++) {
+        g = strptime_rfc3339(rfc3339[i].text, &got, &off, &ts);
+        if (g != rfc3339[i].text + rfc3339[i].len || ts.tv_sec != rfc3339[i].sec
+            || ts.tv_nsec != rfc3339[i].nsec || off != rfc3339[i].utcoff) {
+            printf("strptime_rfc3339 \"%s\": got %lld.%09ld %+ld\n", rfc3339[i].text,
+                   (long long)ts.tv_sec, ts.tv_nsec, off);
+            ret = 1;
+        }
+    }
+    for (i = 0; i < sizeof(bad_rfc3339) / sizeof(bad_rfc3339[0]); i++) {
+        if (strptime_rfc3339(bad_rfc3339[i], &got, NULL, NULL) != NULL) {
+            printf("strptime_rfc3339 \"%s\" accepted\n", bad_rfc3339[i]);
+            ret = 1;
+        }
+    }
+
+    /* Every day of a few centuries against gmtime */
+    for (i = 0; i < 150000; i += rnd(1, 7)) {
+        time_t    t = (time_t)((long)i - 75000) * 86400 + rnd(0, 86399);
+        struct tm tm;
+
+        gmtime_r(&t, &tm);
+        strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &tm);
+        if (!strptime_rfc3339(text, &got, NULL, &ts) || ts.tv_sec != t || got.tm_wday != tm.tm_wday
+            || got.tm_yday != tm.tm_yday) {
+            printf("strptime_rfc3339 \"%s\" wrong\n", text);
+            ret = 1;
+            break;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,167 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check strspn, strcspn, strpbrk, strtok_r and strsep and their
+ * strset versions against one character at a time references, on
+ * random strings and sets of up to three characters.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#define STRLEN 60
+#define ROUNDS 5000
+
+static unsigned long seed = 1;
+
+static unsigned
+next(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (unsigned)(seed >> 16);
+}
+
+/* Reference versions, one character at a time */
+
+static int
+in_set(char c, const char *set)
+{
+    for (; *set; set++)
+        if (*set == c)
+            return 1;
+    return 0;
+}
+
+static size_t
+ref_strspn(const char *s, const char *set)
+{
+    size_t n = 0;
+
+    while (s[n] && in_set(s[n], set))
+        n++;
+    return n;
+}
+
+static size_t
+ref_strcspn(const char *s, const char *set)
+{
+    size_t n = 0;
+
+    while (s[n] && !in_set(s[n], set))
+        n++;
+    return n;
+}
+
+/* Split s at the delimiters and write the tokens to out, '|' separated */
+static void
+ref_split(const char *s, const char *delim, int skip, char *out)
+{
+    *out = '\0';
+    if (!*s)
+        return;
+    for (;;) {
+        size_t n;
+
+        if (skip) {
+            s += ref_strspn(s, delim);
+            if (!*s)
+                return;
+        }
+        n = ref_strcspn(s, delim);
+        strncat(out, s, n);
+        strcat(out, "|");
+        s += n;
+        if (!*s++)
+            return;
+        if (!skip && !*s) {
+            /* strsep on a trailing delimiter ends with an empty string,
+             * and picolibc returns NULL for an empty string */
+            return;
+        }
+    }
+}
+
+static const char chars[] = "ab,; \t\x80\xff";
+
+int
+main(void)
+{
+    static char   str[STRLEN + 1], copy[STRLEN + 1];
+    static char   want[3 * STRLEN], got[3 * STRLEN];
+    char          delim[8];
+    struct strset set;
+    int           errors = 0;
+    int           round;
+
+    for (round = 0; round < ROUNDS; round++) {
+        size_t len = next() % STRLEN;
+        size_t dlen = next() % 4;
+        size_t i;
+        char  *tok, *last, *p;
+        char  *want_p;
+        int    skip;
+
+        for (i = 0; i < len; i++)
+            str[i] = chars[next() % (sizeof(chars) - 1)];
+        str[len] = '\0';
+        for (i = 0; i < dlen; i++)
+            delim[i] = chars[next() % (sizeof(chars) - 1)];
+        delim[dlen] = '\0';
+        strset_init(&set, delim);
+
+        if (strspn(str, delim) != ref_strspn(str, delim)
+            || strspn_set(str, &set) != ref_strspn(str, delim)) {
+            printf("strspn(\"%s\", \"%s\") is %zu should be %zu\n", str, delim,
+                   strspn(str, delim), ref_strspn(str, delim));
+            errors++;
+        }
+        if (strcspn(str, delim) != ref_strcspn(str, delim)
+            || strcspn_set(str, &set) != ref_strcspn(str, delim)) {
+            printf("strcspn(\"%s\", \"%s\") is %zu should be %zu\n", str, delim,
+                   strcspn(str, delim), ref_strcspn(str, delim));
+            errors++;
+        }
+        want_p = str[ref_strcspn(str, delim)] ? str + ref_strcspn(str, delim) : NULL;
+        if (strpbrk(str, delim) != want_p || strpbrk_set(str, &set) != want_p) {
+            printf("strpbrk(\"%s\", \"%s\") wrong\n", str, delim);
+            errors++;
+        }
+
+        for (skip = 0; skip < 2; skip++) {
+            int api;
+
+            ref_split(str, delim, skip, want);
+            for (api = 0; api < 2; api++) {
+                strcpy(copy, str);
+                got[0] = '\0';
+                if (skip) {
+                    last = NULL;
+                    for (p = copy; (tok = api ? strtok_set_r(p, &set, &last)
+                                              : strtok_r(p, delim, &last))
+                                   != NULL;
+                         p = NULL) {
+                        strcat(got, tok);
+                        strcat(got, "|");
+                    }
+                } else {
+                    p = copy;
+                    while ((tok = api ? strsep_set(&p, &set) : strsep(&p, delim)) != NULL) {
+                        strcat(got, tok);
+                        strcat(got, "|");
+                    }
+                }
+                if (strcmp(got, want) != 0) {
+                    printf("%s%s(\"%s\", \"%s\") gave \"%s\" should be \"%s\"\n",
+                           skip ? "strtok" : "strsep", api ? "_set" : "", str, delim, got,
+                           want);
+                    errors++;
+                }
+            }
+        }
+    }
+    printf("%d errors\n", errors);
+    return errors != 0;
+}
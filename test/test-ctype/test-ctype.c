@@ -230,5 +230,37 @@ main(void)
             TEST_WC(xdigit);
         }
     }
+
+    /* The macros must follow uselocale as well as setlocale */
+    setlocale(LC_ALL, locales[NUM_LOCALE - 1]);
+    for (l = 0; l < NUM_LOCALE; l++) {
+        locale_t loc = newlocale(LC_ALL_MASK, locales[l], (locale_t)0);
+        locale_t global;
+
+        if (loc == (locale_t)0) {
+            printf("%s: newlocale failed\n", locales[l]);
+            error = 1;
+            continue;
+        }
+        uselocale(loc);
+        for (c = 0; c < 0x100; c++) {
+            if (!!isalpha(c) != !!isalpha_l(c, loc) || !!ispunct(c) != !!ispunct_l(c, loc)) {
+                printf("%s: uselocale character %#2x is %#x should be %#x\n", locales[l], c,
+                       isalpha(c) | ispunct(c), isalpha_l(c, loc) | ispunct_l(c, loc));
+                error = 1;
+            }
+        }
+        uselocale(LC_GLOBAL_LOCALE);
+        global = newlocale(LC_ALL_MASK, locales[NUM_LOCALE - 1], (locale_t)0);
+        for (c = 0; c < 0x100; c++) {
+            if (!!isalpha(c) != !!isalpha_l(c, global)) {
+                printf("%s: global character %#2x is %#x should be %#x\n", locales[l], c,
+                       isalpha(c), isalpha_l(c, global));
+                error = 1;
+            }
+        }
+        freelocale(global);
+        freelocale(loc);
+    }
     return error;
 }
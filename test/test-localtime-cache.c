@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * localtime_r reuses the previous conversion for nearby times. Make
+ * sure those results match a conversion done from scratch, across DST
+ * changes, day and year boundaries and changes of TZ.
+ */
+
+static const char *const zones[] = {
+    "CET-1CEST,M3.5.0,M10.5.0/3",
+    "EST5EDT",
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "<+0330>-3:30",
+    "NZST-12NZDT,J270,J97",
+    "EST5EDT,100,300/1:30",
+};
+
+static int
+same_tm(const struct tm *a, const struct tm *b)
+{
+    return a->tm_sec == b->tm_sec && a->tm_min == b->tm_min && a->tm_hour == b->tm_hour
+        && a->tm_mday == b->tm_mday && a->tm_mon == b->tm_mon && a->tm_year == b->tm_year
+        && a->tm_wday == b->tm_wday && a->tm_yday == b->tm_yday && a->tm_isdst == b->tm_isdst;
+}
+
+static int
+check_zone(const char *zone)
+{
+    struct tm near, fresh, tmp;
+    time_t    t, far;
+    int       i;
+    int       errors = 0;
+
+    if (setenv("TZ", zone, 1) != 0) {
+        printf("setenv failed\n");
+        return 1;
+    }
+
+    /* Walk through 2024 and into 2025 in uneven steps */
+    t = 1704067200 - 7200;
+    for (i = 0; i < 20000; i++) {
+        localtime_r(&t, &near);
+
+        /* Convert something far away so the next call starts over */
+        far = t + 400L * 86400;
+        localtime_r(&far, &tmp);
+        localtime_r(&t, &fresh);
+
+        if (!same_tm(&near, &fresh)) {
+            printf("%s: %lld: cached %d-%02d-%02d %02d:%02d:%02d dst %d, fresh "
+                   "%d-%02d-%02d %02d:%02d:%02d dst %d\n",
+                   zone, (long long)t, near.tm_year + 1900, near.tm_mon + 1, near.tm_mday,
+                   near.tm_hour, near.tm_min, near.tm_sec, near.tm_isdst, fresh.tm_year + 1900,
+                   fresh.tm_mon + 1, fresh.tm_mday, fresh.tm_hour, fresh.tm_min, fresh.tm_sec,
+                   fresh.tm_isdst);
+            if (++errors > 5)
+                break;
+        }
+        t += 1 + (i % 7) * 337 + (i % 13 == 0 ? 3599 : 0);
+    }
+    return errors;
+}
+
+int
+main(void)
+{
+    struct tm tm;
+    time_t    t = 1720000000; /* July 2024 */
+    int       errors = 0;
+    size_t    i;
+
+    for (i = 0; i < sizeof(zones) / sizeof(zones[0]); i++)
+        errors += check_zone(zones[i]);
+
+    /* A change of TZ must be seen straight away */
+    setenv("TZ", "UTC0", 1);
+    localtime_r(&t, &tm);
+    if (tm.tm_hour != (int)(t / 3600 % 24) || tm.tm_isdst != 0) {
+        printf("UTC0: hour %d dst %d\n", tm.tm_hour, tm.tm_isdst);
+        errors++;
+    }
+    setenv("TZ", "JST-9", 1);
+    localtime_r(&t, &tm);
+    if (tm.tm_hour != (int)((t / 3600 + 9) % 24)) {
+        printf("JST-9: hour %d\n", tm.tm_hour);
+        errors++;
+    }
+
+    return errors != 0;
+}
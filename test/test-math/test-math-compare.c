@@ -111,16 +111,22 @@ compare_ulp32(binary32 x, binary32 y)
 #define LIBNAME "native"
 #endif
 
-#if 0
-#define START 0xc0000000UL
-#define END   0xd0000000UL
-#define STEP  0x00000001UL
-#else
-#define START 0x00000000UL
-#define END   0xffffffffUL
-#define STEP  0x00000001UL
+/*
+ * The input space can be split into TEST_SHARDS pieces, each checked by
+ * its own build with TEST_SHARD set, so that they can run in parallel.
+ * scripts/math-compare-report merges the summary lines of the shards.
+ */
+#ifndef TEST_SHARDS
+#define TEST_SHARDS 1
+#endif
+#ifndef TEST_SHARD
+#define TEST_SHARD 0
 #endif
 
+#define START ((uint32_t)(((uint64_t)TEST_SHARD << 32) / TEST_SHARDS))
+#define END   ((uint32_t)((((uint64_t)TEST_SHARD + 1) << 32) / TEST_SHARDS - 1))
+#define STEP  0x00000001UL
+
 int
 main(void)
 {
@@ -133,7 +139,8 @@ main(void)
     uint32_t ulps[ULP_BINS] = {};
     uint32_t bin;
 
-    printf("Testing %s: \n", FNAME);
+    printf("Testing %s: 0x%08" PRIx32 " to 0x%08" PRIx32 "\n", FNAME, (uint32_t)START,
+           (uint32_t)END);
     for (;;) {
         binary32 fx = binary32_from_uint32(u32);
         binary64 dx = (binary64)fx;
@@ -183,6 +190,11 @@ main(void)
     }
     printf("%s %s: max_ulp %" PRIu32 " at 0x%08" PRIx32 " %a\n", LIBNAME, FNAME, max_ulp,
            max_ulp_u32, (binary64)binary32_from_uint32(max_ulp_u32));
+    printf("summary %s %s shard %d/%d max_ulp %" PRIu32 " at 0x%08" PRIx32 " bins", LIBNAME, FNAME,
+           TEST_SHARD, TEST_SHARDS, max_ulp, max_ulp_u32);
+    for (bin = 0; bin < ULP_BINS; bin++)
+        printf(" %" PRIu32, ulps[bin]);
+    printf(" %s\n", ret ? "FAILED" : "PASSED");
     if (ret)
         printf("FAILED\n");
     else
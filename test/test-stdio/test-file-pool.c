@@ -0,0 +1,144 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef TEST_FILE_NAME
+#define TEST_FILE_NAME "FILEPOOL.TXT"
+#endif
+
+#ifdef __STDIO_FILE_POOL
+
+#define MESSAGE "the static FILE pool keeps fopen away from the heap\n"
+
+static size_t
+heap_used(void)
+{
+    return mallinfo().uordblks;
+}
+
+int
+main(void)
+{
+    FILE  *f[__STDIO_FILE_POOL + 1];
+    FILE  *pool[__STDIO_FILE_POOL];
+    char   line[128];
+    size_t used;
+    int    result = 0;
+    int    i;
+
+    /* Let stdio set up anything it allocates once */
+    f[0] = fopen(TEST_FILE_NAME, "w");
+    if (!f[0]) {
+        printf("fopen %s failed\n", TEST_FILE_NAME);
+        return 1;
+    }
+    fclose(f[0]);
+
+    used = heap_used();
+    for (i = 0; i < __STDIO_FILE_POOL; i++) {
+        f[i] = fopen(TEST_FILE_NAME, i == 0 ? "w" : "r");
+        if (!f[i]) {
+            printf("fopen %d failed\n", i);
+            return 1;
+        }
+    }
+    if (heap_used() != used) {
+        printf("pool fopen used the heap: %zu -> %zu\n", used, heap_used());
+        result = 1;
+    }
+    memcpy(pool, f, sizeof(pool));
+
+    /* The pool is empty, so this one comes from the heap */
+    f[__STDIO_FILE_POOL] = fopen(TEST_FILE_NAME, "r");
+    if (!f[__STDIO_FILE_POOL] || heap_used() == used) {
+        printf("fopen past the pool failed or did not allocate\n");
+        result = 1;
+    }
+
+    /* A message longer than the pool buffer goes through intact */
+    for (i = 0; i < 4; i++)
+        fputs(MESSAGE, f[0]);
+    for (i = 0; i <= __STDIO_FILE_POOL; i++)
+        if (f[i])
+            fclose(f[i]);
+
+    used = heap_used();
+    f[0] = fopen(TEST_FILE_NAME, "r");
+    for (i = 0; i < __STDIO_FILE_POOL; i++)
+        if (f[0] == pool[i])
+            break;
+    if (i == __STDIO_FILE_POOL || heap_used() != used) {
+        printf("closed pool slot not reused\n");
+        result = 1;
+    }
+    for (i = 0; i < 4; i++) {
+        if (!fgets(line, sizeof(line), f[0]) || strcmp(line, MESSAGE) != 0) {
+            printf("line %d read back wrong\n", i);
+            result = 1;
+        }
+    }
+    if (fgets(line, sizeof(line), f[0]) != NULL) {
+        printf("extra data in the file\n");
+        result = 1;
+    }
+
+    /* freopen keeps the pool buffer */
+    f[0] = freopen(TEST_FILE_NAME, "r", f[0]);
+    if (!f[0] || heap_used() != used) {
+        printf("freopen of a pool FILE used the heap\n");
+        result = 1;
+    }
+    if (f[0])
+        fclose(f[0]);
+
+    (void)remove(TEST_FILE_NAME);
+    return result;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("static FILE pool not enabled, skipping\n");
+    return 77;
+}
+
+#endif
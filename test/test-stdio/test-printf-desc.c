@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+static const struct printf_op ints[] = {
+    PRINTF_OP("d=", d),     PRINTF_OP(" u=", u),   PRINTF_OP(" x=", x),
+    PRINTF_OP(" ld=", ld),  PRINTF_OP(" lu=", lu), PRINTF_OP(" lx=", lx),
+    PRINTF_OP(" lld=", lld), PRINTF_OP(" llu=", llu), PRINTF_OP(" llx=", llx),
+    PRINTF_OP_END,
+};
+
+static const struct printf_op strs[] = {
+    PRINTF_OP_LIT("<"), PRINTF_OP(NULL, s), PRINTF_OP("|", c), PRINTF_OP("|", s),
+    PRINTF_OP_LIT(">"), PRINTF_OP_END,
+};
+
+static char out[256];
+
+static int
+check(const char *expect, int ret)
+{
+    if (ret != (int)strlen(expect) || strcmp(out, expect) != 0) {
+        printf("got \"%s\" (%d) expected \"%s\"\n", out, ret, expect);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    int   result = 0;
+    int   ret;
+    FILE *f;
+
+    f = fmemopen(out, sizeof(out), "w");
+    if (!f) {
+        printf("fmemopen failed\n");
+        return 1;
+    }
+    ret = fprintf_desc(f, ints, -32767, 65535u, 0xbeefu, -2147483647l, 4294967295ul, 0x1234ul,
+                       -9223372036854775807ll - 1, 18446744073709551615ull,
+                       0xfedcba9876543210ull);
+    fputc('\0', f);
+    fclose(f);
+    result |= check("d=-32767 u=65535 x=beef ld=-2147483647 lu=4294967295 lx=1234 "
+                    "lld=-9223372036854775808 llu=18446744073709551615 llx=fedcba9876543210",
+                    ret);
+
+    f = fmemopen(out, sizeof(out), "w");
+    if (!f) {
+        printf("fmemopen failed\n");
+        return 1;
+    }
+    ret = fprintf_desc(f, strs, "hello", 'z', (char *)NULL);
+    fputc('\0', f);
+    fclose(f);
+    result |= check("<hello|z|(null)>", ret);
+
+    return result;
+}
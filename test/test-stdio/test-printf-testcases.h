@@ -296,6 +296,14 @@ result |= test(__LINE__, "8.6000", "%2.4f", printf_float(8.6));
 result |= test(__LINE__, "0.600000", "%0f", printf_float(0.6));
 result |= test(__LINE__, "1", "%.0f", printf_float(0.6));
 result |= test(__LINE__, "0", "%.0f", printf_float(0.45));
+result |= test(__LINE__, "0.12", "%.2f", printf_float(0.125));
+result |= test(__LINE__, "0.38", "%.2f", printf_float(0.375));
+result |= test(__LINE__, "2", "%.0f", printf_float(2.5));
+result |= test(__LINE__, "4", "%.0f", printf_float(3.5));
+result |= test(__LINE__, "-0.00", "%.2f", printf_float(-0.001));
+result |= test(__LINE__, "65535.75", "%.2f", printf_float(65535.75));
+result |= test(__LINE__, "0.062500000", "%.9f", printf_float(0.0625));
+result |= test(__LINE__, "16777216.0", "%.1f", printf_float(16777216.0));
 result |= test(__LINE__, "8.6000e+00", "%2.4e", printf_float(8.6));
 result |= test(__LINE__, " 8.6000e+00", "% 2.4e", printf_float(8.6));
 result |= test(__LINE__, "-8.6000e+00", "% 2.4e", printf_float(-8.6));
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdio_ext.h>
+#include <string.h>
+
+static const char input[] = "hello world";
+static size_t     input_pos;
+static char       output[64];
+static size_t     output_len;
+
+static ssize_t
+cookie_read(void *cookie, void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > sizeof(input) - 1 - input_pos)
+        n = sizeof(input) - 1 - input_pos;
+    memcpy(buf, input + input_pos, n);
+    input_pos += n;
+    return n;
+}
+
+static ssize_t
+cookie_write(void *cookie, const void *buf, size_t n)
+{
+    (void)cookie;
+    memcpy(output + output_len, buf, n);
+    output_len += n;
+    return n;
+}
+
+#define CHECK(cond)                                           \
+    do {                                                      \
+        if (!(cond)) {                                        \
+            printf("%s:%d: %s failed\n", __FILE__, __LINE__, #cond); \
+            return 1;                                         \
+        }                                                     \
+    } while (0)
+
+int
+main(void)
+{
+    char        mem[32] = "abcdef";
+    const char *rp;
+    char       *wp;
+    size_t      size;
+    FILE       *f;
+    int         c;
+
+    /* fmemopen reads directly from the caller's buffer */
+    f = fmemopen(mem, 6, "r");
+    CHECK(f != NULL);
+    rp = __freadptr(f, &size);
+    CHECK(rp == mem && size == 6);
+    __freadptrinc(f, 2);
+    CHECK(getc(f) == 'c');
+    CHECK(__freadahead(f) == 3);
+    CHECK(ungetc('c', f) == 'c');
+    CHECK(__freadptr(f, &size) == NULL);
+    CHECK(__freadahead(f) == 4);
+    fclose(f);
+
+    /* and writes directly into it */
+    f = fmemopen(mem, sizeof(mem), "w");
+    CHECK(f != NULL);
+    wp = __fwriteptr(f, &size);
+    CHECK(wp == mem && size == sizeof(mem));
+    memcpy(wp, "xyz", 3);
+    __fwriteptrinc(f, 3);
+    fputc('!', f);
+    fclose(f);
+    CHECK(strcmp(mem, "xyz!") == 0);
+
+    /* bufio streams expose their buffer */
+    f = funopen(NULL, cookie_read, NULL, NULL, NULL);
+    CHECK(f != NULL);
+    CHECK(__freadptr(f, &size) == NULL);
+    c = getc(f);
+    CHECK(c == 'h');
+    rp = __freadptr(f, &size);
+    CHECK(rp != NULL && size == sizeof(input) - 2 && memcmp(rp, "ello world", size) == 0);
+    __freadptrinc(f, 5);
+    CHECK(getc(f) == 'w');
+    fclose(f);
+
+    f = funopen(NULL, NULL, cookie_write, NULL, NULL);
+    CHECK(f != NULL);
+    wp = __fwriteptr(f, &size);
+    CHECK(wp != NULL && size > 5);
+    memcpy(wp, "data", 4);
+    __fwriteptrinc(f, 4);
+    CHECK(__fpending(f) == 4);
+    fputs("more", f);
+    CHECK(__fpending(f) == 8 && output_len == 0);
+    fflush(f);
+    CHECK(__fpending(f) == 0 && output_len == 8 && memcmp(output, "datamore", 8) == 0);
+    fclose(f);
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Check strtod_array and strtof_array against strtod and strtof: the
+ * values must be identical and the end offsets must match the end
+ * pointers returned by the single-value functions.
+ */
+
+static const char *const inputs[] = {
+    "1 2 3",
+    "  -1.5,+2.25,\t3e2\n",
+    "0.1,0.2,0.3,,0.4",
+    "1e",
+    "1e+ 2",
+    "1.5e-3x 7",
+    ".5 5. -.25",
+    "12345678901234567890123 0.000000000000000000000000123456789",
+    "2.2250738585072011e-308 4.9e-324 1.7976931348623157e308 1e400 1e-400",
+    "3.4028235e38 1.17549435e-38 1.4e-45 1e39 1e-46",
+    "9007199254740993 9007199254740993.0000000001 16777217 16777217.5",
+    "0.30000000000000004,-0,0e99",
+    "1-2+3",
+    "inf 4",
+    "- 4",
+    "",
+};
+
+#define NVALS 16
+
+static int
+check(const char *in)
+{
+    double d[NVALS];
+    float  f[NVALS];
+    size_t dends[NVALS];
+    size_t fends[NVALS];
+    size_t len = strlen(in);
+    size_t nd, nf, i;
+    size_t pos;
+    int    errors = 0;
+
+    nd = strtod_array(in, len, d, NVALS, dends);
+    nf = strtof_array(in, len, f, NVALS, fends);
+    if (nd != nf) {
+        printf("\"%s\": %zu doubles but %zu floats\n", in, nd, nf);
+        errors++;
+    }
+
+    pos = 0;
+    for (i = 0; i < nd; i++) {
+        char  *end;
+        double want;
+
+        while (in[pos] == ' ' || in[pos] == ',' || (in[pos] >= '\t' && in[pos] <= '\r'))
+            pos++;
+        want = strtod(in + pos, &end);
+        if (memcmp(&want, &d[i], sizeof(double)) != 0 || (size_t)(end - in) != dends[i]) {
+            printf("\"%s\"[%zu]: got %a end %zu want %a end %zu\n", in, i, d[i], dends[i], want,
+                   (size_t)(end - in));
+            errors++;
+        }
+        if (i < nf) {
+            float want_f = strtof(in + pos, &end);
+            if (memcmp(&want_f, &f[i], sizeof(float)) != 0 || (size_t)(end - in) != fends[i]) {
+                printf("\"%s\"[%zu]: got %a end %zu want %a (float)\n", in, i, (double)f[i],
+                       fends[i], (double)want_f);
+                errors++;
+            }
+        }
+        pos = dends[i];
+    }
+    return errors;
+}
+
+int
+main(void)
+{
+    int    errors = 0;
+    size_t i;
+    double d[2];
+    size_t n;
+
+    for (i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+        errors += check(inputs[i]);
+
+    /* Expected counts for a few cases */
+    if ((n = strtod_array("1 2 3", 5, d, 2, NULL)) != 2) {
+        printf("nvals not honored: %zu\n", n);
+        errors++;
+    }
+    if ((n = strtod_array("1 2 3", 3, d, 2, NULL)) != 2 || d[1] != 2.0) {
+        printf("len not honored: %zu\n", n);
+        errors++;
+    }
+    if ((n = strtod_array("12345", 2, d, 2, NULL)) != 1 || d[0] != 12.0) {
+        printf("len not honored within a number: %zu %g\n", n, d[0]);
+        errors++;
+    }
+    if ((n = strtod_array("inf 4", 5, d, 2, NULL)) != 0) {
+        printf("inf accepted: %zu\n", n);
+        errors++;
+    }
+
+    return errors != 0;
+}
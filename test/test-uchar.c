@@ -149,6 +149,127 @@ const struct {
 
 #define NTEST_C32 sizeof(test_c32) / sizeof(test_c32[0])
 
+#ifdef __PICOLIBC__
+/* The string converters, checked against each other and per-character */
+static int
+test_strings(void)
+{
+    static const char8_t in8[] = "ascii text long enough for words \xC2\x80 \xE3\x8C\xB0 "
+                                 "\xF0\x9F\x9A\x80 \xF4\x8F\xBF\xBF end";
+    static const char32_t want32[] = { 0x80, 0x3330, 0x1f680, 0x10ffff };
+    static const struct {
+        const char *in;
+        size_t      len;
+        int         err;
+        size_t      consumed;
+    } bad8[] = {
+        { "ab\xC0\x80", 4, EILSEQ, 2 },     { "ab\xE0\x9F\xBF", 5, EILSEQ, 2 },
+        { "ab\xED\xA0\x80", 5, EILSEQ, 2 }, { "ab\xF4\x90\x80\x80", 6, EILSEQ, 2 },
+        { "ab\xF0\x90\x80", 5, EINVAL, 2 }, { "ab\xE3\x8C", 4, EINVAL, 2 },
+        { "a\0b", 3, 0, 3 },
+    };
+    static const struct {
+        char16_t in[4];
+        size_t   len;
+        int      err;
+        size_t   consumed;
+    } bad16[] = {
+        { { 'a', 0xdc00, 'b' }, 3, EILSEQ, 1 },
+        { { 'a', 0xd800, 'b' }, 3, EILSEQ, 1 },
+        { { 'a', 0xd800 }, 2, EINVAL, 1 },
+    };
+    char16_t       c16[64], *d16;
+    char32_t       c32[64], *d32;
+    char8_t        c8[128], *d8;
+    const char8_t *s8;
+    const char16_t *s16;
+    size_t         slen, dlen, n16, n32, i, j;
+    int            status = 0;
+
+    s8 = in8;
+    slen = sizeof(in8) - 1;
+    d32 = c32;
+    dlen = 64;
+    if (utf8_to_utf32(&s8, &slen, &d32, &dlen) != 0 || slen != 0) {
+        printf("utf8_to_utf32 failed\n");
+        return 1;
+    }
+    n32 = d32 - c32;
+    for (i = 0, j = 0; i < n32; i++)
+        if (c32[i] >= 0x80 && (j >= 4 || c32[i] != want32[j++]))
+            status = 1;
+    if (status || j != 4)
+        printf("utf8_to_utf32 wrong result\n");
+
+    s8 = in8;
+    slen = sizeof(in8) - 1;
+    d16 = c16;
+    dlen = 64;
+    if (utf8_to_utf16(&s8, &slen, &d16, &dlen) != 0 || slen != 0) {
+        printf("utf8_to_utf16 failed\n");
+        return 1;
+    }
+    n16 = d16 - c16;
+    if (n16 != n32 + 2) {
+        printf("utf8_to_utf16 produced %zu units, expected %zu\n", n16, n32 + 2);
+        status = 1;
+    }
+
+    s16 = c16;
+    slen = n16;
+    d8 = c8;
+    dlen = sizeof(c8);
+    if (utf16_to_utf8(&s16, &slen, &d8, &dlen) != 0 || slen != 0
+        || (size_t)(d8 - c8) != sizeof(in8) - 1 || memcmp(c8, in8, sizeof(in8) - 1) != 0) {
+        printf("utf16_to_utf8 round trip failed\n");
+        status = 1;
+    }
+
+    /* Output too small, stopping before a surrogate pair */
+    s8 = in8;
+    slen = sizeof(in8) - 1;
+    d16 = c16;
+    dlen = n16 - 8;
+    if (utf8_to_utf16(&s8, &slen, &d16, &dlen) != -1 || errno != E2BIG || dlen != 1
+        || *s8 != 0xF0) {
+        printf("utf8_to_utf16 E2BIG failed\n");
+        status = 1;
+    }
+
+    for (i = 0; i < sizeof(bad8) / sizeof(bad8[0]); i++) {
+        int ret;
+
+        s8 = (const char8_t *)bad8[i].in;
+        slen = bad8[i].len;
+        d32 = c32;
+        dlen = 64;
+        errno = 0;
+        ret = utf8_to_utf32(&s8, &slen, &d32, &dlen);
+        if (ret != (bad8[i].err ? -1 : 0) || errno != bad8[i].err
+            || (size_t)(s8 - (const char8_t *)bad8[i].in) != bad8[i].consumed
+            || (size_t)(d32 - c32) != bad8[i].consumed) {
+            printf("utf8_to_utf32 bad %zu: ret %d errno %d consumed %zu\n", i, ret, errno,
+                   (size_t)(s8 - (const char8_t *)bad8[i].in));
+            status = 1;
+        }
+    }
+
+    for (i = 0; i < sizeof(bad16) / sizeof(bad16[0]); i++) {
+        s16 = bad16[i].in;
+        slen = bad16[i].len;
+        d8 = c8;
+        dlen = sizeof(c8);
+        errno = 0;
+        if (utf16_to_utf8(&s16, &slen, &d8, &dlen) != -1 || errno != bad16[i].err
+            || (size_t)(s16 - bad16[i].in) != bad16[i].consumed) {
+            printf("utf16_to_utf8 bad %zu failed\n", i);
+            status = 1;
+        }
+    }
+    return status;
+}
+#endif
+
 int
 main(void)
 {
@@ -378,5 +499,9 @@ main(void)
             }
         }
     }
+#ifdef __PICOLIBC__
+    if (test_strings())
+        status = 1;
+#endif
     return status;
 }
@@ -0,0 +1,190 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * <threads.h>: mutexes, condition variables, call_once and tss on
+ * their own, then, where thrd_create can start threads, several
+ * threads sharing a counter and handing items over a condition
+ * variable.
+ */
+
+#define _DEFAULT_SOURCE
+#include <threads.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NTHREADS 4
+#define NITEMS   100
+
+static int error;
+
+#define check(cond)                                                   \
+    do {                                                              \
+        if (!(cond)) {                                                \
+            printf("%s:%d: %s failed\n", __FILE__, __LINE__, #cond);  \
+            error = 1;                                                \
+        }                                                             \
+    } while (0)
+
+static once_flag once = ONCE_FLAG_INIT;
+static int       once_calls;
+
+static void
+once_func(void)
+{
+    once_calls++;
+}
+
+static int dtor_calls;
+
+static void
+dtor(void *val)
+{
+    (void)val;
+    dtor_calls++;
+}
+
+static mtx_t count_mtx;
+static int   count;
+
+static tss_t key;
+
+static int
+counter(void *arg)
+{
+    int i;
+
+    call_once(&once, once_func);
+#ifdef __THREAD_LOCAL_STORAGE_API
+    check(tss_get(key) == NULL);
+#endif
+    tss_set(key, arg);
+    for (i = 0; i < NITEMS; i++) {
+        mtx_lock(&count_mtx);
+        count++;
+        if (i % 10 == 0)
+            thrd_yield();
+        mtx_unlock(&count_mtx);
+    }
+#ifdef __THREAD_LOCAL_STORAGE_API
+    check(tss_get(key) == arg);
+#endif
+    return (int)(long)arg;
+}
+
+static mtx_t queue_mtx;
+static cnd_t queue_cnd;
+static int   queue[NITEMS], head, tail;
+
+static int
+consumer(void *arg)
+{
+    int sum = 0, got = 0;
+
+    (void)arg;
+    mtx_lock(&queue_mtx);
+    while (got < NITEMS) {
+        while (head == tail)
+            cnd_wait(&queue_cnd, &queue_mtx);
+        sum += queue[tail++];
+        got++;
+    }
+    mtx_unlock(&queue_mtx);
+    return sum;
+}
+
+int
+main(void)
+{
+    mtx_t           rec;
+    cnd_t           cnd;
+    struct timespec ts;
+    thrd_t          thr[NTHREADS], cons;
+    int             i, res, sum;
+
+    /* Without other threads */
+    check(mtx_init(&count_mtx, mtx_plain) == thrd_success);
+    check(mtx_trylock(&count_mtx) == thrd_success);
+    check(mtx_trylock(&count_mtx) == thrd_busy);
+    check(mtx_unlock(&count_mtx) == thrd_success);
+    check(mtx_lock(&count_mtx) == thrd_success);
+    check(mtx_unlock(&count_mtx) == thrd_success);
+
+    check(mtx_init(&rec, mtx_recursive | mtx_timed) == thrd_success);
+    check(mtx_lock(&rec) == thrd_success);
+    check(mtx_lock(&rec) == thrd_success);
+    check(mtx_trylock(&rec) == thrd_success);
+    check(mtx_unlock(&rec) == thrd_success);
+    check(mtx_unlock(&rec) == thrd_success);
+    check(mtx_unlock(&rec) == thrd_success);
+    check(mtx_trylock(&rec) == thrd_success);
+    check(mtx_unlock(&rec) == thrd_success);
+    mtx_destroy(&rec);
+
+    call_once(&once, once_func);
+    call_once(&once, once_func);
+    check(once_calls == 1);
+
+    check(tss_create(&key, dtor) == thrd_success);
+    check(tss_get(key) == NULL);
+    check(tss_set(key, &key) == thrd_success);
+    check(tss_get(key) == &key);
+
+    check(thrd_equal(thrd_current(), thrd_current()));
+
+    /* A wait with nobody to signal times out */
+    check(cnd_init(&cnd) == thrd_success);
+    check(mtx_lock(&count_mtx) == thrd_success);
+    if (clock_gettime(CLOCK_REALTIME, &ts) == 0) {
+        ts.tv_nsec += 10000000;
+        if (ts.tv_nsec >= 1000000000) {
+            ts.tv_nsec -= 1000000000;
+            ts.tv_sec++;
+        }
+        check(cnd_timedwait(&cnd, &count_mtx, &ts) == thrd_timedout);
+    }
+    check(mtx_unlock(&count_mtx) == thrd_success);
+    cnd_destroy(&cnd);
+
+    if (thrd_create(&thr[0], counter, (void *)1L) != thrd_success) {
+        printf("thrd_create not supported, skipping thread tests\n");
+        return error;
+    }
+    for (i = 1; i < NTHREADS; i++)
+        check(thrd_create(&thr[i], counter, (void *)(long)(i + 1)) == thrd_success);
+    for (i = 0; i < NTHREADS; i++) {
+        check(thrd_join(thr[i], &res) == thrd_success);
+        check(res == i + 1);
+    }
+    check(count == NTHREADS * NITEMS);
+    check(once_calls == 1);
+#ifdef __THREAD_LOCAL_STORAGE_API
+    check(dtor_calls == NTHREADS);
+    check(tss_get(key) == &key);
+#endif
+
+    /* Hand items to a consumer one at a time */
+    check(mtx_init(&queue_mtx, mtx_plain) == thrd_success);
+    check(cnd_init(&queue_cnd) == thrd_success);
+    check(thrd_create(&cons, consumer, NULL) == thrd_success);
+    sum = 0;
+    for (i = 0; i < NITEMS; i++) {
+        mtx_lock(&queue_mtx);
+        queue[head++] = i;
+        sum += i;
+        cnd_signal(&queue_cnd);
+        mtx_unlock(&queue_mtx);
+        if (i % 7 == 0)
+            thrd_yield();
+    }
+    check(thrd_join(cons, &res) == thrd_success);
+    check(res == sum);
+
+    /* Sleeping lets the others run */
+    ts.tv_sec = 0;
+    ts.tv_nsec = 1000000;
+    check(thrd_sleep(&ts, NULL) == 0);
+
+    return error;
+}
@@ -252,6 +252,63 @@ main(void)
         if (!test_strftime(__LINE__, &dtForTimegm8, "%a %b %d %Y %H:%M:%S",
                            "Fri Feb 29 2104 00:00:00"))
             ret = 1;
+
+        // gmtime_r() uses 32-bit arithmetic for the years -6400 to about 11000
+        // and 64-bit arithmetic outside that. Walk across both edges of that
+        // range and check that gmtime_r() and timegm() agree with each other
+        // and that consecutive days stay consecutive.
+
+        static const long long edges[] = { -264126528000LL, 285629241600LL };
+
+        for (unsigned e = 0; e < sizeof(edges) / sizeof(edges[0]); e++) {
+            struct tm prev;
+            init_struct_tm(&prev);
+            for (long d = -400; d <= 400; d++) {
+                time_t    t = (time_t)(edges[e] + (long long)d * 86400 + 86399);
+                struct tm tm;
+                if (!gmtime_r(&t, &tm)) {
+                    printf("gmtime_r(%lld) failed\n", (long long)t);
+                    ret = 1;
+                    break;
+                }
+                if (tm.tm_hour != 23 || tm.tm_min != 59 || tm.tm_sec != 59) {
+                    printf("gmtime_r(%lld) time of day %02d:%02d:%02d\n", (long long)t,
+                           tm.tm_hour, tm.tm_min, tm.tm_sec);
+                    ret = 1;
+                }
+                if (d > -400 && tm.tm_wday != (prev.tm_wday + 1) % 7) {
+                    printf("gmtime_r(%lld) wday %d after %d\n", (long long)t, tm.tm_wday,
+                           prev.tm_wday);
+                    ret = 1;
+                }
+                if (d > -400 && tm.tm_yday != prev.tm_yday + 1 && tm.tm_yday != 0) {
+                    printf("gmtime_r(%lld) yday %d after %d\n", (long long)t, tm.tm_yday,
+                           prev.tm_yday);
+                    ret = 1;
+                }
+                prev = tm;
+                time_t back = timegm(&tm);
+                if (back != t) {
+                    printf("timegm(gmtime_r(%lld)) = %lld\n", (long long)t, (long long)back);
+                    ret = 1;
+                }
+            }
+        }
+
+        // A fixed batch of conversions, so the cycle count a simulator
+        // reports for this test follows the cost of gmtime_r() and timegm().
+
+        time_t sum = 0;
+        for (long i = 0; i < 20000; i++) {
+            time_t    t = (time_t)i * 1234567 - (time_t)12345678901LL;
+            struct tm tm;
+            gmtime_r(&t, &tm);
+            sum += timegm(&tm) - t;
+        }
+        if (sum != 0) {
+            puts("gmtime_r/timegm round trip failed.");
+            ret = 1;
+        }
     }
 
     return ret;
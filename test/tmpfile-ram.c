@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * With tmpfile-ram, tmpfile keeps its contents in a heap buffer. Write
+ * more than a stdio buffer, read it back, overwrite the middle, seek
+ * past the end and check the gap reads as zeros, all within the limit
+ * so the file never has to move to the file system.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __TMPFILE_RAM
+
+#if __TMPFILE_RAM >= 64 && __TMPFILE_RAM < 3000
+#define DATA_LEN (__TMPFILE_RAM - 16)
+#else
+#define DATA_LEN 3000
+#endif
+
+/* Where the overwrite goes, inside the data */
+#define MID (DATA_LEN / 2)
+
+#define GAP 8
+
+static int error;
+
+#define check(cond)                                                  \
+    do {                                                             \
+        if (!(cond)) {                                               \
+            printf("%s:%d: %s failed\n", __FILE__, __LINE__, #cond); \
+            error = 1;                                               \
+        }                                                            \
+    } while (0)
+
+static unsigned char
+data_byte(long i)
+{
+    return (unsigned char)(i * 7 + (i >> 8));
+}
+
+int
+main(void)
+{
+    FILE *f = tmpfile();
+    long  i;
+    int   c;
+
+    check(f != NULL);
+    if (!f)
+        return 1;
+
+    for (i = 0; i < DATA_LEN; i++)
+        check(putc(data_byte(i), f) == data_byte(i));
+    check(ftell(f) == DATA_LEN);
+
+    rewind(f);
+    for (i = 0; i < DATA_LEN; i++)
+        if ((c = getc(f)) != data_byte(i)) {
+            printf("byte %ld: got %d want %d\n", i, c, data_byte(i));
+            error = 1;
+            break;
+        }
+    check(getc(f) == EOF);
+    check(feof(f));
+
+    /* Overwrite in the middle, the length stays */
+    check(fseek(f, MID, SEEK_SET) == 0);
+    check(fputs("scratch", f) >= 0);
+    check(fseek(f, 0, SEEK_END) == 0);
+    check(ftell(f) == DATA_LEN);
+    check(fseek(f, MID, SEEK_SET) == 0);
+    {
+        char buf[8];
+
+        check(fread(buf, 1, 7, f) == 7);
+        check(memcmp(buf, "scratch", 7) == 0);
+    }
+    check(getc(f) == data_byte(MID + 7));
+
+    /* A write past the end leaves zeros in the gap */
+    check(fseek(f, GAP, SEEK_END) == 0);
+    check(putc('z', f) == 'z');
+    check(fseek(f, DATA_LEN, SEEK_SET) == 0);
+    for (i = 0; i < GAP; i++)
+        check(getc(f) == 0);
+    check(getc(f) == 'z');
+    check(getc(f) == EOF);
+
+    check(fseek(f, -1, SEEK_SET) != 0);
+    check(fclose(f) == 0);
+
+    return error;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("tmpfile-ram not enabled, skipping\n");
+    return 77;
+}
+
+#endif
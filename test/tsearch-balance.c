@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <search.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/*
+ * Check that tsearch keeps the tree balanced when keys arrive in
+ * order, that tdelete keeps it balanced and ordered, and that
+ * tinsert/tremove work with caller-provided nodes.
+ */
+
+#define NKEYS 4096
+
+static int          keys[NKEYS];
+static struct tnode nodes[NKEYS];
+static int          max_level;
+static int          count;
+static int          last;
+static int          ordered;
+
+static int
+cmp_int(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void
+walk(const void *node, VISIT v, int level)
+{
+    int key = **(int *const *)node;
+
+    if (level > max_level)
+        max_level = level;
+    if (v == postorder || v == leaf) {
+        if (count && key <= last)
+            ordered = 0;
+        last = key;
+        count++;
+    }
+}
+
+/* The keys live in a static array */
+static void
+noop(void *key)
+{
+    (void)key;
+}
+
+static int
+check(void *root, int expect, const char *what)
+{
+    int lg, limit;
+
+    max_level = 0;
+    count = 0;
+    ordered = 1;
+    twalk(root, walk);
+
+    /* An AVL tree of n nodes is less than 1.45 log2(n + 2) high */
+    for (lg = 0; (1 << lg) < expect + 2; lg++)
+        ;
+    limit = lg * 3 / 2;
+    if (count != expect || !ordered || max_level + 1 > limit) {
+        printf("%s: count %d (want %d) ordered %d height %d (limit %d)\n", what, count, expect,
+               ordered, max_level + 1, limit);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    void *root = NULL;
+    void *r;
+    int   errors = 0;
+    int   i;
+
+    for (i = 0; i < NKEYS; i++) {
+        keys[i] = i;
+        r = tsearch(&keys[i], &root, cmp_int);
+        if (r == NULL || *(int **)r != &keys[i]) {
+            printf("tsearch %d failed\n", i);
+            return 1;
+        }
+    }
+    errors += check(root, NKEYS, "sorted insert");
+
+    for (i = 0; i < NKEYS; i++) {
+        r = tfind(&keys[i], &root, cmp_int);
+        if (r == NULL || *(int **)r != &keys[i]) {
+            printf("tfind %d failed\n", i);
+            errors++;
+            break;
+        }
+    }
+
+    for (i = 0; i < NKEYS; i += 2)
+        if (tdelete(&keys[i], &root, cmp_int) == NULL) {
+            printf("tdelete %d failed\n", i);
+            errors++;
+        }
+    if (tdelete(&keys[0], &root, cmp_int) != NULL) {
+        printf("tdelete of a missing key succeeded\n");
+        errors++;
+    }
+    errors += check(root, NKEYS / 2, "after tdelete");
+    for (i = 0; i < NKEYS; i++)
+        if ((tfind(&keys[i], &root, cmp_int) != NULL) != (i & 1)) {
+            printf("tfind %d after tdelete wrong\n", i);
+            errors++;
+            break;
+        }
+    tdestroy(root, noop);
+    root = NULL;
+
+    /* Caller-provided nodes, inserted in descending order */
+    for (i = NKEYS - 1; i >= 0; i--) {
+        r = tinsert(&keys[i], &root, cmp_int, &nodes[i]);
+        if (r != &nodes[i]) {
+            printf("tinsert %d failed\n", i);
+            return 1;
+        }
+    }
+    if (tinsert(&keys[5], &root, cmp_int, &nodes[0]) != &nodes[5]) {
+        printf("tinsert of a duplicate didn't return the existing node\n");
+        errors++;
+    }
+    errors += check(root, NKEYS, "tinsert");
+    for (i = 0; i < NKEYS; i++) {
+        r = tremove(&keys[i], &root, cmp_int);
+        if (r != &nodes[i]) {
+            printf("tremove %d failed\n", i);
+            errors++;
+            break;
+        }
+        if (i % 512 == 0)
+            errors += check(root, NKEYS - 1 - i, "tremove");
+    }
+    if (root != NULL) {
+        printf("tree not empty after tremove\n");
+        errors++;
+    }
+
+    return errors != 0;
+}
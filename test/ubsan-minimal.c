@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * With the minimal UBSan runtime, failed checks must let the program
+ * carry on, each source location must be noted only once however
+ * often it fails, and __ubsan_report must return the number of new
+ * failures since the previous call.
+ */
+
+#include <picoubsan.h>
+#include <limits.h>
+#include <stdio.h>
+
+static volatile int big = INT_MAX;
+static volatile int sink;
+
+static void __noinline
+overflow_add(void)
+{
+    sink = big + 1;
+}
+
+static void __noinline
+overflow_mul(void)
+{
+    sink = big * 2;
+}
+
+static int
+check(int want, const char *when)
+{
+    int n = __ubsan_report();
+
+    if (n != want) {
+        printf("%s: report saw %d failures, want %d\n", when, n, want);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(void)
+{
+    int i, ret = 0;
+
+    for (i = 0; i < 3; i++)
+        overflow_add();
+    ret |= check(1, "same location three times");
+    overflow_add();
+    overflow_mul();
+    ret |= check(1, "one new location");
+    ret |= check(0, "nothing new");
+    return ret;
+}
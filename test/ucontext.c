@@ -0,0 +1,160 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Cooperative context switching on m65832: getcontext/setcontext
+ * loops, makecontext with arguments, swapcontext ping-pong between
+ * tasks on their own stacks, and returning through uc_link.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __m65832__
+
+#include <machine/ucontext.h>
+
+#define STACK_SIZE 1024
+#define NTASKS     4
+#define ROUNDS     50
+
+static ucontext_t main_ctx, ping_ctx, pong_ctx;
+static ucontext_t task_ctx[NTASKS];
+static int        trace[2 * ROUNDS + 1], ntrace;
+static int        task_count[NTASKS];
+static int        finished;
+static int        error;
+
+static void
+ping(int a, int b)
+{
+    int i;
+
+    for (i = 0; i < ROUNDS; i++) {
+        trace[ntrace++] = a + i;
+        swapcontext(&ping_ctx, &pong_ctx);
+    }
+    trace[ntrace++] = b;
+}
+
+static void
+pong(int a)
+{
+    for (;;) {
+        trace[ntrace++] = a;
+        swapcontext(&pong_ctx, &ping_ctx);
+    }
+}
+
+/* Each task yields to the next one; the last yields back to main */
+static void
+task(int id, int n)
+{
+    ucontext_t *next = id + 1 < NTASKS ? &task_ctx[id + 1] : &main_ctx;
+    int         i;
+
+    for (i = 0; i < n; i++) {
+        task_count[id]++;
+        swapcontext(&task_ctx[id], next);
+    }
+    finished++;
+    for (;;)
+        swapcontext(&task_ctx[id], next);
+}
+
+static void
+last(int a, int b, int c, int d, int e, int f)
+{
+    if (a != 1 || b != 2 || c != 3 || d != 4 || e != 5 || f != 6) {
+        printf("makecontext: arguments %d %d %d %d %d %d\n", a, b, c, d, e, f);
+        error = 1;
+    }
+}
+
+int
+main(void)
+{
+    volatile int loops = 0;
+    ucontext_t   args_ctx;
+    int          i;
+
+    /* getcontext returns again each time the context is set */
+    getcontext(&main_ctx);
+    if (++loops < 5)
+        setcontext(&main_ctx);
+    if (loops != 5) {
+        printf("getcontext loop ran %d times\n", loops);
+        error = 1;
+    }
+
+    /* ping and pong take turns; ping returns to main through uc_link */
+    if (__m65832_context_stack(&ping_ctx, STACK_SIZE) < 0
+        || __m65832_context_stack(&pong_ctx, STACK_SIZE) < 0) {
+        printf("no memory for stacks\n");
+        return 1;
+    }
+    ping_ctx.uc_link = &main_ctx;
+    makecontext(&ping_ctx, (void (*)(void))ping, 2, 1000, -1);
+    pong_ctx.uc_link = NULL;
+    makecontext(&pong_ctx, (void (*)(void))pong, 1, 7);
+    swapcontext(&main_ctx, &ping_ctx);
+
+    if (ntrace != 2 * ROUNDS + 1) {
+        printf("ping-pong: %d entries\n", ntrace);
+        error = 1;
+    } else {
+        for (i = 0; i < ROUNDS; i++)
+            if (trace[2 * i] != 1000 + i || trace[2 * i + 1] != 7) {
+                printf("ping-pong: round %d got %d %d\n", i, trace[2 * i], trace[2 * i + 1]);
+                error = 1;
+            }
+        if (trace[2 * ROUNDS] != -1) {
+            printf("ping-pong: last %d\n", trace[2 * ROUNDS]);
+            error = 1;
+        }
+    }
+    free(ping_ctx.uc_stack.ss_sp);
+    free(pong_ctx.uc_stack.ss_sp);
+
+    /* Round-robin over several tasks until all are done */
+    for (i = 0; i < NTASKS; i++) {
+        if (__m65832_context_stack(&task_ctx[i], STACK_SIZE) < 0) {
+            printf("no memory for stacks\n");
+            return 1;
+        }
+        makecontext(&task_ctx[i], (void (*)(void))task, 2, i, ROUNDS + i);
+    }
+    while (finished < NTASKS)
+        swapcontext(&main_ctx, &task_ctx[0]);
+    for (i = 0; i < NTASKS; i++) {
+        if (task_count[i] != ROUNDS + i) {
+            printf("task %d ran %d times\n", i, task_count[i]);
+            error = 1;
+        }
+        free(task_ctx[i].uc_stack.ss_sp);
+    }
+
+    /* All the arguments makecontext passes */
+    if (__m65832_context_stack(&args_ctx, STACK_SIZE) < 0) {
+        printf("no memory for stacks\n");
+        return 1;
+    }
+    args_ctx.uc_link = &main_ctx;
+    makecontext(&args_ctx, (void (*)(void))last, 6, 1, 2, 3, 4, 5, 6);
+    swapcontext(&main_ctx, &args_ctx);
+    free(args_ctx.uc_stack.ss_sp);
+
+    return error;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("ucontext is m65832 only, skipping\n");
+    return 77;
+}
+
+#endif
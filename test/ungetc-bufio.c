@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * ungetc on a buffered stream of the bytes just read steps back in the
+ * buffer, so more than one character can be pushed back. Check the
+ * order they come back in, that ftell follows, that pushing back other
+ * bytes still works once, and that fscanf gets its lookahead back.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <string.h>
+
+static const char *file_data;
+static size_t      file_len, file_pos;
+
+static ssize_t
+mem_read(void *cookie, void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > file_len - file_pos)
+        n = file_len - file_pos;
+    memcpy(buf, file_data + file_pos, n);
+    file_pos += n;
+    return n;
+}
+
+static FILE *
+mem_open(const char *data, size_t bufsize)
+{
+    FILE *f;
+
+    file_data = data;
+    file_len = strlen(data);
+    file_pos = 0;
+    f = funopen(NULL, mem_read, NULL, NULL, NULL);
+    if (f)
+        setvbuf(f, NULL, _IOFBF, bufsize);
+    return f;
+}
+
+#define check(cond)                                     \
+    do {                                                \
+        if (!(cond)) {                                  \
+            printf("%d: %s failed\n", __LINE__, #cond); \
+            ret = 1;                                    \
+        }                                               \
+    } while (0)
+
+int
+main(void)
+{
+    FILE  *f;
+    double d;
+    char   s[16];
+    int    ret = 0;
+
+    f = mem_open("abcdefghijkl", 64);
+    if (!f) {
+        printf("funopen failed\n");
+        return 1;
+    }
+
+    /* Three characters of lookahead go back in order */
+    check(getc(f) == 'a' && getc(f) == 'b' && getc(f) == 'c' && getc(f) == 'd');
+    check(ungetc('d', f) == 'd');
+    check(ungetc('c', f) == 'c');
+    check(ungetc('b', f) == 'b');
+    check(ftell(f) == 1);
+    check(getc(f) == 'b' && getc(f) == 'c' && getc(f) == 'd' && getc(f) == 'e');
+    check(ftell(f) == 5);
+
+    /* A different byte takes the single slot, and only one fits */
+    check(ungetc('X', f) == 'X');
+    check(ungetc('e', f) == EOF);
+    check(ftell(f) == 4);
+    check(getc(f) == 'X' && getc(f) == 'f');
+
+    /* Pushing back after end of file clears it */
+    check(fread(s, 1, sizeof(s), f) == 6 && feof(f));
+    check(ungetc('l', f) == 'l' && !feof(f));
+    check(getc(f) == 'l' && getc(f) == EOF);
+    fclose(f);
+
+    /* fscanf gets back "e+" after a failed exponent, like sscanf */
+    f = mem_open("1e+x rest", 64);
+    check(fscanf(f, "%lf%15s", &d, s) == 2 && d == 1.0 && strcmp(s, "e+x") == 0);
+    fclose(f);
+    check(sscanf("1e+x rest", "%lf%15s", &d, s) == 2 && d == 1.0 && strcmp(s, "e+x") == 0);
+
+    return ret;
+}
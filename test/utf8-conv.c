@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Convert long mixed ASCII and UTF-8 strings with mbsnrtowcs,
+ * mbsrtowcs, wcsnrtombs and mbrtowc from every alignment, so the word
+ * at a time ASCII scan, the direct sequence decoder and the fallback
+ * to the general code all get a turn.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <locale.h>
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+
+static const char mb[] = "plain ascii text, long enough for several words "
+                         "caf\xc3\xa9 \xe2\x82\xac" "5 "
+                         "more ascii between the multibyte characters "
+                         "\xf0\x9f\x9a\x80 end";
+
+static int
+check_string(const char *s, size_t n)
+{
+    wchar_t     wide[128];
+    char        back[256];
+    const char *src = s;
+    const wchar_t *wsrc;
+    mbstate_t   ps = { 0 };
+    size_t      len, bytes, i, pos;
+    wchar_t     wc;
+    int         ret = 0;
+
+    len = mbsrtowcs(wide, &src, 128, &ps);
+    if (len == (size_t)-1 || src != NULL) {
+        printf("mbsrtowcs failed\n");
+        return 1;
+    }
+    if (mbsrtowcs(NULL, &(const char *) { s }, 0, &ps) != len) {
+        printf("mbsrtowcs count differs\n");
+        ret = 1;
+    }
+
+    /* mbrtowc must agree character by character */
+    for (i = 0, pos = 0; i < len; i++) {
+        size_t r = mbrtowc(&wc, s + pos, n - pos, &ps);
+        if (r == 0 || r > 4 || wc != wide[i]) {
+            printf("mbrtowc at %zu: %zd %lx want %lx\n", pos, r, (unsigned long)wc,
+                   (unsigned long)wide[i]);
+            return 1;
+        }
+        pos += r;
+    }
+    if (pos != n) {
+        printf("mbrtowc consumed %zu of %zu\n", pos, n);
+        ret = 1;
+    }
+
+    /* Stopping early leaves src at the next character */
+    src = s;
+    if (mbsnrtowcs(wide, &src, n, 10, &ps) != 10 || src != s + 10) {
+        printf("mbsnrtowcs len limit\n");
+        ret = 1;
+    }
+
+    wsrc = wide;
+    src = s;
+    mbsrtowcs(wide, &src, 128, &ps);
+    bytes = wcsnrtombs(back, &wsrc, len + 1, sizeof(back), &ps);
+    if (bytes != n || wsrc != NULL || strcmp(back, s) != 0) {
+        printf("wcsnrtombs round trip: %zu want %zu\n", bytes, n);
+        ret = 1;
+    }
+    return ret;
+}
+
+int
+main(void)
+{
+    char        buf[sizeof(mb) + 8];
+    const char *src;
+    wchar_t     wide[8];
+    mbstate_t   ps = { 0 };
+    unsigned    off;
+    int         ret = 0;
+
+#if defined(__PICOLIBC__) && !defined(__MB_CAPABLE)
+    printf("skipping, no multibyte support\n");
+    return 77;
+#endif
+    if (!setlocale(LC_CTYPE, "C.UTF-8")) {
+        printf("no C.UTF-8 locale\n");
+        return 77;
+    }
+
+    for (off = 0; off < 8; off++) {
+        memcpy(buf + off, mb, sizeof(mb));
+        ret |= check_string(buf + off, sizeof(mb) - 1);
+    }
+
+    /* Invalid sequences still fail after a run of ASCII */
+    src = "abcdefgh\xc0\x80";
+    errno = 0;
+    if (mbsrtowcs(wide, &src, 8, &ps) != 8 || mbsrtowcs(wide, &src, 8, &ps) != (size_t)-1
+        || errno != EILSEQ) {
+        printf("overlong sequence accepted\n");
+        ret = 1;
+    }
+
+    /* A sequence split by the byte limit is picked up by the next call */
+    memset(&ps, 0, sizeof(ps));
+    src = "ab\xe2\x82\xac";
+    if (mbsnrtowcs(wide, &src, 4, 8, &ps) != 2 || mbsnrtowcs(wide, &src, 1, 8, &ps) != 1
+        || wide[0] != 0x20ac) {
+        printf("split sequence\n");
+        ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check wcslen, wcschr, wcscmp, wmemchr and wmemset against simple
+ * loops for every length and match position up to a few times the
+ * unroll factor, so each exit from the unrolled loops and the tails
+ * after them is taken at least once.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+
+#define LEN 19
+
+static int
+sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+int
+main(void)
+{
+    static const wchar_t fills[] = { 0, 0x41, 0x4e00, (wchar_t)0x01010101, (wchar_t)-1 };
+    wchar_t              a[LEN + 2], b[LEN + 2];
+    size_t               n, i, f;
+    int                  ret = 0;
+
+    for (n = 0; n <= LEN; n++) {
+        for (i = 0; i < n; i++)
+            a[i] = b[i] = 0x100 + i;
+        a[n] = b[n] = 0;
+        a[n + 1] = b[n + 1] = 0x7f;
+
+        if (wcslen(a) != n) {
+            printf("wcslen %zu is %zu\n", n, wcslen(a));
+            ret = 1;
+        }
+        if (wcscmp(a, b) != 0) {
+            printf("wcscmp %zu equal is %d\n", n, wcscmp(a, b));
+            ret = 1;
+        }
+        if (wcschr(a, 0) != a + n) {
+            printf("wcschr %zu nul\n", n);
+            ret = 1;
+        }
+        if (wcschr(a, 0x7f) != NULL) {
+            printf("wcschr %zu found past the end\n", n);
+            ret = 1;
+        }
+        if (wmemchr(a, 0x7f, n + 1) != NULL || wmemchr(a, 0x7f, n + 2) != a + n + 1) {
+            printf("wmemchr %zu length\n", n);
+            ret = 1;
+        }
+        for (i = 0; i < n; i++) {
+            if (wcschr(a, 0x100 + i) != a + i) {
+                printf("wcschr %zu at %zu\n", n, i);
+                ret = 1;
+            }
+            if (wmemchr(a, 0x100 + i, n) != a + i) {
+                printf("wmemchr %zu at %zu\n", n, i);
+                ret = 1;
+            }
+            b[i] = 0x100 + i + 1;
+            if (sign(wcscmp(a, b)) != -1 || sign(wcscmp(b, a)) != 1) {
+                printf("wcscmp %zu differ at %zu\n", n, i);
+                ret = 1;
+            }
+            b[i] = 0;
+            if (sign(wcscmp(a, b)) != 1 || sign(wcscmp(b, a)) != -1) {
+                printf("wcscmp %zu shorter at %zu\n", n, i);
+                ret = 1;
+            }
+            b[i] = 0x100 + i;
+        }
+
+        for (f = 0; f < sizeof(fills) / sizeof(fills[0]); f++) {
+            a[n] = 0x7f;
+            if (wmemset(a, fills[f], n) != a) {
+                printf("wmemset %zu return\n", n);
+                ret = 1;
+            }
+            for (i = 0; i < n; i++) {
+                if (a[i] != fills[f]) {
+                    printf("wmemset %zu fill %zu at %zu\n", n, f, i);
+                    ret = 1;
+                    break;
+                }
+            }
+            if (a[n] != 0x7f) {
+                printf("wmemset %zu fill %zu overran\n", n, f);
+                ret = 1;
+            }
+        }
+    }
+    return ret;
+}
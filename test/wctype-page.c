@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Spot check the wide character classes and case mappings in blocks
+ * with different layouts: ASCII, alternating and offset case pairs,
+ * title case, ideographs, separators and the supplementary planes.
+ * The answers are the same whether they come from the page-indexed
+ * tables or the binary searches.
+ */
+
+#define _GNU_SOURCE
+#include <locale.h>
+#include <stdio.h>
+#include <wchar.h>
+#include <wctype.h>
+
+static const struct {
+    wint_t c;
+    char   alpha, upper, lower, space, punct;
+    wint_t toupper, tolower;
+} checks[] = {
+    { 0x00041, 1, 1, 0, 0, 0, 0x00041, 0x00061 },
+    { 0x00061, 1, 0, 1, 0, 0, 0x00041, 0x00061 },
+    { 0x000b5, 1, 0, 1, 0, 0, 0x0039c, 0x000b5 },
+    { 0x000df, 1, 0, 1, 0, 0, 0x000df, 0x000df },
+    { 0x001c5, 1, 1, 1, 0, 0, 0x001c4, 0x001c6 },
+    { 0x00100, 1, 1, 0, 0, 0, 0x00100, 0x00101 },
+    { 0x00101, 1, 0, 1, 0, 0, 0x00100, 0x00101 },
+    { 0x003a3, 1, 1, 0, 0, 0, 0x003a3, 0x003c3 },
+    { 0x003c3, 1, 0, 1, 0, 0, 0x003a3, 0x003c3 },
+    { 0x04e00, 1, 0, 0, 0, 0, 0x04e00, 0x04e00 },
+    { 0x02028, 0, 0, 0, 1, 0, 0x02028, 0x02028 },
+    { 0x03000, 0, 0, 0, 1, 0, 0x03000, 0x03000 },
+    { 0x0ff21, 1, 1, 0, 0, 0, 0x0ff21, 0x0ff41 },
+#if __SIZEOF_WCHAR_T__ > 2
+    { 0x10400, 1, 1, 0, 0, 0, 0x10400, 0x10428 },
+    { 0x10428, 1, 0, 1, 0, 0, 0x10400, 0x10428 },
+    { 0x1e900, 1, 1, 0, 0, 0, 0x1e900, 0x1e922 },
+    { 0x1e943, 1, 0, 1, 0, 0, 0x1e921, 0x1e943 },
+    { 0xe0100, 0, 0, 0, 0, 1, 0xe0100, 0xe0100 },
+    { 0xe01f0, 0, 0, 0, 0, 0, 0xe01f0, 0xe01f0 },
+#endif
+};
+
+#define NCHECKS (sizeof(checks) / sizeof(checks[0]))
+
+int
+main(void)
+{
+    unsigned i;
+    int      ret = 0;
+
+#if defined(__PICOLIBC__) && !defined(__MB_CAPABLE)
+    printf("skipping, no multibyte support\n");
+    return 77;
+#endif
+    if (!setlocale(LC_CTYPE, "C.UTF-8")) {
+        printf("no C.UTF-8 locale\n");
+        return 77;
+    }
+
+    for (i = 0; i < NCHECKS; i++) {
+        wint_t c = checks[i].c;
+
+        if (!iswalpha(c) != !checks[i].alpha || !iswupper(c) != !checks[i].upper
+            || !iswlower(c) != !checks[i].lower || !iswspace(c) != !checks[i].space
+            || !iswpunct(c) != !checks[i].punct) {
+            printf("classes of U+%04lx\n", (unsigned long)c);
+            ret = 1;
+        }
+        if (towupper(c) != checks[i].toupper || towlower(c) != checks[i].tolower) {
+            printf("case of U+%04lx: %lx %lx\n", (unsigned long)c, (unsigned long)towupper(c),
+                   (unsigned long)towlower(c));
+            ret = 1;
+        }
+    }
+
+    if (iswalpha(WEOF) || iswprint(WEOF) || towupper(WEOF) != WEOF || towlower(WEOF) != WEOF) {
+        printf("WEOF\n");
+        ret = 1;
+    }
+
+    /* Outside of ASCII, the C locale has no classes and no case */
+    setlocale(LC_CTYPE, "C");
+    if (iswalpha(0x3a3) || towlower(0x3a3) != 0x3a3 || towupper(0x101) != 0x101) {
+        printf("C locale\n");
+        ret = 1;
+    }
+    if (!iswupper('A') || towlower('A') != 'a') {
+        printf("C locale ASCII\n");
+        ret = 1;
+    }
+    return ret;
+}
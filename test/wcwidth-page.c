@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check wcwidth and wcswidth at code points from each of the width
+ * tables and at the edges of the page table. The answers are the same
+ * with the page table or the binary searches.
+ */
+
+#define _GNU_SOURCE
+#include <locale.h>
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+
+static const struct {
+    wchar_t c;
+    int     width, cjk;
+} checks[] = {
+    { 0x00041, 1, 1 },   { 0x0007f, -1, -1 }, { 0x0009f, -1, -1 }, { 0x000a1, 1, 2 },
+    { 0x000ad, 1, 1 },   { 0x00300, 0, 0 },   { 0x0036f, 0, 0 },   { 0x00370, 1, 1 },
+    { 0x01100, 2, 2 },   { 0x01160, 0, 0 },   { 0x0200b, 0, 0 },   { 0x02010, 1, 2 },
+    { 0x03000, 2, 2 },   { 0x04e00, 2, 2 },   { 0x0ac00, 2, 2 },   { 0x0fe00, 0, 0 },
+    { 0x0ff01, 2, 2 },   { 0x0fffd, 1, 2 },
+#if __SIZEOF_WCHAR_T__ > 2
+    { 0x1f600, 2, 2 },   { 0x20000, 2, 2 },   { 0x3fffd, 2, 2 },   { 0x3fffe, 1, 1 },
+    { 0xe0001, 0, 0 },   { 0xe01ef, 0, 0 },   { 0xf0000, 1, 2 },   { 0x10fffd, 1, 2 },
+    { 0x10fffe, 1, 1 },
+#endif
+};
+
+#define NCHECKS (sizeof(checks) / sizeof(checks[0]))
+
+int
+main(void)
+{
+    static const wchar_t text[] = { 'a', 0x4e00, 0x0300, 'b', 0x00a1, 0 };
+    unsigned             i;
+    int                  ret = 0;
+
+#if defined(__PICOLIBC__) && !defined(__MB_CAPABLE)
+    printf("skipping, no multibyte support\n");
+    return 77;
+#endif
+    if (!setlocale(LC_CTYPE, "C.UTF-8")) {
+        printf("no C.UTF-8 locale\n");
+        return 77;
+    }
+
+    for (i = 0; i < NCHECKS; i++) {
+        if (wcwidth(checks[i].c) != checks[i].width) {
+            printf("wcwidth U+%04lx is %d should be %d\n", (unsigned long)checks[i].c,
+                   wcwidth(checks[i].c), checks[i].width);
+            ret = 1;
+        }
+    }
+    if (wcwidth(0) != 0) {
+        printf("wcwidth U+0000 is %d\n", wcwidth(0));
+        ret = 1;
+    }
+    if (wcswidth(text, 5) != 5 || wcswidth(text, 2) != 3) {
+        printf("wcswidth %d %d\n", wcswidth(text, 5), wcswidth(text, 2));
+        ret = 1;
+    }
+
+#if defined(__PICOLIBC__) && defined(__MB_EXTENDED_CHARSETS_JIS)
+    /* Ambiguous characters are wide in the CJK locales */
+    if (setlocale(LC_CTYPE, "C.EUC-JP")) {
+        for (i = 0; i < NCHECKS; i++) {
+            if (wcwidth(checks[i].c) != checks[i].cjk) {
+                printf("EUC-JP wcwidth U+%04lx is %d should be %d\n",
+                       (unsigned long)checks[i].c, wcwidth(checks[i].c), checks[i].cjk);
+                ret = 1;
+            }
+        }
+        if (wcswidth(text, 5) != 6) {
+            printf("EUC-JP wcswidth %d\n", wcswidth(text, 5));
+            ret = 1;
+        }
+    }
+#endif
+    return ret;
+}
@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Encode a stream of records through xdrstdio on a buffered FILE and
+ * decode it again. With fast bufio, XDR_INLINE hands out pointers into
+ * the FILE buffer, so records are sized to straddle buffer refills and
+ * flushes, and plain getc/ungetc calls are mixed in to check the
+ * fallback paths. The encoding must match xdrmem byte for byte.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <arpa/inet.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+
+#define NREC  300
+#define NVAL  7
+#define SPACE (NREC * (NVAL + 2) * 8 + 64)
+
+static union {
+    int32_t align;
+    char    b[SPACE];
+} file_data, mem_data;
+
+static size_t file_len, file_pos;
+
+static ssize_t
+mem_write(void *cookie, const void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > SPACE - file_len)
+        n = SPACE - file_len;
+    memcpy(file_data.b + file_len, buf, n);
+    file_len += n;
+    return n;
+}
+
+/* Short reads, so the buffer refills in odd sized pieces */
+static ssize_t
+mem_read(void *cookie, void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > 61)
+        n = 61;
+    if (n > file_len - file_pos)
+        n = file_len - file_pos;
+    memcpy(buf, file_data.b + file_pos, n);
+    file_pos += n;
+    return n;
+}
+
+struct rec {
+    int      id;
+    u_int    flags;
+    int32_t  vals[NVAL];
+    double   scale;
+    uint64_t stamp;
+};
+
+static bool_t
+xdr_rec_t(XDR *xdrs, struct rec *r)
+{
+    int32_t *buf = XDR_INLINE(xdrs, 2 * BYTES_PER_XDR_UNIT);
+
+    if (buf) {
+        if (xdrs->x_op == XDR_ENCODE) {
+            IXDR_PUT_LONG(buf, r->id);
+            IXDR_PUT_U_LONG(buf, r->flags);
+        } else {
+            r->id = IXDR_GET_LONG(buf);
+            r->flags = IXDR_GET_U_LONG(buf);
+        }
+    } else if (!xdr_int(xdrs, &r->id) || !xdr_u_int(xdrs, &r->flags))
+        return FALSE;
+    return xdr_vector(xdrs, (char *)r->vals, NVAL, sizeof(int32_t), (xdrproc_t)xdr_int32_t)
+        && xdr_double(xdrs, &r->scale) && xdr_uint64_t(xdrs, &r->stamp);
+}
+
+static void
+make(struct rec *r, int i)
+{
+    int j;
+
+    memset(r, 0, sizeof(*r));
+    r->id = i * 7 - 100;
+    r->flags = 0x80000000u | (u_int)i;
+    for (j = 0; j < NVAL; j++)
+        r->vals[j] = (int32_t)(i * 0x01010101 + j);
+    r->scale = i / 8.0;
+    r->stamp = ((uint64_t)i << 40) | 0x12345u;
+}
+
+int
+main(void)
+{
+    XDR        xdrs;
+    struct rec r, want;
+    FILE      *f;
+    u_int      mem_len;
+    int        i, c;
+    int        errors = 0;
+
+    xdrmem_create(&xdrs, mem_data.b, sizeof(mem_data.b), XDR_ENCODE);
+    for (i = 0; i < NREC; i++) {
+        make(&r, i);
+        if (!xdr_rec_t(&xdrs, &r)) {
+            printf("xdrmem encode %d failed\n", i);
+            return 1;
+        }
+    }
+    mem_len = xdr_getpos(&xdrs);
+    xdr_destroy(&xdrs);
+
+    f = fwopen(NULL, mem_write);
+    if (!f) {
+        printf("fwopen failed\n");
+        return 1;
+    }
+    xdrstdio_create(&xdrs, f, XDR_ENCODE);
+    for (i = 0; i < NREC; i++) {
+        make(&r, i);
+        if (!xdr_rec_t(&xdrs, &r)) {
+            printf("xdrstdio encode %d failed\n", i);
+            errors++;
+            break;
+        }
+    }
+    xdr_destroy(&xdrs);
+    fclose(f);
+
+    if (file_len != mem_len || memcmp(file_data.b, mem_data.b, mem_len) != 0) {
+        printf("xdrstdio encoding differs from xdrmem (%zu vs %u bytes)\n", file_len, mem_len);
+        errors++;
+    }
+
+    f = fropen(NULL, mem_read);
+    if (!f) {
+        printf("fropen failed\n");
+        return 1;
+    }
+    xdrstdio_create(&xdrs, f, XDR_DECODE);
+    for (i = 0; i < NREC; i++) {
+        if (i % 50 == 25) {
+            /* A pending ungetc must be seen by the next decode */
+            c = getc(f);
+            ungetc(c, f);
+        }
+        make(&want, i);
+        memset(&r, 0, sizeof(r));
+        if (!xdr_rec_t(&xdrs, &r)) {
+            printf("xdrstdio decode %d failed\n", i);
+            errors++;
+            break;
+        }
+        if (memcmp(&r, &want, sizeof(r)) != 0) {
+            printf("record %d decoded wrong\n", i);
+            errors++;
+        }
+    }
+    if (i == NREC && xdr_int(&xdrs, &r.id)) {
+        printf("decode past the end succeeded\n");
+        errors++;
+    }
+    xdr_destroy(&xdrs);
+    fclose(f);
+
+    return errors != 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 M65832 Project
+ *
+ * Check that xdr_vector and xdr_array, which copy arrays of 32- and
+ * 64-bit integers, floats and doubles through XDR_INLINE in one go,
+ * produce the same encoding as the element procedures called one at
+ * a time, decode it back, and fail cleanly when the buffer is short.
+ * Unaligned memory streams cannot inline and take the per-element
+ * path, so they are checked too. Single floats and doubles, which
+ * also go through XDR_INLINE when they can, are compared bit for bit
+ * with the big-endian IEEE encoding.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+
+#define NELEM 37
+
+static xdrproc_t slow_proc;
+
+/* Hides the element procedure from the bulk path */
+static bool_t
+slow(XDR *xdrs, void *p)
+{
+    return (*slow_proc)(xdrs, p);
+}
+
+static int errors;
+
+static void
+check(const char *name, xdrproc_t proc, u_int elsize, void *vals)
+{
+    static union {
+        int32_t align;
+        char    b[NELEM * 8 + 8];
+    } want, got;
+    char     back[NELEM * 8];
+    char    *arr;
+    u_int    n;
+    int      off;
+    XDR      x;
+
+    /* Reference encoding, one element at a time */
+    slow_proc = proc;
+    xdrmem_create(&x, want.b, sizeof(want.b), XDR_ENCODE);
+    if (!xdr_vector(&x, vals, NELEM, elsize, (xdrproc_t)slow)) {
+        printf("%s: reference encode failed\n", name);
+        errors++;
+        return;
+    }
+
+    for (off = 0; off < 2; off++) {
+        memset(got.b, 0xa5, sizeof(got.b));
+        xdrmem_create(&x, got.b + off, NELEM * elsize, XDR_ENCODE);
+        if (!xdr_vector(&x, vals, NELEM, elsize, proc)
+            || memcmp(got.b + off, want.b, NELEM * elsize) != 0
+            || xdr_getpos(&x) != NELEM * elsize) {
+            printf("%s: xdr_vector encode at offset %d differs\n", name, off);
+            errors++;
+        }
+
+        memset(back, 0, sizeof(back));
+        xdrmem_create(&x, got.b + off, NELEM * elsize, XDR_DECODE);
+        if (!xdr_vector(&x, back, NELEM, elsize, proc) || memcmp(back, vals, NELEM * elsize)) {
+            printf("%s: xdr_vector decode at offset %d differs\n", name, off);
+            errors++;
+        }
+
+        /* One element short */
+        xdrmem_create(&x, got.b + off, (NELEM - 1) * elsize, XDR_DECODE);
+        if (xdr_vector(&x, back, NELEM, elsize, proc)) {
+            printf("%s: xdr_vector decode of a short buffer succeeded\n", name);
+            errors++;
+        }
+    }
+
+    /* xdr_array, allocating on decode */
+    n = NELEM;
+    xdrmem_create(&x, got.b, sizeof(got.b), XDR_ENCODE);
+    arr = vals;
+    if (!xdr_array(&x, &arr, &n, NELEM, elsize, proc)
+        || memcmp(got.b + 4, want.b, NELEM * elsize) != 0) {
+        printf("%s: xdr_array encode differs\n", name);
+        errors++;
+    }
+    xdrmem_create(&x, got.b, sizeof(got.b), XDR_DECODE);
+    arr = NULL;
+    n = 0;
+    if (!xdr_array(&x, &arr, &n, NELEM, elsize, proc) || n != NELEM || !arr
+        || memcmp(arr, vals, NELEM * elsize) != 0) {
+        printf("%s: xdr_array decode differs\n", name);
+        errors++;
+    }
+    x.x_op = XDR_FREE;
+    if (!xdr_array(&x, &arr, &n, NELEM, elsize, proc) || arr != NULL) {
+        printf("%s: xdr_array free failed\n", name);
+        errors++;
+    }
+}
+
+/* xdr_float and xdr_double one value at a time, against the IEEE bits */
+static void
+check_bits(void)
+{
+    static const uint64_t dbits[] = {
+        0, 0x8000000000000000ULL, 0x3ff0000000000000ULL, 0x7ff0000000000000ULL,
+        0xfff8000000000001ULL, 0x7ff4000000000000ULL, 0x0000000000000001ULL,
+        0x800fffffffffffffULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL,
+    };
+    static union {
+        int32_t align;
+        char    b[16];
+    } buf;
+    unsigned char want[8];
+    unsigned      i, j, off;
+    double        d, back;
+    float         f, fback;
+    uint32_t      fb;
+    XDR           x;
+
+    for (i = 0; i < sizeof(dbits) / sizeof(dbits[0]); i++) {
+        for (j = 0; j < 8; j++)
+            want[j] = (unsigned char)(dbits[i] >> (56 - 8 * j));
+        for (off = 0; off < 2; off++) {
+            if (sizeof(double) == 8) {
+                memcpy(&d, &dbits[i], 8);
+                memset(buf.b, 0xa5, sizeof(buf.b));
+                xdrmem_create(&x, buf.b + off, 8, XDR_ENCODE);
+                if (!xdr_double(&x, &d) || memcmp(buf.b + off, want, 8) != 0) {
+                    printf("xdr_double encode of %016llx at offset %u differs\n",
+                           (unsigned long long)dbits[i], off);
+                    errors++;
+                }
+                xdrmem_create(&x, buf.b + off, 8, XDR_DECODE);
+                if (!xdr_double(&x, &back) || memcmp(&back, &d, 8) != 0) {
+                    printf("xdr_double decode of %016llx at offset %u differs\n",
+                           (unsigned long long)dbits[i], off);
+                    errors++;
+                }
+                xdrmem_create(&x, buf.b + off, 7, XDR_DECODE);
+                if (xdr_double(&x, &back)) {
+                    printf("xdr_double decode of a short buffer succeeded\n");
+                    errors++;
+                }
+            }
+
+            fb = (uint32_t)(dbits[i] >> 32);
+            memcpy(&f, &fb, 4);
+            xdrmem_create(&x, buf.b + off, 4, XDR_ENCODE);
+            if (!xdr_float(&x, &f) || memcmp(buf.b + off, want, 4) != 0) {
+                printf("xdr_float encode of %08lx differs\n", (unsigned long)fb);
+                errors++;
+            }
+            xdrmem_create(&x, buf.b + off, 4, XDR_DECODE);
+            if (!xdr_float(&x, &fback) || memcmp(&fback, &f, 4) != 0) {
+                printf("xdr_float decode of %08lx differs\n", (unsigned long)fb);
+                errors++;
+            }
+        }
+    }
+}
+
+int
+main(void)
+{
+    static int32_t  i32[NELEM];
+    static uint32_t u32[NELEM];
+    static int64_t  i64[NELEM];
+    static float    f[NELEM];
+    static double   d[NELEM];
+    int             i;
+
+    for (i = 0; i < NELEM; i++) {
+        i32[i] = (int32_t)(0x01020304 * (i + 1)) ^ -(i & 1);
+        u32[i] = 0xdeadbeefU * (uint32_t)i;
+        i64[i] = (int64_t)0x0102030405060708LL * (i - NELEM / 2);
+        f[i] = (float)i * -1.25f;
+        d[i] = (double)i * 3.0e100 - 1.0 / 3.0;
+    }
+
+    check("xdr_int32_t", (xdrproc_t)xdr_int32_t, 4, i32);
+    check("xdr_u_int32_t", (xdrproc_t)xdr_u_int32_t, 4, u32);
+    if (sizeof(int) == 4) {
+        check("xdr_int", (xdrproc_t)xdr_int, 4, i32);
+        check("xdr_u_int", (xdrproc_t)xdr_u_int, 4, u32);
+    }
+    check("xdr_int64_t", (xdrproc_t)xdr_int64_t, 8, i64);
+    check("xdr_u_hyper", (xdrproc_t)xdr_u_hyper, 8, i64);
+    check("xdr_float", (xdrproc_t)xdr_float, sizeof(float), f);
+    if (sizeof(double) == 8)
+        check("xdr_double", (xdrproc_t)xdr_double, 8, d);
+
+    check_bits();
+
+    return errors != 0;
+}